@@ -61,24 +61,13 @@ SPtr<TAddrIA> TAddrClient::getIA() {
 }
 
 SPtr<TAddrIA> TAddrClient::getIA(unsigned long IAID) {
-    SPtr<TAddrIA> ptr;
-    IAsLst.first();
-
-    while ( ptr = IAsLst.get() ) {
-        if (ptr->getIAID() == IAID) {
-            return ptr;
-        }
-    }
-    return SPtr<TAddrIA>();
+    return IAsLst.find(IAID);
 }
 
 void TAddrClient::addIA(SPtr<TAddrIA> ia) {
-    if (getIA(ia->getIAID()))
-    {
+    if (!IAsLst.insert(ia)) {
         Log(Debug) << "Unable to add IA (iaid=" << ia->getIAID() << "), such IA already exists." << LogEnd;
-              return;
     }
-    IAsLst.append(ia);
 }
 
 /**
@@ -89,20 +78,16 @@ void TAddrClient::addIA(SPtr<TAddrIA> ia) {
  * @return number of IAs
  */
 int TAddrClient::countIA() {
-    return IAsLst.count();
+    return IAsLst.size();
 }
 
-bool TAddrClient::delIA(unsigned long IAID) {
-    SPtr<TAddrIA> ptr;
-    IAsLst.first();
+/// @brief returns IAs (may be traversed with iterators, independently of firstIA()/getIA())
+const TAddrIAMap& TAddrClient::getIAs() const {
+    return IAsLst;
+}
 
-    while ( ptr = IAsLst.get() ) {
-        if (ptr->getIAID() == IAID) {
-            IAsLst.del();
-            return true;
-        }
-    }
-    return false;
+bool TAddrClient::delIA(unsigned long IAID) {
+    return IAsLst.erase(IAID);
 }
 
 // --- PD ------------------------------------------------------------
@@ -112,15 +97,7 @@ SPtr<TAddrIA> TAddrClient::getPD() {
 }
 
 SPtr<TAddrIA> TAddrClient::getPD(unsigned long IAID) {
-    SPtr<TAddrIA> ptr;
-    PDLst.first();
-
-    while ( ptr = PDLst.get() ) {
-        if (ptr->getIAID() == IAID) {
-            return ptr;
-        }
-    }
-    return SPtr<TAddrIA>();
+    return PDLst.find(IAID);
 }
 
 void TAddrClient::firstPD() {
@@ -128,24 +105,21 @@ void TAddrClient::firstPD() {
 }
 
 void TAddrClient::addPD(SPtr<TAddrIA> pd) {
-    PDLst.append(pd);
+    if (!PDLst.insert(pd)) {
+        Log(Debug) << "Unable to add PD (iaid=" << pd->getIAID() << "), such PD already exists." << LogEnd;
+    }
 }
 
 int TAddrClient::countPD() {
-    return PDLst.count();
+    return PDLst.size();
 }
 
-bool TAddrClient::delPD(unsigned long IAID) {
-    SPtr<TAddrIA> ptr;
-    PDLst.first();
+const TAddrIAMap& TAddrClient::getPDs() const {
+    return PDLst;
+}
 
-    while ( ptr = PDLst.get() ) {
-        if (ptr->getIAID() == IAID) {
-            PDLst.del();
-            return true;
-        }
-    }
-    return false;
+bool TAddrClient::delPD(unsigned long IAID) {
+    return PDLst.erase(IAID);
 }
 
 // --- TA ------------------------------------------------------------
@@ -155,15 +129,7 @@ SPtr<TAddrIA> TAddrClient::getTA() {
 }
 
 SPtr<TAddrIA> TAddrClient::getTA(unsigned long IAID) {
-    SPtr<TAddrIA> ptr;
-    TALst.first();
-
-    while ( ptr = TALst.get() ) {
-        if (ptr->getIAID() == IAID) {
-            return ptr;
-        }
-    }
-    return SPtr<TAddrIA>();
+    return TALst.find(IAID);
 }
 
 void TAddrClient::firstTA() {
@@ -171,23 +137,21 @@ void TAddrClient::firstTA() {
 }
 
 void TAddrClient::addTA(SPtr<TAddrIA> ia) {
-    TALst.append(ia);
+    if (!TALst.insert(ia)) {
+        Log(Debug) << "Unable to add TA (iaid=" << ia->getIAID() << "), such TA already exists." << LogEnd;
+    }
 }
 
 int TAddrClient::countTA() {
-    return TALst.count();
+    return TALst.size();
+}
+
+const TAddrIAMap& TAddrClient::getTAs() const {
+    return TALst;
 }
 
 bool TAddrClient::delTA(unsigned long iaid) {
-    SPtr<TAddrIA> ptr;
-    TALst.first();
-    while ( ptr = TALst.get() ) {
-        if (ptr->getIAID() == iaid) {
-            TALst.del();
-            return true;
-        }
-    }
-    return false;
+    return TALst.erase(iaid);
 }
 
 // --------------------------------------------------------------------
@@ -198,8 +162,8 @@ unsigned long TAddrClient::getT1Timeout() {
     SPtr<TAddrIA> ptr;
     unsigned long ts = UINT_MAX;
 
-    IAsLst.first();
-    while ( ptr = IAsLst.get() ) {
+    for (TAddrIAMap::const_iterator it = IAsLst.begin(); it != IAsLst.end(); ++it) {
+        ptr = *it;
         if (ptr->getState()==STATE_CONFIGURED) {
             if (ts > ptr->getT1Timeout())
                 ts = ptr->getT1Timeout();
@@ -208,8 +172,8 @@ unsigned long TAddrClient::getT1Timeout() {
         }
     }
 
-    PDLst.first();
-    while ( ptr = PDLst.get() ) {
+    for (TAddrIAMap::const_iterator it = PDLst.begin(); it != PDLst.end(); ++it) {
+        ptr = *it;
         if (ptr->getState()!=STATE_CONFIGURED)
             continue;
         if (ts > ptr->getT1Timeout())
@@ -221,17 +185,16 @@ unsigned long TAddrClient::getT1Timeout() {
 unsigned long TAddrClient::getT2Timeout() {
     SPtr<TAddrIA> ptr;
     unsigned long ts = UINT_MAX;
-    IAsLst.first();
-
-    while ( ptr = IAsLst.get() ) {
+    for (TAddrIAMap::const_iterator it = IAsLst.begin(); it != IAsLst.end(); ++it) {
+        ptr = *it;
         if (ptr->getState()!=STATE_CONFIGURED)
             continue;
         if (ts > ptr->getT2Timeout())
             ts = ptr->getT2Timeout();
     }
 
-    PDLst.first();
-    while ( ptr = PDLst.get() ) {
+    for (TAddrIAMap::const_iterator it = PDLst.begin(); it != PDLst.end(); ++it) {
+        ptr = *it;
         if (ptr->getState()!=STATE_CONFIGURED)
             continue;
         if (ts > ptr->getT2Timeout())
@@ -245,16 +208,16 @@ unsigned long TAddrClient::getPrefTimeout() {
     SPtr<TAddrIA> ptr;
     unsigned long ts = UINT_MAX;
 
-    IAsLst.first();
-    while ( ptr = IAsLst.get() ) {
+    for (TAddrIAMap::const_iterator it = IAsLst.begin(); it != IAsLst.end(); ++it) {
+        ptr = *it;
         if (ptr->getState()!=STATE_CONFIGURED)
             continue;
         if (ts > ptr->getPrefTimeout())
             ts = ptr->getPrefTimeout();
     }
 
-    PDLst.first();
-    while ( ptr = PDLst.get() ) {
+    for (TAddrIAMap::const_iterator it = PDLst.begin(); it != PDLst.end(); ++it) {
+        ptr = *it;
         if (ptr->getState()!=STATE_CONFIGURED)
             continue;
         if (ts > ptr->getPrefTimeout())
@@ -268,20 +231,20 @@ unsigned long TAddrClient::getValidTimeout() {
     SPtr<TAddrIA> ptr;
     unsigned long ts = UINT_MAX;
 
-    IAsLst.first();
-    while ( ptr = IAsLst.get() ) {
+    for (TAddrIAMap::const_iterator it = IAsLst.begin(); it != IAsLst.end(); ++it) {
+        ptr = *it;
         if (ts > ptr->getValidTimeout())
             ts = ptr->getValidTimeout();
     }
 
-    TALst.first();
-    while ( ptr = TALst.get() ) {
+    for (TAddrIAMap::const_iterator it = TALst.begin(); it != TALst.end(); ++it) {
+        ptr = *it;
         if (ts > ptr->getValidTimeout())
             ts = ptr->getValidTimeout();
     }
 
-    PDLst.first();
-    while ( ptr = PDLst.get() ) {
+    for (TAddrIAMap::const_iterator it = PDLst.begin(); it != PDLst.end(); ++it) {
+        ptr = *it;
         if (ts > ptr->getValidTimeout())
             ts = ptr->getValidTimeout();
     }
@@ -294,21 +257,21 @@ unsigned long TAddrClient::getLastTimestamp() {
     unsigned long ts = 0;
     SPtr<TAddrIA> ptr;
 
-    IAsLst.first();
-    while ( ptr = IAsLst.get() ) {
+    for (TAddrIAMap::const_iterator it = IAsLst.begin(); it != IAsLst.end(); ++it) {
+        ptr = *it;
         if (ts < ptr->getTimestamp())
             ts = ptr->getTimestamp();
     }
 
-    firstTA();
-    while ( ptr = getTA() ) {
+    for (TAddrIAMap::const_iterator it = TALst.begin(); it != TALst.end(); ++it) {
+        ptr = *it;
         if (ts < ptr->getTimestamp())
             ts = ptr->getTimestamp();
     }
 
 
-    PDLst.first();
-    while ( ptr = PDLst.get() ) {
+    for (TAddrIAMap::const_iterator it = PDLst.begin(); it != PDLst.end(); ++it) {
+        ptr = *it;
         if (ts > ptr->getTimestamp())
             ts = ptr->getTimestamp();
     }
@@ -347,41 +310,52 @@ void TAddrClient::generateReconfKey() {
 // --------------------------------------------------------------------
 
 std::ostream & operator<<(std::ostream & strum, TAddrClient &x)
+{
+    x.print(strum, true);
+    return strum;
+}
+
+/// @brief prints client in the lease database format
+///
+/// @param strum output stream
+/// @param withTA should temporary addresses be printed?
+void TAddrClient::print(std::ostream& strum, bool withTA)
 {
     strum << "  <AddrClient>" << endl;
-    if (x.DUID_->getLen())
-        strum << "    " << *x.DUID_;
-    if (x.DUID_->getLen()==1)
+    if (DUID_->getLen())
+        strum << "    " << *DUID_;
+    if (DUID_->getLen()==1)
         strum << "  <!-- 1-byte length DUID. DECLINED-ADDRESSES -->" << endl;
 
     // reconfigure-key
-	if (!x.ReconfKey_.empty()) {
-		strum << "    <ReconfigureKey length=\"" << x.ReconfKey_.size() << "\">"
-	          << hexToText(&x.ReconfKey_[0], x.ReconfKey_.size(), false)
+	if (!ReconfKey_.empty()) {
+		strum << "    <ReconfigureKey length=\"" << ReconfKey_.size() << "\">"
+	          << hexToText(&ReconfKey_[0], ReconfKey_.size(), false)
 			  << "</ReconfigureKey>" << endl;
 	}
 	else {
 		strum << "    <ReconfigureKey />" << endl;
 	}
 
-    strum << "    <!-- " << x.IAsLst.count() << " IA(s) -->" << endl;
+    strum << "    <!-- " << IAsLst.size() << " IA(s) -->" << endl;
     SPtr<TAddrIA> ptr;
-    x.IAsLst.first();
-    while (ptr = x.IAsLst.get() ) {
+    for (TAddrIAMap::const_iterator it = IAsLst.begin(); it != IAsLst.end(); ++it) {
+        ptr = *it;
         strum << *ptr;
     }
 
-    strum << "    <!-- " << x.TALst.count() << " TA(s) -->" << endl;
-    x.TALst.first();
-    while (ptr = x.TALst.get() ) {
-        strum << *ptr;
+    if (withTA) {
+        strum << "    <!-- " << TALst.size() << " TA(s) -->" << endl;
+        for (TAddrIAMap::const_iterator it = TALst.begin(); it != TALst.end(); ++it) {
+            ptr = *it;
+            strum << *ptr;
+        }
     }
 
-    strum << "    <!-- " << x.PDLst.count() << " PD(s) -->" << endl;
-    x.PDLst.first();
-    while (ptr = x.PDLst.get() ) {
+    strum << "    <!-- " << PDLst.size() << " PD(s) -->" << endl;
+    for (TAddrIAMap::const_iterator it = PDLst.begin(); it != PDLst.end(); ++it) {
+        ptr = *it;
         strum << *ptr;
     }
     strum << "  </AddrClient>" << endl;
-    return strum;
 }
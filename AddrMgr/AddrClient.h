@@ -17,6 +17,7 @@ class TAddrClient;
 #include "SmartPtr.h"
 #include "Container.h"
 #include "AddrIA.h"
+#include "AddrIAMap.h"
 #include "DUID.h"
 #include "Portable.h"
 
@@ -35,6 +36,7 @@ public:
     void addIA(SPtr<TAddrIA> ia);
     bool delIA(unsigned long IAID);
     int countIA();
+    const TAddrIAMap& getIAs() const;
 
     //--- PD list ---
     void firstPD();
@@ -43,6 +45,7 @@ public:
     void addPD(SPtr<TAddrIA> ia);
     bool delPD(unsigned long IAID);
     int countPD();
+    const TAddrIAMap& getPDs() const;
 
     //--- TA list ---
     void firstTA();
@@ -51,6 +54,7 @@ public:
     void addTA(SPtr<TAddrIA> ia);
     bool delTA(unsigned long iaid);
     int countTA();
+    const TAddrIAMap& getTAs() const;
 
     // time related
     unsigned long getT1Timeout();
@@ -68,6 +72,8 @@ public:
 
     unsigned long getLastTimestamp();
 
+    void print(std::ostream& out, bool withTA);
+
     /// @brief 128 bits of pure randomness used in reconfigure process
     ///
     /// Reconfigure Key nonce is set be the server and the stored by the client.
@@ -76,9 +82,9 @@ public:
     std::vector<uint8_t> ReconfKey_;
 
 private:
-    List(TAddrIA) IAsLst;
-    List(TAddrIA) TALst;
-    List(TAddrIA) PDLst;
+    TAddrIAMap IAsLst;
+    TAddrIAMap TALst;
+    TAddrIAMap PDLst;
     SPtr<TDUID> DUID_;
 
     uint32_t SPI_;
@@ -188,11 +188,10 @@ SPtr<TAddrAddr> TAddrIA::getAddr(SPtr<TIPv6Addr> addr)
     if (!addr) {
 	return SPtr<TAddrAddr>();
     }
-    AddrLst.first();
-    SPtr <TAddrAddr> ptrAddr;
-    while (ptrAddr = AddrLst.get() ) {
-        if ( (*addr)==(*(ptrAddr->get())) )
-            return ptrAddr;
+    for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+         it != AddrLst.end(); ++it) {
+        if ( (*addr)==(*((*it)->get())) )
+            return *it;
     }
 
     return SPtr<TAddrAddr>();
@@ -205,12 +204,9 @@ int TAddrIA::countAddr()
 
 int TAddrIA::delAddr(SPtr<TIPv6Addr> addr)
 {
-    SPtr< TAddrAddr> ptr;
-    AddrLst.first();
-    while (ptr = AddrLst.get())
-    {
-        if (*(ptr->get())==(*addr)) {
-            AddrLst.del();
+    for (TAddrAddrLst::iterator it = AddrLst.begin(); it != AddrLst.end(); ++it) {
+        if (*((*it)->get())==(*addr)) {
+            AddrLst.erase(it);
             return 0;
         }
     }
@@ -247,30 +243,15 @@ int TAddrIA::countPrefix()
 
 bool TAddrIA::delPrefix(SPtr<TAddrPrefix> x)
 {
-    SPtr<TAddrPrefix> ptr;
-    PrefixLst.first();
-
-    while (ptr = PrefixLst.get())
-    {
-	/// @todo: should we compare prefix length, too?
-        if (*(ptr->get())==(*x->get())) {
-            PrefixLst.del();
-            return true;
-        }
-    }
-    return false;
+    return delPrefix(x->get());
 }
 
 bool TAddrIA::delPrefix(SPtr<TIPv6Addr> x)
 {
-    SPtr<TAddrPrefix> ptr;
-    PrefixLst.first();
-
-    while (ptr = PrefixLst.get())
-    {
+    for (TAddrPrefixLst::iterator it = PrefixLst.begin(); it != PrefixLst.end(); ++it) {
 	/// @todo: should we compare prefix length, too?
-        if (*(ptr->get())==(*x)) {
-            PrefixLst.del();
+        if (*((*it)->get())==(*x)) {
+            PrefixLst.erase(it);
             return true;
         }
     }
@@ -311,12 +292,10 @@ unsigned long TAddrIA::getT2Timeout() {
 unsigned long TAddrIA::getPrefTimeout() {
     unsigned long ts = UINT_MAX;
 
-    SPtr<TAddrAddr> ptr;
-    this->AddrLst.first();
-
-    while (ptr = this->AddrLst.get() ) {
-        if (ts > ptr->getPrefTimeout()) 
-            ts = ptr->getPrefTimeout();
+    for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+         it != AddrLst.end(); ++it) {
+        if (ts > (*it)->getPrefTimeout())
+            ts = (*it)->getPrefTimeout();
     }
     return ts;
 }
@@ -324,18 +303,16 @@ unsigned long TAddrIA::getPrefTimeout() {
 unsigned long TAddrIA::getMaxValidTimeout() {
     unsigned long ts = 0; // should be 0
 
-    SPtr<TAddrAddr> ptr;
-    this->AddrLst.first();
-    while (ptr = this->AddrLst.get() ) {
-        if (ts < ptr->getValidTimeout()) 
-            ts = ptr->getValidTimeout();
+    for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+         it != AddrLst.end(); ++it) {
+        if (ts < (*it)->getValidTimeout())
+            ts = (*it)->getValidTimeout();
     }
-    
-    SPtr<TAddrPrefix> prefix;
-    firstPrefix();
-    while (prefix = getPrefix()) {
-      if (ts < prefix->getValidTimeout())
-          ts = prefix->getValidTimeout();
+
+    for (TAddrPrefixLst::const_iterator it = PrefixLst.begin();
+         it != PrefixLst.end(); ++it) {
+        if (ts < (*it)->getValidTimeout())
+            ts = (*it)->getValidTimeout();
     }
 
     return ts;
@@ -344,19 +321,16 @@ unsigned long TAddrIA::getMaxValidTimeout() {
 unsigned long TAddrIA::getValidTimeout() {
     unsigned long ts = UINT_MAX;
 
-    SPtr<TAddrAddr> ptr;
-    this->AddrLst.first();
-
-    while (ptr = this->AddrLst.get() ) {
-        if (ts > ptr->getValidTimeout()) 
-            ts = ptr->getValidTimeout();
+    for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+         it != AddrLst.end(); ++it) {
+        if (ts > (*it)->getValidTimeout())
+            ts = (*it)->getValidTimeout();
     }
 
-    SPtr<TAddrPrefix> prefix;
-    firstPrefix();
-    while (prefix = getPrefix()) {
-      if (ts > prefix->getValidTimeout())
-          ts = prefix->getValidTimeout();
+    for (TAddrPrefixLst::const_iterator it = PrefixLst.begin();
+         it != PrefixLst.end(); ++it) {
+        if (ts > (*it)->getValidTimeout())
+            ts = (*it)->getValidTimeout();
     }
 
     return ts;
@@ -366,11 +340,9 @@ unsigned long TAddrIA::getValidTimeout() {
 void TAddrIA::setTimestamp(unsigned long ts)
 {
     this->Timestamp = ts;
-    SPtr<TAddrAddr> ptr;
-    AddrLst.first();
-    while (ptr = AddrLst.get() )
-    {
-        ptr->setTimestamp(ts);
+    for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+         it != AddrLst.end(); ++it) {
+        (*it)->setTimestamp(ts);
     }
 }
 
@@ -400,10 +372,10 @@ unsigned long TAddrIA::getTentativeTimeout()
     case ADDRSTATUS_NO:
         return DHCPV6_INFINITY;
     case ADDRSTATUS_UNKNOWN:
-        SPtr <TAddrAddr> ptrAddr;
-        AddrLst.first();
-        while ( ptrAddr = AddrLst.get() )
+        for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+             it != AddrLst.end(); ++it)
         {
+            SPtr<TAddrAddr> ptrAddr = *it;
             if (ptrAddr->getTentative()==ADDRSTATUS_UNKNOWN)
                 if (min > ptrAddr->getTimestamp()+DADTIMEOUT-(unsigned long)time(NULL) )
                 {
@@ -426,12 +398,11 @@ enum EAddrStatus TAddrIA::getTentative()
     if (Tentative != ADDRSTATUS_UNKNOWN)
     	return Tentative;
 
-    SPtr<TAddrAddr> ptrAddr;
-    AddrLst.first();
-
     bool allChecked = true;
 
-    while ( ptrAddr = AddrLst.get() ) {
+    for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+         it != AddrLst.end(); ++it) {
+        SPtr<TAddrAddr> ptrAddr = *it;
 	switch (ptrAddr->getTentative()) {
 	case ADDRSTATUS_YES:
 	    Log(Warning) << "DAD failed. Address " << ptrAddr->get()->getPlain() 
@@ -483,12 +454,12 @@ enum EAddrStatus TAddrIA::getTentative()
  */
 void TAddrIA::setTentative()
 {
-    SPtr<TAddrAddr> ptrAddr;
-    AddrLst.first();
     Tentative = ADDRSTATUS_NO;
 
-    while ( ptrAddr = AddrLst.get() ) 
+    for (TAddrAddrLst::const_iterator it = AddrLst.begin();
+         it != AddrLst.end(); ++it)
     {
+        SPtr<TAddrAddr> ptrAddr = *it;
         switch (ptrAddr->getTentative()) 
         {
             case ADDRSTATUS_YES:
@@ -579,15 +550,17 @@ std::ostream & operator<<(std::ostream & strum, TAddrIA &x) {
         strum << "      " << *x.DUID;
 
     // Address list
-    x.AddrLst.first();
-    while (ptr = x.AddrLst.get()) {
+    for (TAddrIA::TAddrAddrLst::const_iterator it = x.AddrLst.begin();
+         it != x.AddrLst.end(); ++it) {
+        ptr = *it;
 	if (ptr)
 	    strum << "      " << *ptr;
     }
 
     // Prefix list
-    x.PrefixLst.first();
-    while (prefix = x.PrefixLst.get()) {
+    for (TAddrIA::TAddrPrefixLst::const_iterator it = x.PrefixLst.begin();
+         it != x.PrefixLst.end(); ++it) {
+        prefix = *it;
 	    strum << "      " << *prefix;
     }
 
@@ -26,6 +26,8 @@ class TAddrIA;
 class TAddrIA
 {
   public:
+    typedef SmallList(TAddrAddr) TAddrAddrLst;
+    typedef SmallList(TAddrPrefix) TAddrPrefixLst;
 
     friend std::ostream & operator<<(std::ostream & strum,TAddrIA &x);
     TAddrIA(const std::string& ifacename, int ifindex, TIAType mode, SPtr<TIPv6Addr> addr, SPtr<TDUID> duid, 
@@ -62,10 +64,16 @@ class TAddrIA
     void addAddr(SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid);
     void addAddr(SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid, int prefix);
 
+    /// @brief returns addresses (traversal that doesn't use firstAddr()/getAddr() cursor)
+    const TAddrAddrLst& getAddrs() const { return AddrLst; }
+
     //--- prefix list related methods ---
     void firstPrefix();
     SPtr<TAddrPrefix> getPrefix();
 
+    /// @brief returns prefixes (traversal that doesn't use firstPrefix()/getPrefix() cursor)
+    const TAddrPrefixLst& getPrefixes() const { return PrefixLst; }
+
     void addPrefix(SPtr<TAddrPrefix> x);
     void addPrefix(SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid, int length);
     int countPrefix();
@@ -101,8 +109,8 @@ class TAddrIA
     SPtr<TFQDN> getFQDN();
 
 private:
-    List(TAddrAddr) AddrLst;
-    List(TAddrPrefix) PrefixLst;
+    TAddrAddrLst AddrLst;
+    TAddrPrefixLst PrefixLst;
 
     unsigned long IAID;
     unsigned long T1;
@@ -0,0 +1,119 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 licence
+ *
+ */
+
+#ifndef ADDRIAMAP_H
+#define ADDRIAMAP_H
+
+#include <vector>
+#include <algorithm>
+#include "SmartPtr.h"
+#include "AddrIA.h"
+
+/// @brief IAs (or TAs, or PDs) of a client, keyed by IAID
+///
+/// Flat map: IAIDs and IAs are kept in two vectors sorted by IAID, so
+/// lookups are binary searches over a contiguous array of keys. Clients
+/// rarely have more than a few IAs, but hosts with dozens of IAs (VM hosts,
+/// container nodes) are not uncommon.
+///
+/// IAs should be traversed with begin()/end(). Lookups and traversals with
+/// iterators don't modify the map, so they may be nested. The first()/get()
+/// cursor is kept for older code; it is not affected by find(), and erase()
+/// keeps it pointing at the element that follows the erased one.
+class TAddrIAMap
+{
+public:
+    typedef std::vector< SPtr<TAddrIA> >::const_iterator const_iterator;
+
+    TAddrIAMap()
+        :Cursor_(0) {
+    }
+
+    const_iterator begin() const {
+        return IAs_.begin();
+    }
+
+    const_iterator end() const {
+        return IAs_.end();
+    }
+
+    size_t size() const {
+        return IAs_.size();
+    }
+
+    bool empty() const {
+        return IAs_.empty();
+    }
+
+    /// @brief returns IA with specified IAID (or NULL)
+    SPtr<TAddrIA> find(unsigned long iaid) const {
+        size_t pos = lowerBound(iaid);
+        if (pos < Iaids_.size() && Iaids_[pos] == iaid)
+            return IAs_[pos];
+        return SPtr<TAddrIA>();
+    }
+
+    /// @brief adds IA (unless IA with the same IAID is already there)
+    ///
+    /// @return true if IA was added
+    bool insert(SPtr<TAddrIA> ia) {
+        unsigned long iaid = ia->getIAID();
+        size_t pos = lowerBound(iaid);
+        if (pos < Iaids_.size() && Iaids_[pos] == iaid)
+            return false;
+        Iaids_.insert(Iaids_.begin() + pos, iaid);
+        IAs_.insert(IAs_.begin() + pos, ia);
+        if (pos < Cursor_)
+            Cursor_++;
+        return true;
+    }
+
+    /// @brief removes IA with specified IAID
+    ///
+    /// @return true if IA was removed
+    bool erase(unsigned long iaid) {
+        size_t pos = lowerBound(iaid);
+        if (pos == Iaids_.size() || Iaids_[pos] != iaid)
+            return false;
+        Iaids_.erase(Iaids_.begin() + pos);
+        IAs_.erase(IAs_.begin() + pos);
+        if (pos < Cursor_)
+            Cursor_--;
+        return true;
+    }
+
+    void clear() {
+        Iaids_.clear();
+        IAs_.clear();
+        Cursor_ = 0;
+    }
+
+    /// @brief rewinds the cursor
+    void first() {
+        Cursor_ = 0;
+    }
+
+    /// @brief returns IA under the cursor and moves it (NULL at the end)
+    SPtr<TAddrIA> get() {
+        if (Cursor_ < IAs_.size())
+            return IAs_[Cursor_++];
+        return SPtr<TAddrIA>();
+    }
+
+private:
+    size_t lowerBound(unsigned long iaid) const {
+        return std::lower_bound(Iaids_.begin(), Iaids_.end(), iaid) - Iaids_.begin();
+    }
+
+    std::vector<unsigned long> Iaids_;
+    std::vector< SPtr<TAddrIA> > IAs_;
+    size_t Cursor_;
+};
+
+#endif
@@ -37,6 +37,7 @@ TAddrMgr::TAddrMgr(const std::string& xmlFile, bool loadfile)
         Log(Debug) << "Skipping database loading." << LogEnd;
     }
     DeleteEmptyClient = true;
+    DumpTA_ = true;
 }
 
 /**
@@ -88,6 +89,8 @@ void TAddrMgr::dump()
 void TAddrMgr::addClient(SPtr<TAddrClient> x)
 {
     ClntsLst.append(x);
+    SPtr<TDUID> duid = x->getDUID();
+    ClntIdx_[string(duid->get(), duid->getLen())] = x;
 }
 
 void TAddrMgr::firstClient()
@@ -103,7 +106,9 @@ SPtr<TAddrClient> TAddrMgr::getClient()
 /**
  * @brief returns client with a specified DUID
  *
- * returns client with a specified DUID
+ * returns client with a specified DUID. Clients are indexed by DUID,
+ * so this does not iterate over clients list (and does not move
+ * the iterator used by firstClient()/getClient()).
  *
  * @param duid client DUID
  *
@@ -111,14 +116,11 @@ SPtr<TAddrClient> TAddrMgr::getClient()
  */
 SPtr<TAddrClient> TAddrMgr::getClient(SPtr<TDUID> duid)
 {
-    SPtr<TAddrClient> ptr;
-    ClntsLst.first();
-    while (ptr = ClntsLst.get() )
-    {
-        if ( *(ptr->getDUID()) == (*duid) )
-            return ptr;
-    }
-    return SPtr<TAddrClient>();
+    std::map<std::string, SPtr<TAddrClient> >::const_iterator it =
+        ClntIdx_.find(string(duid->get(), duid->getLen()));
+    if (it == ClntIdx_.end())
+        return SPtr<TAddrClient>();
+    return it->second;
 }
 
 /**
@@ -183,6 +185,7 @@ bool TAddrMgr::delClient(SPtr<TDUID> duid)
         if  ((*ptr->getDUID())==(*duid))
         {
             ClntsLst.del();
+            ClntIdx_.erase(string(duid->get(), duid->getLen()));
             return true;
         }
     }
@@ -343,12 +346,7 @@ bool TAddrMgr::addPrefix(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr, const
                          SPtr<TIPv6Addr> prefix, unsigned long pref, unsigned long valid,
                          int length, bool quiet) {
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -376,12 +374,7 @@ bool TAddrMgr::addPrefix(SPtr<TAddrClient> client, SPtr<TDUID> duid , SPtr<TIPv6
     }
 
     // find this PD
-    SPtr <TAddrIA> ptrPD;
-    client->firstPD();
-    while ( ptrPD = client->getPD() ) {
-        if ( ptrPD->getIAID() == IAID)
-            break;
-    }
+    SPtr <TAddrIA> ptrPD = client->getPD(IAID);
 
     // have we found this PD?
     if (!ptrPD) {
@@ -428,12 +421,7 @@ bool TAddrMgr::updatePrefix(SPtr<TDUID> duid , SPtr<TIPv6Addr> addr, const std::
                             int length, bool quiet)
 {
     // find client...
-    SPtr <TAddrClient> client;
-    this->firstClient();
-    while ( client = this->getClient() ) {
-        if ( (*client->getDUID()) == (*duid) )
-            break;
-    }
+    SPtr<TAddrClient> client = getClient(duid);
     if (!client) {
         Log(Error) << "Unable to update prefix " << prefix->getPlain() << "/" << (int)length << ": DUID=" << duid->getPlain() << " not found." << LogEnd;
         return false;
@@ -457,12 +445,7 @@ bool TAddrMgr::updatePrefix(SPtr<TAddrClient> client, SPtr<TDUID> duid , SPtr<TI
     }
 
     // for that client, find IA
-    SPtr <TAddrIA> pd;
-    client->firstPD();
-    while ( pd = client->getPD() ) {
-        if ( pd->getIAID() == IAID)
-            break;
-    }
+    SPtr <TAddrIA> pd = client->getPD(IAID);
     // have we found this PD?
     if (!pd) {
         Log(Error) << "Unable to find PD (iaid=" << IAID << ") for client " << duid->getPlain() << "." << LogEnd;
@@ -501,12 +484,7 @@ bool TAddrMgr::delPrefix(SPtr<TDUID> clntDuid,
 
     Log(Debug) << "PD: Deleting prefix " << prefix->getPlain() << ", DUID=" << clntDuid->getPlain() << ", iaid=" << IAID << LogEnd;
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -516,12 +494,7 @@ bool TAddrMgr::delPrefix(SPtr<TDUID> clntDuid,
     }
 
     // find this IA
-    SPtr <TAddrIA> ptrPD;
-    ptrClient->firstPD();
-    while ( ptrPD = ptrClient->getPD() ) {
-        if ( ptrPD->getIAID() == IAID)
-            break;
-    }
+    SPtr <TAddrIA> ptrPD = ptrClient->getPD(IAID);
 
     // have we found this IA?
     if (!ptrPD) {
@@ -650,7 +623,7 @@ bool TAddrMgr::xmlLoadBuiltIn(const char * xmlFile)
 	    clnt = parseAddrClient(xmlFile, f);
 	    if (clnt) {
 		if (clnt->countIA() + clnt->countTA() + clnt->countPD() > 0) {
-		    ClntsLst.append(clnt);
+		    addClient(clnt);
 		    Log(Debug) << "Client " << clnt->getDUID()->getPlain()
 			       << " loaded from disk successfuly (" << clnt->countIA()
 			       << "/" << clnt->countPD() << "/" << clnt->countTA()
@@ -1199,7 +1172,9 @@ ostream & operator<<(ostream & strum,TAddrMgr &x) {
     x.ClntsLst.first();
 
     while ( ptr = x.ClntsLst.get() ) {
-        strum << *ptr;
+        if (!x.DumpTA_ && !ptr->countIA() && !ptr->countPD())
+            continue; // nothing but temporary addresses
+        ptr->print(strum, x.DumpTA_);
     }
 
     strum << "</AddrMgr>" << endl;
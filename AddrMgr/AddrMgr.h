@@ -134,11 +134,17 @@ protected:
 
     bool IsDone;
     List(TAddrClient) ClntsLst;
+
+    /// clients indexed by DUID (must be kept in sync with ClntsLst)
+    std::map<std::string, SPtr<TAddrClient> > ClntIdx_;
     std::string XmlFile;
 
     /// should the client without any IA, TA or PDs be deleted? (srv = yes, client = no)
     bool DeleteEmptyClient;
 
+    /// should TAs be stored in the database by dump()?
+    bool DumpTA_;
+
     uint64_t ReplayDetectionValue_;
 };
 
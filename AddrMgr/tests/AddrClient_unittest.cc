@@ -36,5 +36,66 @@ TEST_F(AddrClientTest, constructor) {
     delete client;
 }
 
+// checks that IAs are found by IAID and that lookups don't break iteration
+TEST_F(AddrClientTest, iaMap) {
+
+    const char duidData[] = {0x1, 0x2, 0x3, 0x4, 0x5, 0x6};
+    SPtr<TDUID> duid = new TDUID(duidData, sizeof(duidData));
+    TAddrClient client(duid);
+
+    // added in random order
+    const unsigned long iaids[] = { 7, 3, 100, 1, 42, 5 };
+    for (unsigned int i = 0; i < sizeof(iaids)/sizeof(iaids[0]); i++) {
+        client.addIA(new TAddrIA("eth0", 1, IATYPE_IA, SPtr<TIPv6Addr>(), duid,
+                                 100, 200, iaids[i]));
+        client.addPD(new TAddrIA("eth0", 1, IATYPE_PD, SPtr<TIPv6Addr>(), duid,
+                                 100, 200, iaids[i]));
+    }
+
+    // duplicates are rejected
+    client.addIA(new TAddrIA("eth0", 1, IATYPE_IA, SPtr<TIPv6Addr>(), duid, 1, 2, 42));
+    EXPECT_EQ(6, client.countIA());
+    EXPECT_EQ(100u, client.getIA(42)->getT1());
+
+    EXPECT_EQ(6, client.countPD());
+    EXPECT_FALSE(client.getIA(2));
+    EXPECT_FALSE(client.getTA(1));
+    ASSERT_TRUE(client.getPD(100));
+    EXPECT_EQ(100u, client.getPD(100)->getIAID());
+
+    // nested traversals and lookups
+    unsigned int cnt = 0;
+    unsigned long last = 0;
+    client.firstIA();
+    while (SPtr<TAddrIA> ia = client.getIA()) {
+        EXPECT_LT(last, ia->getIAID());
+        last = ia->getIAID();
+        EXPECT_TRUE(client.getIA(ia->getIAID()));
+        EXPECT_TRUE(client.getPD(ia->getIAID()));
+        unsigned int inner = 0;
+        for (TAddrIAMap::const_iterator it = client.getIAs().begin();
+             it != client.getIAs().end(); ++it)
+            inner++;
+        EXPECT_EQ(6u, inner);
+        cnt++;
+    }
+    EXPECT_EQ(6u, cnt);
+
+    // deletion while iterating with the cursor
+    cnt = 0;
+    client.firstIA();
+    while (SPtr<TAddrIA> ia = client.getIA()) {
+        if (ia->getIAID() % 2) {
+            EXPECT_TRUE(client.delIA(ia->getIAID()));
+        }
+        cnt++;
+    }
+    EXPECT_EQ(6u, cnt);
+    EXPECT_EQ(2, client.countIA());
+    EXPECT_TRUE(client.getIA(42));
+    EXPECT_TRUE(client.getIA(100));
+    EXPECT_FALSE(client.delIA(7));
+    EXPECT_EQ(6, client.countPD());
+}
 
 } // end of anonymous namespace
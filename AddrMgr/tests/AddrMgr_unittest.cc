@@ -36,6 +36,31 @@ TEST_F(AddrMgrTest, constructor) {
     delete mgr;
 }
 
+// checks that clients can be found by DUID after they are added and deleted
+TEST_F(AddrMgrTest, getClientByDuid) {
+    NakedAddrMgr mgr("non-existing.xml", false);
+
+    SPtr<TDUID> duid1 = new TDUID("00:01:00:0a:0b:0c:0d:0e:0f");
+    SPtr<TDUID> duid2 = new TDUID("00:01:00:0a:0b:0c:0d:0e:10");
+    SPtr<TDUID> duid3 = new TDUID("00:01:00:0a:0b:0c:0d:0e:10:11");
+
+    mgr.addClient(new TAddrClient(duid1));
+    mgr.addClient(new TAddrClient(duid2));
+    EXPECT_EQ(2, mgr.countClient());
+
+    // lookup by (equal, but not the same) DUID object
+    SPtr<TAddrClient> client = mgr.getClient(new TDUID("00:01:00:0a:0b:0c:0d:0e:10"));
+    ASSERT_TRUE(client);
+    EXPECT_TRUE(*client->getDUID() == *duid2);
+    EXPECT_FALSE(mgr.getClient(duid3));
+
+    EXPECT_TRUE(mgr.delClient(duid1));
+    EXPECT_FALSE(mgr.getClient(duid1));
+    EXPECT_TRUE(mgr.getClient(duid2));
+    EXPECT_FALSE(mgr.delClient(duid1));
+    EXPECT_EQ(1, mgr.countClient());
+}
+
 TEST_F(AddrMgrTest, XmlLoadValidDB) {
     TAddrMgr* mgr = new NakedAddrMgr("server-AddrMgr-0.8.3.xml", true);
 
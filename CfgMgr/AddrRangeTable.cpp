@@ -0,0 +1,300 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ */
+
+#include <string.h>
+#include <algorithm>
+#include "AddrRangeTable.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ADDRRANGE_SIMD 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+typedef TAddrRangeTable::TBound TBound;
+
+/// bounds left after binary search, compared by kernel in one pass
+#define ADDRRANGE_WINDOW 32
+
+namespace {
+
+inline bool lessEq(const TBound& a, const TBound& b) {
+    return memcmp(a.B, b.B, 16) <= 0;
+}
+
+/// number of bounds that are <= x
+typedef size_t (*TCountFn)(const TBound* b, size_t n, const TBound& x);
+
+size_t countScalar(const TBound* b, size_t n, const TBound& x) {
+    size_t cnt = 0;
+    for (size_t i = 0; i < n; i++)
+        cnt += lessEq(b[i], x);
+    return cnt;
+}
+
+#ifdef ADDRRANGE_SIMD
+
+/// @brief tells if bound <= x, given byte masks of (bound == x) and (bound <= x)
+///
+/// Bytes are compared bytewise; the result is decided by the first
+/// (most significant) byte that differs.
+inline size_t leFromMasks(unsigned int eq, unsigned int le) {
+    unsigned int ne = ~eq & 0xffff;
+    unsigned int first = ne & (0u - ne);
+    return !ne | !!(le & first);
+}
+
+__attribute__((target("sse2")))
+size_t countSse2(const TBound* b, size_t n, const TBound& x) {
+    __m128i vx = _mm_loadu_si128((const __m128i*)x.B);
+    size_t cnt = 0;
+    for (size_t i = 0; i < n; i++) {
+        __m128i vb = _mm_loadu_si128((const __m128i*)b[i].B);
+        unsigned int eq = _mm_movemask_epi8(_mm_cmpeq_epi8(vb, vx));
+        unsigned int le = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(vb, vx), vb));
+        cnt += leFromMasks(eq, le);
+    }
+    return cnt;
+}
+
+__attribute__((target("avx2")))
+size_t countAvx2(const TBound* b, size_t n, const TBound& x) {
+    __m128i x128 = _mm_loadu_si128((const __m128i*)x.B);
+    __m256i vx = _mm256_broadcastsi128_si256(x128);
+    size_t cnt = 0;
+    size_t i = 0;
+
+    // two bounds per register, two registers per round
+    for (; i + 4 <= n; i += 4) {
+        __m256i b01 = _mm256_loadu_si256((const __m256i*)b[i].B);
+        __m256i b23 = _mm256_loadu_si256((const __m256i*)b[i + 2].B);
+        unsigned int eq01 = _mm256_movemask_epi8(_mm256_cmpeq_epi8(b01, vx));
+        unsigned int le01 = _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_min_epu8(b01, vx), b01));
+        unsigned int eq23 = _mm256_movemask_epi8(_mm256_cmpeq_epi8(b23, vx));
+        unsigned int le23 = _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_min_epu8(b23, vx), b23));
+        cnt += leFromMasks(eq01 & 0xffff, le01 & 0xffff)
+            + leFromMasks(eq01 >> 16, le01 >> 16)
+            + leFromMasks(eq23 & 0xffff, le23 & 0xffff)
+            + leFromMasks(eq23 >> 16, le23 >> 16);
+    }
+    for (; i < n; i++) {
+        __m128i vb = _mm_loadu_si128((const __m128i*)b[i].B);
+        unsigned int eq = _mm_movemask_epi8(_mm_cmpeq_epi8(vb, x128));
+        unsigned int le = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(vb, x128), vb));
+        cnt += leFromMasks(eq, le);
+    }
+    return cnt;
+}
+
+#endif
+
+TAddrRangeTable::EKernel bestKernel() {
+#ifdef ADDRRANGE_SIMD
+    if (TAddrRangeTable::kernelSupported(TAddrRangeTable::KERNEL_AVX2))
+        return TAddrRangeTable::KERNEL_AVX2;
+    if (TAddrRangeTable::kernelSupported(TAddrRangeTable::KERNEL_SSE2))
+        return TAddrRangeTable::KERNEL_SSE2;
+#endif
+    return TAddrRangeTable::KERNEL_SCALAR;
+}
+
+TCountFn kernelFn(TAddrRangeTable::EKernel kernel) {
+    switch (kernel) {
+#ifdef ADDRRANGE_SIMD
+    case TAddrRangeTable::KERNEL_AVX2:
+        return countAvx2;
+    case TAddrRangeTable::KERNEL_SSE2:
+        return countSse2;
+#endif
+    default:
+        return countScalar;
+    }
+}
+
+TAddrRangeTable::EKernel Kernel = bestKernel();
+TCountFn CountLE = kernelFn(Kernel);
+
+/// range being sorted by rebuild()
+struct TEntry {
+    TBound Lo;
+    TBound Hi;
+    unsigned long Tag;
+
+    bool operator<(const TEntry& other) const {
+        int cmp = memcmp(Lo.B, other.Lo.B, 16);
+        if (cmp)
+            return cmp < 0;
+        return Tag < other.Tag;
+    }
+};
+
+}
+
+TAddrRangeTable::TAddrRangeTable() {
+}
+
+/// @brief adds a range
+///
+/// @param min first address of the range
+/// @param max last address of the range
+/// @param tag value returned by find() for addresses in this range
+void TAddrRangeTable::add(SPtr<TIPv6Addr> min, SPtr<TIPv6Addr> max, unsigned long tag) {
+    add(min->getAddr(), max->getAddr(), tag);
+}
+
+/// @brief adds a range (addresses in binary form)
+void TAddrRangeTable::add(const char* min, const char* max, unsigned long tag) {
+    TBound lo, hi;
+    memcpy(lo.B, min, 16);
+    memcpy(hi.B, max, 16);
+    if (!lessEq(lo, hi))
+        swap(lo, hi);
+
+    bool sorted = Lo_.empty() || lessEq(Lo_.back(), lo);
+    Lo_.push_back(lo);
+    Hi_.push_back(hi);
+    Tags_.push_back(tag);
+    if (!sorted) {
+        rebuild();
+        return;
+    }
+    if (MaxHi_.empty() || lessEq(MaxHi_.back(), hi))
+        MaxHi_.push_back(hi);
+    else
+        MaxHi_.push_back(MaxHi_.back());
+}
+
+void TAddrRangeTable::clear() {
+    Lo_.clear();
+    Hi_.clear();
+    MaxHi_.clear();
+    Tags_.clear();
+}
+
+/// @brief sorts ranges by lower bound, recalculates running maximum
+void TAddrRangeTable::rebuild() {
+    vector<TEntry> entries(Lo_.size());
+    for (size_t i = 0; i < Lo_.size(); i++) {
+        entries[i].Lo = Lo_[i];
+        entries[i].Hi = Hi_[i];
+        entries[i].Tag = Tags_[i];
+    }
+    stable_sort(entries.begin(), entries.end());
+
+    MaxHi_.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        Lo_[i] = entries[i].Lo;
+        Hi_[i] = entries[i].Hi;
+        Tags_[i] = entries[i].Tag;
+        if (!i || lessEq(MaxHi_[i - 1], Hi_[i]))
+            MaxHi_[i] = Hi_[i];
+        else
+            MaxHi_[i] = MaxHi_[i - 1];
+    }
+}
+
+/// @brief returns number of ranges with lower bound <= x
+size_t TAddrRangeTable::countLE(const TBound& x) const {
+    size_t lo = 0, hi = Lo_.size();
+    while (hi - lo > ADDRRANGE_WINDOW) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (lessEq(Lo_[mid], x))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == hi)
+        return lo;
+    return lo + CountLE(&Lo_[lo], hi - lo, x);
+}
+
+bool TAddrRangeTable::in(SPtr<TIPv6Addr> addr) const {
+    return in(addr->getAddr());
+}
+
+/// @brief checks if address belongs to any range
+bool TAddrRangeTable::in(const char* addr) const {
+    TBound x;
+    memcpy(x.B, addr, 16);
+    size_t cnt = countLE(x);
+    return cnt && lessEq(x, MaxHi_[cnt - 1]);
+}
+
+bool TAddrRangeTable::find(SPtr<TIPv6Addr> addr, unsigned long& tag) const {
+    return find(addr->getAddr(), tag);
+}
+
+/// @brief finds range that contains address
+///
+/// @param addr address to look for
+/// @param tag lowest tag of the ranges that contain the address (if found)
+///
+/// @return true if address belongs to any range
+bool TAddrRangeTable::find(const char* addr, unsigned long& tag) const {
+    TBound x;
+    memcpy(x.B, addr, 16);
+    bool found = false;
+
+    // only ranges that start before x and whose running maximum is not
+    // below x are candidates; usually there is just one
+    for (size_t i = countLE(x); i > 0 && lessEq(x, MaxHi_[i - 1]); i--) {
+        if (lessEq(x, Hi_[i - 1]) && (!found || Tags_[i - 1] < tag)) {
+            tag = Tags_[i - 1];
+            found = true;
+        }
+    }
+    return found;
+}
+
+TAddrRangeTable::EKernel TAddrRangeTable::getKernel() {
+    return Kernel;
+}
+
+/// @brief selects comparison kernel (best supported one is used by default)
+///
+/// @return false if kernel is not supported on this CPU
+bool TAddrRangeTable::setKernel(EKernel kernel) {
+    if (!kernelSupported(kernel))
+        return false;
+    Kernel = kernel;
+    CountLE = kernelFn(kernel);
+    return true;
+}
+
+bool TAddrRangeTable::kernelSupported(EKernel kernel) {
+#ifdef ADDRRANGE_SIMD
+    __builtin_cpu_init(); // may be called from static initializers
+#endif
+    switch (kernel) {
+    case KERNEL_SCALAR:
+        return true;
+#ifdef ADDRRANGE_SIMD
+    case KERNEL_SSE2:
+        return __builtin_cpu_supports("sse2");
+    case KERNEL_AVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+const char* TAddrRangeTable::kernelName(EKernel kernel) {
+    switch (kernel) {
+    case KERNEL_SCALAR:
+        return "scalar";
+    case KERNEL_SSE2:
+        return "SSE2";
+    case KERNEL_AVX2:
+        return "AVX2";
+    }
+    return "unknown";
+}
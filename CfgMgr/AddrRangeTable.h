@@ -0,0 +1,75 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ */
+
+#ifndef ADDRRANGETABLE_H
+#define ADDRRANGETABLE_H
+
+#include <vector>
+#include <stddef.h>
+#include "IPv6Addr.h"
+#include "SmartPtr.h"
+
+/// @brief set of address (or prefix) ranges with fast membership checks
+///
+/// Ranges are kept sorted by their lower bounds, as arrays of 128-bit
+/// values in network byte order. A lookup narrows the range down with
+/// a binary search, then compares the address with the remaining few
+/// bounds at once (SSE2 or AVX2, selected at runtime; plain C otherwise).
+/// Together with running maximum of upper bounds, that gives the answer
+/// without looking at any range object, no matter how many ranges there are.
+///
+/// Ranges may overlap. Each range has a tag (e.g. index of the class it
+/// belongs to); find() returns the lowest tag of all matching ranges.
+///
+/// Table is meant to be built when configuration is read. Lookups don't
+/// modify it, so they may be done concurrently.
+class TAddrRangeTable
+{
+public:
+    /// comparison kernels
+    typedef enum {
+        KERNEL_SCALAR,
+        KERNEL_SSE2,
+        KERNEL_AVX2
+    } EKernel;
+
+    TAddrRangeTable();
+
+    void add(SPtr<TIPv6Addr> min, SPtr<TIPv6Addr> max, unsigned long tag = 0);
+    void add(const char* min, const char* max, unsigned long tag = 0);
+    void clear();
+
+    bool in(SPtr<TIPv6Addr> addr) const;
+    bool in(const char* addr) const;
+    bool find(SPtr<TIPv6Addr> addr, unsigned long& tag) const;
+    bool find(const char* addr, unsigned long& tag) const;
+
+    size_t size() const { return Lo_.size(); }
+    bool empty() const { return Lo_.empty(); }
+
+    static EKernel getKernel();
+    static bool setKernel(EKernel kernel);
+    static bool kernelSupported(EKernel kernel);
+    static const char* kernelName(EKernel kernel);
+
+    /// 128-bit bound, network byte order
+    struct TBound {
+        unsigned char B[16];
+    };
+
+private:
+    size_t countLE(const TBound& x) const;
+    void rebuild();
+
+    std::vector<TBound> Lo_;    ///< lower bounds, sorted
+    std::vector<TBound> Hi_;    ///< upper bounds
+    std::vector<TBound> MaxHi_; ///< MaxHi_[i] = max(Hi_[0..i])
+    std::vector<unsigned long> Tags_;
+};
+
+#endif
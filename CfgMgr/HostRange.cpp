@@ -10,6 +10,7 @@
 #include "HostRange.h"
 #include "DHCPConst.h"
 #include "Logger.h"
+#include <string.h>
 
 THostRange::THostRange( SPtr<TDUID> duidl, SPtr<TDUID> duidr)
     :isAddrRange_(false), DUIDL_(duidl), DUIDR_(duidr), PrefixLength_(-1)
@@ -25,12 +26,7 @@ THostRange::THostRange( SPtr<TIPv6Addr> addrl, SPtr<TIPv6Addr> addrr)
 bool THostRange::in(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr) const
 {
     if (isAddrRange_)
-    {
-        if ((*addr<=*AddrL_)&&(*AddrL_<=*addr)) return true;
-        if ((*addr<=*AddrR_)&&(*AddrR_<=*addr)) return true;
-        if (*addr<=*AddrL_) return false;
-        if (*AddrR_<=*addr) return false;
-    }
+        return in(addr);
     else
     {
         if (!duid)
@@ -44,15 +40,10 @@ bool THostRange::in(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr) const
 
 bool THostRange::in(SPtr<TIPv6Addr> addr) const
 {
-    if (isAddrRange_)
-    {
-        if ((*addr<=*AddrL_)&&(*AddrL_<=*addr)) return true;
-        if ((*addr<=*AddrR_)&&(*AddrR_<=*addr)) return true;
-        if (*addr<=*AddrL_) return false;
-        if (*AddrR_<=*addr) return false;
-        return true;
-    } else
+    if (!isAddrRange_ || !addr)
         return false;
+    return memcmp(AddrL_->getAddr(), addr->getAddr(), 16) <= 0
+        && memcmp(addr->getAddr(), AddrR_->getAddr(), 16) <= 0;
 }
 
 bool THostRange::in(SPtr<TDUID> duid) const
@@ -113,6 +104,67 @@ unsigned long THostRange::rangeCount() const {
         return 0;
 }
 
+/**
+ * @brief returns offset of the last address in the range
+ *
+ * @param last [out] offset of the last address (AddrR - AddrL)
+ *
+ * @return false if this is not an address range or it has more than 2^64 addresses
+ */
+bool THostRange::getLastIndex(uint64_t& last) const {
+    if (!isAddrRange_)
+        return false;
+
+    TIPv6Addr diff = (*AddrR_) - (*AddrL_);
+    const char* addr = diff.getAddr();
+    for (int i = 0; i < 8; i++) {
+        if (addr[i])
+            return false;
+    }
+    last = 0;
+    for (int i = 8; i < 16; i++)
+        last = (last << 8) | (uint8_t)addr[i];
+    return true;
+}
+
+/// returns address at specified offset from the beginning of the range
+SPtr<TIPv6Addr> THostRange::getAddrByIndex(uint64_t index) const {
+    if (!isAddrRange_)
+        return SPtr<TIPv6Addr>();
+
+    char offset[16];
+    memset(offset, 0, 16);
+    for (int i = 15; i >= 8; i--) {
+        offset[i] = (char)(index & 0xff);
+        index >>= 8;
+    }
+    return new TIPv6Addr((*AddrL_) + TIPv6Addr(offset));
+}
+
+/**
+ * @brief returns offset of an address from the beginning of the range
+ *
+ * @param addr address (must be in the range)
+ * @param index [out] offset of the address (addr - AddrL)
+ *
+ * @return false if address is not in the range or its offset exceeds 2^64-1
+ */
+bool THostRange::getIndex(SPtr<TIPv6Addr> addr, uint64_t& index) const {
+    if (!in(addr))
+        return false;
+
+    TIPv6Addr diff = (*addr) - (*AddrL_);
+    const char* bytes = diff.getAddr();
+    for (int i = 0; i < 8; i++) {
+        if (bytes[i])
+            return false;
+    }
+    index = 0;
+    for (int i = 8; i < 16; i++)
+        index = (index << 8) | (uint8_t)bytes[i];
+    return true;
+}
+
 int THostRange::getPrefixLength() const {
     return PrefixLength_;
 }
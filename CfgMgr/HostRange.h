@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <stdint.h>
 
 class THostRange
 {
@@ -31,6 +32,9 @@ class THostRange
     SPtr<TIPv6Addr> getRandomAddr() const;
     SPtr<TIPv6Addr> getRandomPrefix() const;
     unsigned long rangeCount() const;
+    bool getLastIndex(uint64_t& last) const;
+    SPtr<TIPv6Addr> getAddrByIndex(uint64_t index) const;
+    bool getIndex(SPtr<TIPv6Addr> addr, uint64_t& index) const;
     SPtr<TIPv6Addr> getAddrL() const;
     SPtr<TIPv6Addr> getAddrR() const;
     int getPrefixLength() const;
@@ -0,0 +1,228 @@
+#include "AddrRangeTable.h"
+#include "HostRange.h"
+#include "IPv6Addr.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <ctime>
+#include <vector>
+#include <iostream>
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+class AddrRangeTableTest : public ::testing::Test {
+public:
+    AddrRangeTableTest()
+        :kernel_(TAddrRangeTable::getKernel()) {
+    }
+    ~AddrRangeTableTest() {
+        TAddrRangeTable::setKernel(kernel_);
+    }
+
+    /// returns all kernels that may be used on this CPU
+    vector<TAddrRangeTable::EKernel> kernels() {
+        vector<TAddrRangeTable::EKernel> all;
+        all.push_back(TAddrRangeTable::KERNEL_SCALAR);
+        all.push_back(TAddrRangeTable::KERNEL_SSE2);
+        all.push_back(TAddrRangeTable::KERNEL_AVX2);
+
+        vector<TAddrRangeTable::EKernel> supported;
+        for (size_t i = 0; i < all.size(); i++) {
+            if (TAddrRangeTable::kernelSupported(all[i]))
+                supported.push_back(all[i]);
+        }
+        return supported;
+    }
+
+    TAddrRangeTable::EKernel kernel_;
+};
+
+SPtr<TIPv6Addr> addr(const char* plain) {
+    return new TIPv6Addr(plain, true);
+}
+
+/// random address; bytes are drawn from a few values only, so that
+/// ranges overlap and share common prefixes
+void randomAddr(char* buf) {
+    static const unsigned char values[] = { 0x00, 0x01, 0x7f, 0x80, 0xfe, 0xff };
+    for (int i = 0; i < 16; i++)
+        buf[i] = (char)values[rand() % sizeof(values)];
+}
+
+TEST_F(AddrRangeTableTest, basic) {
+    TAddrRangeTable table;
+    EXPECT_TRUE(table.empty());
+    EXPECT_FALSE(table.in(addr("2001:db8::1")));
+
+    table.add(addr("2001:db8::100"), addr("2001:db8::1ff"), 0);
+    table.add(addr("2001:db8:1::"), addr("2001:db8:1::ffff"), 1);
+    table.add(addr("fe80::"), addr("fe80::ffff"), 2);
+    EXPECT_EQ(3u, table.size());
+
+    EXPECT_TRUE(table.in(addr("2001:db8::100")));
+    EXPECT_TRUE(table.in(addr("2001:db8::150")));
+    EXPECT_TRUE(table.in(addr("2001:db8::1ff")));
+    EXPECT_FALSE(table.in(addr("2001:db8::ff")));
+    EXPECT_FALSE(table.in(addr("2001:db8::200")));
+    EXPECT_FALSE(table.in(addr("::")));
+
+    // bytes above 0x7f are compared as unsigned
+    EXPECT_TRUE(table.in(addr("fe80::8000")));
+    EXPECT_FALSE(table.in(addr("fe80::1:0")));
+    EXPECT_FALSE(table.in(addr("ffff::")));
+
+    unsigned long tag = 100;
+    EXPECT_TRUE(table.find(addr("2001:db8:1::abcd"), tag));
+    EXPECT_EQ(1u, tag);
+    EXPECT_FALSE(table.find(addr("2001:db8:2::"), tag));
+
+    table.clear();
+    EXPECT_FALSE(table.in(addr("2001:db8::150")));
+}
+
+// ranges added out of order and overlapping ones report the lowest tag
+TEST_F(AddrRangeTableTest, overlap) {
+    TAddrRangeTable table;
+    table.add(addr("2001:db8::1:0"), addr("2001:db8::1:ffff"), 3);
+    table.add(addr("2001:db8::"), addr("2001:db8::ffff:ffff"), 5); // covers the above
+    table.add(addr("2001:db8::1:8000"), addr("2001:db8::1:8fff"), 1);
+    table.add(addr("2001:db8::2:ffff"), addr("2001:db8::2:0"), 4); // reversed bounds
+
+    unsigned long tag;
+    ASSERT_TRUE(table.find(addr("2001:db8::1:8001"), tag));
+    EXPECT_EQ(1u, tag);
+    ASSERT_TRUE(table.find(addr("2001:db8::1:1"), tag));
+    EXPECT_EQ(3u, tag);
+    ASSERT_TRUE(table.find(addr("2001:db8::2:1"), tag));
+    EXPECT_EQ(4u, tag);
+    ASSERT_TRUE(table.find(addr("2001:db8::3:1"), tag));
+    EXPECT_EQ(5u, tag);
+    EXPECT_FALSE(table.in(addr("2001:db8::1:0:0")));
+}
+
+// every supported kernel must agree with a plain loop over all ranges
+TEST_F(AddrRangeTableTest, kernels) {
+    srand(1234);
+    EXPECT_TRUE(TAddrRangeTable::kernelSupported(TAddrRangeTable::KERNEL_SCALAR));
+
+    vector<TAddrRangeTable::EKernel> kinds = kernels();
+    const unsigned int counts[] = { 1, 7, 33, 500 };
+    for (unsigned int c = 0; c < sizeof(counts)/sizeof(counts[0]); c++) {
+        TAddrRangeTable table;
+        vector<THostRange> ranges;
+        for (unsigned int i = 0; i < counts[c]; i++) {
+            char lo[16], hi[16];
+            randomAddr(lo);
+            randomAddr(hi);
+            if (memcmp(lo, hi, 16) > 0) {
+                char tmp[16];
+                memcpy(tmp, lo, 16);
+                memcpy(lo, hi, 16);
+                memcpy(hi, tmp, 16);
+            }
+            table.add(lo, hi, i);
+            ranges.push_back(THostRange(new TIPv6Addr(lo), new TIPv6Addr(hi)));
+        }
+
+        for (unsigned int i = 0; i < 2000; i++) {
+            char buf[16];
+            if (i % 4 == 0) {
+                // range boundaries are the interesting cases
+                SPtr<TIPv6Addr> bound = (i % 8) ? ranges[i % ranges.size()].getAddrL()
+                                                : ranges[i % ranges.size()].getAddrR();
+                memcpy(buf, bound->getAddr(), 16);
+            } else {
+                randomAddr(buf);
+            }
+            SPtr<TIPv6Addr> x = new TIPv6Addr(buf);
+
+            bool expected = false;
+            unsigned long expectedTag = 0;
+            for (size_t r = 0; r < ranges.size(); r++) {
+                if (ranges[r].in(x)) {
+                    expected = true;
+                    expectedTag = r;
+                    break;
+                }
+            }
+
+            for (size_t k = 0; k < kinds.size(); k++) {
+                ASSERT_TRUE(TAddrRangeTable::setKernel(kinds[k]));
+                unsigned long tag = 0;
+                EXPECT_EQ(expected, table.in(x))
+                    << TAddrRangeTable::kernelName(kinds[k]) << ", " << x->getPlain();
+                EXPECT_EQ(expected, table.find(x, tag));
+                if (expected) {
+                    EXPECT_EQ(expectedTag, tag);
+                }
+            }
+        }
+    }
+}
+
+// compares linear walk over THostRange objects with each kernel
+TEST_F(AddrRangeTableTest, benchmark) {
+    const unsigned int sizes[] = { 16, 256, 4096 };
+    const unsigned int LOOKUPS = 200000;
+
+    vector<TAddrRangeTable::EKernel> kinds = kernels();
+    for (unsigned int s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+        // disjoint 2001:db8:<i>::/64 pools
+        TAddrRangeTable table;
+        vector<THostRange> ranges;
+        for (unsigned int i = 0; i < sizes[s]; i++) {
+            char lo[16], hi[16];
+            memset(lo, 0, 16);
+            lo[0] = 0x20; lo[1] = 0x01; lo[2] = 0x0d; lo[3] = (char)0xb8;
+            lo[4] = (char)(i >> 8); lo[5] = (char)(i & 0xff);
+            memcpy(hi, lo, 16);
+            memset(hi + 8, 0xff, 8);
+            table.add(lo, hi, i);
+            ranges.push_back(THostRange(new TIPv6Addr(lo), new TIPv6Addr(hi)));
+        }
+
+        vector<SPtr<TIPv6Addr> > addrs;
+        for (unsigned int i = 0; i < 1024; i++) {
+            SPtr<TIPv6Addr> x = new TIPv6Addr(*ranges[rand() % ranges.size()].getAddrL());
+            x->getAddr()[15] = (char)i;
+            if (i % 2)
+                x->getAddr()[6] = 1; // outside of all pools
+            addrs.push_back(x);
+        }
+
+        // linear walk is slow on large tables, so it does fewer lookups
+        // and its time is scaled up
+        unsigned long linearHits = 0;
+        clock_t start = clock();
+        for (unsigned int i = 0; i < LOOKUPS / sizes[s] * 16; i++) {
+            SPtr<TIPv6Addr> x = addrs[i % addrs.size()];
+            for (size_t r = 0; r < ranges.size(); r++) {
+                if (ranges[r].in(x)) {
+                    linearHits++;
+                    break;
+                }
+            }
+        }
+        double linear = (double)(clock() - start) / CLOCKS_PER_SEC * sizes[s] / 16;
+
+        cout << "[ BENCH    ] " << sizes[s] << " ranges, " << LOOKUPS << " lookups: "
+             << linear << "s (linear)";
+        for (size_t k = 0; k < kinds.size(); k++) {
+            TAddrRangeTable::setKernel(kinds[k]);
+            unsigned long hits = 0;
+            start = clock();
+            for (unsigned int i = 0; i < LOOKUPS; i++)
+                hits += table.in(addrs[i % addrs.size()]);
+            double t = (double)(clock() - start) / CLOCKS_PER_SEC;
+            EXPECT_EQ(LOOKUPS / 2, hits);
+            cout << ", " << t << "s (" << TAddrRangeTable::kernelName(kinds[k]) << ")";
+        }
+        cout << endl;
+        EXPECT_LT(0u, linearHits);
+    }
+}
+
+}
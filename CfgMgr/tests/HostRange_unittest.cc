@@ -2,8 +2,11 @@
 #include "DUID.h"
 #include "HostRange.h"
 
+#include <string>
 #include <gtest/gtest.h>
 
+using namespace std;
+
 namespace {
 
 TEST(HostRangeTest, constructor) {
@@ -15,5 +18,53 @@ TEST(HostRangeTest, constructor) {
     /// @todo: implement tests for HostRange
 }
 
+TEST(HostRangeTest, index) {
+    SPtr<TIPv6Addr> addr1 = new TIPv6Addr("2001:db8::ff00", true);
+    SPtr<TIPv6Addr> addr2 = new TIPv6Addr("2001:db8::1:ff", true);
+
+    THostRange range(addr1, addr2);
+    uint64_t last = 0;
+    ASSERT_TRUE(range.getLastIndex(last));
+    EXPECT_EQ(0x100ffu - 0xff00u, last);
+
+    EXPECT_EQ(string("2001:db8::ff00"), range.getAddrByIndex(0)->getPlain());
+    EXPECT_EQ(string("2001:db8::1:0"), range.getAddrByIndex(0x100)->getPlain());
+    EXPECT_EQ(string("2001:db8::1:ff"), range.getAddrByIndex(last)->getPlain());
+
+    uint64_t index = 0;
+    ASSERT_TRUE(range.getIndex(new TIPv6Addr("2001:db8::1:0", true), index));
+    EXPECT_EQ(0x100u, index);
+    ASSERT_TRUE(range.getIndex(new TIPv6Addr("2001:db8::1:ff", true), index));
+    EXPECT_EQ(last, index);
+    EXPECT_FALSE(range.getIndex(new TIPv6Addr("2001:db8::1:100", true), index));
+
+    // /64 pool is the largest one that can be indexed
+    THostRange range64(new TIPv6Addr("2001:db8::", true),
+                       new TIPv6Addr("2001:db8::ffff:ffff:ffff:ffff", true));
+    ASSERT_TRUE(range64.getLastIndex(last));
+    EXPECT_EQ(0xffffffffffffffffULL, last);
+
+    THostRange range48(new TIPv6Addr("2001:db8::", true),
+                       new TIPv6Addr("2001:db8:0:1::", true));
+    EXPECT_FALSE(range48.getLastIndex(last));
+}
+
+// addresses are compared as unsigned 128-bit numbers
+TEST(HostRangeTest, in) {
+    THostRange range(new TIPv6Addr("2001:db8::7f00", true),
+                     new TIPv6Addr("2001:db8::80ff", true));
+    EXPECT_TRUE(range.in(new TIPv6Addr("2001:db8::7f00", true)));
+    EXPECT_TRUE(range.in(new TIPv6Addr("2001:db8::7fff", true)));
+    EXPECT_TRUE(range.in(new TIPv6Addr("2001:db8::8000", true)));
+    EXPECT_TRUE(range.in(new TIPv6Addr("2001:db8::80ff", true)));
+    EXPECT_FALSE(range.in(new TIPv6Addr("2001:db8::7eff", true)));
+    EXPECT_FALSE(range.in(new TIPv6Addr("2001:db8::8100", true)));
+    EXPECT_FALSE(range.in(new TIPv6Addr("fe80::7fff", true)));
+
+    // with DUID, address ranges still check the address
+    SPtr<TDUID> duid = new TDUID("00:01:02:03");
+    EXPECT_TRUE(range.in(duid, new TIPv6Addr("2001:db8::8001", true)));
+    EXPECT_FALSE(range.in(duid, new TIPv6Addr("2001:db8::8101", true)));
+}
 
 }
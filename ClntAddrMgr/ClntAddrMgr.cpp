@@ -183,13 +183,7 @@ TClntAddrMgr::~TClntAddrMgr() {
 
 SPtr<TAddrIA> TClntAddrMgr::getIA(unsigned long IAID)
 {
-    SPtr<TAddrIA> ptrIA;
-    Client->firstIA();
-    while (ptrIA = Client->getIA() ) {
-	if (ptrIA->getIAID() == IAID)
-	    return ptrIA;
-    }
-    return SPtr<TAddrIA>();
+    return Client->getIA(IAID);
 }
 
 /**
@@ -249,13 +243,7 @@ int TClntAddrMgr::countPD() {
 
 SPtr<TAddrIA> TClntAddrMgr::getPD(unsigned long IAID)
 {
-    SPtr<TAddrIA> ptrPD;
-    this->Client->firstPD();
-    while (ptrPD = this->Client->getPD() ) {
-	if (ptrPD->getIAID() == IAID)
-	    return ptrPD;
-    }
-    return SPtr<TAddrIA>(); // NULL
+    return this->Client->getPD(IAID);
 }
 
 void TClntAddrMgr::firstTA()
@@ -270,13 +258,7 @@ SPtr<TAddrIA> TClntAddrMgr::getTA()
 
 SPtr<TAddrIA> TClntAddrMgr::getTA(unsigned long iaid)
 {
-    SPtr<TAddrIA> ta;
-    this->Client->firstTA();
-    while (ta = this->Client->getTA() ) {
-	if (ta->getIAID() == iaid)
-	    return ta;
-    }
-    return SPtr<TAddrIA>(); // NULL
+    return this->Client->getTA(iaid);
 }
 
 void TClntAddrMgr::addTA(SPtr<TAddrIA> ptr)
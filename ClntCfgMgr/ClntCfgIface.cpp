@@ -17,12 +17,14 @@
 #include "ClntCfgIface.h"
 #include "Logger.h"
 #include "Portable.h"
+#include "DHCPDefaults.h"
 #include "OptVendorSpecInfo.h"
 using namespace std;
 
 TClntCfgIface::TClntCfgIface(const std::string& ifaceName)
     :Stateful_(true), Unicast(false), RapidCommit(false), PrefixLength(-1),
-     RoutingEnabled(false){
+     RenewCoalesce(CLIENT_DEFAULT_RENEW_COALESCE), RenewCnt(0), RenewIACnt(0),
+     RenewCoalescedCnt(0), RoutingEnabled(false){
     setDefaults();
 
     NoConfig=false;
@@ -32,7 +34,8 @@ TClntCfgIface::TClntCfgIface(const std::string& ifaceName)
 
 TClntCfgIface::TClntCfgIface(int iface_index)
     :Stateful_(true), Unicast(false), RapidCommit(false), PrefixLength(-1),
-     RoutingEnabled(false){
+     RenewCoalesce(CLIENT_DEFAULT_RENEW_COALESCE), RenewCnt(0), RenewIACnt(0),
+     RenewCoalescedCnt(0), RoutingEnabled(false){
     setDefaults();
     NoConfig=false;
     ID=iface_index;
@@ -79,6 +82,7 @@ void TClntCfgIface::setOptions(SPtr<TClntParsGlobalOpt> opt) {
     Stateful_   = opt->getStateful();
     Unicast     = opt->getUnicast();
     RapidCommit = opt->getRapidCommit();
+    RenewCoalesce = opt->getRenewCoalesce();
 
     // copy YES/NO information
     ReqDNSServer = opt->getReqDNSServer();
@@ -278,6 +282,26 @@ bool TClntCfgIface::getRapidCommit() {
     return this->RapidCommit;
 }
 
+unsigned int TClntCfgIface::getRenewCoalesce() {
+    return RenewCoalesce;
+}
+
+void TClntCfgIface::setRenewCoalesce(unsigned int window) {
+    RenewCoalesce = window;
+}
+
+/**
+ * @brief updates RENEW coalescing statistics
+ *
+ * @param ias number of IAs and PDs included in RENEW
+ * @param coalesced how many of them were included before reaching their T1
+ */
+void TClntCfgIface::addRenewStats(unsigned int ias, unsigned int coalesced) {
+    RenewCnt++;
+    RenewIACnt += ias;
+    RenewCoalescedCnt += coalesced;
+}
+
 void TClntCfgIface::vendorSpecSupported(bool support)
 {
     ReqVendorSpec   = support;
@@ -581,6 +605,10 @@ ostream& operator<<(ostream& out,TClntCfgIface& iface)
         out << "    <!-- <RapidCommit/> -->" << endl;
     }
 
+    out << "    <RenewCoalesce window=\"" << iface.RenewCoalesce << "\" renews=\""
+        << iface.RenewCnt << "\" ias=\"" << iface.RenewIACnt << "\" coalesced=\""
+        << iface.RenewCoalescedCnt << "\"/>" << endl;
+
     out << "    <!-- addresses -->" << endl;
     out << "    <iaLst count=\"" << iface.IALst.count() << "\">" << endl;
     SPtr<TClntCfgIA> ia;
@@ -90,6 +90,10 @@ public:
     bool getRapidCommit();
     void setRapidCommit(bool rapCom);
 
+    unsigned int getRenewCoalesce();
+    void setRenewCoalesce(unsigned int window);
+    void addRenewStats(unsigned int ias, unsigned int coalesced);
+
     // --- option: DNS servers ---
     bool isReqDNSServer();
     EState getDNSServerState();
@@ -218,6 +222,11 @@ private:
     bool RapidCommit;
     int  PrefixLength; // default prefix length of the configured addresses
 
+    unsigned int RenewCoalesce;     // coalescing window (in seconds)
+    unsigned int RenewCnt;          // number of RENEWs sent
+    unsigned int RenewIACnt;        // number of IAs and PDs renewed
+    unsigned int RenewCoalescedCnt; // IAs and PDs renewed before their T1
+
     List(TClntCfgIA) IALst;
     List(TClntCfgPD) PDLst;
     List(THostID) PrefSrvLst;
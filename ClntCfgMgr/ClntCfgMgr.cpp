@@ -15,6 +15,7 @@
 #include <string>
 #include "SmartPtr.h"
 #include "Portable.h"
+#include "DHCPDefaults.h"
 #include "ClntCfgMgr.h"
 #include "ClntCfgIface.h"
 #include "Logger.h"
@@ -51,7 +52,8 @@ void TClntCfgMgr::instanceCreate(const std::string& cfgFile) {
 
 
 TClntCfgMgr::TClntCfgMgr(const std::string& cfgFile)
-    :TCfgMgr(), ScriptName(DEFAULT_SCRIPT), ObeyRaBits_(false)
+    :TCfgMgr(), ScriptName(DEFAULT_SCRIPT), ObeyRaBits_(false),
+     StartupSpread_(CLIENT_DEFAULT_STARTUP_SPREAD)
 {
 
 #ifdef MOD_REMOTE_AUTOCONF
@@ -919,6 +921,7 @@ ostream & operator<<(ostream &strum, TClntCfgMgr &x)
     strum << "  <InactiveMode>" << (x.InactiveMode?1:0) << "</InactiveMode>" << endl;
     strum << "  <FQDNFlagS>" << (x.FQDNFlagS?1:0) << "</FQDNFlagS>" << endl;
     strum << "  <useConfirm>" << (x.UseConfirm?1:0) << "</useConfirm>" << endl;
+    strum << "  <startupSpread>" << x.StartupSpread_ << "</startupSpread>" << endl;
     strum << "  <digest>";
     switch (x.getDigest()) {
     case DIGEST_NONE:
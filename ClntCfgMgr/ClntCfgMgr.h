@@ -87,6 +87,9 @@ class TClntCfgMgr : public TCfgMgr
     void obeyRaBits(bool obey);
     bool obeyRaBits();
 
+    void setStartupSpread(unsigned int spread) { StartupSpread_ = spread; }
+    unsigned int getStartupSpread() { return StartupSpread_; }
+
 #ifndef MOD_DISABLE_AUTH
     // Authorization
     uint32_t getSPI();
@@ -147,6 +150,8 @@ private:
 
     bool ObeyRaBits_;
 
+    unsigned int StartupSpread_; // max. random delay of the first exchange (in seconds)
+
     static TClntCfgMgr * Instance;
 };
 
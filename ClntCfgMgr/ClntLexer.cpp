@@ -353,8 +353,8 @@ int yyFlexLexer::yywrap() { return 1; }
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 101
-#define YY_END_OF_BUFFER 102
+#define YY_NUM_RULES 103
+#define YY_END_OF_BUFFER 104
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -362,103 +362,106 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[867] =
+static yyconst flex_int16_t yy_accept[901] =
     {   0,
-        1,    1,    0,    0,    0,    0,  102,  100,    2,    1,
-        1,  100,   82,  100,  100,   99,   99,  100,  100,  100,
-      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
-      100,  100,  100,  100,  100,  100,  100,   86,   86,  101,
-        1,    1,    1,    0,   94,   82,    0,   94,   84,   83,
-       99,    0,    0,   98,    0,   91,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   11,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   53,   95,   95,   95,   95,   95,   95,
-       95,   95,   25,   26,   12,   95,   95,   95,   95,   95,
-
-       85,   83,   99,    0,    0,    0,   90,   96,   89,   89,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,    8,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   99,    0,    0,    0,    0,   88,   88,
-        0,   89,    0,   89,   95,   95,   77,   95,   95,   95,
-       95,   95,   95,   95,   95,    7,   95,   34,   13,   95,
-       95,   95,   95,   95,   10,    0,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-
-       95,   95,   95,   95,   95,   95,   95,   99,    0,   97,
-        0,    0,    0,   88,    0,   88,    0,   89,   89,   89,
-       89,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,    3,   95,   95,   95,   95,
-       95,   95,   95,    0,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,    0,
-        0,    0,    0,    0,   88,   88,   88,   88,    0,   89,
-       89,   89,    0,   89,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   29,   95,   95,   95,
-
-       95,   95,   35,   95,   95,   95,   95,   95,   95,   95,
-        0,    0,   95,   95,   95,   95,   95,   27,   95,   54,
-       95,   95,   95,   95,   95,   20,   95,   95,   95,   95,
-       95,    6,   95,   95,   95,   95,   95,    0,    0,    0,
-        0,   88,   88,   88,    0,   88,    0,    0,   89,   89,
-       89,   89,   95,    5,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   58,   56,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,    0,    0,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       43,   95,   95,   95,   95,   95,   95,   49,   95,   95,
-
-       95,   97,    0,    0,    0,    0,    0,   88,   88,   88,
-       88,    0,   89,   89,   89,    0,   89,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   57,   95,   95,   95,   95,   42,   95,
-       95,   16,   17,    0,    0,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   19,    0,    0,    0,    0,
-       88,   88,   88,    0,   88,   93,   89,   89,   89,   89,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   55,   95,   95,   95,
-
-       95,   15,    0,    0,   95,   95,    4,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   14,
-       95,   31,   95,   95,    0,    0,    0,    0,   92,   88,
-       88,   88,   88,   89,   89,   89,    0,   89,   95,   95,
-       95,   95,   95,   95,   67,   95,   95,   95,   95,   95,
-       95,   95,   28,   95,   95,   95,   95,   18,    0,    0,
-       39,   38,   30,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   33,   32,   95,   95,   95,   95,   97,    0,
-        0,   88,   88,   88,    0,   88,   89,   89,   89,   89,
-       81,   95,   95,   95,   95,   95,   66,   95,   95,   95,
-
-       95,   68,   95,   95,   95,   95,   61,   41,   40,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   59,    0,    0,    0,    0,   88,   88,   88,
-       88,   89,   89,   89,    0,   89,    9,   95,   95,   63,
-       95,   95,   95,   37,   95,   69,   95,   80,   95,   51,
-       95,   95,   95,   95,   95,   47,   95,   95,   95,   76,
-       95,   95,    0,    0,    0,   88,   88,   88,    0,   88,
-       89,   89,   89,   89,   95,   95,   64,   95,   36,   95,
-       95,   95,   62,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   97,    0,    0,    0,   88,   88,   88,
-
-       88,   89,   89,   89,    0,   89,   95,   65,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   44,   95,
-       95,   23,    0,    0,   87,   90,   88,   88,   88,    0,
-       88,   89,   89,   89,   89,   95,   79,   70,   95,   95,
-       95,   95,   95,   95,   95,   95,   24,   95,    0,    0,
-       87,    0,   88,   88,   88,   88,   88,   89,   89,   89,
-        0,   89,   95,   71,   95,   95,   95,   95,   95,   46,
-       95,   95,   95,   95,   95,   97,   87,   90,   88,    0,
-       88,   88,   88,   88,   89,   89,   89,   95,   95,   95,
-       95,   95,   95,   21,   95,   45,   52,   95,   95,    0,
-
-       87,   88,   88,   88,   88,   89,   89,   89,   95,   72,
-       73,   74,   75,   95,   22,   48,   95,    0,   88,   88,
-        0,   88,   88,   89,   95,   95,   95,   97,   88,   88,
-       89,   95,   95,   95,    0,   88,   88,    0,   60,   95,
-       50,   87,   88,   88,   78,   87,   88,   88,    0,    0,
-       88,   88,    0,   88,   88,    0,   97,   88,   88,    0,
-       88,   88,    0,   88,   88,    0
+        1,    1,    0,    0,    0,    0,  104,  102,    2,    1,
+        1,  102,   84,  102,  102,  101,  101,  102,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,   88,   88,   88,
+      103,    1,    1,    1,    0,   96,   84,    0,   96,   86,
+       85,  101,    0,    0,  100,    0,   93,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   11,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   53,   97,   97,   97,   97,   97,
+       97,   97,   97,   25,   26,   12,   97,   97,   97,   97,
+
+       97,   87,    0,   85,  101,    0,    0,    0,   92,   98,
+       91,   91,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,    8,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,  101,    0,
+        0,    0,    0,   90,   90,   98,    0,   91,    0,   91,
+       97,   97,   79,   97,   97,   97,   97,   97,   97,   97,
+       97,    7,   97,   34,   13,   97,   97,   97,   97,   97,
+       10,    0,   97,   97,   97,   97,   97,   97,   97,   97,
+
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,  101,    0,   99,    0,    0,
+        0,   90,    0,   90,    0,   91,   91,   91,   91,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,    3,   97,   97,   97,   97,   97,   97,
+       97,    0,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,    0,
+        0,    0,    0,    0,   90,   90,   90,   90,    0,    0,
+       91,   91,   91,    0,   91,   97,   97,   97,   97,   97,
+
+       97,   97,   97,   97,   97,   97,   97,   29,   97,   97,
+       97,   97,   97,   35,   97,   97,   97,   97,   97,   97,
+       97,    0,    0,   97,   97,   97,   97,   97,   27,   97,
+       54,   97,   97,   97,   97,   97,   97,   20,   97,   97,
+       97,   97,   97,   97,    6,   97,   97,   97,   97,   97,
+        0,    0,    0,    0,    0,   90,   90,   90,    0,   90,
+        0,    0,   91,   91,   91,   91,   97,    5,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   58,
+       56,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+        0,    0,   97,   97,   97,   97,   97,   97,   97,   97,
+
+       97,   97,   97,   97,   97,   43,   97,   97,   97,   97,
+       97,   97,   97,   49,   97,   97,   97,   99,    0,    0,
+        0,    0,    0,   90,   90,   90,   90,    0,    0,   91,
+       91,   91,    0,   91,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       57,   97,   97,   97,   97,   42,   97,   97,   16,   17,
+        0,    0,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   19,    0,    0,    0,    0,    0,
+       90,   90,   90,    0,   90,   95,   91,   91,   91,   91,
+
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   55,   97,   97,   97,
+       97,   15,    0,    0,   97,   97,    4,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   14,   97,   31,   97,   97,    0,    0,    0,    0,
+       94,   90,   90,   90,   90,   95,   91,   91,   91,    0,
+       91,   97,   97,   97,   97,   97,   97,   69,   97,   97,
+       97,   97,   97,   97,   97,   28,   97,   97,   97,   97,
+       18,    0,    0,   39,   38,   30,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   33,   32,   97,   97,
+
+       97,   97,   97,   99,    0,    0,   94,   90,   90,   90,
+        0,   90,   91,   91,   91,   91,   83,   97,   97,   97,
+       97,   97,   68,   97,   97,   97,   97,   70,   97,   97,
+       97,   97,   61,   41,   40,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       59,    0,    0,    0,    0,   90,   90,   90,   90,   91,
+       91,   91,    0,   91,    9,   97,   97,   65,   97,   97,
+       97,   37,   97,   71,   97,   82,   97,   51,   97,   97,
+       97,   97,   97,   47,   97,   97,   97,   97,   78,   97,
+       97,   97,    0,    0,    0,   90,   90,   90,    0,   90,
+
+       91,   91,   91,   91,   97,   97,   66,   97,   36,   97,
+       97,   97,   62,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   99,    0,    0,    0,   90,
+       90,   90,   90,   91,   91,   91,    0,   91,   97,   67,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       44,   97,   63,   64,   97,   23,    0,    0,   89,   92,
+       90,   90,   90,    0,   90,   91,   91,   91,   91,   97,
+       81,   72,   97,   97,   97,   97,   97,   97,   97,   97,
+       24,   97,    0,    0,   89,    0,   90,   90,   90,   90,
+       90,   91,   91,   91,    0,   91,   97,   73,   97,   97,
+
+       97,   97,   97,   46,   97,   97,   97,   97,   97,   99,
+       89,   92,   90,    0,   90,   90,   90,   90,   91,   91,
+       91,   97,   97,   97,   97,   97,   97,   21,   97,   45,
+       52,   97,   97,    0,   89,   90,   90,   90,   90,   91,
+       91,   91,   97,   74,   75,   76,   77,   97,   22,   48,
+       97,    0,   90,   90,    0,   90,   90,   91,   97,   97,
+       97,   99,   90,   90,   91,   97,   97,   97,    0,   90,
+       90,    0,   60,   97,   50,   89,   90,   90,   80,   89,
+       90,   90,    0,    0,   90,   90,    0,   90,   90,    0,
+       99,   90,   90,    0,   90,   90,    0,   90,   90,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -472,11 +475,11 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,   23,   24,   25,   26,   27,   28,
        29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
        39,   40,   41,   42,   43,   44,   45,   46,   47,   48,
-        1,    1,    1,    1,    1,    1,   49,   50,   51,   52,
+        1,    1,    1,    1,    1,    1,   23,   24,   25,   26,
 
-       53,   54,   55,   56,   57,   58,   59,   60,   61,   62,
-       63,   64,   65,   66,   67,   68,   69,   70,   71,   72,
-       73,   74,    1,    1,    1,    1,    1,    1,    1,    1,
+       27,   28,   29,   30,   31,   32,   33,   34,   35,   36,
+       37,   38,   39,   40,   41,   42,   43,   44,   45,   46,
+       47,   48,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -493,1157 +496,1074 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[75] =
+static yyconst flex_int32_t yy_meta[49] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    4,    3,    3,    3,    3,    3,    3,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    3,    3,
-        3,    3,    3,    3,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[952] =
+static yyconst flex_int16_t yy_base[901] =
     {   0,
-        0,    0, 1425, 1415,    0,    0, 1393, 4032, 4032,   72,
-       74, 1380,    0, 1377,   71,   71,   34, 1361,  134,  183,
-      184,  228,  215,  240,  297,   54,   77,   71,  321,  210,
-      223,  308,  331,  354,   67,   87,   67, 4032, 1370, 4032,
-      108,  112,  115, 1376, 4032,    0, 1373, 1371, 4032,    0,
-      399, 1355,  417, 4032,    0,  443,    0,  485,   83,  171,
-        0,  179,  176,  185,  188,  200,  190,  227,  239,  235,
-      252,  235,  269,  280,  331,  278,  279,  304,  300, 1330,
-      317,  333,  332,    0,  348,  338,  489,  336,  343,  390,
-      408,  493,    0,    0,    0,  411,  416,  457,  482,  479,
-
-     4032,    0,  547, 1317,  461, 1316,  591,    0,  635,  565,
-      677,  480,  482,  487,  495,  500,  486,  501, 1327,  506,
-      494,  505,  505,  551,    0,  568,  570,  577,  607,  612,
-     1326,  620,  123,  655, 1325,  634,  651,  655,  679,  674,
-      685,  676,  672,  684, 1324,  678,  675,  687,  692,  695,
-      690,  696,  690,  737,  616, 1311, 1283, 1267,  783,  755,
-      764,  827,  869,  801,  911,  803,    0,  784, 1277, 1276,
-     1275,  798,  831,  842,  840, 1274,  835, 1273,    0,  864,
-      865,  873,  873,  917,    0, 1272,  917,  907,  904, 1262,
-      909,  923,  921,  912,  924,  913,  925,  919,  959, 1261,
-
-      939,  961, 1260,  944,  961,  951, 1259,  988, 1245, 1101,
-     1092, 1091, 1014, 1025, 1067, 1043, 1085, 1111, 1129, 1155,
-     1173, 1090,  951,  949,  956, 1162,  952,  957,  954,  971,
-     1035, 1058, 1176, 1110, 1154,    0, 1165, 1156, 1168, 1164,
-     1185, 1176, 1191, 1189, 1179, 1190, 1183, 1193, 1191, 1196,
-     1193, 1188, 1101, 1207, 1195, 1220, 1212, 1207, 1213, 1224,
-     1227, 1219, 1212, 1226, 1214, 1223, 1100, 1225, 1240, 1087,
-     1086, 1085, 1051, 1282, 1293, 1311, 1337, 1355, 1138, 1381,
-     1050, 1393, 1435, 1411, 1245, 1282, 1304, 1345, 1411, 1399,
-     1413, 1404, 1417, 1437, 1060, 1429,    0, 1434, 1435, 1438,
-
-     1426, 1439,    0, 1431, 1059, 1441, 1443, 1434, 1453, 1445,
-     1444, 1455, 1455, 1451, 1464, 1453, 1486,    0, 1483, 1058,
-     1486, 1481, 1057, 1056, 1484,    0, 1479, 1475, 1483, 1494,
-     1055,    0, 1485, 1482, 1491, 1045, 1495, 1015,  997,  996,
-     1540, 1551,  937, 1563, 1605, 1581, 1623, 1649, 1660, 1678,
-     1704, 1722, 1569,  906, 1584, 1617, 1648, 1671, 1721,  903,
-     1708, 1711, 1730, 1703, 1715,    0, 1707, 1712, 1724, 1725,
-     1726, 1735, 1726, 1737, 1738, 1740, 1734, 1739, 1757, 1737,
-     1751, 1739,  902, 1758, 1769, 1771, 1761, 1770, 1759, 1778,
-        0, 1779, 1759, 1768, 1770, 1772, 1777,    0, 1783, 1774,
-
-     1776,  889,  888,  887,  886, 1832, 1843, 1854, 1872, 1898,
-     1916, 1881, 1942,  884, 1954, 1996, 1972, 1795, 1850, 1887,
-     1903, 1969, 1958, 1967, 1968, 1995, 1987, 2003, 1996, 1995,
-     1999, 2007,  895,    0, 2008, 2000,  894, 2000,    0, 1998,
-     2005,    0,    0, 2017, 1997, 2011, 2016, 2022, 2025, 2029,
-      893, 2028, 2043, 2036, 2029, 2046, 2031, 2044, 2049, 2053,
-     2041, 2055, 2057, 2057, 2048,    0,  880,  849,  848, 2074,
-     2102,  847, 2114, 2156, 2132, 2141, 2200, 2174, 2244, 2218,
-     2143, 2155,  858, 2190, 2210, 2211, 2240, 2253, 2251, 2241,
-     2242, 2257, 2245, 2259, 2243, 2246,    0, 2243, 2251, 2261,
-
-     2247,    0, 2258, 2263, 2255, 2252,    0, 2259, 2269, 2286,
-      857, 2285, 2286, 2282, 2283, 2282, 2292, 2289, 2299,    0,
-     2306,    0, 2305, 2306,  844,  842,  841,  840, 2321, 2349,
-     2367, 2393, 2411, 2437,  839, 2449, 2491, 2467, 2338, 2356,
-     2404, 2463, 2469, 2471,    0, 2450, 2487, 2499, 2482, 2501,
-     2500, 2497,    0, 2489, 2507, 2494, 2505,    0, 2497, 2494,
-        0,    0,    0, 2493, 2505, 2510, 2530, 2519, 2516, 2521,
-     2505, 2528,    0,    0, 2526,  850, 2525, 2543,  837,  836,
-      807, 2565,  806, 2587, 2629, 2605, 2673, 2647, 2717, 2691,
-        0, 2527, 2534, 2591, 2610, 2666,    0, 2680, 2684, 2706,
-
-      817,    0, 2713, 2723, 2717, 2726,    0, 4032, 4032, 2712,
-     2726, 2715, 2725, 2730, 2729, 2717,  816, 2733, 2736, 2727,
-     2727, 2733,    0,  803,  802,  801,  773, 2780, 2798, 2824,
-     2842, 2868,  770, 2880, 2922, 2898,    0, 2782, 2798,    0,
-     2832, 2898, 2892,    0, 2918,    0, 2900,    0, 2917,    0,
-     2928, 2912, 2929, 2918, 2937,    0, 2938, 2922, 2926,    0,
-     2927, 2930,  713,  712,  711, 2981,  710, 2993, 3035, 3011,
-     3079, 3053, 3123, 3097,  715, 2932,    0, 2998,    0, 3031,
-     3079, 3095,    0, 3085, 3127, 3128, 3112, 3115, 3133, 3118,
-     3124,  714, 3134,  657,  656,  655,  654, 3177, 3195, 3221,
-
-     3239, 3265,  653, 3277, 3319, 3295, 3123,    0, 3166,  656,
-     3202, 3217, 3291, 3283, 3282, 3298, 3310, 3327,    0, 3325,
-     3314,    0,  650,  649,  648,    0, 3344,  647, 3370, 3412,
-     3388, 3456, 3430, 3500, 3474, 3329,    0,    0,  377,  658,
-     3339, 3375, 3403, 3446, 3466, 3477,    0, 3494,  645,  644,
-      605,  604,  603, 3547, 3521, 3591, 3565, 3609,  602, 3635,
-        0, 3653, 3494,    0,  123,  602,  608, 3546, 3560,    0,
-     3560, 3598, 3639, 3638, 3634,  571,  570, 4032,  569,    0,
-     3693,  568, 3705, 3679, 3749, 3723,    0, 3636,  572,  569,
-      526,  475, 3663,    0, 3700,    0,    0, 3693, 3710,  467,
-
-      466,  465,  464, 3793, 3768, 3811,  463,    0, 3770,    0,
-        0,    0,    0, 3792,    0,    0, 3803,  462,  461,  423,
-        0, 3837, 4032,    0, 3794, 3811, 3801,  422,  421,  420,
-     4032, 3796, 3812, 3811,  419,  418,  388,    0,    0, 3808,
-        0,  386,  385,  384,    0,  382,  375,  374,    0,  372,
-      365,  321,    0,  320,  316,    0,  315,  314,  308,  306,
-      279,  273,    0,  271,  264, 4032, 3875, 3879, 3883, 3887,
-     3891, 3895, 3897,  230, 3899, 3901, 3903, 3905, 3907, 3909,
-     3911, 3913, 3915, 3917, 3919, 3921, 3923, 3925, 3927, 3929,
-     3931, 3933, 3935, 3937, 3939, 3941, 3943, 3945, 3947, 3949,
-
-     3951, 3953, 3955, 3957, 3959, 3961, 3963, 3965, 3967, 3969,
-      229, 3971, 3973, 3975,  227, 3977, 3979, 3981,  225,  222,
-     3983, 3985, 3987,  220, 3989, 3991,  219,  214, 3993, 3995,
-     3997, 3999, 4001,  212, 4003, 4005, 4007, 4009, 4011,  143,
-     4013, 4015, 4017,  139, 4019,  134, 4021, 4023, 4025,   79,
-     4027
+        1,    0,   49,    0,   97,    0, 3758, 3758, 3758,  143,
+      145,  148,  196,  244,  285,  285,  153,  272,  309,  332,
+      264,  333,  250,  275,  364,  289,  338,  334,  370,  371,
+      370,  376,  373,  402,  281,  391,  281, 3758, 3758,  309,
+     3758,    0,    0,    0,    0, 3758,    0,    0,  355, 3758,
+      430,  466,  482,  498, 3758,  507,  523,  542,  578,  341,
+      330,    0,  336,  355,  364,  366,  376,  367,  376,  388,
+      382,  396,  377,  393,  403,  584,  399,  399,  394,  389,
+      519,  507,  527,  522,    0,  582,  572,  586,  569,  573,
+      576,  584,  593,    0,    0,    0,  582,  588,  586,  587,
+
+      584, 3758,    0,    0,  621,  637,  653,  662,  678,  694,
+      712,  730,    0,  739,    0,  586,  587,  592,  599,  604,
+      590,  605,  633,  636,  664,  690,  697,  706,    0,  742,
+      744,  745,  740,  745,  763,  747,  766,  752,  768,  732,
+      749,  753,  751,  746,  757,  748,  759,  745,  757,  779,
+      752,  751,  761,  767,  770,  765,  771,  765,  786,  802,
+      811,  827,  843,  861,  879,    0,  888,  897,  913,  931,
+      940,  952,    0,  761,  823,  839,  855,  832,  850,  888,
+      901,  933,  929,  960,    0,  944,  930,  932,  932,  950,
+        0,  966,  951,  941,  939,  971,  945,  956,  962,  953,
+
+      965,  949,  948,  963,  957,  970,  987,  956,  972,  976,
+      990,  979,  977,  967,  995,  984,  985,  986, 1000, 1016,
+     1032, 1041, 1057, 1075, 1086, 1095, 1113, 1122, 1140,  987,
+      972,  981, 1028, 1129, 1037, 1124, 1045, 1071, 1081, 1094,
+     1136, 1134, 1127,    0, 1140, 1130, 1142, 1137, 1148, 1139,
+     1154, 1153, 1143, 1154, 1146, 1156, 1144, 1149, 1146, 1141,
+     1178, 1161, 1148, 1164, 1182, 1157, 1153, 1159, 1170, 1173,
+     1156, 1166, 1159, 1173, 1155, 1163, 1195, 1166, 1181, 1195,
+     1195, 1211, 1227, 1245, 1254, 1272, 1281, 1299, 1308,    0,
+     1319, 1211, 1329, 1345, 1363, 1226, 1216, 1239, 1250, 1284,
+
+     1291, 1324, 1330, 1335, 1354, 1376, 1347,    0, 1352, 1353,
+     1356, 1344, 1357,    0, 1349, 1384, 1360, 1362, 1353, 1372,
+     1364, 1363, 1374, 1367, 1363, 1376, 1365, 1383,    0, 1380,
+     1398, 1384, 1379, 1401, 1402, 1388, 1385,    0, 1380, 1376,
+     1380, 1380, 1392, 1411,    0, 1385, 1381, 1390, 1415, 1395,
+     1414, 1430, 1446, 1462,    0, 1473, 1414, 1483, 1499, 1517,
+     1528, 1430, 1537, 1555, 1564, 1582, 1445, 1495, 1478, 1500,
+     1498, 1522, 1571, 1557, 1567, 1570, 1576, 1563, 1575,    0,
+     1568, 1573, 1586, 1588, 1581, 1590, 1581, 1592, 1593, 1594,
+     1587, 1583, 1601, 1581, 1595, 1583, 1618, 1603, 1603, 1605,
+
+     1595, 1604, 1593, 1612, 1599,    0, 1614, 1594, 1603, 1630,
+     1600, 1602, 1607,    0, 1613, 1604, 1606, 1625, 1626, 1636,
+     1652, 1670, 1636, 1679, 1697, 1706, 1724, 1733,    0, 1652,
+     1660, 1742, 1758, 1776, 1678, 1675, 1695, 1727, 1750, 1746,
+     1764, 1765, 1777, 1759, 1775, 1768, 1767, 1771, 1779, 1797,
+        0, 1781, 1773, 1800, 1774,    0, 1772, 1779,    0,    0,
+     1791, 1771, 1785, 1790, 1789, 1792, 1796, 1811, 1796, 1796,
+     1789, 1782, 1799, 1784, 1805, 1798, 1803, 1803, 1791, 1792,
+     1806, 1808, 1808, 1799,    0, 1825, 1841, 1857, 1873,    0,
+     1825, 1841, 1882, 1898, 1916, 1925, 1934, 1952, 1961, 1979,
+
+     1869, 1889, 1918, 1916, 1927, 1954, 1966, 1979, 1977, 1967,
+     1968, 1983, 1971, 1985, 1969, 1972,    0, 1969, 1977, 1987,
+     1973,    0, 1984, 1989, 1981, 1978,    0, 1979, 1989, 1987,
+     2012, 1989, 1989, 1985, 1986, 1985, 1995, 1994, 1991, 2001,
+     1995,    0, 2009,    0, 2008, 2009, 2024, 2024, 2040, 2056,
+     2072, 2081, 2099, 2108, 2126,    0, 2040, 2056, 2135, 2151,
+     2169, 2062, 2070, 2107, 2126, 2147, 2156,    0, 2144, 2166,
+     2168, 2151, 2170, 2169, 2166,    0, 2158, 2176, 2163, 2174,
+        0, 2166, 2163,    0,    0,    0, 2162, 2174, 2179, 2173,
+     2181, 2178, 2183, 2167, 2175, 2186,    0,    0, 2175, 2176,
+
+     2207, 2176, 2194, 2198, 2208, 2224,    0, 2208, 2231, 2241,
+     2257, 2275, 2284, 2302, 2311, 2329,    0, 2221, 2243, 2245,
+     2265, 2277,    0, 2301, 2314, 2310, 2343,    0, 2318, 2328,
+     2322, 2331,    0, 3758, 3758, 2317, 2331, 2320, 2330, 2335,
+     2334, 2322, 2355, 2339, 2342, 2327, 2334, 2343, 2335, 2341,
+        0, 2360, 2360, 2376, 2392, 2408, 2426, 2435, 2453, 2376,
+     2392, 2462, 2478, 2496,    0, 2402, 2408,    0, 2431, 2457,
+     2466,    0, 2483,    0, 2480,    0, 2492,    0, 2493, 2477,
+     2494, 2483, 2502,    0, 2503, 2487, 2491, 2504,    0, 2507,
+     2494, 2497, 2520, 2536, 2552, 2520, 2536, 2568, 2584, 2602,
+
+     2611, 2629, 2638, 2656, 2580, 2571,    0, 2573,    0, 2607,
+     2611, 2637,    0, 2636, 2652, 2653, 2637, 2640, 2658, 2643,
+     2649, 2659, 2661, 2678, 2662, 2668, 2669, 2679, 2695, 2711,
+     2729, 2738, 2756, 2679, 2711, 2765, 2781, 2799, 2701,    0,
+     2727, 2769, 2780, 2765, 2790, 2782, 2781, 2797, 2794, 2801,
+        0, 2799,    0,    0, 2788,    0, 2816, 2832, 2848, 2864,
+     2816, 2832, 2880, 2896, 2914, 2923, 2941, 2950, 2968, 2859,
+        0,    0, 2976, 2892, 2883, 2885, 2914, 2913, 2943, 2966,
+        0, 2958, 2983, 2983, 2999, 2999, 3015, 3031, 3049, 3058,
+     3076, 3031, 3039, 3085, 3101, 3119, 3041,    0, 3126, 3067,
+
+     3093, 3092, 3104,    0, 3107, 3102, 3109, 3108, 3104, 3126,
+     3136, 3758, 3152, 3168, 3136, 3152, 3184, 3202, 3211, 3229,
+     3238, 3147, 3189, 3195, 3216, 3226, 3232,    0, 3240,    0,
+        0, 3226, 3227, 3257, 3257, 3273, 3289, 3305, 3323, 3273,
+     3305, 3332, 3308,    0,    0,    0,    0, 3331,    0,    0,
+     3330, 3349, 3349, 3365, 3381,    0, 3758, 3397, 3346, 3378,
+     3383, 3404, 3414, 3430, 3758, 3394, 3432, 3431, 3448, 3448,
+     3464, 3480,    0, 3445,    0, 3496, 3512, 3528,    0, 3480,
+     3496, 3544, 3560, 3576, 3592, 3608, 3624, 3512, 3640, 3656,
+     3544, 3672, 3688, 3560, 3576, 3704, 3720, 3729, 3592, 3758
     } ;
 
-static yyconst flex_int16_t yy_def[952] =
+static yyconst flex_int16_t yy_def[901] =
     {   0,
-      866,    1,  867,  867,  868,  868,  866,  866,  866,  866,
-      866,  869,  870,  871,  866,  866,   16,  866,  866,   19,
-       19,   19,   19,   19,   19,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,  866,  866,  866,
-      866,  866,  866,  869,  866,  870,  871,  866,  866,  872,
-      866,  873,   51,  866,  874,  866,   25,   25,   58,   58,
-       25,   25,   25,   25,   58,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+      900,    1,  900,    3,  900,    5,  900,  900,  900,  900,
+       10,  900,  900,  900,  900,  900,   16,  900,   16,   19,
+       20,   20,   21,   21,   21,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,  900,  900,  900,
+      900,   10,   11,   10,   12,  900,   13,   14,  900,  900,
+      900,   17,  900,   52,  900,  900,  900,  900,   58,   59,
+       59,   58,   58,   58,   58,   59,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
 
-      866,  872,  866,  875,  103,  876,  866,  874,  866,  109,
-       58,  111,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,  866,  154,  877,  878,  879,  866,  159,
-      866,  866,  866,  162,  111,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,  866,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       58,  900,   14,   51,   17,   53,  105,  900,  900,  900,
+      900,  111,   58,   59,   58,  114,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   17,  159,
+      108,  108,   53,  900,  164,  110,  900,  111,  900,  168,
+      114,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,  900,   58,   58,   58,   58,   58,   58,   58,   58,
 
-       25,   25,   25,   25,   25,   25,   25,  155,  155,  878,
-      880,  881,  866,  866,  866,  214,  866,  866,  218,  866,
-      220,  165,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,  866,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,  882,
-      866,  883,  884,  866,  866,  275,  866,  277,  866,  866,
-      866,  866,  866,  282,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,  159,  160,  162,  108,  900,
+      900,  164,  900,  222,  900,  111,  226,  111,  228,  171,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,  900,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   53,
+      900,  220,   53,  900,  164,  285,  164,  287,  900,  225,
+      900,  900,  228,  900,  293,   58,   58,   58,   58,   58,
 
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-      866,  866,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,  885,  886,  887,
-      866,  866,  866,  866,  866,  344,  866,  866,  866,  349,
-      866,  351,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,  866,  866,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,  900,  900,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      220,  220,  900,  900,  284,  900,  900,  287,  900,  358,
+      900,  291,  228,  363,  111,  365,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      900,  900,   58,   58,   58,   58,   58,   58,   58,   58,
 
-       25,  883,  866,  888,  889,  866,  866,  866,  408,  866,
-      410,  866,  866,  866,  866,  866,  415,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,  866,  866,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,  890,  891,  892,  866,
-      866,  866,  866,  866,  473,  866,  866,  477,  866,  479,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,  282,  900,  353,
+       53,  900,  356,  287,  424,  164,  426,  900,  361,  291,
+      900,  365,  900,  432,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      900,  900,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   53,  353,  900,  900,  422,
+      356,  900,  426,  900,  493,  900,  365,  497,  111,  499,
 
-       25,   25,  866,  866,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,  893,  866,  894,  895,  866,  866,
-      530,  866,  532,  866,  866,  866,  866,  536,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,  866,  866,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,  896,  897,
-      898,  866,  866,  866,  866,  584,  866,  587,  866,  589,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,  900,  900,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,  353,  900,  488,   53,
+      900,  426,  552,  164,  554,  496,  291,  900,  499,  900,
+      559,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,  900,  900,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
 
-       25,   25,   25,   25,   25,   25,   25,  866,  866,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,  899,  866,  900,  901,  866,  628,  866,
-      630,  866,  866,  866,  866,  634,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,  902,  903,  904,  866,  866,  866,  866,  668,
-      866,  671,  866,  673,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,  905,  866,  906,  907,  866,  698,  866,
+       58,   58,   58,  420,  488,  900,  551,  356,  900,  554,
+      900,  610,  499,  613,  111,  615,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,  900,  900,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   53,  900,  606,   53,  554,  656,  164,  658,  291,
+      900,  615,  900,  662,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,  488,  606,  900,  356,  900,  658,  900,  698,
 
-      700,  866,  866,  866,  866,  704,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,  908,  909,  910,  911,  866,  866,  866,  866,
-      729,  866,  732,  866,  734,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,  912,  866,
-      913,  866,  914,  866,  754,  866,  756,  866,  866,  866,
-      915,  760,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,  916,  917,  866,  918,  919,
-      866,  866,  866,  783,  866,  785,  920,   25,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,   25,   25,  921,
-
-      866,  922,  923,  866,  804,  866,  866,  924,   25,   25,
-       25,   25,   25,   25,   25,   25,   25,  925,  866,  926,
-      927,  866,  866,  928,   25,   25,   25,  929,  930,  931,
-      866,   25,   25,   25,  932,  866,  933,  934,   25,   25,
-       25,  935,  936,  937,   25,  938,  866,  939,  940,  941,
-      942,  943,  944,  866,  945,  946,  866,  947,  948,  941,
-      866,  949,  950,  951,  866,    0,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866
+      615,  701,  111,  703,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,  549,  900,  695,  900,  658,
+      730,  164,  732,  291,  900,  703,  900,  736,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   53,  695,  900,  900,
+      356,  900,  732,  900,  763,  703,  766,  111,  768,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,  606,  900,  759,  900,  900,  732,  788,  423,
+      790,  291,  900,  768,  900,  794,   58,   58,   58,   58,
+
+       58,   58,   58,   58,   58,   58,   58,   58,   58,  654,
+      759,  900,  787,  900,  356,  900,  423,  817,  768,  819,
+      900,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   53,  900,  787,  900,  423,  838,  291,
+      900,  900,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,  695,  900,  837,  900,  423,  900,  900,   58,   58,
+       58,  728,  837,  900,  900,   58,   58,   58,  729,  900,
+      864,  900,   58,   58,   58,  759,  864,  900,   58,  785,
+      900,  878,  900,  786,  878,  900,  900,  900,  886,  900,
+      900,  886,  900,  884,  900,  893,  764,  893,  900,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[4107] =
+static yyconst flex_int16_t yy_nxt[3807] =
     {   0,
-        8,    9,   10,   11,   12,   13,   14,    8,    8,    8,
-        8,   15,   16,   17,   17,   17,   17,   17,   17,   17,
-       17,   18,   19,   20,   21,   22,   23,   24,   25,   26,
-       27,   25,   25,   28,   25,   29,   30,   31,   25,   32,
-       33,   34,   35,   36,   37,   25,   25,   25,   19,   20,
-       21,   22,   23,   24,   25,   26,   27,   25,   25,   28,
-       25,   29,   30,   31,   25,   32,   33,   34,   35,   36,
-       37,   25,   25,   25,   41,   42,   43,   42,   49,  866,
-       72,  757,   50,   51,   51,   51,   51,   51,   51,   51,
-       51,   51,   52,   53,   53,   53,   53,   53,   53,   73,
-
-       54,   76,   97,  100,   74,  866,   72,   77,  112,   98,
-       41,   42,   75,   99,   43,   42,   55,   41,   42,   53,
-       53,   53,   53,   53,   53,   73,   54,   76,   97,  100,
-       74,  186,  187,   77,  112,   98,  859,  789,   75,   99,
-      790,  857,   55,   57,   57,  852,   58,   58,   58,   58,
-       58,   58,   58,   58,   58,   52,   58,   58,   58,   59,
-       58,   60,   57,   61,   57,   57,   57,   57,   57,   62,
-       57,   57,   57,   57,   57,   57,   63,   57,   57,   57,
-       57,   57,   58,   58,   58,   59,   58,   60,   57,   61,
-       57,   57,   57,   57,   57,   62,   57,   57,   57,   57,
-
-       57,   57,   63,   57,   57,   57,   57,   57,   58,   58,
-       58,   58,  113,   64,  844,  114,  831,  115,   57,   57,
-      116,  830,  824,  117,  808,   57,   57,  803,  118,  787,
-      119,  753,  108,   82,   58,   58,   58,   58,  113,   64,
-       58,  114,   58,  115,   57,   57,  116,   83,   84,  117,
-       57,   57,   57,   65,  118,   58,  119,   57,   66,   82,
-       70,  120,   85,   67,   68,   58,   58,   58,   58,  122,
-       69,  121,  123,   83,   84,   57,   57,  124,   71,   65,
-      125,   58,   57,   57,   66,  863,   70,  120,   85,   67,
-       68,   58,  863,   58,  863,  122,   69,  121,  123,  126,
-
-      856,   57,  127,  124,   71,  130,  125,  131,   57,   57,
-       57,   57,   57,   57,   57,   57,   57,   57,  866,   57,
-       57,   57,   57,   57,   57,  126,   57,  866,  127,  863,
-       86,  130,   57,  131,   87,  856,  860,  856,  132,   57,
-      133,  849,  856,   78,   88,   57,   57,   57,   57,   57,
-       57,   79,   57,  128,  135,   89,   86,   80,   57,  136,
-       87,   90,   81,   91,  132,   57,  133,   93,   94,   78,
-       88,  129,   92,  137,  138,  139,   95,   79,  143,  128,
-      135,   89,  144,   80,   96,  136,  849,   90,   81,   91,
-      764,  765,  766,  778,  767,  849,  838,  129,   92,  137,
-
-      138,  139,   95,  850,  143,  849,  838,  752,  144,  838,
-       96,  103,  103,  103,  103,  103,  103,  103,  103,  103,
-      104,  105,  105,  105,  105,  105,  105,  145,   54,  105,
-      105,  105,  105,  105,  105,  105,  105,  105,  146,  821,
-      726,  838,  821,  835,  821,  149,  150,  105,  105,  105,
-      105,  105,  105,  145,   54,  109,  109,  109,  109,  109,
-      109,  109,  109,  109,  146,  110,  110,  110,  110,  110,
-      110,  149,  150,  155,  155,  155,  155,  155,  155,  155,
-      155,  155,  780,  697,  761,  821,  780,  752,  107,  813,
-      151,  110,  110,  110,  110,  110,  110,  111,  111,  111,
-
-      111,  111,  111,  111,  111,  111,  104,  111,  111,  111,
-      111,  111,  111,  140,   61,  147,  151,  152,  153,  166,
-      141,  167,  168,  142,  169,  170,  171,  172,  174,  175,
-      176,  177,  148,  111,  111,  111,  111,  111,  111,  140,
-       61,  147,  812,  152,  153,  166,  141,  167,  168,  142,
-      169,  170,  171,  172,  174,  175,  176,  177,  148,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,   52,  155,
-      155,  155,  155,  155,  155,  866,   54,  164,  164,  164,
-      164,  164,  164,  164,  164,  164,  178,  811,  810,  730,
-      780,  752,  800,  179,  180,  155,  155,  155,  155,  155,
-
-      155,  181,   54,  159,  159,  159,  159,  159,  159,  159,
-      159,  159,  178,  160,  160,  160,  160,  160,  160,  179,
-      180,  792,  791,  705,  780,  778,  752,  181,  209,  209,
-      209,  209,  209,  209,  209,  209,  209,  182,  183,  160,
-      160,  160,  160,  160,  160,  161,  185,  162,  162,  162,
-      162,  162,  162,  162,  162,  162,  163,  164,  164,  164,
-      164,  164,  164,  182,  183,  697,  627,  768,  669,  752,
-      697,  107,  185,  738,  635,  726,  697,  627,  723,  188,
-      190,  191,  192,  164,  164,  164,  164,  164,  164,  165,
-      165,  165,  165,  165,  165,  165,  165,  165,   52,  165,
-
-      165,  165,  165,  165,  165,  188,  190,  191,  192,  193,
-      194,  195,  196,  197,  198,  200,  201,  202,  203,  204,
-      205,  206,  207,  721,  707,  165,  165,  165,  165,  165,
-      165,  585,  697,  627,  528,  193,  194,  195,  196,  197,
-      198,  200,  201,  202,  203,  204,  205,  206,  207,  208,
-      208,  208,  208,  208,  208,  208,  208,  208,   52,  209,
-      209,  209,  209,  209,  209,  866,   54,  216,  216,  216,
-      216,  216,  216,  216,  216,  216,  217,  217,  217,  217,
-      217,  217,  217,  217,  217,  209,  209,  209,  209,  209,
-      209,  537,   54,  213,  107,  214,  214,  214,  214,  214,
-
-      214,  214,  214,  214,  215,  216,  216,  216,  216,  216,
-      216,  866,  223,  219,  219,  219,  219,  219,  219,  219,
-      219,  219,  627,  528,  107,  657,  645,  474,  627,  224,
-      225,  216,  216,  216,  216,  216,  216,  161,  229,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  163,  219,
-      219,  219,  219,  219,  219,  224,  225,  528,  624,  621,
-      416,  107,  528,  405,  229,  405,  567,  541,  345,  528,
-      405,  230,  231,  232,  234,  219,  219,  219,  219,  219,
-      219,  220,  220,  220,  220,  220,  220,  220,  220,  220,
-      236,  221,  221,  221,  221,  221,  221,  230,  231,  232,
-
-      234,  107,  510,  499,  496,  283,  237,  107,  405,  273,
-      467,  450,  426,  238,  239,  419,  236,  221,  221,  221,
-      221,  221,  221,  222,  222,  222,  222,  222,  222,  222,
-      222,  222,  237,  222,  222,  222,  222,  222,  222,  238,
-      239,  240,  245,  247,  248,  250,  253,  254,  255,  251,
-      241,  242,  243,  252,  256,  257,  258,  246,  215,  222,
-      222,  222,  222,  222,  222,  262,  266,  240,  245,  247,
-      248,  250,  253,  254,  255,  251,  241,  242,  243,  252,
-      256,  257,  258,  246,  259,  263,  267,  268,  285,  286,
-      287,  262,  266,  292,  293,  295,  264,  296,  294,  260,
-
-      208,  208,  208,  208,  208,  208,  208,  208,  208,  866,
-      259,  263,  267,  268,  285,  286,  287,  405,  273,  292,
-      293,  295,  264,  296,  294,  260,  274,  274,  274,  274,
-      274,  274,  274,  274,  274,  213,  273,  275,  275,  275,
-      275,  275,  275,  275,  275,  275,  215,  276,  276,  276,
-      276,  276,  276,  866,  400,  276,  276,  276,  276,  276,
-      276,  276,  276,  276,  396,  390,  389,  386,  371,  363,
-      297,  163,  107,  276,  276,  276,  276,  276,  276,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  298,  278,
-      278,  278,  278,  278,  278,  279,  297,  217,  217,  217,
-
-      217,  217,  217,  217,  217,  217,  273,  158,  107,  335,
-      321,  866,  273,  158,  298,  278,  278,  278,  278,  278,
-      278,  161,  270,  280,  280,  280,  280,  280,  280,  280,
-      280,  280,  163,  281,  281,  281,  281,  281,  281,  866,
-      302,  281,  281,  281,  281,  281,  281,  281,  281,  281,
-      347,  347,  347,  347,  347,  347,  347,  347,  347,  281,
-      281,  281,  281,  281,  281,  161,  302,  282,  282,  282,
-      282,  282,  282,  282,  282,  282,  283,  284,  284,  284,
-      284,  284,  284,  866,  288,  284,  284,  284,  284,  284,
-      284,  284,  284,  284,  303,  304,  289,  305,  306,  290,
-
-      307,  291,  299,  284,  284,  284,  284,  284,  284,  300,
-      288,  308,  309,  310,  311,  313,  314,  301,  315,  316,
-      303,  304,  289,  305,  306,  290,  307,  291,  299,  312,
-      317,  318,  319,  320,  322,  300,  323,  308,  309,  310,
-      311,  313,  314,  301,  315,  316,  324,  325,  326,  327,
-      328,  329,  330,  331,  332,  312,  317,  318,  319,  320,
-      322,  333,  323,  334,  336,  337,  866,  353,  269,  265,
-      261,  249,  324,  325,  326,  327,  328,  329,  330,  331,
-      332,  244,  235,  233,  228,  227,  226,  333,  107,  334,
-      336,  337,  341,  353,  274,  274,  274,  274,  274,  274,
-
-      274,  274,  274,  213,  158,  342,  342,  342,  342,  342,
-      342,  342,  342,  342,  215,  343,  343,  343,  343,  343,
-      343,  866,  354,  343,  343,  343,  343,  343,  343,  343,
-      343,  343,  158,  199,  189,  184,  173,  158,  107,  134,
-      355,  343,  343,  343,  343,  343,  343,  213,  354,  344,
-      344,  344,  344,  344,  344,  344,  344,  344,  345,  346,
-      346,  346,  346,  346,  346,  866,  355,  346,  346,  346,
-      346,  346,  346,  346,  346,  346,  107,   47,  356,   48,
-       45,  101,   56,   48,   45,  346,  346,  346,  346,  346,
-      346,  161,  866,  348,  348,  348,  348,  348,  348,  348,
-
-      348,  348,  163,  161,  356,  349,  349,  349,  349,  349,
-      349,  349,  349,  349,  283,  350,  350,  350,  350,  350,
-      350,  866,   39,  350,  350,  350,  350,  350,  350,  350,
-      350,  350,   39,  866,  866,  866,  866,  357,  358,  359,
-      360,  350,  350,  350,  350,  350,  350,  351,  351,  351,
-      351,  351,  351,  351,  351,  351,  361,  352,  352,  352,
-      352,  352,  352,  357,  358,  359,  360,  362,  364,  365,
-      366,  367,  368,  369,  370,  372,  373,  374,  375,  376,
-      377,  378,  361,  352,  352,  352,  352,  352,  352,  379,
-      380,  381,  382,  362,  364,  365,  366,  367,  368,  369,
-
-      370,  372,  373,  374,  375,  376,  377,  378,  383,  384,
-      387,  388,  391,  392,  393,  379,  380,  381,  382,  394,
-      395,  397,  385,  398,  399,  401,  866,  866,  866,  866,
-      866,  866,  866,  866,  383,  384,  387,  388,  391,  392,
-      393,  866,  866,  866,  866,  394,  395,  397,  385,  398,
-      399,  401,  406,  406,  406,  406,  406,  406,  406,  406,
-      406,  213,  866,  407,  407,  407,  407,  407,  407,  407,
-      407,  407,  215,  213,  866,  408,  408,  408,  408,  408,
-      408,  408,  408,  408,  345,  409,  409,  409,  409,  409,
-      409,  866,  866,  409,  409,  409,  409,  409,  409,  409,
-
-      409,  409,  866,  866,  866,  866,  866,  866,  418,  866,
-      866,  409,  409,  409,  409,  409,  409,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  420,  411,  411,  411,
-      411,  411,  411,  412,  418,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,  866,  421,  866,  866,  866,  866,
-      866,  866,  420,  411,  411,  411,  411,  411,  411,  161,
-      866,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      161,  421,  413,  413,  413,  413,  413,  413,  413,  413,
-      413,  283,  414,  414,  414,  414,  414,  414,  866,  422,
-      414,  414,  414,  414,  414,  414,  414,  414,  414,  866,
-
-      866,  866,  866,  866,  866,  866,  866,  423,  414,  414,
-      414,  414,  414,  414,  161,  422,  415,  415,  415,  415,
-      415,  415,  415,  415,  415,  416,  417,  417,  417,  417,
-      417,  417,  866,  423,  417,  417,  417,  417,  417,  417,
-      417,  417,  417,  424,  427,  428,  432,  433,  434,  435,
-      436,  437,  417,  417,  417,  417,  417,  417,  425,  429,
-      438,  439,  440,  441,  442,  430,  443,  431,  444,  424,
-      427,  428,  432,  433,  434,  435,  436,  437,  445,  446,
-      447,  448,  449,  451,  425,  429,  438,  439,  440,  441,
-      442,  430,  443,  431,  444,  452,  453,  454,  455,  456,
-
-      457,  458,  459,  460,  445,  446,  447,  448,  449,  451,
-      461,  462,  463,  464,  465,  466,  866,  481,  866,  866,
-      866,  452,  453,  454,  455,  456,  457,  458,  459,  460,
-      866,  866,  866,  866,  866,  866,  461,  462,  463,  464,
-      465,  466,  470,  481,  406,  406,  406,  406,  406,  406,
-      406,  406,  406,  213,  866,  407,  407,  407,  407,  407,
-      407,  407,  407,  407,  213,  866,  471,  471,  471,  471,
-      471,  471,  471,  471,  471,  345,  472,  472,  472,  472,
-      472,  472,  866,  482,  472,  472,  472,  472,  472,  472,
-      472,  472,  472,  476,  476,  476,  476,  476,  476,  476,
-
-      476,  476,  472,  472,  472,  472,  472,  472,  213,  482,
-      473,  473,  473,  473,  473,  473,  473,  473,  473,  474,
-      475,  475,  475,  475,  475,  475,  866,  483,  475,  475,
-      475,  475,  475,  475,  475,  475,  475,  866,  866,  484,
-      866,  866,  866,  866,  866,  866,  475,  475,  475,  475,
-      475,  475,  161,  483,  348,  348,  348,  348,  348,  348,
-      348,  348,  348,  283,  161,  484,  477,  477,  477,  477,
-      477,  477,  477,  477,  477,  416,  478,  478,  478,  478,
-      478,  478,  866,  866,  478,  478,  478,  478,  478,  478,
-      478,  478,  478,  866,  866,  866,  866,  866,  485,  486,
-
-      487,  488,  478,  478,  478,  478,  478,  478,  479,  479,
-      479,  479,  479,  479,  479,  479,  479,  489,  480,  480,
-      480,  480,  480,  480,  485,  486,  487,  488,  490,  491,
-      492,  493,  494,  495,  497,  498,  500,  501,  502,  503,
-      504,  505,  506,  489,  480,  480,  480,  480,  480,  480,
-      507,  508,  509,  511,  490,  491,  492,  493,  494,  495,
-      497,  498,  500,  501,  502,  503,  504,  505,  506,  512,
-      513,  514,  515,  516,  517,  518,  507,  508,  509,  511,
-      519,  520,  521,  522,  523,  524,  529,  529,  529,  529,
-      529,  529,  529,  529,  529,  512,  513,  514,  515,  516,
-
-      517,  518,  866,  866,  866,  866,  519,  520,  521,  522,
-      523,  524,  213,  866,  407,  407,  407,  407,  407,  407,
-      407,  407,  407,  345,  213,  866,  530,  530,  530,  530,
-      530,  530,  530,  530,  530,  474,  531,  531,  531,  531,
-      531,  531,  866,  866,  531,  531,  531,  531,  531,  531,
-      531,  531,  531,  476,  476,  476,  476,  476,  476,  476,
-      476,  476,  531,  531,  531,  531,  531,  531,  532,  532,
-      532,  532,  532,  532,  532,  532,  532,  539,  533,  533,
-      533,  533,  533,  533,  866,  540,  535,  535,  535,  535,
-      535,  535,  535,  535,  535,  866,  866,  866,  866,  866,
-
-      866,  866,  866,  539,  533,  533,  533,  533,  533,  533,
-      161,  540,  534,  534,  534,  534,  534,  534,  534,  534,
-      534,  416,  535,  535,  535,  535,  535,  535,  866,  542,
-      538,  538,  538,  538,  538,  538,  538,  538,  538,  866,
-      866,  866,  866,  866,  866,  866,  543,  544,  535,  535,
-      535,  535,  535,  535,  161,  542,  536,  536,  536,  536,
-      536,  536,  536,  536,  536,  537,  538,  538,  538,  538,
-      538,  538,  543,  544,  545,  546,  547,  548,  549,  550,
-      551,  552,  553,  554,  555,  556,  557,  558,  559,  560,
-      561,  562,  538,  538,  538,  538,  538,  538,  563,  564,
-
-      545,  546,  547,  548,  549,  550,  551,  552,  553,  554,
-      555,  556,  557,  558,  559,  560,  561,  562,  568,  565,
-      569,  570,  571,  572,  563,  564,  566,  573,  574,  575,
-      576,  577,  578,  529,  529,  529,  529,  529,  529,  529,
-      529,  529,  866,  866,  568,  565,  569,  570,  571,  572,
-      866,  866,  566,  573,  574,  575,  576,  577,  578,  213,
-      866,  582,  582,  582,  582,  582,  582,  582,  582,  582,
-      474,  583,  583,  583,  583,  583,  583,  866,  591,  583,
-      583,  583,  583,  583,  583,  583,  583,  583,  866,  866,
-      866,  866,  866,  866,  866,  866,  592,  583,  583,  583,
-
-      583,  583,  583,  213,  591,  584,  584,  584,  584,  584,
-      584,  584,  584,  584,  585,  586,  586,  586,  586,  586,
-      586,  866,  592,  586,  586,  586,  586,  586,  586,  586,
-      586,  586,  866,  866,  593,  866,  866,  866,  866,  866,
-      866,  586,  586,  586,  586,  586,  586,  161,  866,  348,
-      348,  348,  348,  348,  348,  348,  348,  348,  416,  161,
-      593,  587,  587,  587,  587,  587,  587,  587,  587,  587,
-      537,  588,  588,  588,  588,  588,  588,  866,  866,  588,
-      588,  588,  588,  588,  588,  588,  588,  588,  866,  866,
-      866,  866,  866,  594,  595,  596,  597,  588,  588,  588,
-
-      588,  588,  588,  589,  589,  589,  589,  589,  589,  589,
-      589,  589,  598,  590,  590,  590,  590,  590,  590,  594,
-      595,  596,  597,  599,  600,  601,  602,  603,  604,  605,
-      606,  607,  608,  609,  610,  611,  612,  866,  598,  590,
-      590,  590,  590,  590,  590,  615,  616,  617,  618,  599,
-      600,  601,  602,  603,  604,  605,  606,  607,  608,  609,
-      610,  611,  612,  613,  619,  620,  622,  623,  637,  638,
-      614,  615,  616,  617,  618,  213,  866,  407,  407,  407,
-      407,  407,  407,  407,  407,  407,  474,  866,  866,  613,
-      619,  620,  622,  623,  637,  638,  614,  213,  866,  628,
-
-      628,  628,  628,  628,  628,  628,  628,  628,  585,  629,
-      629,  629,  629,  629,  629,  866,  866,  629,  629,  629,
-      629,  629,  629,  629,  629,  629,  866,  866,  866,  866,
-      866,  866,  639,  866,  866,  629,  629,  629,  629,  629,
-      629,  630,  630,  630,  630,  630,  630,  630,  630,  630,
-      640,  631,  631,  631,  631,  631,  631,  866,  639,  633,
-      633,  633,  633,  633,  633,  633,  633,  633,  866,  866,
-      866,  866,  866,  866,  866,  866,  640,  631,  631,  631,
-      631,  631,  631,  161,  866,  632,  632,  632,  632,  632,
-      632,  632,  632,  632,  537,  633,  633,  633,  633,  633,
-
-      633,  866,  641,  636,  636,  636,  636,  636,  636,  636,
-      636,  636,  866,  866,  866,  866,  866,  866,  866,  642,
-      643,  633,  633,  633,  633,  633,  633,  161,  641,  634,
-      634,  634,  634,  634,  634,  634,  634,  634,  635,  636,
-      636,  636,  636,  636,  636,  642,  643,  644,  646,  647,
-      648,  649,  650,  651,  652,  653,  654,  655,  656,  658,
-      659,  660,  661,  662,  866,  636,  636,  636,  636,  636,
-      636,  866,  866,  644,  646,  647,  648,  649,  650,  651,
-      652,  653,  654,  655,  656,  658,  659,  660,  661,  662,
-      213,  866,  666,  666,  666,  666,  666,  666,  666,  666,
-
-      666,  585,  667,  667,  667,  667,  667,  667,  866,  675,
-      667,  667,  667,  667,  667,  667,  667,  667,  667,  866,
-      866,  866,  866,  866,  866,  866,  866,  676,  667,  667,
-      667,  667,  667,  667,  213,  675,  668,  668,  668,  668,
-      668,  668,  668,  668,  668,  669,  670,  670,  670,  670,
-      670,  670,  866,  676,  670,  670,  670,  670,  670,  670,
-      670,  670,  670,  866,  866,  677,  866,  866,  866,  866,
-      866,  866,  670,  670,  670,  670,  670,  670,  161,  866,
-      348,  348,  348,  348,  348,  348,  348,  348,  348,  537,
-      161,  677,  671,  671,  671,  671,  671,  671,  671,  671,
-
-      671,  635,  672,  672,  672,  672,  672,  672,  866,  866,
-      672,  672,  672,  672,  672,  672,  672,  672,  672,  866,
-      866,  866,  866,  866,  678,  679,  866,  682,  672,  672,
-      672,  672,  672,  672,  673,  673,  673,  673,  673,  673,
-      673,  673,  673,  683,  674,  674,  674,  674,  674,  674,
-      678,  679,  680,  682,  684,  685,  686,  687,  681,  688,
-      689,  690,  691,  692,  693,  866,  708,  866,  866,  683,
-      674,  674,  674,  674,  674,  674,  866,  866,  680,  866,
-      684,  685,  686,  687,  681,  688,  689,  690,  691,  692,
-      693,  213,  708,  407,  407,  407,  407,  407,  407,  407,
-
-      407,  407,  585,  213,  866,  698,  698,  698,  698,  698,
-      698,  698,  698,  698,  669,  699,  699,  699,  699,  699,
-      699,  866,  866,  699,  699,  699,  699,  699,  699,  699,
-      699,  699,  866,  866,  866,  866,  866,  866,  709,  866,
-      866,  699,  699,  699,  699,  699,  699,  700,  700,  700,
-      700,  700,  700,  700,  700,  700,  710,  701,  701,  701,
-      701,  701,  701,  866,  709,  703,  703,  703,  703,  703,
-      703,  703,  703,  703,  866,  866,  866,  866,  866,  866,
-      866,  866,  710,  701,  701,  701,  701,  701,  701,  161,
-      866,  702,  702,  702,  702,  702,  702,  702,  702,  702,
-
-      635,  703,  703,  703,  703,  703,  703,  866,  711,  706,
-      706,  706,  706,  706,  706,  706,  706,  706,  866,  866,
-      866,  866,  866,  866,  866,  712,  713,  703,  703,  703,
-      703,  703,  703,  161,  711,  704,  704,  704,  704,  704,
-      704,  704,  704,  704,  705,  706,  706,  706,  706,  706,
-      706,  712,  713,  714,  715,  716,  717,  718,  719,  720,
-      722,  866,  736,  866,  866,  866,  866,  866,  866,  866,
-      866,  706,  706,  706,  706,  706,  706,  866,  866,  714,
-      715,  716,  717,  718,  719,  720,  722,  213,  736,  727,
-      727,  727,  727,  727,  727,  727,  727,  727,  669,  728,
-
-      728,  728,  728,  728,  728,  866,  737,  728,  728,  728,
-      728,  728,  728,  728,  728,  728,  866,  866,  866,  866,
-      866,  866,  866,  866,  739,  728,  728,  728,  728,  728,
-      728,  213,  737,  729,  729,  729,  729,  729,  729,  729,
-      729,  729,  730,  731,  731,  731,  731,  731,  731,  866,
-      739,  731,  731,  731,  731,  731,  731,  731,  731,  731,
-      866,  866,  740,  866,  866,  866,  866,  866,  866,  731,
-      731,  731,  731,  731,  731,  161,  866,  348,  348,  348,
-      348,  348,  348,  348,  348,  348,  635,  161,  740,  732,
-      732,  732,  732,  732,  732,  732,  732,  732,  705,  733,
-
-      733,  733,  733,  733,  733,  866,  866,  733,  733,  733,
-      733,  733,  733,  733,  733,  733,  866,  866,  866,  866,
-      866,  741,  742,  743,  744,  733,  733,  733,  733,  733,
-      733,  734,  734,  734,  734,  734,  734,  734,  734,  734,
-      745,  735,  735,  735,  735,  735,  735,  741,  742,  743,
-      744,  746,  747,  748,  213,  763,  407,  407,  407,  407,
-      407,  407,  407,  407,  407,  669,  745,  735,  735,  735,
-      735,  735,  735,  769,  866,  866,  866,  746,  747,  748,
-      213,  763,  754,  754,  754,  754,  754,  754,  754,  754,
-      754,  730,  755,  755,  755,  755,  755,  755,  866,  769,
-
-      755,  755,  755,  755,  755,  755,  755,  755,  755,  866,
-      866,  866,  866,  866,  866,  770,  866,  866,  755,  755,
-      755,  755,  755,  755,  756,  756,  756,  756,  756,  756,
-      756,  756,  756,  771,  757,  757,  757,  757,  757,  757,
-      866,  770,  759,  759,  759,  759,  759,  759,  759,  759,
-      759,  866,  866,  866,  866,  866,  866,  866,  866,  771,
-      757,  757,  757,  757,  757,  757,  161,  866,  758,  758,
-      758,  758,  758,  758,  758,  758,  758,  705,  759,  759,
-      759,  759,  759,  759,  866,  772,  762,  762,  762,  762,
-      762,  762,  762,  762,  762,  866,  866,  866,  866,  866,
-
-      866,  866,  773,  774,  759,  759,  759,  759,  759,  759,
-      161,  772,  760,  760,  760,  760,  760,  760,  760,  760,
-      760,  761,  762,  762,  762,  762,  762,  762,  773,  774,
-      775,  866,  788,  782,  782,  782,  782,  782,  782,  782,
-      782,  782,  866,  866,  866,  866,  866,  866,  762,  762,
-      762,  762,  762,  762,  866,  866,  775,  213,  788,  781,
-      781,  781,  781,  781,  781,  781,  781,  781,  730,  782,
-      782,  782,  782,  782,  782,  866,  793,  784,  784,  784,
-      784,  784,  784,  784,  784,  784,  794,  866,  866,  866,
-      866,  866,  866,  866,  795,  782,  782,  782,  782,  782,
-
-      782,  213,  793,  783,  783,  783,  783,  783,  783,  783,
-      783,  783,  794,  784,  784,  784,  784,  784,  784,  161,
-      795,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      705,  866,  866,  866,  866,  866,  866,  866,  796,  784,
-      784,  784,  784,  784,  784,  161,  866,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  761,  786,  786,  786,
-      786,  786,  786,  866,  796,  786,  786,  786,  786,  786,
-      786,  786,  786,  786,  797,  798,  799,  866,  809,  866,
-      866,  866,  866,  786,  786,  786,  786,  786,  786,  866,
-      814,  805,  805,  805,  805,  805,  805,  805,  805,  805,
-
-      797,  798,  799,  213,  809,  407,  407,  407,  407,  407,
-      407,  407,  407,  407,  730,  213,  814,  804,  804,  804,
-      804,  804,  804,  804,  804,  804,  815,  805,  805,  805,
-      805,  805,  805,  866,  816,  807,  807,  807,  807,  807,
-      807,  807,  807,  807,  866,  866,  866,  866,  866,  866,
-      866,  817,  815,  805,  805,  805,  805,  805,  805,  161,
-      816,  806,  806,  806,  806,  806,  806,  806,  806,  806,
-      761,  807,  807,  807,  807,  807,  807,  817,  866,  866,
-      823,  823,  823,  823,  823,  823,  823,  823,  823,  866,
-      866,  866,  866,  866,  866,  866,  825,  807,  807,  807,
-
-      807,  807,  807,  213,  866,  822,  822,  822,  822,  822,
-      822,  822,  822,  822,  826,  823,  823,  823,  823,  823,
-      823,  161,  825,  348,  348,  348,  348,  348,  348,  348,
-      348,  348,  761,  827,  832,  833,  834,  839,  840,  841,
-      826,  823,  823,  823,  823,  823,  823,  213,  845,  407,
-      407,  407,  407,  407,  407,  407,  407,  407,  866,  827,
-      832,  833,  834,  839,  840,  841,  866,  866,  866,  866,
-      866,  866,  866,  866,  845,   38,   38,   38,   38,   40,
-       40,   40,   40,   44,   44,   44,   44,   46,  866,   46,
-       46,   47,   47,   47,   47,  102,  866,  102,  102,  106,
-
-      106,  156,  156,  157,  157,  210,  210,  211,  211,  212,
-      212,  271,  271,  272,  272,  338,  338,  339,  339,  340,
-      340,  402,  402,  403,  403,  404,  404,  468,  468,  469,
-      469,  525,  525,  526,  526,  527,  527,  579,  579,  580,
-      580,  581,  581,  468,  468,  625,  625,  626,  626,  663,
-      663,  664,  664,  665,  665,  694,  694,  695,  695,  696,
-      696,  580,  580,  724,  724,  725,  725,  749,  749,  750,
-      750,  751,  751,  776,  776,  777,  777,  779,  779,  664,
-      664,  801,  801,  802,  802,  818,  818,  819,  819,  820,
-      820,  828,  828,  829,  829,  724,  724,  836,  836,  837,
-
-      837,  842,  842,  843,  843,  846,  846,  847,  847,  848,
-      848,  777,  777,  851,  851,  853,  853,  854,  854,  855,
-      855,  858,  858,  861,  861,  862,  862,  864,  864,  865,
-      865,    7,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-
-      866,  866,  866,  866,  866,  866
+      900,    8,    9,   10,   11,   12,   13,   14,    8,    8,
+        8,    8,   15,   16,   17,   17,   17,   17,   17,   17,
+       17,   17,   18,   19,   20,   21,   22,   23,   24,   25,
+       26,   27,   25,   25,   28,   25,   29,   30,   31,   25,
+       32,   33,   34,   35,   36,   37,   25,   25,   25,   38,
+       38,   39,   38,   38,   38,   38,   40,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   42,   43,   44,   45,   45,
+       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   47,   47,  900,   47,
+
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   48,   48,   48,   48,   48,   48,
+       49,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   50,   57,   58,   71,   51,   52,   52,   52,
+
+       52,   52,   52,   52,   52,   52,   53,   54,   54,   54,
+       54,   54,   54,   72,   55,   73,   98,  101,   58,   58,
+      102,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+       56,   59,   59,   59,   60,   59,   61,   58,   62,   58,
+       58,   58,   58,   58,   63,   58,   58,   58,   58,   58,
+       58,   64,   58,   58,   58,   58,   58,   59,   66,   59,
+       74,  103,   65,   67,   77,   75,  116,   58,   68,   69,
+       78,  117,  118,   76,   58,   70,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,  900,   58,   58,   58,   58,
+       58,   58,   79,   58,   83,   85,  119,   90,   87,  120,
+
+       80,  121,   88,   91,  122,   92,   81,  123,   84,   86,
+      124,   82,   89,   99,   93,   94,   95,  100,  126,  127,
+      125,  128,  129,  130,   96,  131,  134,  135,  136,  137,
+      104,  104,   97,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  105,  105,
+      105,  105,  105,  105,  105,  105,  105,  106,  107,  107,
+      107,  107,  107,  107,  108,  108,  108,  108,  108,  108,
+
+      108,  108,  108,  109,  108,  108,  108,  108,  108,  108,
+      107,  107,  107,  107,  107,  107,  107,  107,  107,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  138,  110,
+      110,  110,  110,  110,  110,  111,  111,  111,  111,  111,
+      111,  111,  111,  111,  139,  112,  112,  112,  112,  112,
+      112,  113,  113,  140,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  141,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  106,
+
+      114,  114,  114,  114,  114,  114,  132,  115,  142,  143,
+      144,  148,  149,  150,  151,  152,  154,  145,  155,  156,
+      146,  147,  157,  158,  133,  172,  173,  174,  175,  176,
+      177,  178,  153,  159,  159,  159,  159,  159,  159,  159,
+      159,  159,  179,  160,  160,  160,  160,  160,  160,  161,
+      161,  161,  161,  161,  161,  161,  161,  161,  180,  161,
+      161,  161,  161,  161,  161,  160,  160,  160,  160,  160,
+      160,  160,  160,  160,  162,  162,  162,  162,  162,  162,
+      162,  162,  162,  163,  162,  162,  162,  162,  162,  162,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  181,
+
+      165,  165,  165,  165,  165,  165,  166,  166,  166,  166,
+      166,  166,  166,  166,  166,  182,  166,  166,  166,  166,
+      166,  166,  167,  183,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  169,  170,  170,  170,  170,  170,  170,
+      900,  184,  170,  170,  170,  170,  170,  170,  170,  170,
+      170,  171,  171,  171,  171,  171,  171,  171,  171,  171,
+       53,  171,  171,  171,  171,  171,  171,  185,  186,  187,
+      188,  189,  190,  191,  192,  193,  194,  195,  196,  197,
+      198,  199,  200,  201,  202,  203,  204,  205,  206,  207,
+      208,  210,  209,  211,  212,  213,  214,  215,  216,  216,
+
+      216,  216,  216,  216,  216,  216,  216,  233,  217,  217,
+      217,  217,  217,  217,  217,  217,  217,  217,  217,  217,
+      217,  217,  217,  218,  218,  218,  218,  218,  218,  218,
+      218,  218,  234,  218,  218,  218,  218,  218,  218,  219,
+      219,  219,  219,  219,  219,  219,  219,  219,  235,  219,
+      219,  219,  219,  219,  219,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  236,  220,  220,  220,  220,  220,
+      220,  221,  237,  222,  222,  222,  222,  222,  222,  222,
+      222,  222,  223,  224,  224,  224,  224,  224,  224,  900,
+      238,  224,  224,  224,  224,  224,  224,  224,  224,  224,
+
+      225,  225,  225,  225,  225,  225,  225,  225,  225,  226,
+      226,  226,  226,  226,  226,  226,  226,  226,  239,  227,
+      227,  227,  227,  227,  227,  228,  228,  228,  228,  228,
+      228,  228,  228,  228,  240,  229,  229,  229,  229,  229,
+      229,  900,  241,  227,  227,  227,  227,  227,  227,  227,
+      227,  227,  230,  230,  230,  230,  230,  230,  230,  230,
+      230,  231,  230,  230,  230,  230,  230,  230,  242,  243,
+      244,  245,  246,  247,  248,  252,  253,  255,  232,  256,
+      257,  258,  259,  249,  250,  251,  260,  261,  262,  263,
+      264,  254,  265,  266,  267,  268,  270,  271,  272,  275,
+
+      273,  276,  277,  278,  279,  900,  900,  280,  900,  296,
+      269,  274,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  297,  281,  281,  281,  281,  281,  281,  282,  282,
+      282,  282,  282,  282,  282,  282,  282,  283,  282,  282,
+      282,  282,  282,  282,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  285,  285,  285,  285,  285,  285,  285,
+      285,  285,  298,  286,  286,  286,  286,  286,  286,  287,
+      287,  287,  287,  287,  287,  287,  287,  287,  303,  288,
+      288,  288,  288,  288,  288,  900,  306,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  289,  307,  290,  290,
+
+      290,  290,  290,  290,  290,  290,  290,  291,  291,  291,
+      291,  291,  291,  291,  291,  291,  308,  292,  292,  292,
+      292,  292,  292,  900,  309,  292,  292,  292,  292,  292,
+      292,  292,  292,  292,  293,  293,  293,  293,  293,  293,
+      293,  293,  293,  294,  295,  295,  295,  295,  295,  295,
+      900,  299,  295,  295,  295,  295,  295,  295,  295,  295,
+      295,  304,  310,  300,  313,  305,  301,  314,  302,  311,
+      315,  316,  317,  318,  319,  320,  321,  312,  322,  324,
+      325,  326,  327,  328,  329,  330,  331,  332,  333,  334,
+      335,  336,  337,  323,  338,  339,  340,  341,  342,  343,
+
+      344,  345,  346,  347,  348,  349,  350,  351,  351,  351,
+      351,  351,  351,  351,  351,  351,  163,  351,  351,  351,
+      351,  351,  351,  352,  352,  352,  352,  352,  352,  352,
+      352,  352,  169,  352,  352,  352,  352,  352,  352,  353,
+      353,  353,  353,  353,  353,  353,  353,  353,  367,  353,
+      353,  353,  353,  353,  353,  354,  368,  355,  355,  355,
+      355,  355,  355,  355,  355,  355,  356,  356,  356,  356,
+      356,  356,  356,  356,  356,  369,  357,  357,  357,  357,
+      357,  357,  900,  370,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  358,  358,  358,  358,  358,  358,  358,
+
+      358,  358,  359,  360,  360,  360,  360,  360,  360,  900,
+      371,  360,  360,  360,  360,  360,  360,  360,  360,  360,
+      361,  361,  361,  361,  361,  361,  361,  361,  361,  167,
+      372,  362,  362,  362,  362,  362,  362,  362,  362,  362,
+      169,  363,  363,  363,  363,  363,  363,  363,  363,  363,
+      373,  364,  364,  364,  364,  364,  364,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  374,  366,  366,  366,
+      366,  366,  366,  900,  375,  364,  364,  364,  364,  364,
+      364,  364,  364,  364,  376,  377,  378,  379,  380,  381,
+      382,  383,  384,  385,  386,  387,  388,  389,  390,  391,
+
+      392,  393,  394,  395,  396,  397,  398,  400,  401,  402,
+      403,  404,  405,  406,  407,  408,  409,  410,  411,  399,
+      412,  413,  414,  415,  416,  417,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  223,  418,  418,  418,  418,
+      418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+      419,  900,  419,  419,  419,  419,  419,  419,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  421,  420,  420,
+      420,  420,  420,  420,  422,  422,  422,  422,  422,  422,
+      422,  422,  422,  221,  435,  423,  423,  423,  423,  423,
+      423,  423,  423,  423,  223,  424,  424,  424,  424,  424,
+
+      424,  424,  424,  424,  436,  425,  425,  425,  425,  425,
+      425,  426,  426,  426,  426,  426,  426,  426,  426,  426,
+      437,  427,  427,  427,  427,  427,  427,  900,  438,  425,
+      425,  425,  425,  425,  425,  425,  425,  425,  428,  439,
+      429,  429,  429,  429,  429,  429,  429,  429,  429,  430,
+      430,  430,  430,  430,  430,  430,  430,  430,  440,  431,
+      431,  431,  431,  431,  431,  900,  443,  431,  431,  431,
+      431,  431,  431,  431,  431,  431,  432,  432,  432,  432,
+      432,  432,  432,  432,  432,  433,  434,  434,  434,  434,
+      434,  434,  900,  441,  434,  434,  434,  434,  434,  434,
+
+      434,  434,  434,  444,  445,  446,  449,  450,  442,  451,
+      452,  447,  453,  448,  454,  455,  456,  457,  458,  459,
+      460,  461,  462,  463,  464,  465,  466,  467,  468,  469,
+      470,  471,  472,  473,  474,  475,  476,  477,  478,  479,
+      480,  481,  482,  483,  484,  485,  486,  283,  487,  487,
+      487,  487,  487,  487,  487,  487,  487,  900,  487,  487,
+      487,  487,  487,  487,  488,  488,  488,  488,  488,  488,
+      488,  488,  488,  294,  488,  488,  488,  488,  488,  488,
+      489,  294,  490,  490,  490,  490,  490,  490,  490,  490,
+      490,  491,  491,  491,  491,  491,  491,  491,  491,  491,
+
+      501,  492,  492,  492,  492,  492,  492,  900,  502,  492,
+      492,  492,  492,  492,  492,  492,  492,  492,  493,  493,
+      493,  493,  493,  493,  493,  493,  493,  494,  495,  495,
+      495,  495,  495,  495,  900,  503,  495,  495,  495,  495,
+      495,  495,  495,  495,  495,  496,  496,  496,  496,  496,
+      496,  496,  496,  496,  497,  497,  497,  497,  497,  497,
+      497,  497,  497,  504,  498,  498,  498,  498,  498,  498,
+      499,  499,  499,  499,  499,  499,  499,  499,  499,  505,
+      500,  500,  500,  500,  500,  500,  900,  506,  498,  498,
+      498,  498,  498,  498,  498,  498,  498,  507,  508,  509,
+
+      510,  511,  512,  513,  514,  515,  516,  517,  518,  519,
+      520,  521,  522,  523,  524,  525,  526,  527,  528,  529,
+      530,  531,  532,  533,  534,  535,  536,  537,  538,  539,
+      540,  541,  542,  543,  544,  545,  546,  547,  547,  547,
+      547,  547,  547,  547,  547,  547,  359,  547,  547,  547,
+      547,  547,  547,  548,  548,  548,  548,  548,  548,  548,
+      548,  548,  359,  548,  548,  548,  548,  548,  548,  549,
+      549,  549,  549,  549,  549,  549,  549,  549,  550,  549,
+      549,  549,  549,  549,  549,  551,  551,  551,  551,  551,
+      551,  551,  551,  551,  552,  552,  552,  552,  552,  552,
+
+      552,  552,  552,  562,  553,  553,  553,  553,  553,  553,
+      554,  554,  554,  554,  554,  554,  554,  554,  554,  563,
+      555,  555,  555,  555,  555,  555,  900,  564,  553,  553,
+      553,  553,  553,  553,  553,  553,  553,  556,  556,  556,
+      556,  556,  556,  556,  556,  556,  557,  557,  557,  557,
+      557,  557,  557,  557,  557,  565,  558,  558,  558,  558,
+      558,  558,  900,  566,  558,  558,  558,  558,  558,  558,
+      558,  558,  558,  559,  559,  559,  559,  559,  559,  559,
+      559,  559,  560,  561,  561,  561,  561,  561,  561,  900,
+      567,  561,  561,  561,  561,  561,  561,  561,  561,  561,
+
+      568,  569,  570,  571,  572,  573,  574,  575,  576,  577,
+      578,  579,  580,  581,  582,  583,  584,  585,  586,  587,
+      588,  590,  591,  592,  593,  594,  595,  589,  596,  597,
+      598,  599,  600,  601,  602,  603,  604,  604,  604,  604,
+      604,  604,  604,  604,  604,  421,  604,  604,  604,  604,
+      604,  604,  605,  605,  605,  605,  605,  605,  605,  605,
+      605,  433,  605,  605,  605,  605,  605,  605,  606,  606,
+      606,  606,  606,  606,  606,  606,  606,  433,  606,  606,
+      606,  606,  606,  606,  607,  607,  607,  607,  607,  607,
+      607,  607,  607,  608,  608,  608,  608,  608,  608,  608,
+
+      608,  608,  617,  609,  609,  609,  609,  609,  609,  900,
+      618,  609,  609,  609,  609,  609,  609,  609,  609,  609,
+      610,  610,  610,  610,  610,  610,  610,  610,  610,  611,
+      612,  612,  612,  612,  612,  612,  900,  619,  612,  612,
+      612,  612,  612,  612,  612,  612,  612,  613,  613,  613,
+      613,  613,  613,  613,  613,  613,  620,  614,  614,  614,
+      614,  614,  614,  615,  615,  615,  615,  615,  615,  615,
+      615,  615,  621,  616,  616,  616,  616,  616,  616,  900,
+      622,  614,  614,  614,  614,  614,  614,  614,  614,  614,
+      623,  624,  625,  626,  627,  628,  629,  630,  631,  632,
+
+      633,  634,  635,  636,  637,  638,  639,  641,  642,  643,
+      644,  645,  646,  640,  647,  648,  649,  650,  651,  652,
+      653,  653,  653,  653,  653,  653,  653,  653,  653,  494,
+      653,  653,  653,  653,  653,  653,  654,  654,  654,  654,
+      654,  654,  654,  654,  654,  655,  654,  654,  654,  654,
+      654,  654,  494,  656,  656,  656,  656,  656,  656,  656,
+      656,  656,  665,  657,  657,  657,  657,  657,  657,  658,
+      658,  658,  658,  658,  658,  658,  658,  658,  666,  659,
+      659,  659,  659,  659,  659,  900,  667,  657,  657,  657,
+      657,  657,  657,  657,  657,  657,  660,  660,  660,  660,
+
+      660,  660,  660,  660,  660,  668,  661,  661,  661,  661,
+      661,  661,  900,  669,  661,  661,  661,  661,  661,  661,
+      661,  661,  661,  662,  662,  662,  662,  662,  662,  662,
+      662,  662,  663,  664,  664,  664,  664,  664,  664,  900,
+      670,  664,  664,  664,  664,  664,  664,  664,  664,  664,
+      671,  672,  673,  674,  675,  676,  677,  678,  679,  680,
+      681,  682,  683,  684,  685,  686,  687,  688,  689,  690,
+      691,  692,  693,  693,  693,  693,  693,  693,  693,  693,
+      693,  550,  693,  693,  693,  693,  693,  693,  694,  694,
+      694,  694,  694,  694,  694,  694,  694,  560,  694,  694,
+
+      694,  694,  694,  694,  695,  695,  695,  695,  695,  695,
+      695,  695,  695,  560,  695,  695,  695,  695,  695,  695,
+      696,  696,  696,  696,  696,  696,  696,  696,  696,  705,
+      697,  697,  697,  697,  697,  697,  900,  706,  697,  697,
+      697,  697,  697,  697,  697,  697,  697,  698,  698,  698,
+      698,  698,  698,  698,  698,  698,  699,  700,  700,  700,
+      700,  700,  700,  900,  707,  700,  700,  700,  700,  700,
+      700,  700,  700,  700,  701,  701,  701,  701,  701,  701,
+      701,  701,  701,  708,  702,  702,  702,  702,  702,  702,
+      703,  703,  703,  703,  703,  703,  703,  703,  703,  709,
+
+      704,  704,  704,  704,  704,  704,  900,  712,  702,  702,
+      702,  702,  702,  702,  702,  702,  702,  710,  713,  714,
+      715,  716,  717,  711,  718,  719,  720,  721,  722,  723,
+      724,  725,  726,  726,  726,  726,  726,  726,  726,  726,
+      726,  611,  726,  726,  726,  726,  726,  726,  727,  727,
+      727,  727,  727,  727,  727,  727,  727,  611,  727,  727,
+      727,  727,  727,  727,  728,  728,  728,  728,  728,  728,
+      728,  728,  728,  729,  728,  728,  728,  728,  728,  728,
+      730,  730,  730,  730,  730,  730,  730,  730,  730,  739,
+      731,  731,  731,  731,  731,  731,  732,  732,  732,  732,
+
+      732,  732,  732,  732,  732,  740,  733,  733,  733,  733,
+      733,  733,  900,  741,  731,  731,  731,  731,  731,  731,
+      731,  731,  731,  734,  734,  734,  734,  734,  734,  734,
+      734,  734,  742,  735,  735,  735,  735,  735,  735,  900,
+      743,  735,  735,  735,  735,  735,  735,  735,  735,  735,
+      736,  736,  736,  736,  736,  736,  736,  736,  736,  737,
+      738,  738,  738,  738,  738,  738,  900,  744,  738,  738,
+      738,  738,  738,  738,  738,  738,  738,  745,  746,  747,
+      748,  749,  750,  751,  752,  753,  754,  755,  756,  757,
+      655,  758,  758,  758,  758,  758,  758,  758,  758,  758,
+
+      663,  758,  758,  758,  758,  758,  758,  759,  759,  759,
+      759,  759,  759,  759,  759,  759,  760,  759,  759,  759,
+      759,  759,  759,  761,  761,  761,  761,  761,  761,  761,
+      761,  761,  663,  762,  762,  762,  762,  762,  762,  900,
+      770,  762,  762,  762,  762,  762,  762,  762,  762,  762,
+      763,  763,  763,  763,  763,  763,  763,  763,  763,  764,
+      765,  765,  765,  765,  765,  765,  900,  771,  765,  765,
+      765,  765,  765,  765,  765,  765,  765,  766,  766,  766,
+      766,  766,  766,  766,  766,  766,  772,  767,  767,  767,
+      767,  767,  767,  768,  768,  768,  768,  768,  768,  768,
+
+      768,  768,  773,  769,  769,  769,  769,  769,  769,  900,
+      774,  767,  767,  767,  767,  767,  767,  767,  767,  767,
+      775,  776,  777,  778,  779,  780,  781,  782,  783,  783,
+      783,  783,  783,  783,  783,  783,  783,  699,  783,  783,
+      783,  783,  783,  783,  784,  784,  784,  784,  784,  784,
+      784,  784,  784,  699,  784,  784,  784,  784,  784,  784,
+      785,  785,  785,  785,  785,  785,  785,  785,  785,  786,
+      785,  785,  785,  785,  785,  785,  787,  787,  787,  787,
+      787,  787,  787,  787,  787,  797,  787,  787,  787,  787,
+      787,  787,  788,  788,  788,  788,  788,  788,  788,  788,
+
+      788,  802,  789,  789,  789,  789,  789,  789,  790,  790,
+      790,  790,  790,  790,  790,  790,  790,  803,  791,  791,
+      791,  791,  791,  791,  900,  804,  789,  789,  789,  789,
+      789,  789,  789,  789,  789,  792,  792,  792,  792,  792,
+      792,  792,  792,  792,  805,  793,  793,  793,  793,  793,
+      793,  900,  806,  793,  793,  793,  793,  793,  793,  793,
+      793,  793,  794,  794,  794,  794,  794,  794,  794,  794,
+      794,  795,  796,  796,  796,  796,  796,  796,  900,  807,
+      796,  796,  796,  796,  796,  796,  796,  796,  796,  798,
+      799,  800,  808,  801,  809,  810,  810,  810,  810,  810,
+
+      810,  810,  810,  810,  729,  810,  810,  810,  810,  810,
+      810,  811,  811,  811,  811,  811,  811,  811,  811,  811,
+      812,  811,  811,  811,  811,  811,  811,  813,  813,  813,
+      813,  813,  813,  813,  813,  813,  814,  813,  813,  813,
+      813,  813,  813,  815,  815,  815,  815,  815,  815,  815,
+      815,  815,  737,  816,  816,  816,  816,  816,  816,  900,
+      737,  816,  816,  816,  816,  816,  816,  816,  816,  816,
+      817,  817,  817,  817,  817,  817,  817,  817,  817,  822,
+      818,  818,  818,  818,  818,  818,  900,  825,  818,  818,
+      818,  818,  818,  818,  818,  818,  818,  819,  819,  819,
+
+      819,  819,  819,  819,  819,  819,  826,  820,  820,  820,
+      820,  820,  820,  821,  821,  821,  821,  821,  821,  821,
+      821,  821,  827,  821,  821,  821,  821,  821,  821,  900,
+      828,  820,  820,  820,  820,  820,  820,  820,  820,  820,
+      823,  829,  830,  824,  831,  832,  833,  834,  835,  835,
+      835,  835,  835,  835,  835,  835,  835,  764,  835,  835,
+      835,  835,  835,  835,  836,  836,  836,  836,  836,  836,
+      836,  836,  836,  764,  836,  836,  836,  836,  836,  836,
+      837,  837,  837,  837,  837,  837,  837,  837,  837,  843,
+      837,  837,  837,  837,  837,  837,  838,  838,  838,  838,
+
+      838,  838,  838,  838,  838,  844,  839,  839,  839,  839,
+      839,  839,  900,  845,  839,  839,  839,  839,  839,  839,
+      839,  839,  839,  840,  840,  840,  840,  840,  840,  840,
+      840,  840,  846,  841,  841,  841,  841,  841,  841,  900,
+      847,  841,  841,  841,  841,  841,  841,  841,  841,  841,
+      842,  842,  842,  842,  842,  842,  842,  842,  842,  848,
+      842,  842,  842,  842,  842,  842,  849,  850,  851,  852,
+      852,  852,  852,  852,  852,  852,  852,  852,  786,  852,
+      852,  852,  852,  852,  852,  853,  853,  853,  853,  853,
+      853,  853,  853,  853,  795,  853,  853,  853,  853,  853,
+
+      853,  854,  854,  854,  854,  854,  854,  854,  854,  854,
+      855,  854,  854,  854,  854,  854,  854,  856,  856,  856,
+      856,  856,  856,  856,  856,  856,  795,  857,  857,  857,
+      857,  857,  857,  900,  859,  857,  857,  857,  857,  857,
+      857,  857,  857,  857,  858,  858,  858,  858,  858,  858,
+      858,  858,  858,  860,  858,  858,  858,  858,  858,  858,
+      861,  862,  862,  862,  862,  862,  862,  862,  862,  862,
+      814,  862,  862,  862,  862,  862,  862,  863,  863,  863,
+      863,  863,  863,  863,  863,  863,  866,  863,  863,  863,
+      863,  863,  863,  864,  864,  864,  864,  864,  864,  864,
+
+      864,  864,  867,  864,  864,  864,  864,  864,  864,  865,
+      865,  865,  865,  865,  865,  865,  865,  865,  868,  865,
+      865,  865,  865,  865,  865,  869,  870,  870,  870,  870,
+      870,  870,  870,  870,  870,  873,  870,  870,  870,  870,
+      870,  870,  871,  871,  871,  871,  871,  871,  871,  871,
+      871,  872,  871,  871,  871,  871,  871,  871,  874,  875,
+      876,  876,  876,  876,  876,  876,  876,  876,  876,  855,
+      876,  876,  876,  876,  876,  876,  877,  877,  877,  877,
+      877,  877,  877,  877,  877,  879,  877,  877,  877,  877,
+      877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+
+      878,  884,  878,  878,  878,  878,  878,  878,  880,  880,
+      880,  880,  880,  880,  880,  880,  880,  872,  880,  880,
+      880,  880,  880,  880,  881,  881,  881,  881,  881,  881,
+      881,  881,  881,  883,  881,  881,  881,  881,  881,  881,
+      882,  882,  882,  882,  882,  882,  882,  882,  882,  883,
+      882,  882,  882,  882,  882,  882,  885,  885,  885,  885,
+      885,  885,  885,  885,  885,  894,  885,  885,  885,  885,
+      885,  885,  886,  886,  886,  886,  886,  886,  886,  886,
+      886,  900,  886,  886,  886,  886,  886,  886,  887,  887,
+      887,  887,  887,  887,  887,  887,  887,  890,  887,  887,
+
+      887,  887,  887,  887,  888,  888,  888,  888,  888,  888,
+      888,  888,  888,  897,  888,  888,  888,  888,  888,  888,
+      889,  889,  889,  889,  889,  889,  889,  889,  889,  890,
+      889,  889,  889,  889,  889,  889,  891,  891,  891,  891,
+      891,  891,  891,  891,  891,  900,  891,  891,  891,  891,
+      891,  891,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  900,  892,  892,  892,  892,  892,  892,  893,  893,
+      893,  893,  893,  893,  893,  893,  893,  900,  893,  893,
+      893,  893,  893,  893,  895,  895,  895,  895,  895,  895,
+      895,  895,  895,  900,  895,  895,  895,  895,  895,  895,
+
+      896,  896,  896,  896,  896,  896,  896,  896,  896,  897,
+      896,  896,  896,  896,  896,  896,  898,  898,  898,  898,
+      898,  898,  898,  898,  898,  900,  898,  898,  898,  898,
+      898,  898,  791,  791,  791,  791,  791,  791,  791,  791,
+      791,  899,  899,  899,  899,  899,  899,  899,  899,  899,
+      900,  899,  899,  899,  899,  899,  899,    7,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+
+      900,  900,  900,  900,  900,  900
     } ;
 
-static yyconst flex_int16_t yy_chk[4107] =
+static yyconst flex_int16_t yy_chk[3807] =
     {   0,
+        0,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,   10,   10,   11,   11,   15,   17,
-       26,  950,   15,   16,   16,   16,   16,   16,   16,   16,
-       16,   16,   16,   16,   16,   16,   16,   16,   16,   27,
-
-       16,   28,   35,   37,   27,   17,   26,   28,   59,   36,
-       41,   41,   27,   36,   42,   42,   16,   43,   43,   16,
-       16,   16,   16,   16,   16,   27,   16,   28,   35,   37,
-       27,  133,  133,   28,   59,   36,  946,  765,   27,   36,
-      765,  944,   16,   19,   19,  940,   19,   19,   19,   19,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,   10,   10,   11,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   13,   13,   17,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   15,   18,   21,   23,   15,   16,   16,   16,
+
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   24,   16,   26,   35,   37,   19,   19,
+       40,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       16,   19,   19,   19,   19,   19,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-
-       19,   19,   19,   19,   19,   19,   19,   19,   20,   21,
-       20,   21,   60,   20,  934,   62,  928,   63,   20,   21,
-       64,  927,  924,   65,  920,   20,   21,  919,   66,  915,
-       67,  911,  874,   30,   20,   21,   20,   21,   60,   20,
-       23,   62,   23,   63,   20,   21,   64,   30,   31,   65,
-       23,   20,   21,   22,   66,   22,   67,   23,   22,   30,
-       23,   68,   31,   22,   22,   24,   23,   24,   23,   69,
-       22,   68,   70,   30,   31,   24,   23,   71,   24,   22,
-       72,   22,   24,   23,   22,  865,   23,   68,   31,   22,
-       22,   24,  864,   24,  862,   69,   22,   68,   70,   73,
-
-      861,   24,   74,   71,   24,   76,   72,   77,   24,   25,
+       19,   19,   19,   19,   19,   19,   19,   20,   22,   20,
+       27,   49,   20,   22,   28,   27,   60,   20,   22,   22,
+       28,   61,   63,   27,   20,   22,   25,   25,   25,   25,
        25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
-       25,   25,   25,   25,   25,   73,   25,  860,   74,  859,
-       32,   76,   25,   77,   32,  858,  857,  855,   78,   25,
-       79,  854,  852,   29,   32,   25,   25,   25,   25,   25,
-       25,   29,   25,   75,   81,   33,   32,   29,   25,   82,
-       32,   33,   29,   33,   78,   25,   79,   34,   34,   29,
-       32,   75,   33,   83,   85,   86,   34,   29,   88,   75,
-       81,   33,   89,   29,   34,   82,  851,   33,   29,   33,
-      739,  739,  739,  850,  739,  848,  847,   75,   33,   83,
-
-       85,   86,   34,  846,   88,  844,  843,  842,   89,  837,
-       34,   51,   51,   51,   51,   51,   51,   51,   51,   51,
-       51,   51,   51,   51,   51,   51,   51,   90,   51,   53,
-       53,   53,   53,   53,   53,   53,   53,   53,   91,  836,
-      835,  830,  829,  828,  820,   96,   97,   51,   51,   51,
-       51,   51,   51,   90,   51,   56,   56,   56,   56,   56,
-       56,   56,   56,   56,   91,   56,   56,   56,   56,   56,
-       56,   96,   97,  105,  105,  105,  105,  105,  105,  105,
-      105,  105,  819,  818,  807,  803,  802,  801,  800,  792,
-       98,   56,   56,   56,   56,   56,   56,   58,   58,   58,
-
+       25,   25,   29,   25,   30,   31,   64,   33,   32,   65,
+
+       29,   66,   32,   33,   67,   33,   29,   68,   30,   31,
+       69,   29,   32,   36,   33,   34,   34,   36,   70,   71,
+       69,   72,   73,   74,   34,   75,   77,   78,   79,   80,
+       51,   51,   34,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   53,   53,   53,   53,   53,   53,
+
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   81,   56,
+       56,   56,   56,   56,   56,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   82,   57,   57,   57,   57,   57,
+       57,   58,   58,   83,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   84,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
        58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
-       58,   58,   58,   87,   58,   92,   98,   99,  100,  112,
-       87,  113,  114,   87,  115,  116,  117,  118,  120,  121,
-      122,  123,   92,   58,   58,   58,   58,   58,   58,   87,
-       58,   92,  791,   99,  100,  112,   87,  113,  114,   87,
-      115,  116,  117,  118,  120,  121,  122,  123,   92,  103,
-      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
-      103,  103,  103,  103,  103,  110,  103,  110,  110,  110,
-      110,  110,  110,  110,  110,  110,  124,  790,  789,  782,
-      779,  777,  776,  126,  127,  103,  103,  103,  103,  103,
-
-      103,  128,  103,  107,  107,  107,  107,  107,  107,  107,
-      107,  107,  124,  107,  107,  107,  107,  107,  107,  126,
-      127,  767,  766,  759,  753,  752,  751,  128,  155,  155,
-      155,  155,  155,  155,  155,  155,  155,  129,  130,  107,
-      107,  107,  107,  107,  107,  109,  132,  109,  109,  109,
-      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
-      109,  109,  109,  129,  130,  750,  749,  740,  728,  725,
-      724,  723,  132,  710,  703,  697,  696,  695,  694,  134,
-      136,  137,  138,  109,  109,  109,  109,  109,  109,  111,
+       59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+
+       59,   59,   59,   59,   59,   59,   76,   59,   86,   87,
+       88,   89,   90,   91,   92,   93,   97,   88,   98,   99,
+       88,   88,  100,  101,   76,  116,  117,  118,  119,  120,
+      121,  122,   93,  105,  105,  105,  105,  105,  105,  105,
+      105,  105,  123,  105,  105,  105,  105,  105,  105,  106,
+      106,  106,  106,  106,  106,  106,  106,  106,  124,  106,
+      106,  106,  106,  106,  106,  107,  107,  107,  107,  107,
+      107,  107,  107,  107,  108,  108,  108,  108,  108,  108,
+      108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  125,
+
+      109,  109,  109,  109,  109,  109,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  126,  110,  110,  110,  110,
+      110,  110,  111,  127,  111,  111,  111,  111,  111,  111,
       111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
-
-      111,  111,  111,  111,  111,  134,  136,  137,  138,  139,
-      140,  141,  142,  143,  144,  146,  147,  148,  149,  150,
-      151,  152,  153,  692,  675,  111,  111,  111,  111,  111,
-      111,  667,  665,  664,  663,  139,  140,  141,  142,  143,
-      144,  146,  147,  148,  149,  150,  151,  152,  153,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  160,  154,  160,  160,  160,
-      160,  160,  160,  160,  160,  160,  161,  161,  161,  161,
-      161,  161,  161,  161,  161,  154,  154,  154,  154,  154,
-      154,  633,  154,  159,  627,  159,  159,  159,  159,  159,
-
-      159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
-      159,  164,  166,  164,  164,  164,  164,  164,  164,  164,
-      164,  164,  626,  625,  624,  617,  601,  583,  581,  166,
-      168,  159,  159,  159,  159,  159,  159,  162,  172,  162,
-      162,  162,  162,  162,  162,  162,  162,  162,  162,  162,
-      162,  162,  162,  162,  162,  166,  168,  580,  579,  576,
-      535,  528,  527,  526,  172,  525,  511,  483,  472,  469,
-      468,  173,  174,  175,  177,  162,  162,  162,  162,  162,
-      162,  163,  163,  163,  163,  163,  163,  163,  163,  163,
-      180,  163,  163,  163,  163,  163,  163,  173,  174,  175,
-
-      177,  467,  451,  437,  433,  414,  181,  405,  404,  403,
-      402,  383,  360,  182,  183,  354,  180,  163,  163,  163,
-      163,  163,  163,  165,  165,  165,  165,  165,  165,  165,
-      165,  165,  181,  165,  165,  165,  165,  165,  165,  182,
-      183,  184,  187,  188,  189,  191,  193,  194,  195,  192,
-      184,  184,  184,  192,  196,  197,  198,  187,  343,  165,
-      165,  165,  165,  165,  165,  201,  204,  184,  187,  188,
-      189,  191,  193,  194,  195,  192,  184,  184,  184,  192,
-      196,  197,  198,  187,  199,  202,  205,  206,  223,  224,
-      225,  201,  204,  227,  228,  229,  202,  230,  228,  199,
-
-      208,  208,  208,  208,  208,  208,  208,  208,  208,  208,
-      199,  202,  205,  206,  223,  224,  225,  340,  339,  227,
-      228,  229,  202,  230,  228,  199,  213,  213,  213,  213,
-      213,  213,  213,  213,  213,  214,  338,  214,  214,  214,
-      214,  214,  214,  214,  214,  214,  214,  214,  214,  214,
-      214,  214,  214,  216,  336,  216,  216,  216,  216,  216,
-      216,  216,  216,  216,  331,  324,  323,  320,  305,  295,
-      231,  281,  273,  214,  214,  214,  214,  214,  214,  215,
-      215,  215,  215,  215,  215,  215,  215,  215,  232,  215,
-      215,  215,  215,  215,  215,  217,  231,  217,  217,  217,
-
-      217,  217,  217,  217,  217,  217,  272,  271,  270,  267,
-      253,  222,  212,  211,  232,  215,  215,  215,  215,  215,
-      215,  218,  210,  218,  218,  218,  218,  218,  218,  218,
-      218,  218,  218,  218,  218,  218,  218,  218,  218,  219,
-      234,  219,  219,  219,  219,  219,  219,  219,  219,  219,
-      279,  279,  279,  279,  279,  279,  279,  279,  279,  218,
-      218,  218,  218,  218,  218,  220,  234,  220,  220,  220,
+      112,  128,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  130,  131,  132,
+      133,  134,  135,  136,  137,  137,  138,  139,  140,  141,
+      142,  143,  144,  145,  146,  147,  148,  149,  150,  151,
+      152,  153,  152,  154,  155,  156,  157,  158,  159,  159,
+
+      159,  159,  159,  159,  159,  159,  159,  174,  159,  159,
+      159,  159,  159,  159,  160,  160,  160,  160,  160,  160,
+      160,  160,  160,  161,  161,  161,  161,  161,  161,  161,
+      161,  161,  175,  161,  161,  161,  161,  161,  161,  162,
+      162,  162,  162,  162,  162,  162,  162,  162,  176,  162,
+      162,  162,  162,  162,  162,  163,  163,  163,  163,  163,
+      163,  163,  163,  163,  177,  163,  163,  163,  163,  163,
+      163,  164,  178,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  165,
+      179,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+
+      167,  167,  167,  167,  167,  167,  167,  167,  167,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  180,  168,
+      168,  168,  168,  168,  168,  169,  169,  169,  169,  169,
+      169,  169,  169,  169,  181,  169,  169,  169,  169,  169,
+      169,  170,  182,  170,  170,  170,  170,  170,  170,  170,
+      170,  170,  171,  171,  171,  171,  171,  171,  171,  171,
+      171,  172,  171,  171,  171,  171,  171,  171,  183,  184,
+      186,  187,  188,  189,  190,  192,  193,  194,  172,  195,
+      196,  197,  198,  190,  190,  190,  198,  199,  200,  201,
+      202,  193,  203,  204,  205,  206,  207,  208,  209,  211,
+
+      210,  212,  213,  214,  215,  216,  217,  218,  230,  231,
+      206,  210,  219,  219,  219,  219,  219,  219,  219,  219,
+      219,  232,  219,  219,  219,  219,  219,  219,  220,  220,
       220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
-      220,  220,  220,  221,  226,  221,  221,  221,  221,  221,
-      221,  221,  221,  221,  235,  237,  226,  238,  239,  226,
-
-      240,  226,  233,  220,  220,  220,  220,  220,  220,  233,
-      226,  241,  242,  243,  244,  245,  246,  233,  247,  248,
-      235,  237,  226,  238,  239,  226,  240,  226,  233,  244,
-      249,  250,  251,  252,  254,  233,  255,  241,  242,  243,
-      244,  245,  246,  233,  247,  248,  256,  257,  258,  259,
-      260,  261,  262,  263,  264,  244,  249,  250,  251,  252,
-      254,  265,  255,  266,  268,  269,  209,  285,  207,  203,
-      200,  190,  256,  257,  258,  259,  260,  261,  262,  263,
-      264,  186,  178,  176,  171,  170,  169,  265,  158,  266,
-      268,  269,  274,  285,  274,  274,  274,  274,  274,  274,
-
-      274,  274,  274,  275,  157,  275,  275,  275,  275,  275,
-      275,  275,  275,  275,  275,  275,  275,  275,  275,  275,
-      275,  276,  286,  276,  276,  276,  276,  276,  276,  276,
-      276,  276,  156,  145,  135,  131,  119,  106,  104,   80,
-      287,  275,  275,  275,  275,  275,  275,  277,  286,  277,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  277,  277,  278,  287,  278,  278,  278,
-      278,  278,  278,  278,  278,  278,   52,   48,  288,   47,
-       44,   39,   18,   14,   12,  277,  277,  277,  277,  277,
-      277,  280,    7,  280,  280,  280,  280,  280,  280,  280,
-
-      280,  280,  280,  282,  288,  282,  282,  282,  282,  282,
-      282,  282,  282,  282,  282,  282,  282,  282,  282,  282,
-      282,  284,    4,  284,  284,  284,  284,  284,  284,  284,
-      284,  284,    3,    0,    0,    0,    0,  289,  290,  291,
-      292,  282,  282,  282,  282,  282,  282,  283,  283,  283,
-      283,  283,  283,  283,  283,  283,  293,  283,  283,  283,
-      283,  283,  283,  289,  290,  291,  292,  294,  296,  298,
-      299,  300,  301,  302,  304,  306,  307,  308,  309,  310,
-      311,  312,  293,  283,  283,  283,  283,  283,  283,  313,
-      314,  315,  316,  294,  296,  298,  299,  300,  301,  302,
-
-      304,  306,  307,  308,  309,  310,  311,  312,  317,  319,
-      321,  322,  325,  327,  328,  313,  314,  315,  316,  329,
-      330,  333,  319,  334,  335,  337,    0,    0,    0,    0,
-        0,    0,    0,    0,  317,  319,  321,  322,  325,  327,
-      328,    0,    0,    0,    0,  329,  330,  333,  319,  334,
-      335,  337,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  342,    0,  342,  342,  342,  342,  342,  342,  342,
-      342,  342,  342,  344,    0,  344,  344,  344,  344,  344,
-      344,  344,  344,  344,  344,  344,  344,  344,  344,  344,
-      344,  346,    0,  346,  346,  346,  346,  346,  346,  346,
-
-      346,  346,    0,    0,    0,    0,    0,    0,  353,    0,
-        0,  344,  344,  344,  344,  344,  344,  345,  345,  345,
-      345,  345,  345,  345,  345,  345,  355,  345,  345,  345,
-      345,  345,  345,  347,  353,  347,  347,  347,  347,  347,
-      347,  347,  347,  347,    0,  356,    0,    0,    0,    0,
-        0,    0,  355,  345,  345,  345,  345,  345,  345,  348,
-        0,  348,  348,  348,  348,  348,  348,  348,  348,  348,
-      349,  356,  349,  349,  349,  349,  349,  349,  349,  349,
-      349,  349,  349,  349,  349,  349,  349,  349,  350,  357,
-      350,  350,  350,  350,  350,  350,  350,  350,  350,    0,
-
-        0,    0,    0,    0,    0,    0,    0,  358,  349,  349,
-      349,  349,  349,  349,  351,  357,  351,  351,  351,  351,
-      351,  351,  351,  351,  351,  351,  351,  351,  351,  351,
-      351,  351,  352,  358,  352,  352,  352,  352,  352,  352,
-      352,  352,  352,  359,  361,  362,  364,  365,  367,  368,
-      369,  370,  351,  351,  351,  351,  351,  351,  359,  363,
-      371,  372,  373,  374,  375,  363,  376,  363,  377,  359,
-      361,  362,  364,  365,  367,  368,  369,  370,  378,  379,
-      380,  381,  382,  384,  359,  363,  371,  372,  373,  374,
-      375,  363,  376,  363,  377,  385,  386,  387,  388,  389,
-
-      390,  392,  393,  394,  378,  379,  380,  381,  382,  384,
-      395,  396,  397,  399,  400,  401,    0,  418,    0,    0,
-        0,  385,  386,  387,  388,  389,  390,  392,  393,  394,
-        0,    0,    0,    0,    0,    0,  395,  396,  397,  399,
-      400,  401,  406,  418,  406,  406,  406,  406,  406,  406,
-      406,  406,  406,  407,    0,  407,  407,  407,  407,  407,
-      407,  407,  407,  407,  408,    0,  408,  408,  408,  408,
-      408,  408,  408,  408,  408,  408,  408,  408,  408,  408,
-      408,  408,  409,  419,  409,  409,  409,  409,  409,  409,
-      409,  409,  409,  412,  412,  412,  412,  412,  412,  412,
-
-      412,  412,  408,  408,  408,  408,  408,  408,  410,  419,
-      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
-      410,  410,  410,  410,  410,  410,  411,  420,  411,  411,
-      411,  411,  411,  411,  411,  411,  411,    0,    0,  421,
-        0,    0,    0,    0,    0,    0,  410,  410,  410,  410,
-      410,  410,  413,  420,  413,  413,  413,  413,  413,  413,
-      413,  413,  413,  413,  415,  421,  415,  415,  415,  415,
-      415,  415,  415,  415,  415,  415,  415,  415,  415,  415,
-      415,  415,  417,    0,  417,  417,  417,  417,  417,  417,
-      417,  417,  417,    0,    0,    0,    0,    0,  422,  423,
-
-      424,  425,  415,  415,  415,  415,  415,  415,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  426,  416,  416,
-      416,  416,  416,  416,  422,  423,  424,  425,  427,  428,
-      429,  430,  431,  432,  435,  436,  438,  440,  441,  444,
-      445,  446,  447,  426,  416,  416,  416,  416,  416,  416,
-      448,  449,  450,  452,  427,  428,  429,  430,  431,  432,
-      435,  436,  438,  440,  441,  444,  445,  446,  447,  453,
-      454,  455,  456,  457,  458,  459,  448,  449,  450,  452,
-      460,  461,  462,  463,  464,  465,  470,  470,  470,  470,
-      470,  470,  470,  470,  470,  453,  454,  455,  456,  457,
-
-      458,  459,    0,    0,    0,    0,  460,  461,  462,  463,
-      464,  465,  471,    0,  471,  471,  471,  471,  471,  471,
-      471,  471,  471,  471,  473,    0,  473,  473,  473,  473,
-      473,  473,  473,  473,  473,  473,  473,  473,  473,  473,
-      473,  473,  475,    0,  475,  475,  475,  475,  475,  475,
-      475,  475,  475,  476,  476,  476,  476,  476,  476,  476,
-      476,  476,  473,  473,  473,  473,  473,  473,  474,  474,
-      474,  474,  474,  474,  474,  474,  474,  481,  474,  474,
-      474,  474,  474,  474,  478,  482,  478,  478,  478,  478,
-      478,  478,  478,  478,  478,    0,    0,    0,    0,    0,
-
-        0,    0,    0,  481,  474,  474,  474,  474,  474,  474,
-      477,  482,  477,  477,  477,  477,  477,  477,  477,  477,
-      477,  477,  477,  477,  477,  477,  477,  477,  480,  484,
-      480,  480,  480,  480,  480,  480,  480,  480,  480,    0,
-        0,    0,    0,    0,    0,    0,  485,  486,  477,  477,
-      477,  477,  477,  477,  479,  484,  479,  479,  479,  479,
-      479,  479,  479,  479,  479,  479,  479,  479,  479,  479,
-      479,  479,  485,  486,  487,  488,  489,  490,  491,  492,
-      493,  494,  495,  496,  498,  499,  500,  501,  503,  504,
-      505,  506,  479,  479,  479,  479,  479,  479,  508,  509,
-
-      487,  488,  489,  490,  491,  492,  493,  494,  495,  496,
-      498,  499,  500,  501,  503,  504,  505,  506,  512,  510,
-      513,  514,  515,  516,  508,  509,  510,  517,  518,  519,
-      521,  523,  524,  529,  529,  529,  529,  529,  529,  529,
-      529,  529,    0,    0,  512,  510,  513,  514,  515,  516,
-        0,    0,  510,  517,  518,  519,  521,  523,  524,  530,
-        0,  530,  530,  530,  530,  530,  530,  530,  530,  530,
-      530,  530,  530,  530,  530,  530,  530,  531,  539,  531,
-      531,  531,  531,  531,  531,  531,  531,  531,    0,    0,
-        0,    0,    0,    0,    0,    0,  540,  530,  530,  530,
-
-      530,  530,  530,  532,  539,  532,  532,  532,  532,  532,
-      532,  532,  532,  532,  532,  532,  532,  532,  532,  532,
-      532,  533,  540,  533,  533,  533,  533,  533,  533,  533,
-      533,  533,    0,    0,  541,    0,    0,    0,    0,    0,
-        0,  532,  532,  532,  532,  532,  532,  534,    0,  534,
-      534,  534,  534,  534,  534,  534,  534,  534,  534,  536,
-      541,  536,  536,  536,  536,  536,  536,  536,  536,  536,
-      536,  536,  536,  536,  536,  536,  536,  538,    0,  538,
-      538,  538,  538,  538,  538,  538,  538,  538,    0,    0,
-        0,    0,    0,  542,  543,  544,  546,  536,  536,  536,
-
-      536,  536,  536,  537,  537,  537,  537,  537,  537,  537,
-      537,  537,  547,  537,  537,  537,  537,  537,  537,  542,
-      543,  544,  546,  548,  549,  550,  551,  552,  554,  555,
-      556,  557,  559,  560,  564,  565,  566,    0,  547,  537,
-      537,  537,  537,  537,  537,  568,  569,  570,  571,  548,
-      549,  550,  551,  552,  554,  555,  556,  557,  559,  560,
-      564,  565,  566,  567,  572,  575,  577,  578,  592,  593,
-      567,  568,  569,  570,  571,  582,    0,  582,  582,  582,
-      582,  582,  582,  582,  582,  582,  582,    0,    0,  567,
-      572,  575,  577,  578,  592,  593,  567,  584,    0,  584,
-
-      584,  584,  584,  584,  584,  584,  584,  584,  584,  584,
-      584,  584,  584,  584,  584,  586,    0,  586,  586,  586,
-      586,  586,  586,  586,  586,  586,    0,    0,    0,    0,
-        0,    0,  594,    0,    0,  584,  584,  584,  584,  584,
-      584,  585,  585,  585,  585,  585,  585,  585,  585,  585,
-      595,  585,  585,  585,  585,  585,  585,  588,  594,  588,
-      588,  588,  588,  588,  588,  588,  588,  588,    0,    0,
-        0,    0,    0,    0,    0,    0,  595,  585,  585,  585,
-      585,  585,  585,  587,    0,  587,  587,  587,  587,  587,
-      587,  587,  587,  587,  587,  587,  587,  587,  587,  587,
-
-      587,  590,  596,  590,  590,  590,  590,  590,  590,  590,
-      590,  590,    0,    0,    0,    0,    0,    0,    0,  598,
-      599,  587,  587,  587,  587,  587,  587,  589,  596,  589,
-      589,  589,  589,  589,  589,  589,  589,  589,  589,  589,
-      589,  589,  589,  589,  589,  598,  599,  600,  603,  604,
-      605,  606,  610,  611,  612,  613,  614,  615,  616,  618,
-      619,  620,  621,  622,    0,  589,  589,  589,  589,  589,
-      589,    0,    0,  600,  603,  604,  605,  606,  610,  611,
-      612,  613,  614,  615,  616,  618,  619,  620,  621,  622,
-      628,    0,  628,  628,  628,  628,  628,  628,  628,  628,
-
-      628,  628,  628,  628,  628,  628,  628,  628,  629,  638,
-      629,  629,  629,  629,  629,  629,  629,  629,  629,    0,
-        0,    0,    0,    0,    0,    0,    0,  639,  628,  628,
-      628,  628,  628,  628,  630,  638,  630,  630,  630,  630,
-      630,  630,  630,  630,  630,  630,  630,  630,  630,  630,
-      630,  630,  631,  639,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,    0,    0,  641,    0,    0,    0,    0,
-        0,    0,  630,  630,  630,  630,  630,  630,  632,    0,
-      632,  632,  632,  632,  632,  632,  632,  632,  632,  632,
-      634,  641,  634,  634,  634,  634,  634,  634,  634,  634,
-
-      634,  634,  634,  634,  634,  634,  634,  634,  636,    0,
-      636,  636,  636,  636,  636,  636,  636,  636,  636,    0,
-        0,    0,    0,    0,  642,  643,    0,  647,  634,  634,
-      634,  634,  634,  634,  635,  635,  635,  635,  635,  635,
-      635,  635,  635,  649,  635,  635,  635,  635,  635,  635,
-      642,  643,  645,  647,  651,  652,  653,  654,  645,  655,
-      657,  658,  659,  661,  662,    0,  676,    0,    0,  649,
-      635,  635,  635,  635,  635,  635,    0,    0,  645,    0,
-      651,  652,  653,  654,  645,  655,  657,  658,  659,  661,
-      662,  666,  676,  666,  666,  666,  666,  666,  666,  666,
-
-      666,  666,  666,  668,    0,  668,  668,  668,  668,  668,
-      668,  668,  668,  668,  668,  668,  668,  668,  668,  668,
-      668,  670,    0,  670,  670,  670,  670,  670,  670,  670,
-      670,  670,    0,    0,    0,    0,    0,    0,  678,    0,
-        0,  668,  668,  668,  668,  668,  668,  669,  669,  669,
-      669,  669,  669,  669,  669,  669,  680,  669,  669,  669,
-      669,  669,  669,  672,  678,  672,  672,  672,  672,  672,
-      672,  672,  672,  672,    0,    0,    0,    0,    0,    0,
-        0,    0,  680,  669,  669,  669,  669,  669,  669,  671,
-        0,  671,  671,  671,  671,  671,  671,  671,  671,  671,
-
-      671,  671,  671,  671,  671,  671,  671,  674,  681,  674,
-      674,  674,  674,  674,  674,  674,  674,  674,    0,    0,
-        0,    0,    0,    0,    0,  682,  684,  671,  671,  671,
-      671,  671,  671,  673,  681,  673,  673,  673,  673,  673,
-      673,  673,  673,  673,  673,  673,  673,  673,  673,  673,
-      673,  682,  684,  685,  686,  687,  688,  689,  690,  691,
-      693,    0,  707,    0,    0,    0,    0,    0,    0,    0,
-        0,  673,  673,  673,  673,  673,  673,    0,    0,  685,
-      686,  687,  688,  689,  690,  691,  693,  698,  707,  698,
-      698,  698,  698,  698,  698,  698,  698,  698,  698,  698,
-
-      698,  698,  698,  698,  698,  699,  709,  699,  699,  699,
-      699,  699,  699,  699,  699,  699,    0,    0,    0,    0,
-        0,    0,    0,    0,  711,  698,  698,  698,  698,  698,
-      698,  700,  709,  700,  700,  700,  700,  700,  700,  700,
-      700,  700,  700,  700,  700,  700,  700,  700,  700,  701,
-      711,  701,  701,  701,  701,  701,  701,  701,  701,  701,
-        0,    0,  712,    0,    0,    0,    0,    0,    0,  700,
-      700,  700,  700,  700,  700,  702,    0,  702,  702,  702,
-      702,  702,  702,  702,  702,  702,  702,  704,  712,  704,
-      704,  704,  704,  704,  704,  704,  704,  704,  704,  704,
-
-      704,  704,  704,  704,  704,  706,    0,  706,  706,  706,
-      706,  706,  706,  706,  706,  706,    0,    0,    0,    0,
-        0,  713,  714,  715,  716,  704,  704,  704,  704,  704,
-      704,  705,  705,  705,  705,  705,  705,  705,  705,  705,
-      717,  705,  705,  705,  705,  705,  705,  713,  714,  715,
-      716,  718,  720,  721,  727,  736,  727,  727,  727,  727,
-      727,  727,  727,  727,  727,  727,  717,  705,  705,  705,
-      705,  705,  705,  741,    0,    0,    0,  718,  720,  721,
-      729,  736,  729,  729,  729,  729,  729,  729,  729,  729,
-      729,  729,  729,  729,  729,  729,  729,  729,  731,  741,
-
-      731,  731,  731,  731,  731,  731,  731,  731,  731,    0,
-        0,    0,    0,    0,    0,  742,    0,    0,  729,  729,
-      729,  729,  729,  729,  730,  730,  730,  730,  730,  730,
-      730,  730,  730,  743,  730,  730,  730,  730,  730,  730,
-      733,  742,  733,  733,  733,  733,  733,  733,  733,  733,
-      733,    0,    0,    0,    0,    0,    0,    0,    0,  743,
-      730,  730,  730,  730,  730,  730,  732,    0,  732,  732,
+      220,  220,  220,  220,  221,  221,  221,  221,  221,  221,
+      221,  221,  221,  222,  222,  222,  222,  222,  222,  222,
+      222,  222,  233,  222,  222,  222,  222,  222,  222,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  235,  223,
+      223,  223,  223,  223,  223,  224,  237,  224,  224,  224,
+      224,  224,  224,  224,  224,  224,  225,  238,  225,  225,
+
+      225,  225,  225,  225,  225,  225,  225,  226,  226,  226,
+      226,  226,  226,  226,  226,  226,  239,  226,  226,  226,
+      226,  226,  226,  227,  240,  227,  227,  227,  227,  227,
+      227,  227,  227,  227,  228,  228,  228,  228,  228,  228,
+      228,  228,  228,  228,  228,  228,  228,  228,  228,  228,
+      229,  234,  229,  229,  229,  229,  229,  229,  229,  229,
+      229,  236,  241,  234,  242,  236,  234,  243,  234,  241,
+      245,  246,  247,  248,  249,  250,  251,  241,  252,  253,
+      254,  255,  256,  257,  258,  259,  260,  261,  262,  263,
+      264,  265,  266,  252,  267,  268,  269,  270,  271,  272,
+
+      273,  274,  275,  276,  277,  278,  279,  280,  280,  280,
+      280,  280,  280,  280,  280,  280,  281,  280,  280,  280,
+      280,  280,  280,  282,  282,  282,  282,  282,  282,  282,
+      282,  282,  292,  282,  282,  282,  282,  282,  282,  283,
+      283,  283,  283,  283,  283,  283,  283,  283,  296,  283,
+      283,  283,  283,  283,  283,  284,  297,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  285,  285,  285,  285,
+      285,  285,  285,  285,  285,  298,  285,  285,  285,  285,
+      285,  285,  286,  299,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  287,  287,  287,  287,  287,  287,  287,
+
+      287,  287,  287,  287,  287,  287,  287,  287,  287,  288,
+      300,  288,  288,  288,  288,  288,  288,  288,  288,  288,
+      289,  289,  289,  289,  289,  289,  289,  289,  289,  291,
+      301,  291,  291,  291,  291,  291,  291,  291,  291,  291,
+      291,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      302,  293,  293,  293,  293,  293,  293,  294,  294,  294,
+      294,  294,  294,  294,  294,  294,  303,  294,  294,  294,
+      294,  294,  294,  295,  304,  295,  295,  295,  295,  295,
+      295,  295,  295,  295,  305,  306,  307,  309,  310,  311,
+      312,  313,  315,  316,  317,  318,  319,  320,  321,  322,
+
+      323,  324,  325,  326,  327,  328,  330,  331,  332,  333,
+      334,  335,  336,  337,  339,  340,  341,  342,  343,  330,
+      344,  346,  347,  348,  349,  350,  351,  351,  351,  351,
+      351,  351,  351,  351,  351,  357,  351,  351,  351,  351,
+      351,  351,  352,  352,  352,  352,  352,  352,  352,  352,
+      352,  362,  352,  352,  352,  352,  352,  352,  353,  353,
+      353,  353,  353,  353,  353,  353,  353,  353,  353,  353,
+      353,  353,  353,  353,  354,  354,  354,  354,  354,  354,
+      354,  354,  354,  356,  367,  356,  356,  356,  356,  356,
+      356,  356,  356,  356,  356,  358,  358,  358,  358,  358,
+
+      358,  358,  358,  358,  368,  358,  358,  358,  358,  358,
+      358,  359,  359,  359,  359,  359,  359,  359,  359,  359,
+      369,  359,  359,  359,  359,  359,  359,  360,  370,  360,
+      360,  360,  360,  360,  360,  360,  360,  360,  361,  371,
+      361,  361,  361,  361,  361,  361,  361,  361,  361,  363,
+      363,  363,  363,  363,  363,  363,  363,  363,  372,  363,
+      363,  363,  363,  363,  363,  364,  374,  364,  364,  364,
+      364,  364,  364,  364,  364,  364,  365,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  365,  365,  365,  365,
+      365,  365,  366,  373,  366,  366,  366,  366,  366,  366,
+
+      366,  366,  366,  375,  376,  377,  378,  379,  373,  381,
+      382,  377,  383,  377,  384,  385,  386,  387,  388,  389,
+      390,  391,  392,  393,  394,  395,  396,  397,  398,  399,
+      400,  401,  402,  403,  404,  405,  407,  408,  409,  410,
+      411,  412,  413,  415,  416,  417,  418,  419,  420,  420,
+      420,  420,  420,  420,  420,  420,  420,  423,  420,  420,
+      420,  420,  420,  420,  421,  421,  421,  421,  421,  421,
+      421,  421,  421,  430,  421,  421,  421,  421,  421,  421,
+      422,  431,  422,  422,  422,  422,  422,  422,  422,  422,
+      422,  424,  424,  424,  424,  424,  424,  424,  424,  424,
+
+      435,  424,  424,  424,  424,  424,  424,  425,  436,  425,
+      425,  425,  425,  425,  425,  425,  425,  425,  426,  426,
+      426,  426,  426,  426,  426,  426,  426,  426,  426,  426,
+      426,  426,  426,  426,  427,  437,  427,  427,  427,  427,
+      427,  427,  427,  427,  427,  428,  428,  428,  428,  428,
+      428,  428,  428,  428,  432,  432,  432,  432,  432,  432,
+      432,  432,  432,  438,  432,  432,  432,  432,  432,  432,
+      433,  433,  433,  433,  433,  433,  433,  433,  433,  439,
+      433,  433,  433,  433,  433,  433,  434,  440,  434,  434,
+      434,  434,  434,  434,  434,  434,  434,  441,  442,  443,
+
+      444,  445,  446,  447,  448,  449,  450,  452,  453,  454,
+      455,  457,  458,  461,  462,  463,  464,  465,  466,  467,
+      468,  469,  470,  471,  472,  473,  474,  475,  476,  477,
+      478,  479,  480,  481,  482,  483,  484,  486,  486,  486,
+      486,  486,  486,  486,  486,  486,  491,  486,  486,  486,
+      486,  486,  486,  487,  487,  487,  487,  487,  487,  487,
+      487,  487,  492,  487,  487,  487,  487,  487,  487,  488,
+      488,  488,  488,  488,  488,  488,  488,  488,  488,  488,
+      488,  488,  488,  488,  488,  489,  489,  489,  489,  489,
+      489,  489,  489,  489,  493,  493,  493,  493,  493,  493,
+
+      493,  493,  493,  501,  493,  493,  493,  493,  493,  493,
+      494,  494,  494,  494,  494,  494,  494,  494,  494,  502,
+      494,  494,  494,  494,  494,  494,  495,  503,  495,  495,
+      495,  495,  495,  495,  495,  495,  495,  496,  496,  496,
+      496,  496,  496,  496,  496,  496,  497,  497,  497,  497,
+      497,  497,  497,  497,  497,  504,  497,  497,  497,  497,
+      497,  497,  498,  505,  498,  498,  498,  498,  498,  498,
+      498,  498,  498,  499,  499,  499,  499,  499,  499,  499,
+      499,  499,  499,  499,  499,  499,  499,  499,  499,  500,
+      506,  500,  500,  500,  500,  500,  500,  500,  500,  500,
+
+      507,  508,  509,  510,  511,  512,  513,  514,  515,  516,
+      518,  519,  520,  521,  523,  524,  525,  526,  528,  529,
+      530,  531,  532,  533,  534,  535,  536,  530,  537,  538,
+      539,  540,  541,  543,  545,  546,  547,  547,  547,  547,
+      547,  547,  547,  547,  547,  548,  547,  547,  547,  547,
+      547,  547,  549,  549,  549,  549,  549,  549,  549,  549,
+      549,  557,  549,  549,  549,  549,  549,  549,  550,  550,
+      550,  550,  550,  550,  550,  550,  550,  558,  550,  550,
+      550,  550,  550,  550,  551,  551,  551,  551,  551,  551,
+      551,  551,  551,  552,  552,  552,  552,  552,  552,  552,
+
+      552,  552,  562,  552,  552,  552,  552,  552,  552,  553,
+      563,  553,  553,  553,  553,  553,  553,  553,  553,  553,
+      554,  554,  554,  554,  554,  554,  554,  554,  554,  554,
+      554,  554,  554,  554,  554,  554,  555,  564,  555,  555,
+      555,  555,  555,  555,  555,  555,  555,  559,  559,  559,
+      559,  559,  559,  559,  559,  559,  565,  559,  559,  559,
+      559,  559,  559,  560,  560,  560,  560,  560,  560,  560,
+      560,  560,  566,  560,  560,  560,  560,  560,  560,  561,
+      567,  561,  561,  561,  561,  561,  561,  561,  561,  561,
+      569,  570,  571,  572,  573,  574,  575,  577,  578,  579,
+
+      580,  582,  583,  587,  588,  589,  590,  591,  592,  593,
+      594,  595,  596,  590,  599,  600,  601,  602,  603,  604,
+      605,  605,  605,  605,  605,  605,  605,  605,  605,  608,
+      605,  605,  605,  605,  605,  605,  606,  606,  606,  606,
+      606,  606,  606,  606,  606,  606,  606,  606,  606,  606,
+      606,  606,  609,  610,  610,  610,  610,  610,  610,  610,
+      610,  610,  618,  610,  610,  610,  610,  610,  610,  611,
+      611,  611,  611,  611,  611,  611,  611,  611,  619,  611,
+      611,  611,  611,  611,  611,  612,  620,  612,  612,  612,
+      612,  612,  612,  612,  612,  612,  613,  613,  613,  613,
+
+      613,  613,  613,  613,  613,  621,  613,  613,  613,  613,
+      613,  613,  614,  622,  614,  614,  614,  614,  614,  614,
+      614,  614,  614,  615,  615,  615,  615,  615,  615,  615,
+      615,  615,  615,  615,  615,  615,  615,  615,  615,  616,
+      624,  616,  616,  616,  616,  616,  616,  616,  616,  616,
+      625,  626,  627,  629,  630,  631,  632,  636,  637,  638,
+      639,  640,  641,  642,  643,  644,  645,  646,  647,  648,
+      649,  650,  652,  652,  652,  652,  652,  652,  652,  652,
+      652,  653,  652,  652,  652,  652,  652,  652,  654,  654,
+      654,  654,  654,  654,  654,  654,  654,  660,  654,  654,
+
+      654,  654,  654,  654,  655,  655,  655,  655,  655,  655,
+      655,  655,  655,  661,  655,  655,  655,  655,  655,  655,
+      656,  656,  656,  656,  656,  656,  656,  656,  656,  666,
+      656,  656,  656,  656,  656,  656,  657,  667,  657,  657,
+      657,  657,  657,  657,  657,  657,  657,  658,  658,  658,
+      658,  658,  658,  658,  658,  658,  658,  658,  658,  658,
+      658,  658,  658,  659,  669,  659,  659,  659,  659,  659,
+      659,  659,  659,  659,  662,  662,  662,  662,  662,  662,
+      662,  662,  662,  670,  662,  662,  662,  662,  662,  662,
+      663,  663,  663,  663,  663,  663,  663,  663,  663,  671,
+
+      663,  663,  663,  663,  663,  663,  664,  675,  664,  664,
+      664,  664,  664,  664,  664,  664,  664,  673,  677,  679,
+      680,  681,  682,  673,  683,  685,  686,  687,  688,  690,
+      691,  692,  693,  693,  693,  693,  693,  693,  693,  693,
+      693,  696,  693,  693,  693,  693,  693,  693,  694,  694,
+      694,  694,  694,  694,  694,  694,  694,  697,  694,  694,
+      694,  694,  694,  694,  695,  695,  695,  695,  695,  695,
+      695,  695,  695,  695,  695,  695,  695,  695,  695,  695,
+      698,  698,  698,  698,  698,  698,  698,  698,  698,  705,
+      698,  698,  698,  698,  698,  698,  699,  699,  699,  699,
+
+      699,  699,  699,  699,  699,  706,  699,  699,  699,  699,
+      699,  699,  700,  708,  700,  700,  700,  700,  700,  700,
+      700,  700,  700,  701,  701,  701,  701,  701,  701,  701,
+      701,  701,  710,  701,  701,  701,  701,  701,  701,  702,
+      711,  702,  702,  702,  702,  702,  702,  702,  702,  702,
+      703,  703,  703,  703,  703,  703,  703,  703,  703,  703,
+      703,  703,  703,  703,  703,  703,  704,  712,  704,  704,
+      704,  704,  704,  704,  704,  704,  704,  714,  715,  716,
+      717,  718,  719,  720,  721,  722,  723,  724,  725,  726,
+      727,  728,  728,  728,  728,  728,  728,  728,  728,  728,
+
+      734,  728,  728,  728,  728,  728,  728,  729,  729,  729,
+      729,  729,  729,  729,  729,  729,  729,  729,  729,  729,
+      729,  729,  729,  730,  730,  730,  730,  730,  730,  730,
+      730,  730,  735,  730,  730,  730,  730,  730,  730,  731,
+      739,  731,  731,  731,  731,  731,  731,  731,  731,  731,
       732,  732,  732,  732,  732,  732,  732,  732,  732,  732,
-      732,  732,  732,  732,  735,  744,  735,  735,  735,  735,
-      735,  735,  735,  735,  735,    0,    0,    0,    0,    0,
-
-        0,    0,  745,  746,  732,  732,  732,  732,  732,  732,
-      734,  744,  734,  734,  734,  734,  734,  734,  734,  734,
-      734,  734,  734,  734,  734,  734,  734,  734,  745,  746,
-      748,  755,  763,  755,  755,  755,  755,  755,  755,  755,
-      755,  755,    0,    0,    0,    0,    0,    0,  734,  734,
-      734,  734,  734,  734,    0,    0,  748,  754,  763,  754,
-      754,  754,  754,  754,  754,  754,  754,  754,  754,  754,
-      754,  754,  754,  754,  754,  757,  768,  757,  757,  757,
-      757,  757,  757,  757,  757,  757,  769,    0,    0,    0,
-        0,    0,    0,    0,  771,  754,  754,  754,  754,  754,
-
-      754,  756,  768,  756,  756,  756,  756,  756,  756,  756,
-      756,  756,  769,  756,  756,  756,  756,  756,  756,  758,
-      771,  758,  758,  758,  758,  758,  758,  758,  758,  758,
-      758,    0,    0,    0,    0,    0,    0,    0,  772,  756,
-      756,  756,  756,  756,  756,  760,    0,  760,  760,  760,
-      760,  760,  760,  760,  760,  760,  760,  760,  760,  760,
-      760,  760,  760,  762,  772,  762,  762,  762,  762,  762,
-      762,  762,  762,  762,  773,  774,  775,    0,  788,    0,
-        0,    0,    0,  760,  760,  760,  760,  760,  760,  784,
-      793,  784,  784,  784,  784,  784,  784,  784,  784,  784,
-
-      773,  774,  775,  781,  788,  781,  781,  781,  781,  781,
-      781,  781,  781,  781,  781,  783,  793,  783,  783,  783,
-      783,  783,  783,  783,  783,  783,  795,  783,  783,  783,
-      783,  783,  783,  786,  798,  786,  786,  786,  786,  786,
-      786,  786,  786,  786,    0,    0,    0,    0,    0,    0,
-        0,  799,  795,  783,  783,  783,  783,  783,  783,  785,
-      798,  785,  785,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,  785,  799,  805,    0,
-      805,  805,  805,  805,  805,  805,  805,  805,  805,    0,
-        0,    0,    0,    0,    0,    0,  809,  785,  785,  785,
-
-      785,  785,  785,  804,    0,  804,  804,  804,  804,  804,
-      804,  804,  804,  804,  814,  804,  804,  804,  804,  804,
-      804,  806,  809,  806,  806,  806,  806,  806,  806,  806,
-      806,  806,  806,  817,  825,  826,  827,  832,  833,  834,
-      814,  804,  804,  804,  804,  804,  804,  822,  840,  822,
-      822,  822,  822,  822,  822,  822,  822,  822,    0,  817,
-      825,  826,  827,  832,  833,  834,    0,    0,    0,    0,
-        0,    0,    0,    0,  840,  867,  867,  867,  867,  868,
-      868,  868,  868,  869,  869,  869,  869,  870,    0,  870,
-      870,  871,  871,  871,  871,  872,    0,  872,  872,  873,
-
-      873,  875,  875,  876,  876,  877,  877,  878,  878,  879,
-      879,  880,  880,  881,  881,  882,  882,  883,  883,  884,
-      884,  885,  885,  886,  886,  887,  887,  888,  888,  889,
-      889,  890,  890,  891,  891,  892,  892,  893,  893,  894,
-      894,  895,  895,  896,  896,  897,  897,  898,  898,  899,
-      899,  900,  900,  901,  901,  902,  902,  903,  903,  904,
-      904,  905,  905,  906,  906,  907,  907,  908,  908,  909,
-      909,  910,  910,  912,  912,  913,  913,  914,  914,  916,
-      916,  917,  917,  918,  918,  921,  921,  922,  922,  923,
-      923,  925,  925,  926,  926,  929,  929,  930,  930,  931,
-
-      931,  932,  932,  933,  933,  935,  935,  936,  936,  937,
-      937,  938,  938,  939,  939,  941,  941,  942,  942,  943,
-      943,  945,  945,  947,  947,  948,  948,  949,  949,  951,
-      951,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-
-      866,  866,  866,  866,  866,  866
+      732,  732,  732,  732,  732,  732,  733,  741,  733,  733,
+      733,  733,  733,  733,  733,  733,  733,  736,  736,  736,
+      736,  736,  736,  736,  736,  736,  742,  736,  736,  736,
+      736,  736,  736,  737,  737,  737,  737,  737,  737,  737,
+
+      737,  737,  743,  737,  737,  737,  737,  737,  737,  738,
+      744,  738,  738,  738,  738,  738,  738,  738,  738,  738,
+      745,  746,  747,  748,  749,  750,  752,  755,  757,  757,
+      757,  757,  757,  757,  757,  757,  757,  761,  757,  757,
+      757,  757,  757,  757,  758,  758,  758,  758,  758,  758,
+      758,  758,  758,  762,  758,  758,  758,  758,  758,  758,
+      759,  759,  759,  759,  759,  759,  759,  759,  759,  759,
+      759,  759,  759,  759,  759,  759,  760,  760,  760,  760,
+      760,  760,  760,  760,  760,  770,  760,  760,  760,  760,
+      760,  760,  763,  763,  763,  763,  763,  763,  763,  763,
+
+      763,  774,  763,  763,  763,  763,  763,  763,  764,  764,
+      764,  764,  764,  764,  764,  764,  764,  775,  764,  764,
+      764,  764,  764,  764,  765,  776,  765,  765,  765,  765,
+      765,  765,  765,  765,  765,  766,  766,  766,  766,  766,
+      766,  766,  766,  766,  777,  766,  766,  766,  766,  766,
+      766,  767,  778,  767,  767,  767,  767,  767,  767,  767,
+      767,  767,  768,  768,  768,  768,  768,  768,  768,  768,
+      768,  768,  768,  768,  768,  768,  768,  768,  769,  779,
+      769,  769,  769,  769,  769,  769,  769,  769,  769,  773,
+      773,  773,  780,  773,  782,  783,  783,  783,  783,  783,
+
+      783,  783,  783,  783,  784,  783,  783,  783,  783,  783,
+      783,  785,  785,  785,  785,  785,  785,  785,  785,  785,
+      786,  785,  785,  785,  785,  785,  785,  787,  787,  787,
+      787,  787,  787,  787,  787,  787,  787,  787,  787,  787,
+      787,  787,  787,  788,  788,  788,  788,  788,  788,  788,
+      788,  788,  792,  788,  788,  788,  788,  788,  788,  789,
+      793,  789,  789,  789,  789,  789,  789,  789,  789,  789,
+      790,  790,  790,  790,  790,  790,  790,  790,  790,  797,
+      790,  790,  790,  790,  790,  790,  791,  800,  791,  791,
+      791,  791,  791,  791,  791,  791,  791,  794,  794,  794,
+
+      794,  794,  794,  794,  794,  794,  801,  794,  794,  794,
+      794,  794,  794,  795,  795,  795,  795,  795,  795,  795,
+      795,  795,  802,  795,  795,  795,  795,  795,  795,  796,
+      803,  796,  796,  796,  796,  796,  796,  796,  796,  796,
+      799,  805,  806,  799,  807,  808,  809,  810,  811,  811,
+      811,  811,  811,  811,  811,  811,  811,  815,  811,  811,
+      811,  811,  811,  811,  813,  813,  813,  813,  813,  813,
+      813,  813,  813,  816,  813,  813,  813,  813,  813,  813,
+      814,  814,  814,  814,  814,  814,  814,  814,  814,  822,
+      814,  814,  814,  814,  814,  814,  817,  817,  817,  817,
+
+      817,  817,  817,  817,  817,  823,  817,  817,  817,  817,
+      817,  817,  818,  824,  818,  818,  818,  818,  818,  818,
+      818,  818,  818,  819,  819,  819,  819,  819,  819,  819,
+      819,  819,  825,  819,  819,  819,  819,  819,  819,  820,
+      826,  820,  820,  820,  820,  820,  820,  820,  820,  820,
+      821,  821,  821,  821,  821,  821,  821,  821,  821,  827,
+      821,  821,  821,  821,  821,  821,  829,  832,  833,  834,
+      834,  834,  834,  834,  834,  834,  834,  834,  835,  834,
+      834,  834,  834,  834,  834,  836,  836,  836,  836,  836,
+      836,  836,  836,  836,  840,  836,  836,  836,  836,  836,
+
+      836,  837,  837,  837,  837,  837,  837,  837,  837,  837,
+      837,  837,  837,  837,  837,  837,  837,  838,  838,  838,
+      838,  838,  838,  838,  838,  838,  841,  838,  838,  838,
+      838,  838,  838,  839,  843,  839,  839,  839,  839,  839,
+      839,  839,  839,  839,  842,  842,  842,  842,  842,  842,
+      842,  842,  842,  848,  842,  842,  842,  842,  842,  842,
+      851,  852,  852,  852,  852,  852,  852,  852,  852,  852,
+      853,  852,  852,  852,  852,  852,  852,  854,  854,  854,
+      854,  854,  854,  854,  854,  854,  859,  854,  854,  854,
+      854,  854,  854,  855,  855,  855,  855,  855,  855,  855,
+
+      855,  855,  860,  855,  855,  855,  855,  855,  855,  858,
+      858,  858,  858,  858,  858,  858,  858,  858,  861,  858,
+      858,  858,  858,  858,  858,  862,  863,  863,  863,  863,
+      863,  863,  863,  863,  863,  866,  863,  863,  863,  863,
+      863,  863,  864,  864,  864,  864,  864,  864,  864,  864,
+      864,  864,  864,  864,  864,  864,  864,  864,  867,  868,
+      869,  869,  869,  869,  869,  869,  869,  869,  869,  870,
+      869,  869,  869,  869,  869,  869,  871,  871,  871,  871,
+      871,  871,  871,  871,  871,  874,  871,  871,  871,  871,
+      871,  871,  872,  872,  872,  872,  872,  872,  872,  872,
+
+      872,  880,  872,  872,  872,  872,  872,  872,  876,  876,
+      876,  876,  876,  876,  876,  876,  876,  881,  876,  876,
+      876,  876,  876,  876,  877,  877,  877,  877,  877,  877,
+      877,  877,  877,  888,  877,  877,  877,  877,  877,  877,
+      878,  878,  878,  878,  878,  878,  878,  878,  878,  878,
+      878,  878,  878,  878,  878,  878,  882,  882,  882,  882,
+      882,  882,  882,  882,  882,  891,  882,  882,  882,  882,
+      882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+      883,  894,  883,  883,  883,  883,  883,  883,  884,  884,
+      884,  884,  884,  884,  884,  884,  884,  895,  884,  884,
+
+      884,  884,  884,  884,  885,  885,  885,  885,  885,  885,
+      885,  885,  885,  899,  885,  885,  885,  885,  885,  885,
+      886,  886,  886,  886,  886,  886,  886,  886,  886,  886,
+      886,  886,  886,  886,  886,  886,  887,  887,  887,  887,
+      887,  887,  887,  887,  887,    0,  887,  887,  887,  887,
+      887,  887,  889,  889,  889,  889,  889,  889,  889,  889,
+      889,    0,  889,  889,  889,  889,  889,  889,  890,  890,
+      890,  890,  890,  890,  890,  890,  890,    0,  890,  890,
+      890,  890,  890,  890,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,    0,  892,  892,  892,  892,  892,  892,
+
+      893,  893,  893,  893,  893,  893,  893,  893,  893,  893,
+      893,  893,  893,  893,  893,  893,  896,  896,  896,  896,
+      896,  896,  896,  896,  896,    0,  896,  896,  896,  896,
+      896,  896,  897,  897,  897,  897,  897,  897,  897,  897,
+      897,  898,  898,  898,  898,  898,  898,  898,  898,  898,
+        0,  898,  898,  898,  898,  898,  898,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+      900,  900,  900,  900,  900,  900,  900,  900,  900,  900,
+
+      900,  900,  900,  900,  900,  900
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[102] =
+static yyconst flex_int32_t yy_rule_can_match_eol[104] =
     {   0,
 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0, 0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 0,     };
 
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
@@ -1836,13 +1756,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 867 )
+				if ( yy_current_state >= 901 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 4032 );
+		while ( yy_base[yy_current_state] != 3758 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2127,101 +2047,109 @@ YY_RULE_SETUP
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-{ return ClntParser::AUTH_METHODS_; }
+{ return ClntParser::RENEW_COALESCE_; }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-{ return ClntParser::AUTH_PROTOCOL_; }
+{ return ClntParser::STARTUP_SPREAD_; }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-{ return ClntParser::AUTH_ALGORITHM_; }
+{ return ClntParser::AUTH_METHODS_; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-{ return ClntParser::AUTH_REPLAY_; }
+{ return ClntParser::AUTH_PROTOCOL_; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-{ return ClntParser::AUTH_REALM_; }
+{ return ClntParser::AUTH_ALGORITHM_; }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_NONE_; }
+{ return ClntParser::AUTH_REPLAY_; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_PLAIN_; }
+{ return ClntParser::AUTH_REALM_; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_MD5_; }
+{ return ClntParser::DIGEST_NONE_; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA1_; }
+{ return ClntParser::DIGEST_PLAIN_; }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA224_; }
+{ return ClntParser::DIGEST_HMAC_MD5_; }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA256_; }
+{ return ClntParser::DIGEST_HMAC_SHA1_; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA384_; }
+{ return ClntParser::DIGEST_HMAC_SHA224_; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA512_; }
+{ return ClntParser::DIGEST_HMAC_SHA256_; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-{ return ClntParser::SKIP_CONFIRM_; }
+{ return ClntParser::DIGEST_HMAC_SHA384_; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-{ return ClntParser::AFTR_; }
+{ return ClntParser::DIGEST_HMAC_SHA512_; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-{ return ClntParser::DOWNLINK_PREFIX_IFACES_; }
+{ return ClntParser::SKIP_CONFIRM_; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-{ return ClntParser::BIND_TO_ADDR_; }
+{ return ClntParser::AFTR_; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-{ return ClntParser::EXPERIMENTAL_; }
+{ return ClntParser::DOWNLINK_PREFIX_IFACES_; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
-{ return ClntParser::ADDR_PARAMS_; }
+{ return ClntParser::BIND_TO_ADDR_; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
-;
+{ return ClntParser::EXPERIMENTAL_; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
-;
+{ return ClntParser::ADDR_PARAMS_; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
+;
+	YY_BREAK
+case 85:
+YY_RULE_SETUP
+;
+	YY_BREAK
+case 86:
+YY_RULE_SETUP
 {
   BEGIN(COMMENT);
   ComBeg=yylineno;
 }
 	YY_BREAK
-case 85:
+case 87:
 YY_RULE_SETUP
 BEGIN(INITIAL);
 	YY_BREAK
-case 86:
-/* rule 86 can match eol */
+case 88:
+/* rule 88 can match eol */
 YY_RULE_SETUP
 ;
 	YY_BREAK
@@ -2233,7 +2161,7 @@ case YY_STATE_EOF(COMMENT):
 	YY_BREAK
     //IPv6 address - various forms
 
-case 87:
+case 89:
 YY_RULE_SETUP
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
@@ -2244,7 +2172,7 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 90:
 YY_RULE_SETUP
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
@@ -2255,7 +2183,7 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 91:
 YY_RULE_SETUP
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
@@ -2267,7 +2195,7 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 92:
 YY_RULE_SETUP
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
@@ -2278,7 +2206,7 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 93:
 YY_RULE_SETUP
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
@@ -2289,7 +2217,7 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 94:
 YY_RULE_SETUP
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
@@ -2300,7 +2228,7 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 95:
 YY_RULE_SETUP
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
@@ -2311,8 +2239,8 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
-/* rule 94 can match eol */
+case 96:
+/* rule 96 can match eol */
 YY_RULE_SETUP
 {
     yylval.strval=new char[strlen(yytext)-1];
@@ -2321,7 +2249,7 @@ YY_RULE_SETUP
     return ClntParser::STRING_;
 }
 	YY_BREAK
-case 95:
+case 97:
 YY_RULE_SETUP
 {
     int len = strlen(yytext);
@@ -2344,7 +2272,7 @@ YY_RULE_SETUP
     return ClntParser::STRING_;
 }
 	YY_BREAK
-case 96:
+case 98:
 YY_RULE_SETUP
 {
     // DUID in 0x00010203 format
@@ -2378,7 +2306,7 @@ YY_RULE_SETUP
    return ClntParser::DUID_;
 }
 	YY_BREAK
-case 97:
+case 99:
 YY_RULE_SETUP
 {
    // DUID in 00:01:02:03 format
@@ -2408,7 +2336,7 @@ YY_RULE_SETUP
    return ClntParser::DUID_;
 }
 	YY_BREAK
-case 98:
+case 100:
 YY_RULE_SETUP
 {
     yytext[strlen(yytext)-1]='\n';
@@ -2419,7 +2347,7 @@ YY_RULE_SETUP
     return ClntParser::HEXNUMBER_;
 }
 	YY_BREAK
-case 99:
+case 101:
 YY_RULE_SETUP
 {
     if(!sscanf(yytext,"%10u",(unsigned int*)&(yylval.ival))) {
@@ -2429,11 +2357,11 @@ YY_RULE_SETUP
     return ClntParser::INTNUMBER_;
 }
 	YY_BREAK
-case 100:
+case 102:
 YY_RULE_SETUP
 {return yytext[0];}
 	YY_BREAK
-case 101:
+case 103:
 YY_RULE_SETUP
 ECHO;
 	YY_BREAK
@@ -2819,7 +2747,7 @@ int yyFlexLexer::yy_get_next_buffer()
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 867 )
+			if ( yy_current_state >= 901 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -2847,11 +2775,11 @@ int yyFlexLexer::yy_get_next_buffer()
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 867 )
+		if ( yy_current_state >= 901 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 866);
+	yy_is_jam = (yy_current_state == 900);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -19,7 +19,8 @@ using namespace std;
 
 TClntParsIfaceOpt::TClntParsIfaceOpt()
     : TClntParsIAOpt(), Stateless_(false), Unicast(CLIENT_DEFAULT_UNICAST),
-      RapidCommit(CLIENT_DEFAULT_RAPID_COMMIT), Timezone(""), FQDN(""),
+      RapidCommit(CLIENT_DEFAULT_RAPID_COMMIT), RenewCoalesce(CLIENT_DEFAULT_RENEW_COALESCE),
+      Timezone(""), FQDN(""),
       NISDomain(""), Lifetime(false), ReqDNSServer(false), ReqDomain(false),
       ReqNTPServer(false), ReqTimezone(false), ReqSIPServer(false),
       ReqSIPDomain(false), ReqFQDN(false), ReqNISServer(false),
@@ -57,6 +58,16 @@ void TClntParsIfaceOpt::setRapidCommit(bool rapCom)
     this->RapidCommit=rapCom;
 }
 
+unsigned int TClntParsIfaceOpt::getRenewCoalesce()
+{
+    return RenewCoalesce;
+}
+
+void TClntParsIfaceOpt::setRenewCoalesce(unsigned int window)
+{
+    RenewCoalesce = window;
+}
+
 TClntParsIfaceOpt::~TClntParsIfaceOpt() {
 }
 
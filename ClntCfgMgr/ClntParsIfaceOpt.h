@@ -30,6 +30,8 @@ class TClntParsIfaceOpt : public TClntParsIAOpt
     bool getUnicast();
     bool getRapidCommit();
     void setRapidCommit(bool rapid);
+    unsigned int getRenewCoalesce();
+    void setRenewCoalesce(unsigned int window);
     bool getStateful();
     void setStateful(bool state);
 
@@ -114,6 +116,9 @@ private:
     /// should we try to use rapid-commit?
     bool RapidCommit;
 
+    /// renew IAs reaching T1 within that many seconds together
+    unsigned int RenewCoalesce;
+
     List(TIPv6Addr) DNSServerLst;
     List(std::string) DomainLst;
     List(TIPv6Addr) NTPServerLst;
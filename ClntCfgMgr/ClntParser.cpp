@@ -477,6 +477,8 @@ typedef
 #define	DUID_KEYWORD_	336
 #define	HEX_KEYWORD_	337
 #define	RECONFIGURE_	338
+#define	RENEW_COALESCE_	339
+#define	STARTUP_SPREAD_	340
 
 
 #line 263 "../bison++/bison.cc"
@@ -607,6 +609,8 @@ static const int STRING_KEYWORD_;
 static const int DUID_KEYWORD_;
 static const int HEX_KEYWORD_;
 static const int RECONFIGURE_;
+static const int RENEW_COALESCE_;
+static const int STARTUP_SPREAD_;
 
 
 #line 307 "../bison++/bison.cc"
@@ -696,6 +700,8 @@ enum YY_ClntParser_ENUM_TOKEN { YY_ClntParser_NULL_TOKEN=0
 	,DUID_KEYWORD_=336
 	,HEX_KEYWORD_=337
 	,RECONFIGURE_=338
+	,RENEW_COALESCE_=339
+	,STARTUP_SPREAD_=340
 
 
 #line 310 "../bison++/bison.cc"
@@ -813,6 +819,8 @@ const int YY_ClntParser_CLASS::STRING_KEYWORD_=335;
 const int YY_ClntParser_CLASS::DUID_KEYWORD_=336;
 const int YY_ClntParser_CLASS::HEX_KEYWORD_=337;
 const int YY_ClntParser_CLASS::RECONFIGURE_=338;
+const int YY_ClntParser_CLASS::RENEW_COALESCE_=339;
+const int YY_ClntParser_CLASS::STARTUP_SPREAD_=340;
 
 
 #line 341 "../bison++/bison.cc"
@@ -831,18 +839,18 @@ YY_ClntParser_CONSTRUCTOR_CODE;
  #line 352 "../bison++/bison.cc"
 
 
-#define	YYFINAL		311
+#define	YYFINAL		317
 #define	YYFLAG		-32768
-#define	YYNTBASE	89
+#define	YYNTBASE	91
 
-#define YYTRANSLATE(x) ((unsigned)(x) <= 338 ? yytranslate[x] : 194)
+#define YYTRANSLATE(x) ((unsigned)(x) <= 340 ? yytranslate[x] : 198)
 
 static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,    86,    88,     2,    87,     2,     2,     2,
+     2,     2,     2,    88,    90,     2,    89,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -850,7 +858,7 @@ static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,    84,     2,    85,     2,     2,     2,     2,     2,
+     2,     2,    86,     2,    87,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -871,7 +879,7 @@ static const char yytranslate[] = {     0,
     46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
     56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
     66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-    76,    77,    78,    79,    80,    81,    82,    83
+    76,    77,    78,    79,    80,    81,    82,    83,    84,    85
 };
 
 #if YY_ClntParser_DEBUG != 0
@@ -882,95 +890,96 @@ static const short yyprhs[] = {     0,
     61,    63,    65,    67,    69,    71,    73,    75,    77,    79,
     81,    83,    85,    87,    89,    91,    93,    95,    97,    99,
    101,   103,   105,   107,   109,   111,   113,   115,   117,   119,
-   120,   124,   125,   132,   133,   140,   145,   150,   154,   158,
-   160,   163,   165,   168,   170,   173,   175,   178,   180,   181,
-   182,   189,   193,   196,   198,   201,   202,   208,   209,   216,
-   220,   222,   225,   227,   230,   232,   235,   237,   240,   243,
-   244,   250,   251,   258,   259,   266,   268,   271,   273,   275,
-   278,   281,   284,   287,   290,   293,   298,   300,   303,   305,
-   308,   311,   312,   316,   319,   322,   324,   327,   330,   332,
-   336,   338,   340,   342,   344,   346,   348,   350,   352,   354,
-   356,   358,   360,   361,   365,   366,   370,   373,   376,   379,
-   381,   383,   385,   387,   390,   393,   396,   399,   402,   405,
-   407,   411,   412,   418,   421,   422,   429,   431,   434,   436,
-   438,   440,   445,   447,   451,   452,   458,   459,   468,   470,
-   473,   475,   477,   480,   483,   485,   487,   491,   495,   497,
-   501,   503,   507,   509,   511,   514,   515,   520,   523,   524,
-   529,   532,   533,   538,   541,   545,   548,   549,   554,   557,
-   558,   563,   566,   570,   574,   577,   578,   583,   586,   587,
-   592,   595,   599,   602,   606,   609,   612,   616,   618,   622,
-   626,   632,   635,   640,   645,   646,   652,   657,   661,   665,
-   669
+   121,   123,   124,   128,   129,   136,   137,   144,   149,   154,
+   158,   162,   164,   167,   169,   172,   174,   177,   179,   182,
+   184,   185,   186,   193,   197,   200,   202,   205,   206,   212,
+   213,   220,   224,   226,   229,   231,   234,   236,   239,   241,
+   244,   247,   248,   254,   255,   262,   263,   270,   272,   275,
+   277,   279,   282,   285,   288,   291,   294,   297,   302,   304,
+   307,   309,   312,   315,   316,   320,   323,   326,   328,   331,
+   334,   336,   340,   342,   344,   346,   348,   350,   352,   354,
+   356,   358,   360,   362,   364,   365,   369,   370,   374,   377,
+   380,   383,   386,   388,   390,   392,   394,   397,   400,   403,
+   406,   409,   412,   415,   417,   421,   422,   428,   431,   432,
+   439,   441,   444,   446,   448,   450,   455,   457,   461,   462,
+   468,   469,   478,   480,   483,   485,   487,   490,   493,   495,
+   497,   501,   505,   507,   511,   513,   517,   519,   521,   524,
+   525,   530,   533,   534,   539,   542,   543,   548,   551,   555,
+   558,   559,   564,   567,   568,   573,   576,   580,   584,   587,
+   588,   593,   596,   597,   602,   605,   609,   612,   616,   619,
+   622,   626,   628,   632,   636,   642,   645,   650,   655,   656,
+   662,   667,   671,   675,   679
 };
 
-static const short yyrhs[] = {    90,
-     0,     0,    91,     0,    96,     0,    90,    91,     0,    90,
-    96,     0,    92,     0,   116,     0,   117,     0,   115,     0,
-   118,     0,   121,     0,   119,     0,   122,     0,   123,     0,
-   148,     0,   149,     0,   124,     0,   126,     0,   127,     0,
-   128,     0,   129,     0,   132,     0,   133,     0,   134,     0,
-   181,     0,   135,     0,   146,     0,   147,     0,    94,     0,
-   145,     0,    93,     0,   164,     0,   120,     0,   163,     0,
-   169,     0,   171,     0,   173,     0,   175,     0,   176,     0,
-   178,     0,   180,     0,   182,     0,   184,     0,   186,     0,
-   187,     0,   188,     0,   189,     0,   191,     0,   136,     0,
-   138,     0,   192,     0,   144,     0,   140,     0,   151,     0,
-   152,     0,   142,     0,   114,     0,   143,     0,     0,    51,
-    95,   167,     0,     0,    24,    42,    84,    97,    99,    85,
-     0,     0,    24,   168,    84,    98,    99,    85,     0,    24,
-    42,    84,    85,     0,    24,   168,    84,    85,     0,    24,
-    42,    25,     0,    24,   168,    25,     0,    92,     0,    99,
-    92,     0,   105,     0,    99,   105,     0,   100,     0,    99,
-   100,     0,   153,     0,    99,   153,     0,    29,     0,     0,
-     0,    29,    84,   101,   103,   102,    85,     0,    29,    84,
-    85,     0,   103,   104,     0,   104,     0,    30,   168,     0,
-     0,    28,    84,   106,   108,    85,     0,     0,    28,   168,
-    84,   107,   108,    85,     0,    28,    84,    85,     0,    28,
-     0,    28,   168,     0,    93,     0,   108,    93,     0,   109,
-     0,   108,   109,     0,    31,     0,    31,    33,     0,    31,
-   168,     0,     0,    31,    84,   110,   113,    85,     0,     0,
-    31,    33,    84,   111,   113,    85,     0,     0,    31,   168,
-    84,   112,   113,    85,     0,   114,     0,   113,   114,     0,
-   141,     0,   150,     0,    39,   168,     0,    40,    42,     0,
-    38,    42,     0,    41,   168,     0,    52,    53,     0,    52,
-    54,     0,    52,    55,   168,    45,     0,    69,     0,    34,
-    42,     0,    46,     0,    46,   168,     0,    37,    42,     0,
-     0,    56,   125,   130,     0,    57,    42,     0,    58,    42,
-     0,   128,     0,    59,    42,     0,    60,    42,     0,   131,
-     0,   130,    86,   131,     0,    61,     0,    62,     0,    63,
-     0,    64,     0,    65,     0,    66,     0,    67,     0,    68,
-     0,    70,     0,    72,     0,    71,     0,    73,     0,     0,
-    26,   137,   165,     0,     0,    27,   139,   165,     0,    78,
-    33,     0,     5,   168,     0,    35,   168,     0,    74,     0,
-    75,     0,    48,     0,    47,     0,    83,   168,     0,    20,
-    42,     0,    21,   168,     0,     7,   168,     0,     3,   168,
-     0,     4,   168,     0,    49,     0,    49,    84,    85,     0,
-     0,    49,    84,   154,   156,    85,     0,    49,   168,     0,
-     0,    49,   168,    84,   155,   156,    85,     0,   157,     0,
-   156,   157,     0,   158,     0,   151,     0,   152,     0,    50,
-    33,    87,   168,     0,    50,     0,    50,    84,    85,     0,
-     0,    50,    84,   159,   161,    85,     0,     0,    50,    33,
-    87,   168,    84,   160,   161,    85,     0,   162,     0,   161,
-   162,     0,   150,     0,   141,     0,     8,   168,     0,    77,
-   168,     0,    33,     0,    45,     0,   165,    86,    33,     0,
-   165,    86,    45,     0,    33,     0,   166,    86,    33,     0,
-    42,     0,   167,    86,    42,     0,    43,     0,    44,     0,
-    36,     6,     0,     0,    36,     6,   170,   166,     0,    36,
-    10,     0,     0,    36,    10,   172,   167,     0,    36,     9,
-     0,     0,    36,     9,   174,   166,     0,    36,    11,     0,
+static const short yyrhs[] = {    92,
+     0,     0,    93,     0,    98,     0,    92,    93,     0,    92,
+    98,     0,    94,     0,   118,     0,   119,     0,   117,     0,
+   120,     0,   123,     0,   121,     0,   124,     0,   125,     0,
+   152,     0,   153,     0,   126,     0,   128,     0,   129,     0,
+   130,     0,   131,     0,   134,     0,   135,     0,   136,     0,
+   185,     0,   137,     0,   149,     0,   151,     0,    96,     0,
+   148,     0,   150,     0,    95,     0,   168,     0,   122,     0,
+   167,     0,   173,     0,   175,     0,   177,     0,   179,     0,
+   180,     0,   182,     0,   184,     0,   186,     0,   188,     0,
+   190,     0,   191,     0,   192,     0,   193,     0,   195,     0,
+   138,     0,   140,     0,   196,     0,   147,     0,   142,     0,
+   145,     0,   155,     0,   156,     0,   144,     0,   116,     0,
+   146,     0,     0,    51,    97,   171,     0,     0,    24,    42,
+    86,    99,   101,    87,     0,     0,    24,   172,    86,   100,
+   101,    87,     0,    24,    42,    86,    87,     0,    24,   172,
+    86,    87,     0,    24,    42,    25,     0,    24,   172,    25,
+     0,    94,     0,   101,    94,     0,   107,     0,   101,   107,
+     0,   102,     0,   101,   102,     0,   157,     0,   101,   157,
+     0,    29,     0,     0,     0,    29,    86,   103,   105,   104,
+    87,     0,    29,    86,    87,     0,   105,   106,     0,   106,
+     0,    30,   172,     0,     0,    28,    86,   108,   110,    87,
+     0,     0,    28,   172,    86,   109,   110,    87,     0,    28,
+    86,    87,     0,    28,     0,    28,   172,     0,    95,     0,
+   110,    95,     0,   111,     0,   110,   111,     0,    31,     0,
+    31,    33,     0,    31,   172,     0,     0,    31,    86,   112,
+   115,    87,     0,     0,    31,    33,    86,   113,   115,    87,
+     0,     0,    31,   172,    86,   114,   115,    87,     0,   116,
+     0,   115,   116,     0,   143,     0,   154,     0,    39,   172,
+     0,    40,    42,     0,    38,    42,     0,    41,   172,     0,
+    52,    53,     0,    52,    54,     0,    52,    55,   172,    45,
+     0,    69,     0,    34,    42,     0,    46,     0,    46,   172,
+     0,    37,    42,     0,     0,    56,   127,   132,     0,    57,
+    42,     0,    58,    42,     0,   130,     0,    59,    42,     0,
+    60,    42,     0,   133,     0,   132,    88,   133,     0,    61,
+     0,    62,     0,    63,     0,    64,     0,    65,     0,    66,
+     0,    67,     0,    68,     0,    70,     0,    72,     0,    71,
+     0,    73,     0,     0,    26,   139,   169,     0,     0,    27,
+   141,   169,     0,    78,    33,     0,     5,   172,     0,    35,
+   172,     0,    84,   172,     0,    74,     0,    75,     0,    48,
+     0,    47,     0,    85,   172,     0,    83,   172,     0,    20,
+    42,     0,    21,   172,     0,     7,   172,     0,     3,   172,
+     0,     4,   172,     0,    49,     0,    49,    86,    87,     0,
+     0,    49,    86,   158,   160,    87,     0,    49,   172,     0,
+     0,    49,   172,    86,   159,   160,    87,     0,   161,     0,
+   160,   161,     0,   162,     0,   155,     0,   156,     0,    50,
+    33,    89,   172,     0,    50,     0,    50,    86,    87,     0,
+     0,    50,    86,   163,   165,    87,     0,     0,    50,    33,
+    89,   172,    86,   164,   165,    87,     0,   166,     0,   165,
+   166,     0,   154,     0,   143,     0,     8,   172,     0,    77,
+   172,     0,    33,     0,    45,     0,   169,    88,    33,     0,
+   169,    88,    45,     0,    33,     0,   170,    88,    33,     0,
+    42,     0,   171,    88,    42,     0,    43,     0,    44,     0,
+    36,     6,     0,     0,    36,     6,   174,   170,     0,    36,
+    10,     0,     0,    36,    10,   176,   171,     0,    36,     9,
+     0,     0,    36,     9,   178,   170,     0,    36,    11,     0,
     36,    11,    42,     0,    36,    12,     0,     0,    36,    12,
-   177,   166,     0,    36,    13,     0,     0,    36,    13,   179,
-   167,     0,    36,    18,     0,    36,    18,    42,     0,    36,
-    19,   168,     0,    36,    14,     0,     0,    36,    14,   183,
-   166,     0,    36,    15,     0,     0,    36,    15,   185,   166,
+   181,   170,     0,    36,    13,     0,     0,    36,    13,   183,
+   171,     0,    36,    18,     0,    36,    18,    42,     0,    36,
+    19,   172,     0,    36,    14,     0,     0,    36,    14,   187,
+   170,     0,    36,    15,     0,     0,    36,    15,   189,   170,
      0,    36,    16,     0,    36,    16,    42,     0,    36,    17,
      0,    36,    17,    42,     0,    36,    22,     0,    36,    23,
-     0,    36,    23,   190,     0,   168,     0,   168,    88,   168,
-     0,   190,    86,   168,     0,   190,    86,   168,    88,   168,
-     0,    36,    76,     0,    36,   168,    82,    45,     0,    36,
-   168,    31,    33,     0,     0,    36,   168,    79,   193,   166,
-     0,    36,   168,    80,    42,     0,    36,   168,    82,     0,
-    36,   168,    31,     0,    36,   168,    80,     0,    36,   168,
+     0,    36,    23,   194,     0,   172,     0,   172,    90,   172,
+     0,   194,    88,   172,     0,   194,    88,   172,    90,   172,
+     0,    36,    76,     0,    36,   172,    82,    45,     0,    36,
+   172,    31,    33,     0,     0,    36,   172,    79,   197,   170,
+     0,    36,   172,    80,    42,     0,    36,   172,    82,     0,
+    36,   172,    31,     0,    36,   172,    80,     0,    36,   172,
     79,     0
 };
 
@@ -978,31 +987,31 @@ static const short yyrhs[] = {    90,
 
 #if (YY_ClntParser_DEBUG != 0) || defined(YY_ClntParser_ERROR_VERBOSE) 
 static const short yyrline[] = { 0,
-   145,   146,   150,   151,   152,   153,   157,   158,   159,   160,
-   161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
-   171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
-   181,   185,   186,   187,   188,   189,   190,   191,   192,   193,
-   194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
-   204,   205,   206,   207,   211,   212,   213,   214,   215,   219,
-   221,   229,   234,   244,   251,   260,   272,   283,   296,   310,
-   311,   312,   313,   314,   315,   316,   317,   324,   333,   344,
-   349,   349,   361,   362,   366,   378,   384,   389,   396,   406,
-   417,   425,   438,   439,   440,   441,   454,   460,   466,   474,
-   485,   492,   503,   513,   521,   533,   534,   538,   539,   543,
-   553,   558,   563,   569,   570,   571,   579,   601,   608,   616,
-   639,   645,   648,   658,   680,   688,   691,   707,   716,   717,
-   721,   722,   723,   724,   725,   726,   727,   728,   732,   738,
-   744,   750,   757,   762,   768,   771,   777,   783,   790,   797,
-   808,   824,   831,   838,   845,   862,   870,   877,   884,   891,
-   899,   907,   914,   918,   927,   934,   942,   943,   947,   948,
-   949,   955,   962,   969,   976,   979,   987,   994,  1001,  1002,
-  1006,  1007,  1011,  1029,  1046,  1050,  1054,  1058,  1065,  1066,
-  1070,  1071,  1074,  1075,  1082,  1088,  1092,  1101,  1106,  1109,
-  1118,  1124,  1127,  1136,  1140,  1150,  1156,  1159,  1168,  1173,
-  1176,  1185,  1194,  1201,  1216,  1222,  1225,  1234,  1240,  1243,
-  1252,  1256,  1267,  1271,  1281,  1292,  1297,  1305,  1306,  1307,
-  1308,  1312,  1319,  1326,  1335,  1340,  1346,  1353,  1359,  1366,
-  1372
+   146,   147,   151,   152,   153,   154,   158,   159,   160,   161,
+   162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+   172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+   182,   183,   187,   188,   189,   190,   191,   192,   193,   194,
+   195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+   205,   206,   207,   208,   209,   210,   214,   215,   216,   217,
+   218,   222,   224,   232,   237,   247,   254,   263,   275,   286,
+   299,   313,   314,   315,   316,   317,   318,   319,   320,   327,
+   336,   347,   352,   352,   364,   365,   369,   381,   387,   392,
+   399,   409,   420,   428,   441,   442,   443,   444,   457,   463,
+   469,   477,   488,   495,   506,   516,   524,   536,   537,   541,
+   542,   546,   556,   561,   566,   572,   573,   574,   582,   604,
+   611,   619,   642,   648,   651,   661,   683,   691,   694,   710,
+   719,   720,   724,   725,   726,   727,   728,   729,   730,   731,
+   735,   741,   747,   753,   760,   765,   771,   774,   780,   786,
+   793,   800,   807,   818,   834,   841,   848,   856,   863,   880,
+   888,   895,   902,   909,   917,   925,   932,   936,   945,   952,
+   960,   961,   965,   966,   967,   973,   980,   987,   994,   997,
+  1005,  1012,  1019,  1020,  1024,  1025,  1029,  1047,  1064,  1068,
+  1072,  1076,  1083,  1084,  1088,  1089,  1092,  1093,  1100,  1106,
+  1110,  1119,  1124,  1127,  1136,  1142,  1145,  1154,  1158,  1168,
+  1174,  1177,  1186,  1191,  1194,  1203,  1212,  1219,  1234,  1240,
+  1243,  1252,  1258,  1261,  1270,  1274,  1285,  1289,  1299,  1310,
+  1315,  1323,  1324,  1325,  1326,  1330,  1337,  1344,  1353,  1358,
+  1364,  1371,  1377,  1384,  1390
 };
 
 static const char * const yytname[] = {   "$","error","$illegal.","T1_","T2_",
@@ -1019,55 +1028,56 @@ static const char * const yytname[] = {   "$","error","$illegal.","T1_","T2_",
 "DIGEST_HMAC_SHA224_","DIGEST_HMAC_SHA256_","DIGEST_HMAC_SHA384_","DIGEST_HMAC_SHA512_",
 "STATELESS_","ANON_INF_REQUEST_","INSIST_MODE_","INACTIVE_MODE_","EXPERIMENTAL_",
 "ADDR_PARAMS_","REMOTE_AUTOCONF_","AFTR_","ROUTING_","BIND_TO_ADDR_","ADDRESS_LIST_KEYWORD_",
-"STRING_KEYWORD_","DUID_KEYWORD_","HEX_KEYWORD_","RECONFIGURE_","'{'","'}'",
-"','","'/'","'-'","Grammar","GlobalDeclarationList","GlobalOptionDeclaration",
-"InterfaceOptionDeclaration","IAOptionDeclaration","DownlinkPrefixInterfaces",
-"@1","InterfaceDeclaration","@2","@3","InterfaceDeclarationsList","TADeclaration",
-"@4","@5","TADeclarationList","IAID","IADeclaration","@6","@7","IADeclarationList",
-"ADDRESDeclaration","@8","@9","@10","AddressParametersList","AddressParameter",
-"LogLevelOption","LogModeOption","LogNameOption","LogColors","DuidTypeOption",
-"StatelessMode","WorkDirOption","StrictRfcNoRoutingOption","ScriptName","AuthAcceptMethods",
-"@11","AuthProtocol","AuthAlgorithm","AuthReplay","AuthRealm","DigestList","Digest",
-"AnonInfRequest","InactiveMode","InsistMode","Experimental","RejectServersOption",
-"@12","PreferServersOption","@13","BindToAddress","PreferredTimeOption","RapidCommitOption",
-"ExperimentalAddrParams","ExperimentalRemoteAutoconf","ObeyRaBits","SkipConfirm",
-"ReconfigureAccept","DdnsProtocol","DdnsTimeout","ValidTimeOption","T1Option",
-"T2Option","PDDeclaration","@14","@15","PDOptionsList","PDOption","Prefix","@16",
-"@17","PrefixOptionsList","PrefixOption","UnicastOption","Routing","ADDRESDUIDList",
-"ADDRESSList","StringList","Number","DNSServerOption","@18","DomainOption","@19",
-"NTPServerOption","@20","TimeZoneOption","SIPServerOption","@21","SIPDomainOption",
-"@22","FQDNOption","FQDNBits","NISServerOption","@23","NISPServerOption","@24",
-"NISDomainOption","NISPDomainOption","LifetimeOption","VendorSpecOption","VendorSpecList",
-"DsLiteTunnelOption","ExtraOption","@25",""
+"STRING_KEYWORD_","DUID_KEYWORD_","HEX_KEYWORD_","RECONFIGURE_","RENEW_COALESCE_",
+"STARTUP_SPREAD_","'{'","'}'","','","'/'","'-'","Grammar","GlobalDeclarationList",
+"GlobalOptionDeclaration","InterfaceOptionDeclaration","IAOptionDeclaration",
+"DownlinkPrefixInterfaces","@1","InterfaceDeclaration","@2","@3","InterfaceDeclarationsList",
+"TADeclaration","@4","@5","TADeclarationList","IAID","IADeclaration","@6","@7",
+"IADeclarationList","ADDRESDeclaration","@8","@9","@10","AddressParametersList",
+"AddressParameter","LogLevelOption","LogModeOption","LogNameOption","LogColors",
+"DuidTypeOption","StatelessMode","WorkDirOption","StrictRfcNoRoutingOption",
+"ScriptName","AuthAcceptMethods","@11","AuthProtocol","AuthAlgorithm","AuthReplay",
+"AuthRealm","DigestList","Digest","AnonInfRequest","InactiveMode","InsistMode",
+"Experimental","RejectServersOption","@12","PreferServersOption","@13","BindToAddress",
+"PreferredTimeOption","RapidCommitOption","RenewCoalesceOption","ExperimentalAddrParams",
+"ExperimentalRemoteAutoconf","ObeyRaBits","SkipConfirm","StartupSpread","ReconfigureAccept",
+"DdnsProtocol","DdnsTimeout","ValidTimeOption","T1Option","T2Option","PDDeclaration",
+"@14","@15","PDOptionsList","PDOption","Prefix","@16","@17","PrefixOptionsList",
+"PrefixOption","UnicastOption","Routing","ADDRESDUIDList","ADDRESSList","StringList",
+"Number","DNSServerOption","@18","DomainOption","@19","NTPServerOption","@20",
+"TimeZoneOption","SIPServerOption","@21","SIPDomainOption","@22","FQDNOption",
+"FQDNBits","NISServerOption","@23","NISPServerOption","@24","NISDomainOption",
+"NISPDomainOption","LifetimeOption","VendorSpecOption","VendorSpecList","DsLiteTunnelOption",
+"ExtraOption","@25",""
 };
 #endif
 
 static const short yyr1[] = {     0,
-    89,    89,    90,    90,    90,    90,    91,    91,    91,    91,
-    91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
-    91,    91,    91,    91,    91,    91,    91,    91,    91,    91,
-    91,    92,    92,    92,    92,    92,    92,    92,    92,    92,
-    92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
-    92,    92,    92,    92,    93,    93,    93,    93,    93,    95,
-    94,    97,    96,    98,    96,    96,    96,    96,    96,    99,
-    99,    99,    99,    99,    99,    99,    99,   100,   101,   102,
-   100,   100,   103,   103,   104,   106,   105,   107,   105,   105,
-   105,   105,   108,   108,   108,   108,   109,   109,   109,   110,
-   109,   111,   109,   112,   109,   113,   113,   114,   114,   115,
-   116,   117,   118,   119,   119,   119,   120,   121,   122,   122,
-   123,   125,   124,   126,   127,   127,   128,   129,   130,   130,
-   131,   131,   131,   131,   131,   131,   131,   131,   132,   133,
-   134,   135,   137,   136,   139,   138,   140,   141,   142,   143,
+    91,    91,    92,    92,    92,    92,    93,    93,    93,    93,
+    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+    93,    93,    94,    94,    94,    94,    94,    94,    94,    94,
+    94,    94,    94,    94,    94,    94,    94,    94,    94,    94,
+    94,    94,    94,    94,    94,    94,    95,    95,    95,    95,
+    95,    97,    96,    99,    98,   100,    98,    98,    98,    98,
+    98,   101,   101,   101,   101,   101,   101,   101,   101,   102,
+   103,   104,   102,   102,   105,   105,   106,   108,   107,   109,
+   107,   107,   107,   107,   110,   110,   110,   110,   111,   111,
+   111,   112,   111,   113,   111,   114,   111,   115,   115,   116,
+   116,   117,   118,   119,   120,   121,   121,   121,   122,   123,
+   124,   124,   125,   127,   126,   128,   129,   129,   130,   131,
+   132,   132,   133,   133,   133,   133,   133,   133,   133,   133,
+   134,   135,   136,   137,   139,   138,   141,   140,   142,   143,
    144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
-   153,   154,   153,   153,   155,   153,   156,   156,   157,   157,
-   157,   158,   158,   158,   159,   158,   160,   158,   161,   161,
-   162,   162,   163,   164,   165,   165,   165,   165,   166,   166,
-   167,   167,   168,   168,   169,   170,   169,   171,   172,   171,
-   173,   174,   173,   175,   175,   176,   177,   176,   178,   179,
-   178,   180,   180,   181,   182,   183,   182,   184,   185,   184,
-   186,   186,   187,   187,   188,   189,   189,   190,   190,   190,
-   190,   191,   192,   192,   193,   192,   192,   192,   192,   192,
-   192
+   154,   155,   156,   157,   157,   158,   157,   157,   159,   157,
+   160,   160,   161,   161,   161,   162,   162,   162,   163,   162,
+   164,   162,   165,   165,   166,   166,   167,   168,   169,   169,
+   169,   169,   170,   170,   171,   171,   172,   172,   173,   174,
+   173,   175,   176,   175,   177,   178,   177,   179,   179,   180,
+   181,   180,   182,   183,   182,   184,   184,   185,   186,   187,
+   186,   188,   189,   188,   190,   190,   191,   191,   192,   193,
+   193,   194,   194,   194,   194,   195,   196,   196,   197,   196,
+   196,   196,   196,   196,   196
 };
 
 static const short yyr2[] = {     0,
@@ -1076,206 +1086,210 @@ static const short yyr2[] = {     0,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-     3,     0,     6,     0,     6,     4,     4,     3,     3,     1,
-     2,     1,     2,     1,     2,     1,     2,     1,     0,     0,
-     6,     3,     2,     1,     2,     0,     5,     0,     6,     3,
-     1,     2,     1,     2,     1,     2,     1,     2,     2,     0,
-     5,     0,     6,     0,     6,     1,     2,     1,     1,     2,
-     2,     2,     2,     2,     2,     4,     1,     2,     1,     2,
-     2,     0,     3,     2,     2,     1,     2,     2,     1,     3,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     0,     3,     0,     3,     2,     2,     2,     1,
-     1,     1,     1,     2,     2,     2,     2,     2,     2,     1,
-     3,     0,     5,     2,     0,     6,     1,     2,     1,     1,
-     1,     4,     1,     3,     0,     5,     0,     8,     1,     2,
-     1,     1,     2,     2,     1,     1,     3,     3,     1,     3,
-     1,     3,     1,     1,     2,     0,     4,     2,     0,     4,
-     2,     0,     4,     2,     3,     2,     0,     4,     2,     0,
-     4,     2,     3,     3,     2,     0,     4,     2,     0,     4,
-     2,     3,     2,     3,     2,     2,     3,     1,     3,     3,
-     5,     2,     4,     4,     0,     5,     4,     3,     3,     3,
-     3
+     1,     0,     3,     0,     6,     0,     6,     4,     4,     3,
+     3,     1,     2,     1,     2,     1,     2,     1,     2,     1,
+     0,     0,     6,     3,     2,     1,     2,     0,     5,     0,
+     6,     3,     1,     2,     1,     2,     1,     2,     1,     2,
+     2,     0,     5,     0,     6,     0,     6,     1,     2,     1,
+     1,     2,     2,     2,     2,     2,     2,     4,     1,     2,
+     1,     2,     2,     0,     3,     2,     2,     1,     2,     2,
+     1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+     1,     1,     1,     1,     0,     3,     0,     3,     2,     2,
+     2,     2,     1,     1,     1,     1,     2,     2,     2,     2,
+     2,     2,     2,     1,     3,     0,     5,     2,     0,     6,
+     1,     2,     1,     1,     1,     4,     1,     3,     0,     5,
+     0,     8,     1,     2,     1,     1,     2,     2,     1,     1,
+     3,     3,     1,     3,     1,     3,     1,     1,     2,     0,
+     4,     2,     0,     4,     2,     0,     4,     2,     3,     2,
+     0,     4,     2,     0,     4,     2,     3,     3,     2,     0,
+     4,     2,     0,     4,     2,     3,     2,     3,     2,     2,
+     3,     1,     3,     3,     5,     2,     4,     4,     0,     5,
+     4,     3,     3,     3,     3
 };
 
 static const short yydefact[] = {     2,
-     0,     0,     0,     0,     0,     0,     0,     0,   143,   145,
-     0,     0,     0,     0,     0,     0,     0,     0,   119,   153,
-   152,    60,     0,   122,     0,     0,     0,     0,   117,   139,
-   141,   140,   142,   150,   151,     0,     0,     0,     1,     3,
-     7,    32,    30,     4,    58,    10,     8,     9,    11,    13,
-    34,    12,    14,    15,    18,    19,    20,    21,    22,    23,
-    24,    25,    27,    50,    51,    54,   108,    57,    59,    53,
-    31,    28,    29,    16,    17,   109,    55,    56,    35,    33,
-    36,    37,    38,    39,    40,    41,    42,    26,    43,    44,
-    45,    46,    47,    48,    49,    52,   193,   194,   158,   159,
-   148,   157,   183,   155,   156,     0,     0,     0,     0,   118,
-   149,   195,   201,   198,   204,   206,   209,   215,   218,   221,
-   223,   212,     0,   225,   226,   232,     0,   121,   112,   110,
-   111,   113,   120,     0,   114,   115,     0,     0,   124,   125,
-   127,   128,   184,   147,   154,     5,     6,    68,    62,    69,
-    64,   185,   186,   144,   146,     0,     0,     0,   205,     0,
-     0,     0,     0,   222,   224,   213,   214,   228,   227,   239,
-   241,   240,   238,   191,    61,     0,   131,   132,   133,   134,
-   135,   136,   137,   138,   123,   129,    66,     0,    67,     0,
-     0,   189,   197,   203,   200,   208,   211,   217,   220,     0,
-     0,   234,     0,   237,   233,     0,   116,     0,    91,    78,
-     0,   160,    70,     0,    74,    72,    76,     0,   187,   188,
-     0,   229,   230,   236,   192,   130,    86,    92,    79,   162,
-   164,    63,    71,    75,    73,    77,    65,   190,     0,    90,
-     0,    88,    82,     0,   161,     0,   165,   231,    97,    93,
-     0,    95,     0,     0,    80,    84,   173,   170,   171,     0,
-   167,   169,     0,    98,   100,    99,    87,    94,    96,     0,
-    85,     0,    83,     0,   175,   163,   168,     0,   102,     0,
-   104,    89,    81,     0,   174,     0,   166,     0,     0,   106,
-     0,   172,   182,   181,     0,   179,     0,   101,   107,     0,
-   177,   176,   180,   103,   105,     0,     0,   178,     0,     0,
-     0
+     0,     0,     0,     0,     0,     0,     0,     0,   145,   147,
+     0,     0,     0,     0,     0,     0,     0,     0,   121,   156,
+   155,    62,     0,   124,     0,     0,     0,     0,   119,   141,
+   143,   142,   144,   153,   154,     0,     0,     0,     0,     0,
+     1,     3,     7,    33,    30,     4,    60,    10,     8,     9,
+    11,    13,    35,    12,    14,    15,    18,    19,    20,    21,
+    22,    23,    24,    25,    27,    51,    52,    55,   110,    59,
+    56,    61,    54,    31,    28,    32,    29,    16,    17,   111,
+    57,    58,    36,    34,    37,    38,    39,    40,    41,    42,
+    43,    26,    44,    45,    46,    47,    48,    49,    50,    53,
+   197,   198,   162,   163,   150,   161,   187,   159,   160,     0,
+     0,     0,     0,   120,   151,   199,   205,   202,   208,   210,
+   213,   219,   222,   225,   227,   216,     0,   229,   230,   236,
+     0,   123,   114,   112,   113,   115,   122,     0,   116,   117,
+     0,     0,   126,   127,   129,   130,   188,   149,   158,   152,
+   157,     5,     6,    70,    64,    71,    66,   189,   190,   146,
+   148,     0,     0,     0,   209,     0,     0,     0,     0,   226,
+   228,   217,   218,   232,   231,   243,   245,   244,   242,   195,
+    63,     0,   133,   134,   135,   136,   137,   138,   139,   140,
+   125,   131,    68,     0,    69,     0,     0,   193,   201,   207,
+   204,   212,   215,   221,   224,     0,     0,   238,     0,   241,
+   237,     0,   118,     0,    93,    80,     0,   164,    72,     0,
+    76,    74,    78,     0,   191,   192,     0,   233,   234,   240,
+   196,   132,    88,    94,    81,   166,   168,    65,    73,    77,
+    75,    79,    67,   194,     0,    92,     0,    90,    84,     0,
+   165,     0,   169,   235,    99,    95,     0,    97,     0,     0,
+    82,    86,   177,   174,   175,     0,   171,   173,     0,   100,
+   102,   101,    89,    96,    98,     0,    87,     0,    85,     0,
+   179,   167,   172,     0,   104,     0,   106,    91,    83,     0,
+   178,     0,   170,     0,     0,   108,     0,   176,   186,   185,
+     0,   183,     0,   103,   109,     0,   181,   180,   184,   105,
+   107,     0,     0,   182,     0,     0,     0
 };
 
-static const short yydefgoto[] = {   309,
-    39,    40,    41,    42,    43,   134,    44,   188,   190,   214,
-   215,   244,   272,   255,   256,   216,   241,   253,   251,   252,
-   280,   288,   291,   289,    45,    46,    47,    48,    49,    50,
-    51,    52,    53,    54,    55,   138,    56,    57,    58,    59,
-   185,   186,    60,    61,    62,    63,    64,   108,    65,   109,
-    66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-    76,    77,    78,   217,   246,   263,   260,   261,   262,   286,
-   306,   295,   296,    79,    80,   154,   193,   175,   127,    81,
-   156,    82,   158,    83,   157,    84,    85,   160,    86,   161,
-    87,    88,    89,   162,    90,   163,    91,    92,    93,    94,
-   169,    95,    96,   203
+static const short yydefgoto[] = {   315,
+    41,    42,    43,    44,    45,   138,    46,   194,   196,   220,
+   221,   250,   278,   261,   262,   222,   247,   259,   257,   258,
+   286,   294,   297,   295,    47,    48,    49,    50,    51,    52,
+    53,    54,    55,    56,    57,   142,    58,    59,    60,    61,
+   191,   192,    62,    63,    64,    65,    66,   112,    67,   113,
+    68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+    78,    79,    80,    81,    82,   223,   252,   269,   266,   267,
+   268,   292,   312,   301,   302,    83,    84,   160,   199,   181,
+   131,    85,   162,    86,   164,    87,   163,    88,    89,   166,
+    90,   167,    91,    92,    93,   168,    94,   169,    95,    96,
+    97,    98,   175,    99,   100,   209
 };
 
-static const short yypact[] = {   113,
-   166,   166,   166,   166,   166,    -6,   166,   201,-32768,-32768,
-    13,   166,   218,    27,    72,   166,    77,   166,   166,-32768,
--32768,-32768,   202,-32768,   102,   104,   126,   137,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,   166,    54,   166,   113,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+static const short yypact[] = {   109,
+    54,    54,    54,    54,    54,   -26,    54,   207,-32768,-32768,
+    -6,    54,   281,    21,    46,    54,    62,    54,    54,-32768,
+-32768,-32768,   212,-32768,    82,    90,    99,   120,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,    54,   137,    54,    54,    54,
+   109,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,   -20,    22,    78,    78,-32768,
--32768,   122,   156,   162,   165,   181,   173,   214,   216,   209,
-   221,   224,   166,-32768,   166,-32768,   -12,-32768,-32768,-32768,
--32768,-32768,-32768,   247,-32768,-32768,   166,   270,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   138,-32768,
-   175,-32768,-32768,   172,   172,   257,   257,   247,-32768,   257,
-   247,   257,   257,-32768,-32768,-32768,-32768,   203,   206,   260,
-   262,   256,   255,-32768,   215,   258,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,   219,-32768,-32768,   190,-32768,   190,
-    97,-32768,   225,   225,   215,   225,   215,   225,   225,   166,
-   166,-32768,   257,-32768,-32768,   271,-32768,   270,    28,   220,
-   263,    57,-32768,     5,-32768,-32768,-32768,    17,-32768,-32768,
-   279,-32768,   227,   225,-32768,-32768,   231,   233,   235,   237,
-   239,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   166,-32768,
-   100,-32768,-32768,   294,-32768,    35,-32768,-32768,    82,-32768,
-    53,-32768,   100,   166,   294,-32768,    -3,-32768,-32768,    23,
--32768,-32768,    35,   241,-32768,   242,-32768,-32768,-32768,    58,
--32768,   243,-32768,   253,   244,-32768,-32768,    25,-32768,     9,
--32768,-32768,-32768,   166,-32768,     9,-32768,     9,    43,-32768,
-     9,   259,-32768,-32768,    44,-32768,    71,-32768,-32768,    91,
--32768,-32768,-32768,-32768,-32768,     9,    92,-32768,   341,   342,
--32768
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   -20,
+   -11,    17,    17,-32768,-32768,   157,   158,   153,   162,   178,
+   177,   200,   204,   210,   213,   232,    54,-32768,    54,-32768,
+    92,-32768,-32768,-32768,-32768,-32768,-32768,   233,-32768,-32768,
+    54,   265,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,   -65,-32768,   189,-32768,-32768,   192,
+   192,   244,   244,   233,-32768,   244,   233,   244,   244,-32768,
+-32768,-32768,-32768,   191,   195,   249,   251,   243,   241,-32768,
+   227,   256,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+   228,-32768,-32768,   194,-32768,   194,    86,-32768,   229,   229,
+   227,   229,   227,   229,   229,    54,    54,-32768,   244,-32768,
+-32768,   246,-32768,   265,   110,   234,   296,   132,-32768,     5,
+-32768,-32768,-32768,    16,-32768,-32768,   288,-32768,   245,   229,
+-32768,-32768,   235,   237,   247,   250,   252,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,    54,-32768,   205,-32768,-32768,   306,
+-32768,    57,-32768,-32768,    78,-32768,    22,-32768,   205,    54,
+   306,-32768,    15,-32768,-32768,    52,-32768,-32768,    57,   255,
+-32768,   257,-32768,-32768,-32768,    64,-32768,   258,-32768,   259,
+   260,-32768,-32768,    55,-32768,   253,-32768,-32768,-32768,    54,
+-32768,   253,-32768,   253,    23,-32768,   253,   263,-32768,-32768,
+    65,-32768,    71,-32768,-32768,   101,-32768,-32768,-32768,-32768,
+-32768,   253,   113,-32768,   342,   344,-32768
 };
 
 static const short yypgoto[] = {-32768,
--32768,   305,    32,     1,-32768,-32768,   306,-32768,-32768,   157,
-  -105,-32768,-32768,-32768,    93,   -56,-32768,-32768,    96,  -228,
--32768,-32768,-32768,   -86,    30,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,   142,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,   -94,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
-     2,    24,    36,   -51,-32768,-32768,    83,  -201,-32768,-32768,
--32768,    46,  -150,-32768,-32768,   245,    18,    45,    -1,-32768,
+-32768,   305,  -147,   -44,-32768,-32768,   309,-32768,-32768,   155,
+   -61,-32768,-32768,-32768,    91,   -47,-32768,-32768,    94,  -142,
+-32768,-32768,-32768,   -63,   -33,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,   140,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,   -85,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,   -66,   -28,   -27,   -35,-32768,-32768,    87,  -220,
+-32768,-32768,-32768,    43,  -176,-32768,-32768,   248,   -82,    81,
+    -1,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768
+-32768,-32768,-32768,-32768,-32768,-32768
 };
 
 
-#define	YYLAST		354
-
-
-static const short yytable[] = {    99,
-   100,   101,   102,   103,   148,   105,   107,     1,     2,     3,
-   111,     4,     5,     3,   130,     4,   132,   133,   170,     1,
-     2,     3,   269,     4,     5,     1,     2,     1,     2,   274,
-     9,    10,   209,   210,   143,   104,   145,     1,     2,    12,
-   211,   269,     9,    10,   209,   210,   150,     3,     3,     4,
-     4,    12,   211,   212,   110,     1,     2,     3,   277,     4,
-     1,     2,     3,   149,     4,   212,   171,   172,   128,   173,
-    97,    98,   257,    29,   257,     3,   277,     4,    34,    35,
-   275,    36,    37,   249,   257,    29,   144,    12,   249,   232,
-    34,    35,    12,    36,    37,     3,     3,     4,     4,    97,
-    98,   237,     1,     2,     3,   151,     4,   276,   234,   287,
-   152,   227,   234,   129,   264,     1,     2,     3,   131,     4,
-     5,   167,   153,   168,    97,    98,    34,   298,   302,   219,
-   249,    34,     6,     7,    12,   176,     8,   267,     9,    10,
-   230,   220,   282,   139,   303,   140,    11,    12,    13,    14,
-    15,    16,    17,    18,  -196,   304,   303,   235,    19,    20,
-    21,   235,   236,    22,    23,   265,   236,   141,    24,    25,
-    26,    27,    28,    34,   194,   305,   308,   196,   142,   198,
-   199,    29,    30,    31,    32,    33,    34,    35,  -202,    36,
-    37,   293,     1,     2,     3,    38,     4,     5,   222,   223,
-   293,   297,   195,  -199,   300,   197,   159,   228,    97,    98,
-   231,   293,   293,  -207,  -210,     9,    10,   209,   210,   213,
-   224,   213,   187,   112,    12,   211,   113,   114,   115,   116,
-   117,   118,   119,   120,   121,   122,   123,   248,   212,   124,
-   125,   250,   106,    97,    98,   233,  -216,   266,  -219,   233,
-   164,   268,   271,   250,   135,   136,   137,   191,    29,   189,
-    97,    98,   165,    34,    35,   166,    36,    37,   112,   258,
-   268,   113,   114,   115,   116,   117,   118,   119,   120,   121,
-   122,   259,   292,   258,   124,   125,   258,   294,   174,   192,
-   200,   201,   202,   126,  -235,   259,   294,   204,   259,   205,
-   206,   258,   207,   229,   208,    97,    98,   294,   294,   290,
-   221,   238,   225,   259,   239,   240,   242,   290,   299,   243,
-   290,   245,   247,   254,   279,   281,   299,   283,   285,   299,
-   177,   178,   179,   180,   181,   182,   183,   184,   126,   284,
-   310,   311,   301,   146,   147,   278,   218,   273,   270,   226,
-     0,   307,     0,   155
+#define	YYLAST		372
+
+
+static const short yytable[] = {   103,
+   104,   105,   106,   107,   154,   109,   111,     1,     2,     3,
+   115,     4,     5,   156,   134,   108,   136,   137,     1,     2,
+     3,   193,     4,     5,     1,     2,     3,     3,     4,     4,
+     9,    10,   215,   216,   147,   114,   149,   150,   151,    12,
+   217,     9,    10,   215,   216,   283,   219,   280,   219,   158,
+    12,   217,   255,   218,     1,     2,    12,     1,     2,     1,
+     2,   159,   132,   283,   218,   155,     1,     2,     3,     3,
+     4,     4,   239,    29,   157,     3,   239,     4,    34,    35,
+   200,    36,    37,   202,    29,   204,   205,   133,    39,    34,
+    35,   238,    36,    37,   255,    34,   101,   102,    12,    39,
+   281,   263,   243,   135,   263,     3,   263,     4,   273,   304,
+   270,     1,     2,     3,   275,     4,     5,     3,   225,     4,
+   101,   102,   176,   143,   309,   173,   230,   174,     6,     7,
+   226,   144,     8,   275,     9,    10,   309,    34,   282,   182,
+   145,   293,    11,    12,    13,    14,    15,    16,    17,    18,
+   288,   308,   101,   102,    19,    20,    21,   310,   240,    22,
+    23,   146,   240,   271,    24,    25,    26,    27,    28,   148,
+   177,   178,   241,   179,   101,   102,   241,    29,    30,    31,
+    32,    33,    34,    35,   242,    36,    37,   311,   242,  -200,
+  -206,    38,    39,    40,  -203,   233,     1,     2,     3,   314,
+     4,     5,   256,   165,   228,   229,   299,     1,     2,     3,
+  -211,     4,   274,   234,   256,   299,   237,   236,  -214,     9,
+    10,   215,   216,   264,   265,   300,   299,   299,    12,   217,
+   303,   274,  -220,   306,   300,   255,  -223,   264,   265,    12,
+   264,   265,   218,   254,   201,   300,   300,   203,   110,   101,
+   102,   170,   296,   272,   171,   264,   265,     3,   277,     4,
+   296,   305,    29,   296,   139,   140,   141,    34,    35,   305,
+    36,    37,   305,   172,   180,   195,   198,    39,    34,   197,
+   206,   208,   207,  -239,   210,   211,   116,   231,   298,   117,
+   118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+   213,   116,   128,   129,   117,   118,   119,   120,   121,   122,
+   123,   124,   125,   126,   212,   214,   227,   128,   129,   235,
+   244,   246,   248,   101,   102,   183,   184,   185,   186,   187,
+   188,   189,   190,   249,   245,   260,   251,   253,   101,   102,
+   285,   316,   287,   317,   289,   152,   291,   290,   307,   153,
+   224,   279,   276,   232,   313,   284,   130,     0,     0,     0,
+   161,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     0,   130
 };
 
 static const short yycheck[] = {     1,
      2,     3,     4,     5,    25,     7,     8,     3,     4,     5,
-    12,     7,     8,     5,    16,     7,    18,    19,    31,     3,
-     4,     5,   251,     7,     8,     3,     4,     3,     4,    33,
-    26,    27,    28,    29,    36,    42,    38,     3,     4,    35,
-    36,   270,    26,    27,    28,    29,    25,     5,     5,     7,
-     7,    35,    36,    49,    42,     3,     4,     5,   260,     7,
-     3,     4,     5,    84,     7,    49,    79,    80,    42,    82,
-    43,    44,    50,    69,    50,     5,   278,     7,    74,    75,
-    84,    77,    78,    31,    50,    69,    33,    35,    31,    85,
-    74,    75,    35,    77,    78,     5,     5,     7,     7,    43,
-    44,    85,     3,     4,     5,    84,     7,    85,   214,    85,
-    33,    84,   218,    42,    33,     3,     4,     5,    42,     7,
-     8,   123,    45,   125,    43,    44,    74,    85,    85,    33,
-    31,    74,    20,    21,    35,   137,    24,    85,    26,    27,
-    84,    45,    85,    42,   295,    42,    34,    35,    36,    37,
-    38,    39,    40,    41,    33,    85,   307,   214,    46,    47,
-    48,   218,   214,    51,    52,    84,   218,    42,    56,    57,
-    58,    59,    60,    74,   157,    85,    85,   160,    42,   162,
-   163,    69,    70,    71,    72,    73,    74,    75,    33,    77,
-    78,   286,     3,     4,     5,    83,     7,     8,   200,   201,
-   295,   288,   158,    42,   291,   161,    42,   209,    43,    44,
-   212,   306,   307,    33,    42,    26,    27,    28,    29,   188,
-   203,   190,    85,     6,    35,    36,     9,    10,    11,    12,
-    13,    14,    15,    16,    17,    18,    19,   239,    49,    22,
-    23,   241,    42,    43,    44,   214,    33,   249,    33,   218,
-    42,   251,   254,   253,    53,    54,    55,    86,    69,    85,
-    43,    44,    42,    74,    75,    42,    77,    78,     6,   246,
-   270,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-    18,   246,   284,   260,    22,    23,   263,   286,    42,    33,
-    88,    86,    33,    76,    33,   260,   295,    42,   263,    45,
-    86,   278,    45,    84,    86,    43,    44,   306,   307,   280,
-    86,    33,    42,   278,    88,    85,    84,   288,   289,    85,
-   291,    85,    84,    30,    84,    84,   297,    85,    85,   300,
-    61,    62,    63,    64,    65,    66,    67,    68,    76,    87,
-     0,     0,    84,    39,    39,   263,   190,   255,   253,   208,
-    -1,   306,    -1,   109
+    12,     7,     8,    25,    16,    42,    18,    19,     3,     4,
+     5,    87,     7,     8,     3,     4,     5,     5,     7,     7,
+    26,    27,    28,    29,    36,    42,    38,    39,    40,    35,
+    36,    26,    27,    28,    29,   266,   194,    33,   196,    33,
+    35,    36,    31,    49,     3,     4,    35,     3,     4,     3,
+     4,    45,    42,   284,    49,    86,     3,     4,     5,     5,
+     7,     7,   220,    69,    86,     5,   224,     7,    74,    75,
+   163,    77,    78,   166,    69,   168,   169,    42,    84,    74,
+    75,    87,    77,    78,    31,    74,    43,    44,    35,    84,
+    86,    50,    87,    42,    50,     5,    50,     7,    87,    87,
+    33,     3,     4,     5,   257,     7,     8,     5,    33,     7,
+    43,    44,    31,    42,   301,   127,   209,   129,    20,    21,
+    45,    42,    24,   276,    26,    27,   313,    74,    87,   141,
+    42,    87,    34,    35,    36,    37,    38,    39,    40,    41,
+    87,    87,    43,    44,    46,    47,    48,    87,   220,    51,
+    52,    42,   224,    86,    56,    57,    58,    59,    60,    33,
+    79,    80,   220,    82,    43,    44,   224,    69,    70,    71,
+    72,    73,    74,    75,   220,    77,    78,    87,   224,    33,
+    33,    83,    84,    85,    42,    86,     3,     4,     5,    87,
+     7,     8,   247,    42,   206,   207,   292,     3,     4,     5,
+    33,     7,   257,   215,   259,   301,   218,    86,    42,    26,
+    27,    28,    29,   252,   252,   292,   312,   313,    35,    36,
+   294,   276,    33,   297,   301,    31,    33,   266,   266,    35,
+   269,   269,    49,   245,   164,   312,   313,   167,    42,    43,
+    44,    42,   286,   255,    42,   284,   284,     5,   260,     7,
+   294,   295,    69,   297,    53,    54,    55,    74,    75,   303,
+    77,    78,   306,    42,    42,    87,    33,    84,    74,    88,
+    90,    33,    88,    33,    42,    45,     6,    42,   290,     9,
+    10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+    45,     6,    22,    23,     9,    10,    11,    12,    13,    14,
+    15,    16,    17,    18,    88,    88,    88,    22,    23,    86,
+    33,    87,    86,    43,    44,    61,    62,    63,    64,    65,
+    66,    67,    68,    87,    90,    30,    87,    86,    43,    44,
+    86,     0,    86,     0,    87,    41,    87,    89,    86,    41,
+   196,   261,   259,   214,   312,   269,    76,    -1,    -1,    -1,
+   113,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    -1,    76
 };
 
 #line 352 "../bison++/bison.cc"
@@ -1772,35 +1786,35 @@ YYLABEL(yyreduce)
 
   switch (yyn) {
 
-case 60:
-#line 219 "ClntParser.y"
+case 62:
+#line 222 "ClntParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 61:
-#line 221 "ClntParser.y"
+case 63:
+#line 224 "ClntParser.y"
 {
     CfgMgr->setDownlinkPrefixIfaces(PresentStringLst);
 ;
     break;}
-case 62:
-#line 230 "ClntParser.y"
+case 64:
+#line 233 "ClntParser.y"
 {
     if (!StartIfaceDeclaration(yyvsp[-1].strval))
 	YYABORT;
 ;
     break;}
-case 63:
-#line 235 "ClntParser.y"
+case 65:
+#line 238 "ClntParser.y"
 {
     delete [] yyvsp[-4].strval;
     if (!EndIfaceDeclaration())
 	YYABORT;
 ;
     break;}
-case 64:
-#line 245 "ClntParser.y"
+case 66:
+#line 248 "ClntParser.y"
 {
     if (!IfaceDefined(yyvsp[-1].ival))
 	YYABORT;
@@ -1808,15 +1822,15 @@ case 64:
 	YYABORT;
 ;
     break;}
-case 65:
-#line 252 "ClntParser.y"
+case 67:
+#line 255 "ClntParser.y"
 {
     if (!EndIfaceDeclaration())
 	YYABORT;
 ;
     break;}
-case 66:
-#line 261 "ClntParser.y"
+case 68:
+#line 264 "ClntParser.y"
 {
     if (!IfaceDefined(string(yyvsp[-2].strval)))
 	YYABORT;
@@ -1825,8 +1839,8 @@ case 66:
     EmptyIface();
 ;
     break;}
-case 67:
-#line 273 "ClntParser.y"
+case 69:
+#line 276 "ClntParser.y"
 {
     if (!IfaceDefined(yyvsp[-2].ival))
 	YYABORT;
@@ -1834,8 +1848,8 @@ case 67:
     EmptyIface();
 ;
     break;}
-case 68:
-#line 284 "ClntParser.y"
+case 70:
+#line 287 "ClntParser.y"
 {
     if (!IfaceDefined(string(yyvsp[-1].strval)))
 	YYABORT;
@@ -1845,8 +1859,8 @@ case 68:
     delete yyvsp[-1].strval;
 ;
     break;}
-case 69:
-#line 297 "ClntParser.y"
+case 71:
+#line 300 "ClntParser.y"
 {
     if (!IfaceDefined(yyvsp[-1].ival))
 	YYABORT;
@@ -1855,8 +1869,8 @@ case 69:
     ClntCfgIfaceLst.getLast()->setNoConfig();
 ;
     break;}
-case 78:
-#line 325 "ClntParser.y"
+case 80:
+#line 328 "ClntParser.y"
 {
     if (!ParserOptStack.getLast()->getStateful()) {
         Log(Crit) << "Attempted to use TA (stateful option) in stateless mode." << LogEnd;
@@ -1866,8 +1880,8 @@ case 78:
     this->ClntCfgTALst.append( new TClntCfgTA() ); // append new TA
 ;
     break;}
-case 79:
-#line 334 "ClntParser.y"
+case 81:
+#line 337 "ClntParser.y"
 {
     if (!ParserOptStack.getLast()->getStateful()) {
         Log(Crit) << "Attempted to use TA (stateful option) in stateless mode." << LogEnd;
@@ -1878,15 +1892,15 @@ case 79:
     this->iaidSet = false;
 ;
     break;}
-case 80:
-#line 344 "ClntParser.y"
+case 82:
+#line 347 "ClntParser.y"
 {
     if (this->iaidSet)
 	this->ClntCfgTALst.getLast()->setIAID(this->iaid);
 ;
     break;}
-case 82:
-#line 350 "ClntParser.y"
+case 84:
+#line 353 "ClntParser.y"
 {
     if (!ParserOptStack.getLast()->getStateful()) {
         Log(Crit) << "Attempted to use TA (stateful option) in stateless mode." << LogEnd;
@@ -1896,30 +1910,30 @@ case 82:
     this->ClntCfgTALst.append( new TClntCfgTA() ); // append new TA
 ;
     break;}
-case 85:
-#line 367 "ClntParser.y"
+case 87:
+#line 370 "ClntParser.y"
 {
     this->iaidSet = true;
     this->iaid = yyvsp[0].ival;
     Log(Crit) << "IAID=" << this->iaid << " parsed." << LogEnd;
 ;
     break;}
-case 86:
-#line 379 "ClntParser.y"
+case 88:
+#line 382 "ClntParser.y"
 {
     if (!StartIADeclaration(false)) {
         YYABORT;
     }
 ;
     break;}
-case 87:
-#line 385 "ClntParser.y"
+case 89:
+#line 388 "ClntParser.y"
 {
     EndIADeclaration();
 ;
     break;}
-case 88:
-#line 390 "ClntParser.y"
+case 90:
+#line 393 "ClntParser.y"
 {
     if (!StartIADeclaration(false)) {
         YYABORT;
@@ -1927,16 +1941,16 @@ case 88:
     this->iaid = yyvsp[-1].ival;
 ;
     break;}
-case 89:
-#line 397 "ClntParser.y"
+case 91:
+#line 400 "ClntParser.y"
 {
     EndIADeclaration();
     Log(Info) << "Setting IAID to " << this->iaid << LogEnd;
     ClntCfgIALst.getLast()->setIAID(this->iaid);
 ;
     break;}
-case 90:
-#line 407 "ClntParser.y"
+case 92:
+#line 410 "ClntParser.y"
 {
     if (!StartIADeclaration(true)) {
         YYABORT;
@@ -1944,8 +1958,8 @@ case 90:
     EndIADeclaration();
 ;
     break;}
-case 91:
-#line 418 "ClntParser.y"
+case 93:
+#line 421 "ClntParser.y"
 {
     if (!StartIADeclaration(true)) {
         YYABORT;
@@ -1953,8 +1967,8 @@ case 91:
     EndIADeclaration();
 ;
     break;}
-case 92:
-#line 426 "ClntParser.y"
+case 94:
+#line 429 "ClntParser.y"
 {
     if (!StartIADeclaration(true)) {
         YYABORT;
@@ -1964,29 +1978,29 @@ case 92:
     ClntCfgIALst.getLast()->setIAID(yyvsp[0].ival);
 ;
     break;}
-case 97:
-#line 455 "ClntParser.y"
+case 99:
+#line 458 "ClntParser.y"
 {
     EmptyAddr();
 ;
     break;}
-case 98:
-#line 460 "ClntParser.y"
+case 100:
+#line 463 "ClntParser.y"
 {
     ClntCfgAddrLst.append(new TClntCfgAddr(new TIPv6Addr(yyvsp[0].addrval)));
     ClntCfgAddrLst.getLast()->setOptions(ParserOptStack.getLast());
 ;
     break;}
-case 99:
-#line 467 "ClntParser.y"
+case 101:
+#line 470 "ClntParser.y"
 {
     for (int i = 0; i < yyvsp[0].ival; i++) {
         EmptyAddr();
     }
 ;
     break;}
-case 100:
-#line 475 "ClntParser.y"
+case 102:
+#line 478 "ClntParser.y"
 {
     // Get last context
     SPtr<TClntParsGlobalOpt> globalOpt = ParserOptStack.getLast();
@@ -1998,15 +2012,15 @@ case 100:
     ParserOptStack.append(newOpt);
 ;
     break;}
-case 101:
-#line 486 "ClntParser.y"
+case 103:
+#line 489 "ClntParser.y"
 {
     EmptyAddr(); // Create an empty address
     ParserOptStack.delLast(); // Delete new context
 ;
     break;}
-case 102:
-#line 493 "ClntParser.y"
+case 104:
+#line 496 "ClntParser.y"
 {
     // We need to store just one address, but let's use PresentAddrLst
     // We'll need that address to create an actual object when the context is closed
@@ -2018,8 +2032,8 @@ case 102:
     ParserOptStack.append(newOpt);
 ;
     break;}
-case 103:
-#line 504 "ClntParser.y"
+case 105:
+#line 507 "ClntParser.y"
 {
     ClntCfgAddrLst.append(new TClntCfgAddr(PresentAddrLst.getLast()));
     ClntCfgAddrLst.getLast()->setOptions(ParserOptStack.getLast());
@@ -2028,8 +2042,8 @@ case 103:
     PresentAddrLst.clear();
 ;
     break;}
-case 104:
-#line 514 "ClntParser.y"
+case 106:
+#line 517 "ClntParser.y"
 {
     //In this agregated declaration no address hints are allowed
     ParserOptStack.append(new TClntParsGlobalOpt(*ParserOptStack.getLast()));
@@ -2038,8 +2052,8 @@ case 104:
     AddrCount_ = yyvsp[-1].ival;
 ;
     break;}
-case 105:
-#line 522 "ClntParser.y"
+case 107:
+#line 525 "ClntParser.y"
 {
     for (unsigned int i = 0; i < AddrCount_; i++) {
         EmptyAddr();
@@ -2049,8 +2063,8 @@ case 105:
     AddrCount_ = 0;
 ;
     break;}
-case 110:
-#line 544 "ClntParser.y"
+case 112:
+#line 547 "ClntParser.y"
 {
     if ( (yyvsp[0].ival<1) || (yyvsp[0].ival>8) ) {
 	Log(Crit) << "Invalid loglevel specified: " << yyvsp[0].ival << ". Allowed range: 1-8." << LogEnd;
@@ -2058,42 +2072,42 @@ case 110:
     logger::setLogLevel(yyvsp[0].ival);
 ;
     break;}
-case 111:
-#line 553 "ClntParser.y"
+case 113:
+#line 556 "ClntParser.y"
 {
     logger::setLogMode(yyvsp[0].strval);
 ;
     break;}
-case 112:
-#line 558 "ClntParser.y"
+case 114:
+#line 561 "ClntParser.y"
 {
     logger::setLogName(yyvsp[0].strval);
 ;
     break;}
-case 113:
-#line 564 "ClntParser.y"
+case 115:
+#line 567 "ClntParser.y"
 {
     logger::setColors(yyvsp[0].ival==1);
 ;
     break;}
-case 114:
-#line 569 "ClntParser.y"
+case 116:
+#line 572 "ClntParser.y"
 { this->DUIDType  = DUID_TYPE_LLT;;
     break;}
-case 115:
-#line 570 "ClntParser.y"
+case 117:
+#line 573 "ClntParser.y"
 { this->DUIDType  = DUID_TYPE_LL; ;
     break;}
-case 116:
-#line 571 "ClntParser.y"
+case 118:
+#line 574 "ClntParser.y"
 {
   this->DUIDType       = DUID_TYPE_EN;
   this->DUIDEnterpriseNumber = yyvsp[-1].ival;
   this->DUIDEnterpriseID     = new TDUID(yyvsp[0].duidval.duid, yyvsp[0].duidval.length);
 ;
     break;}
-case 117:
-#line 580 "ClntParser.y"
+case 119:
+#line 583 "ClntParser.y"
 {
     if (!ClntCfgIALst.empty()) {
         Log(Crit) << "Attempting to enable statelss, but IA (stateful option) is already defined." << LogEnd;
@@ -2113,14 +2127,14 @@ case 117:
     ParserOptStack.getLast()->setStateful(false);
 ;
     break;}
-case 118:
-#line 602 "ClntParser.y"
+case 120:
+#line 605 "ClntParser.y"
 {
     ParserOptStack.getLast()->setWorkDir(yyvsp[0].strval);
 ;
     break;}
-case 119:
-#line 609 "ClntParser.y"
+case 121:
+#line 612 "ClntParser.y"
 {
     Log(Warning) << "strict-rfc-no-routing has changed in 1.0.0RC2: it now takes one argument: "
                  << " 0 (address configured with guessed /64 prefix length that may be wrong in "
@@ -2129,8 +2143,8 @@ case 119:
                  << "Dibbler is now RFC conformant." << LogEnd;
 ;
     break;}
-case 120:
-#line 617 "ClntParser.y"
+case 122:
+#line 620 "ClntParser.y"
 {
     switch (yyvsp[0].ival) {
     case 0:
@@ -2151,20 +2165,20 @@ case 120:
     }
 ;
     break;}
-case 121:
-#line 640 "ClntParser.y"
+case 123:
+#line 643 "ClntParser.y"
 {
     CfgMgr->setScript(yyvsp[0].strval);
 ;
     break;}
-case 122:
-#line 646 "ClntParser.y"
+case 124:
+#line 649 "ClntParser.y"
 {
     DigestLst.clear();
 ;
     break;}
-case 123:
-#line 648 "ClntParser.y"
+case 125:
+#line 651 "ClntParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     CfgMgr->setAuthAcceptMethods(DigestLst);
@@ -2174,8 +2188,8 @@ case 123:
 #endif
 ;
     break;}
-case 124:
-#line 658 "ClntParser.y"
+case 126:
+#line 661 "ClntParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     if (!strcasecmp(yyvsp[0].strval,"none")) {
@@ -2197,8 +2211,8 @@ case 124:
 #endif
 ;
     break;}
-case 125:
-#line 680 "ClntParser.y"
+case 127:
+#line 683 "ClntParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     Log(Crit) << "auth-algorithm selection is not supported yet." << LogEnd;
@@ -2208,8 +2222,8 @@ case 125:
 #endif
 ;
     break;}
-case 127:
-#line 691 "ClntParser.y"
+case 129:
+#line 694 "ClntParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     if (strcasecmp(yyvsp[0].strval, "none")) {
@@ -2225,8 +2239,8 @@ case 127:
 #endif
 ;
     break;}
-case 128:
-#line 707 "ClntParser.y"
+case 130:
+#line 710 "ClntParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     CfgMgr->setAuthRealm(std::string(yyvsp[0].strval));
@@ -2235,108 +2249,114 @@ case 128:
 #endif
 ;
     break;}
-case 131:
-#line 721 "ClntParser.y"
+case 133:
+#line 724 "ClntParser.y"
 { DigestLst.push_back(DIGEST_NONE); ;
     break;}
-case 132:
-#line 722 "ClntParser.y"
+case 134:
+#line 725 "ClntParser.y"
 { DigestLst.push_back(DIGEST_PLAIN); ;
     break;}
-case 133:
-#line 723 "ClntParser.y"
+case 135:
+#line 726 "ClntParser.y"
 { DigestLst.push_back(DIGEST_HMAC_MD5); ;
     break;}
-case 134:
-#line 724 "ClntParser.y"
+case 136:
+#line 727 "ClntParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA1); ;
     break;}
-case 135:
-#line 725 "ClntParser.y"
+case 137:
+#line 728 "ClntParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA224); ;
     break;}
-case 136:
-#line 726 "ClntParser.y"
+case 138:
+#line 729 "ClntParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA256); ;
     break;}
-case 137:
-#line 727 "ClntParser.y"
+case 139:
+#line 730 "ClntParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA384); ;
     break;}
-case 138:
-#line 728 "ClntParser.y"
+case 140:
+#line 731 "ClntParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA512); ;
     break;}
-case 139:
-#line 733 "ClntParser.y"
+case 141:
+#line 736 "ClntParser.y"
 {
     ParserOptStack.getLast()->setAnonInfRequest(true);
 ;
     break;}
-case 140:
-#line 739 "ClntParser.y"
+case 142:
+#line 742 "ClntParser.y"
 {
     ParserOptStack.getLast()->setInactiveMode(true);
 ;
     break;}
-case 141:
-#line 745 "ClntParser.y"
+case 143:
+#line 748 "ClntParser.y"
 {
     ParserOptStack.getLast()->setInsistMode(true);
 ;
     break;}
-case 142:
-#line 751 "ClntParser.y"
+case 144:
+#line 754 "ClntParser.y"
 {
     Log(Crit) << "Experimental features are allowed." << LogEnd;
     ParserOptStack.getLast()->setExperimental();
 ;
     break;}
-case 143:
-#line 758 "ClntParser.y"
+case 145:
+#line 761 "ClntParser.y"
 {
     //ParserOptStack.getLast()->clearRejedSrv();
     PresentStationLst.clear();
 ;
     break;}
-case 144:
-#line 762 "ClntParser.y"
+case 146:
+#line 765 "ClntParser.y"
 {
     ParserOptStack.getLast()->setRejedSrvLst(&PresentStationLst);
 ;
     break;}
-case 145:
-#line 769 "ClntParser.y"
+case 147:
+#line 772 "ClntParser.y"
 {
     PresentStationLst.clear();
 ;
     break;}
-case 146:
-#line 771 "ClntParser.y"
+case 148:
+#line 774 "ClntParser.y"
 {
     ParserOptStack.getLast()->setPrefSrvLst(&PresentStationLst);
 ;
     break;}
-case 147:
-#line 778 "ClntParser.y"
+case 149:
+#line 781 "ClntParser.y"
 {
     ClntCfgIfaceLst.getLast()->setBindToAddr(SPtr<TIPv6Addr>(new TIPv6Addr(yyvsp[0].addrval)));
 ;
     break;}
-case 148:
-#line 784 "ClntParser.y"
+case 150:
+#line 787 "ClntParser.y"
 {
     ParserOptStack.getLast()->setPref(yyvsp[0].ival);
 ;
     break;}
-case 149:
-#line 791 "ClntParser.y"
+case 151:
+#line 794 "ClntParser.y"
 {
     ParserOptStack.getLast()->setRapidCommit(yyvsp[0].ival);
 ;
     break;}
-case 150:
-#line 798 "ClntParser.y"
+case 152:
+#line 801 "ClntParser.y"
+{
+    ParserOptStack.getLast()->setRenewCoalesce(yyvsp[0].ival);
+;
+    break;}
+case 153:
+#line 808 "ClntParser.y"
 {
 	if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental 'addr-params' defined, but experimental features are disabled."
@@ -2346,8 +2366,8 @@ case 150:
     ParserOptStack.getLast()->setAddrParams(true);
 ;
     break;}
-case 151:
-#line 809 "ClntParser.y"
+case 154:
+#line 819 "ClntParser.y"
 {
     if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental remote autoconfiguration feature defined, but experimental"
@@ -2362,29 +2382,37 @@ case 151:
 #endif
 ;
     break;}
-case 152:
-#line 825 "ClntParser.y"
+case 155:
+#line 835 "ClntParser.y"
 {
     Log(Debug) << "Obeying Router Advertisement (M, O) bits." << LogEnd;
     CfgMgr->obeyRaBits(true);
 ;
     break;}
-case 153:
-#line 832 "ClntParser.y"
+case 156:
+#line 842 "ClntParser.y"
 {
     Log(Debug) << "CONFIRM support disabled (skip-confirm in client.conf)." << LogEnd;
     ParserOptStack.getLast()->setConfirm(false);
 ;
     break;}
-case 154:
-#line 839 "ClntParser.y"
+case 157:
+#line 849 "ClntParser.y"
+{
+    Log(Debug) << "First transmission will be delayed by up to " << yyvsp[0].ival
+               << " second(s) (startup-spread)." << LogEnd;
+    CfgMgr->setStartupSpread(yyvsp[0].ival);
+;
+    break;}
+case 158:
+#line 857 "ClntParser.y"
 {
     Log(Debug) << "Reconfigure accept " << ((yyvsp[0].ival>0)?"enabled":"disabled") << "." << LogEnd;
     CfgMgr->setReconfigure(yyvsp[0].ival);
 ;
     break;}
-case 155:
-#line 846 "ClntParser.y"
+case 159:
+#line 864 "ClntParser.y"
 {
     if (!strcasecmp(yyvsp[0].strval,"tcp"))
 	CfgMgr->setDDNSProtocol(TCfgMgr::DNSUPDATE_TCP);
@@ -2400,33 +2428,33 @@ case 155:
     Log(Debug) << "DDNS: Setting protocol to " << (yyvsp[0].strval) << LogEnd;
 ;
     break;}
-case 156:
-#line 863 "ClntParser.y"
+case 160:
+#line 881 "ClntParser.y"
 {
     Log(Debug) << "DDNS: Setting timeout to " << yyvsp[0].ival << "ms." << LogEnd;
     CfgMgr->setDDNSTimeout(yyvsp[0].ival);
 ;
     break;}
-case 157:
-#line 871 "ClntParser.y"
+case 161:
+#line 889 "ClntParser.y"
 {
     ParserOptStack.getLast()->setValid(yyvsp[0].ival);
 ;
     break;}
-case 158:
-#line 878 "ClntParser.y"
+case 162:
+#line 896 "ClntParser.y"
 {
     ParserOptStack.getLast()->setT1(yyvsp[0].ival);
 ;
     break;}
-case 159:
-#line 885 "ClntParser.y"
+case 163:
+#line 903 "ClntParser.y"
 {
     ParserOptStack.getLast()->setT2(yyvsp[0].ival);
 ;
     break;}
-case 160:
-#line 892 "ClntParser.y"
+case 164:
+#line 910 "ClntParser.y"
 {
     Log(Debug) << "Prefix delegation option (no parameters) found." << LogEnd;
     if (!StartPDDeclaration()) {
@@ -2435,8 +2463,8 @@ case 160:
     EndPDDeclaration();
 ;
     break;}
-case 161:
-#line 900 "ClntParser.y"
+case 165:
+#line 918 "ClntParser.y"
 {
     Log(Debug) << "Prefix delegation option (empty scope) found." << LogEnd;
     if (!StartPDDeclaration()) {
@@ -2445,8 +2473,8 @@ case 161:
     EndPDDeclaration();
 ;
     break;}
-case 162:
-#line 908 "ClntParser.y"
+case 166:
+#line 926 "ClntParser.y"
 {
     Log(Debug) << "Prefix delegation option (with scope) found." << LogEnd;
     if (!StartPDDeclaration()) {
@@ -2454,14 +2482,14 @@ case 162:
     }
 ;
     break;}
-case 163:
-#line 915 "ClntParser.y"
+case 167:
+#line 933 "ClntParser.y"
 {
     EndPDDeclaration();
 ;
     break;}
-case 164:
-#line 919 "ClntParser.y"
+case 168:
+#line 937 "ClntParser.y"
 {
     Log(Debug) << "Prefix delegation option (with IAID set to " << yyvsp[0].ival << " found." << LogEnd;
     if (!StartPDDeclaration()) {
@@ -2471,8 +2499,8 @@ case 164:
     ClntCfgPDLst.getLast()->setIAID(yyvsp[0].ival);
 ;
     break;}
-case 165:
-#line 928 "ClntParser.y"
+case 169:
+#line 946 "ClntParser.y"
 {
     if (!StartPDDeclaration()) {
         YYABORT;
@@ -2480,15 +2508,15 @@ case 165:
     this->iaid = yyvsp[-1].ival;
 ;
     break;}
-case 166:
-#line 935 "ClntParser.y"
+case 170:
+#line 953 "ClntParser.y"
 {
     EndPDDeclaration();
     ClntCfgPDLst.getLast()->setIAID(yyvsp[-4].ival);
 ;
     break;}
-case 172:
-#line 956 "ClntParser.y"
+case 176:
+#line 974 "ClntParser.y"
 {
     SPtr<TIPv6Addr> addr = new TIPv6Addr(yyvsp[-2].addrval);
     SPtr<TClntCfgPrefix> prefix = new TClntCfgPrefix(addr, (yyvsp[0].ival));
@@ -2496,29 +2524,29 @@ case 172:
     Log(Debug) << "PD: Adding single prefix " << addr->getPlain() << "/" << (yyvsp[0].ival) << "." << LogEnd;
 ;
     break;}
-case 173:
-#line 963 "ClntParser.y"
+case 177:
+#line 981 "ClntParser.y"
 {
     Log(Debug) << "PD: Adding single prefix." << LogEnd;
     SPtr<TClntCfgPrefix> prefix = new TClntCfgPrefix(new TIPv6Addr("::",true), 0);
     PrefixLst.append(prefix);
 ;
     break;}
-case 174:
-#line 970 "ClntParser.y"
+case 178:
+#line 988 "ClntParser.y"
 {
     Log(Debug) << "PD: Adding single prefix." << LogEnd;
     SPtr<TClntCfgPrefix> prefix = new TClntCfgPrefix(new TIPv6Addr("::",true), 0);
     PrefixLst.append(prefix);
 ;
     break;}
-case 175:
-#line 977 "ClntParser.y"
+case 179:
+#line 995 "ClntParser.y"
 {
 ;
     break;}
-case 176:
-#line 980 "ClntParser.y"
+case 180:
+#line 998 "ClntParser.y"
 {
     Log(Debug) << "PD: Adding single (any) prefix." << LogEnd;
     SPtr<TClntCfgPrefix> prefix = new TClntCfgPrefix(new TIPv6Addr("::",true), 0);
@@ -2526,8 +2554,8 @@ case 176:
     PrefixLst.append(prefix);
 ;
     break;}
-case 177:
-#line 988 "ClntParser.y"
+case 181:
+#line 1006 "ClntParser.y"
 {
     SPtr<TIPv6Addr> addr = new TIPv6Addr(yyvsp[-3].addrval);
     SPtr<TClntCfgPrefix> prefix = new TClntCfgPrefix(addr, (yyvsp[-1].ival));
@@ -2535,14 +2563,14 @@ case 177:
     Log(Debug) << "PD: Adding single prefix " << addr->getPlain() << "/" << (yyvsp[-1].ival) << "." << LogEnd;
 ;
     break;}
-case 178:
-#line 995 "ClntParser.y"
+case 182:
+#line 1013 "ClntParser.y"
 {
     PrefixLst.getLast()->setOptions(ParserOptStack.getLast());
 ;
     break;}
-case 183:
-#line 1012 "ClntParser.y"
+case 187:
+#line 1030 "ClntParser.y"
 {
     switch(yyvsp[0].ival) {
     case 0:
@@ -2558,8 +2586,8 @@ case 183:
     }
 ;
     break;}
-case 184:
-#line 1030 "ClntParser.y"
+case 188:
+#line 1048 "ClntParser.y"
 {
     switch(yyvsp[0].ival) {
     case 0:
@@ -2575,166 +2603,166 @@ case 184:
     }
 ;
     break;}
-case 185:
-#line 1047 "ClntParser.y"
+case 189:
+#line 1065 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<THostID> (new THostID(new TIPv6Addr(yyvsp[0].addrval))));
 ;
     break;}
-case 186:
-#line 1051 "ClntParser.y"
+case 190:
+#line 1069 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<THostID> (new THostID(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length))));
 ;
     break;}
-case 187:
-#line 1055 "ClntParser.y"
+case 191:
+#line 1073 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<THostID> (new THostID(new TIPv6Addr(yyvsp[0].addrval))));
 ;
     break;}
-case 188:
-#line 1059 "ClntParser.y"
+case 192:
+#line 1077 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<THostID> (new THostID( new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length))));
 ;
     break;}
-case 189:
-#line 1065 "ClntParser.y"
+case 193:
+#line 1083 "ClntParser.y"
 {PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr(yyvsp[0].addrval)));;
     break;}
-case 190:
-#line 1066 "ClntParser.y"
+case 194:
+#line 1084 "ClntParser.y"
 {PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr(yyvsp[0].addrval)));;
     break;}
-case 191:
-#line 1070 "ClntParser.y"
+case 195:
+#line 1088 "ClntParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 192:
-#line 1071 "ClntParser.y"
+case 196:
+#line 1089 "ClntParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 193:
-#line 1074 "ClntParser.y"
+case 197:
+#line 1092 "ClntParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 194:
-#line 1075 "ClntParser.y"
+case 198:
+#line 1093 "ClntParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 195:
-#line 1083 "ClntParser.y"
+case 199:
+#line 1101 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setDNSServerLst(&PresentAddrLst);
 ;
     break;}
-case 196:
-#line 1089 "ClntParser.y"
+case 200:
+#line 1107 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 197:
-#line 1092 "ClntParser.y"
+case 201:
+#line 1110 "ClntParser.y"
 {
     ParserOptStack.getLast()->setDNSServerLst(&PresentAddrLst);
 ;
     break;}
-case 198:
-#line 1102 "ClntParser.y"
+case 202:
+#line 1120 "ClntParser.y"
 {
     PresentStringLst.clear();
     ParserOptStack.getLast()->setDomainLst(&PresentStringLst);
 ;
     break;}
-case 199:
-#line 1106 "ClntParser.y"
+case 203:
+#line 1124 "ClntParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 200:
-#line 1109 "ClntParser.y"
+case 204:
+#line 1127 "ClntParser.y"
 {
     ParserOptStack.getLast()->setDomainLst(&PresentStringLst);
 ;
     break;}
-case 201:
-#line 1119 "ClntParser.y"
+case 205:
+#line 1137 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setNTPServerLst(&PresentAddrLst);
 ;
     break;}
-case 202:
-#line 1124 "ClntParser.y"
+case 206:
+#line 1142 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 203:
-#line 1127 "ClntParser.y"
+case 207:
+#line 1145 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNTPServerLst(&PresentAddrLst);
 ;
     break;}
-case 204:
-#line 1137 "ClntParser.y"
+case 208:
+#line 1155 "ClntParser.y"
 {
     ParserOptStack.getLast()->setTimezone(string(""));
   ;
     break;}
-case 205:
-#line 1141 "ClntParser.y"
+case 209:
+#line 1159 "ClntParser.y"
 {
     ParserOptStack.getLast()->setTimezone(yyvsp[0].strval);
 ;
     break;}
-case 206:
-#line 1151 "ClntParser.y"
+case 210:
+#line 1169 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setSIPServerLst(&PresentAddrLst);
 ;
     break;}
-case 207:
-#line 1156 "ClntParser.y"
+case 211:
+#line 1174 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 208:
-#line 1159 "ClntParser.y"
+case 212:
+#line 1177 "ClntParser.y"
 {
     ParserOptStack.getLast()->setSIPServerLst(&PresentAddrLst);
 ;
     break;}
-case 209:
-#line 1169 "ClntParser.y"
+case 213:
+#line 1187 "ClntParser.y"
 {
     PresentStringLst.clear();
     ParserOptStack.getLast()->setSIPDomainLst(&PresentStringLst);
 ;
     break;}
-case 210:
-#line 1173 "ClntParser.y"
+case 214:
+#line 1191 "ClntParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 211:
-#line 1176 "ClntParser.y"
+case 215:
+#line 1194 "ClntParser.y"
 {
     ParserOptStack.getLast()->setSIPDomainLst(&PresentStringLst);
 ;
     break;}
-case 212:
-#line 1186 "ClntParser.y"
+case 216:
+#line 1204 "ClntParser.y"
 {
 	char hostname[255];
 	if (get_hostname(hostname, 255) == LOWLEVEL_NO_ERROR) {
@@ -2744,14 +2772,14 @@ case 212:
 	}
 ;
     break;}
-case 213:
-#line 1195 "ClntParser.y"
+case 217:
+#line 1213 "ClntParser.y"
 {
     ParserOptStack.getLast()->setFQDN(yyvsp[0].strval);
 ;
     break;}
-case 214:
-#line 1202 "ClntParser.y"
+case 218:
+#line 1220 "ClntParser.y"
 {
     if (yyvsp[0].ival!=0 && yyvsp[0].ival!=1) {
 	Log(Crit) << "Invalid FQDN S bit value: " << yyvsp[0].ival << ", expected 0 or 1." << LogEnd;
@@ -2762,72 +2790,72 @@ case 214:
     ParserOptStack.getLast()->setFQDNFlagS(yyvsp[0].ival);
 ;
     break;}
-case 215:
-#line 1217 "ClntParser.y"
+case 219:
+#line 1235 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setNISServerLst(&PresentAddrLst);
 ;
     break;}
-case 216:
-#line 1222 "ClntParser.y"
+case 220:
+#line 1240 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 217:
-#line 1225 "ClntParser.y"
+case 221:
+#line 1243 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISServerLst(&PresentAddrLst);
 ;
     break;}
-case 218:
-#line 1235 "ClntParser.y"
+case 222:
+#line 1253 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setNISPServerLst(&PresentAddrLst);
 ;
     break;}
-case 219:
-#line 1240 "ClntParser.y"
+case 223:
+#line 1258 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 220:
-#line 1243 "ClntParser.y"
+case 224:
+#line 1261 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISPServerLst(&PresentAddrLst);
 ;
     break;}
-case 221:
-#line 1253 "ClntParser.y"
+case 225:
+#line 1271 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISDomain("");
 ;
     break;}
-case 222:
-#line 1257 "ClntParser.y"
+case 226:
+#line 1275 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISDomain(yyvsp[0].strval);
 ;
     break;}
-case 223:
-#line 1268 "ClntParser.y"
+case 227:
+#line 1286 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISPDomain("");
 ;
     break;}
-case 224:
-#line 1272 "ClntParser.y"
+case 228:
+#line 1290 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISPDomain(yyvsp[0].strval);
 ;
     break;}
-case 225:
-#line 1282 "ClntParser.y"
+case 229:
+#line 1300 "ClntParser.y"
 {
     if (ParserOptStack.getLast()->getStateful()) {
         Log(Crit) << "Information refresh time (lifetime) option can only be used in stateless mode." << LogEnd;
@@ -2836,44 +2864,44 @@ case 225:
     ParserOptStack.getLast()->setLifetime();
 ;
     break;}
-case 226:
-#line 1293 "ClntParser.y"
+case 230:
+#line 1311 "ClntParser.y"
 {
     Log(Debug) << "VendorSpec defined (no details)." << LogEnd;
     ParserOptStack.getLast()->setVendorSpec();
 ;
     break;}
-case 227:
-#line 1298 "ClntParser.y"
+case 231:
+#line 1316 "ClntParser.y"
 {
     ParserOptStack.getLast()->setVendorSpec();
     Log(Debug) << "VendorSpec defined (multiple times)." << LogEnd;
 ;
     break;}
-case 228:
-#line 1305 "ClntParser.y"
+case 232:
+#line 1323 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(OPTION_VENDOR_OPTS, yyvsp[0].ival,0,0,0,0) ); ;
     break;}
-case 229:
-#line 1306 "ClntParser.y"
+case 233:
+#line 1324 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(OPTION_VENDOR_OPTS, yyvsp[-2].ival,yyvsp[0].ival,0,0,0) ); ;
     break;}
-case 230:
-#line 1307 "ClntParser.y"
+case 234:
+#line 1325 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(OPTION_VENDOR_OPTS, yyvsp[0].ival,0,0,0,0) ); ;
     break;}
-case 231:
-#line 1308 "ClntParser.y"
+case 235:
+#line 1326 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(OPTION_VENDOR_OPTS, yyvsp[-2].ival,yyvsp[0].ival,0,0,0) ); ;
     break;}
-case 232:
-#line 1313 "ClntParser.y"
+case 236:
+#line 1331 "ClntParser.y"
 {
     ClntCfgIfaceLst.getLast()->addExtraOption(OPTION_AFTR_NAME, TOpt::Layout_String, false);
 ;
     break;}
-case 233:
-#line 1320 "ClntParser.y"
+case 237:
+#line 1338 "ClntParser.y"
 {
     // option 123 hex 0x1234abcd
     SPtr<TOpt> opt = new TOptGeneric(yyvsp[-2].ival, yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0);
@@ -2881,8 +2909,8 @@ case 233:
     Log(Debug) << "Will send option " << yyvsp[-2].ival << " (hex data, len" << yyvsp[0].duidval.length << ")" << LogEnd;
 ;
     break;}
-case 234:
-#line 1327 "ClntParser.y"
+case 238:
+#line 1345 "ClntParser.y"
 {
     // option 123 address 2001:db8::1
     SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[0].addrval));
@@ -2892,15 +2920,15 @@ case 234:
     Log(Debug) << "Will send option " << yyvsp[-2].ival << " (address " << addr->getPlain() << ")" << LogEnd;
 ;
     break;}
-case 235:
-#line 1336 "ClntParser.y"
+case 239:
+#line 1354 "ClntParser.y"
 {
     // option 123 address-list 2001:db8::1,2001:db8::cafe
     PresentAddrLst.clear();
 ;
     break;}
-case 236:
-#line 1340 "ClntParser.y"
+case 240:
+#line 1358 "ClntParser.y"
 {
     SPtr<TOpt> opt = new TOptAddrLst(yyvsp[-3].ival, PresentAddrLst, 0);
     ClntCfgIfaceLst.getLast()->addExtraOption(opt, TOpt::Layout_AddrLst, true);
@@ -2908,8 +2936,8 @@ case 236:
 	       << PresentAddrLst.count() << " addresses)." << LogEnd;
 ;
     break;}
-case 237:
-#line 1347 "ClntParser.y"
+case 241:
+#line 1365 "ClntParser.y"
 {
     // option 123 string "foobar"
     SPtr<TOpt> opt = new TOptString(yyvsp[-2].ival, string(yyvsp[0].strval), 0);
@@ -2917,16 +2945,16 @@ case 237:
     Log(Debug) << "Will send option " << yyvsp[-2].ival << " (string " << yyvsp[0].strval << ")" << LogEnd;
 ;
     break;}
-case 238:
-#line 1354 "ClntParser.y"
+case 242:
+#line 1372 "ClntParser.y"
 {
     // just request option 123 and interpret responses as hex
     Log(Debug) << "Will request option " << yyvsp[-1].ival << " and iterpret response as hex." << LogEnd;
     ClntCfgIfaceLst.getLast()->addExtraOption(yyvsp[-1].ival, TOpt::Layout_Duid, false);
 ;
     break;}
-case 239:
-#line 1360 "ClntParser.y"
+case 243:
+#line 1378 "ClntParser.y"
 {
     // just request this option and expect OptAddr layout
     Log(Debug) << "Will request option " << yyvsp[-1].ival 
@@ -2934,16 +2962,16 @@ case 239:
     ClntCfgIfaceLst.getLast()->addExtraOption(yyvsp[-1].ival, TOpt::Layout_Addr, false);
 ;
     break;}
-case 240:
-#line 1367 "ClntParser.y"
+case 244:
+#line 1385 "ClntParser.y"
 {
     // just request this option and expect OptString layout
     Log(Debug) << "Will request option " << yyvsp[-1].ival << " and interpret response as a string." << LogEnd;
     ClntCfgIfaceLst.getLast()->addExtraOption(yyvsp[-1].ival, TOpt::Layout_String, false);
 ;
     break;}
-case 241:
-#line 1373 "ClntParser.y"
+case 245:
+#line 1391 "ClntParser.y"
 {
     // just request this option and expect OptAddrLst layout
     Log(Debug) << "Will request option " << yyvsp[-1].ival
@@ -3155,7 +3183,7 @@ YYLABEL(yyerrhandle)
 /* END */
 
  #line 1039 "../bison++/bison.cc"
-#line 1380 "ClntParser.y"
+#line 1398 "ClntParser.y"
 
 
 /////////////////////////////////////////////////////////////////////////////
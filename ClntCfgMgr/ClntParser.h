@@ -354,6 +354,8 @@ typedef
 #define	DUID_KEYWORD_	336
 #define	HEX_KEYWORD_	337
 #define	RECONFIGURE_	338
+#define	RENEW_COALESCE_	339
+#define	STARTUP_SPREAD_	340
 
 
 #line 169 "../bison++/bison.h"
@@ -483,6 +485,8 @@ static const int STRING_KEYWORD_;
 static const int DUID_KEYWORD_;
 static const int HEX_KEYWORD_;
 static const int RECONFIGURE_;
+static const int RENEW_COALESCE_;
+static const int STARTUP_SPREAD_;
 
 
 #line 212 "../bison++/bison.h"
@@ -572,6 +576,8 @@ static const int RECONFIGURE_;
 	,DUID_KEYWORD_=336
 	,HEX_KEYWORD_=337
 	,RECONFIGURE_=338
+	,RENEW_COALESCE_=339
+	,STARTUP_SPREAD_=340
 
 
 #line 215 "../bison++/bison.h"
@@ -133,6 +133,7 @@ namespace std
 %token ROUTING_, BIND_TO_ADDR_
 %token ADDRESS_LIST_KEYWORD_, STRING_KEYWORD_, DUID_KEYWORD_, HEX_KEYWORD_
 %token RECONFIGURE_
+%token RENEW_COALESCE_, STARTUP_SPREAD_
 %type  <ival> Number
 
 %%
@@ -179,6 +180,7 @@ GlobalOptionDeclaration
 | ReconfigureAccept
 | DownlinkPrefixInterfaces
 | ObeyRaBits
+| StartupSpread
 ;
 
 InterfaceOptionDeclaration
@@ -205,6 +207,7 @@ InterfaceOptionDeclaration
 | ExtraOption
 | ExperimentalRemoteAutoconf
 | BindToAddress
+| RenewCoalesceOption
 ;
 
 IAOptionDeclaration
@@ -793,6 +796,13 @@ RapidCommitOption
 }
 ;
 
+RenewCoalesceOption
+:   RENEW_COALESCE_ Number
+{
+    ParserOptStack.getLast()->setRenewCoalesce($2);
+}
+;
+
 ExperimentalAddrParams
 :   ADDR_PARAMS_
 {
@@ -834,6 +844,14 @@ SkipConfirm
     ParserOptStack.getLast()->setConfirm(false);
 };
 
+StartupSpread
+: STARTUP_SPREAD_ Number
+{
+    Log(Debug) << "First transmission will be delayed by up to " << $2
+               << " second(s) (startup-spread)." << LogEnd;
+    CfgMgr->setStartupSpread($2);
+};
+
 ReconfigureAccept
 : RECONFIGURE_ Number
 {
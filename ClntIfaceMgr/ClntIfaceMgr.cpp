@@ -12,7 +12,9 @@
 #include <sstream>
 #include <stdlib.h>
 #include <unistd.h>
+#include <vector>
 #include "Portable.h"
+#include "DHCPDefaults.h"
 #include "SmartPtr.h"
 #include "ClntIfaceMgr.h"
 #include "ClntTransMgr.h"
@@ -96,7 +98,12 @@ bool TClntIfaceMgr::sendMulticast(int iface, char * msg, int msgsize)
 }
 
 
-SPtr<TClntMsg> TClntIfaceMgr::select(unsigned int timeout)
+/// @brief waits for incoming message
+///
+/// @param timeoutMs max number of milliseconds to wait
+///
+/// @return received message (or NULL)
+SPtr<TClntMsg> TClntIfaceMgr::select(uint64_t timeoutMs)
 {
     int bufsize=4096;
     static char buf[4096];
@@ -104,7 +111,13 @@ SPtr<TClntMsg> TClntIfaceMgr::select(unsigned int timeout)
     SPtr<TIPv6Addr> myaddr(new TIPv6Addr());
     int sockid;
 
-    sockid = TIfaceMgr::select(timeout, buf, bufsize, peer, myaddr);
+    unsigned long sec = DHCPV6_INFINITY;
+    unsigned long usec = 0;
+    if (timeoutMs/1000 < DHCPV6_INFINITY) {
+        sec = (unsigned long)(timeoutMs/1000);
+        usec = (unsigned long)(timeoutMs%1000)*1000;
+    }
+    sockid = TIfaceMgr::select(sec, usec, buf, bufsize, peer, myaddr);
 
     if (sockid>0) {
         if (bufsize<4) {
@@ -174,12 +187,14 @@ SPtr<TClntMsg> TClntIfaceMgr::select(unsigned int timeout)
 }
 
 TClntIfaceMgr::TClntIfaceMgr(const std::string& xmlFile)
-    : TIfaceMgr(xmlFile, false)
+    : TIfaceMgr(xmlFile, false), PrefixSplit(CLNTPDSPLIT_FILE),
+      FqdnChanged_(false), DownlinkValid_(false), DownlinkUplink_(0), DownlinkSplit_(false)
 {
     struct iface * ptr;
     struct iface * ifaceList;
 
     this->XmlFile = xmlFile;
+    PrefixSplit.load();
 
     // get interface list
     ifaceList = if_list_get(); // external (C coded) function
@@ -227,11 +242,13 @@ void TClntIfaceMgr::removeAllOpts() {
     SPtr<TIfaceIface> iface;
     SPtr<TClntIfaceIface> clntIface;
 
+    cfg_batch_begin();
     this->firstIface();
     while (iface = this->getIface()) {
         clntIface = (Ptr*) iface;
         clntIface->removeAllOpts();
     }
+    cfg_batch_commit();
 }
 
 unsigned int TClntIfaceMgr::getTimeout() {
@@ -262,17 +279,13 @@ bool TClntIfaceMgr::doDuties() {
                             // Here we check if all parameters are set, and do the DNS update if possible
                             List(TIPv6Addr) DNSSrvLst = iface->getDNSServerLst();
                             string fqdn = iface->getFQDN();
-                            if (ClntAddrMgr().countIA() > 0 && DNSSrvLst.count() > 0 && fqdn.size() > 0) {
-
-                                Log(Warning) << "Sleeping 3 seconds before performing DNS Update." << LogEnd;
-                                /** @todo: sleep cannot be performed here. What if client has to perform other
-                                   action during those 3 seconds? */
-#ifdef WIN32
-                            Sleep(3);
-#else
-                            sleep(3);
-#endif
-                            this->fqdnAdd(iface, fqdn);
+                            if (ClntAddrMgr().countIA() > 0 && DNSSrvLst.count() > 0 && fqdn.size() > 0 &&
+                                !FqdnPending_.count(iface->getID())) {
+                            // DNS Update is performed in background, state is set
+                            // when it's done (see fqdnAddDone())
+                            FqdnPending_.insert(iface->getID());
+                            if (!this->fqdnAdd(iface, fqdn))
+                                FqdnPending_.erase(iface->getID());
                         }
                   }
               }
@@ -282,6 +295,88 @@ bool TClntIfaceMgr::doDuties() {
     return true;
 }
 
+#ifndef MOD_CLNT_DISABLE_DNSUPDATE
+/// @brief DNS Update performed by the background worker
+class TClntDnsUpdateJob : public TClntWorker::TJob
+{
+public:
+    /// @param act DNS Update to be performed (will be deleted by the job)
+    /// @param timeout DNS Update timeout (in ms)
+    /// @param delay number of seconds to wait before DNS Update is performed
+    /// @param ifindex interface FQDN was added on (0 for removal, result is not reported)
+    TClntDnsUpdateJob(DNSUpdate* act, unsigned int timeout, unsigned int delay, int ifindex)
+        :TJob("DNS Update", delay + 2*timeout/1000 + CLIENT_DEFAULT_SCRIPT_TIMEOUT),
+         Act(act), DnsTimeout(timeout), Delay(delay), Ifindex(ifindex) {}
+    ~TClntDnsUpdateJob() { delete Act; }
+
+    int run() {
+        if (Delay) {
+#ifdef WIN32
+            Sleep(Delay*1000);
+#else
+            sleep(Delay);
+#endif
+        }
+        return Act->run(DnsTimeout);
+    }
+
+    void done(int result) {
+        if (result < 0)
+            result = DNSUPDATE_ERROR;
+        Act->showResult(result);
+        if (Ifindex)
+            ClntIfaceMgr().fqdnAddDone(Ifindex, result == DNSUPDATE_SUCCESS);
+    }
+
+private:
+    DNSUpdate* Act;
+    unsigned int DnsTimeout;
+    unsigned int Delay;
+    int Ifindex;
+};
+#endif
+
+/// @brief notify script executed by the background worker
+class TClntScriptJob : public TClntWorker::TJob
+{
+public:
+    TClntScriptJob(const std::string& scriptName, const std::string& action,
+                   const TNotifyScriptParams& params)
+        :TJob(scriptName + " script", CLIENT_DEFAULT_SCRIPT_TIMEOUT),
+         ScriptName(scriptName), Action(action) {
+        // params will be gone by the time the script is started
+        for (int i = 0; i < params.envCnt; i++)
+            Env.push_back(params.env[i]);
+    }
+
+    int run() {
+        const char * argv[3];
+        argv[0] = ScriptName.c_str();
+        argv[1] = Action.c_str();
+        argv[2] = NULL;
+
+        std::vector<const char*> env;
+        for (std::vector<std::string>::const_iterator e = Env.begin(); e != Env.end(); ++e)
+            env.push_back(e->c_str());
+        env.push_back(NULL);
+
+        return execute(ScriptName.c_str(), argv, &env[0]);
+    }
+
+    void done(int result) {
+        if (result>=0) {
+            Log(Debug) << "Script execution complete, return code=" << result << LogEnd;
+        } else {
+            Log(Warning) << "Script execution failed, return code=" << result << LogEnd;
+        }
+    }
+
+private:
+    std::string ScriptName;
+    std::string Action;
+    std::vector<std::string> Env;
+};
+
 bool TClntIfaceMgr::fqdnAdd(SPtr<TClntIfaceIface> iface, const std::string& fqdn)
 {
     SPtr<TIPv6Addr> DNSAddr;
@@ -308,7 +403,12 @@ bool TClntIfaceMgr::fqdnAdd(SPtr<TClntIfaceIface> iface, const std::string& fqdn
     ClntAddrMgr().firstIA();
     ptrAddrIA = ClntAddrMgr().getIA();
 
-    if (ptrAddrIA->countAddr() > 0) {
+    if (!ptrAddrIA || !ptrAddrIA->countAddr()) {
+        Log(Error) << "Unable to find any address. FQDN add failed." << LogEnd;
+        return false;
+    }
+
+    {
         ptrAddrIA->firstAddr();
         addr = ptrAddrIA->getAddr()->get();
 
@@ -330,9 +430,9 @@ bool TClntIfaceMgr::fqdnAdd(SPtr<TClntIfaceIface> iface, const std::string& fqdn
         /* add AAAA record */
         DNSUpdate *act = new DNSUpdate(DNSAddr->getPlain(), "", fqdn, addr->getPlain(),
                                        DNSUPDATE_AAAA, proto2);
-        int result = act->run(timeout);
-        act->showResult(result);
-        delete act;
+        // failed updates are retried with increasing delay
+        unsigned int delay = CLIENT_DNSUPDATE_DELAY << FqdnFailures_[iface->getID()];
+        Worker.add(iface->getID(), new TClntDnsUpdateJob(act, timeout, delay, iface->getID()));
 #else
         Log(Error) << "This version is compiled without DNS Update support." << LogEnd;
         return false;
@@ -372,9 +472,7 @@ bool TClntIfaceMgr::fqdnDel(SPtr<TClntIfaceIface> iface, SPtr<TAddrIA> ia, const
 
     DNSUpdate *act = new DNSUpdate(dns->getPlain(), "", fqdn, myAddr->getPlain(),
                                    DNSUPDATE_AAAA_CLEANUP, proto2);
-    int result = act->run(timeout);
-    act->showResult(result);
-    delete act;
+    Worker.add(iface->getID(), new TClntDnsUpdateJob(act, timeout, 0, 0));
 
 #else
     Log(Error) << "This Dibbler version is compiled without DNS Update support." << LogEnd;
@@ -383,6 +481,88 @@ bool TClntIfaceMgr::fqdnDel(SPtr<TClntIfaceIface> iface, SPtr<TAddrIA> ia, const
     return false;
 }
 
+/**
+ * @brief queues notify script execution
+ *
+ * Script is run by the background worker, so a hung script does not block
+ * the client. Scripts are executed in the same order they were requested.
+ *
+ * @param scriptName script to be executed
+ * @param action action (add, update, delete)
+ * @param params parameters passed as environment variables
+ */
+void TClntIfaceMgr::notifyScript(const std::string& scriptName, std::string action,
+                                 TNotifyScriptParams& params) {
+    // get PATH
+    char * path = getenv("PATH");
+    if (path) {
+        params.addParam("PATH", string(path));
+    }
+
+    Log(Debug) << "About to execute " << scriptName << " script, "
+               << params.envCnt << " variables." << LogEnd;
+    Worker.add(params.ifindex, new TClntScriptJob(scriptName, action, params));
+}
+
+/**
+ * @brief sets FQDN state once DNS Update is done
+ *
+ * Failed update is retried (FQDN state stays STATE_INPROCESS) up to
+ * CLIENT_DNSUPDATE_RETRIES times, then FQDN is marked as failed.
+ *
+ * @param ifindex interface FQDN was added on
+ * @param success was DNS Update successful?
+ */
+void TClntIfaceMgr::fqdnAddDone(int ifindex, bool success) {
+    FqdnPending_.erase(ifindex);
+    SPtr<TClntCfgIface> cfgIface = ClntCfgMgr().getIface(ifindex);
+    if (!cfgIface || cfgIface->getFQDNState() != STATE_INPROCESS)
+        return;
+
+    FqdnChanged_ = true;
+    if (success) {
+        FqdnFailures_.erase(ifindex);
+        cfgIface->setFQDNState(STATE_CONFIGURED);
+        return;
+    }
+
+    if (++FqdnFailures_[ifindex] > CLIENT_DNSUPDATE_RETRIES) {
+        Log(Error) << "FQDN: DNS Update on " << cfgIface->getFullName() << " failed "
+                   << FqdnFailures_[ifindex] << " times, giving up." << LogEnd;
+        FqdnFailures_.erase(ifindex);
+        cfgIface->setFQDNState(STATE_FAILED);
+        return;
+    }
+    Log(Warning) << "FQDN: DNS Update on " << cfgIface->getFullName()
+                 << " failed, will be retried." << LogEnd;
+}
+
+/**
+ * @brief reaps finished background jobs and starts pending ones
+ *
+ * @return true if FQDN state changed (update succeeded, or has to be retried)
+ */
+bool TClntIfaceMgr::processJobs() {
+    Worker.poll();
+    bool changed = FqdnChanged_;
+    FqdnChanged_ = false;
+    return changed;
+}
+
+/// returns number of pending (or running) background jobs
+unsigned int TClntIfaceMgr::countJobs() {
+    return Worker.count();
+}
+
+/// @brief waits for pending DNS updates and scripts (called during shutdown)
+void TClntIfaceMgr::finishJobs() {
+    if (Worker.count()) {
+        Log(Info) << "Waiting for " << Worker.count() << " DNS Update(s)/script(s) to finish."
+                  << LogEnd;
+    }
+    Worker.finish(CLIENT_DEFAULT_WORKER_SHUTDOWN);
+}
+
 void TClntIfaceMgr::dump()
 {
     std::ofstream xmlDump;
@@ -433,54 +613,55 @@ bool TClntIfaceMgr::delPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLen,
     return modifyPrefix(iface, prefix, prefixLen, 0, 0, PREFIX_MODIFY_DEL, params);
 }
 
-bool TClntIfaceMgr::modifyPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLen,
-                                 unsigned int pref, unsigned int valid,
-                                 PrefixModifyMode mode,
-                                 TNotifyScriptParams* params /*= NULL*/)
+/**
+ * @brief returns interfaces delegated prefix will be split among
+ *
+ * The list is found once and reused until interface state changes (see
+ * linkChanged()), so renewals don't walk all interfaces.
+ *
+ * @param uplink interface the prefix was delegated on
+ * @param ifaceLst [out] list of downlink interfaces
+ *
+ * @return false if split was administratively disabled (downlink-prefix-ifaces none)
+ */
+bool TClntIfaceMgr::getDownlinkIfaces(SPtr<TClntIfaceIface> uplink, TIfaceIfaceLst& ifaceLst)
 {
-    SPtr<TClntIfaceIface> ptrIface = (Ptr*)getIfaceByID(iface);
-    if (!ptrIface) {
-        Log(Error) << "Unable to find interface with ifindex=" << iface
-                   << ", prefix add/modify operation failed." << LogEnd;
-        return false;
-    }
-
-    string action;
-    int conf = 0; // number of successfully configured prefixes
-    int status = -1;
-
-    switch (mode) {
-    case PREFIX_MODIFY_ADD:
-            action = "Adding";
-            break;
-    case PREFIX_MODIFY_UPDATE:
-            action = "Updating";
-            break;
-    case PREFIX_MODIFY_DEL:
-            action = "Deleting";
-            break;
+    if (!DownlinkValid_ || DownlinkUplink_ != uplink->getID()) {
+        DownlinkIfaces_.clear();
+        DownlinkSplit_ = findDownlinkIfaces(uplink, DownlinkIfaces_);
+        DownlinkUplink_ = uplink->getID();
+        DownlinkValid_ = true;
     }
+    ifaceLst.insert(ifaceLst.end(), DownlinkIfaces_.begin(), DownlinkIfaces_.end());
+    return DownlinkSplit_;
+}
 
-    // option: split this prefix and add it to all interfaces
-    Log(Notice) << "PD: " << action << " prefix " << prefix->getPlain() << "/" << (int)prefixLen
-                << " to all interfaces (prefix will be split to /"
-                << int(prefixLen+8) << " prefixes if necessary)." << LogEnd;
-
-    if (prefixLen>120) {
-        Log(Error) << "PD: Unable to perform prefix operation: prefix /" << prefixLen
-                   << " can't be split. At least /120 prefix is required." << LogEnd;
-        return false;
-    }
+/**
+ * @brief forgets downlink interfaces, so they are found again when needed
+ *
+ * Should be called when interface state (flags, link) has changed.
+ */
+void TClntIfaceMgr::linkChanged()
+{
+    DownlinkValid_ = false;
+}
 
-    // get a list of interfaces that we will assign prefixes to
-    TIfaceIfaceLst ifaceLst;
+/**
+ * @brief finds interfaces delegated prefix will be split among
+ *
+ * @param uplink interface the prefix was delegated on
+ * @param ifaceLst [out] list of downlink interfaces
+ *
+ * @return false if split was administratively disabled (downlink-prefix-ifaces none)
+ */
+bool TClntIfaceMgr::findDownlinkIfaces(SPtr<TClntIfaceIface> uplink, TIfaceIfaceLst& ifaceLst)
+{
     vector<string> ifaceNames = ClntCfgMgr().getDownlinkPrefixIfaces();
 
     // skip PD split, because it was administratively disabled
     // (i.e. user specified downlink-prefix-ifaces none
-    bool skip = false;
     if (ifaceNames.size() == 1 && (ifaceNames[0] == "none")) {
-        skip = true;
+        return false;
     }
 
     for (vector<string>::const_iterator name = ifaceNames.begin(); name != ifaceNames.end(); ++name) {
@@ -495,11 +676,11 @@ bool TClntIfaceMgr::modifyPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLe
             Log(Warning) << "Interface " << *name << " specified in downlink-prefix-ifaces is missing." << LogEnd;
     }
 
-    if (!skip && (ifaceLst.empty()) ) {
+    if (ifaceLst.empty()) {
         SPtr<TIfaceIface> x;
         firstIface();
         while ( x = (Ptr*)getIface() ) {
-            if (x->getID() == ptrIface->getID()) {
+            if (x->getID() == uplink->getID()) {
                 Log(Debug) << "PD: Interface " << x->getFullName()
                            << " is the interface, where prefix has been obtained, skipping." << LogEnd;
                 continue;
@@ -537,102 +718,237 @@ bool TClntIfaceMgr::modifyPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLe
             ifaceLst.push_back(x);
         }
     }
+    return true;
+}
 
-    TIfaceIfaceLst::const_iterator i;
-    string dl_ifaces;
-    for (TIfaceIfaceLst::const_iterator i=ifaceLst.begin(); i!=ifaceLst.end(); ++i) {
-      dl_ifaces += string((*i)->getName()) + " ";
+/**
+ * @brief queues lifetime update of already configured sub-prefix
+ *
+ * @param sub sub-prefix to be updated
+ * @param pref new preferred lifetime
+ * @param valid new valid lifetime
+ *
+ * @return status returned by the low-level prefix_update()
+ */
+int TClntIfaceMgr::updateSubPrefix(const TClntPrefixSplit::TSubPrefix& sub,
+                                   unsigned int pref, unsigned int valid)
+{
+    return prefix_update(sub.Iface.c_str(), sub.Ifindex, sub.Prefix->getPlain(),
+                         sub.PrefixLen, pref, valid);
+}
+
+/**
+ * @brief adds, updates or deletes sub-prefixes of a delegated prefix
+ *
+ * The prefix is split when the delegated prefix is seen for the first time
+ * (see TClntPrefixSplit) and again only if the downlink interfaces have
+ * changed since. Later updates only touch sub-prefixes with changed
+ * lifetimes, and all changes are sent to the kernel in one batch. Sub-prefix
+ * state is updated once the kernel has accepted the change.
+ */
+bool TClntIfaceMgr::modifyPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLen,
+                                 unsigned int pref, unsigned int valid,
+                                 PrefixModifyMode mode,
+                                 TNotifyScriptParams* params /*= NULL*/)
+{
+    SPtr<TClntIfaceIface> ptrIface = (Ptr*)getIfaceByID(iface);
+    if (!ptrIface) {
+        Log(Error) << "Unable to find interface with ifindex=" << iface
+                   << ", prefix add/modify operation failed." << LogEnd;
+        return false;
     }
-    if (skip) {
-        dl_ifaces += string("[none]");
+
+    string action;
+    int conf = 0; // number of successfully configured prefixes
+    int unchanged = 0; // number of prefixes that did not need any change
+    int status = -1;
+
+    switch (mode) {
+    case PREFIX_MODIFY_ADD:
+            action = "Adding";
+            break;
+    case PREFIX_MODIFY_UPDATE:
+            action = "Updating";
+            break;
+    case PREFIX_MODIFY_DEL:
+            action = "Deleting";
+            break;
+    }
+
+    // option: split this prefix and add it to all interfaces
+    Log(Notice) << "PD: " << action << " prefix " << prefix->getPlain() << "/" << (int)prefixLen
+                << " to all interfaces (prefix will be split if necessary)." << LogEnd;
+
+    TClntPrefixSplit::TPlan* plan = PrefixSplit.find(prefix, prefixLen);
+    if (!plan || mode != PREFIX_MODIFY_DEL) {
+        // get a list of interfaces that we will assign prefixes to. It may
+        // differ from the one the plan was computed for (config or interfaces
+        // changed), then the prefix is split again.
+        TIfaceIfaceLst ifaceLst;
+        bool split = getDownlinkIfaces(ptrIface, ifaceLst);
+
+        if (!plan || !split || !TClntPrefixSplit::matches(*plan, ifaceLst)) {
+            TClntPrefixSplit::TPlan old;
+            if (plan) {
+                Log(Info) << "PD: Downlink interfaces changed, prefix " << prefix->getPlain()
+                          << "/" << prefixLen << " will be split again." << LogEnd;
+                old = *plan;
+                PrefixSplit.remove(prefix, prefixLen);
+                plan = 0;
+            }
+
+            if (split && !ifaceLst.empty()) {
+                plan = PrefixSplit.create(prefix, prefixLen, iface, ifaceLst);
+            }
+
+            // sub-prefixes that didn't change are kept, the others are removed
+            ipaddr_batch_begin();
+            for (vector<TClntPrefixSplit::TSubPrefix>::iterator o = old.SubPrefixes.begin();
+                 o != old.SubPrefixes.end(); ++o) {
+                if (!o->Configured)
+                    continue;
+                bool kept = false;
+                for (unsigned int i = 0; plan && !kept && i < plan->SubPrefixes.size(); i++) {
+                    TClntPrefixSplit::TSubPrefix& sub = plan->SubPrefixes[i];
+                    if (sub.Iface == o->Iface && sub.PrefixLen == o->PrefixLen &&
+                        *sub.Prefix == *o->Prefix) {
+                        sub.Configured = true;
+                        sub.Pref = o->Pref;
+                        sub.Valid = o->Valid;
+                        kept = true;
+                    }
+                }
+                if (kept)
+                    continue;
+                Log(Notice) << "PD: Deleting prefix " << o->Prefix->getPlain() << "/"
+                            << o->PrefixLen << " from the " << o->Iface << "/" << o->Ifindex
+                            << " interface." << LogEnd;
+                prefix_del(o->Iface.c_str(), o->Ifindex, o->Prefix->getPlain(),
+                           o->PrefixLen);
+            }
+            if (ipaddr_batch_commit() != LOWLEVEL_NO_ERROR) {
+                string tmp = error_message();
+                Log(Error) << "Prefix error encountered during Deleting operation: " << tmp << LogEnd;
+            }
+            PrefixSplit.save();
+        }
+
+        if (!split) {
+            Log(Info) << "PD: Using 0 suitable interface(s):[none]" << LogEnd;
+            if (params) {
+                params->addParam("DOWNLINK_PREFIX_IFACES", "[none]");
+                params->addParam("DOWNLINK_PREFIXES", "");
+            }
+            return true;
+        }
+
+        if (ifaceLst.empty()) {
+            if (params) {
+                params->addParam("DOWNLINK_PREFIX_IFACES", "");
+            }
+            Log(Warning) << "Suitable interfaces not found. Delegated prefix not split." << LogEnd;
+            return true;
+        }
+
+        if (!plan) {
+            return false;
+        }
+    }
+
+    string dl_ifaces;
+    for (vector<TClntPrefixSplit::TSubPrefix>::const_iterator sub = plan->SubPrefixes.begin();
+         sub != plan->SubPrefixes.end(); ++sub) {
+        dl_ifaces += sub->Iface + " ";
     }
-    Log(Info) << "PD: Using " << ifaceLst.size() << " suitable interface(s):"
-	      << dl_ifaces << LogEnd;
+    Log(Info) << "PD: Using " << plan->SubPrefixes.size() << " suitable interface(s):"
+              << dl_ifaces << LogEnd;
 
     // pass this info to the script as well
     if (params) {
         params->addParam("DOWNLINK_PREFIX_IFACES", dl_ifaces);
     }
 
-    if (!skip && ifaceLst.empty()) {
-        Log(Warning) << "Suitable interfaces not found. Delegated prefix not split." << LogEnd;
-        return true;
-    }
-
     stringstream prefix_split; // textual representation, used to pass as script
-    for (TIfaceIfaceLst::const_iterator i=ifaceLst.begin(); i!=ifaceLst.end(); ++i) {
-
-        char buf[16];
-        int subprefixLen;
-        memmove(buf, prefix->getAddr(), 16);
-
-        if (ifaceLst.size() == 1) {
-            // just one interface - use delegated prefix as is
-            subprefixLen = prefixLen;
-        } else if (ifaceLst.size()<256) {
-            subprefixLen = prefixLen + 8;
-            int offset = prefixLen/8;
-            if (prefixLen%8 == 0) {
-                // that's easy, just put ID in the next octet
-                buf[offset] = (*i)->getID();
-            } else {
-                // here's fun
-                uint16_t existing = readUint16(buf+offset);
-                uint16_t bitmask = 0xff00;
-                uint16_t infixmask = ((uint8_t)(*i)->getID()) << 8;
-                bitmask = bitmask >> (prefixLen%8);
-                infixmask = infixmask >> (prefixLen%8);
-
-                // clear out if there is anything there, i.e. server assigned prefix
-                // with garbage in host section
-                existing = existing & (~bitmask);
-                existing = existing | (bitmask & infixmask);
-                writeUint16(buf+offset, existing);
-            }
 
-        } else {
-            // users with too much time that play with virtual interfaces are out of luck
-            Log(Error) << "Something is wrong. Detected more than 256 interface." << LogEnd;
-            return false;
-        }
+    // requests queued in the batch, their results are known after commit
+    vector<pair<TClntPrefixSplit::TSubPrefix*, unsigned> > queued;
 
-        SPtr<TIPv6Addr> tmpAddr = new TIPv6Addr(buf, false);
+    ipaddr_batch_begin();
+    for (vector<TClntPrefixSplit::TSubPrefix>::iterator sub = plan->SubPrefixes.begin();
+         sub != plan->SubPrefixes.end(); ++sub) {
 
-        Log(Notice) << "PD: " << action << " prefix " << tmpAddr->getPlain() << "/" << subprefixLen
-                    << " on the " << (*i)->getFullName() << " interface." << LogEnd;
+        const char* name = sub->Iface.c_str();
+        string plain = sub->Prefix->getPlain();
 
-	if (params) {
-	  prefix_split << (*i)->getName() << " " << tmpAddr->getPlain()
-		       << "/" << subprefixLen << " ";
-	}
+        if (params) {
+            prefix_split << sub->Iface << " " << plain << "/" << sub->PrefixLen << " ";
+        }
+
+        if (mode != PREFIX_MODIFY_DEL && sub->Configured &&
+            sub->Pref == pref && sub->Valid == valid) {
+            unchanged++;
+            continue;
+        }
+
+        Log(Notice) << "PD: " << action << " prefix " << plain << "/" << sub->PrefixLen
+                    << " on the " << sub->Iface << "/" << sub->Ifindex << " interface." << LogEnd;
 
         switch (mode) {
         case PREFIX_MODIFY_ADD:
-            status = prefix_add( (*i)->getName(), (*i)->getID(), tmpAddr->getPlain(), subprefixLen, pref, valid);
+            if (sub->Configured) {
+                // already there, just lifetimes changed
+                status = updateSubPrefix(*sub, pref, valid);
+            } else {
+                status = prefix_add(name, sub->Ifindex, plain.c_str(), sub->PrefixLen, pref, valid);
+            }
             break;
         case PREFIX_MODIFY_UPDATE:
-            status = prefix_update( (*i)->getName(), (*i)->getID(), tmpAddr->getPlain(), subprefixLen, pref, valid);
+            status = updateSubPrefix(*sub, pref, valid);
             break;
         case PREFIX_MODIFY_DEL:
-          status = prefix_del( (*i)->getName(), (*i)->getID(), tmpAddr->getPlain(), subprefixLen);
+            status = prefix_del(name, sub->Ifindex, plain.c_str(), sub->PrefixLen);
             break;
         }
         if (status==LOWLEVEL_NO_ERROR) {
-            conf++;
+            queued.push_back(make_pair(&(*sub), ipaddr_batch_last()));
         } else {
             string tmp = error_message();
             Log(Error) << "Prefix error encountered during " << action << " operation: " << tmp << LogEnd;
         }
+    }
+    if (ipaddr_batch_commit() != LOWLEVEL_NO_ERROR) {
+        string tmp = error_message();
+        Log(Error) << "Prefix error encountered during " << action << " operation: " << tmp << LogEnd;
+    }
+
+    // state is updated only for changes accepted by the kernel, so the failed
+    // ones are tried again next time
+    for (vector<pair<TClntPrefixSplit::TSubPrefix*, unsigned> >::const_iterator q = queued.begin();
+         q != queued.end(); ++q) {
+        if (ipaddr_batch_result(q->second) != LOWLEVEL_NO_ERROR)
+            continue;
+        conf++;
+        q->first->Configured = (mode != PREFIX_MODIFY_DEL);
+        q->first->Pref = pref;
+        q->first->Valid = valid;
+    }
 
+    if (unchanged) {
+        Log(Debug) << "PD: " << unchanged << " sub-prefix(es) unchanged, skipped." << LogEnd;
     }
 
     if (params) {
       params->addParam("DOWNLINK_PREFIXES", prefix_split.str());
     }
 
-    // If at least one prefix configured successfully (or we were told to skip)
-    // then it's a great success!
-    if (conf || skip) {
+    if (mode == PREFIX_MODIFY_DEL) {
+        PrefixSplit.remove(prefix, prefixLen);
+        PrefixSplit.save();
+    }
+
+    // If at least one prefix configured successfully (or nothing had to be
+    // done) then it's a great success!
+    if (conf || unchanged) {
         return true;
     } else {
         // We failed again... dammit.
@@ -669,6 +985,7 @@ void TClntIfaceMgr::redetectIfaces() {
                         << ", O bit:" << (iface->getOBit()?"1":"0") << "->" << (ptr->o_bit?"1":"0")
                         << ")."  << LogEnd;
             iface->updateState(ptr);
+            linkChanged();
         }
         ptr = ptr->next;
     }
@@ -9,6 +9,8 @@
  */
 
 #include <iostream>
+#include <set>
+#include <map>
 
 class TClntIfaceMgr;
 class TClntMsg;
@@ -22,6 +24,8 @@ class TClntIfaceIface;
 #include "ClntAddrMgr.h"
 #include "ClntTransMgr.h"
 #include "ClntIfaceIface.h"
+#include "ClntPrefixSplit.h"
+#include "ClntWorker.h"
 #include "IPv6Addr.h"
 #include "ClntMsg.h"
 #include "ScriptParams.h"
@@ -52,7 +56,7 @@ public:
     
     bool sendMulticast(int iface, char *msg, int msgsize);
     
-    SPtr<TClntMsg> select(unsigned int timeout);
+    SPtr<TClntMsg> select(uint64_t timeoutMs);
 
 #ifdef MOD_REMOTE_AUTOCONF
     bool notifyRemoteScripts(SPtr<TIPv6Addr> receivedAddr, SPtr<TIPv6Addr> serverAddr, int ifindex);
@@ -60,6 +64,15 @@ public:
 
     bool fqdnAdd(SPtr<TClntIfaceIface> iface, const std::string& domainname);
     bool fqdnDel(SPtr<TClntIfaceIface> iface, SPtr<TAddrIA> ia, const std::string& domainname);
+    void fqdnAddDone(int ifindex, bool success);
+
+    virtual void notifyScript(const std::string& scriptName, std::string action,
+                              TNotifyScriptParams& params);
+
+    // --- background jobs ---
+    bool processJobs();
+    unsigned int countJobs();
+    void finishJobs();
 
     bool addPrefix   (int iface, SPtr<TIPv6Addr> prefix, int prefixLen,
                       unsigned int pref, unsigned int valid,
@@ -78,13 +91,30 @@ public:
     bool doDuties();
 
     void redetectIfaces();
+    void linkChanged();
 
   private:
     bool modifyPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLen,
                       unsigned int pref, unsigned int valid, PrefixModifyMode mode,
                       TNotifyScriptParams* params /*= NULL*/);
+    int updateSubPrefix(const TClntPrefixSplit::TSubPrefix& sub,
+                        unsigned int pref, unsigned int valid);
+    bool getDownlinkIfaces(SPtr<TClntIfaceIface> uplink, TIfaceIfaceLst& ifaceLst);
+    bool findDownlinkIfaces(SPtr<TClntIfaceIface> uplink, TIfaceIfaceLst& ifaceLst);
 
     std::string XmlFile;
+    TClntPrefixSplit PrefixSplit;
+    TClntWorker Worker;
+
+    std::set<int> FqdnPending_;             // interfaces with DNS Update in progress
+    std::map<int, unsigned int> FqdnFailures_; // failed DNS Updates, by interface
+    bool FqdnChanged_;                      // FQDN state changed by finished DNS Update
+
+    // downlink interfaces found for DownlinkUplink_, valid until next link change
+    bool DownlinkValid_;
+    int DownlinkUplink_;
+    bool DownlinkSplit_;
+    TIfaceIfaceLst DownlinkIfaces_;
 
     static TClntIfaceMgr* Instance;
 };
@@ -0,0 +1,267 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <fstream>
+#include <sstream>
+#include <set>
+#include <string.h>
+#include "ClntPrefixSplit.h"
+#include "Logger.h"
+
+using namespace std;
+
+TClntPrefixSplit::TClntPrefixSplit(const std::string& file)
+    :File(file)
+{
+}
+
+TClntPrefixSplit::TPlan* TClntPrefixSplit::find(SPtr<TIPv6Addr> prefix, int prefixLen)
+{
+    for (list<TPlan>::iterator plan = Plans.begin(); plan != Plans.end(); ++plan) {
+        if (plan->PrefixLen == prefixLen && *plan->Prefix == *prefix)
+            return &(*plan);
+    }
+    return 0;
+}
+
+/**
+ * @brief computes split plan for a delegated prefix
+ *
+ * Up to 255 interfaces get /prefixLen+8 sub-prefixes (as in earlier versions,
+ * the interface index is used as slot if possible). More interfaces need more
+ * bits. Slot 0 is never used, so the first sub-prefix never equals the
+ * delegated prefix.
+ *
+ * @param prefix delegated prefix
+ * @param prefixLen delegated prefix length
+ * @param uplink ifindex of the interface the prefix was delegated on
+ * @param downlinks interfaces the prefix is split among
+ *
+ * @return new plan (or NULL if the prefix is too long to be split)
+ */
+TClntPrefixSplit::TPlan* TClntPrefixSplit::create(SPtr<TIPv6Addr> prefix, int prefixLen,
+                                                  int uplink, const TIfaceIfaceLst& downlinks)
+{
+    unsigned int cnt = downlinks.size();
+    int bits = 0;
+    if (cnt > 1) {
+        bits = 8;
+        while ( (1u << bits) <= cnt)
+            bits++;
+    }
+    if (prefixLen + bits > 128) {
+        Log(Error) << "PD: Unable to split prefix " << prefix->getPlain() << "/" << prefixLen
+                   << " among " << cnt << " interfaces: /" << prefixLen + bits
+                   << " sub-prefixes would be needed." << LogEnd;
+        return 0;
+    }
+
+    unsigned int maxSlot = (1u << bits) - 1;
+    vector<SPtr<TIfaceIface> > ifaces(downlinks.begin(), downlinks.end());
+    vector<unsigned int> slots(cnt, 0);
+    set<unsigned int> used;
+
+    if (bits) {
+        // 1st pass: slots remembered from previous plans
+        for (unsigned int i = 0; i < cnt; i++) {
+            map<string, unsigned int>::const_iterator s = Slots.find(ifaces[i]->getName());
+            if (s != Slots.end() && s->second && s->second <= maxSlot && !used.count(s->second)) {
+                slots[i] = s->second;
+                used.insert(s->second);
+            }
+        }
+        // 2nd pass: interface index
+        for (unsigned int i = 0; i < cnt; i++) {
+            unsigned int id = ifaces[i]->getID();
+            if (!slots[i] && id && id <= maxSlot && !used.count(id)) {
+                slots[i] = id;
+                used.insert(id);
+            }
+        }
+        // 3rd pass: whatever is left
+        unsigned int next = 1;
+        for (unsigned int i = 0; i < cnt; i++) {
+            if (slots[i])
+                continue;
+            while (used.count(next))
+                next++;
+            slots[i] = next;
+            used.insert(next);
+        }
+    }
+
+    TPlan plan;
+    plan.Prefix = prefix;
+    plan.PrefixLen = prefixLen;
+    plan.Uplink = uplink;
+    for (unsigned int i = 0; i < cnt; i++) {
+        TSubPrefix sub;
+        sub.Iface = ifaces[i]->getName();
+        sub.Ifindex = ifaces[i]->getID();
+        sub.Slot = slots[i];
+        sub.Prefix = splitPrefix(prefix, prefixLen, slots[i], bits);
+        sub.PrefixLen = prefixLen + bits;
+        sub.Configured = false;
+        sub.Pref = 0;
+        sub.Valid = 0;
+        plan.SubPrefixes.push_back(sub);
+
+        if (bits)
+            Slots[sub.Iface] = sub.Slot;
+    }
+
+    Log(Info) << "PD: Prefix " << prefix->getPlain() << "/" << prefixLen << " split into "
+              << cnt << " /" << prefixLen + bits << " sub-prefix(es)." << LogEnd;
+
+    Plans.push_back(plan);
+    return &Plans.back();
+}
+
+void TClntPrefixSplit::remove(SPtr<TIPv6Addr> prefix, int prefixLen)
+{
+    for (list<TPlan>::iterator plan = Plans.begin(); plan != Plans.end(); ++plan) {
+        if (plan->PrefixLen == prefixLen && *plan->Prefix == *prefix) {
+            Plans.erase(plan);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief checks if plan was computed for specified downlink interfaces
+ *
+ * Downlink interfaces depend on configuration (downlink-prefix-ifaces) and on
+ * the state of interfaces, so both may have changed since the plan was
+ * computed or stored.
+ *
+ * @param plan split plan
+ * @param downlinks current downlink interfaces
+ *
+ * @return true if plan covers exactly these interfaces
+ */
+bool TClntPrefixSplit::matches(const TPlan& plan, const TIfaceIfaceLst& downlinks)
+{
+    if (plan.SubPrefixes.size() != downlinks.size())
+        return false;
+
+    set<pair<string, int> > current;
+    for (TIfaceIfaceLst::const_iterator i = downlinks.begin(); i != downlinks.end(); ++i) {
+        current.insert(make_pair((*i)->getName(), (*i)->getID()));
+    }
+    for (vector<TSubPrefix>::const_iterator sub = plan.SubPrefixes.begin();
+         sub != plan.SubPrefixes.end(); ++sub) {
+        if (!current.count(make_pair(sub->Iface, sub->Ifindex)))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief puts slot into bits that follow delegated prefix
+ *
+ * @param prefix delegated prefix
+ * @param prefixLen delegated prefix length
+ * @param slot slot number
+ * @param bits number of bits used for slots (0 means no split)
+ *
+ * @return sub-prefix
+ */
+SPtr<TIPv6Addr> TClntPrefixSplit::splitPrefix(SPtr<TIPv6Addr> prefix, int prefixLen,
+                                              unsigned int slot, int bits)
+{
+    char buf[16];
+    memmove(buf, prefix->getAddr(), 16);
+
+    // clear out if there is anything there, i.e. server assigned prefix
+    // with garbage in host section
+    for (int b = 0; b < bits; b++) {
+        int pos = prefixLen + b;
+        unsigned char mask = 0x80 >> (pos % 8);
+        if (slot & (1u << (bits - 1 - b)))
+            buf[pos/8] |= mask;
+        else
+            buf[pos/8] &= ~mask;
+    }
+    return new TIPv6Addr(buf, false);
+}
+
+/**
+ * @brief loads plans stored by save()
+ *
+ * Configured flags are not stored, so after restart every sub-prefix is
+ * configured again on the first add/update.
+ *
+ * @return true if file was loaded
+ */
+bool TClntPrefixSplit::load()
+{
+    ifstream f(File.c_str());
+    if (!f.is_open())
+        return false;
+
+    Plans.clear();
+    Slots.clear();
+
+    string line;
+    while (getline(f, line)) {
+        istringstream s(line);
+        string kw;
+        s >> kw;
+        if (kw == "slot") {
+            string name;
+            unsigned int slot = 0;
+            if (s >> name >> slot)
+                Slots[name] = slot;
+        } else if (kw == "plan") {
+            string addr;
+            TPlan plan;
+            if (!(s >> addr >> plan.PrefixLen >> plan.Uplink))
+                continue;
+            plan.Prefix = new TIPv6Addr(addr.c_str(), true);
+            Plans.push_back(plan);
+        } else if (kw == "sub" && !Plans.empty()) {
+            string addr;
+            TSubPrefix sub;
+            if (!(s >> sub.Iface >> sub.Ifindex >> sub.Slot >> addr >> sub.PrefixLen))
+                continue;
+            sub.Prefix = new TIPv6Addr(addr.c_str(), true);
+            sub.Configured = false;
+            sub.Pref = 0;
+            sub.Valid = 0;
+            Plans.back().SubPrefixes.push_back(sub);
+        }
+    }
+
+    Log(Debug) << "PD: " << Plans.size() << " prefix split plan(s) loaded from " << File << "." << LogEnd;
+    return true;
+}
+
+bool TClntPrefixSplit::save()
+{
+    ofstream f(File.c_str());
+    if (!f.is_open()) {
+        Log(Warning) << "PD: Unable to write prefix split plan to " << File << "." << LogEnd;
+        return false;
+    }
+
+    f << "# prefix split plan generated by Dibbler, do not edit" << endl;
+    for (map<string, unsigned int>::const_iterator s = Slots.begin(); s != Slots.end(); ++s) {
+        f << "slot " << s->first << " " << s->second << endl;
+    }
+    for (list<TPlan>::const_iterator plan = Plans.begin(); plan != Plans.end(); ++plan) {
+        f << "plan " << plan->Prefix->getPlain() << " " << plan->PrefixLen << " "
+          << plan->Uplink << endl;
+        for (vector<TSubPrefix>::const_iterator sub = plan->SubPrefixes.begin();
+             sub != plan->SubPrefixes.end(); ++sub) {
+            f << "sub " << sub->Iface << " " << sub->Ifindex << " " << sub->Slot << " "
+              << sub->Prefix->getPlain() << " " << sub->PrefixLen << endl;
+        }
+    }
+    return true;
+}
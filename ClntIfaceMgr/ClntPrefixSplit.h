@@ -0,0 +1,75 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef CLNTPREFIXSPLIT_H
+#define CLNTPREFIXSPLIT_H
+
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include "SmartPtr.h"
+#include "IPv6Addr.h"
+#include "Iface.h"
+
+/// @brief keeps track of how delegated prefixes are split among downlink interfaces
+///
+/// For every delegated prefix a plan is computed once: each downlink interface
+/// gets a slot number that is put into the bits just after the delegated prefix.
+/// Slots are remembered per interface name, so the same interface gets the same
+/// sub-prefix even if the delegated prefix changes or the client is restarted.
+/// The plan also remembers which sub-prefixes were configured in the system and
+/// with what lifetimes, so renews only touch what actually changed. A plan is
+/// only valid for the downlink interfaces it was computed for (see matches()).
+class TClntPrefixSplit
+{
+ public:
+    /// single sub-prefix assigned to a downlink interface
+    struct TSubPrefix {
+        std::string Iface;        ///< downlink interface name
+        int Ifindex;              ///< downlink interface index
+        unsigned int Slot;        ///< value put into the split bits
+        SPtr<TIPv6Addr> Prefix;   ///< sub-prefix
+        int PrefixLen;            ///< sub-prefix length
+        bool Configured;          ///< has it been configured since startup?
+        unsigned int Pref;        ///< preferred lifetime it was configured with
+        unsigned int Valid;       ///< valid lifetime it was configured with
+    };
+
+    /// split plan for a single delegated prefix
+    struct TPlan {
+        SPtr<TIPv6Addr> Prefix;   ///< delegated prefix
+        int PrefixLen;            ///< delegated prefix length
+        int Uplink;               ///< ifindex the prefix was delegated on
+        std::vector<TSubPrefix> SubPrefixes;
+    };
+
+    TClntPrefixSplit(const std::string& file);
+
+    TPlan* find(SPtr<TIPv6Addr> prefix, int prefixLen);
+    TPlan* create(SPtr<TIPv6Addr> prefix, int prefixLen, int uplink,
+                  const TIfaceIfaceLst& downlinks);
+    void remove(SPtr<TIPv6Addr> prefix, int prefixLen);
+    static bool matches(const TPlan& plan, const TIfaceIfaceLst& downlinks);
+
+    bool load();
+    bool save();
+
+    static SPtr<TIPv6Addr> splitPrefix(SPtr<TIPv6Addr> prefix, int prefixLen,
+                                       unsigned int slot, int bits);
+
+ private:
+    std::string File;
+    std::list<TPlan> Plans;
+
+    /// interface name -> slot, kept even when plans are removed
+    std::map<std::string, unsigned int> Slots;
+};
+
+#endif
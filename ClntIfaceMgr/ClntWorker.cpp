@@ -0,0 +1,183 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef WIN32
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+#include <string.h>
+#include "ClntWorker.h"
+#include "Logger.h"
+
+using namespace std;
+
+#ifndef WIN32
+/// does nothing, just interrupts select() in the main loop, so finished
+/// jobs are reaped right away (select() is never restarted, SA_RESTART
+/// only keeps other system calls from failing with EINTR)
+static void childExited(int)
+{
+}
+#endif
+
+TClntWorker::TClntWorker()
+{
+#ifndef WIN32
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = childExited;
+    sa.sa_flags = SA_NOCLDSTOP | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGCHLD, &sa, NULL);
+#endif
+}
+
+TClntWorker::~TClntWorker()
+{
+    for (TQueues::iterator q = Queues.begin(); q != Queues.end(); ++q)
+        stop(q->second);
+}
+
+/// @brief queues a job (and starts it, if its queue is idle)
+///
+/// @param queue queue the job is added to (interface index)
+/// @param job job to be executed
+void TClntWorker::add(int queue, SPtr<TJob> job)
+{
+#ifdef WIN32
+    job->done(job->run());
+#else
+    TQueue& q = Queues[queue];
+    q.Jobs.push_back(job);
+    Log(Debug) << "Worker: " << job->Name << " queued (" << q.Jobs.size()
+               << " job(s) pending for interface " << queue << ")." << LogEnd;
+    if (!q.Pid)
+        start(q);
+#endif
+}
+
+void TClntWorker::start(TQueue& queue)
+{
+#ifndef WIN32
+    while (!queue.Jobs.empty() && !queue.Pid) {
+        SPtr<TJob> job = queue.Jobs.front();
+        pid_t pid = fork();
+        if (pid < 0) {
+            Log(Warning) << "Worker: Unable to start " << job->Name
+                         << " in background, running it now." << LogEnd;
+            int result = job->run();
+            queue.Jobs.pop_front();
+            job->done(result);
+            continue;
+        }
+        if (!pid) {
+            // child: client signal handlers and shutdown don't apply here.
+            // Own process group, so anything the job spawns (e.g. a script)
+            // is killed with it on timeout.
+            setpgid(0, 0);
+            signal(SIGINT, SIG_DFL);
+            signal(SIGTERM, SIG_DFL);
+            signal(SIGCHLD, SIG_DFL);
+            _exit(job->run() & 0xff);
+        }
+        // also set in the parent, so the group exists before stop() may use it
+        setpgid(pid, pid);
+        queue.Pid = pid;
+        queue.Started = time(NULL);
+    }
+#endif
+}
+
+void TClntWorker::complete(TQueue& queue, int result)
+{
+    SPtr<TJob> job = queue.Jobs.front();
+    queue.Jobs.pop_front();
+    queue.Pid = 0;
+    job->done(result);
+}
+
+/// kills running job of a queue (if any), together with its children
+void TClntWorker::stop(TQueue& queue)
+{
+#ifndef WIN32
+    if (queue.Pid) {
+        ::kill(-queue.Pid, SIGKILL);
+        waitpid(queue.Pid, NULL, 0);
+        queue.Pid = 0;
+    }
+#endif
+}
+
+/// @brief processes finished jobs (if any) and starts the next ones
+void TClntWorker::poll()
+{
+#ifndef WIN32
+    TQueues::iterator q = Queues.begin();
+    while (q != Queues.end()) {
+        TQueue& queue = q->second;
+        while (queue.Pid) {
+            int status = 0;
+            pid_t pid = waitpid(queue.Pid, &status, WNOHANG);
+            if (pid == 0) {
+                // still running
+                SPtr<TJob> job = queue.Jobs.front();
+                if (time(NULL) - queue.Started < (time_t)job->Timeout)
+                    break;
+                Log(Warning) << "Worker: " << job->Name << " did not finish within "
+                             << job->Timeout << " second(s), killing it." << LogEnd;
+                stop(queue);
+                complete(queue, -1);
+            } else if (pid < 0) {
+                complete(queue, -1);
+            } else {
+                complete(queue, WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+            }
+            start(queue);
+        }
+        if (queue.Jobs.empty())
+            Queues.erase(q++);
+        else
+            ++q;
+    }
+#endif
+}
+
+/// @brief waits for all queued jobs (used during shutdown)
+///
+/// @param timeout max number of seconds to wait (remaining jobs are dropped)
+void TClntWorker::finish(unsigned int timeout)
+{
+#ifndef WIN32
+    time_t deadline = time(NULL) + timeout;
+    poll();
+    while (!Queues.empty() && time(NULL) < deadline) {
+        usleep(100000);
+        poll();
+    }
+    if (Queues.empty())
+        return;
+
+    Log(Warning) << "Worker: " << count() << " job(s) not finished in "
+                 << timeout << " second(s), dropping them." << LogEnd;
+    for (TQueues::iterator q = Queues.begin(); q != Queues.end(); ++q)
+        stop(q->second);
+    Queues.clear();
+#endif
+}
+
+/// returns number of queued (including running) jobs
+unsigned int TClntWorker::count()
+{
+    unsigned int cnt = 0;
+    for (TQueues::const_iterator q = Queues.begin(); q != Queues.end(); ++q)
+        cnt += q->second.Jobs.size();
+    return cnt;
+}
@@ -0,0 +1,76 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef CLNTWORKER_H
+#define CLNTWORKER_H
+
+#include <string>
+#include <list>
+#include <map>
+#include <time.h>
+#include "SmartPtr.h"
+
+/// @brief runs side effects (DNS updates, scripts) in background
+///
+/// Jobs are kept in queues, one per interface. Jobs in a queue are executed
+/// one at a time, in the order they were added, so e.g. DNS record removal
+/// never overtakes its addition. Queues run in parallel, so a slow DNS
+/// server or a hung script only delays jobs of its own interface. Each job
+/// is run in a child process, so retransmissions and renewals are not
+/// blocked either. poll() must be called from the main loop: it reaps
+/// finished jobs (calling their done() method) and starts the next ones.
+/// Child exit interrupts the main loop's select(), so jobs are reaped as
+/// soon as they finish. On systems without fork() jobs are run synchronously.
+class TClntWorker
+{
+ public:
+    class TJob
+    {
+    public:
+        /// @param name job name (used in logs)
+        /// @param timeout job is killed if it does not finish within that many seconds
+        TJob(const std::string& name, unsigned int timeout)
+            :Name(name), Timeout(timeout) {}
+        virtual ~TJob() {}
+
+        /// executed in background, returned value (0-255) is passed to done()
+        virtual int run() = 0;
+
+        /// executed in the main loop after run() completed (result < 0 if it failed)
+        virtual void done(int result) = 0;
+
+        std::string Name;
+        unsigned int Timeout;
+    };
+
+    TClntWorker();
+    ~TClntWorker();
+
+    void add(int queue, SPtr<TJob> job);
+    void poll();
+    void finish(unsigned int timeout);
+    unsigned int count();
+
+ private:
+    struct TQueue {
+        TQueue() :Pid(0), Started(0) {}
+        std::list<SPtr<TJob> > Jobs; ///< queued jobs, first one is running
+        int Pid;                     ///< pid of the running job (0 if none)
+        time_t Started;              ///< when the running job was started
+    };
+    typedef std::map<int, TQueue> TQueues;
+
+    void start(TQueue& queue);
+    void complete(TQueue& queue, int result);
+    void stop(TQueue& queue);
+
+    TQueues Queues; ///< job queues, by interface index
+};
+
+#endif
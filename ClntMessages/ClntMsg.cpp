@@ -180,6 +180,10 @@ TClntMsg::TClntMsg(int iface, SPtr<TIPv6Addr> addr, char* buf, int bufSize)
 	case OPTION_INFORMATION_REFRESH_TIME:
 	    ptr = new TClntOptLifetime(buf+pos, length, this);
 	    break;
+	case OPTION_SOL_MAX_RT:
+	case OPTION_INF_MAX_RT:
+	    ptr = new TOptInteger(code, OPTION_SOL_MAX_RT_LEN, buf+pos, length, this);
+	    break;
 	case OPTION_AFTR_NAME:
 	    ptr = new TOptDomainLst(code, buf+pos, length, this);
 	    break;
@@ -235,7 +239,7 @@ TClntMsg::TClntMsg(int iface, SPtr<TIPv6Addr> addr, char* buf, int bufSize)
 	}
 
 	if ( (ptr) && (ptr->isValid()) ) {
-	    Options.push_back( ptr );
+	    addOption( ptr );
 	} else {
 	    Log(Warning) << "Option " << code << " is invalid. Ignoring." << LogEnd;
 	}
@@ -321,10 +325,11 @@ TClntMsg::~TClntMsg() {
 void TClntMsg::setDefaults()
 {
     FirstTimeStamp = time(NULL);
-    LastTimeStamp  = time(NULL);
+    NextTimeStamp  = TClntTimerQueue::now();
 
     RC  = 0;
     RT  = 0;
+    RDLeft = 0;
     IRT = 0;
     MRT = 0;
     MRC = 0;
@@ -338,29 +343,90 @@ void TClntMsg::setDefaults()
     PeerAddr_.reset();
 }
 
+/// returns number of seconds to the next transmission (rounded up)
 unsigned long TClntMsg::getTimeout()
 {
-    long diff = (LastTimeStamp+RT) - time(NULL);
-    return (diff<0) ? 0 : diff;
+    return (unsigned long)((getTimeoutMs() + 999)/1000);
+}
+
+/// returns number of milliseconds to the next transmission
+uint64_t TClntMsg::getTimeoutMs()
+{
+    uint64_t now = TClntTimerQueue::now();
+    return (NextTimeStamp > now) ? NextTimeStamp - now : 0;
+}
+
+/**
+ * @brief returns RAND factor used in retransmission timeouts
+ *
+ * See RFC8415, section 15. Random generator is seeded once, when
+ * ClntTransMgr is created.
+ *
+ * @param positive should the value be strictly positive?
+ *
+ * @return random value between -0.1 and 0.1 (or between 0 and 0.1)
+ */
+double TClntMsg::getRand(bool positive)
+{
+    double r = (double)rand()/((double)RAND_MAX + 1.0);
+    return positive ? 0.1*(1.0 - r) : 0.2*r - 0.1;
+}
+
+/**
+ * @brief delays the first transmission
+ *
+ * Used for SOLICIT and INF-REQUEST (see SOL_MAX_DELAY, INF_MAX_DELAY), so
+ * clients that start at the same time (e.g. after power outage) don't
+ * send their messages at the same time. The message is sent when its
+ * timeout expires.
+ *
+ * @param delay delay (in ms)
+ */
+void TClntMsg::sendDelayed(uint64_t delay)
+{
+    NextTimeStamp = TClntTimerQueue::now() + delay;
+    Log(Debug) << getName() << " transmission delayed by " << delay << "ms." << LogEnd;
+}
+
+/**
+ * @brief changes Maximum Retransmission Time
+ *
+ * Used when server sent SOL_MAX_RT or INF_MAX_RT option. The next
+ * retransmission timeout will be capped with the new value.
+ *
+ * @param mrt new MRT (in seconds)
+ */
+void TClntMsg::setMRT(long mrt)
+{
+    MRT = mrt;
 }
 
 void TClntMsg::send()
 {
     char* pkt = new char[getSize()];
 
-    srand((uint32_t)time(NULL));
-    if (!RC)
-	RT=(int)(0.5+IRT+IRT*(0.2*(double)rand()/(double)RAND_MAX-0.1));
-    else
-	RT =(int)(0.5+2.0*RT+RT*(0.2*(double)rand()/(double)RAND_MAX-0.1));
+    if (!RC) {
+        // RFC8415, section 15: first RT for SOLICIT must be greater than IRT
+        RT = (uint64_t)(IRT*1000*(1.0 + getRand(MsgType == SOLICIT_MSG)));
+        RDLeft = (uint64_t)MRD*1000;
+
+        // the first message in exchange has elapsed time set to 0
+        SPtr<TClntOptElapsed> elapsed = (Ptr*)getOption(OPTION_ELAPSED_TIME);
+        if (elapsed)
+            elapsed->reset();
+    } else {
+        RT = (uint64_t)(2.0*RT*(1.0 + getRand(false)));
+    }
 
-    if (MRT != 0 && RT>MRT)
-	RT = (int)(0.5+MRT + MRT*(0.2*(double)rand()/(double)RAND_MAX-0.1));
+    if (MRT != 0 && RT > (uint64_t)MRT*1000)
+        RT = (uint64_t)(MRT*1000*(1.0 + getRand(false)));
 
-    if ((MRD != 0) && (RT>MRD))
-	RT = MRD;
-    if (MRD) 
-      MRD -= RT;
+    if (RDLeft) {
+        if (RT > RDLeft)
+            RT = RDLeft;
+        RDLeft -= RT;
+        MRD = (long)((RDLeft + 999)/1000);
+    }
 
     RC++;
 
@@ -394,7 +460,7 @@ void TClntMsg::send()
 		   << "/" << Iface << " to multicast." << LogEnd;
 	ClntIfaceMgr().sendMulticast(Iface, pkt, getSize());
     }
-    LastTimeStamp = time(NULL);
+    NextTimeStamp = TClntTimerQueue::now() + RT;
     delete [] pkt;
 }
 
@@ -501,7 +567,7 @@ void TClntMsg::appendAuthenticationOption()
 void TClntMsg::appendElapsedOption() {
     // include ELAPSED option
     if (!getOption(OPTION_ELAPSED_TIME))
-	Options.push_back(new TClntOptElapsed(this));
+	addOption(new TClntOptElapsed(this));
 }
 
 /* CHANGED in this function: According to RFC3315,'status==STATE_NOTCONFIGURED' is not a must.
@@ -520,7 +586,7 @@ void TClntMsg::appendRequestedOptions() {
 	 ClntCfgMgr().getReconfigure())
     {
 	SPtr<TOptEmpty> optReconfigure = new TOptEmpty(OPTION_RECONF_ACCEPT, this);
-	Options.push_back( (Ptr*) optReconfigure);
+	addOption( (Ptr*) optReconfigure);
     }
 
     SPtr<TClntOptOptionRequest> optORO = new TClntOptOptionRequest(iface, this);
@@ -542,7 +608,7 @@ void TClntMsg::appendRequestedOptions() {
 	List(TIPv6Addr) * dnsLst = iface->getProposedDNSServerLst();
 	if (dnsLst->count()) {
 	    // if there are any hints specified in config file, include them
-	    Options.push_back( new TOptAddrLst(OPTION_DNS_SERVERS, *dnsLst, this) );
+	    addOption( new TOptAddrLst(OPTION_DNS_SERVERS, *dnsLst, this) );
 	}
 	iface->setDNSServerState(STATE_INPROCESS);
     }
@@ -554,7 +620,7 @@ void TClntMsg::appendRequestedOptions() {
 	List(string) * domainsLst = iface->getProposedDomainLst();
 	if ( domainsLst->count() ) {
 	    // if there are any hints specified in config file, include them
-	    Options.push_back( new TOptDomainLst(OPTION_DOMAIN_LIST, *domainsLst, this));
+	    addOption( new TOptDomainLst(OPTION_DOMAIN_LIST, *domainsLst, this));
 	}
 	iface->setDomainState(STATE_INPROCESS);
     }
@@ -566,7 +632,7 @@ void TClntMsg::appendRequestedOptions() {
 	List(TIPv6Addr) * ntpLst = iface->getProposedNTPServerLst();
 	if (ntpLst->count()) {
 	    // if there are any hints specified in config file, include them
-	    Options.push_back( new TOptAddrLst(OPTION_SNTP_SERVERS, *ntpLst, this) );
+	    addOption( new TOptAddrLst(OPTION_SNTP_SERVERS, *ntpLst, this) );
 	}
 	iface->setNTPServerState(STATE_INPROCESS);
     }
@@ -579,7 +645,7 @@ void TClntMsg::appendRequestedOptions() {
 	if (timezone.length()) {
 	    // if there are any hints specified in config file, include them
 	    SPtr<TClntOptTimeZone> opt = new TClntOptTimeZone(timezone,this);
-	    Options.push_back( (Ptr*)opt );
+	    addOption( (Ptr*)opt );
 	}
 	iface->setTimezoneState(STATE_INPROCESS);
     }
@@ -591,7 +657,7 @@ void TClntMsg::appendRequestedOptions() {
 	List(TIPv6Addr) * lst = iface->getProposedSIPServerLst();
 	if ( lst->count()) {
 	    // if there are any hints specified in config file, include them
-	    Options.push_back( new TOptAddrLst(OPTION_SIP_SERVER_A, *lst, this ) );
+	    addOption( new TOptAddrLst(OPTION_SIP_SERVER_A, *lst, this ) );
 	}
 	iface->setSIPServerState(STATE_INPROCESS);
     }
@@ -603,7 +669,7 @@ void TClntMsg::appendRequestedOptions() {
 	List(string) * domainsLst = iface->getProposedSIPDomainLst();
 	if ( domainsLst->count() ) {
 	    // if there are any hints specified in config file, include them
-	    Options.push_back( new TOptDomainLst(OPTION_SIP_SERVER_D, *domainsLst, this ));
+	    addOption( new TOptDomainLst(OPTION_SIP_SERVER_D, *domainsLst, this ));
 	}
 	iface->setSIPDomainState(STATE_INPROCESS);
     }
@@ -616,7 +682,7 @@ void TClntMsg::appendRequestedOptions() {
 	{
 	    SPtr<TClntOptFQDN> opt = new TClntOptFQDN( fqdn,this );
 	    opt->setSFlag(ClntCfgMgr().getFQDNFlagS());
-	    Options.push_back( (Ptr*)opt );
+	    addOption( (Ptr*)opt );
 	}
 	iface->setFQDNState(STATE_INPROCESS);
     }
@@ -628,7 +694,7 @@ void TClntMsg::appendRequestedOptions() {
 	List(TIPv6Addr) * lst = iface->getProposedNISServerLst();
 	if ( lst->count() ) {
 	    // if there are any hints specified in config file, include them
-	    Options.push_back( new TOptAddrLst(OPTION_NIS_SERVERS, *lst, this ));
+	    addOption( new TOptAddrLst(OPTION_NIS_SERVERS, *lst, this ));
 	}
 	iface->setNISServerState(STATE_INPROCESS);
     }
@@ -638,7 +704,7 @@ void TClntMsg::appendRequestedOptions() {
 	optORO->addOption(OPTION_NIS_DOMAIN_NAME);
 	string domain = iface->getProposedNISDomain();
 	if (domain.length()) {
-	    Options.push_back( new TOptDomainLst(OPTION_NIS_DOMAIN_NAME, domain, this) );
+	    addOption( new TOptDomainLst(OPTION_NIS_DOMAIN_NAME, domain, this) );
 	}
 	iface->setNISDomainState(STATE_INPROCESS);
     }
@@ -650,7 +716,7 @@ void TClntMsg::appendRequestedOptions() {
 	List(TIPv6Addr) * lst = iface->getProposedNISPServerLst();
 	if ( lst->count() ) {
 	    // if there are any hints specified in config file, include them
-	    Options.push_back( new TOptAddrLst(OPTION_NISP_SERVERS, *lst, this) );
+	    addOption( new TOptAddrLst(OPTION_NISP_SERVERS, *lst, this) );
 	}
 	iface->setNISPServerState(STATE_INPROCESS);
     }
@@ -660,7 +726,7 @@ void TClntMsg::appendRequestedOptions() {
 	optORO->addOption(OPTION_NISP_DOMAIN_NAME);
 	string domain = iface->getProposedNISPDomain();
 	if (domain.length()) {
-	    Options.push_back( new TOptDomainLst(OPTION_NISP_DOMAIN_NAME, domain, this) );
+	    addOption( new TOptDomainLst(OPTION_NISP_DOMAIN_NAME, domain, this) );
 	}
 	iface->setNISPDomainState(STATE_INPROCESS);
     }
@@ -682,7 +748,7 @@ void TClntMsg::appendRequestedOptions() {
 	iface->firstVendorSpec();
 
 	while (optVendor = iface->getVendorSpec()) {
-	    Options.push_back( (Ptr*) optVendor);
+	    addOption( (Ptr*) optVendor);
 	}
     }
 
@@ -722,7 +788,7 @@ void TClntMsg::appendRequestedOptions() {
 	     (*gen)->State == STATE_CONFIRMME) {
 	    optORO->addOption( (*gen)->OptionType);
 	    if ( (*gen)->Option && (*gen)->Always)
-		Options.push_back( (*gen)->Option );
+		addOption( (*gen)->Option );
 	}
     }
 
@@ -731,9 +797,18 @@ void TClntMsg::appendRequestedOptions() {
 	optORO->addOption(OPTION_NEIGHBORS);
 #endif
 
+    // --- option: SOL_MAX_RT, INF_MAX_RT (RFC8415, 18.2) ---
+    // servers use them to slow down clients, so they are always requested
+    // (but INF-REQUEST is not sent only because of them)
+    if (this->MsgType == SOLICIT_MSG || this->MsgType == REQUEST_MSG ||
+        this->MsgType == RENEW_MSG || this->MsgType == REBIND_MSG)
+	optORO->addOption(OPTION_SOL_MAX_RT);
+    if (this->MsgType == INFORMATION_REQUEST_MSG && optORO->count())
+	optORO->addOption(OPTION_INF_MAX_RT);
+
     // final setup: Did we add any options at all?
     if ( optORO->count() )
-	Options.push_back( (Ptr*) optORO );
+	addOption( (Ptr*) optORO );
 }
 
 /**
@@ -756,7 +831,7 @@ void TClntMsg::appendTAOptions(bool switchToInProcess)
 	    // ... which are not yet configured
 	    SPtr<TOpt> ptrOpt = new TClntOptTA(ptrTA->getIAID(), this);
 
-	    Options.push_back ( (Ptr*) ptrOpt);
+	    addOption(ptrOpt);
 	    Log(Debug) << "TA option (IAID=" << ptrTA->getIAID() << ") was added." << LogEnd;
 	    if (switchToInProcess)
 		ptrTA->setState(STATE_INPROCESS);
@@ -769,7 +844,7 @@ bool TClntMsg::appendClientID()
 {
     SPtr<TOpt> ptr;
     ptr = new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this );
-    Options.push_back( ptr );
+    addOption( ptr );
     return true;
 }
 
@@ -859,6 +934,7 @@ void TClntMsg::answer(SPtr<TClntMsg> reply)
 		if ( ptrIA->getIAID() == clntOpt->getIAID() )
 		{
 		    requestOpt = Options.erase(requestOpt);
+		    optionsChanged();
 		    break;
 		}
 	    }
@@ -889,6 +965,7 @@ void TClntMsg::answer(SPtr<TClntMsg> reply)
 		if ( ta->getIAID() == ptrTA->getIAID() )
 		{
 		    requestOpt = Options.erase(requestOpt);
+		    optionsChanged();
 		    break;
 		}
 	    }
@@ -954,6 +1031,7 @@ void TClntMsg::answer(SPtr<TClntMsg> reply)
 		if ( pd->getIAID() == reqPD->getIAID() )
 		{
 		    requestOpt = Options.erase(requestOpt);
+		    optionsChanged();
 		    break;
 		}
 	    }
@@ -1309,6 +1387,7 @@ void TClntMsg::deletePD(SPtr<TOpt> pd_) {
         if ( pd->getIAID() == delPD->getIAID() )
         {
             opt = Options.erase(opt);
+            optionsChanged();
             break;
         }
     }
@@ -28,7 +28,10 @@ public:
     TClntMsg(int iface, SPtr<TIPv6Addr> addr, int msgType);
     ~TClntMsg();
     unsigned long getTimeout();
+    uint64_t getTimeoutMs();
     void send();
+    void sendDelayed(uint64_t delay);
+    void setMRT(long mrt);
     SPtr<TOpt> parseExtraOption(const char *buf, unsigned int code, unsigned int length);
 
     //answer for a specific message
@@ -57,17 +60,19 @@ public:
     bool check(bool clntIDmandatory, bool srvIDmandatory);
     bool appendClientID();
 
-    long IRT;           // Initial Retransmission Time
-    long MRT;           // Maximum Retransmission Time
+    long IRT;           // Initial Retransmission Time (in seconds)
+    long MRT;           // Maximum Retransmission Time (in seconds)
     long MRC;           // Maximum Retransmission Count
-    long MRD;           // Maximum Retransmission Duration
+    long MRD;           // Maximum Retransmission Duration (in seconds, 0 when elapsed)
     int RC;             // Retransmission counter (counts to 0)
-    int RT;             // Retransmission timeout (in seconds)
+    uint64_t RT;        // Retransmission timeout (in ms)
+    uint64_t RDLeft;    // remaining retransmission duration (in ms)
     int FirstTimeStamp; // timestamp of the first transmission
-    int LastTimeStamp;  // timestamp of the last transmission
+    uint64_t NextTimeStamp; // when the next transmission is due (in ms)
 
  private:
     void setDefaults();
+    double getRand(bool positive);
     void invalidAllowOptInMsg(int msg, int opt);
     void invalidAllowOptInOpt(int msg, int parentOpt, int childOpt);
 };
@@ -33,7 +33,7 @@ TClntMsgConfirm::TClntMsgConfirm(unsigned int iface,
 
     //The client MUST include a Client Identifier option to identify itself
     //to the server.
-    Options.push_back(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this ) );
+    addOption(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this ) );
     //The client includes IA options for all of the IAs
     //assigned to the interface for which the Confirm message is being
     //sent.  The IA options include all of the addresses the client
@@ -44,14 +44,17 @@ TClntMsgConfirm::TClntMsgConfirm(unsigned int iface,
     SPtr<TAddrIA> ia;
     iaLst.first();
     while(ia=iaLst.get())
-        Options.push_back(new TClntOptIA_NA(ia,true,this));
+        addOption(new TClntOptIA_NA(ia,true,this));
 
     appendRequestedOptions();
     appendElapsedOption();
     appendAuthenticationOption();
 
     IsDone = false;
-    send();
+
+    //The first Confirm message from the client on the interface MUST be
+    //delayed by a random amount of time between 0 and CNF_MAX_DELAY.
+    sendDelayed(ClntTransMgr().getStartDelay(iface, CNF_MAX_DELAY));
 }
 
 void TClntMsgConfirm::answer(SPtr<TClntMsg> reply)
@@ -159,9 +162,6 @@ void TClntMsgConfirm::addrsRejected() {
 
 void TClntMsgConfirm::doDuties()
 {
-    //The first Confirm message from the client on the interface MUST be
-    //delayed by a random amount of time between 0 and CNF_MAX_DELAY.
-    /// @todo: MRD counters are a mess.
     if (!MRD) {
         // MRD reached. Nobody said that out addrs are faulty, so we suppose
         // they are ok. Use them
@@ -175,11 +175,6 @@ void TClntMsgConfirm::doDuties()
     send();
 }
 
-unsigned long TClntMsgConfirm::getTimeout()
-{
-        return 0;
-}
-
 bool TClntMsgConfirm::check()
 {
         return 0;
@@ -24,7 +24,6 @@ public:
     bool check();
     void answer(SPtr<TClntMsg> Rep);
     void doDuties();
-    unsigned long getTimeout();
     std::string getName() const;
 
     void addrsAccepted();
@@ -29,17 +29,17 @@ TClntMsgDecline::TClntMsgDecline(int iface, SPtr<TIPv6Addr> addr,
     // include our ClientIdentifier
     SPtr<TOpt> ptr;
     ptr = new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this );
-    Options.push_back( ptr );
+    addOption( ptr );
     
     // include server's DUID
     ptr = new TOptDUID(OPTION_SERVERID, IALst.getFirst()->getDUID(),this);
-    Options.push_back( ptr );
+    addOption( ptr );
     
     // create IAs
     SPtr<TAddrIA> ptrIA;
     IALst.first();
     while ( ptrIA = IALst.get() ) {
-	Options.push_back( new TClntOptIA_NA(ptrIA,this));
+	addOption( new TClntOptIA_NA(ptrIA,this));
     }
 
     appendElapsedOption();
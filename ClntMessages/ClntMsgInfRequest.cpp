@@ -30,7 +30,7 @@ TClntMsgInfRequest::TClntMsgInfRequest(SPtr<TClntCfgIface> iface)
     :TClntMsg(iface->getID(), SPtr<TIPv6Addr>(), INFORMATION_REQUEST_MSG) {
 
     IRT = INF_TIMEOUT;
-    MRT = INF_MAX_RT;
+    MRT = ClntTransMgr().getInfMaxRT();
     MRC = 0;
     MRD = 0;
     RT= 0 ;
@@ -39,7 +39,7 @@ TClntMsgInfRequest::TClntMsgInfRequest(SPtr<TClntCfgIface> iface)
     IsDone=false;
 
     if (!ClntCfgMgr().anonInfRequest()) {
-        Options.push_back(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this));
+        addOption(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this));
     } else {
         Log(Info) << "Sending anonymous INF-REQUEST (ClientID not included)." << LogEnd;
     }
@@ -56,7 +56,9 @@ TClntMsgInfRequest::TClntMsgInfRequest(SPtr<TClntCfgIface> iface)
 
     appendAuthenticationOption();
     appendElapsedOption();
-    send();
+
+    // the first INF-REQUEST is delayed by up to INF_MAX_DELAY
+    sendDelayed(ClntTransMgr().getStartDelay(Iface, INF_MAX_DELAY));
 }
 
 //opts - all options list WITHOUT serverDUID including server id
@@ -64,7 +66,7 @@ TClntMsgInfRequest::TClntMsgInfRequest(TOptList ReqOpts,
 				       int iface)
     :TClntMsg(iface, SPtr<TIPv6Addr>(), INFORMATION_REQUEST_MSG) {
     IRT = INF_TIMEOUT;
-    MRT = INF_MAX_RT;
+    MRT = ClntTransMgr().getInfMaxRT();
     MRC = 0;
     MRD = 0;
     RT=0;
@@ -84,6 +86,7 @@ TClntMsgInfRequest::TClntMsgInfRequest(TOptList ReqOpts,
     
     // copy whole list from Verify ...
     Options = ReqOpts;
+    optionsChanged();
     
     SPtr<TOpt> opt;
     firstOption();
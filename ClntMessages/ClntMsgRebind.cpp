@@ -30,6 +30,7 @@ TClntMsgRebind::TClntMsgRebind(TOptList ptrOpts, int iface)
   :TClntMsg(iface, SPtr<TIPv6Addr>(), REBIND_MSG)
 {
     Options=ptrOpts;
+    optionsChanged();
     IRT=REB_TIMEOUT;
     MRT=REB_MAX_RT;
     MRC=0;
@@ -76,13 +76,13 @@ TClntMsgRelease::TClntMsgRelease(int iface, SPtr<TIPv6Addr> addr,
     }
     srvDUID = x->getDUID();
 
-    Options.push_back(new TOptDUID(OPTION_SERVERID, srvDUID,this));
-    Options.push_back(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(),this));
+    addOption(new TOptDUID(OPTION_SERVERID, srvDUID,this));
+    addOption(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(),this));
 
     // --- RELEASE IA ---
     iaLst.first();
     while(x=iaLst.get()) {
-        Options.push_back(new TClntOptIA_NA(x,this));
+        addOption(new TClntOptIA_NA(x,this));
         SPtr<TAddrAddr> ptrAddr;
         SPtr<TClntIfaceIface> ptrIface;
         ptrIface = (Ptr*)ClntIfaceMgr().getIfaceByID(x->getIfindex());
@@ -107,7 +107,7 @@ TClntMsgRelease::TClntMsgRelease(int iface, SPtr<TIPv6Addr> addr,
 
     // --- RELEASE TA ---
     if (ta) {
-        Options.push_back(new TClntOptTA(ta, this));
+        addOption(new TClntOptTA(ta, this));
         SPtr<TClntIfaceIface> ptrIface;
         ptrIface = (Ptr*)ClntIfaceMgr().getIfaceByID(ta->getIfindex());
         if (ptrIface) {
@@ -129,7 +129,7 @@ TClntMsgRelease::TClntMsgRelease(int iface, SPtr<TIPv6Addr> addr,
     pdLst.first();
     while(pd=pdLst.get()) {
         SPtr<TClntOptIA_PD> pdOpt = new TClntOptIA_PD(pd,this);
-        Options.push_back( (Ptr*)pdOpt );
+        addOption( (Ptr*)pdOpt );
         pdOpt->setContext(srvDUID, addr, this);
         pdOpt->delPrefixes();
 
@@ -63,31 +63,28 @@ TClntMsgRenew::TClntMsgRenew(List(TAddrIA) IALst,
     Iface    = ia->getIfindex();
     PeerAddr_ = ia->getSrvAddr();
 
-    if (RT>MRD) 
-        RT=MRD;
-
     // store our DUID
-    Options.push_back(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this));
+    addOption(new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this));
 
     // and say who's this message is for
     if (IALst.count())
-      	Options.push_back( new TOptDUID(OPTION_SERVERID,IALst.getFirst()->getDUID(),this));
+      	addOption( new TOptDUID(OPTION_SERVERID,IALst.getFirst()->getDUID(),this));
     else
-	Options.push_back( new TOptDUID(OPTION_SERVERID,PDLst.getFirst()->getDUID(),this));
+	addOption( new TOptDUID(OPTION_SERVERID,PDLst.getFirst()->getDUID(),this));
     
     //Store all IAs to renew
     IALst.first();
     while(ia=IALst.get()) {
 	      if (timeout > ia->getT2Timeout())
 	          timeout = ia->getT2Timeout();
-	      Options.push_back(new TClntOptIA_NA(ia,this));
+	      addOption(new TClntOptIA_NA(ia,this));
     }
 
     PDLst.first();
     while (ia=PDLst.get()) {
 	      if (timeout > ia->getT2Timeout())
 	          timeout = ia->getT2Timeout();
-	      Options.push_back(new TClntOptIA_PD(ia, this));
+	      addOption(new TClntOptIA_PD(ia, this));
     }
 
     appendRequestedOptions();
@@ -68,6 +68,7 @@ TClntMsgRequest::TClntMsgRequest(TOptList opts, int iface)
 
     // copy whole list from SOLICIT ...
     Options = opts;
+    optionsChanged();
 
     // set proper Parent in copied options
     TOptList::iterator opt=Options.begin();
@@ -122,7 +123,7 @@ TClntMsgRequest::TClntMsgRequest(TOptList opts, int iface)
     }
     
     // ... and append server's DUID from ADVERTISE
-    Options.push_back( srvDUID );
+    addOption( srvDUID );
     
     appendElapsedOption();
     appendAuthenticationOption();
@@ -143,7 +144,7 @@ TClntMsgRequest::TClntMsgRequest(List(TAddrIA) IAs,
     IsDone=false;
     SPtr<TOpt> ptr;
     ptr = new TOptDUID(OPTION_CLIENTID, ClntCfgMgr().getDUID(), this );
-    Options.push_back( ptr );
+    addOption( ptr );
 
     if (!srvDUID) {
 	Log(Error) << "Unable to send REQUEST: ServerId not specified.\n" << LogEnd;
@@ -154,14 +155,14 @@ TClntMsgRequest::TClntMsgRequest(List(TAddrIA) IAs,
     ptr = (Ptr*) new TOptDUID(OPTION_SERVERID, srvDUID,this);
     // all IAs provided by checkSolicit
     SPtr<TAddrIA> ClntAddrIA;
-    Options.push_back( ptr );
+    addOption( ptr );
 	
     IAs.first();
     while (ClntAddrIA = IAs.get()) 
     {
         SPtr<TClntCfgIA> ClntCfgIA = ClntCfgMgr().getIA(ClntAddrIA->getIAID());
         SPtr<TClntOptIA_NA> IA_NA = new TClntOptIA_NA(ClntCfgIA, ClntAddrIA, this);
-        Options.push_back((Ptr*)IA_NA);
+        addOption((Ptr*)IA_NA);
     }
 
     appendElapsedOption();
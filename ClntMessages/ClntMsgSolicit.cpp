@@ -39,7 +39,7 @@ TClntMsgSolicit::TClntMsgSolicit(int iface, SPtr<TIPv6Addr> addr,
     :TClntMsg(iface, addr, SOLICIT_MSG)
 {
     IRT=SOL_TIMEOUT;
-    MRT=SOL_MAX_RT;
+    MRT=ClntTransMgr().getSolMaxRT();
     MRC=0; //these both below mean there is no ending condition and transactions
     MRD=0; //lasts till receiving answer
     RT=0;
@@ -55,7 +55,7 @@ TClntMsgSolicit::TClntMsgSolicit(int iface, SPtr<TIPv6Addr> addr,
     while (ia = iaLst.get()) {
         SPtr<TClntOptIA_NA> iaOpt;
         iaOpt = new TClntOptIA_NA(ia, this);
-        Options.push_back( (Ptr*)iaOpt );
+        addOption( (Ptr*)iaOpt );
         if (!remoteAutoconf)
             ia->setState(STATE_INPROCESS);
         addrIA = ClntAddrMgr().getIA(ia->getIAID());
@@ -68,7 +68,7 @@ TClntMsgSolicit::TClntMsgSolicit(int iface, SPtr<TIPv6Addr> addr,
     // TA is provided by ::checkSolicit()
     if (ta) {
 	SPtr<TClntOptTA> taOpt = new TClntOptTA(ta->getIAID(), this);
-	Options.push_back( (Ptr*) taOpt);
+	addOption( (Ptr*) taOpt);
 	if (!remoteAutoconf)
 	    ta->setState(STATE_INPROCESS);
         addrIA = ClntAddrMgr().getTA(ta->getIAID());
@@ -83,7 +83,7 @@ TClntMsgSolicit::TClntMsgSolicit(int iface, SPtr<TIPv6Addr> addr,
     pdLst.first();
     while ( pd = pdLst.get() ) {
         SPtr<TClntOptIA_PD> pdOpt = new TClntOptIA_PD(pd, this);
-        Options.push_back( (Ptr*)pdOpt );
+        addOption( (Ptr*)pdOpt );
         if (!remoteAutoconf)
             pd->setState(STATE_INPROCESS);
         addrIA = ClntAddrMgr().getPD(pd->getIAID());
@@ -94,7 +94,7 @@ TClntMsgSolicit::TClntMsgSolicit(int iface, SPtr<TIPv6Addr> addr,
     }
     
     if (rapid)
-        Options.push_back(new TOptEmpty(OPTION_RAPID_COMMIT, this));
+        addOption(new TOptEmpty(OPTION_RAPID_COMMIT, this));
 
     // RECONF-ACCEPT is added in TClntMsg::appendRequestedOptions()
 
@@ -109,7 +109,9 @@ TClntMsgSolicit::TClntMsgSolicit(int iface, SPtr<TIPv6Addr> addr,
     appendAuthenticationOption();
     
     IsDone = false;
-    send();
+
+    // the first SOLICIT is delayed by up to SOL_MAX_DELAY
+    sendDelayed(ClntTransMgr().getStartDelay(Iface, SOL_MAX_DELAY));
 }
 
 void TClntMsgSolicit::answer(SPtr<TClntMsg> msg)
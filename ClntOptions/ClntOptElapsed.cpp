@@ -27,6 +27,12 @@ TClntOptElapsed::TClntOptElapsed(TMsg* parent)
     Timestamp = (uint32_t)time(NULL);
 }
 
+/// @brief starts counting elapsed time from now
+void TClntOptElapsed::reset()
+{
+    Timestamp = (uint32_t)time(NULL);
+}
+
 bool TClntOptElapsed::doDuties()
 {
     return false;
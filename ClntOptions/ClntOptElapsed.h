@@ -20,6 +20,7 @@ class TClntOptElapsed : public TOptInteger
 
     char * storeSelf(char* buf);
     bool doDuties();
+    void reset();
 private:
     unsigned long Timestamp;
 };
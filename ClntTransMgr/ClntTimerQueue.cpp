@@ -0,0 +1,160 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <time.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+#include "ClntTimerQueue.h"
+#include "DHCPConst.h"
+
+/**
+ * @brief schedules (or moves) a timer
+ *
+ * Second-based timers track lease state that is itself kept with second
+ * precision, so a 0 timeout (e.g. DAD still in progress) is checked again
+ * in a second rather than in a tight loop.
+ *
+ * @param type timer type
+ * @param id timer id (meaning depends on type)
+ * @param timeout number of seconds from now (DHCPV6_INFINITY cancels the timer)
+ */
+void TClntTimerQueue::schedule(TimerType type, unsigned long id, unsigned long timeout)
+{
+    if (timeout == DHCPV6_INFINITY) {
+        cancel(type, id);
+        return;
+    }
+    if (!timeout)
+        timeout = 1;
+    scheduleMs(type, id, (uint64_t)timeout*1000);
+}
+
+/**
+ * @brief schedules (or moves) a timer with millisecond precision
+ *
+ * @param type timer type
+ * @param id timer id (meaning depends on type)
+ * @param timeout number of milliseconds from now
+ */
+void TClntTimerQueue::scheduleMs(TimerType type, unsigned long id, uint64_t timeout)
+{
+    cancel(type, id);
+
+    TTimer timer;
+    timer.Type = type;
+    timer.Id = id;
+    Index[TKey(type, id)] = Queue.insert(std::make_pair(now() + timeout, timer));
+}
+
+void TClntTimerQueue::cancel(TimerType type, unsigned long id)
+{
+    std::map<TKey, TQueue::iterator>::iterator it = Index.find(TKey(type, id));
+    if (it == Index.end())
+        return;
+    Queue.erase(it->second);
+    Index.erase(it);
+}
+
+/**
+ * @brief removes first expired timer from the queue
+ *
+ * @param timer [out] expired timer
+ *
+ * @return true if there was an expired timer
+ */
+bool TClntTimerQueue::popExpired(TTimer& timer)
+{
+    if (Queue.empty())
+        return false;
+
+    TQueue::iterator first = Queue.begin();
+    if (first->first > now())
+        return false;
+
+    timer = first->second;
+    Index.erase(TKey(timer.Type, timer.Id));
+    Queue.erase(first);
+    return true;
+}
+
+/**
+ * @brief returns timers that will expire within specified time
+ *
+ * Timers are not removed from the queue.
+ *
+ * @param timeout number of seconds from now
+ * @param timers [out] timers, sorted by expiration time
+ */
+void TClntTimerQueue::getExpiring(unsigned long timeout, std::vector<TTimer>& timers)
+{
+    uint64_t until = now() + (uint64_t)timeout*1000;
+    for (TQueue::const_iterator it = Queue.begin(); it != Queue.end() && it->first <= until; ++it)
+        timers.push_back(it->second);
+}
+
+/// returns number of seconds to the first timer, rounded up (or DHCPV6_INFINITY)
+unsigned long TClntTimerQueue::getTimeout()
+{
+    if (Queue.empty())
+        return DHCPV6_INFINITY;
+
+    return (unsigned long)((getTimeoutMs() + 999)/1000);
+}
+
+/// returns number of milliseconds to the first timer (or DHCPV6_INFINITY)
+uint64_t TClntTimerQueue::getTimeoutMs()
+{
+    if (Queue.empty())
+        return DHCPV6_INFINITY;
+
+    uint64_t current = now();
+    uint64_t when = Queue.begin()->first;
+    return (when > current) ? when - current : 0;
+}
+
+bool TClntTimerQueue::isScheduled(TimerType type, unsigned long id)
+{
+    return Index.find(TKey(type, id)) != Index.end();
+}
+
+unsigned int TClntTimerQueue::count()
+{
+    return Queue.size();
+}
+
+void TClntTimerQueue::clear()
+{
+    Queue.clear();
+    Index.clear();
+}
+
+/// returns current monotonic time (in milliseconds, since unspecified point)
+uint64_t TClntTimerQueue::now()
+{
+#if defined(WIN32)
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER cnt;
+    if (!freq.QuadPart)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&cnt);
+    return (uint64_t)(cnt.QuadPart/(freq.QuadPart/1000));
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000 + ts.tv_nsec/1000000;
+#else
+    // no monotonic clock on this system
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec*1000 + tv.tv_usec/1000;
+#endif
+}
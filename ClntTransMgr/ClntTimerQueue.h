@@ -0,0 +1,67 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef CLNTTIMERQUEUE_H
+#define CLNTTIMERQUEUE_H
+
+#include <map>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+/// @brief priority queue of client timers
+///
+/// Every timer is identified by its type and an id (transaction-id, IAID,
+/// ifindex etc.). There is at most one timer for a given type and id:
+/// scheduling it again moves it. All operations are O(log n), so wakeups
+/// only cost as much as the number of timers that actually expired.
+/// Timers are kept with millisecond precision, on a monotonic clock, so
+/// system clock changes don't fire them early or late.
+class TClntTimerQueue
+{
+ public:
+    typedef enum {
+        TIMER_TRANSACTION, ///< retransmission of a message (id = transaction-id)
+        TIMER_IA_T1,       ///< IA_NA needs renewal (id = IAID)
+        TIMER_PD_T1,       ///< IA_PD needs renewal (id = IAID)
+        TIMER_IA_VALID,    ///< first address of IA_NA will expire (id = IAID)
+        TIMER_TA_VALID,    ///< first address of IA_TA will expire (id = IAID)
+        TIMER_PD_VALID,    ///< first prefix of IA_PD will expire (id = IAID)
+        TIMER_TENTATIVE,   ///< DAD result of IA_NA should be checked (id = IAID)
+        TIMER_LIFETIME,    ///< information refresh time (id = 0)
+        TIMER_INACTIVE     ///< inactive interfaces should be checked (id = 0)
+    } TimerType;
+
+    struct TTimer {
+        TimerType Type;
+        unsigned long Id;
+    };
+
+    void schedule(TimerType type, unsigned long id, unsigned long timeout);
+    void scheduleMs(TimerType type, unsigned long id, uint64_t timeout);
+    void cancel(TimerType type, unsigned long id);
+    bool popExpired(TTimer& timer);
+    void getExpiring(unsigned long timeout, std::vector<TTimer>& timers);
+    unsigned long getTimeout();
+    uint64_t getTimeoutMs();
+    bool isScheduled(TimerType type, unsigned long id);
+    unsigned int count();
+    void clear();
+
+    static uint64_t now();
+
+ private:
+    typedef std::multimap<uint64_t, TTimer> TQueue;
+    typedef std::pair<int, unsigned long> TKey;
+
+    TQueue Queue; ///< timers sorted by expiration time (in ms)
+    std::map<TKey, TQueue::iterator> Index; ///< timers by type and id
+};
+
+#endif
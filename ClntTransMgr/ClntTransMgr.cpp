@@ -12,6 +12,12 @@
 
 #include <iostream>
 #include <string>
+#include <stdlib.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <process.h>
+#endif
 
 #include "ClntTransMgr.h"
 #include "ClntAddrMgr.h"
@@ -28,9 +34,14 @@
 #include "ClntMsgDecline.h"
 #include "ClntMsgConfirm.h"
 #include "ClntMsgReconfigure.h"
+#include "OptInteger.h"
+#include "OptIA_NA.h"
+#include "OptTA.h"
+#include "OptIA_PD.h"
 #include "Container.h"
 #include "DHCPConst.h"
 #include "Logger.h"
+#include "Portable.h"
 
 using namespace std;
 
@@ -55,8 +66,11 @@ TClntTransMgr &TClntTransMgr::instance()
 }
 
 TClntTransMgr::TClntTransMgr(const std::string& config)
-  :IsDone(true), Shutdown(true), CtrlIface_(-1)
+  :IsDone(true), Shutdown(true), Checks(CHECK_ALL), TouchedAll(true),
+   SolMaxRT(SOL_MAX_RT), InfMaxRT(INF_MAX_RT), CtrlIface_(-1)
 {
+    seedRand();
+
     // should we set REUSE option during binding sockets?
 #ifdef MOD_CLNT_BIND_REUSE
     BindReuse = true;
@@ -415,90 +429,352 @@ bool TClntTransMgr::openLoopbackSocket() {
 /*
  * this method is called, when no message has been received, but some
  * action should be taken, e.g. RENEW transmission
+ *
+ * Only expired timers are processed here. Each timer or event (e.g. a
+ * finished transaction) requests only the checks that may be affected by it
+ * (see CHECK_* flags), e.g. an expired lease leads to SOLICIT check, a DAD
+ * timer to DECLINE check.
  */
 void TClntTransMgr::doDuties()
 {
-    // for each message on list, let it do its duties, if timeout is reached
-    SPtr <TClntMsg> msg;
-    Transactions.first();
-    while(msg=Transactions.get())
-    {
-        if ((!msg->getTimeout())&&(!msg->isDone())) {
-            Log(Info) << "Processing msg (" << msg->getName() << ",transID=0x"
-                 << hex << msg->getTransID() << dec << ",opts:";
-            SPtr<TOpt> ptrOpt;
-            msg->firstOption();
-            while (ptrOpt = msg->getOption()) {
-                Log(Cont) << " " << ptrOpt->getOptType();
+    TClntTimerQueue::TTimer timer;
+    List(TAddrIA) renewIAs;
+    List(TAddrIA) renewPDs;
+    SPtr<TAddrIA> ia;
+
+    // finished DNS updates and scripts (failed DNS Update is queued again
+    // by ClntIfaceMgr().doDuties())
+    if (ClntIfaceMgr().processJobs())
+        Checks |= CHECK_STATE;
+
+    while (Timers.popExpired(timer)) {
+        switch (timer.Type) {
+        case TClntTimerQueue::TIMER_TRANSACTION:
+            processTransaction(timer.Id);
+            break;
+        case TClntTimerQueue::TIMER_IA_T1:
+            // touched, so T1 is checked again if it isn't renewed now
+            touch(IATYPE_IA, timer.Id);
+            if (ia = ClntAddrMgr().getIA(timer.Id))
+                renewIAs.append(ia);
+            break;
+        case TClntTimerQueue::TIMER_PD_T1:
+            touch(IATYPE_PD, timer.Id);
+            if (ia = ClntAddrMgr().getPD(timer.Id))
+                renewPDs.append(ia);
+            break;
+        case TClntTimerQueue::TIMER_INACTIVE:
+            checkInactive();
+            break;
+        case TClntTimerQueue::TIMER_IA_VALID:
+            touch(IATYPE_IA, timer.Id);
+            Checks |= CHECK_EXPIRED | CHECK_SOLICIT;
+            break;
+        case TClntTimerQueue::TIMER_TA_VALID:
+            touch(IATYPE_TA, timer.Id);
+            Checks |= CHECK_EXPIRED | CHECK_SOLICIT;
+            break;
+        case TClntTimerQueue::TIMER_PD_VALID:
+            touch(IATYPE_PD, timer.Id);
+            Checks |= CHECK_EXPIRED | CHECK_SOLICIT;
+            break;
+        case TClntTimerQueue::TIMER_TENTATIVE:
+            touch(IATYPE_IA, timer.Id);
+            Checks |= CHECK_DECLINE;
+            break;
+        case TClntTimerQueue::TIMER_LIFETIME:
+            Checks |= CHECK_INFREQUEST;
+            break;
+        }
+    }
+
+    if (!this->Shutdown && !this->IsDone && (renewIAs.count() || renewPDs.count())) {
+        checkRenew(renewIAs, renewPDs);
+    }
+
+    if (Checks) {
+        unsigned int checks = Checks;
+        Checks = 0;
+
+        if (checks & CHECK_EXPIRED) {
+            ipaddr_batch_begin();
+            removeExpired();
+            ClntAddrMgr().doDuties();
+            ipaddr_batch_commit();
+        }
+
+        ClntAddrMgr().dump();
+        ClntIfaceMgr().dump();
+        ClntCfgMgr().dump();
+
+        if (!this->Shutdown && !this->IsDone) {
+
+            // did we switched links lately?
+            // are there any IAs to confirm?
+            if (checks & CHECK_CONFIRM)
+                checkConfirm();
+
+            // are there any tentative addrs?
+            if (checks & CHECK_DECLINE)
+                checkDecline();
+
+            if (checks & CHECK_SOLICIT) {
+                // are there any IAs or TAs to configure?
+                checkSolicit();
+
+                //is there any IA in Address manager, which has not sufficient number
+                //of addresses
+                checkRequest();
+
+#ifdef MOD_REMOTE_AUTOCONF
+                checkRemoteSolicits();
+#endif
             }
-            Log(Cont) << ")" << LogEnd;
-            msg->doDuties();
+
+            // are there any aging IAs or PDs? (after startup, T1 timers take care of that)
+            if (checks & CHECK_RENEW)
+                checkRenew();
+
+            //Maybe we require only infromations concernig link
+            if (checks & CHECK_INFREQUEST)
+                checkInfRequest();
+
+        }
+
+        // This method launch the DNS update, so the checkDecline has to be done before to ensure the ip address is valid
+        ClntIfaceMgr().doDuties();
+
+        scheduleTimers();
+    } else if (TouchedAll || !Touched.empty()) {
+        scheduleTimers();
+    }
+
+    if (this->Shutdown && !Transactions.count())
+        this->IsDone = true;
+}
+
+/**
+ * @brief requests CONFIRM check during next doDuties() call
+ *
+ * Should be called when link state change marked IAs for CONFIRM.
+ */
+void TClntTransMgr::recheck()
+{
+    Checks |= CHECK_CONFIRM;
+}
+
+/// appends new transaction and schedules its retransmission timer
+void TClntTransMgr::addTransaction(SPtr<TClntMsg> msg)
+{
+    Transactions.append(msg);
+    touch((Ptr*)msg);
+    Timers.scheduleMs(TClntTimerQueue::TIMER_TRANSACTION, msg->getTransID(), msg->getTimeoutMs());
+}
+
+/**
+ * @brief lets transaction do its duties (e.g. retransmit), removes it if done
+ *
+ * @param transid transaction-id of the transaction that timed out
+ */
+void TClntTransMgr::processTransaction(unsigned long transid)
+{
+    SPtr<TClntMsg> msg;
+    Transactions.first();
+    while (msg = Transactions.get()) {
+        if ((unsigned long)msg->getTransID() == transid)
+            break;
+    }
+    if (!msg)
+        return;
+
+    if ((!msg->getTimeoutMs())&&(!msg->isDone())) {
+        Log(Info) << "Processing msg (" << msg->getName() << ",transID=0x"
+                  << hex << msg->getTransID() << dec << ",opts:";
+        SPtr<TOpt> ptrOpt;
+        msg->firstOption();
+        while (ptrOpt = msg->getOption()) {
+            Log(Cont) << " " << ptrOpt->getOptType();
         }
+        Log(Cont) << ")" << LogEnd;
+        msg->doDuties();
+    }
+
+    if (msg->isDone()) {
+        delTransaction(msg);
+    } else {
+        Timers.scheduleMs(TClntTimerQueue::TIMER_TRANSACTION, transid, msg->getTimeoutMs());
     }
+}
 
-    // now delete messages which are marked as done
+/// removes finished transaction, IAs it failed to configure are checked again
+void TClntTransMgr::delTransaction(SPtr<TClntMsg> msg)
+{
+    SPtr<TClntMsg> x;
     Transactions.first();
-    while (msg = Transactions.get() ) {
-        if (msg->isDone())
+    while (x = Transactions.get()) {
+        if (x == msg) {
             Transactions.del();
+            break;
+        }
     }
+    Timers.cancel(TClntTimerQueue::TIMER_TRANSACTION, msg->getTransID());
+    touch((Ptr*)msg);
+    if (msg->getType() == INFORMATION_REQUEST_MSG)
+        Checks |= CHECK_INFREQUEST;
+    else
+        Checks |= CHECK_SOLICIT;
+}
 
-    if (ClntCfgMgr().inactiveMode())
-    {
-        SPtr<TClntCfgIface> x;
-        x = ClntCfgMgr().checkInactiveIfaces();
-        if (x) {
-            if (!populateAddrMgr(x)) {
-                Log(Error)<< "Call to populateAddrMgr() ended with error"
-                          << " Following operation may be unstable!" << LogEnd;
-            }
-            if (!openSockets(x)) {
-                Log(Crit) << "Attempt to bind activated interfaces failed."
-                          << " Following operation may be unstable!" << LogEnd;
-            }
+/// activates interfaces that became ready (inactive-mode)
+void TClntTransMgr::checkInactive()
+{
+    if (!ClntCfgMgr().inactiveMode())
+        return;
+
+    SPtr<TClntCfgIface> x;
+    x = ClntCfgMgr().checkInactiveIfaces();
+    if (x) {
+        if (!populateAddrMgr(x)) {
+            Log(Error)<< "Call to populateAddrMgr() ended with error"
+                      << " Following operation may be unstable!" << LogEnd;
+        }
+        if (!openSockets(x)) {
+            Log(Crit) << "Attempt to bind activated interfaces failed."
+                      << " Following operation may be unstable!" << LogEnd;
         }
+        Checks |= CHECK_SOLICIT | CHECK_INFREQUEST;
     }
 
-    removeExpired();
-    ClntAddrMgr().doDuties();
+    if (ClntCfgMgr().inactiveIfacesCnt())
+        Timers.schedule(TClntTimerQueue::TIMER_INACTIVE, 0, INACTIVE_MODE_INTERVAL);
+}
 
-    ClntAddrMgr().dump();
-    ClntIfaceMgr().dump();
-    ClntCfgMgr().dump();
+/**
+ * @brief (re)schedules lease related timers
+ *
+ * Called after checks, so IA states are up to date. Only timers of IAs,
+ * TAs and PDs touched since the last call are updated (all of them at
+ * startup), see touch().
+ */
+void TClntTransMgr::scheduleTimers()
+{
+    SPtr<TAddrIA> ia;
 
-    if (!this->Shutdown && !this->IsDone) {
+    if (TouchedAll) {
+        ClntAddrMgr().firstIA();
+        while (ia = ClntAddrMgr().getIA())
+            scheduleIA(IATYPE_IA, ia->getIAID());
 
-        // did we switched links lately?
-        // are there any IAs to confirm?
-        checkConfirm();
-        
-        // are there any tentative addrs?
-        checkDecline();
+        ClntAddrMgr().firstTA();
+        while (ia = ClntAddrMgr().getTA())
+            scheduleIA(IATYPE_TA, ia->getIAID());
 
-        // are there any IAs or TAs to configure?
-        checkSolicit();
+        ClntAddrMgr().firstPD();
+        while (ia = ClntAddrMgr().getPD())
+            scheduleIA(IATYPE_PD, ia->getIAID());
+    } else {
+        for (std::set<std::pair<int, unsigned long> >::const_iterator t = Touched.begin();
+             t != Touched.end(); ++t)
+            scheduleIA(t->first, t->second);
+    }
+    Touched.clear();
+    TouchedAll = false;
 
-        //is there any IA in Address manager, which has not sufficient number 
-        //of addresses
-        checkRequest();
+    Timers.schedule(TClntTimerQueue::TIMER_LIFETIME, 0, ClntIfaceMgr().getTimeout());
 
-        // are there any aging IAs or PDs?
-        checkRenew();
+    if (ClntCfgMgr().inactiveMode() && ClntCfgMgr().inactiveIfacesCnt() &&
+        !Timers.isScheduled(TClntTimerQueue::TIMER_INACTIVE, 0))
+        Timers.schedule(TClntTimerQueue::TIMER_INACTIVE, 0, INACTIVE_MODE_INTERVAL);
+}
 
-        //Maybe we require only infromations concernig link
-        checkInfRequest();
+/**
+ * @brief (re)schedules timers of a single IA, TA or PD
+ *
+ * T1 timers are kept only for configured IAs and PDs. Timers of IAs that
+ * no longer exist are cancelled.
+ *
+ * @param type IATYPE_IA, IATYPE_TA or IATYPE_PD
+ * @param iaid IAID
+ */
+void TClntTransMgr::scheduleIA(int type, unsigned long iaid)
+{
+    SPtr<TAddrIA> ia;
 
-#ifdef MOD_REMOTE_AUTOCONF
-        checkRemoteSolicits();
-#endif
+    switch (type) {
+    case IATYPE_IA:
+        ia = ClntAddrMgr().getIA(iaid);
+        if (!ia) {
+            Timers.cancel(TClntTimerQueue::TIMER_IA_T1, iaid);
+            Timers.cancel(TClntTimerQueue::TIMER_IA_VALID, iaid);
+            Timers.cancel(TClntTimerQueue::TIMER_TENTATIVE, iaid);
+            return;
+        }
+        if (ia->getState() == STATE_CONFIGURED)
+            Timers.schedule(TClntTimerQueue::TIMER_IA_T1, iaid, ia->getT1Timeout());
+        else
+            Timers.cancel(TClntTimerQueue::TIMER_IA_T1, iaid);
+        Timers.schedule(TClntTimerQueue::TIMER_IA_VALID, iaid, ia->getValidTimeout());
+        Timers.schedule(TClntTimerQueue::TIMER_TENTATIVE, iaid, ia->getTentativeTimeout());
+        break;
+    case IATYPE_TA:
+        ia = ClntAddrMgr().getTA(iaid);
+        if (!ia) {
+            Timers.cancel(TClntTimerQueue::TIMER_TA_VALID, iaid);
+            return;
+        }
+        Timers.schedule(TClntTimerQueue::TIMER_TA_VALID, iaid, ia->getValidTimeout());
+        break;
+    case IATYPE_PD:
+        ia = ClntAddrMgr().getPD(iaid);
+        if (!ia) {
+            Timers.cancel(TClntTimerQueue::TIMER_PD_T1, iaid);
+            Timers.cancel(TClntTimerQueue::TIMER_PD_VALID, iaid);
+            return;
+        }
+        if (ia->getState() == STATE_CONFIGURED)
+            Timers.schedule(TClntTimerQueue::TIMER_PD_T1, iaid, ia->getT1Timeout());
+        else
+            Timers.cancel(TClntTimerQueue::TIMER_PD_T1, iaid);
+        Timers.schedule(TClntTimerQueue::TIMER_PD_VALID, iaid, ia->getValidTimeout());
+        break;
+    }
+}
 
-    } 
-    
-    // This method launch the DNS update, so the checkDecline has to be done before to ensure the ip address is valid
-    ClntIfaceMgr().doDuties();
+/// marks IA, TA or PD whose timers need to be updated by scheduleTimers()
+void TClntTransMgr::touch(int type, unsigned long iaid)
+{
+    Touched.insert(std::make_pair(type, iaid));
+}
 
-    if (this->Shutdown && !Transactions.count())
-        this->IsDone = true;
+/// marks IAs, TAs and PDs carried in a message (sent or received)
+void TClntTransMgr::touch(SPtr<TMsg> msg)
+{
+    SPtr<TOpt> opt;
+    msg->firstOption();
+    while (opt = msg->getOption()) {
+        switch (opt->getOptType()) {
+        case OPTION_IA_NA:
+        {
+            SPtr<TOptIA_NA> ia = (Ptr*)opt;
+            touch(IATYPE_IA, ia->getIAID());
+            break;
+        }
+        case OPTION_IA_TA:
+        {
+            SPtr<TOptTA> ta = (Ptr*)opt;
+            touch(IATYPE_TA, ta->getIAID());
+            break;
+        }
+        case OPTION_IA_PD:
+        {
+            SPtr<TOptIA_PD> pd = (Ptr*)opt;
+            touch(IATYPE_PD, pd->getIAID());
+            break;
+        }
+        default:
+            break;
+        }
+    }
 }
 
 void TClntTransMgr::shutdown()
@@ -512,7 +788,9 @@ void TClntTransMgr::shutdown()
     List(TAddrIA) releasedPDs;
 
     Transactions.clear(); // delete all transactions
+    Timers.clear();
     this->Shutdown = true;
+    Checks |= CHECK_STATE;
     Log(Notice) << "Shutting down entire client." << LogEnd;
         
     // delete all weird-state/innormal-state and address-free IAs 
@@ -619,6 +897,7 @@ void TClntTransMgr::shutdown()
     //CHANGED:the following two lines are uncommented.
     doDuties(); // just to send RELEASE msg
     Transactions.clear(); // delete all transactions
+    Timers.clear();
 
     // clean up options
     ClntIfaceMgr().removeAllOpts();
@@ -663,6 +942,7 @@ void TClntTransMgr::relayMsg(SPtr<TClntMsg> msgAnswer)
                 msgAnswer->setIface(msgQuestion->getIface());
             }
 
+            updateMaxRT(msgAnswer);
             handleResponse(msgQuestion, msgAnswer);
             break;
         }
@@ -716,8 +996,24 @@ bool TClntTransMgr::handleResponse(SPtr<TClntMsg> question, SPtr<TClntMsg> answe
 {
     // pre-handling hooks can be added here
 
-    // handle actual response
+    // handle actual response. Address changes caused by it are sent
+    // to the kernel together and config files are written once.
+    ipaddr_batch_begin();
+    cfg_batch_begin();
     question->answer(answer);
+    cfg_batch_commit();
+    ipaddr_batch_commit();
+
+    touch((Ptr*)question);
+    touch((Ptr*)answer);
+
+    // answer may have finished the transaction or changed its timeout
+    if (question->isDone())
+        delTransaction(question);
+    else
+        Timers.scheduleMs(TClntTimerQueue::TIMER_TRANSACTION, question->getTransID(),
+                          question->getTimeoutMs());
+    Checks |= CHECK_STATE;
 
     // post-handling hooks can be added here
     SPtr<TMsg> q = (Ptr*) question;
@@ -732,51 +1028,102 @@ bool TClntTransMgr::handleResponse(SPtr<TClntMsg> question, SPtr<TClntMsg> answe
     return true;
 }
 
-unsigned long TClntTransMgr::getTimeout()
+/// returns number of milliseconds until something needs to be done
+uint64_t TClntTransMgr::getTimeoutMs()
 {
-    unsigned long timeout = DHCPV6_INFINITY;
-    unsigned long tmp;
-
-    if (this->IsDone) 
+    if (this->IsDone || Checks)
         return 0;
 
-    // AddrMgr timeout
-    timeout = ClntAddrMgr().getTimeout();
-    tmp     = ClntAddrMgr().getTentativeTimeout();
-    if (timeout > tmp)
-        timeout = tmp;
-    // Uncomment for timeout debugging
-    //Log(Debug) << "Timeout after AddrMgr=" << timeout << LogEnd;
-
-    if (timeout == 0) {
-	ClntAddrMgr().getTimeout();
+    uint64_t timeout = Timers.getTimeoutMs();
+    if (ClntIfaceMgr().countJobs() && timeout > 1000) {
+        // finished jobs interrupt select(), but a job may finish just before
+        // select() is called, so poll them every second, too
+        timeout = 1000;
     }
+    return timeout;
+}
 
-    // IfaceMgr (Lifetime option) timeout
-    tmp = ClntIfaceMgr().getTimeout();
-    if (timeout > tmp)
-        timeout = tmp;
-    // Uncomment for timeout debugging
-    // Log(Debug) << "Timeout after IfaceMgr=" << timeout << LogEnd;
+/**
+ * @brief returns random delay of the first transmission
+ *
+ * The first exchange on each interface after startup is additionally
+ * spread over startup-spread seconds.
+ *
+ * @param ifindex interface index
+ * @param maxDelay max. delay (SOL_MAX_DELAY, INF_MAX_DELAY etc., in seconds)
+ *
+ * @return delay (in ms)
+ */
+uint64_t TClntTransMgr::getStartDelay(int ifindex, unsigned int maxDelay)
+{
+    uint64_t range = (uint64_t)maxDelay*1000;
+    if (StartedIfaces.insert(ifindex).second)
+        range += (uint64_t)ClntCfgMgr().getStartupSpread()*1000;
 
-    // Messages timeout
-    SPtr<TClntMsg> ptrMsg;
-    Transactions.first();
-    tmp = DHCPV6_INFINITY;
-    while(ptrMsg=Transactions.get())
-    {
-        if (tmp > ptrMsg->getTimeout())
-            tmp = ptrMsg->getTimeout();
-    }
-    if (timeout > tmp)
-        timeout = tmp;
+    return (uint64_t)(range*((double)rand()/((double)RAND_MAX + 1.0)));
+}
 
-    if (ClntCfgMgr().inactiveIfacesCnt()) {
-        if (timeout>INACTIVE_MODE_INTERVAL)
-            timeout=INACTIVE_MODE_INTERVAL;
+/**
+ * @brief seeds random generator
+ *
+ * Clients started at the same time must not retransmit at the same
+ * time, so the seed is based on wall-clock and monotonic time, pid and DUID.
+ */
+void TClntTransMgr::seedRand()
+{
+    uint32_t seed = (uint32_t)time(NULL) ^ (uint32_t)TClntTimerQueue::now() ^
+        ((uint32_t)getpid() << 16);
+    SPtr<TDUID> duid = ClntCfgMgr().getDUID();
+    if (duid) {
+        const char* buf = duid->get();
+        for (size_t i = 0; i < duid->getLen(); i++)
+            seed = seed*31 + (uint8_t)buf[i];
     }
+    srand(seed);
+}
 
-    return timeout;
+/**
+ * @brief updates SOL_MAX_RT and INF_MAX_RT with values received from server
+ *
+ * See RFC8415, section 18.2.9. Options are processed even if the answer
+ * is going to be rejected (e.g. ADVERTISE with NoAddrsAvail), so servers
+ * can slow down clients they are unable to serve.
+ *
+ * @param answer message received from server
+ */
+void TClntTransMgr::updateMaxRT(SPtr<TClntMsg> answer)
+{
+    if (answer->getType() != ADVERTISE_MSG && answer->getType() != REPLY_MSG)
+        return;
+
+    int types[] = { OPTION_SOL_MAX_RT, OPTION_INF_MAX_RT };
+    for (int i = 0; i < 2; i++) {
+        SPtr<TOptInteger> opt = (Ptr*) answer->getOption(types[i]);
+        if (!opt)
+            continue;
+        unsigned int value = opt->getValue();
+        if (value < MAX_RT_OPTION_MIN || value > MAX_RT_OPTION_MAX) {
+            Log(Warning) << "Received invalid " << (i ? "INF_MAX_RT" : "SOL_MAX_RT") << " value "
+                         << value << ", ignored." << LogEnd;
+            continue;
+        }
+
+        int msgType = i ? INFORMATION_REQUEST_MSG : SOLICIT_MSG;
+        unsigned int& maxRT = i ? InfMaxRT : SolMaxRT;
+        if (maxRT != value) {
+            Log(Info) << (i ? "INF_MAX_RT" : "SOL_MAX_RT") << " changed from " << maxRT
+                      << " to " << value << " second(s)." << LogEnd;
+            maxRT = value;
+        }
+
+        // apply it to ongoing transmissions as well
+        SPtr<TClntMsg> msg;
+        Transactions.first();
+        while (msg = Transactions.get()) {
+            if (msg->getType() == msgType)
+                msg->setMRT(value);
+        }
+    }
 }
 
 void TClntTransMgr::stop()
@@ -798,7 +1145,7 @@ void TClntTransMgr::sendRequest(TOptList requestOptions, int iface)
             opt = requestOptions.erase(opt);
     }
     SPtr<TClntMsg> ptr = new TClntMsgRequest(requestOptions, iface);
-    Transactions.append( (Ptr*)ptr );
+    addTransaction( (Ptr*)ptr );
 }
 
 void TClntTransMgr::sendRenew()
@@ -831,7 +1178,7 @@ void TClntTransMgr::sendRenew()
 	 
     Log(Info) << "Generating RENEW for " << iaLst.count() << " IA(s) and " << pdLst.count() << " PD(s). " << LogEnd;
     SPtr <TClntMsg> ptrRenew = new TClntMsgRenew(iaLst, pdLst);
-    Transactions.append(ptrRenew);
+    addTransaction(ptrRenew);
 }
 
 
@@ -877,7 +1224,7 @@ void TClntTransMgr::sendRelease( List(TAddrIA) IALst, SPtr<TAddrIA> ta, List(TAd
                 << " interface." << LogEnd;
 
     SPtr<TClntMsg> ptr = new TClntMsgRelease(iface, addr, IALst, ta, pdLst);
-    Transactions.append( ptr );
+    addTransaction( ptr );
 }
 
 // Send REBIND message
@@ -892,7 +1239,7 @@ void TClntTransMgr::sendRebind(TOptList requestOptions, int iface) {
 
     SPtr<TClntMsg> ptr =  new TClntMsgRebind(requestOptions, iface);
     if (!ptr->isDone())
-        Transactions.append( ptr );
+        addTransaction( ptr );
 }
 
 void TClntTransMgr::sendInfRequest(TOptList requestOptions, int iface) {
@@ -906,7 +1253,7 @@ void TClntTransMgr::sendInfRequest(TOptList requestOptions, int iface) {
 
     SPtr<TClntMsg> ptr = new TClntMsgInfRequest(requestOptions,iface);
     if (!ptr->isDone())
-        Transactions.append( ptr );    
+        addTransaction( ptr );    
 }
 
 // should we send SOLICIT ?
@@ -966,7 +1313,7 @@ void TClntTransMgr::checkSolicit() {
                 Log(Cont) << " (with rapid-commit)";
             } 
             Log(Cont) << " on " << iface->getFullName() <<" interface." << LogEnd;
-            Transactions.append(new TClntMsgSolicit(iface->getID(),
+            addTransaction(new TClntMsgSolicit(iface->getID(),
                                                     SPtr<TIPv6Addr>(), iaLst, ta, pdLst, 
                                                     iface->getRapidCommit()));
 	    
@@ -1007,7 +1354,7 @@ void TClntTransMgr::checkConfirm()
 
         if (IALst.count()) {
             Log(Info) << "Creating CONFIRM: " << IALst.count() << " IA(s) on " << iface->getFullName() << LogEnd;
-            Transactions.append(
+            addTransaction(
                 new TClntMsgConfirm(iface->getID(), IALst));
 
 	    // state of certain IAs has changed. Let's log it.
@@ -1073,7 +1420,7 @@ void TClntTransMgr::checkInfRequest()
         {
             Log(Info) << "Creating INFORMATION-REQUEST message on "
                       << iface->getFullName() << " interface." << LogEnd;
-            Transactions.append(new TClntMsgInfRequest(iface));
+            addTransaction(new TClntMsgInfRequest(iface));
         }
     }
 }
@@ -1085,71 +1432,175 @@ void TClntTransMgr::checkRenew()
         return;
 
     // TENTATIVE_YES, there are. Find them!
-    
-    // Find all IAs
     List(TAddrIA) iaLst;
+    List(TAddrIA) pdLst;
     SPtr<TAddrIA> ia;
-    SPtr<TAddrIA> iaPattern;
-    ClntAddrMgr().firstIA();
 
-    // Need to be fixed:?? how to deal with mutiple network interfaces.
-    while (ia = ClntAddrMgr().getIA() ) 
-    {
-        if ( (ia->getT1Timeout()!=0) || 
-             (ia->getState()!=STATE_CONFIGURED) ||
-             (ia->getTentative()==ADDRSTATUS_UNKNOWN) )
-            continue;
-        
-        if (!iaPattern) {
-            iaPattern = ia;
+    ClntAddrMgr().firstIA();
+    while (ia = ClntAddrMgr().getIA() ) {
+        if (!ia->getT1Timeout())
             iaLst.append(ia);
-            ia->setState(STATE_INPROCESS);
-            continue;
-        }
-
-        if ( (ia->getIfindex() == iaPattern->getIfindex()) &&
-             (ia->getDUID()  == iaPattern->getDUID()) )
-        {
-                iaLst.append(ia);
-                ia->setState(STATE_INPROCESS);
-        }
     }
 
-    // Find all PDs
-    List(TAddrIA) pdLst;
     ClntAddrMgr().firstPD();
     while (ia = ClntAddrMgr().getPD()) {
-        if ( (ia->getT1Timeout()!=0) || 
-             (ia->getState()!=STATE_CONFIGURED) )
-            continue;
-        
-        if (!iaPattern) {
-            iaPattern = ia;
+        if (!ia->getT1Timeout())
             pdLst.append(ia);
+    }
+
+    checkRenew(iaLst, pdLst);
+}
+
+/**
+ * @brief sends RENEW for IAs and PDs that reached T1
+ *
+ * IAs and PDs obtained from the same server on the same interface are
+ * renewed together, one RENEW per server is sent.
+ *
+ * @param iaLst IAs that reached T1
+ * @param pdLst PDs that reached T1
+ */
+void TClntTransMgr::checkRenew(List(TAddrIA) iaLst, List(TAddrIA) pdLst)
+{
+    SPtr<TAddrIA> ia;
+    SPtr<TAddrIA> iaPattern;
+
+    do {
+        List(TAddrIA) renewIAs;
+        List(TAddrIA) renewPDs;
+        iaPattern.reset();
+
+        iaLst.first();
+        while (ia = iaLst.get()) {
+            if ( (ia->getT1Timeout()!=0) || 
+                 (ia->getState()!=STATE_CONFIGURED) ||
+                 (ia->getTentative()==ADDRSTATUS_UNKNOWN) )
+                continue;
+
+            if (!iaPattern)
+                iaPattern = ia;
+            else if ( (ia->getIfindex() != iaPattern->getIfindex()) ||
+                      !sameDUID(ia->getDUID(), iaPattern->getDUID()) )
+                continue;
+
+            renewIAs.append(ia);
             ia->setState(STATE_INPROCESS);
-            continue;
         }
 
-        if ( (ia->getIfindex() == iaPattern->getIfindex()) &&
-             (ia->getDUID()  == iaPattern->getDUID()) )
-        {
-                pdLst.append(ia);
-                ia->setState(STATE_INPROCESS);
+        pdLst.first();
+        while (ia = pdLst.get()) {
+            if ( (ia->getT1Timeout()!=0) || 
+                 (ia->getState()!=STATE_CONFIGURED) )
+                continue;
+
+            if (!iaPattern)
+                iaPattern = ia;
+            else if ( (ia->getIfindex() != iaPattern->getIfindex()) ||
+                      !sameDUID(ia->getDUID(), iaPattern->getDUID()) )
+                continue;
+
+            renewPDs.append(ia);
+            ia->setState(STATE_INPROCESS);
         }
-    }
 
-    if (iaLst.count() + pdLst.count() == 0) {
-        // there are no IAs or PD to refresh. Just do nothing.
-        return;
+        if (renewIAs.count() + renewPDs.count() == 0) {
+            // there are no (more) IAs or PD to refresh. Just do nothing.
+            return;
+        }
+
+        // T1 of those IAs has been reached, so their timers are no longer needed
+        renewIAs.first();
+        while (ia = renewIAs.get())
+            Timers.cancel(TClntTimerQueue::TIMER_IA_T1, ia->getIAID());
+        renewPDs.first();
+        while (ia = renewPDs.get())
+            Timers.cancel(TClntTimerQueue::TIMER_PD_T1, ia->getIAID());
+
+        SPtr<TClntCfgIface> cfgIface = ClntCfgMgr().getIface(iaPattern->getIfindex());
+        unsigned int coalesced = 0;
+        if (cfgIface)
+            coalesced = coalesceRenew(iaPattern, cfgIface->getRenewCoalesce(), renewIAs, renewPDs);
+
+        Log(Info) << "Generating RENEW for " << renewIAs.count() << " IA(s) and "
+                  << renewPDs.count() << " PD(s)";
+        if (coalesced)
+            Log(Cont) << " (" << coalesced << " renewed early to coalesce)";
+        Log(Cont) << ". " << LogEnd;
+        if (cfgIface)
+            cfgIface->addRenewStats(renewIAs.count() + renewPDs.count(), coalesced);
+        SPtr <TClntMsg> ptrRenew = new TClntMsgRenew(renewIAs, renewPDs);
+        addTransaction(ptrRenew);
+
+        // state of certain IAs has changed. Let's log it.
+        ClntAddrMgr().dump();
+        ClntCfgMgr().dump();
+    } while (true);
+}
+
+/**
+ * @brief adds IAs and PDs that will reach T1 soon to RENEW
+ *
+ * Renewing all IAs bound to the same server at once saves messages and
+ * server work. IAs and PDs whose T1 expires within the window are renewed
+ * early, together with those that already reached T1.
+ *
+ * @param iaPattern IA that triggered the RENEW (server and interface)
+ * @param window coalescing window (in seconds, 0 disables coalescing)
+ * @param renewIAs [in/out] IAs to be renewed
+ * @param renewPDs [in/out] PDs to be renewed
+ *
+ * @return number of IAs and PDs added
+ */
+unsigned int TClntTransMgr::coalesceRenew(SPtr<TAddrIA> iaPattern, unsigned int window,
+                                          List(TAddrIA)& renewIAs, List(TAddrIA)& renewPDs)
+{
+    if (!window)
+        return 0;
+
+    std::vector<TClntTimerQueue::TTimer> timers;
+    Timers.getExpiring(window, timers);
+
+    unsigned int cnt = 0;
+    for (std::vector<TClntTimerQueue::TTimer>::const_iterator t = timers.begin();
+         t != timers.end(); ++t) {
+        SPtr<TAddrIA> ia;
+        switch (t->Type) {
+        case TClntTimerQueue::TIMER_IA_T1:
+            ia = ClntAddrMgr().getIA(t->Id);
+            if (!ia || ia->getTentative()==ADDRSTATUS_UNKNOWN)
+                continue;
+            break;
+        case TClntTimerQueue::TIMER_PD_T1:
+            ia = ClntAddrMgr().getPD(t->Id);
+            if (!ia)
+                continue;
+            break;
+        default:
+            continue;
+        }
+
+        if ( (ia->getState()!=STATE_CONFIGURED) ||
+             (ia->getIfindex() != iaPattern->getIfindex()) ||
+             !sameDUID(ia->getDUID(), iaPattern->getDUID()) )
+            continue;
+
+        if (t->Type == TClntTimerQueue::TIMER_IA_T1)
+            renewIAs.append(ia);
+        else
+            renewPDs.append(ia);
+        ia->setState(STATE_INPROCESS);
+        Timers.cancel(t->Type, t->Id);
+        cnt++;
     }
-         
-    Log(Info) << "Generating RENEW for " << iaLst.count() << " IA(s) and " << pdLst.count() << " PD(s). " << LogEnd;
-    SPtr <TClntMsg> ptrRenew = new TClntMsgRenew(iaLst, pdLst);
-    Transactions.append(ptrRenew);
 
-    // state of certain IAs has changed. Let's log it.
-    ClntAddrMgr().dump();
-    ClntCfgMgr().dump();
+    return cnt;
+}
+
+bool TClntTransMgr::sameDUID(SPtr<TDUID> a, SPtr<TDUID> b)
+{
+    if (!a || !b)
+        return a == b;
+    return *a == *b;
 }
 
 void TClntTransMgr::checkDecline()
@@ -1185,12 +1636,13 @@ void TClntTransMgr::checkDecline()
             //Here should be send decline for all tentative addresses in IAs
             SPtr<TClntMsgDecline> decline = 
                 new TClntMsgDecline(firstIA->getIfindex(), SPtr<TIPv6Addr>(), declineIALst);
-            Transactions.append( (Ptr*) decline);
+            addTransaction( (Ptr*) decline);
 
             // decline sent, now remove those addrs from IfaceMgr
             SPtr<TIfaceIface> ptrIface = ClntIfaceMgr().getIfaceByID(firstIA->getIfindex());
             SPtr<TDUID> duid;
 
+            ipaddr_batch_begin();
             declineIALst.first();
             while (ptrIA = declineIALst.get() ) {
                 SPtr<TAddrAddr> ptrAddr;
@@ -1214,11 +1666,12 @@ void TClntTransMgr::checkDecline()
                 duid = ptrIA->getDUID();
                 ptrIA->setTentative();
             }
+            ipaddr_batch_commit();
 
             // create REQUEST message
             SPtr<TClntMsgRequest> request;
             request = new TClntMsgRequest(declineIALst, duid, firstIA->getIfindex() );
-            Transactions.append( (Ptr*) request);
+            addTransaction( (Ptr*) request);
 
 	    // state of certain IAs has changed. Let's log it.
 	    ClntAddrMgr().dump();
@@ -1282,7 +1735,7 @@ void TClntTransMgr::checkRequest()
         // create REQUEST message
         SPtr<TClntMsgRequest> request;
         request = new TClntMsgRequest( requestIALst, duid, ifaceID );
-        Transactions.append( (Ptr*) request);
+        addTransaction( (Ptr*) request);
     } 
 }
 
@@ -1527,7 +1980,7 @@ bool TClntTransMgr::sendRemoteSolicit(SPtr<TNeighborInfo> neighbor) {
                                                  true /*rapid-commit */, 
                                                  true /* remote autoconf*/);
     neighbor->transid = solicit->getTransID();
-    Transactions.append(solicit);
+    addTransaction(solicit);
 
     return true;
 }
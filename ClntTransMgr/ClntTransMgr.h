@@ -11,12 +11,14 @@
 #ifndef CLNTTRANSMGR_H
 #define CLNTTRANSMGR_H
 #include <string>
+#include <set>
 #include "ClntCfgIface.h"
 #include "Opt.h"
 #include "OptAddrLst.h"
 #include "IPv6Addr.h"
 #include "AddrIA.h"
 #include "ClntMsg.h"
+#include "ClntTimerQueue.h"
 
 #define ClntTransMgr() (TClntTransMgr::instance())
 
@@ -30,8 +32,9 @@ class TClntTransMgr
     static TClntTransMgr &instance();
     ~TClntTransMgr();
     void doDuties();
+    void recheck();
     void relayMsg(SPtr<TClntMsg> msg);
-    unsigned long getTimeout();
+    uint64_t getTimeoutMs();
     void stop();
     void sendRequest(TOptList requestOptions, int iface);
     void sendInfRequest(TOptList requestOptions, int iface);
@@ -60,6 +63,11 @@ class TClntTransMgr
 
     bool sanitizeAddrDB();
 
+    // retransmission parameters
+    unsigned int getSolMaxRT() { return SolMaxRT; }
+    unsigned int getInfMaxRT() { return InfMaxRT; }
+    uint64_t getStartDelay(int ifindex, unsigned int maxDelay);
+
 #ifdef MOD_REMOTE_AUTOCONF
     struct TNeighborInfo {
 	typedef enum {
@@ -98,6 +106,14 @@ class TClntTransMgr
     void checkConfirm();
     void checkDB();
     void checkRenew();
+    void checkRenew(List(TAddrIA) iaLst, List(TAddrIA) pdLst);
+    unsigned int coalesceRenew(SPtr<TAddrIA> iaPattern, unsigned int window,
+                               List(TAddrIA)& renewIAs, List(TAddrIA)& renewPDs);
+    void checkInactive();
+    void scheduleTimers();
+    void scheduleIA(int type, unsigned long iaid);
+    void touch(int type, unsigned long iaid);
+    void touch(SPtr<TMsg> msg);
     void checkRequest();
     void checkSolicit();
     void checkInfRequest();
@@ -107,12 +123,42 @@ class TClntTransMgr
     bool openSockets(SPtr<TClntCfgIface> iface);
     bool populateAddrMgr(SPtr<TClntCfgIface> iface);
 
+    void addTransaction(SPtr<TClntMsg> msg);
+    void delTransaction(SPtr<TClntMsg> msg);
+    void processTransaction(unsigned long transid);
+    static bool sameDUID(SPtr<TDUID> a, SPtr<TDUID> b);
+    void updateMaxRT(SPtr<TClntMsg> answer);
+    void seedRand();
+
     void sortAdvertiseLst();
     void printLst(List(TMsg) lst);
 
     List(TClntMsg) Transactions;
+    TClntTimerQueue Timers; // retransmissions, T1 and other timers
+
+    // follow-up checks requested by events, done by the next doDuties()
+    enum {
+        CHECK_EXPIRED    = 0x01, // remove expired addresses and prefixes
+        CHECK_CONFIRM    = 0x02, // IAs marked for CONFIRM
+        CHECK_DECLINE    = 0x04, // DAD results
+        CHECK_SOLICIT    = 0x08, // IAs, TAs and PDs to be (re)configured
+        CHECK_RENEW      = 0x10, // IAs and PDs that reached T1 (T1 timers after startup)
+        CHECK_INFREQUEST = 0x20, // interfaces that need INFORMATION-REQUEST
+        CHECK_STATE      = 0x40, // state changed: store it and reschedule timers
+        CHECK_ALL        = 0x7f
+    };
+
     bool IsDone;         // isDone = true - client operation is finished
     bool Shutdown;       // is shutdown in progress?
+    unsigned int Checks; // CHECK_* flags
+
+    // IAs, TAs and PDs (IATYPE_*, IAID) whose timers need an update
+    std::set<std::pair<int, unsigned long> > Touched;
+    bool TouchedAll;     // timers of all IAs, TAs and PDs need an update
+
+    unsigned int SolMaxRT; // SOL_MAX_RT (may be updated by server)
+    unsigned int InfMaxRT; // INF_MAX_RT (may be updated by server)
+    std::set<int> StartedIfaces; // interfaces that already had their startup delay
 
     bool BindReuse; // Bug #56. Shall we allow running client and server on the same machine?
 
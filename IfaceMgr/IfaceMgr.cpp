@@ -153,6 +153,24 @@ SPtr<TIfaceIface> TIfaceMgr::getIfaceBySocket(int fd) {
 int TIfaceMgr::select(unsigned long time, char *buf,
                       int &bufsize, SPtr<TIPv6Addr> peer,
                       SPtr<TIPv6Addr> myaddr) {
+    return select(time, 0, buf, bufsize, peer, myaddr);
+}
+
+/**
+ * @brief waits for data with sub-second precision
+ *
+ * @param time number of seconds to wait
+ * @param usec number of additional microseconds to wait
+ * @param buf buffer the data will be stored in
+ * @param bufsize [in] buffer size, [out] number of bytes received
+ * @param peer [out] sender's address
+ * @param myaddr [out] address the data was received on
+ *
+ * @return socket descriptor (or -1 if nothing was received)
+ */
+int TIfaceMgr::select(unsigned long time, unsigned long usec, char *buf,
+                      int &bufsize, SPtr<TIPv6Addr> peer,
+                      SPtr<TIPv6Addr> myaddr) {
     struct timeval czas;
     int result;
     if (time > DHCPV6_INFINITY/2)
@@ -165,7 +183,7 @@ int TIfaceMgr::select(unsigned long time, char *buf,
 #endif
 
     czas.tv_sec=time;
-    czas.tv_usec=0;
+    czas.tv_usec=usec % 1000000;
 
     // tricks with FDS macros
     fd_set fds;
@@ -179,9 +197,9 @@ int TIfaceMgr::select(unsigned long time, char *buf,
     if (!TIfaceSocket::getCount()) {
         Log(Debug) << "No sockets open. Sleeping for " << time << " seconds." << LogEnd;
 #ifdef WIN32
-        Sleep(time*1000); // Windows sleep is specified in milliseconds
+        Sleep(time*1000 + czas.tv_usec/1000); // Windows sleep is specified in milliseconds
 #else
-        sleep(time); // Posix sleep is specified in seconds
+        ::select(0, NULL, NULL, NULL, &czas);
 #endif
         return 0;
     }
@@ -442,6 +460,7 @@ void TIfaceMgr::notifyScripts(const std::string& scriptName, SPtr<TMsg> question
 
     params.addParam("IFACE", iface->getName());
 
+    params.ifindex = iface->getID();
     tmp << dec << (int)iface->getID();
     params.addParam("IFINDEX", tmp.str().c_str());
     tmp.str("");
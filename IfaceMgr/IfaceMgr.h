@@ -38,6 +38,9 @@ class TIfaceMgr {
     // ---other---
     int select(unsigned long time, char *buf, int &bufsize, SPtr<TIPv6Addr> peer,
                SPtr<TIPv6Addr> myaddr);
+    int select(unsigned long time, unsigned long usec,
+               char *buf, int &bufsize, SPtr<TIPv6Addr> peer,
+               SPtr<TIPv6Addr> myaddr);
     std::string printMac(char * mac, int macLen);
     void dump();
     bool isDone();
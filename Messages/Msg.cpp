@@ -20,6 +20,7 @@
 #include "OptAuthentication.h"
 #include "Logger.h"
 #include "hmac-sha-md5.h"
+#include "HmacKey.h"
 
 class TNotifyScriptParams;
 
@@ -60,6 +61,7 @@ void TMsg::setAttribs(int iface, SPtr<TIPv6Addr> addr, int msgType, long transID
     AuthDigestPtr_ = NULL;
     AuthDigestLen_ = 0;
     SPI_ = 0;
+    optionsChanged();
 }
 
 int TMsg::getSize()
@@ -141,7 +143,7 @@ void TMsg::calculateDigests(char* buffer, size_t len) {
             return;
         }
         if (auth->getAuthDataPtr()) {
-            hmac_md5(buffer, len, (char*) &AuthKey_[0], AuthKey_.size() ,auth->getAuthDataPtr());
+            THmacKey::get(AuthKey_, DIGEST_HMAC_MD5)->sign(buffer, len, auth->getAuthDataPtr());
         }
         return;
     }
@@ -152,7 +154,7 @@ void TMsg::calculateDigests(char* buffer, size_t len) {
             return;
         }
         if (auth->getAuthDataPtr()) {
-            hmac_md5(buffer, len, (char*) &AuthKey_[0], AuthKey_.size() ,auth->getAuthDataPtr());
+            THmacKey::get(AuthKey_, DIGEST_HMAC_MD5)->sign(buffer, len, auth->getAuthDataPtr());
         }
         return;
     }
@@ -176,27 +178,13 @@ void TMsg::calculateDigests(char* buffer, size_t len) {
             case DIGEST_PLAIN:
                 memcpy(AuthDigestPtr_, "This is 32-byte plain testkey...", getDigestSize(UsedDigestType));
                 break;
-            case DIGEST_HMAC_MD5:
-                hmac_md5(buffer, len, (char*)&AuthKey_[0], AuthKey_.size(), (char *)AuthDigestPtr_);
-                break;
-            case DIGEST_HMAC_SHA1:
-                hmac_sha(buffer, len, (char*)&AuthKey_[0], AuthKey_.size(), (char *)AuthDigestPtr_, 1);
-                break;
-            case DIGEST_HMAC_SHA224:
-                hmac_sha(buffer, len, (char*)&AuthKey_[0], AuthKey_.size(), (char *)AuthDigestPtr_, 224);
-                break;
-            case DIGEST_HMAC_SHA256:
-                hmac_sha(buffer, len, (char*)&AuthKey_[0], AuthKey_.size(), (char *)AuthDigestPtr_, 256);
-                break;
-            case DIGEST_HMAC_SHA384:
-                hmac_sha(buffer, len, (char*)&AuthKey_[0], AuthKey_.size(), (char *)AuthDigestPtr_, 384);
-                break;
-            case DIGEST_HMAC_SHA512:
-                hmac_sha(buffer, len, (char*)&AuthKey_[0], AuthKey_.size(), (char *)AuthDigestPtr_, 512);
-                break;
-            default:
+            default: {
+                SPtr<THmacKey> hkey = THmacKey::get(AuthKey_, UsedDigestType);
+                if (hkey)
+                    hkey->sign(buffer, len, AuthDigestPtr_);
                 break;
             }
+            }
             PrintHex(std::string("Auth: Sending digest ") + getDigestName(UsedDigestType) +" : ",
 				 (uint8_t*)AuthDigestPtr_, getDigestSize(UsedDigestType));
         }
@@ -206,11 +194,60 @@ void TMsg::calculateDigests(char* buffer, size_t len) {
 }
 
 SPtr<TOpt> TMsg::getOption(int type) {
-    TOptList::iterator opt;
-    for (opt = Options.begin(); opt!=Options.end(); ++opt)
-        if ( (*opt)->getOptType()==type) 
-	    return *opt;
-    return SPtr<TOpt>();
+    if (!OptIndexValid_ || OptIndexSize_ != Options.size())
+        indexOptions();
+    if (type >= 0 && type < 64 && !(OptMask_ & ((uint64_t)1 << type)))
+        return SPtr<TOpt>();
+
+    std::map<int, TOptSlot>::const_iterator slot = OptIndex_.find(type);
+    if (slot == OptIndex_.end())
+        return SPtr<TOpt>();
+    return slot->second.First;
+}
+
+/// @brief returns number of options of specified type
+unsigned int TMsg::countOption(int type) {
+    if (!getOption(type))
+        return 0;
+    return OptIndex_[type].Count;
+}
+
+void TMsg::addOption(SPtr<TOpt> opt) {
+    Options.push_back(opt);
+    if (!opt || !OptIndexValid_ || OptIndexSize_ + 1 != Options.size()) {
+        OptIndexValid_ = false;
+        return;
+    }
+
+    int type = opt->getOptType();
+    TOptSlot& slot = OptIndex_[type];
+    if (!slot.Count++)
+        slot.First = opt;
+    if (type >= 0 && type < 64)
+        OptMask_ |= (uint64_t)1 << type;
+    OptIndexSize_++;
+}
+
+/// @brief must be called after Options were modified directly
+void TMsg::optionsChanged() {
+    OptIndexValid_ = false;
+}
+
+void TMsg::indexOptions() {
+    OptIndex_.clear();
+    OptMask_ = 0;
+    for (TOptList::const_iterator opt = Options.begin(); opt != Options.end(); ++opt) {
+        if (!*opt)
+            continue;
+        int type = (*opt)->getOptType();
+        TOptSlot& slot = OptIndex_[type];
+        if (!slot.Count++)
+            slot.First = *opt;
+        if (type >= 0 && type < 64)
+            OptMask_ |= (uint64_t)1 << type;
+    }
+    OptIndexSize_ = Options.size();
+    OptIndexValid_ = true;
 }
 
 void TMsg::firstOption() {
@@ -334,23 +371,19 @@ bool TMsg::validateAuthInfo(char *buf, int bufSize,
         }
 
         // Ok, let's do validation
-        char *rcvdAuthInfo = new char[RECONFIGURE_DIGEST_SIZE];
-        char *goodAuthInfo = new char[RECONFIGURE_DIGEST_SIZE];
+        char rcvdAuthInfo[DELAYED_AUTH_DIGEST_SIZE];
+        char goodAuthInfo[DELAYED_AUTH_DIGEST_SIZE];
 
         memmove(rcvdAuthInfo, AuthDigestPtr_, DELAYED_AUTH_DIGEST_SIZE);
         memset(AuthDigestPtr_, 0, DELAYED_AUTH_DIGEST_SIZE);
 
-        hmac_md5(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo);
+        THmacKey::get(AuthKey_, DIGEST_HMAC_MD5)->sign(buf, bufSize, goodAuthInfo);
 
         Log(Debug) << "Auth: Checking delayed-auth (HMAC-MD5) digest:" << LogEnd;
         PrintHex("Auth:received digest: ", (uint8_t*)rcvdAuthInfo, DELAYED_AUTH_DIGEST_SIZE);
         PrintHex("Auth:  proper digest: ", (uint8_t*)goodAuthInfo, DELAYED_AUTH_DIGEST_SIZE);
 
-        if (0 == memcmp(goodAuthInfo, rcvdAuthInfo, DELAYED_AUTH_DIGEST_SIZE))
-            is_ok = true;
-
-        delete [] rcvdAuthInfo;
-        delete [] goodAuthInfo;
+        is_ok = hmac_equal(goodAuthInfo, rcvdAuthInfo, DELAYED_AUTH_DIGEST_SIZE);
 
         return is_ok;
     }
@@ -389,23 +422,19 @@ bool TMsg::validateAuthInfo(char *buf, int bufSize,
             return false;
         }
 
-        char *rcvdAuthInfo = new char[RECONFIGURE_DIGEST_SIZE];
-        char *goodAuthInfo = new char[RECONFIGURE_DIGEST_SIZE];
+        char rcvdAuthInfo[RECONFIGURE_DIGEST_SIZE];
+        char goodAuthInfo[RECONFIGURE_DIGEST_SIZE];
 
         memmove(rcvdAuthInfo, AuthDigestPtr_, RECONFIGURE_DIGEST_SIZE);
         memset(AuthDigestPtr_, 0, RECONFIGURE_DIGEST_SIZE);
 
-        hmac_md5(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo);
+        THmacKey::get(AuthKey_, DIGEST_HMAC_MD5)->sign(buf, bufSize, goodAuthInfo);
 
         Log(Debug) << "Auth: Checking reconfigure-key" << LogEnd;
         PrintHex("Auth:received digest: ", (uint8_t*)rcvdAuthInfo, RECONFIGURE_DIGEST_SIZE);
         PrintHex("Auth:  proper digest: ", (uint8_t*)goodAuthInfo, RECONFIGURE_DIGEST_SIZE);
 
-        if (0 == memcmp(goodAuthInfo, rcvdAuthInfo, RECONFIGURE_DIGEST_SIZE))
-            is_ok = true;
-
-        delete [] rcvdAuthInfo;
-        delete [] goodAuthInfo;
+        is_ok = hmac_equal(goodAuthInfo, rcvdAuthInfo, RECONFIGURE_DIGEST_SIZE);
 
         return is_ok;
     }
@@ -446,49 +475,39 @@ bool TMsg::validateAuthInfo(char *buf, int bufSize,
         }
 
         unsigned AuthInfoLen = getDigestSize(DigestType_);
-        char *rcvdAuthInfo = new char[AuthInfoLen];
-        char *goodAuthInfo = new char[AuthInfoLen];
+        if (AuthInfoLen > HMAC_MAX_DIGESTSIZE) {
+            Log(Warning) << "Auth: Invalid digest size " << AuthInfoLen << LogEnd;
+            return false;
+        }
+        char rcvdAuthInfo[HMAC_MAX_DIGESTSIZE];
+        char goodAuthInfo[HMAC_MAX_DIGESTSIZE];
 
         memmove(rcvdAuthInfo, AuthDigestPtr_, AuthInfoLen);
         memset(AuthDigestPtr_, 0, AuthInfoLen);
+        memset(goodAuthInfo, 0, AuthInfoLen);
 
+        bool known = true;
         switch (DigestType_) {
                 case DIGEST_PLAIN:
                     /// @todo: load plain text from a file
                     memcpy(goodAuthInfo, "This is 32-byte plain testkey...", 32);
                     break;
-                case DIGEST_HMAC_MD5:
-                    hmac_md5(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo);
-                    break;
-                case DIGEST_HMAC_SHA1:
-                    hmac_sha(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo, 1);
-                    break;
-                case DIGEST_HMAC_SHA224:
-                    hmac_sha(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo, 224);
-                    break;
-                case DIGEST_HMAC_SHA256:
-                    hmac_sha(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo, 256);
-                    break;
-                case DIGEST_HMAC_SHA384:
-                    hmac_sha(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo, 384);
-                    break;
-                case DIGEST_HMAC_SHA512:
-                    hmac_sha(buf, bufSize, (char*)&AuthKey_[0], AuthKey_.size(), goodAuthInfo, 512);
-                    break;
-                default:
+                default: {
+                    SPtr<THmacKey> hkey = THmacKey::get(AuthKey_, DigestType_);
+                    if (hkey)
+                        hkey->sign(buf, bufSize, goodAuthInfo);
+                    else
+                        known = false;
                     break;
+                }
         }
-        if (0 == memcmp(goodAuthInfo, rcvdAuthInfo, AuthInfoLen))
-            is_ok = true;
+        is_ok = known && hmac_equal(goodAuthInfo, rcvdAuthInfo, AuthInfoLen);
 
         Log(Debug) << "Auth:Checking using digest method: "
                    << getDigestName(DigestType_) << LogEnd;
         PrintHex("Auth:received digest: ", (uint8_t*)rcvdAuthInfo, AuthInfoLen);
         PrintHex("Auth:  proper digest: ", (uint8_t*)goodAuthInfo, AuthInfoLen);
 
-        delete [] rcvdAuthInfo;
-        delete [] goodAuthInfo;
-
         if (is_ok)
             Log(Info) << "Auth: Digest correct." << LogEnd;
         else {
@@ -514,29 +533,10 @@ bool TMsg::validateAuthInfo(char *buf, int bufSize,
  */
 bool TMsg::check(bool clntIDmandatory, bool srvIDmandatory)
 {
-    SPtr<TOpt> option;
-    int clntCnt=0;
-    int srvCnt =0;
-    int authCnt = 0;
     bool status = true;
-
-    for (TOptList::iterator opt=Options.begin(); opt!=Options.end(); ++opt)
-    {
-	switch ( (*opt)->getOptType() ) {
-	case OPTION_CLIENTID:
-	    clntCnt++;
-	    break;
-	case OPTION_SERVERID:
-	    srvCnt++;
-	    break;
-	case OPTION_AUTH:
-	    authCnt++;
-	    break;
-	default:
-	    break;
-	    /* ignore the rest */
-	}
-    }
+    unsigned int clntCnt = countOption(OPTION_CLIENTID);
+    unsigned int srvCnt = countOption(OPTION_SERVERID);
+    unsigned int authCnt = countOption(OPTION_AUTH);
 
     if (clntIDmandatory && (clntCnt!=1) ) {
 	Log(Warning) << "Exactly 1 ClientID option required in the " << this->getName() 
@@ -572,15 +572,28 @@ bool TMsg::check(bool clntIDmandatory, bool srvIDmandatory)
 
 bool TMsg::delOption(int code)
 {
-    for (TOptList::iterator opt = Options.begin(); opt!=Options.end(); ++opt)
-    {
-	if ( (*opt)->getOptType() == code) {
-	    Options.erase(opt);
-	    firstOption();
-	    return true;
-	}
+    if (!getOption(code))
+        return false;
+
+    TOptList::iterator opt = Options.begin();
+    while ((*opt)->getOptType() != code)
+        ++opt;
+    opt = Options.erase(opt);
+    firstOption();
+
+    TOptSlot& slot = OptIndex_[code];
+    if (--slot.Count) {
+        // next one becomes the first occurrence
+        while ((*opt)->getOptType() != code)
+            ++opt;
+        slot.First = *opt;
+    } else {
+        OptIndex_.erase(code);
+        if (code >= 0 && code < 64)
+            OptMask_ &= ~((uint64_t)1 << code);
     }
-    return false;
+    OptIndexSize_--;
+    return true;
 }
 
 void* TMsg::getNotifyScriptParams() {
@@ -16,6 +16,7 @@ class TMsg;
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
 #include "SmartPtr.h"
 #include "Container.h"
 #include "DHCPConst.h"
@@ -47,10 +48,13 @@ class TMsg
 
     // returns requested option (or NULL, there is no such option)
     SPtr<TOpt> getOption(int type);
-    void firstOption();
     int countOption();
-    void addOption(SPtr<TOpt> opt) { Options.push_back(opt); }
+    unsigned int countOption(int type);
+    void addOption(SPtr<TOpt> opt);
 
+    /// @deprecated cursor API, iterate over getOptLst() instead
+    void firstOption();
+    /// @deprecated cursor API, iterate over getOptLst() instead
     virtual SPtr<TOpt> getOption();
 
     long getType();
@@ -89,7 +93,10 @@ class TMsg
     long TransID;
 
     bool delOption(int code);
+    void optionsChanged();
 
+    /// Options may be modified directly, but anything else than addOption()
+    /// or delOption() must be followed by optionsChanged()
     TOptList Options;
     TOptList::iterator NextOpt; // to be removed together with firstOption() and getOption();
     void setAttribs(int iface, SPtr<TIPv6Addr> addr,
@@ -116,6 +123,24 @@ class TMsg
 
     // a pointer to NotifyScriptParams structure (if defined)
     TNotifyScriptParams* NotifyScripts;
+
+  private:
+    /// first occurrence and number of options of one type
+    struct TOptSlot {
+        TOptSlot() :Count(0) {}
+        SPtr<TOpt> First;
+        unsigned int Count;
+    };
+
+    void indexOptions();
+
+    /// Option index, so lookups don't walk Options. addOption() and
+    /// delOption() keep it up to date (so it is filled while a message is
+    /// decoded), other changes get it rebuilt on the next lookup.
+    std::map<int, TOptSlot> OptIndex_;
+    uint64_t OptMask_;     ///< bit N is set if option N (N < 64) is present
+    size_t OptIndexSize_;  ///< Options.size() covered by the index
+    bool OptIndexValid_;
 };
 
 typedef std::list< SPtr<TMsg> > TMsgLst;
@@ -0,0 +1,122 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * Released under GNU GPL v2 licence
+ *
+ */
+
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+#include <limits.h>
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+/// @brief full memory barrier
+inline void atomicBarrier() {
+#ifdef WIN32
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+}
+
+/// @brief atomically adds delta, returns new value
+inline long atomicAdd(volatile long* value, long delta) {
+#ifdef WIN32
+    return InterlockedExchangeAdd(value, delta) + delta;
+#else
+    return __sync_add_and_fetch(value, delta);
+#endif
+}
+
+/// @brief sets value to desired if it is equal to expected
+///
+/// @return true if value was changed
+inline bool atomicCas(volatile long* value, long expected, long desired) {
+#ifdef WIN32
+    return InterlockedCompareExchange(value, desired, expected) == expected;
+#else
+    return __sync_bool_compare_and_swap(value, expected, desired);
+#endif
+}
+
+/// @brief reads a pointer published by other thread
+template <class T>
+inline T* atomicLoadPtr(T* volatile* ptr) {
+    T* x = *ptr;
+    atomicBarrier();
+    return x;
+}
+
+/// @brief publishes a pointer (everything written before is visible to
+///        threads that read it with atomicLoadPtr())
+template <class T>
+inline void atomicStorePtr(T* volatile* ptr, T* x) {
+    atomicBarrier();
+    *ptr = x;
+    atomicBarrier();
+}
+
+/// @brief usage counter that may be modified by many threads
+///
+/// Never goes below zero: sub() of more than the current value sets it
+/// to zero, the same way pool counters always did. It doesn't wrap around
+/// either: add() saturates at LONG_MAX (e.g. sum of free counts of huge
+/// pools).
+class TAtomicCounter
+{
+public:
+    TAtomicCounter(unsigned long value = 0)
+        :Value_((long)value) {
+    }
+
+    TAtomicCounter(const TAtomicCounter& other)
+        :Value_((long)other.get()) {
+    }
+
+    TAtomicCounter& operator=(const TAtomicCounter& other) {
+        set(other.get());
+        return *this;
+    }
+
+    /// @return new value
+    unsigned long add(unsigned long count = 1) {
+        while (true) {
+            long old = Value_;
+            long value = count > (unsigned long)(LONG_MAX - old) ? LONG_MAX : old + (long)count;
+            if (atomicCas(&Value_, old, value))
+                return (unsigned long)value;
+        }
+    }
+
+    /// @return new value
+    unsigned long sub(unsigned long count = 1) {
+        while (true) {
+            long old = Value_;
+            long value = (unsigned long)old < count ? 0 : old - (long)count;
+            if (atomicCas(&Value_, old, value))
+                return (unsigned long)value;
+        }
+    }
+
+    unsigned long get() const {
+        long x = Value_;
+        atomicBarrier();
+        return (unsigned long)x;
+    }
+
+    void set(unsigned long value) {
+        atomicBarrier();
+        Value_ = (long)value;
+        atomicBarrier();
+    }
+
+private:
+    volatile long Value_;
+};
+
+#endif
@@ -13,8 +13,10 @@
 
 #include <list>
 #include <stdlib.h>
+#include "SmallVector.h"
 
 #define List(x) TContainer< SPtr< x > >
+#define SmallList(x) TSmallContainer< SPtr< x > >
 
 template <class TYP>
 class TContainer{
@@ -110,4 +112,96 @@ void TContainer<TYP>::first() {
         return;
 }
 
+/// @brief contiguous replacement for TContainer
+///
+/// Offers the TContainer interface (append(), first()/get()/del(), ...)
+/// on top of TSmallVector, so modules can switch from List(x) to
+/// SmallList(x) without touching every loop, then move loops to
+/// begin()/end() iterators one by one. Iterators don't share any state,
+/// so traversals may be nested; the first()/get() cursor is still one per
+/// container and should only be used by code that doesn't call anything
+/// that could traverse the same container.
+///
+/// Unlike TContainer, del() doesn't rewind the cursor: it stays on the
+/// element that followed the deleted one.
+template <class TYP, unsigned int N = 4>
+class TSmallContainer {
+public:
+    typedef TSmallVector<TYP, N> container_type;
+    typedef typename container_type::iterator iterator;
+    typedef typename container_type::const_iterator const_iterator;
+
+    TSmallContainer()
+        :Cursor_(0) {
+    }
+
+    iterator begin() { return Vec_.begin(); }
+    iterator end() { return Vec_.end(); }
+    const_iterator begin() const { return Vec_.begin(); }
+    const_iterator end() const { return Vec_.end(); }
+
+    void append(const TYP &foo) {
+        Vec_.push_back(foo);
+    }
+
+    size_t count() const {
+        return Vec_.size();
+    }
+
+    bool empty() const {
+        return Vec_.empty();
+    }
+
+    /// @brief removes element, returns iterator to the one that followed it
+    iterator erase(iterator pos) {
+        size_t idx = pos - Vec_.begin();
+        if (idx < Cursor_)
+            Cursor_--;
+        return Vec_.erase(pos);
+    }
+
+    void first() {
+        Cursor_ = 0;
+    }
+
+    TYP get() {
+        if (Cursor_ < Vec_.size())
+            return Vec_[Cursor_++];
+        return TYP();
+    }
+
+    /// @brief removes element returned by the last get()
+    void del() {
+        if (Cursor_)
+            erase(Vec_.begin() + Cursor_ - 1);
+    }
+
+    void delFirst() {
+        if (!Vec_.empty())
+            erase(Vec_.begin());
+    }
+
+    void delLast() {
+        if (!Vec_.empty())
+            erase(Vec_.end() - 1);
+    }
+
+    TYP getFirst() const {
+        return Vec_.empty() ? TYP() : Vec_.front();
+    }
+
+    TYP getLast() const {
+        return Vec_.empty() ? TYP() : Vec_.back();
+    }
+
+    void clear() {
+        Vec_.clear();
+        Cursor_ = 0;
+    }
+
+private:
+    container_type Vec_;
+    size_t Cursor_;
+};
+
 #endif
@@ -161,18 +161,20 @@ void TDHCPClient::run()
 #ifdef MOD_CLNT_CONFIRM
         if (linkstateChange) {
           ClntAddrMgr().setIA2Confirm(&linkstates);
+          ClntIfaceMgr().linkChanged();
+          ClntTransMgr().recheck();
           this->resetLinkstate();
         }
 #endif
 
         ClntTransMgr().doDuties();
 
-        unsigned int timeout = ClntTransMgr().getTimeout();
+        uint64_t timeout = ClntTransMgr().getTimeoutMs();
 
         if (timeout == 0)
             timeout = 1;
 
-        Log(Debug) << "Sleeping for " << timeout << " second(s)." << LogEnd;
+        Log(Debug) << "Sleeping for " << timeout << " ms." << LogEnd;
         SPtr<TClntMsg> msg=ClntIfaceMgr().select(timeout);
 
         if (msg) {
@@ -191,6 +193,7 @@ void TDHCPClient::run()
             ClntTransMgr().relayMsg(msg);
         }
     }
+    ClntIfaceMgr().finishJobs();
     Log(Notice) << "Bye bye." << LogEnd;
 }
 
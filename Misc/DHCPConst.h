@@ -42,7 +42,7 @@
 
 #define SOL_MAX_DELAY 1
 #define SOL_TIMEOUT   1
-#define SOL_MAX_RT    120
+#define SOL_MAX_RT    3600 /* RFC8415, was 120 in RFC3315 */
 #define REQ_TIMEOUT   1
 #define REQ_MAX_RT    30
 #define REQ_MAX_RC    10
@@ -56,7 +56,7 @@
 #define REB_MAX_RT    600
 #define INF_MAX_DELAY 1
 #define INF_TIMEOUT   1
-#define INF_MAX_RT    120
+#define INF_MAX_RT    3600 /* RFC8415, was 120 in RFC3315 */
 #define REL_TIMEOUT   1
 #define REL_MAX_RC    5
 #define DEC_TIMEOUT   1
@@ -64,6 +64,10 @@
 #define REC_TIMEOUT   2
 #define REC_MAX_RC    8
 
+// allowed values of SOL_MAX_RT and INF_MAX_RT options (RFC8415, 21.24, 21.25)
+#define MAX_RT_OPTION_MIN 60
+#define MAX_RT_OPTION_MAX 86400
+
 #define HOP_COUNT_LIMIT 32
 
 // how long does server caches its replies?
@@ -159,6 +163,10 @@
 // RFC6939
 #define OPTION_CLIENT_LINKLAYER_ADDR 79
 
+// RFC8415
+#define OPTION_SOL_MAX_RT       82
+#define OPTION_INF_MAX_RT       83
+
 // draft-ietf-mif-dhcpv6-route-option-04
 #define OPTION_NEXT_HOP         242
 #define OPTION_RTPREFIX         243
@@ -180,6 +188,8 @@ typedef enum {
 // (value of the len field, so actual option length is +4 bytes)
 #define OPTION_ELAPSED_TIME_LEN     2
 #define OPTION_INFORMATION_REFRESH_TIME_LEN         4
+#define OPTION_SOL_MAX_RT_LEN       4
+#define OPTION_INF_MAX_RT_LEN       4
 
 // --- Status Codes ---
 /// @todo: convert this to enum
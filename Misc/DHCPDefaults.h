@@ -19,6 +19,9 @@
 // addresses reported as DECLINED are not used for 2 hours
 #define DECLINED_TIMEOUT ((unsigned long) 7200)
 
+// number of precomputed HMAC keys (AUTH) kept between messages
+#define HMAC_KEY_CACHE_SIZE 64
+
 // 1 (quiet) - 8 (debug)
 #define DEFAULT_LOGLEVEL 7
 
@@ -55,12 +58,80 @@
 // see DHCPConst.h for available enums
 #define SERVER_DEFAULT_UNKNOWN_FQDN UNKNOWN_FQDN_REJECT
 
+// server load: number of queued messages or estimated reply latency (ms) above
+// which the server is considered overloaded (a quarter of that means busy)
+#define SERVER_DEFAULT_LOAD_BACKLOG 64
+#define SERVER_DEFAULT_LOAD_LATENCY 1000
+// how long (in seconds) elevated load level is kept after it was last observed
+#define SERVER_DEFAULT_LOAD_HOLD 30
+// SOL_MAX_RT/INF_MAX_RT sent to clients when busy and when overloaded (or out
+// of addresses)
+#define SERVER_DEFAULT_BUSY_MAX_RT 3600
+#define SERVER_DEFAULT_OVERLOAD_MAX_RT 14400
+// rejected clients (not supported, no class allowed) are remembered for that
+// many seconds, up to that many clients
+#define SERVER_DEFAULT_REJECT_CACHE_TTL 30
+#define SERVER_DEFAULT_REJECT_CACHE_SIZE 1024
+// walk address pools in keyed pseudo-random order (every address is visited
+// once per cycle); at most that many addresses are checked for one lease
+#define SERVER_DEFAULT_ADDR_PERMUTATION true
+#define SERVER_MAX_IA_PERMUTATION_STEPS 65536
+// number of lease extensions (RENEW/REBIND) journaled before whole lease
+// database is dumped again
+#define SERVER_DEFAULT_JOURNAL_MAX 1000
+// leases renewed before that percentage of valid lifetime elapsed (and before
+// T1) are returned unchanged, with remaining lifetimes (0 disables)
+#define SERVER_DEFAULT_LEASE_REUSE 0
+#define SERVER_MAX_LEASE_REUSE 100
+// replies are remembered for that many seconds (up to that many replies), so
+// retransmitted messages are answered without processing them again
+#define SERVER_DEFAULT_REPLY_CACHE_TTL 3
+#define SERVER_DEFAULT_REPLY_CACHE_SIZE 4096
+// replies to RENEW/REBIND are kept (for up to that many clients) as templates
+// for the next RENEW/REBIND from the same client (0 disables)
+#define SERVER_DEFAULT_RENEW_TEMPLATES 65536
+// lease synchronization between two servers: TCP port the secondary listens on,
+// how often primary tries to connect, after how many seconds of disconnection
+// partner's clients are taken over and how many bytes may be queued for it
+#define SERVER_DEFAULT_LEASE_SYNC_PORT 647
+#define SERVER_DEFAULT_LEASE_SYNC_RETRY 10
+#define SERVER_DEFAULT_LEASE_SYNC_TAKEOVER 30
+#define SERVER_DEFAULT_LEASE_SYNC_QUEUE 1048576
+// at most that many percent of a pool may be held in DECLINE quarantine
+// (for DECLINED_TIMEOUT seconds)
+#define SERVER_DEFAULT_DECLINE_MAX_SHARE 25
+// temporary addresses are allocated from a ring of that many slots per TA
+// pool (larger pools are covered partially, 0 disables rings); TA leases may
+// be kept in memory only (never written to the lease database)
+#define SERVER_TA_RING_SIZE 65536
+#define SERVER_DEFAULT_TA_MEMORY_ONLY false
+
 #define CLIENT_DEFAULT_T1 UINT_MAX
 #define CLIENT_DEFAULT_T2 UINT_MAX
 
 #define CLIENT_DEFAULT_UNICAST false
 #define CLIENT_DEFAULT_RAPID_COMMIT false
 
+// IAs and PDs that would reach T1 within that many seconds are renewed
+// together with the one that triggered RENEW (0 disables coalescing)
+#define CLIENT_DEFAULT_RENEW_COALESCE 0
+
+// DNS updates and scripts are run in background. Hung script is killed after
+// that many seconds, pending jobs are dropped if not done that long after shutdown
+#define CLIENT_DEFAULT_SCRIPT_TIMEOUT 60
+#define CLIENT_DEFAULT_WORKER_SHUTDOWN 10
+
+// delay (in seconds) before DNS Update, so the address is ready to use
+#define CLIENT_DNSUPDATE_DELAY 3
+
+// failed DNS Update is retried that many times (delay doubled each time)
+#define CLIENT_DNSUPDATE_RETRIES 3
+
+// first SOLICIT/INF-REQUEST/CONFIRM after startup is delayed by a random time
+// up to that many seconds (on top of SOL_MAX_DELAY etc.), so devices that
+// start at the same time (e.g. after power outage) don't flood servers
+#define CLIENT_DEFAULT_STARTUP_SPREAD 0
+
 // It is now /128. See discussion in bug #222
 #define CLIENT_DEFAULT_PREFIX_LENGTH 128
 
@@ -64,6 +64,18 @@ TDHCPServer::TDHCPServer(const std::string& config)
 
     SrvAddrMgr().dump();
 
+    SrvAddrMgr().getQuarantine().setLimits(SrvCfgMgr().getDeclineHoldTime(),
+                                           SrvCfgMgr().getDeclineMaxShare());
+
+    if (SrvCfgMgr().getLeaseSyncPeer()) {
+        SrvAddrMgr().getLeaseSync().start(SrvCfgMgr().getLeaseSyncPrimary() ?
+                                          TSrvLeaseSync::ROLE_PRIMARY :
+                                          TSrvLeaseSync::ROLE_SECONDARY,
+                                          SrvCfgMgr().getLeaseSyncPeer(),
+                                          SrvCfgMgr().getLeaseSyncPort(),
+                                          SrvCfgMgr().getLeaseSyncSecret());
+    }
+
     SrvCfgMgr().removeReservedFromCache();
     SrvCfgMgr().setCounters();
     SrvCfgMgr().dump();
@@ -74,8 +86,15 @@ void TDHCPServer::run()
 {
     Log(Notice) << "Server begins operation." << LogEnd;
 
+    // packet processing reads configuration snapshots; snapshots replaced
+    // while a packet was processed are freed when it's done
+    int cfgReader = SrvCfgMgr().registerReader();
+
     bool silent = false;
     while ( (!isDone()) && (!SrvTransMgr().isDone()) ) {
+        SrvCfgMgr().quiescent(cfgReader);
+        SrvCfgMgr().reclaimSnapshots();
+
         if (serviceShutdown)
             SrvTransMgr().shutdown();
 
@@ -137,7 +156,9 @@ void TDHCPServer::run()
         SrvTransMgr().relayMsg(msg);
     }
 
+    SrvCfgMgr().unregisterReader(cfgReader);
     SrvCfgMgr().setPerformanceMode(false);
+    SrvAddrMgr().getLeaseSync().stop();
     SrvAddrMgr().dump();
 
     SrvIfaceMgr().closeSockets();
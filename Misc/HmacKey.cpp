@@ -0,0 +1,99 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ */
+
+#include "HmacKey.h"
+#include "DHCPDefaults.h"
+
+using namespace std;
+
+THmacKey::TCache THmacKey::Cache_;
+
+/// @brief maps digest type to hmac_sha_md5 type (0 if it's not HMAC)
+static int hmacType(DigestTypes type)
+{
+    switch (type) {
+    case DIGEST_HMAC_MD5:    return 5;
+    case DIGEST_HMAC_SHA1:   return 1;
+    case DIGEST_HMAC_SHA224: return 224;
+    case DIGEST_HMAC_SHA256: return 256;
+    case DIGEST_HMAC_SHA384: return 384;
+    case DIGEST_HMAC_SHA512: return 512;
+    default:                 return 0;
+    }
+}
+
+THmacKey::THmacKey(const TKey& key, DigestTypes type)
+    :Type_(type), Valid_(false)
+{
+    const char* data = key.empty() ? "" : (const char*)&key[0];
+    Valid_ = hmacType(type) && hmac_key_init(&Schedule_, data, key.size(), hmacType(type));
+}
+
+bool THmacKey::valid() const
+{
+    return Valid_;
+}
+
+DigestTypes THmacKey::getType() const
+{
+    return Type_;
+}
+
+unsigned int THmacKey::getDigestSize() const
+{
+    return Valid_ ? Schedule_.digestsize : 0;
+}
+
+/// @brief calculates HMAC of the buffer
+///
+/// @param buf message to sign
+/// @param len length of the message
+/// @param digest [out] getDigestSize() bytes of digest are written here
+void THmacKey::sign(const char* buf, size_t len, char* digest) const
+{
+    if (Valid_)
+        hmac_key_digest(&Schedule_, buf, len, digest);
+}
+
+/// @brief returns prepared key, computing it only if it's not cached yet
+///
+/// Keys are cached by their data, not by SPI, so a key changed under
+/// the same SPI is never confused with the old one.
+///
+/// @param key key data
+/// @param type HMAC digest type
+///
+/// @return prepared key (or NULL if type is not an HMAC digest)
+SPtr<THmacKey> THmacKey::get(const TKey& key, DigestTypes type)
+{
+    if (!hmacType(type))
+        return SPtr<THmacKey>();
+
+    pair<int, string> id(type, key.empty() ? string() : string((const char*)&key[0], key.size()));
+    TCache::const_iterator it = Cache_.find(id);
+    if (it != Cache_.end())
+        return it->second;
+
+    // keys are rarely replaced, so just start over when the cache is full
+    if (Cache_.size() >= HMAC_KEY_CACHE_SIZE)
+        Cache_.clear();
+
+    SPtr<THmacKey> hkey = new THmacKey(key, type);
+    Cache_[id] = hkey;
+    return hkey;
+}
+
+void THmacKey::clearCache()
+{
+    Cache_.clear();
+}
+
+unsigned int THmacKey::getCacheSize()
+{
+    return Cache_.size();
+}
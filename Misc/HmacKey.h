@@ -0,0 +1,51 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ */
+
+#ifndef HMACKEY_H
+#define HMACKEY_H
+
+#include <map>
+#include <string>
+#include "SmartPtr.h"
+#include "DHCPConst.h"
+#include "Key.h"
+#include "hmac-sha-md5.h"
+
+/// @brief HMAC key with precomputed inner and outer hash states
+///
+/// Hashing ipad/opad blocks is done once per key, so signing or verifying
+/// a message only hashes the message itself. Everything is computed on the
+/// stack, without allocations.
+///
+/// Messages are signed with the same few keys (SPI keys, reconfigure keys),
+/// so prepared keys are cached (see get()).
+class THmacKey
+{
+ public:
+    THmacKey(const TKey& key, DigestTypes type);
+
+    bool valid() const;
+    DigestTypes getType() const;
+    unsigned int getDigestSize() const;
+
+    void sign(const char* buf, size_t len, char* digest) const;
+
+    static SPtr<THmacKey> get(const TKey& key, DigestTypes type);
+    static void clearCache();
+    static unsigned int getCacheSize();
+
+ private:
+    typedef std::map<std::pair<int, std::string>, SPtr<THmacKey> > TCache;
+    static TCache Cache_; ///< keyed by (digest type, key data)
+
+    struct hmac_key Schedule_;
+    DigestTypes Type_;
+    bool Valid_;
+};
+
+#endif
@@ -128,13 +128,8 @@ std::ostream& operator<<(std::ostream& out,TIPv6Addr& addr)
 
 bool TIPv6Addr::operator<=(const TIPv6Addr &other)
 {
-    for (int i=0;i<16;i++) {
-        if (Addr[i]<other.Addr[i])
-            return true;
-        if(Addr[i]>other.Addr[i])
-            return false;
-    }
-    return true; //hmm: are they equal
+    // bytes must be compared as unsigned, or 8000:: would be smaller than ::1
+    return memcmp(Addr, other.Addr, 16) <= 0;
 }
 
 TIPv6Addr TIPv6Addr::operator-(const TIPv6Addr &other)
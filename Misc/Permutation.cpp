@@ -0,0 +1,117 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "Permutation.h"
+
+/// number of Feistel rounds (4 rounds give a strong pseudo-random permutation)
+static const int FEISTEL_ROUNDS = 4;
+
+TPermutation::TPermutation()
+    :Last_(0), Key_(0), Cursor_(0), HalfBits_(1), HalfMask_(1)
+{
+}
+
+/**
+ * @brief sets up permutation of 0..last
+ *
+ * @param last largest index that can be returned
+ * @param key permutation key
+ */
+void TPermutation::init(uint64_t last, uint64_t key)
+{
+    int bits = 0;
+    while (bits < 64 && (last >> bits))
+        bits++;
+    if (bits < 2)
+        bits = 2;
+
+    Last_ = last;
+    Key_ = key;
+    Cursor_ = 0;
+    HalfBits_ = (bits + 1)/2;
+    HalfMask_ = (HalfBits_ == 32) ? 0xffffffffULL : ((1ULL << HalfBits_) - 1);
+}
+
+/// returns index at specified position of the permutation
+uint64_t TPermutation::permute(uint64_t index) const
+{
+    if (index > Last_)
+        return index;
+
+    // cycle walking: the index is in range, so this terminates
+    uint64_t x = encrypt(index);
+    while (x > Last_)
+        x = encrypt(x);
+    return x;
+}
+
+/// returns position of specified index in the permutation (inverse of permute())
+uint64_t TPermutation::unpermute(uint64_t value) const
+{
+    if (value > Last_)
+        return value;
+
+    // cycle walking backwards: the value is in range, so this terminates
+    uint64_t x = decrypt(value);
+    while (x > Last_)
+        x = decrypt(x);
+    return x;
+}
+
+/// returns next index of the permutation (and moves the cursor)
+uint64_t TPermutation::next()
+{
+    uint64_t x = permute(Cursor_);
+    Cursor_ = (Cursor_ == Last_) ? 0 : Cursor_ + 1;
+    return x;
+}
+
+uint64_t TPermutation::getLast() const
+{
+    return Last_;
+}
+
+uint64_t TPermutation::getCursor() const
+{
+    return Cursor_;
+}
+
+uint64_t TPermutation::encrypt(uint64_t x) const
+{
+    uint64_t left = (x >> HalfBits_) & HalfMask_;
+    uint64_t right = x & HalfMask_;
+    for (int i = 0; i < FEISTEL_ROUNDS; i++) {
+        uint64_t tmp = right;
+        right = left ^ mix(right, i);
+        left = tmp;
+    }
+    return (left << HalfBits_) | right;
+}
+
+uint64_t TPermutation::decrypt(uint64_t x) const
+{
+    uint64_t left = (x >> HalfBits_) & HalfMask_;
+    uint64_t right = x & HalfMask_;
+    for (int i = FEISTEL_ROUNDS - 1; i >= 0; i--) {
+        uint64_t tmp = left;
+        left = right ^ mix(left, i);
+        right = tmp;
+    }
+    return (left << HalfBits_) | right;
+}
+
+/// Feistel round function (splitmix64 finalizer over key, round and half)
+uint64_t TPermutation::mix(uint64_t half, int round) const
+{
+    uint64_t z = Key_ + (uint64_t)(round + 1)*0x9e3779b97f4a7c15ULL + half;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    return z & HalfMask_;
+}
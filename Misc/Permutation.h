@@ -0,0 +1,51 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef PERMUTATION_H
+#define PERMUTATION_H
+
+#include <stdint.h>
+
+/// @brief keyed pseudo-random permutation of 0..last with a cursor
+///
+/// Indexes are permuted with a balanced Feistel network over the smallest
+/// even number of bits that covers the whole range. Values that fall
+/// outside of the range are encrypted again (cycle walking) until they
+/// land inside it, so the result is a permutation of exactly 0..last.
+/// The domain is never more than 4 times larger than the range, so it
+/// takes less than 4 rounds of encryption on average.
+///
+/// next() walks the permutation using a cursor, so every index is returned
+/// exactly once in any (last+1) consecutive calls, while the order still
+/// looks random to anyone who does not know the key.
+class TPermutation
+{
+ public:
+    TPermutation();
+    void init(uint64_t last, uint64_t key);
+    uint64_t permute(uint64_t index) const;
+    uint64_t unpermute(uint64_t value) const;
+    uint64_t next();
+
+    uint64_t getLast() const;
+    uint64_t getCursor() const;
+
+ private:
+    uint64_t encrypt(uint64_t x) const;
+    uint64_t decrypt(uint64_t x) const;
+    uint64_t mix(uint64_t half, int round) const;
+
+    uint64_t Last_;    ///< largest index in the range
+    uint64_t Key_;
+    uint64_t Cursor_;  ///< index to be permuted by next call to next()
+    int HalfBits_;     ///< number of bits in each Feistel half
+    uint64_t HalfMask_;
+};
+
+#endif
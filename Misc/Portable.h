@@ -107,6 +107,7 @@ struct link_state_notify_t
 #define CLNTDUID_FILE	  "client-duid"
 #define CLNTADDRMGR_FILE  "client-AddrMgr.xml"
 #define CLNTTRANSMGR_FILE "client-TransMgr.xml"
+#define CLNTPDSPLIT_FILE  "client-PDSplit.txt"
 
 #define SRVCFGMGR_FILE    "server-CfgMgr.xml"
 #define SRVIFACEMGR_FILE  "server-IfaceMgr.xml"
@@ -261,6 +262,17 @@ unsigned long pref, unsigned long valid, int prefixLength);
     extern int ipaddr_update(const char* ifacename, int ifindex, const char* addr,
 			     unsigned long pref, unsigned long valid, int prefixLength);
     extern int ipaddr_del(const char* ifacename, int ifindex, const char* addr, int prefixLength);
+
+    /* address operations issued between these two calls may be queued and
+       applied together. Calls may be nested. Commit applies everything queued
+       so far if its level queued anything, and returns the first error of
+       operations queued at its level. */
+    extern int ipaddr_batch_begin();
+    extern int ipaddr_batch_commit();
+    /* id of the last queued address/route operation (0 if operations are not
+       queued on this system) and its result, known after it was committed */
+    extern unsigned ipaddr_batch_last();
+    extern int ipaddr_batch_result(unsigned id);
     
     /* add socket to interface */
     extern int sock_add(char* ifacename,int ifaceid, char* addr, int port, int thisifaceonly, int reuse);
@@ -302,6 +314,12 @@ unsigned long pref, unsigned long valid, int prefixLength);
     extern char * error_message();
 
     /* options */
+
+    /* option changes made between these two calls are applied together,
+       config files are written once and only if their content changes */
+    extern int cfg_batch_begin();
+    extern int cfg_batch_commit();
+
     extern int dns_add(const char* ifname, int ifindex, const char* addrPlain);
     extern int dns_del(const char* ifname, int ifindex, const char* addrPlain);
     extern int domain_add(const char* ifname, int ifindex, const char* domain);
@@ -0,0 +1,139 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * Released under GNU GPL v2 licence
+ *
+ */
+
+#ifndef RCU_H
+#define RCU_H
+
+#include <vector>
+#include <utility>
+#include <stddef.h>
+#include "Atomic.h"
+
+/// @brief pointer to an immutable object, read without locks (RCU style)
+///
+/// Writer builds a new object and publishes it; readers get the current
+/// one with get(), without any locking. Objects replaced by publish() are
+/// retired and deleted only when no reader may still use them.
+///
+/// Readers register with registerReader() and call quiescent() whenever
+/// they don't hold any pointer obtained from get() (e.g. after each
+/// packet). Object retired by a publish() is deleted once every registered
+/// reader reported quiescent state after that publish(). Unregistered
+/// threads may call get() too, but then the caller must make sure nothing
+/// is published while the pointer is used.
+///
+/// Writers (publish(), reclaim()) must be serialized by the caller.
+template <class T>
+class TRcuPtr
+{
+public:
+    /// maximum number of registered readers
+    static const int MAX_READERS = 64;
+
+    TRcuPtr()
+        :Current_(0), Generation_(1) {
+        for (int i = 0; i < MAX_READERS; i++)
+            Readers_[i] = 0;
+    }
+
+    ~TRcuPtr() {
+        delete Current_;
+        for (size_t i = 0; i < Retired_.size(); i++)
+            delete Retired_[i].second;
+    }
+
+    /// @brief returns current object (may be NULL if nothing was published)
+    const T* get() const {
+        return atomicLoadPtr(const_cast<T* volatile*>(&Current_));
+    }
+
+    /// @brief registers a reader
+    ///
+    /// @return reader slot to be passed to quiescent(), -1 if there are too many readers
+    int registerReader() {
+        for (int i = 0; i < MAX_READERS; i++) {
+            if (atomicCas(&Readers_[i], 0, generation()))
+                return i;
+        }
+        return -1;
+    }
+
+    void unregisterReader(int reader) {
+        if (reader < 0 || reader >= MAX_READERS)
+            return;
+        atomicBarrier();
+        Readers_[reader] = 0;
+        atomicBarrier();
+    }
+
+    /// @brief tells that reader doesn't hold any pointer returned by get()
+    void quiescent(int reader) {
+        if (reader < 0 || reader >= MAX_READERS)
+            return;
+        atomicBarrier();
+        Readers_[reader] = generation();
+        atomicBarrier();
+    }
+
+    /// @brief makes obj the current object, retires the previous one
+    ///
+    /// @param obj new object (ownership is taken over)
+    void publish(T* obj) {
+        T* old = Current_;
+        atomicStorePtr(&Current_, obj);
+        long gen = atomicAdd(&Generation_, 1);
+        if (old)
+            Retired_.push_back(std::make_pair(gen, old));
+        reclaim();
+    }
+
+    /// @brief deletes retired objects no reader may use anymore
+    ///
+    /// @return number of retired objects that are still waiting
+    size_t reclaim() {
+        long oldest = generation();
+        for (int i = 0; i < MAX_READERS; i++) {
+            long seen = Readers_[i];
+            if (seen && seen < oldest)
+                oldest = seen;
+        }
+
+        size_t kept = 0;
+        for (size_t i = 0; i < Retired_.size(); i++) {
+            if (Retired_[i].first <= oldest)
+                delete Retired_[i].second;
+            else
+                Retired_[kept++] = Retired_[i];
+        }
+        Retired_.resize(kept);
+        return kept;
+    }
+
+    /// @brief returns number of publish() calls made so far, plus one
+    long generation() const {
+        long x = Generation_;
+        atomicBarrier();
+        return x;
+    }
+
+private:
+    TRcuPtr(const TRcuPtr&);
+    TRcuPtr& operator=(const TRcuPtr&);
+
+    T* volatile Current_;
+    volatile long Generation_;
+
+    /// generation seen by each reader at its last quiescent state (0 = unused slot)
+    volatile long Readers_[MAX_READERS];
+
+    /// objects replaced by publish(), with generation they were retired at
+    std::vector< std::pair<long, T*> > Retired_;
+};
+
+#endif
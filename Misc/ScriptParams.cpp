@@ -17,7 +17,7 @@
 using namespace std;
 
 TNotifyScriptParams::TNotifyScriptParams() 
-    :envCnt(0), ipCnt(1), pdCnt(1) {
+    :envCnt(0), ipCnt(1), pdCnt(1), ifindex(0) {
     for (int i = 0; i<512; i++) {
         env[i] = 0;
     }
@@ -21,6 +21,7 @@ public:
     int envCnt;
     int ipCnt;
     int pdCnt;
+    int ifindex; // interface the script is run for
     TNotifyScriptParams();
     ~TNotifyScriptParams();
     void addParam(const std::string& name, const std::string& value);
@@ -0,0 +1,149 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * Released under GNU GPL v2 licence
+ *
+ */
+
+#ifndef SMALLVECTOR_H
+#define SMALLVECTOR_H
+
+#include <new>
+#include <algorithm>
+#include <stddef.h>
+
+/// @brief vector that keeps up to N elements inside the object
+///
+/// Elements are stored contiguously. The first N of them live in the
+/// object itself, so short collections (addresses in an IA, pools in
+/// a class) don't allocate at all; larger ones move to the heap. Iterators
+/// are plain pointers and are invalidated by any insertion or removal.
+/// Collections of SPtr<> elements give stable handles: objects pointed
+/// to never move, only the pointers do.
+template <class T, unsigned int N>
+class TSmallVector
+{
+public:
+    typedef T value_type;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    TSmallVector()
+        :Data_(inlineData()), Size_(0), Capacity_(N) {
+    }
+
+    TSmallVector(const TSmallVector& other)
+        :Data_(inlineData()), Size_(0), Capacity_(N) {
+        reserve(other.Size_);
+        for (size_t i = 0; i < other.Size_; i++)
+            new (Data_ + i) T(other.Data_[i]);
+        Size_ = other.Size_;
+    }
+
+    TSmallVector& operator=(const TSmallVector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.Size_);
+            for (size_t i = 0; i < other.Size_; i++)
+                new (Data_ + i) T(other.Data_[i]);
+            Size_ = other.Size_;
+        }
+        return *this;
+    }
+
+    ~TSmallVector() {
+        clear();
+        if (Data_ != inlineData())
+            ::operator delete(Data_);
+    }
+
+    iterator begin() { return Data_; }
+    iterator end() { return Data_ + Size_; }
+    const_iterator begin() const { return Data_; }
+    const_iterator end() const { return Data_ + Size_; }
+
+    size_t size() const { return Size_; }
+    bool empty() const { return !Size_; }
+    size_t capacity() const { return Capacity_; }
+
+    T& operator[](size_t i) { return Data_[i]; }
+    const T& operator[](size_t i) const { return Data_[i]; }
+    T& front() { return Data_[0]; }
+    const T& front() const { return Data_[0]; }
+    T& back() { return Data_[Size_ - 1]; }
+    const T& back() const { return Data_[Size_ - 1]; }
+
+    void push_back(const T& x) {
+        if (Size_ == Capacity_) {
+            T copy(x); // x may be one of our elements
+            reserve(Capacity_ * 2);
+            new (Data_ + Size_) T(copy);
+        } else {
+            new (Data_ + Size_) T(x);
+        }
+        Size_++;
+    }
+
+    void pop_back() {
+        Data_[--Size_].~T();
+    }
+
+    /// @brief inserts element before pos
+    ///
+    /// @return iterator pointing at the inserted element
+    iterator insert(iterator pos, const T& x) {
+        size_t idx = pos - Data_;
+        push_back(x);
+        std::rotate(Data_ + idx, Data_ + Size_ - 1, Data_ + Size_);
+        return Data_ + idx;
+    }
+
+    /// @brief removes element (order of the others is kept)
+    ///
+    /// @return iterator pointing at the element that followed the removed one
+    iterator erase(iterator pos) {
+        std::copy(pos + 1, end(), pos);
+        pop_back();
+        return pos;
+    }
+
+    void clear() {
+        while (Size_)
+            pop_back();
+    }
+
+    void reserve(size_t n) {
+        if (n <= Capacity_)
+            return;
+        T* mem = static_cast<T*>(::operator new(n * sizeof(T)));
+        for (size_t i = 0; i < Size_; i++) {
+            new (mem + i) T(Data_[i]);
+            Data_[i].~T();
+        }
+        if (Data_ != inlineData())
+            ::operator delete(Data_);
+        Data_ = mem;
+        Capacity_ = n;
+    }
+
+private:
+    T* inlineData() {
+        return reinterpret_cast<T*>(Inline_.Buf);
+    }
+
+    T* Data_;
+    size_t Size_;
+    size_t Capacity_;
+
+    /// storage for the first N elements (aligned as the most demanding type)
+    union {
+        char Buf[N * sizeof(T)];
+        long double AlignLongDouble;
+        void* AlignPtr;
+        long long AlignLongLong;
+    } Inline_;
+};
+
+#endif
@@ -8,98 +8,155 @@
  */
 
 #include <string.h>
-#include <stdlib.h>
 #include "Misc/md5.h"
 #include "Misc/sha1.h"
 #include "Misc/sha256.h"
 #include "Misc/sha512.h"
+#include "Misc/hmac-sha-md5.h"
 
-/* "Feeding The Void With Emptiness..." ;) */
-#define SHA_CASE(x,y)                                                                       \
-          case x:                                                                           \
-                  ctx = malloc(sizeof(struct sha##y##_ctx));                                \
-                  init_ctx      = (void(*)(void *))                &sha##x##_init_ctx;      \
-                  process_bytes = (void(*)(void *, size_t, void *))&sha##y##_process_bytes; \
-                  finish_ctx    = (void* (*)(void *, void *))      &sha##x##_finish_ctx;    \
-                  blocksize = SHA##x##_BLOCKSIZE;                                           \
-                  digestsize = SHA##x##_DIGESTSIZE;                                         \
-                  break;
+/* stored key schedules must fit the biggest hash state */
+typedef char hmac_state_fits[sizeof(struct sha512_ctx) <= HMAC_STATE_WORDS * sizeof(uint64_t) ? 1 : -1];
+typedef char hmac_digest_fits[SHA512_DIGESTSIZE <= HMAC_MAX_DIGESTSIZE ? 1 : -1];
+
+/* SHA512_DIGESTSIZE is the biggest, aligned for finish_ctx() */
+union hmac_digest {
+  uint64_t words[SHA512_DIGESTSIZE / sizeof(uint64_t)];
+  char bytes[SHA512_DIGESTSIZE];
+};
 
-/* Take buffer and key (and their lengths), generate HMAC-SHA (or HMAC-MD5)     */
-/* and write the result to RESBUF                                               */
 /* type is one of the following: 1, 224, 256, 384, 512 (for SHA) or 5 (for MD5) */
-static void *
-hmac_sha_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type) {
-  /* SHA512_BLOCKSIZE and SHA512_DIGESTSIZE are the biggest, so we can use it with other algorithms */
-  char Ki[SHA512_BLOCKSIZE];
-  char Ko[SHA512_BLOCKSIZE];
-  char tmpbuf[SHA512_DIGESTSIZE];
-  int i;
-  int blocksize;
-  int digestsize;
-  void *ctx;
-  void (*init_ctx)(void *);
-  void (*process_bytes)(void *, size_t, void *);
-  void *(*finish_ctx)(void *, void *);
-  void *result;
+static int hash_sizes(int type, unsigned int *blocksize, unsigned int *digestsize) {
+  switch (type) {
+          case   5: *blocksize = MD5_BLOCKSIZE;    *digestsize = MD5_DIGESTSIZE;    return 1;
+          case   1: *blocksize = SHA1_BLOCKSIZE;   *digestsize = SHA1_DIGESTSIZE;   return 1;
+          case 224: *blocksize = SHA224_BLOCKSIZE; *digestsize = SHA224_DIGESTSIZE; return 1;
+          case 256: *blocksize = SHA256_BLOCKSIZE; *digestsize = SHA256_DIGESTSIZE; return 1;
+          case 384: *blocksize = SHA384_BLOCKSIZE; *digestsize = SHA384_DIGESTSIZE; return 1;
+          case 512: *blocksize = SHA512_BLOCKSIZE; *digestsize = SHA512_DIGESTSIZE; return 1;
+          default:  return 0;
+  }
+}
 
+static void hash_init(int type, void *ctx) {
   switch (type) {
-          case 5: /* Oh, it's MD5! */
-                  ctx = malloc(sizeof(struct md5_ctx));
-                  init_ctx      = (void(*)(void *))                 &md5_init_ctx;
-                  process_bytes = (void(*)(void *, size_t, void *)) &md5_process_bytes;
-                  finish_ctx    = (void* (*)(void *, void *))       &md5_finish_ctx;
-                  blocksize = MD5_BLOCKSIZE;
-                  digestsize = MD5_DIGESTSIZE;
-                  break;
-               /*   .--------< SHA variant   
-                    |                        
-                    v                   */
-          SHA_CASE(  1,   1)
-          SHA_CASE(224, 256)
-          SHA_CASE(256, 256)
-          SHA_CASE(384, 512)
-          SHA_CASE(512, 512)
-          default:
-                  return NULL;
+          case   5: md5_init_ctx((struct md5_ctx *)ctx);       break;
+          case   1: sha1_init_ctx((struct sha1_ctx *)ctx);     break;
+          case 224: sha224_init_ctx((struct sha256_ctx *)ctx); break;
+          case 256: sha256_init_ctx((struct sha256_ctx *)ctx); break;
+          case 384: sha384_init_ctx((struct sha512_ctx *)ctx); break;
+          case 512: sha512_init_ctx((struct sha512_ctx *)ctx); break;
   }
+}
+
+static void hash_process(int type, const void *buffer, size_t len, void *ctx) {
+  switch (type) {
+          case   5: md5_process_bytes(buffer, len, (struct md5_ctx *)ctx); break;
+          case   1: sha1_process_bytes(buffer, len, (struct sha1_ctx *)ctx); break;
+          case 224:
+          case 256: sha256_process_bytes(buffer, len, (struct sha256_ctx *)ctx); break;
+          case 384:
+          case 512: sha512_process_bytes(buffer, len, (struct sha512_ctx *)ctx); break;
+  }
+}
+
+static void hash_finish(int type, void *ctx, union hmac_digest *res) {
+  switch (type) {
+          case   5: md5_finish_ctx((struct md5_ctx *)ctx, res);       break;
+          case   1: sha1_finish_ctx((struct sha1_ctx *)ctx, res);     break;
+          case 224: sha224_finish_ctx((struct sha256_ctx *)ctx, res); break;
+          case 256: sha256_finish_ctx((struct sha256_ctx *)ctx, res); break;
+          case 384: sha384_finish_ctx((struct sha512_ctx *)ctx, res); break;
+          case 512: sha512_finish_ctx((struct sha512_ctx *)ctx, res); break;
+  }
+}
+
+/* Prepare key schedule for KEY (of length KEY_LEN) and digest TYPE.        */
+/* Returns 0 if TYPE is not supported.                                      */
+int hmac_key_init(struct hmac_key *hkey, const char *key, size_t key_len, int type) {
+  /* SHA512_BLOCKSIZE is the biggest, so we can use it with other algorithms */
+  char Ki[SHA512_BLOCKSIZE];
+  char Ko[SHA512_BLOCKSIZE];
+  union hmac_digest keyhash;
+  unsigned int i;
+
+  memset(hkey, 0, sizeof(*hkey));
+  if (!hash_sizes(type, &hkey->blocksize, &hkey->digestsize))
+          return 0;
+  hkey->type = type;
 
   /* if given key is longer that algorithm's block, we must change it to
      hash of the original key (of size of algorithm's digest) */
-  if (key_len > blocksize) {
-          init_ctx (&ctx);
-          process_bytes (key, key_len, &ctx);
-          finish_ctx (&ctx, Ki);
-          key_len = digestsize;
-          memcpy(Ko, Ki, key_len);
-  } else {
-          memcpy(Ki, key, key_len);
-          memcpy(Ko, key, key_len);
+  if (key_len > hkey->blocksize) {
+          hash_init(type, hkey->inner);
+          hash_process(type, key, key_len, hkey->inner);
+          hash_finish(type, hkey->inner, &keyhash);
+          key = keyhash.bytes;
+          key_len = hkey->digestsize;
   }
 
   /* prepare input and output key */
   for (i = 0; i < key_len; i++) {
-          Ki[i] ^= 0x36;
-          Ko[i] ^= 0x5c;
+          Ki[i] = key[i] ^ 0x36;
+          Ko[i] = key[i] ^ 0x5c;
   }
-  for (; i < blocksize; i++) {
+  for (; i < hkey->blocksize; i++) {
           Ki[i] = 0x36;
           Ko[i] = 0x5c;
   }
 
-  init_ctx (ctx);
-  process_bytes (Ki, blocksize, ctx);
-  process_bytes ((void *)buffer, len, ctx);
-  finish_ctx (ctx, tmpbuf);
+  hash_init(type, hkey->inner);
+  hash_process(type, Ki, hkey->blocksize, hkey->inner);
+  hash_init(type, hkey->outer);
+  hash_process(type, Ko, hkey->blocksize, hkey->outer);
+
+  memset(Ki, 0, sizeof(Ki));
+  memset(Ko, 0, sizeof(Ko));
+  memset(&keyhash, 0, sizeof(keyhash));
+  return 1;
+}
+
+/* Generate HMAC of BUFFER (of length LEN) using prepared key schedule and  */
+/* write the result to RESBUF (digestsize bytes, no alignment required)     */
+void *hmac_key_digest(const struct hmac_key *hkey, const char *buffer, size_t len, char *resbuf) {
+  uint64_t ctx[HMAC_STATE_WORDS];
+  union hmac_digest tmp;
+
+  if (!hkey->type)
+          return NULL;
 
-  init_ctx (ctx);
-  process_bytes (Ko, blocksize, ctx);
-  process_bytes (tmpbuf, digestsize, ctx);
+  memcpy(ctx, hkey->inner, sizeof(ctx));
+  hash_process(hkey->type, buffer, len, ctx);
+  hash_finish(hkey->type, ctx, &tmp);
 
-  result = finish_ctx (ctx, resbuf);
-  free(ctx);
+  memcpy(ctx, hkey->outer, sizeof(ctx));
+  hash_process(hkey->type, tmp.bytes, hkey->digestsize, ctx);
+  hash_finish(hkey->type, ctx, &tmp);
+
+  memcpy(resbuf, tmp.bytes, hkey->digestsize);
+  return resbuf;
+}
+
+/* Compare digests in constant time, so the time taken doesn't tell how     */
+/* many leading bytes of a forged digest were right. Returns 1 if equal.    */
+int hmac_equal(const char *a, const char *b, size_t len) {
+  volatile unsigned char diff = 0;
+  size_t i;
+
+  for (i = 0; i < len; i++)
+          diff |= (unsigned char)(a[i] ^ b[i]);
+  return diff == 0;
+}
+
+/* Take buffer and key (and their lengths), generate HMAC-SHA (or HMAC-MD5)     */
+/* and write the result to RESBUF                                               */
+/* type is one of the following: 1, 224, 256, 384, 512 (for SHA) or 5 (for MD5) */
+static void *
+hmac_sha_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type) {
+  struct hmac_key hkey;
 
-  return result;
+  if (!hmac_key_init(&hkey, key, key_len, type))
+          return NULL;
+  return hmac_key_digest(&hkey, buffer, len, resbuf);
 }
 
 /* HMAC-SHA function wrapper */
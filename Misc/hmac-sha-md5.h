@@ -8,10 +8,34 @@
  *
  */	
 
+#ifndef HMAC_SHA_MD5_H
+#define HMAC_SHA_MD5_H
+
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* room for the biggest hash state (struct sha512_ctx) and digest (SHA512) */
+#define HMAC_STATE_WORDS 44
+#define HMAC_MAX_DIGESTSIZE 64
+
+/* HMAC key schedule: hash states after absorbing ipad and opad blocks, so
+   signing a message doesn't need to process the key again */
+struct hmac_key {
+  int type;                 /* 1, 224, 256, 384, 512 (SHA) or 5 (MD5) */
+  unsigned int blocksize;
+  unsigned int digestsize;
+  uint64_t inner[HMAC_STATE_WORDS];
+  uint64_t outer[HMAC_STATE_WORDS];
+};
+
+int hmac_key_init(struct hmac_key *hkey, const char *key, size_t key_len, int type);
+void *hmac_key_digest(const struct hmac_key *hkey, const char *buffer, size_t len, char *resbuf);
+int hmac_equal(const char *a, const char *b, size_t len);
+
 void *hmac_sha (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type);
 void *hmac_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf);
 
@@ -19,3 +43,4 @@ void *hmac_md5 (const char *buffer, size_t len, char *key, size_t key_len, char
 }
 #endif
 
+#endif
@@ -37,7 +37,8 @@
 # define SWAP(n) \
     (((n) << 24) | (((n) & 0xff00) << 8) | (((n) >> 8) & 0xff00) | ((n) >> 24))
 #else
-#if __BYTE_ORDER == __BIG_ENDIAN
+#if defined(WORDS_BIGENDIAN) || \
+    (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
 # define SWAP(n) (n)
 #else
 # define SWAP(n) \
@@ -0,0 +1,289 @@
+#include "HmacKey.h"
+#include "DHCPDefaults.h"
+
+#include <string.h>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+enum KeyKind { KEY_0B, KEY_JEFE, KEY_AA, KEY_SEQ };
+enum DataKind { DATA_HI, DATA_JEFE, DATA_DD, DATA_CD, DATA_BIG_KEY, DATA_BIG_BOTH, DATA_BIG_BOTH2 };
+
+struct Vector {
+    DigestTypes type;
+    KeyKind key;
+    size_t keyLen;
+    DataKind data;
+    const char* expected;
+};
+
+// RFC 2202 (MD5, SHA1) and RFC 4231 (SHA2); truncated test case 5 is skipped
+const Vector vectors[] = {
+    { DIGEST_HMAC_MD5, KEY_0B,   16, DATA_HI,   "9294727a3638bb1c13f48ef8158bfc9d" },
+    { DIGEST_HMAC_MD5, KEY_JEFE,  4, DATA_JEFE, "750c783e6ab0b503eaa86e310a5db738" },
+    { DIGEST_HMAC_MD5, KEY_AA,   16, DATA_DD,   "56be34521d144c88dbb8c733f0e8b3f6" },
+    { DIGEST_HMAC_MD5, KEY_SEQ,  25, DATA_CD,   "697eaf0aca3a3aea3a75164746ffaa79" },
+    { DIGEST_HMAC_MD5, KEY_AA,   80, DATA_BIG_KEY,  "6b1ab7fe4bd7bf8f0b62e6ce61b9d0cd" },
+    { DIGEST_HMAC_MD5, KEY_AA,   80, DATA_BIG_BOTH, "6f630fad67cda0ee1fb1f562db3aa53e" },
+
+    { DIGEST_HMAC_SHA1, KEY_0B,   20, DATA_HI,   "b617318655057264e28bc0b6fb378c8ef146be00" },
+    { DIGEST_HMAC_SHA1, KEY_JEFE,  4, DATA_JEFE, "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79" },
+    { DIGEST_HMAC_SHA1, KEY_AA,   20, DATA_DD,   "125d7342b9ac11cd91a39af48aa17b4f63f175d3" },
+    { DIGEST_HMAC_SHA1, KEY_SEQ,  25, DATA_CD,   "4c9007f4026250c6bc8414f9bf50c86c2d7235da" },
+    { DIGEST_HMAC_SHA1, KEY_AA,   80, DATA_BIG_KEY,  "aa4ae5e15272d00e95705637ce8a3b55ed402112" },
+    { DIGEST_HMAC_SHA1, KEY_AA,   80, DATA_BIG_BOTH, "e8e99d0f45237d786d6bbaa7965c7808bbff1a91" },
+
+    { DIGEST_HMAC_SHA224, KEY_0B,   20, DATA_HI,
+      "896fb1128abbdf196832107cd49df33f47b4b1169912ba4f53684b22" },
+    { DIGEST_HMAC_SHA224, KEY_JEFE,  4, DATA_JEFE,
+      "a30e01098bc6dbbf45690f3a7e9e6d0f8bbea2a39e6148008fd05e44" },
+    { DIGEST_HMAC_SHA224, KEY_AA,   20, DATA_DD,
+      "7fb3cb3588c6c1f6ffa9694d7d6ad2649365b0c1f65d69d1ec8333ea" },
+    { DIGEST_HMAC_SHA224, KEY_SEQ,  25, DATA_CD,
+      "6c11506874013cac6a2abc1bb382627cec6a90d86efc012de7afec5a" },
+    { DIGEST_HMAC_SHA224, KEY_AA,  131, DATA_BIG_KEY,
+      "95e9a0db962095adaebe9b2d6f0dbce2d499f112f2d2b7273fa6870e" },
+    { DIGEST_HMAC_SHA224, KEY_AA,  131, DATA_BIG_BOTH2,
+      "3a854166ac5d9f023f54d517d0b39dbd946770db9c2b95c9f6f565d1" },
+
+    { DIGEST_HMAC_SHA256, KEY_0B,   20, DATA_HI,
+      "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" },
+    { DIGEST_HMAC_SHA256, KEY_JEFE,  4, DATA_JEFE,
+      "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843" },
+    { DIGEST_HMAC_SHA256, KEY_AA,   20, DATA_DD,
+      "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe" },
+    { DIGEST_HMAC_SHA256, KEY_SEQ,  25, DATA_CD,
+      "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b" },
+    { DIGEST_HMAC_SHA256, KEY_AA,  131, DATA_BIG_KEY,
+      "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" },
+    { DIGEST_HMAC_SHA256, KEY_AA,  131, DATA_BIG_BOTH2,
+      "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2" },
+
+    { DIGEST_HMAC_SHA384, KEY_0B,   20, DATA_HI,
+      "afd03944d84895626b0825f4ab46907f15f9dadbe4101ec682aa034c7cebc59c"
+      "faea9ea9076ede7f4af152e8b2fa9cb6" },
+    { DIGEST_HMAC_SHA384, KEY_JEFE,  4, DATA_JEFE,
+      "af45d2e376484031617f78d2b58a6b1b9c7ef464f5a01b47e42ec3736322445e"
+      "8e2240ca5e69e2c78b3239ecfab21649" },
+    { DIGEST_HMAC_SHA384, KEY_AA,   20, DATA_DD,
+      "88062608d3e6ad8a0aa2ace014c8a86f0aa635d947ac9febe83ef4e55966144b"
+      "2a5ab39dc13814b94e3ab6e101a34f27" },
+    { DIGEST_HMAC_SHA384, KEY_SEQ,  25, DATA_CD,
+      "3e8a69b7783c25851933ab6290af6ca77a9981480850009cc5577c6e1f573b4e"
+      "6801dd23c4a7d679ccf8a386c674cffb" },
+    { DIGEST_HMAC_SHA384, KEY_AA,  131, DATA_BIG_KEY,
+      "4ece084485813e9088d2c63a041bc5b44f9ef1012a2b588f3cd11f05033ac4c6"
+      "0c2ef6ab4030fe8296248df163f44952" },
+    { DIGEST_HMAC_SHA384, KEY_AA,  131, DATA_BIG_BOTH2,
+      "6617178e941f020d351e2f254e8fd32c602420feb0b8fb9adccebb82461e99c5"
+      "a678cc31e799176d3860e6110c46523e" },
+
+    { DIGEST_HMAC_SHA512, KEY_0B,   20, DATA_HI,
+      "87aa7cdea5ef619d4ff0b4241a1d6cb02379f4e2ce4ec2787ad0b30545e17cde"
+      "daa833b7d6b8a702038b274eaea3f4e4be9d914eeb61f1702e696c203a126854" },
+    { DIGEST_HMAC_SHA512, KEY_JEFE,  4, DATA_JEFE,
+      "164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea250554"
+      "9758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737" },
+    { DIGEST_HMAC_SHA512, KEY_AA,   20, DATA_DD,
+      "fa73b0089d56a284efb0f0756c890be9b1b5dbdd8ee81a3655f83e33b2279d39"
+      "bf3e848279a722c806b485a47e67c807b946a337bee8942674278859e13292fb" },
+    { DIGEST_HMAC_SHA512, KEY_SEQ,  25, DATA_CD,
+      "b0ba465637458c6990e5a8c5f61d4af7e576d97ff94b872de76f8050361ee3db"
+      "a91ca5c11aa25eb4d679275cc5788063a5f19741120c4f2de2adebeb10a298dd" },
+    { DIGEST_HMAC_SHA512, KEY_AA,  131, DATA_BIG_KEY,
+      "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f352"
+      "6b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598" },
+    { DIGEST_HMAC_SHA512, KEY_AA,  131, DATA_BIG_BOTH2,
+      "e37b6a775dc87dbaa4dfa9f96e5e3ffddebd71f8867289865df5a32d20cdc944"
+      "b6022cac3c4982b10d5eeb55c3e4de15134676fb6de0446065c97440fa8c6a58" }
+};
+
+TKey makeKey(KeyKind kind, size_t len) {
+    TKey key;
+    switch (kind) {
+    case KEY_0B:
+        key.assign(len, 0x0b);
+        break;
+    case KEY_JEFE:
+        key.assign((const uint8_t*)"Jefe", (const uint8_t*)"Jefe" + 4);
+        break;
+    case KEY_AA:
+        key.assign(len, 0xaa);
+        break;
+    case KEY_SEQ:
+        for (size_t i = 1; i <= len; i++)
+            key.push_back((uint8_t)i);
+        break;
+    }
+    return key;
+}
+
+string makeData(DataKind kind) {
+    switch (kind) {
+    case DATA_HI:
+        return "Hi There";
+    case DATA_JEFE:
+        return "what do ya want for nothing?";
+    case DATA_DD:
+        return string(50, (char)0xdd);
+    case DATA_CD:
+        return string(50, (char)0xcd);
+    case DATA_BIG_KEY:
+        return "Test Using Larger Than Block-Size Key - Hash Key First";
+    case DATA_BIG_BOTH:
+        return "Test Using Larger Than Block-Size Key and Larger Than One Block-Size Data";
+    case DATA_BIG_BOTH2:
+        return "This is a test using a larger than block-size key and a larger than "
+            "block-size data. The key needs to be hashed before being used by the HMAC algorithm.";
+    }
+    return "";
+}
+
+string toHex(const char* buf, size_t len) {
+    static const char digits[] = "0123456789abcdef";
+    string hex;
+    for (size_t i = 0; i < len; i++) {
+        hex += digits[(uint8_t)buf[i] >> 4];
+        hex += digits[(uint8_t)buf[i] & 0xf];
+    }
+    return hex;
+}
+
+TEST(HmacKeyTest, vectors) {
+    for (size_t i = 0; i < sizeof(vectors)/sizeof(vectors[0]); i++) {
+        const Vector& v = vectors[i];
+        TKey key = makeKey(v.key, v.keyLen);
+        string data = makeData(v.data);
+
+        THmacKey hkey(key, v.type);
+        ASSERT_TRUE(hkey.valid());
+        ASSERT_EQ(getDigestSize(v.type), hkey.getDigestSize());
+
+        // odd offset: digest buffer doesn't need to be aligned
+        char digest[HMAC_MAX_DIGESTSIZE + 1];
+        hkey.sign(data.c_str(), data.size(), digest + 1);
+        EXPECT_EQ(string(v.expected), toHex(digest + 1, hkey.getDigestSize()))
+            << "vector " << i << " (" << getDigestName(v.type) << ")";
+
+        // key schedule is reused, so the second message must give the same result
+        char again[HMAC_MAX_DIGESTSIZE];
+        hkey.sign(data.c_str(), data.size(), again);
+        EXPECT_EQ(0, memcmp(digest + 1, again, hkey.getDigestSize()));
+
+        // old one-shot interface gives the same digests
+        char oneShot[HMAC_MAX_DIGESTSIZE];
+        if (v.type == DIGEST_HMAC_MD5) {
+            hmac_md5(data.c_str(), data.size(), (char*)&key[0], key.size(), oneShot);
+        } else {
+            static const int shaTypes[] = { 0, 0, 0, 1, 224, 256, 384, 512 };
+            hmac_sha(data.c_str(), data.size(), (char*)&key[0], key.size(), oneShot,
+                     shaTypes[v.type]);
+        }
+        EXPECT_EQ(0, memcmp(digest + 1, oneShot, hkey.getDigestSize()))
+            << "vector " << i << " (" << getDigestName(v.type) << ")";
+    }
+}
+
+TEST(HmacKeyTest, invalid) {
+    TKey key = makeKey(KEY_0B, 16);
+    EXPECT_FALSE(THmacKey(key, DIGEST_NONE).valid());
+    EXPECT_FALSE(THmacKey(key, DIGEST_PLAIN).valid());
+    EXPECT_FALSE(THmacKey::get(key, DIGEST_PLAIN));
+
+    char buf[16];
+    EXPECT_EQ(NULL, hmac_sha("abc", 3, (char*)&key[0], key.size(), buf, 2));
+
+    // empty key is a valid (if weak) key
+    EXPECT_TRUE(THmacKey(TKey(), DIGEST_HMAC_SHA256).valid());
+}
+
+TEST(HmacKeyTest, equal) {
+    EXPECT_TRUE(hmac_equal("abcdef", "abcdef", 6));
+    EXPECT_FALSE(hmac_equal("abcdef", "abcdeg", 6));
+    EXPECT_FALSE(hmac_equal("xbcdef", "abcdef", 6));
+    EXPECT_TRUE(hmac_equal("xbc", "abc", 0));
+}
+
+TEST(HmacKeyTest, cache) {
+    THmacKey::clearCache();
+
+    TKey key1 = makeKey(KEY_0B, 16);
+    TKey key2 = makeKey(KEY_AA, 16);
+    SPtr<THmacKey> a = THmacKey::get(key1, DIGEST_HMAC_MD5);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(1u, THmacKey::getCacheSize());
+
+    // same key and type: the same object
+    EXPECT_TRUE(a == THmacKey::get(key1, DIGEST_HMAC_MD5));
+    EXPECT_EQ(1u, THmacKey::getCacheSize());
+
+    // other type or other key: new object
+    SPtr<THmacKey> b = THmacKey::get(key1, DIGEST_HMAC_SHA1);
+    SPtr<THmacKey> c = THmacKey::get(key2, DIGEST_HMAC_MD5);
+    EXPECT_TRUE(a != b);
+    EXPECT_TRUE(a != c);
+    EXPECT_EQ(DIGEST_HMAC_SHA1, b->getType());
+    EXPECT_EQ(3u, THmacKey::getCacheSize());
+
+    // cache doesn't grow without limit
+    for (unsigned int i = 0; i < 3 * HMAC_KEY_CACHE_SIZE; i++) {
+        TKey key(4, 0);
+        key[0] = (uint8_t)i;
+        key[1] = (uint8_t)(i >> 8);
+        EXPECT_TRUE(THmacKey::get(key, DIGEST_HMAC_SHA256));
+        EXPECT_GE((unsigned int)HMAC_KEY_CACHE_SIZE, THmacKey::getCacheSize());
+    }
+
+    // objects handed out earlier are still usable
+    char digest[HMAC_MAX_DIGESTSIZE];
+    a->sign("Hi There", 8, digest);
+    EXPECT_EQ("9294727a3638bb1c13f48ef8158bfc9d", toHex(digest, 16));
+
+    THmacKey::clearCache();
+    EXPECT_EQ(0u, THmacKey::getCacheSize());
+}
+
+// compares one-shot HMAC (key processed every time) with cached key schedule
+TEST(HmacKeyTest, benchmark) {
+    const DigestTypes types[] = { DIGEST_HMAC_MD5, DIGEST_HMAC_SHA1, DIGEST_HMAC_SHA224,
+                                  DIGEST_HMAC_SHA256, DIGEST_HMAC_SHA384, DIGEST_HMAC_SHA512 };
+    const int shaTypes[] = { 5, 1, 224, 256, 384, 512 };
+    const unsigned int MSGS = 20000;
+
+    TKey key = makeKey(KEY_SEQ, 25);
+    string msg(200, 'x'); // typical signed message
+    char digest[HMAC_MAX_DIGESTSIZE];
+
+    for (size_t t = 0; t < sizeof(types)/sizeof(types[0]); t++) {
+        clock_t start = clock();
+        for (unsigned int i = 0; i < MSGS; i++) {
+            msg[0] = (char)i;
+            if (types[t] == DIGEST_HMAC_MD5)
+                hmac_md5(msg.c_str(), msg.size(), (char*)&key[0], key.size(), digest);
+            else
+                hmac_sha(msg.c_str(), msg.size(), (char*)&key[0], key.size(), digest,
+                         shaTypes[t]);
+        }
+        double oneShot = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        start = clock();
+        for (unsigned int i = 0; i < MSGS; i++) {
+            msg[0] = (char)i;
+            THmacKey::get(key, types[t])->sign(msg.c_str(), msg.size(), digest);
+        }
+        double cached = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        cout << "[ BENCH    ] " << getDigestName(types[t]) << ", " << MSGS << " x "
+             << msg.size() << " bytes: " << oneShot << "s (one-shot), " << cached
+             << "s (cached key), " << (cached > 0 ? MSGS / cached : 0) << " msgs/s" << endl;
+    }
+    THmacKey::clearCache();
+}
+
+}
@@ -0,0 +1,91 @@
+#include "Permutation.h"
+
+#include <set>
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+// checks that every index is returned exactly once per cycle
+TEST(PermutationTest, fullCycle) {
+    const uint64_t sizes[] = { 1, 2, 3, 4, 5, 17, 100, 256, 1000, 4097 };
+
+    for (unsigned int i = 0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+        TPermutation perm;
+        perm.init(sizes[i] - 1, 0x0123456789abcdefULL + i);
+
+        for (int cycle = 0; cycle < 2; cycle++) {
+            set<uint64_t> seen;
+            for (uint64_t j = 0; j < sizes[i]; j++) {
+                uint64_t x = perm.next();
+                EXPECT_LT(x, sizes[i]);
+                seen.insert(x);
+            }
+            EXPECT_EQ(sizes[i], seen.size());
+            EXPECT_EQ(0u, perm.getCursor());
+        }
+    }
+}
+
+// checks that the order depends on the key and does not look sequential
+TEST(PermutationTest, key) {
+    TPermutation perm1, perm2;
+    perm1.init(65535, 1);
+    perm2.init(65535, 2);
+
+    int same = 0, sequential = 0;
+    uint64_t prev = perm1.permute(0);
+    for (uint64_t i = 0; i < 1000; i++) {
+        uint64_t x = perm1.permute(i);
+        if (x == perm2.permute(i))
+            same++;
+        if (i && x == prev + 1)
+            sequential++;
+        prev = x;
+    }
+    EXPECT_GT(10, same);
+    EXPECT_GT(10, sequential);
+
+    // same key, same order
+    TPermutation perm3;
+    perm3.init(65535, 1);
+    for (uint64_t i = 0; i < 100; i++)
+        EXPECT_EQ(perm1.permute(i), perm3.permute(i));
+}
+
+// checks that largest possible range works
+TEST(PermutationTest, range64) {
+    TPermutation perm;
+    perm.init(0xffffffffffffffffULL, 12345);
+
+    set<uint64_t> seen;
+    for (int i = 0; i < 1000; i++)
+        seen.insert(perm.next());
+    EXPECT_EQ(1000u, seen.size());
+
+    // out of range index is returned unchanged
+    TPermutation small;
+    small.init(9, 12345);
+    EXPECT_EQ(10u, small.permute(10));
+}
+
+// checks that unpermute() is the inverse of permute()
+TEST(PermutationTest, unpermute) {
+    const uint64_t lasts[] = { 0, 1, 2, 16, 999, 65535, 0xffffffffULL, 0xffffffffffffffffULL };
+
+    for (unsigned int i = 0; i < sizeof(lasts)/sizeof(lasts[0]); i++) {
+        TPermutation perm;
+        perm.init(lasts[i], 0xfedcba9876543210ULL + i);
+        for (uint64_t j = 0; j < 1000 && j <= lasts[i]; j++) {
+            EXPECT_EQ(j, perm.unpermute(perm.permute(j)));
+            EXPECT_EQ(j, perm.permute(perm.unpermute(j)));
+        }
+    }
+
+    TPermutation small;
+    small.init(9, 12345);
+    EXPECT_EQ(10u, small.unpermute(10));
+}
+
+}
@@ -0,0 +1,188 @@
+#include "Rcu.h"
+#include "Atomic.h"
+
+#include <pthread.h>
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+volatile long alive = 0;
+
+/// object that checks it is not used after being deleted
+class Config {
+public:
+    Config(long v)
+        :a(v), b(v), deleted(false) {
+        atomicAdd(&alive, 1);
+    }
+    ~Config() {
+        deleted = true;
+        atomicAdd(&alive, -1);
+    }
+    long a;
+    long b;
+    volatile bool deleted;
+};
+
+TEST(RcuTest, reclaim) {
+    alive = 0;
+    {
+        TRcuPtr<Config> ptr;
+        EXPECT_FALSE(ptr.get());
+
+        // no readers, old objects are freed immediately
+        ptr.publish(new Config(1));
+        ptr.publish(new Config(2));
+        EXPECT_EQ(1, alive);
+        EXPECT_EQ(2, ptr.get()->a);
+
+        // reader holding old object
+        int reader = ptr.registerReader();
+        ASSERT_NE(-1, reader);
+        const Config* held = ptr.get();
+        ptr.publish(new Config(3));
+        ptr.publish(new Config(4));
+        EXPECT_EQ(3, alive);
+        EXPECT_EQ(2u, ptr.reclaim());
+        EXPECT_FALSE(held->deleted);
+        EXPECT_EQ(4, ptr.get()->a);
+
+        // reader is done with it
+        ptr.quiescent(reader);
+        EXPECT_EQ(0u, ptr.reclaim());
+        EXPECT_EQ(1, alive);
+
+        // unregistered readers don't block reclamation
+        ptr.publish(new Config(5));
+        ptr.unregisterReader(reader);
+        EXPECT_EQ(0u, ptr.reclaim());
+        EXPECT_EQ(1, alive);
+    }
+    EXPECT_EQ(0, alive);
+}
+
+TEST(RcuTest, readerSlots) {
+    TRcuPtr<Config> ptr;
+    int readers[TRcuPtr<Config>::MAX_READERS];
+    for (int i = 0; i < TRcuPtr<Config>::MAX_READERS; i++) {
+        readers[i] = ptr.registerReader();
+        EXPECT_EQ(i, readers[i]);
+    }
+    EXPECT_EQ(-1, ptr.registerReader());
+    ptr.unregisterReader(readers[5]);
+    EXPECT_EQ(5, ptr.registerReader());
+}
+
+struct ReaderArgs {
+    TRcuPtr<Config>* Ptr;
+    volatile long* Stop;
+    long Reads;
+    long Errors;
+};
+
+void* reader(void* arg) {
+    ReaderArgs* args = (ReaderArgs*)arg;
+    int id = args->Ptr->registerReader();
+    while (!*args->Stop) {
+        for (int i = 0; i < 100; i++) {
+            const Config* cfg = args->Ptr->get();
+            if (cfg->deleted || cfg->a != cfg->b)
+                args->Errors++;
+            args->Reads++;
+        }
+        args->Ptr->quiescent(id);
+    }
+    args->Ptr->unregisterReader(id);
+    return 0;
+}
+
+// checks that readers never see an object that was already deleted
+TEST(RcuTest, concurrentReaders) {
+    const int THREADS = 4;
+    alive = 0;
+    volatile long stop = 0;
+
+    TRcuPtr<Config> ptr;
+    ptr.publish(new Config(0));
+
+    pthread_t threads[THREADS];
+    ReaderArgs args[THREADS];
+    for (int i = 0; i < THREADS; i++) {
+        args[i].Ptr = &ptr;
+        args[i].Stop = &stop;
+        args[i].Reads = 0;
+        args[i].Errors = 0;
+        ASSERT_EQ(0, pthread_create(&threads[i], NULL, reader, &args[i]));
+    }
+
+    for (long i = 1; i <= 20000; i++) {
+        ptr.publish(new Config(i));
+        if (i % 100 == 0)
+            ptr.reclaim();
+    }
+
+    stop = 1;
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(threads[i], NULL);
+        EXPECT_EQ(0, args[i].Errors);
+        EXPECT_LT(0, args[i].Reads);
+    }
+
+    EXPECT_EQ(0u, ptr.reclaim());
+    EXPECT_EQ(1, alive);
+}
+
+struct CounterArgs {
+    TAtomicCounter* Counter;
+    int Count;
+};
+
+void* counterUser(void* arg) {
+    CounterArgs* args = (CounterArgs*)arg;
+    for (int i = 0; i < args->Count; i++) {
+        args->Counter->add();
+        args->Counter->add(2);
+        args->Counter->sub(2);
+    }
+    return 0;
+}
+
+TEST(AtomicCounterTest, basic) {
+    TAtomicCounter cnt;
+    EXPECT_EQ(0u, cnt.get());
+    EXPECT_EQ(5u, cnt.add(5));
+    EXPECT_EQ(3u, cnt.sub(2));
+
+    // never goes below zero
+    EXPECT_EQ(0u, cnt.sub(10));
+    EXPECT_EQ(0u, cnt.sub());
+
+    // never wraps around
+    cnt.set(LONG_MAX - 1);
+    EXPECT_EQ((unsigned long)LONG_MAX, cnt.add(ULONG_MAX));
+    EXPECT_EQ((unsigned long)LONG_MAX, cnt.add());
+    EXPECT_EQ(0u, cnt.sub(ULONG_MAX));
+
+    cnt.set(7);
+    TAtomicCounter copy(cnt);
+    EXPECT_EQ(7u, copy.get());
+}
+
+TEST(AtomicCounterTest, concurrent) {
+    const int THREADS = 4;
+    const int COUNT = 100000;
+
+    TAtomicCounter cnt;
+    pthread_t threads[THREADS];
+    CounterArgs args = { &cnt, COUNT };
+    for (int i = 0; i < THREADS; i++)
+        ASSERT_EQ(0, pthread_create(&threads[i], NULL, counterUser, &args));
+    for (int i = 0; i < THREADS; i++)
+        pthread_join(threads[i], NULL);
+
+    EXPECT_EQ((unsigned long)THREADS * COUNT, cnt.get());
+}
+
+}
@@ -0,0 +1,215 @@
+#include "Container.h"
+#include "SmallVector.h"
+#include "SmartPtr.h"
+#include "IPv6Addr.h"
+
+#include <ctime>
+#include <iostream>
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+int instances = 0;
+
+class Elem {
+public:
+    Elem(int v)
+        :value(v) {
+        instances++;
+    }
+    Elem(const Elem& other)
+        :value(other.value) {
+        instances++;
+    }
+    ~Elem() {
+        instances--;
+    }
+    int value;
+};
+
+class SmallVectorTest : public ::testing::Test {
+public:
+    SmallVectorTest() {
+        instances = 0;
+    }
+};
+
+TEST_F(SmallVectorTest, inlineAndHeap) {
+    {
+        TSmallVector<Elem, 4> vec;
+        EXPECT_TRUE(vec.empty());
+        EXPECT_EQ(4u, vec.capacity());
+
+        for (int i = 0; i < 4; i++)
+            vec.push_back(Elem(i));
+        EXPECT_EQ(4u, vec.capacity());
+        EXPECT_EQ(4, instances);
+
+        // moves to the heap
+        for (int i = 4; i < 100; i++)
+            vec.push_back(Elem(i));
+        EXPECT_EQ(100u, vec.size());
+        EXPECT_LE(100u, vec.capacity());
+        EXPECT_EQ(100, instances);
+
+        int expected = 0;
+        for (TSmallVector<Elem, 4>::const_iterator it = vec.begin(); it != vec.end(); ++it)
+            EXPECT_EQ(expected++, it->value);
+
+        // appending own element while growing
+        TSmallVector<Elem, 4> copy(vec);
+        EXPECT_EQ(200, instances);
+        copy.push_back(copy[0]);
+        EXPECT_EQ(0, copy.back().value);
+
+        copy = vec;
+        EXPECT_EQ(100u, copy.size());
+        EXPECT_EQ(99, copy.back().value);
+    }
+    EXPECT_EQ(0, instances);
+}
+
+TEST_F(SmallVectorTest, insertErase) {
+    TSmallVector<Elem, 2> vec;
+    vec.push_back(Elem(1));
+    vec.push_back(Elem(3));
+    vec.insert(vec.begin() + 1, Elem(2));
+    vec.insert(vec.begin(), Elem(0));
+    vec.insert(vec.end(), Elem(4));
+    ASSERT_EQ(5u, vec.size());
+    for (int i = 0; i < 5; i++)
+        EXPECT_EQ(i, vec[i].value);
+
+    TSmallVector<Elem, 2>::iterator it = vec.erase(vec.begin() + 1);
+    EXPECT_EQ(2, it->value);
+    vec.erase(vec.end() - 1);
+    ASSERT_EQ(3u, vec.size());
+    EXPECT_EQ(0, vec[0].value);
+    EXPECT_EQ(2, vec[1].value);
+    EXPECT_EQ(3, vec[2].value);
+    EXPECT_EQ(3, instances);
+
+    vec.clear();
+    EXPECT_EQ(0, instances);
+}
+
+// checks that TSmallContainer behaves like TContainer
+TEST_F(SmallVectorTest, containerAdapter) {
+    TSmallContainer< SPtr<Elem> > container;
+    EXPECT_TRUE(container.empty());
+    container.first();
+    EXPECT_FALSE(container.get());
+    EXPECT_FALSE(container.getFirst());
+    EXPECT_FALSE(container.getLast());
+
+    for (int i = 0; i < 10; i++)
+        container.append(new Elem(i));
+    EXPECT_EQ(10u, container.count());
+    EXPECT_EQ(0, container.getFirst()->value);
+    EXPECT_EQ(9, container.getLast()->value);
+
+    // deleting odd elements while iterating
+    int visited = 0;
+    container.first();
+    while (SPtr<Elem> e = container.get()) {
+        visited++;
+        if (e->value % 2)
+            container.del();
+    }
+    EXPECT_EQ(10, visited);
+    EXPECT_EQ(5u, container.count());
+
+    // nested traversals don't interfere
+    int pairs = 0;
+    for (TSmallContainer< SPtr<Elem> >::const_iterator a = container.begin();
+         a != container.end(); ++a) {
+        EXPECT_EQ(0, (*a)->value % 2);
+        for (TSmallContainer< SPtr<Elem> >::const_iterator b = container.begin();
+             b != container.end(); ++b)
+            pairs++;
+    }
+    EXPECT_EQ(25, pairs);
+
+    container.delFirst();
+    container.delLast();
+    EXPECT_EQ(3u, container.count());
+    EXPECT_EQ(2, container.getFirst()->value);
+    EXPECT_EQ(6, container.getLast()->value);
+
+    container.clear();
+    EXPECT_EQ(0, instances);
+}
+
+/// pool-like element, looked up by ID or address
+class Pool {
+public:
+    Pool(unsigned long id)
+        :ID(id), Addr(new TIPv6Addr("2001:db8::", true)) {
+        Addr->getAddr()[15] = (char)id;
+    }
+    unsigned long ID;
+    SPtr<TIPv6Addr> Addr;
+};
+
+template <class C>
+static double lookupTime(C& container, unsigned int rounds, unsigned long& found) {
+    clock_t start = clock();
+    for (unsigned int r = 0; r < rounds; r++) {
+        unsigned long id = r % (container.count() + 1);
+        SPtr<Pool> pool;
+        container.first();
+        while (pool = container.get()) {
+            if (pool->ID == id)
+                break;
+        }
+        if (pool)
+            found++;
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+template <class C>
+static double iterateTime(const C& container, unsigned int rounds, unsigned long& sum) {
+    clock_t start = clock();
+    for (unsigned int r = 0; r < rounds; r++) {
+        for (typename C::const_iterator it = container.begin(); it != container.end(); ++it)
+            sum += (*it)->Addr->getAddr()[15];
+    }
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// compares TContainer and TSmallContainer on typical sizes: a few
+// addresses in an IA, a few dozens of pools or interfaces
+TEST_F(SmallVectorTest, benchmark) {
+    const unsigned int sizes[] = { 2, 8, 32 };
+    const unsigned int ROUNDS = 200000;
+
+    for (unsigned int s = 0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+        List(Pool) list;
+        SmallList(Pool) vec;
+        for (unsigned int i = 0; i < sizes[s]; i++) {
+            SPtr<Pool> pool = new Pool(i);
+            list.append(pool);
+            vec.append(pool);
+        }
+
+        unsigned long listFound = 0, vecFound = 0;
+        double listLookup = lookupTime(list, ROUNDS, listFound);
+        double vecLookup = lookupTime(vec, ROUNDS, vecFound);
+        EXPECT_EQ(listFound, vecFound);
+
+        unsigned long listSum = 0, vecSum = 0;
+        double listIter = iterateTime(list.getSTL(), ROUNDS, listSum);
+        double vecIter = iterateTime(vec, ROUNDS, vecSum);
+        EXPECT_EQ(listSum, vecSum);
+
+        cout << "[ BENCH    ] " << sizes[s] << " elements, " << ROUNDS << " rounds: "
+             << "lookup " << listLookup << "s (list) vs " << vecLookup << "s (small vector), "
+             << "iteration " << listIter << "s (list) vs " << vecIter << "s (small vector)"
+             << endl;
+    }
+}
+
+}
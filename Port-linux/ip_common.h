@@ -29,3 +29,4 @@ extern int do_multiroute(int argc, char **argv);
 extern int do_xfrm(int argc, char **argv);
 
 extern struct rtnl_handle rth;
+extern int rtnl_batch_request(struct nlmsghdr *n);
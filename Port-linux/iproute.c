@@ -27,6 +27,7 @@
 #include <netinet/in.h>
 #include <netinet/ip.h>
 #include <arpa/inet.h>
+#include <net/if.h>
 #include <linux/in_route.h>
 /* #include <linux/ip_mp_alg.h> */
 
@@ -907,11 +908,13 @@ int iproute_modify(int cmd, unsigned flags, int argc, char **argv)
 
 	if (d || nhs_ok)  {
 
-            ll_init_map(&rth);
-
+            /* index is looked up for every route rather than taken from
+               the link map: dumping all links (ll_init_map()) for every route
+               is too expensive with many interfaces, and a map filled earlier
+               may hold a stale index of a re-created interface */
             if (d) {
                 int idx;
-                if ((idx = ll_name_to_index(d)) == 0) {
+                if ((idx = if_nametoindex(d)) == 0) {
                     fprintf(stderr, "Cannot find device \"%s\"\n", d);
                     return -1;
                 }
@@ -955,7 +958,8 @@ int iproute_modify(int cmd, unsigned flags, int argc, char **argv)
 	if (req.r.rtm_family == AF_UNSPEC)
 		req.r.rtm_family = AF_INET;
 
-	return rtnl_talk(&rth, &req.n, 0, 0, NULL, NULL, NULL);
+	/* queued if there is a batch open, see ipaddr_batch_begin() */
+	return rtnl_batch_request(&req.n);
 }
 
 static int rtnl_rtcache_request(struct rtnl_handle *rth, int family)
@@ -34,6 +34,7 @@
 #include <fnmatch.h>
 #include <time.h>
 #include <errno.h>
+#include <poll.h>
 
 
 #include "libnetlink.h"
@@ -57,21 +58,62 @@
 struct rtnl_handle rth;
 char Message[1024] = {0};
 
+/* rth is kept open for the whole lifetime of the process and is used for all
+   address operations. rth_mon is subscribed to IPv6 address notifications and
+   is used to learn DAD results (see dad_process_events()). */
+static int rth_ready = 0;
+static struct rtnl_handle rth_mon = { .fd = -1 };
+
+static int nl_ready();
+static void dad_process_events();
+static void dad_flush();
+int ipaddr_batch_commit();
+
 int lowlevelInit()
 {
     if (rtnl_open(&rth, 0) < 0) {
 	sprintf(Message, "Cannot open rtnetlink\n");
 	return LOWLEVEL_ERROR_SOCKET;
     }
+    rth_ready = 1;
+
+    /* failure here is not fatal: is_addr_tentative() falls back to dumps */
+    if (rtnl_open(&rth_mon, RTMGRP_IPV6_IFADDR) < 0) {
+	rth_mon.fd = -1;
+    } else {
+	fcntl(rth_mon.fd, F_SETFL, fcntl(rth_mon.fd, F_GETFL) | O_NONBLOCK);
+    }
     return 0;
 }
 
 int lowlevelExit()
 {
-    rtnl_close(&rth);
+    ipaddr_batch_commit();
+    dad_flush();
+    if (rth_mon.fd >= 0) {
+	rtnl_close(&rth_mon);
+	rth_mon.fd = -1;
+    }
+    if (rth_ready) {
+	rtnl_close(&rth);
+	rth_ready = 0;
+    }
     return 0;
 }
 
+/* opens rth on first use if lowlevelInit() was not called (server, tests) */
+static int nl_ready()
+{
+    if (!rth_ready) {
+	if (rtnl_open(&rth, 0) < 0) {
+	    sprintf(Message, "Cannot open rtnetlink");
+	    return 0;
+	}
+	rth_ready = 1;
+    }
+    return 1;
+}
+
 struct nlmsg_list
 {
 	struct nlmsg_list *next;
@@ -348,11 +390,382 @@ void ipaddr_global_get(int *count, char **bufPtr, int ifindex, struct nlmsg_list
     *bufPtr = buf;
 }
 
+/* ********************************************************************** */
+/* *** DAD state tracking *********************************************** */
+/* ********************************************************************** */
+
+#define DAD_HASH_SIZE 256
+
+#define DAD_STATE_UNKNOWN 0
+#define DAD_STATE_PENDING 1
+#define DAD_STATE_DONE    2
+#define DAD_STATE_FAILED  3
+
+/* address added by ipaddr_add(). Its state is updated from RTM_NEWADDR
+   notifications, so is_addr_tentative() does not need to dump all addresses */
+struct dad_entry {
+    int ifindex;
+    char addr[16];
+    int state;
+    struct dad_entry *next;
+};
+
+static struct dad_entry *dad_hash[DAD_HASH_SIZE];
+
+static unsigned dad_bucket(const char *addr)
+{
+    unsigned h = 0;
+    int i;
+    for (i = 0; i < 16; i++)
+	h = h * 31 + (unsigned char)addr[i];
+    return h % DAD_HASH_SIZE;
+}
+
+static struct dad_entry *dad_find(int ifindex, const char *addr)
+{
+    struct dad_entry *e;
+    for (e = dad_hash[dad_bucket(addr)]; e; e = e->next) {
+	if (e->ifindex == ifindex && !memcmp(e->addr, addr, 16))
+	    return e;
+    }
+    return NULL;
+}
+
+static void dad_track(int ifindex, const char *addr)
+{
+    struct dad_entry *e = dad_find(ifindex, addr);
+    unsigned b;
+    if (!e) {
+	e = malloc(sizeof(struct dad_entry));
+	if (!e)
+	    return;
+	b = dad_bucket(addr);
+	e->ifindex = ifindex;
+	memcpy(e->addr, addr, 16);
+	e->next = dad_hash[b];
+	dad_hash[b] = e;
+    }
+    e->state = DAD_STATE_UNKNOWN;
+}
+
+static void dad_untrack(int ifindex, const char *addr)
+{
+    struct dad_entry **e = &dad_hash[dad_bucket(addr)];
+    struct dad_entry *tmp;
+    while (*e) {
+	if ((*e)->ifindex == ifindex && !memcmp((*e)->addr, addr, 16)) {
+	    tmp = *e;
+	    *e = tmp->next;
+	    free(tmp);
+	    return;
+	}
+	e = &(*e)->next;
+    }
+}
+
+static void dad_flush()
+{
+    struct dad_entry *tmp;
+    int i;
+    for (i = 0; i < DAD_HASH_SIZE; i++) {
+	while (dad_hash[i]) {
+	    tmp = dad_hash[i];
+	    dad_hash[i] = tmp->next;
+	    free(tmp);
+	}
+    }
+}
+
+/* notifications were lost, so nothing we know can be trusted anymore */
+static void dad_invalidate()
+{
+    struct dad_entry *e;
+    int i;
+    for (i = 0; i < DAD_HASH_SIZE; i++)
+	for (e = dad_hash[i]; e; e = e->next)
+	    e->state = DAD_STATE_UNKNOWN;
+}
+
+static void dad_update(struct nlmsghdr *n)
+{
+    struct ifaddrmsg *ifa = NLMSG_DATA(n);
+    struct rtattr * rta_tb[IFA_MAX+1];
+    struct dad_entry *e;
+
+    if ((n->nlmsg_type != RTM_NEWADDR && n->nlmsg_type != RTM_DELADDR) ||
+	n->nlmsg_len < NLMSG_LENGTH(sizeof(*ifa)) || ifa->ifa_family != AF_INET6)
+	return;
+
+    memset(rta_tb, 0, sizeof(rta_tb));
+    parse_rtattr(rta_tb, IFA_MAX, IFA_RTA(ifa), n->nlmsg_len - NLMSG_LENGTH(sizeof(*ifa)));
+    if (!rta_tb[IFA_LOCAL])
+	rta_tb[IFA_LOCAL] = rta_tb[IFA_ADDRESS];
+    if (!rta_tb[IFA_LOCAL])
+	return;
+
+    e = dad_find(ifa->ifa_index, RTA_DATA(rta_tb[IFA_LOCAL]));
+    if (!e)
+	return; /* not ours */
+
+    if (n->nlmsg_type == RTM_DELADDR)
+	e->state = DAD_STATE_UNKNOWN;
+    else if (ifa->ifa_flags & IFA_F_DADFAILED)
+	e->state = DAD_STATE_FAILED;
+    else if (ifa->ifa_flags & IFA_F_TENTATIVE)
+	e->state = DAD_STATE_PENDING;
+    else
+	e->state = DAD_STATE_DONE;
+}
+
+/* reads all address notifications queued on rth_mon (never blocks) */
+static void dad_process_events()
+{
+    char buf[8192];
+    struct nlmsghdr *h;
+    int status;
+
+    if (rth_mon.fd < 0)
+	return;
+
+    while (1) {
+	status = recv(rth_mon.fd, buf, sizeof(buf), MSG_DONTWAIT);
+	if (status < 0) {
+	    if (errno == EINTR)
+		continue;
+	    if (errno == ENOBUFS) {
+		/* socket buffer overrun, some notifications were dropped */
+		dad_invalidate();
+		continue;
+	    }
+	    return; /* EAGAIN: nothing more to read */
+	}
+	if (status == 0)
+	    return;
+	for (h = (struct nlmsghdr*)buf; NLMSG_OK(h, status); h = NLMSG_NEXT(h, status))
+	    dad_update(h);
+    }
+}
+
+/* ********************************************************************** */
+/* *** batched address operations *************************************** */
+/* ********************************************************************** */
+
+/* RTM_NEWADDR/RTM_DELADDR (and route) requests queued between
+   ipaddr_batch_begin() and ipaddr_batch_commit() are sent to the kernel in a
+   single datagram */
+#define BATCH_MAX_REQS  256
+#define BATCH_MAX_DEPTH 8
+/* how long to wait for acks (in ms) before the outstanding requests fail */
+#define BATCH_ACK_TIMEOUT 2000
+
+static char batch_buf[16384];
+static int batch_len = 0;
+static int batch_cnt = 0;
+static int batch_depth = 0;
+
+/* sequence numbers and nesting levels of queued requests. Other users of rth
+   (ll_init_map(), rtnl_talk(), dumps) take sequence numbers too, so the queued
+   ones are not necessarily consecutive. */
+static unsigned batch_seq[BATCH_MAX_REQS];
+static int batch_level[BATCH_MAX_REQS];
+
+/* errors of sent requests, kept until the commit of the level that queued them */
+static int batch_err[BATCH_MAX_DEPTH + 1];
+
+/* results of recently sent requests (see ipaddr_batch_result()) */
+static struct {
+    unsigned seq;
+    int result;
+} batch_results[BATCH_MAX_REQS];
+static unsigned batch_last = 0;
+
+int ipaddr_batch_begin()
+{
+    batch_depth++;
+    return LOWLEVEL_NO_ERROR;
+}
+
+static int batch_level_of(int depth)
+{
+    return depth > BATCH_MAX_DEPTH ? BATCH_MAX_DEPTH : depth;
+}
+
+static void batch_set_result(int i, int result)
+{
+    batch_results[batch_seq[i] % BATCH_MAX_REQS].seq = batch_seq[i];
+    batch_results[batch_seq[i] % BATCH_MAX_REQS].result = result;
+    if (result != LOWLEVEL_NO_ERROR)
+	batch_err[batch_level[i]] = result;
+}
+
+/* sends all queued requests and waits for their acks. Errors are stored in
+   batch_err[] for the levels that queued the failed requests. */
+static void batch_flush()
+{
+    struct sockaddr_nl nladdr;
+    struct nlmsghdr *h;
+    char buf[16384];
+    char acked[BATCH_MAX_REQS];
+    int cnt = batch_cnt;
+    int outstanding = batch_cnt;
+    int status;
+    int i;
+
+    if (!batch_cnt)
+	return;
+
+    memset(&nladdr, 0, sizeof(nladdr));
+    nladdr.nl_family = AF_NETLINK;
+    memset(acked, 0, sizeof(acked));
+
+    status = sendto(rth.fd, batch_buf, batch_len, 0, (struct sockaddr*)&nladdr, sizeof(nladdr));
+    batch_len = 0;
+    batch_cnt = 0;
+    if (status < 0) {
+	sprintf(Message, "Cannot talk to rtnetlink: %s", strerror(errno));
+	for (i = 0; i < cnt; i++)
+	    batch_set_result(i, LOWLEVEL_ERROR_SOCKET);
+	return;
+    }
+
+    while (outstanding > 0) {
+	struct pollfd pfd;
+	pfd.fd = rth.fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	status = poll(&pfd, 1, BATCH_ACK_TIMEOUT);
+	if (status < 0 && errno == EINTR)
+	    continue;
+	if (status <= 0) {
+	    sprintf(Message, "Netlink acks not received: %s",
+		    status ? strerror(errno) : "timeout");
+	    break;
+	}
+	status = recv(rth.fd, buf, sizeof(buf), MSG_DONTWAIT);
+	if (status < 0) {
+	    if (errno == EINTR || errno == EAGAIN)
+		continue;
+	    sprintf(Message, "Netlink receive failed: %s", strerror(errno));
+	    break;
+	}
+	if (status == 0)
+	    break;
+
+	for (h = (struct nlmsghdr*)buf; NLMSG_OK(h, status); h = NLMSG_NEXT(h, status)) {
+	    struct nlmsgerr *err = (struct nlmsgerr*)NLMSG_DATA(h);
+	    if (h->nlmsg_type != NLMSG_ERROR)
+		continue;
+	    for (i = 0; i < cnt; i++) {
+		if (!acked[i] && batch_seq[i] == h->nlmsg_seq)
+		    break;
+	    }
+	    if (i == cnt)
+		continue; /* not ours */
+	    acked[i] = 1;
+	    outstanding--;
+	    if (err->error) {
+		sprintf(Message, "Netlink request %u failed: %s", i + 1, strerror(-err->error));
+		batch_set_result(i, LOWLEVEL_ERROR_UNSPEC);
+	    } else {
+		batch_set_result(i, LOWLEVEL_NO_ERROR);
+	    }
+	}
+    }
+
+    /* socket failed or timed out before all acks were received */
+    for (i = 0; i < cnt; i++) {
+	if (!acked[i])
+	    batch_set_result(i, LOWLEVEL_ERROR_SOCKET);
+    }
+}
+
+static int batch_append(struct nlmsghdr *n)
+{
+    int level = batch_level_of(batch_depth);
+    int result;
+
+    if (batch_len + NLMSG_ALIGN(n->nlmsg_len) > sizeof(batch_buf) ||
+	batch_cnt == BATCH_MAX_REQS)
+	batch_flush();
+
+    n->nlmsg_flags |= NLM_F_ACK;
+    n->nlmsg_seq = ++rth.seq;
+    memcpy(batch_buf + batch_len, n, n->nlmsg_len);
+    batch_len += NLMSG_ALIGN(n->nlmsg_len);
+    batch_seq[batch_cnt] = n->nlmsg_seq;
+    batch_level[batch_cnt] = level;
+    batch_cnt++;
+    batch_last = n->nlmsg_seq;
+
+    if (batch_depth)
+	return LOWLEVEL_NO_ERROR;
+
+    batch_flush();
+    result = batch_err[0];
+    batch_err[0] = LOWLEVEL_NO_ERROR;
+    return result;
+}
+
+/* used by iproute_modify(), so route changes share the address batch */
+int rtnl_batch_request(struct nlmsghdr *n)
+{
+    if (!nl_ready())
+	return LOWLEVEL_ERROR_SOCKET;
+    return batch_append(n);
+}
+
+/* sends queued requests if this level queued any and returns the first
+   error of requests queued at this level. Requests queued by outer levels
+   are sent too (order is kept), their errors are returned by their own
+   commits. */
+int ipaddr_batch_commit()
+{
+    int level = batch_level_of(batch_depth);
+    int result;
+    int i;
+
+    if (batch_depth > 0)
+	batch_depth--;
+
+    for (i = 0; i < batch_cnt; i++) {
+	if (batch_level[i] == level) {
+	    batch_flush();
+	    break;
+	}
+    }
+    /* the outermost commit sends everything */
+    if (!batch_depth)
+	batch_flush();
+
+    result = batch_err[level];
+    batch_err[level] = LOWLEVEL_NO_ERROR;
+    return result;
+}
+
+unsigned ipaddr_batch_last()
+{
+    return batch_last;
+}
+
+int ipaddr_batch_result(unsigned id)
+{
+    if (!id)
+	return LOWLEVEL_NO_ERROR;
+    if (batch_results[id % BATCH_MAX_REQS].seq == id)
+	return batch_results[id % BATCH_MAX_REQS].result;
+    /* not sent yet, or so old that its result was overwritten */
+    return LOWLEVEL_ERROR_UNSPEC;
+}
+
 /** 
  * adds, updates or deletes addresses to interface
  * 
+ * Request is queued if there is a batch open (see ipaddr_batch_begin()),
+ * otherwise it is sent immediately.
+ *
  * @param addr 
  * @param ifacename 
+ * @param ifindex interface index (if 0, ifacename is used to find it)
  * @param prefixLen 
  * @param preferred 
  * @param valid 
@@ -360,10 +773,9 @@ void ipaddr_global_get(int *count, char **bufPtr, int ifindex, struct nlmsg_list
  * 
  * @return 
  */
-int ipaddr_add_or_del(const char * addr, const char *ifacename, int prefixLen, 
+int ipaddr_add_or_del(const char * addr, const char *ifacename, int ifindex, int prefixLen,
                       unsigned long preferred, unsigned long valid, int mode)
 {
-    struct rtnl_handle rth;
     struct {
 	struct nlmsghdr 	n;
 	struct ifaddrmsg 	ifa;
@@ -377,7 +789,7 @@ int ipaddr_add_or_del(const char * addr, const char *ifacename, int prefixLen,
     struct ifa_cacheinfo ci;
 
 #ifdef LOWLEVEL_DEBUG
-    printf("### iface=%s, addr=%s, add=%d ###\n", ifacename, addr, add);
+    printf("### iface=%s, addr=%s, mode=%d ###\n", ifacename, addr, mode);
 #endif
     
     memset(&req, 0, sizeof(req));
@@ -420,23 +832,32 @@ int ipaddr_add_or_del(const char * addr, const char *ifacename, int prefixLen,
     if (!scoped)
 	req.ifa.ifa_scope = default_scope(&lcl);
     
-    rtnl_open(&rth, 0);
-    ll_init_map(&rth);
-    
+    if (!nl_ready())
+	return LOWLEVEL_ERROR_SOCKET;
+
     /* is there an interface with this ifindex? */
-    if ((req.ifa.ifa_index = ll_name_to_index((char*)ifacename)) == 0) {
+    if (ifindex <= 0) {
+	ll_init_map(&rth);
+	ifindex = ll_name_to_index((char*)ifacename);
+    }
+    if ((req.ifa.ifa_index = ifindex) == 0) {
 	sprintf(Message, "Cannot find device: %s", ifacename);
 	return LOWLEVEL_ERROR_UNSPEC;
     }
-    rtnl_talk(&rth, &req.n, 0, 0, NULL, NULL, NULL); fflush(stdout);
 
-    return LOWLEVEL_NO_ERROR;
+    /* start listening for DAD result before the kernel starts DAD */
+    if (mode == ADDROPER_ADD)
+	dad_track(req.ifa.ifa_index, (const char*)lcl.data);
+    if (mode == ADDROPER_DEL)
+	dad_untrack(req.ifa.ifa_index, (const char*)lcl.data);
+
+    return batch_append(&req.n);
 }
 
 int ipaddr_add(const char * ifacename, int ifaceid, const char * addr, unsigned long pref,
 	       unsigned long valid, int prefixLength)
 {
-    return ipaddr_add_or_del(addr,ifacename, prefixLength, pref, valid, ADDROPER_ADD);
+    return ipaddr_add_or_del(addr,ifacename, ifaceid, prefixLength, pref, valid, ADDROPER_ADD);
 }
 
 int ipaddr_update(const char* ifacename, int ifindex, const char* addr,
@@ -444,13 +865,13 @@ int ipaddr_update(const char* ifacename, int ifindex, const char* addr,
 {
     /** @todo: Linux kernel currently does not provide API for dynamic addresses */
 
-    return ipaddr_add_or_del(addr, ifacename, prefixLength, pref, valid, ADDROPER_UPDATE);
+    return ipaddr_add_or_del(addr, ifacename, ifindex, prefixLength, pref, valid, ADDROPER_UPDATE);
 }
 
 
 int ipaddr_del(const char * ifacename, int ifaceid, const char * addr, int prefixLength)
 {
-    return ipaddr_add_or_del(addr,ifacename, prefixLength, 0/*pref*/, 0/*valid*/, ADDROPER_DEL);
+    return ipaddr_add_or_del(addr,ifacename, ifaceid, prefixLength, 0/*pref*/, 0/*valid*/, ADDROPER_DEL);
 }
 
 int sock_add(char * ifacename,int ifaceid, char * addr, int port, int thisifaceonly, int reuse)
@@ -639,24 +1060,19 @@ void microsleep(int microsecs)
     nanosleep(&x,&y);
 }
 
-/*
- * returns: -1 - address not found, 0 - addr is ok, 1 - addr is tentative
- */
-int is_addr_tentative(char * ifacename, int iface, char * addr)
+/* dumps all IPv6 addresses over the persistent socket, used when there
+   is no notification-based state for the address */
+static int is_addr_tentative_dump(int iface, const char * packed1)
 {
-    char buf[256];
-    char packed1[16];
     char packed2[16];
     struct rtattr * rta_tb[IFA_MAX+1];
     struct nlmsg_list *ainfo = NULL;
     struct nlmsg_list *head = NULL;
-    struct rtnl_handle rth;
 
     int tentative = LOWLEVEL_TENTATIVE_DONT_KNOW;
 
-    inet_pton6(addr,packed1);
-
-    rtnl_open(&rth, 0);
+    if (!nl_ready())
+	return LOWLEVEL_TENTATIVE_DONT_KNOW;
 
     /* 2nd attribute: AF_UNSPEC, AF_INET, AF_INET6 */
     /* rtnl_wilddump_request(&rth, AF_PACKET, RTM_GETLINK); */
@@ -675,14 +1091,15 @@ int is_addr_tentative(char * ifacename, int iface, char * addr)
 	    if (!rta_tb[IFA_LOCAL])   rta_tb[IFA_LOCAL]   = rta_tb[IFA_ADDRESS];
 	    if (!rta_tb[IFA_ADDRESS]) rta_tb[IFA_ADDRESS] = rta_tb[IFA_LOCAL];
 	    
-	    inet_ntop6(RTA_DATA(rta_tb[IFA_LOCAL]), buf /*, sizeof(buf)*/);
 	    memcpy(packed2,RTA_DATA(rta_tb[IFA_LOCAL]),16);
 
 	    /* print_packed(packed1); printf(" "); print_packed(packed2); printf("\n"); */
 
 	    /* is this addr which are we looking for? */
 	    if (!memcmp(packed1,packed2,16) ) {
-		if (ifa->ifa_flags & IFA_F_TENTATIVE)
+		/* let the tracking table learn it, too */
+		dad_update(n);
+		if (ifa->ifa_flags & (IFA_F_TENTATIVE | IFA_F_DADFAILED))
 		    tentative = LOWLEVEL_TENTATIVE_YES;
 		else
 		    tentative = LOWLEVEL_TENTATIVE_NO;
@@ -691,18 +1108,42 @@ int is_addr_tentative(char * ifacename, int iface, char * addr)
 	ainfo = ainfo->next;
     }
 
-    /* now delete list */
-    while (head) {
-	ainfo = head;
-	head = head->next;
-	free(ainfo);
-    }
-    
-    rtnl_close(&rth);
+    release_nlmsg_list(head);
 
     return tentative;
 }
 
+/*
+ * returns: -1 - address not found, 0 - addr is ok, 1 - addr is tentative
+ * (or DAD has failed)
+ *
+ * For addresses added with ipaddr_add() the answer is taken from address
+ * notifications received so far. Other addresses are checked with a dump.
+ */
+int is_addr_tentative(char * ifacename, int iface, char * addr)
+{
+    char packed1[16];
+    struct dad_entry *e;
+
+    inet_pton6(addr,packed1);
+
+    dad_process_events();
+    e = dad_find(iface, packed1);
+    if (e && rth_mon.fd >= 0) {
+	switch (e->state) {
+	case DAD_STATE_DONE:
+	    return LOWLEVEL_TENTATIVE_NO;
+	case DAD_STATE_PENDING:
+	case DAD_STATE_FAILED:
+	    return LOWLEVEL_TENTATIVE_YES;
+	default:
+	    break;
+	}
+    }
+
+    return is_addr_tentative_dump(iface, packed1);
+}
+
 char * getAAAKeyFilename(uint32_t SPI)
 {
     static char filename[1024];
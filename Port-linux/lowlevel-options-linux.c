@@ -82,289 +82,527 @@ FILE *resolvconf_open(const char *arg1, const char *arg2)
 /* in iproute.c, borrowed from iproute2 */
 extern int iproute_modify(int cmd, unsigned flags, int argc, char **argv);
 
-/**
- * @brief Removes an entry from a file.
- * 
- * Remove value of keyword from opened file in and the result is printed into
- * opened file out. If removed_empty and keyword remains without argument, it
- * will be removed too. Comments (starting with comment char) are respected.
- * All values following keyword are removed on all lines (global remove).
- * 
- * @param in 
- * @param out 
- * @param keyword 
- * @param value 
- * @param comment 
- * @param remove_empty 
- * 
- * @return Returns LOWLEVEL_NO_ERROR by default, LOWLEVEL_ERROR_FILE on I/O error \
- *         (and errno is set up), LOWLEVEL_ERROR_UNSPEC if value or keyword is too long.
- */
-int cfg_value_del(FILE *in, FILE *out, const char *keyword, const char *value,
-	const char comment, int remove_empty) {
-    char buf[MAX_LINE_LEN+1];
-
-    if (strlen(keyword) > MAX_LINE_LEN || strlen(value) > MAX_LINE_LEN)
-	return(LOWLEVEL_ERROR_UNSPEC);
-
-    errno = 0;
-    while (fgets(buf, MAX_LINE_LEN, in)) {
-
-	char *head;
-	/* Skip leading white space */
-	for (head=buf; *head!='\0' && isspace((int)(*head)); head++);
-	/* Skip comment */
-	if (*head!='\0' && *head!=comment) {
-	    /* Find keyword */
-	    if (strstr(head, keyword)==head) {
-		head += strlen(keyword);
-
-		/* Skip alone keyword */
-		if (*head!='\0' && *head!=comment && isspace((int)(*head))) {
-		    char *keyword_end=head;
-
-		    /* Locate each argument */
-		    while (*head!='\0' && *head!=comment) {
-		    char *argument_begin=head;
-		    /* Skip spaces before argument */
-		    for (; *head!='\0' && isspace((int)(*head)); head++);
-		    if (*head!='\0' && *head!=comment) {
-			/* Compare argument to value */
-			if (strstr(head, value)==head) {
-			    head += strlen(value);
-			    if (*head=='\0' || *head==comment ||
-				    isspace((int)(*head))) {
-				/* remove this argument */
-				/* sprinf() moves data and appends '\0' */
-				sprintf(argument_begin, "%s", head);
-				head=argument_begin;
-			    }
-			}
-			/* Skip rest of the argument */
-			for (; *head!='\0' && !isspace((int)(*head)); head++);
-		    }
-		}
-
-		/* Remove whole line if keyword remains without any arguments.*/
-		if (remove_empty) {
-		    for (head=keyword_end; *head!='\0' && isspace((int)(*head));
-			    head++);
-		    if (*head=='\0' || *head==comment) *buf='\0';
-		    }
-		}
-	    }
-	}
+/* ********************************************************************** */
+/* *** desired system configuration ************************************* */
+/* ********************************************************************** */
+
+/* Received DNS servers, domains and NTP servers are not written to the
+   files one by one. dns_add(), ntp_del() and friends only update the
+   desired state. The files are regenerated from that state once per batch
+   (see cfg_batch_begin()/cfg_batch_commit()) and only written if their
+   content has actually changed. */
+
+#define MAX_VALUE_LEN 255
+
+struct cfg_value {
+    char ifname[MAX_IFNAME_LENGTH];
+    char value[MAX_VALUE_LEN+1];
+    struct cfg_value *next;
+};
+
+struct cfg_state {
+    struct cfg_value *desired; /* values that should be configured */
+    struct cfg_value *applied; /* values written to the file last time */
+    int dirty;
+};
+
+struct cfg_buf {
+    char *data;
+    size_t len;
+    size_t size;
+};
+
+static struct cfg_state dns_state;
+static struct cfg_state domain_state;
+static struct cfg_state ntp_state;
+static int cfg_batch_depth = 0;
+
+static struct cfg_value *cfg_list_find(struct cfg_value *lst, const char *ifname,
+                                       const char *value)
+{
+    for (; lst; lst = lst->next) {
+        if ( (!ifname || !strcmp(lst->ifname, ifname)) && !strcmp(lst->value, value))
+            return lst;
+    }
+    return NULL;
+}
+
+static void cfg_list_free(struct cfg_value *lst)
+{
+    struct cfg_value *tmp;
+    while (lst) {
+        tmp = lst->next;
+        free(lst);
+        lst = tmp;
+    }
+}
+
+static struct cfg_value *cfg_list_copy(struct cfg_value *lst)
+{
+    struct cfg_value *head = NULL;
+    struct cfg_value **tail = &head;
+    for (; lst; lst = lst->next) {
+        *tail = malloc(sizeof(struct cfg_value));
+        if (!*tail)
+            break;
+        memcpy(*tail, lst, sizeof(struct cfg_value));
+        (*tail)->next = NULL;
+        tail = &(*tail)->next;
+    }
+    return head;
+}
+
+static int cfg_state_add(struct cfg_state *state, const char *ifname, const char *value)
+{
+    struct cfg_value **tail;
+    struct cfg_value *v;
+
+    if (!value || strlen(value) > MAX_VALUE_LEN)
+        return LOWLEVEL_ERROR_UNSPEC;
+    if (cfg_list_find(state->desired, ifname, value))
+        return LOWLEVEL_NO_ERROR;
 
-	/* print output */
-	if (-1 == fprintf(out, "%s", buf)) return(LOWLEVEL_ERROR_FILE);
+    v = malloc(sizeof(struct cfg_value));
+    if (!v)
+        return LOWLEVEL_ERROR_UNSPEC;
+    memset(v, 0, sizeof(struct cfg_value));
+    snprintf(v->ifname, MAX_IFNAME_LENGTH, "%s", ifname);
+    snprintf(v->value, MAX_VALUE_LEN+1, "%s", value);
+
+    for (tail = &state->desired; *tail; tail = &(*tail)->next);
+    *tail = v;
+    state->dirty = 1;
+    return LOWLEVEL_NO_ERROR;
+}
+
+/* value == NULL removes all values configured on that interface */
+static int cfg_state_del(struct cfg_state *state, const char *ifname, const char *value)
+{
+    struct cfg_value **v = &state->desired;
+    struct cfg_value *tmp;
+    while (*v) {
+        if (!strcmp((*v)->ifname, ifname) && (!value || !strcmp((*v)->value, value))) {
+            tmp = *v;
+            *v = tmp->next;
+            free(tmp);
+            state->dirty = 1;
+            continue;
+        }
+        v = &(*v)->next;
     }
+    return LOWLEVEL_NO_ERROR;
+}
 
-    return((errno)?LOWLEVEL_ERROR_FILE:LOWLEVEL_NO_ERROR);
+static void cfg_state_applied(struct cfg_state *state)
+{
+    cfg_list_free(state->applied);
+    state->applied = cfg_list_copy(state->desired);
+    state->dirty = 0;
 }
 
+static int cfg_buf_append(struct cfg_buf *buf, const char *data, size_t len)
+{
+    char *tmp;
+    if (buf->len + len + 1 > buf->size) {
+        size_t size = buf->size ? buf->size : 1024;
+        while (buf->len + len + 1 > size)
+            size *= 2;
+        tmp = realloc(buf->data, size);
+        if (!tmp)
+            return LOWLEVEL_ERROR_UNSPEC;
+        buf->data = tmp;
+        buf->size = size;
+    }
+    memcpy(buf->data + buf->len, data, len);
+    buf->len += len;
+    buf->data[buf->len] = 0;
+    return LOWLEVEL_NO_ERROR;
+}
+
+static int cfg_buf_str(struct cfg_buf *buf, const char *str)
+{
+    return cfg_buf_append(buf, str, strlen(str));
+}
+
+/* reads whole file. Missing file is not an error (it's just empty) */
+static int cfg_file_read(const char *file, struct cfg_buf *buf)
+{
+    char tmp[4096];
+    size_t len;
+    FILE *f = fopen(file, "r");
+    if (!f)
+        return (errno == ENOENT) ? LOWLEVEL_NO_ERROR : LOWLEVEL_ERROR_FILE;
+    while ((len = fread(tmp, 1, sizeof(tmp), f)) > 0) {
+        if (cfg_buf_append(buf, tmp, len) != LOWLEVEL_NO_ERROR) {
+            fclose(f);
+            return LOWLEVEL_ERROR_UNSPEC;
+        }
+    }
+    fclose(f);
+    return LOWLEVEL_NO_ERROR;
+}
 
 /**
- * @brief removes value of keyword from file.
+ * @brief replaces file content atomically
  *
- * It tries to do its best not to corrupt the file.
- * Returns LOWLEVEL ERROR codes
+ * New content is written to a temporary file in the same directory, which
+ * is then renamed over the original one, so readers never see a partially
+ * written file. Permissions of the original file are preserved.
  *
- * @param file
- * @param keyword
- * @param value
+ * @param file name of the file to be replaced
+ * @param content new content
+ * @param len length of the new content
  *
  * @return status code (one of LOWLEVEL_* defines)
  */
-int cfg_file_del(const char *file, const char *keyword, const char *value) {
-    FILE *fold, *ftmp;
-    int tmpfd;
-    int error = LOWLEVEL_NO_ERROR;
+static int cfg_file_replace(const char *file, const char *content, size_t len)
+{
+    char template[MAX_LINE_LEN+1];
     struct stat st;
-    char template[]="/etc/dibbler.XXXXXX";
+    int fd;
 
-    /* Create temporary FILE */
-    if ((tmpfd = mkstemp(template)) == -1)
-	return (LOWLEVEL_ERROR_FILE);
+    if (snprintf(template, sizeof(template), "%s.dibbler-XXXXXX", file) >= (int)sizeof(template))
+        return LOWLEVEL_ERROR_UNSPEC;
 
-    if (!(ftmp = fdopen(tmpfd, "w"))) {
-        /* close the file first, then... */
-	close(tmpfd);
+    memset(&st, 0, sizeof(st));
+    if (stat(file, &st))
+        st.st_mode = 0644;
 
-        /* then delete it */
-	unlink(template);
-	return(LOWLEVEL_ERROR_FILE);
+    if ((fd = mkstemp(template)) == -1)
+        return LOWLEVEL_ERROR_FILE;
+
+    if ( (write(fd, content, len) != (ssize_t)len) || fchmod(fd, st.st_mode & 07777) ||
+         fsync(fd) ) {
+        close(fd);
+        unlink(template);
+        return LOWLEVEL_ERROR_FILE;
+    }
+    if (close(fd) || rename(template, file)) {
+        unlink(template);
+        return LOWLEVEL_ERROR_FILE;
     }
+    return LOWLEVEL_NO_ERROR;
+}
 
-    /* Open original file */
-    if (!(fold = fopen(file, "r"))) {
-	unlink(template);
-	fclose(ftmp);
-	return(LOWLEVEL_ERROR_FILE);
+/* returns 1 if the value is on the list, no matter which interface */
+static int cfg_known(struct cfg_value *lst, const char *value, size_t len)
+{
+    for (; lst; lst = lst->next) {
+        if (strlen(lst->value) == len && !strncmp(lst->value, value, len))
+            return 1;
     }
+    return 0;
+}
 
-    /* modify configuration */
-    error = cfg_value_del(fold, ftmp, keyword, value, '#', 1);
+/* marks desired value as present in the file */
+static void cfg_mark(struct cfg_value *lst, int *present, const char *value, size_t len)
+{
+    int i;
+    for (i = 0; lst; lst = lst->next, i++) {
+        if (strlen(lst->value) == len && !strncmp(lst->value, value, len))
+            present[i] = 1;
+    }
+}
+
+/**
+ * @brief renders new content of a configuration file
+ *
+ * Values that were configured previously and are no longer desired are
+ * removed, desired values not present in the file are added. Lines not
+ * managed by dibbler are kept intact. single_kw is a keyword that takes
+ * one value per line (e.g. nameserver), multi_kw takes a list of values
+ * in a single line (e.g. search).
+ *
+ * @param old current content of the file
+ * @param out new content will be stored here
+ * @param single_kw keyword with one value per line
+ * @param single state of values for single_kw
+ * @param multi_kw keyword with multiple values (may be NULL)
+ * @param multi state of values for multi_kw (may be NULL)
+ *
+ * @return status code (one of LOWLEVEL_* defines)
+ */
+static int cfg_render(const char *old, struct cfg_buf *out,
+                      const char *single_kw, struct cfg_state *single,
+                      const char *multi_kw, struct cfg_state *multi)
+{
+    int single_cnt = 0, multi_cnt = 0, i, pass;
+    int *single_present, *multi_present;
+    int multi_done = 0;
+    struct cfg_value *v;
+    const char *line, *eol, *p, *tok;
+    size_t len;
+    int result = LOWLEVEL_NO_ERROR;
+
+    for (v = single->desired; v; v = v->next) single_cnt++;
+    for (v = multi ? multi->desired : NULL; v; v = v->next) multi_cnt++;
+    single_present = calloc(single_cnt + 1, sizeof(int));
+    multi_present  = calloc(multi_cnt + 1, sizeof(int));
+    if (!single_present || !multi_present) {
+        free(single_present);
+        free(multi_present);
+        return LOWLEVEL_ERROR_UNSPEC;
+    }
 
-    /* close the files */
-    if (fclose(fold) == EOF) {
-        error=LOWLEVEL_ERROR_FILE;
+    /* 1st pass: find out which desired values are already there,
+       2nd pass: write the output */
+    for (pass = 0; pass < 2; pass++) {
+        for (line = old; line && *line; line = eol) {
+            eol = strchr(line, '\n');
+            eol = eol ? eol + 1 : line + strlen(line);
+
+            for (p = line; p < eol && (*p == ' ' || *p == '\t'); p++);
+            len = strlen(single_kw);
+            if (p + len < eol && !strncmp(p, single_kw, len) && isspace((int)p[len])) {
+                for (tok = p + len; tok < eol && isspace((int)*tok); tok++);
+                for (p = tok; p < eol && !isspace((int)*p) && *p != '#'; p++);
+                if (cfg_known(single->desired, tok, p - tok)) {
+                    if (!pass)
+                        cfg_mark(single->desired, single_present, tok, p - tok);
+                } else if (cfg_known(single->applied, tok, p - tok)) {
+                    continue; /* not desired anymore */
+                }
+            } else if (multi_kw && (len = strlen(multi_kw)) &&
+                       p + len < eol && !strncmp(p, multi_kw, len) && isspace((int)p[len])) {
+                struct cfg_buf tmp;
+                int values = 0;
+                memset(&tmp, 0, sizeof(tmp));
+                cfg_buf_append(&tmp, line, p + len - line);
+                for (tok = p + len; tok < eol; tok = p) {
+                    for (; tok < eol && isspace((int)*tok); tok++);
+                    if (tok == eol || *tok == '#')
+                        break;
+                    for (p = tok; p < eol && !isspace((int)*p); p++);
+                    if (cfg_known(multi->desired, tok, p - tok)) {
+                        if (!pass)
+                            cfg_mark(multi->desired, multi_present, tok, p - tok);
+                    } else if (cfg_known(multi->applied, tok, p - tok)) {
+                        continue;
+                    }
+                    cfg_buf_str(&tmp, " ");
+                    cfg_buf_append(&tmp, tok, p - tok);
+                    values++;
+                }
+                if (pass && !multi_done) {
+                    /* missing values are appended to the first line */
+                    for (i = 0, v = multi->desired; v; v = v->next, i++) {
+                        if (!multi_present[i]) {
+                            cfg_buf_str(&tmp, " ");
+                            cfg_buf_str(&tmp, v->value);
+                            values++;
+                        }
+                    }
+                    multi_done = 1;
+                }
+                if (pass && values) {
+                    cfg_buf_str(&tmp, "\n");
+                    result |= cfg_buf_append(out, tmp.data, tmp.len);
+                }
+                free(tmp.data);
+                continue;
+            }
+            if (pass)
+                result |= cfg_buf_append(out, line, eol - line);
+        }
     }
 
-    if (fclose(ftmp) == EOF) {
-        error=LOWLEVEL_ERROR_FILE;
+    if (out->len && out->data[out->len-1] != '\n')
+        result |= cfg_buf_str(out, "\n");
+
+    for (i = 0, v = single->desired; v; v = v->next, i++) {
+        if (!single_present[i]) {
+            result |= cfg_buf_str(out, single_kw);
+            result |= cfg_buf_str(out, " ");
+            result |= cfg_buf_str(out, v->value);
+            result |= cfg_buf_str(out, "\n");
+        }
     }
 
-    /* move temp file into place of the old one */
-    if (error==LOWLEVEL_NO_ERROR) {
-	memset(&st,0,sizeof(st));
-	if (stat(file, &st) || rename(template, file) ||
-		chmod(file, st.st_mode))
-	    error=LOWLEVEL_ERROR_FILE;
+    if (multi && !multi_done && multi->desired) {
+        result |= cfg_buf_str(out, multi_kw);
+        for (v = multi->desired; v; v = v->next) {
+            result |= cfg_buf_str(out, " ");
+            result |= cfg_buf_str(out, v->value);
+        }
+        result |= cfg_buf_str(out, "\n");
     }
 
-    return(error);
+    free(single_present);
+    free(multi_present);
+    return result ? LOWLEVEL_ERROR_UNSPEC : LOWLEVEL_NO_ERROR;
 }
 
+/* regenerates the file and writes it if anything has changed */
+static int cfg_file_update(const char *file,
+                           const char *single_kw, struct cfg_state *single,
+                           const char *multi_kw, struct cfg_state *multi)
+{
+    struct cfg_buf old, out;
+    int result;
 
-/*
- * results 0 - ok
-          -1 - unable to open temp. file
-          -2 - unable to open resolv.conf file
- */
-int dns_add(const char * ifname, int ifaceid, const char * addrPlain) {
-    FILE * f = NULL;
-    unsigned char c;
+    memset(&old, 0, sizeof(old));
+    memset(&out, 0, sizeof(out));
 
-#ifdef MOD_RESOLVCONF
-    /* try to use resolvconf */
-    f=resolvconf_open("-a", ifname);
-#endif
+    result = cfg_file_read(file, &old);
+    if (result == LOWLEVEL_NO_ERROR)
+        result = cfg_render(old.data, &out, single_kw, single, multi_kw, multi);
 
-    /* if resolvconf is not available, fallback to normal file append */
-    if (!f && !(f=fopen(RESOLVCONF_FILE, "a+")) ) {
-            return LOWLEVEL_ERROR_FILE;
+    if (result == LOWLEVEL_NO_ERROR &&
+        (old.len != out.len || (out.len && memcmp(old.data, out.data, out.len))) ) {
+        result = cfg_file_replace(file, out.data ? out.data : "", out.len);
     }
-    
-    fseek(f, -1, SEEK_END);
-    c = fgetc(f); /* read the last character */
 
-    fseek(f,0, SEEK_END);
-    /* if the file does not end with new-line, add it */
-    if ( (c != CR) && (c != LF) ) {
-        fprintf(f,"\n");
-    }
-    fprintf(f,"nameserver %s\n",addrPlain);
-    fclose(f);
-    return LOWLEVEL_NO_ERROR;
+    free(old.data);
+    free(out.data);
+    return result;
 }
 
-int dns_del(const char * ifname, int ifaceid, const char *addrPlain) {
-    
 #ifdef MOD_RESOLVCONF
-    FILE *f = NULL;
-    /* try to use resolvconf to remove config */
-    if ((f=resolvconf_open("-d", ifname))) {
-        fclose(f);
-        return LOWLEVEL_NO_ERROR;
+/* resolvconf takes complete configuration of an interface at once */
+static void resolvconf_render(struct cfg_buf *buf, const char *ifname,
+                              struct cfg_value *dns, struct cfg_value *domains)
+{
+    int search = 0;
+    for (; dns; dns = dns->next) {
+        if (strcmp(dns->ifname, ifname))
+            continue;
+        cfg_buf_str(buf, "nameserver ");
+        cfg_buf_str(buf, dns->value);
+        cfg_buf_str(buf, "\n");
     }
-#endif
-    
-    return cfg_file_del(RESOLVCONF_FILE, "nameserver", addrPlain);
+    for (; domains; domains = domains->next) {
+        if (strcmp(domains->ifname, ifname))
+            continue;
+        cfg_buf_str(buf, search ? " " : "search ");
+        cfg_buf_str(buf, domains->value);
+        search = 1;
+    }
+    if (search)
+        cfg_buf_str(buf, "\n");
 }
 
-int domain_add(const char* ifname, int ifaceid, const char* domain) {
-    FILE * f, *f2;
-    char buf[512];
-    int found = 0;
-    unsigned char c;
-    struct stat st;
+/* returns 0 if resolvconf is not available */
+static int resolvconf_update()
+{
+    struct cfg_value *lists[4];
+    struct cfg_value *v;
+    struct cfg_buf before, after;
+    FILE *f;
+    int i;
 
-#ifdef MOD_RESOLVCONF
-    /* try to use resolvconf it is available */
-    if ( (f=resolvconf_open("-a", ifname))) {
-        fprintf(f, "search %s\n", domain);
-        fclose(f);
-        return LOWLEVEL_NO_ERROR;
+    if (access(RESOLVCONF, X_OK) != 0)
+        return 0;
+
+    lists[0] = dns_state.desired;
+    lists[1] = domain_state.desired;
+    lists[2] = dns_state.applied;
+    lists[3] = domain_state.applied;
+
+    for (i = 0; i < 4; i++) {
+        for (v = lists[i]; v; v = v->next) {
+            /* only the first occurrence of each interface is processed */
+            struct cfg_value *prev;
+            int j, seen = 0;
+            for (j = 0; j <= i && !seen; j++)
+                for (prev = lists[j]; prev && prev != v && !seen; prev = prev->next)
+                    seen = !strcmp(prev->ifname, v->ifname);
+            if (seen)
+                continue;
+
+            memset(&before, 0, sizeof(before));
+            memset(&after, 0, sizeof(after));
+            resolvconf_render(&before, v->ifname, dns_state.applied, domain_state.applied);
+            resolvconf_render(&after, v->ifname, dns_state.desired, domain_state.desired);
+            if (before.len != after.len || (after.len && memcmp(before.data, after.data, after.len))) {
+                if (after.len) {
+                    if ((f = resolvconf_open("-a", v->ifname))) {
+                        fwrite(after.data, 1, after.len, f);
+                        fclose(f);
+                    }
+                } else if ((f = resolvconf_open("-d", v->ifname))) {
+                    fclose(f);
+                }
+            }
+            free(before.data);
+            free(after.data);
+        }
     }
+    return 1;
+}
 #endif
-    
-    /* otherwise do the edit on your own */
 
-    memset(&st,0,sizeof(st));
-    stat(RESOLVCONF_FILE, &st);
+int cfg_batch_begin()
+{
+    cfg_batch_depth++;
+    return LOWLEVEL_NO_ERROR;
+}
 
-    unlink(RESOLVCONF_FILE ".old");
-    rename(RESOLVCONF_FILE, RESOLVCONF_FILE ".old");
-    if ( !(f = fopen(RESOLVCONF_FILE ".old", "r")) )
-	return LOWLEVEL_ERROR_FILE;
-    if ( !(f2 = fopen(RESOLVCONF_FILE, "w+")) ) {
-        fclose(f);
-	return LOWLEVEL_ERROR_FILE;
-    }
-    while (fgets(buf,511,f)) {
-	if ( (!found) && (strstr(buf, "search")) ) {
-	    if (strlen(buf))
-		buf[strlen(buf)-1]=0;
-	    fprintf(f2, "%s %s\n", buf, domain);
-	    found = 1;
-	    continue;
-	}
-	fprintf(f2,"%s",buf);
+/* writes all changes made since the outermost cfg_batch_begin() */
+int cfg_batch_commit()
+{
+    int result = LOWLEVEL_NO_ERROR;
+    int resolv = 0;
+
+    if (cfg_batch_depth > 0)
+        cfg_batch_depth--;
+    if (cfg_batch_depth)
+        return LOWLEVEL_NO_ERROR;
+
+    if (dns_state.dirty || domain_state.dirty) {
+#ifdef MOD_RESOLVCONF
+        resolv = resolvconf_update();
+#endif
+        if (!resolv)
+            result = cfg_file_update(RESOLVCONF_FILE, "nameserver", &dns_state,
+                                     "search", &domain_state);
+        if (result == LOWLEVEL_NO_ERROR) {
+            cfg_state_applied(&dns_state);
+            cfg_state_applied(&domain_state);
+        }
     }
 
-    fseek(f2, -1, SEEK_END);
-    c = fgetc(f2);
-    fseek(f2,0, SEEK_END);
-    if ( (c!=CR) && (c!=LF) ) {
-	fprintf(f2,"\n");
+    if (ntp_state.dirty) {
+        int ntp = cfg_file_update(NTPCONF_FILE, "server", &ntp_state, NULL, NULL);
+        if (ntp == LOWLEVEL_NO_ERROR)
+            cfg_state_applied(&ntp_state);
+        else
+            result = ntp;
     }
 
-    if (!found)
-	fprintf(f2,"search %s\n",domain);
+    return result;
+}
 
-    fclose(f);
-    fclose(f2);
-    chmod(RESOLVCONF_FILE,st.st_mode);
+/* applies the change immediately, unless there is a batch in progress */
+static int cfg_apply(int result)
+{
+    if (result != LOWLEVEL_NO_ERROR || cfg_batch_depth)
+        return result;
+    cfg_batch_depth++;
+    return cfg_batch_commit();
+}
 
-    return LOWLEVEL_NO_ERROR;
+int dns_add(const char * ifname, int ifaceid, const char * addrPlain) {
+    return cfg_apply(cfg_state_add(&dns_state, ifname, addrPlain));
 }
 
-int domain_del(const char * ifname, int ifaceid, const char *domain) {
+int dns_del(const char * ifname, int ifaceid, const char *addrPlain) {
+    return cfg_apply(cfg_state_del(&dns_state, ifname, addrPlain));
+}
 
-#ifdef MOD_RESOLVCONF
-    FILE * f;
-    /* try to use resolvconf if it is available */
-    if ((f = resolvconf_open("-d", ifname))) {
-        fclose(f);
-        return LOWLEVEL_NO_ERROR;
-    }
-#endif
+int domain_add(const char* ifname, int ifaceid, const char* domain) {
+    return cfg_apply(cfg_state_add(&domain_state, ifname, domain));
+}
 
-    /* otherwise fallback to normal file manipulation */
-    return cfg_file_del(RESOLVCONF_FILE, "search", domain);
+int domain_del(const char * ifname, int ifaceid, const char *domain) {
+    return cfg_apply(cfg_state_del(&domain_state, ifname, domain));
 }
 
 int ntp_add(const char* ifname, const int ifindex, const char* addrPlain){
-    FILE * f;
-    unsigned char c;
-    if ( !(f=fopen(NTPCONF_FILE,"a+"))) {
-	return LOWLEVEL_ERROR_FILE;
-    }
-
-    fseek(f, -1, SEEK_END);
-    c = fgetc(f);
-    fseek(f,0, SEEK_END);
-    if ( (c!=CR) && (c!=LF) ) {
-	fprintf(f,"\n");
-    }
-
-    fprintf(f,"server %s\n",addrPlain);
-    fclose(f);
-    return LOWLEVEL_NO_ERROR;
+    return cfg_apply(cfg_state_add(&ntp_state, ifname, addrPlain));
 }
 
 int ntp_del(const char* ifname, const int ifindex, const char* addrPlain){
-    return cfg_file_del(NTPCONF_FILE, "server", addrPlain);
+    return cfg_apply(cfg_state_del(&ntp_state, ifname, addrPlain));
 }
 
 /* 
@@ -503,6 +741,8 @@ void delete_radvd_conf(const char* ifname, const char* prefixPlain, int prefixLe
     rename(RADVD_FILE,RADVD_FILE".old");
 
     f = fopen(RADVD_FILE".old","r");
+    if (!f)
+	return;
     f2 = fopen(RADVD_FILE,"w"); 
 
     snprintf(buf2, 511, "### %s start ###\n", ifname);
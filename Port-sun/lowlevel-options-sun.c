@@ -19,6 +19,15 @@
 
 extern char * Message;
 
+int cfg_batch_begin() {
+    /* options are applied immediately */
+    return LOWLEVEL_NO_ERROR;
+}
+
+int cfg_batch_commit() {
+    return LOWLEVEL_NO_ERROR;
+}
+
 /*
  * results 0 - ok
           -1 - unable to open temp. file
@@ -270,6 +270,23 @@ int ipaddr_del(const char * ifacename, int ifaceid, const char * addr,
     return LOWLEVEL_ERROR_UNSPEC;
 }
 
+int ipaddr_batch_begin() {
+    /* addresses are configured with ifconfig, one at a time */
+    return LOWLEVEL_NO_ERROR;
+}
+
+int ipaddr_batch_commit() {
+    return LOWLEVEL_NO_ERROR;
+}
+
+unsigned ipaddr_batch_last() {
+    return 0;
+}
+
+int ipaddr_batch_result(unsigned id) {
+    return LOWLEVEL_NO_ERROR;
+}
+
 int sock_add(char * ifacename, int ifaceid, char * addr, int port,
         int thisifaceonly, int reuse) {
     int error;
@@ -366,6 +366,27 @@ int ipaddr_del(const char * ifacename, int ifaceid, const char * addr, int prefi
     return i;
 }
 
+int ipaddr_batch_begin()
+{
+    /* addresses are configured with netsh, one at a time */
+    return LOWLEVEL_NO_ERROR;
+}
+
+int ipaddr_batch_commit()
+{
+    return LOWLEVEL_NO_ERROR;
+}
+
+unsigned ipaddr_batch_last()
+{
+    return 0;
+}
+
+int ipaddr_batch_result(unsigned id)
+{
+    return LOWLEVEL_NO_ERROR;
+}
+
 SOCKET mcast=0;
 
 extern int sock_add(char * ifacename,int ifaceid, char * addr, int port, int thisifaceonly, int reuse)
@@ -480,6 +501,15 @@ int sock_recv(int fd, char * myPlainAddr, char * peerPlainAddr, char * buf, int
     }
 }
 
+extern int cfg_batch_begin() {
+    /* options are applied immediately */
+    return LOWLEVEL_NO_ERROR;
+}
+
+extern int cfg_batch_commit() {
+    return LOWLEVEL_NO_ERROR;
+}
+
 extern int dns_add(const char* ifname, int ifaceid, const char* addrPlain) {
     
     // netsh interface ipv6 add dns "eth0" address=2000::123
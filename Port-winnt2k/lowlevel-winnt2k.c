@@ -275,6 +275,27 @@ int ipaddr_del(const char* ifacename, int ifindex, const char* addr,
 	return ipaddr_add(ifacename, ifindex, addr, 0, 0, prefixLength);
 }
 
+int ipaddr_batch_begin()
+{
+    /* addresses are configured with netsh, one at a time */
+    return LOWLEVEL_NO_ERROR;
+}
+
+int ipaddr_batch_commit()
+{
+    return LOWLEVEL_NO_ERROR;
+}
+
+unsigned ipaddr_batch_last()
+{
+    return 0;
+}
+
+int ipaddr_batch_result(unsigned id)
+{
+    return LOWLEVEL_NO_ERROR;
+}
+
 SOCKET mcast=0;
 
 extern int sock_add(char * ifacename,int ifaceid, char * addr, int port, int thisifaceonly, int reuse)
@@ -401,6 +422,15 @@ int sock_recv(int fd, char * myPlainAddr, char * peerPlainAddr, char * buf, int
 	}
 } 
 
+extern int cfg_batch_begin() {
+    /* options are applied immediately */
+    return LOWLEVEL_NO_ERROR;
+}
+
+extern int cfg_batch_commit() {
+    return LOWLEVEL_NO_ERROR;
+}
+
 extern int dns_add(const char* ifname, int ifindex, const char* addrPlain) {
   // I think Windows NT/2000 does not support DNS over IPv6...
     return 0;
@@ -77,7 +77,7 @@ void TRelMsg::decodeOpts(char * buf, int bufSize) {
 	}
 
 	if ( (ptr) && (ptr->isValid()) )
-	    Options.push_back( ptr );
+	    addOption( ptr );
 	else
 	    Log(Warning) << "Option " << code << " is invalid. Option ignored." << LogEnd;
         pos+=length;
@@ -41,6 +41,6 @@ std::string TReqMsg::getName() const
 
 void TReqMsg::addOption(SPtr<TOpt> opt)
 {
-    Options.push_back(opt);
+    TMsg::addOption(opt);
 }
 
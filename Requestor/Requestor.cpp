@@ -172,13 +172,6 @@ int main(int argc, char *argv[])
 }
 
 
-/* linker workarounds: dummy functions */
-extern "C"
-{
-    void *hmac_sha (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type) { return 0; }
-    void *hmac_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf) { return 0; }
-}
-
 #ifndef WIN32
 //unsigned getDigestSize(enum DigestTypes type) { return 0; }
 #endif
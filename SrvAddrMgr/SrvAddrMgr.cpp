@@ -11,6 +11,8 @@
  */
 
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include "SrvAddrMgr.h"
 #include "AddrClient.h"
 #include "AddrIA.h"
@@ -25,16 +27,33 @@ using namespace std;
 TSrvAddrMgr * TSrvAddrMgr::Instance = 0;
 
 TSrvAddrMgr::TSrvAddrMgr(const std::string& xmlfile, bool loadDB)
-    :TAddrMgr(xmlfile, loadDB) {
+    :TAddrMgr(xmlfile, loadDB), JournalFile_(xmlfile + ".journal"), JournalCount_(0),
+     LeaseSync_(*this) {
 
     this->CacheMaxSize = 999999999;
     this->cacheRead();
+
+    if (loadDB)
+        journalRead();
+
+    recountLeases(ClntCounters_, Counters_);
 }
 
 TSrvAddrMgr::~TSrvAddrMgr() {
     Log(Debug) << "SrvAddrMgr cleanup." << LogEnd;
 }
 
+/// @brief updates interface names and indexes of loaded leases
+///
+/// Lease counters are recalculated, as IA addresses are counted per class
+/// and classes are looked up by interface index.
+bool TSrvAddrMgr::updateInterfacesInfo(const NameToIndexMapping& nameToIndex,
+                                       const IndexToNameMapping& indexToName) {
+    bool result = TAddrMgr::updateInterfacesInfo(nameToIndex, indexToName);
+    recountLeases(ClntCounters_, Counters_);
+    return result;
+}
+
 /**
  * @brief adds an address to the client.
  *
@@ -69,12 +88,7 @@ bool TSrvAddrMgr::addClntAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
     }
 
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -85,12 +99,7 @@ bool TSrvAddrMgr::addClntAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
     }
 
     // find this IA
-    SPtr <TAddrIA> ptrIA;
-    ptrClient->firstIA();
-    while ( ptrIA = ptrClient->getIA() ) {
-        if ( ptrIA->getIAID() == IAID)
-            break;
-    }
+    SPtr <TAddrIA> ptrIA = ptrClient->getIA(IAID);
 
     // have we found this IA?
     if (!ptrIA) {
@@ -100,12 +109,7 @@ bool TSrvAddrMgr::addClntAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
             Log(Debug) << "Adding IA (IAID=" << IAID << ") to addrDB." << LogEnd;
     }
 
-    SPtr <TAddrAddr> ptrAddr;
-    ptrIA->firstAddr();
-    while ( ptrAddr = ptrIA->getAddr() ) {
-        if (*ptrAddr->get()==*addr)
-            break;
-    }
+    SPtr <TAddrAddr> ptrAddr = ptrIA->getAddr(addr);
 
     // address already exists
     if (ptrAddr) {
@@ -117,9 +121,13 @@ bool TSrvAddrMgr::addClntAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
     // add address
     ptrAddr = new TAddrAddr(addr, pref, valid);
     ptrIA->addAddr(ptrAddr);
-    if (!quiet)
+    countLease(clntDuid, IATYPE_IA, ptrIA->getIfindex(), addr, true);
+    if (!quiet) {
         Log(Debug) << "Adding " << ptrAddr->get()->getPlain()
                    << " to IA (IAID=" << IAID << ") to addrDB." << LogEnd;
+        LeaseSync_.leaseAdded(clntDuid, ptrIA, IATYPE_IA, addr, 128, pref, valid,
+                              ptrAddr->getTimestamp());
+    }
     return true;
 }
 
@@ -136,12 +144,7 @@ bool TSrvAddrMgr::delClntAddr(SPtr<TDUID> clntDuid, unsigned long IAID,
 {
 
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = getClient(clntDuid);
     if (!ptrClient) { // have we found this client?
         Log(Warning) << "Client (DUID=" << clntDuid->getPlain()
                      << ") not found in addrDB, cannot delete address and/or client." << LogEnd;
@@ -149,12 +152,7 @@ bool TSrvAddrMgr::delClntAddr(SPtr<TDUID> clntDuid, unsigned long IAID,
     }
 
     // find this IA
-    SPtr <TAddrIA> ptrIA;
-    ptrClient->firstIA();
-    while ( ptrIA = ptrClient->getIA() ) {
-        if ( ptrIA->getIAID() == IAID)
-            break;
-    }
+    SPtr <TAddrIA> ptrIA = ptrClient->getIA(IAID);
     if (!ptrIA) { // have we found this IA?
         Log(Warning) << "IA (IAID=" << IAID << ") not assigned to client, cannot delete address and/or IA."
                      << LogEnd;
@@ -162,21 +160,19 @@ bool TSrvAddrMgr::delClntAddr(SPtr<TDUID> clntDuid, unsigned long IAID,
     }
 
     // find an address
-    SPtr <TAddrAddr> ptrAddr;
-    ptrIA->firstAddr();
-    while ( ptrAddr = ptrIA->getAddr() ) {
-        if (*ptrAddr->get()==*clntAddr)
-            break;
-    }
+    SPtr <TAddrAddr> ptrAddr = ptrIA->getAddr(clntAddr);
     if (!ptrAddr) {
         Log(Warning) << "Address " << *clntAddr << " not assigned, cannot delete." << LogEnd;
         return false;
     }
 
     ptrIA->delAddr(clntAddr);
+    countLease(clntDuid, IATYPE_IA, ptrIA->getIfindex(), clntAddr, false);
     this->addCachedEntry(clntDuid, clntAddr, IATYPE_IA);
-    if (!quiet)
+    if (!quiet) {
         Log(Debug) << "Deleted address " << *clntAddr << " from addrDB." << LogEnd;
+        LeaseSync_.leaseDeleted(clntDuid, IAID, IATYPE_IA, clntAddr);
+    }
 
     if (!ptrIA->countAddr()) {
         if (!quiet)
@@ -220,12 +216,7 @@ bool TSrvAddrMgr::addTAAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
     }
 
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -235,12 +226,7 @@ bool TSrvAddrMgr::addTAAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
     }
 
     // find this TA
-    SPtr <TAddrIA> ta;
-    ptrClient->firstTA();
-    while ( ta = ptrClient->getTA() ) {
-        if ( ta->getIAID() == iaid)
-            break;
-    }
+    SPtr <TAddrIA> ta = ptrClient->getTA(iaid);
 
     // have we found this TA?
     if (!ta) {
@@ -250,12 +236,7 @@ bool TSrvAddrMgr::addTAAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
         Log(Debug) << "Adding TA (IAID=" << iaid << ") to the addrDB." << LogEnd;
     }
 
-    SPtr <TAddrAddr> ptrAddr;
-    ta->firstAddr();
-    while ( ptrAddr = ta->getAddr() ) {
-        if (*ptrAddr->get()==*addr)
-            break;
-    }
+    SPtr <TAddrAddr> ptrAddr = ta->getAddr(addr);
 
     // address already exists
     if (ptrAddr) {
@@ -267,8 +248,14 @@ bool TSrvAddrMgr::addTAAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
     // add address
     ptrAddr = new TAddrAddr(addr, pref, valid);
     ta->addAddr(ptrAddr);
+    countLease(clntDuid, IATYPE_TA, ta->getIfindex(), addr, true);
+    SPtr<TSrvTARing> ring = findTARing(addr);
+    if (ring)
+        ring->assign(addr, clntDuid, iaid, ta->getIfindex(), (unsigned long)time(NULL) + valid);
     Log(Debug) << "Adding " << ptrAddr->get()->getPlain() << " to TA (IAID=" << iaid
                << ") to addrDB." << LogEnd;
+    LeaseSync_.leaseAdded(clntDuid, ta, IATYPE_TA, addr, 128, pref, valid,
+                          ptrAddr->getTimestamp());
     return true;
 }
 
@@ -285,12 +272,7 @@ bool TSrvAddrMgr::addTAAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
 bool TSrvAddrMgr::delTAAddr(SPtr<TDUID> clntDuid, unsigned long iaid,
                             SPtr<TIPv6Addr> clntAddr, bool quiet) {
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -300,12 +282,7 @@ bool TSrvAddrMgr::delTAAddr(SPtr<TDUID> clntDuid, unsigned long iaid,
     }
 
     // find this IA
-    SPtr <TAddrIA> ta;
-    ptrClient->firstTA();
-    while ( ta = ptrClient->getTA() ) {
-        if ( ta->getIAID() == iaid)
-            break;
-    }
+    SPtr <TAddrIA> ta = ptrClient->getTA(iaid);
 
     // have we found this TA?
     if (!ta) {
@@ -314,12 +291,7 @@ bool TSrvAddrMgr::delTAAddr(SPtr<TDUID> clntDuid, unsigned long iaid,
         return false;
     }
 
-    SPtr <TAddrAddr> ptrAddr;
-    ta->firstAddr();
-    while ( ptrAddr = ta->getAddr() ) {
-        if (*ptrAddr->get()==*clntAddr)
-            break;
-    }
+    SPtr <TAddrAddr> ptrAddr = ta->getAddr(clntAddr);
 
     // address already exists
     if (!ptrAddr) {
@@ -328,8 +300,14 @@ bool TSrvAddrMgr::delTAAddr(SPtr<TDUID> clntDuid, unsigned long iaid,
     }
 
     ta->delAddr(clntAddr);
-    if (!quiet)
+    countLease(clntDuid, IATYPE_TA, ta->getIfindex(), clntAddr, false);
+    SPtr<TSrvTARing> ring = findTARing(clntAddr);
+    if (ring)
+        ring->release(clntAddr, clntDuid, iaid);
+    if (!quiet) {
         Log(Debug) << "Deleted temp. address " << *clntAddr << " from addrDB." << LogEnd;
+        LeaseSync_.leaseDeleted(clntDuid, iaid, IATYPE_TA, clntAddr);
+    }
 
     if (!ta->countAddr()) {
         if (!quiet)
@@ -347,57 +325,378 @@ bool TSrvAddrMgr::delTAAddr(SPtr<TDUID> clntDuid, unsigned long iaid,
     return true;
 }
 
+/**
+ * @brief picks a temporary address for a client
+ *
+ * Address is taken from the ring of specified TA class (see TSrvTARing),
+ * so no other leases are checked. Addresses assigned by the lease sync
+ * partner are skipped. If the ring offers an address whose lease
+ * has expired, but was not removed yet, that lease is returned in expired.
+ * It must be removed (see reclaimTAAddr()) before the address is leased,
+ * but the address may be offered (ADVERTISE) without removing it.
+ * Address is not leased; addTAAddr() must be called to lease it.
+ *
+ * @param ta TA class
+ * @param expired [out] expired lease that holds returned address (if any)
+ *
+ * @return free temporary address (or NULL if the ring is full)
+ */
+SPtr<TIPv6Addr> TSrvAddrMgr::allocTAAddr(SPtr<TSrvCfgTA> ta,
+                                         std::vector<TExpiredInfo>& expired) {
+    SPtr<TSrvTARing> ring = getTARing(ta);
+    if (!ring)
+        return SPtr<TIPv6Addr>();
+
+    // skip addresses assigned by the partner
+    unsigned long now = (unsigned long)time(NULL);
+    TSrvTARing::TLease lease;
+    unsigned int tries = 0;
+    do {
+        if (!ring->next(now, SERVER_MAX_TA_RANDOM_TRIES, lease))
+            return SPtr<TIPv6Addr>();
+    } while (!LeaseSync_.ownsAddr(lease.Addr, now) && ++tries < SERVER_MAX_TA_RANDOM_TRIES);
+    if (!LeaseSync_.ownsAddr(lease.Addr, now))
+        return SPtr<TIPv6Addr>();
+
+    if (lease.Duid) {
+        TExpiredInfo info;
+        info.client = getClient(lease.Duid);
+        if (info.client)
+            info.ia = info.client->getTA(lease.Iaid);
+        if (info.ia && info.ia->getAddr(lease.Addr)) {
+            Log(Debug) << "Temp. address " << lease.Addr->getPlain() << " (DUID="
+                       << lease.Duid->getPlain() << ", IAID=" << lease.Iaid
+                       << ") has expired, it may be reclaimed." << LogEnd;
+            info.addr = lease.Addr;
+            info.prefixLen = 128;
+            expired.push_back(info);
+        } else {
+            // lease is gone already, slot was not freed
+            ring->release(lease);
+        }
+    }
+    return lease.Addr;
+}
+
+/**
+ * @brief removes expired temporary address lease, so its address can be leased again
+ *
+ * Lease is removed as if it expired (lease sync partner is informed). Expire
+ * notify is not called here, it is run later from TSrvTransMgr::doDuties()
+ * (see getReclaimedTA()).
+ *
+ * @param exp expired lease (as returned by allocTAAddr())
+ *
+ * @return true if lease was removed
+ */
+bool TSrvAddrMgr::reclaimTAAddr(const TExpiredInfo& exp) {
+    Log(Notice) << "Temp. address " << *(exp.addr) << " in IA (IAID="
+                << exp.ia->getIAID() << ") in client (DUID=\""
+                << exp.client->getDUID()->getPlain()
+                << "\") has expired, reclaiming it." << LogEnd;
+    if (!delTAAddr(exp.client->getDUID(), exp.ia->getIAID(), exp.addr, false))
+        return false;
+    ReclaimedTA_.push_back(exp);
+    return true;
+}
+
+/**
+ * @brief returns temporary address leases reclaimed since last call
+ *
+ * @param tempAddrLst [out] reclaimed leases are appended here
+ */
+void TSrvAddrMgr::getReclaimedTA(std::vector<TExpiredInfo>& tempAddrLst) {
+    tempAddrLst.insert(tempAddrLst.end(), ReclaimedTA_.begin(), ReclaimedTA_.end());
+    ReclaimedTA_.clear();
+}
+
+/**
+ * @brief returns ring of temporary addresses for specified TA class
+ *
+ * Rings are created on first use and filled with temporary addresses
+ * leased so far.
+ *
+ * @param ta TA class
+ *
+ * @return ring (or NULL if rings are disabled)
+ */
+SPtr<TSrvTARing> TSrvAddrMgr::getTARing(SPtr<TSrvCfgTA> ta) {
+    std::map<unsigned long, SPtr<TSrvTARing> >::iterator it = TARings_.find(ta->getID());
+    if (it != TARings_.end())
+        return it->second;
+
+    if (!SERVER_TA_RING_SIZE || !ta->getPool())
+        return SPtr<TSrvTARing>();
+
+    // every pool gets its own key, so pools are walked in unrelated orders
+    uint64_t key = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+    key ^= ((uint64_t)time(NULL) << 20) ^ ta->getID();
+    SPtr<TSrvTARing> ring = new TSrvTARing(ta->getPool(), SERVER_TA_RING_SIZE, key);
+    TARings_[ta->getID()] = ring;
+
+    unsigned long now = (unsigned long)time(NULL);
+    SPtr<TAddrClient> client;
+    ClntsLst.first();
+    while (client = ClntsLst.get()) {
+        SPtr<TAddrIA> ia;
+        client->firstTA();
+        while (ia = client->getTA()) {
+            SPtr<TAddrAddr> addr;
+            ia->firstAddr();
+            while (addr = ia->getAddr())
+                ring->assign(addr->get(), client->getDUID(), ia->getIAID(), ia->getIfindex(),
+                             now + addr->getValidTimeout());
+        }
+    }
+
+    Log(Debug) << "TA ring for class " << ta->getID() << " created: " << ring->size()
+               << " slot(s), " << ring->count() << " leased." << LogEnd;
+    return ring;
+}
+
+/// returns ring that covers specified temporary address (or NULL)
+SPtr<TSrvTARing> TSrvAddrMgr::findTARing(SPtr<TIPv6Addr> addr) {
+    for (std::map<unsigned long, SPtr<TSrvTARing> >::iterator it = TARings_.begin();
+         it != TARings_.end(); ++it) {
+        if (it->second->contains(addr))
+            return it->second;
+    }
+    return SPtr<TSrvTARing>();
+}
+
+bool TSrvAddrMgr::addPrefix(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr,
+                           const std::string& ifname,
+                           int ifindex, unsigned long IAID, unsigned long T1, unsigned long T2,
+                           SPtr<TIPv6Addr> prefix, unsigned long pref, unsigned long valid,
+                           int length, bool quiet)
+{
+    bool result = TAddrMgr::addPrefix(clntDuid, clntAddr, ifname, ifindex, IAID, T1, T2,
+                                      prefix, pref, valid, length, quiet);
+    if (result)
+        countLease(clntDuid, IATYPE_PD, ifindex, prefix, true);
+    if (result && !quiet) {
+        SPtr<TAddrClient> client = getClient(clntDuid);
+        SPtr<TAddrIA> pd = client ? client->getPD(IAID) : SPtr<TAddrIA>();
+        if (pd)
+            LeaseSync_.leaseAdded(clntDuid, pd, IATYPE_PD, prefix, length, pref, valid,
+                                  pd->getTimestamp());
+    }
+    return result;
+}
+
 bool TSrvAddrMgr::delPrefix(SPtr<TDUID> clntDuid, unsigned long IAID, SPtr<TIPv6Addr> prefix, bool quiet)
 {
     bool result = TAddrMgr::delPrefix(clntDuid, IAID, prefix, quiet);
-    if (result)
+    if (result) {
+        countLease(clntDuid, IATYPE_PD, 0, prefix, false);
         addCachedEntry(clntDuid, prefix, IATYPE_PD);
+    }
+    if (result && !quiet)
+        LeaseSync_.leaseDeleted(clntDuid, IAID, IATYPE_PD, prefix);
     return result;
 }
 
 /// @brief returns how many leases does this client have?
 ///
+/// Counters are maintained on every lease addition and removal, so this
+/// does not walk client's IAs, TAs and PDs.
+///
 /// @param duid client's DUID
 ///
 /// @return number of leases (addresses and/or prefixes)
 unsigned long TSrvAddrMgr::getLeaseCount(SPtr<TDUID> duid) {
-    SPtr <TAddrClient> ptrClient;
-    ClntsLst.first();
-    while ( ptrClient = ClntsLst.get() ) {
-        if ( (*ptrClient->getDUID()) == (*duid))
-            break;
-    }
-    // Have we found this client?
-    if (!ptrClient) {
+    TLeaseCountersMap::const_iterator it =
+        ClntCounters_.find(string(duid->get(), duid->getLen()));
+    if (it == ClntCounters_.end())
         return 0;
-    }
+    return it->second.total();
+}
 
-    unsigned long count = 0;
+/// @brief returns lease counters of specified client
+///
+/// @param duid client's DUID
+///
+/// @return counters (all zero if client has no leases)
+TSrvAddrMgr::TLeaseCounters TSrvAddrMgr::getLeaseCounters(SPtr<TDUID> duid) {
+    TLeaseCountersMap::const_iterator it =
+        ClntCounters_.find(string(duid->get(), duid->getLen()));
+    if (it == ClntCounters_.end())
+        return TLeaseCounters();
+    return it->second;
+}
+
+/// @brief returns counters of all leases
+const TSrvAddrMgr::TLeaseCounters& TSrvAddrMgr::getLeaseCounters() {
+    return Counters_;
+}
+
+/// @brief returns number of addresses leased from specified class
+///
+/// @param classID ID of the address class (see TSrvCfgAddrClass::getID())
+unsigned long TSrvAddrMgr::getClassLeaseCount(unsigned long classID) {
+    std::map<unsigned long, unsigned long>::const_iterator it =
+        Counters_.Classes.find(classID);
+    return it == Counters_.Classes.end() ? 0 : it->second;
+}
+
+bool TSrvAddrMgr::TLeaseCounters::operator==(const TLeaseCounters& other) const {
+    return Addrs == other.Addrs && TempAddrs == other.TempAddrs &&
+        Prefixes == other.Prefixes && Classes == other.Classes;
+}
 
-    // count each of client's IAs
-    SPtr <TAddrIA> ptrIA;
-    ptrClient->firstIA();
-    while ( ptrIA = ptrClient->getIA() ) {
-        count += ptrIA->countAddr();
+/// @brief updates lease counters after lease was added or removed
+///
+/// @param duid client's DUID
+/// @param type lease type (IA, TA or PD)
+/// @param ifindex interface index (used to find class of IA addresses)
+/// @param addr leased address or prefix
+/// @param added true if lease was added, false if removed
+void TSrvAddrMgr::countLease(SPtr<TDUID> duid, TIAType type, int ifindex,
+                             SPtr<TIPv6Addr> addr, bool added) {
+    string key(duid->get(), duid->getLen());
+    TLeaseCounters& clnt = ClntCounters_[key];
+    TLeaseCounters* counters[] = { &clnt, &Counters_ };
+
+    unsigned long classID = 0;
+    bool classFound = false;
+    if (type == IATYPE_IA) {
+        const TSrvCfgIface* cfgIface = SrvCfgMgr().getSnapshot()->getIfaceByID(ifindex);
+        SPtr<TSrvCfgAddrClass> cls = cfgIface ? cfgIface->getClassByAddr(addr)
+                                              : SPtr<TSrvCfgAddrClass>();
+        if (cls) {
+            classID = cls->getID();
+            classFound = true;
+        }
     }
 
-    // count each of client's TA
-    ptrClient->firstTA();
-    while (ptrIA = ptrClient->getTA() ) {
-        count += ptrIA->countAddr();
+    for (unsigned int i = 0; i < 2; i++) {
+        TLeaseCounters& c = *counters[i];
+        unsigned long* cnt = 0;
+        switch (type) {
+        case IATYPE_IA:
+            cnt = &c.Addrs;
+            break;
+        case IATYPE_TA:
+            cnt = &c.TempAddrs;
+            break;
+        case IATYPE_PD:
+            cnt = &c.Prefixes;
+            break;
+        }
+        if (!cnt)
+            continue;
+
+        if (added) {
+            (*cnt)++;
+            if (classFound)
+                c.Classes[classID]++;
+            continue;
+        }
+
+        if (*cnt)
+            (*cnt)--;
+        if (classFound) {
+            std::map<unsigned long, unsigned long>::iterator cl = c.Classes.find(classID);
+            if (cl != c.Classes.end() && !--cl->second)
+                c.Classes.erase(cl);
+        }
     }
 
-    // count each of client's PD
-    ptrClient->firstPD();
-    while (ptrIA = ptrClient->getPD() ) {
-        count += ptrIA->countPrefix();
+    if (!clnt.total())
+        ClntCounters_.erase(key);
+}
+
+/// @brief counts all leases from scratch
+///
+/// @param clients per client counters will be stored here
+/// @param total counters of all leases will be stored here
+void TSrvAddrMgr::recountLeases(TLeaseCountersMap& clients, TLeaseCounters& total) {
+    clients.clear();
+    total = TLeaseCounters();
+
+    SPtr<TAddrClient> client;
+    ClntsLst.first();
+    while (client = ClntsLst.get()) {
+        SPtr<TDUID> duid = client->getDUID();
+        TLeaseCounters c;
+
+        SPtr<TAddrIA> ia;
+        client->firstIA();
+        while (ia = client->getIA()) {
+            const TSrvCfgIface* cfgIface = SrvCfgMgr().getSnapshot()->getIfaceByID(ia->getIfindex());
+            SPtr<TAddrAddr> addr;
+            ia->firstAddr();
+            while (addr = ia->getAddr()) {
+                c.Addrs++;
+                SPtr<TSrvCfgAddrClass> cls = cfgIface ? cfgIface->getClassByAddr(addr->get())
+                                                      : SPtr<TSrvCfgAddrClass>();
+                if (cls) {
+                    c.Classes[cls->getID()]++;
+                    total.Classes[cls->getID()]++;
+                }
+            }
+        }
+
+        client->firstTA();
+        while (ia = client->getTA())
+            c.TempAddrs += ia->countAddr();
+
+        client->firstPD();
+        while (ia = client->getPD())
+            c.Prefixes += ia->countPrefix();
+
+        total.Addrs += c.Addrs;
+        total.TempAddrs += c.TempAddrs;
+        total.Prefixes += c.Prefixes;
+        if (c.total())
+            clients[string(duid->get(), duid->getLen())] = c;
     }
+}
 
-    return count;
+/// @brief verifies that lease counters match actual content of the database
+///
+/// This walks the whole database, so it is meant for tests and debugging only.
+///
+/// @return true if counters are consistent
+bool TSrvAddrMgr::verifyLeaseCounters() {
+    TLeaseCountersMap clients;
+    TLeaseCounters total;
+    recountLeases(clients, total);
+
+    bool ok = true;
+    if (!(total == Counters_)) {
+        Log(Error) << "Lease counters mismatch: " << Counters_.Addrs << "/"
+                   << Counters_.TempAddrs << "/" << Counters_.Prefixes
+                   << " addr/ta/pd lease(s) counted, but " << total.Addrs << "/"
+                   << total.TempAddrs << "/" << total.Prefixes << " found." << LogEnd;
+        ok = false;
+    }
+    if (clients.size() != ClntCounters_.size()) {
+        Log(Error) << "Lease counters mismatch: " << ClntCounters_.size()
+                   << " client(s) counted, but " << clients.size() << " found." << LogEnd;
+        ok = false;
+    }
+    for (TLeaseCountersMap::const_iterator it = clients.begin(); it != clients.end(); ++it) {
+        TLeaseCountersMap::const_iterator counted = ClntCounters_.find(it->first);
+        if (counted == ClntCounters_.end() || !(counted->second == it->second)) {
+            Log(Error) << "Lease counters mismatch for client DUID="
+                       << TDUID(it->first.c_str(), it->first.size()).getPlain() << LogEnd;
+            ok = false;
+        }
+    }
+    return ok;
 }
 
 bool TSrvAddrMgr::addrIsFree(SPtr<TIPv6Addr> addr)
 {
+    // declined recently
+    if (Quarantine_.contains(addr, (unsigned long)time(NULL)))
+        return false;
+
+    // the other half of addresses is assigned by the partner
+    if (!LeaseSync_.ownsAddr(addr, (unsigned long)time(NULL)))
+        return false;
+
     // for each client...
     SPtr <TAddrClient> ptrClient;
     ClntsLst.first();
@@ -417,15 +716,32 @@ bool TSrvAddrMgr::addrIsFree(SPtr<TIPv6Addr> addr)
     return true;
 }
 
-/**
- * Verifies if addr is unused
- *
- * @param addr
- *
- * @return
- */
+/// @brief verifies if prefix is unused (and may be assigned by this server)
+bool TSrvAddrMgr::prefixIsFree(SPtr<TIPv6Addr> prefix)
+{
+    if (!LeaseSync_.ownsAddr(prefix, (unsigned long)time(NULL)))
+        return false;
+    return TAddrMgr::prefixIsFree(prefix);
+}
+
+/// @brief verifies if temporary address is unused (and may be assigned by this server)
 bool TSrvAddrMgr::taAddrIsFree(SPtr<TIPv6Addr> addr)
 {
+    // the other half of addresses is assigned by the partner
+    if (!LeaseSync_.ownsAddr(addr, (unsigned long)time(NULL)))
+        return false;
+    return !taAddrIsLeased(addr);
+}
+
+/// @brief checks if temporary address is leased to any client
+bool TSrvAddrMgr::taAddrIsLeased(SPtr<TIPv6Addr> addr)
+{
+    // addresses covered by a ring are tracked there
+    SPtr<TSrvTARing> ring = findTARing(addr);
+    TSrvTARing::TLease lease;
+    if (ring && ring->get(addr, lease))
+        return (bool)lease.Duid;
+
     // for each client...
     SPtr <TAddrClient> ptrClient;
     ClntsLst.first();
@@ -436,50 +752,33 @@ bool TSrvAddrMgr::taAddrIsFree(SPtr<TIPv6Addr> addr)
         while ( ta = ptrClient->getTA() )
         {
             if (ta->getAddr(addr) )
-                return false;
+                return true;
         }
     }
-    return true;
+    return false;
 }
 
+/// @brief returns numbers of addresses leased from specified classes
+///
+/// @param classes list of classes
+/// @param clntCnt array (one element per class): addresses leased to this client
+/// @param addrCnt array (one element per class): addresses leased to all clients
+/// @param duid client's DUID
+/// @param iface interface index (unused, class IDs are unique)
 void TSrvAddrMgr::getAddrsCount(SPtr< List(TSrvCfgAddrClass) > classes,
      long *clntCnt, long *addrCnt, SPtr<TDUID> duid, int iface)
 {
-    memset(clntCnt,0,sizeof(long)*classes->count());
-    memset(addrCnt,0,sizeof(long)*classes->count());
-    int classNr=0;
-
-    SPtr<TAddrClient> ptrClient;
-    firstClient();
-    while(ptrClient=getClient())
-    {
-        bool thisClient=(*(ptrClient->getDUID())==*duid);
-        ptrClient->firstIA();
-        SPtr<TAddrIA> ptrIA;
-        while(ptrIA=ptrClient->getIA())
-        {
-            SPtr<TAddrAddr> ptrAddr;
-            ptrIA->firstAddr();
-            while(ptrAddr=ptrIA->getAddr())
-            {
-                if(ptrIA->getIfindex() == iface)
-                {
-                    SPtr<TSrvCfgAddrClass> ptrClass;
-                    classes->first();
-                    classNr=0;
-                    while(ptrClass=classes->get())
-                    {
-                        if(ptrClass->addrInPool(ptrAddr->get()))
-                        {
-                            if(thisClient)
-                                clntCnt[classNr]++;
-                            addrCnt[classNr]++;
-                        }
-                        classNr++;
-                    }
-                }
-            }
-        }
+    TLeaseCounters clnt = getLeaseCounters(duid);
+    int classNr = 0;
+
+    SPtr<TSrvCfgAddrClass> ptrClass;
+    classes->first();
+    while (ptrClass = classes->get()) {
+        std::map<unsigned long, unsigned long>::const_iterator it =
+            clnt.Classes.find(ptrClass->getID());
+        clntCnt[classNr] = (it == clnt.Classes.end()) ? 0 : it->second;
+        addrCnt[classNr] = getClassLeaseCount(ptrClass->getID());
+        classNr++;
     }
 }
 
@@ -596,6 +895,10 @@ void TSrvAddrMgr::doDuties(std::vector<TExpiredInfo>& addrLst,
             } // while (prefix)
         } // while (pd)
     } // while (client)
+
+#ifdef DEBUG
+    verifyLeaseCounters();
+#endif
 }
 
 /// @brief Checks if address is still supported in current configuration (used in loadDB)
@@ -788,12 +1091,177 @@ void TSrvAddrMgr::print(std::ostream & out) {
 
 void TSrvAddrMgr::dump() {
 
+    // everything journaled so far will be in the dump
+    JournalPending_.clear();
+
     // Do not write anything to disk if there is performance mode enabled
     if (SrvCfgMgr().getPerformanceMode())
         return;
 
+    // temporary addresses may be kept in memory only
+    DumpTA_ = !SrvCfgMgr().getTAMemoryOnly();
+
     TAddrMgr::dump(); // perform normal dump of the AddrMgr
     cacheDump();
+
+    if (JournalCount_) {
+        std::ofstream f(JournalFile_.c_str(), std::ios::trunc);
+        JournalCount_ = 0;
+    }
+}
+
+/**
+ * @brief checks if renewed lease can be confirmed without extending it
+ *
+ * Clients that renew too often (less than configured percentage of valid
+ * lifetime elapsed and still before T1) get their current lease back with
+ * remaining lifetimes, so it is not modified and nothing has to be written.
+ * Renewals at or after T1 are always processed normally, otherwise the client
+ * would be told to renew again immediately.
+ *
+ * @param ia client's IA or PD
+ *
+ * @return true if lease should be left intact
+ */
+bool TSrvAddrMgr::leaseReusable(SPtr<TAddrIA> ia) {
+    unsigned int threshold = SrvCfgMgr().getLeaseReuse();
+    if (!threshold || !ia->getT1Timeout())
+        return false;
+
+    unsigned long now = (unsigned long)time(NULL);
+    unsigned int leases = 0;
+
+    SPtr<TAddrAddr> addr;
+    ia->firstAddr();
+    while (addr = ia->getAddr()) {
+        unsigned long ts = (unsigned long)addr->getTimestamp();
+        unsigned long elapsed = now > ts ? now - ts : 0;
+        if ((uint64_t)elapsed*100 >= (uint64_t)addr->getValid()*threshold)
+            return false;
+        leases++;
+    }
+
+    SPtr<TAddrPrefix> prefix;
+    ia->firstPrefix();
+    while (prefix = ia->getPrefix()) {
+        unsigned long ts = (unsigned long)prefix->getTimestamp();
+        unsigned long elapsed = now > ts ? now - ts : 0;
+        if ((uint64_t)elapsed*100 >= (uint64_t)prefix->getValid()*threshold)
+            return false;
+        leases++;
+    }
+
+    return leases != 0;
+}
+
+/**
+ * @brief records lifetime extension of a lease
+ *
+ * Renewed leases only get new timestamps, so there's no need to dump
+ * whole database after RENEW or REBIND. A short record is added
+ * to the journal instead (see dumpJournal()) and it is replayed when
+ * the database is loaded.
+ *
+ * @param duid client DUID
+ * @param ia renewed IA (its timestamp is recorded)
+ * @param type IATYPE_IA or IATYPE_PD
+ */
+void TSrvAddrMgr::journalLease(SPtr<TDUID> duid, SPtr<TAddrIA> ia, TIAType type) {
+    stringstream tmp;
+    tmp << duid->getPlain() << " " << ia->getIAID() << " "
+        << (type == IATYPE_PD ? "pd" : "ia") << " " << ia->getTimestamp() << endl;
+    JournalPending_ += tmp.str();
+    LeaseSync_.leaseExtended(duid, ia, type);
+}
+
+/**
+ * @brief writes journaled lease extensions to disk
+ *
+ * If there are too many records in the journal, whole database
+ * is dumped instead (and journal is truncated).
+ */
+void TSrvAddrMgr::dumpJournal() {
+    if (JournalPending_.empty())
+        return;
+
+    if (SrvCfgMgr().getPerformanceMode()) {
+        JournalPending_.clear();
+        return;
+    }
+
+    unsigned int records = 0;
+    for (string::const_iterator c = JournalPending_.begin(); c != JournalPending_.end(); ++c) {
+        if (*c == '\n')
+            records++;
+    }
+    if (JournalCount_ + records > SERVER_DEFAULT_JOURNAL_MAX) {
+        dump();
+        return;
+    }
+
+    std::ofstream f(JournalFile_.c_str(), std::ios::app);
+    if (!f.is_open()) {
+        Log(Error) << "Unable to open lease journal " << JournalFile_
+                   << ", dumping whole database." << LogEnd;
+        dump();
+        return;
+    }
+    f << JournalPending_;
+    JournalPending_.clear();
+    JournalCount_ += records;
+}
+
+/// returns number of records in the journal file
+unsigned int TSrvAddrMgr::getJournalCount() {
+    return JournalCount_;
+}
+
+/// @brief replays lease extensions journaled after last database dump
+void TSrvAddrMgr::journalRead() {
+    ifstream f(JournalFile_.c_str());
+    if (!f.is_open())
+        return;
+
+    string line;
+    unsigned int applied = 0;
+    while (getline(f, line)) {
+        stringstream tmp(line);
+        string duidTxt, type;
+        unsigned long iaid = 0, timestamp = 0;
+        if (!(tmp >> duidTxt >> iaid >> type >> timestamp)) {
+            Log(Warning) << "Invalid lease journal record: " << line << LogEnd;
+            continue;
+        }
+        JournalCount_++;
+
+        SPtr<TAddrClient> client = getClient(new TDUID(duidTxt.c_str()));
+        if (!client)
+            continue;
+
+        if (type == "pd") {
+            SPtr<TAddrIA> pd = client->getPD(iaid);
+            if (!pd)
+                continue;
+            pd->setTimestamp(timestamp);
+            SPtr<TAddrPrefix> prefix;
+            pd->firstPrefix();
+            while (prefix = pd->getPrefix())
+                prefix->setTimestamp(timestamp);
+        } else {
+            SPtr<TAddrIA> ia = client->getIA(iaid);
+            if (!ia)
+                continue;
+            ia->setTimestamp(timestamp);
+            SPtr<TAddrAddr> addr;
+            ia->firstAddr();
+            while (addr = ia->getAddr())
+                addr->setTimestamp(timestamp);
+        }
+        applied++;
+    }
+
+    Log(Debug) << "Lease journal " << JournalFile_ << ": " << applied << " of "
+               << JournalCount_ << " lease extension(s) applied." << LogEnd;
 }
 
 /**
@@ -940,6 +1408,60 @@ void TSrvAddrMgr::cacheRead() {
     }
 }
 
+TSrvLeaseSync& TSrvAddrMgr::getLeaseSync() {
+    return LeaseSync_;
+}
+
+TSrvQuarantine& TSrvAddrMgr::getQuarantine() {
+    return Quarantine_;
+}
+
+/**
+ * @brief puts address declined by a client in quarantine
+ *
+ * Address must be already removed from the client. It stays counted as
+ * assigned in its class until it is released by releaseDeclined(). If the
+ * class has too many quarantined addresses already, it is released at once.
+ *
+ * @param iface interface index
+ * @param addr declined address
+ *
+ * @return true if address was quarantined
+ */
+bool TSrvAddrMgr::declineAddr(int iface, SPtr<TIPv6Addr> addr) {
+    SPtr<TSrvCfgAddrClass> pool = SrvCfgMgr().getClassByAddr(iface, addr);
+    if (pool && Quarantine_.add(addr, iface, pool->getID(), pool->countAddrInPool(),
+                                (unsigned long)time(NULL))) {
+        Log(Info) << "Address " << addr->getPlain() << " declined, it will not be used for "
+                  << Quarantine_.getHoldTime() << " seconds (" << Quarantine_.count(pool->getID())
+                  << " address(es) from class " << pool->getID() << " in quarantine)." << LogEnd;
+        return true;
+    }
+
+    if (pool)
+        Log(Warning) << "Too many declined addresses in class " << pool->getID()
+                     << ", address " << addr->getPlain() << " is returned to the pool." << LogEnd;
+    SrvCfgMgr().delClntAddr(iface, addr);
+    return false;
+}
+
+/**
+ * @brief returns declined addresses to their pools, once their hold time elapsed
+ *
+ * @return number of released addresses
+ */
+unsigned int TSrvAddrMgr::releaseDeclined() {
+    std::vector<TSrvQuarantine::TEntry> released;
+    Quarantine_.expire((unsigned long)time(NULL), released);
+    for (std::vector<TSrvQuarantine::TEntry>::const_iterator e = released.begin();
+         e != released.end(); ++e) {
+        Log(Notice) << "Declined address " << e->Addr->getPlain()
+                    << " returned to the pool." << LogEnd;
+        SrvCfgMgr().delClntAddr(e->Iface, e->Addr);
+    }
+    return released.size();
+}
+
 void TSrvAddrMgr::instanceCreate(const std::string& xmlFile, bool loadDB)
 {
     if (Instance) {
@@ -13,9 +13,16 @@
 #define SRVADDRMGR_H
 
 #include <vector>
+#include <string>
+#include <map>
 #include "AddrMgr.h"
 #include "SrvCfgAddrClass.h"
 #include "SrvCfgPD.h"
+#include "SrvLeaseSync.h"
+#include "SrvQuarantine.h"
+#include "SrvTARing.h"
+
+class TSrvCfgTA;
 
 #define SrvAddrMgr() (TSrvAddrMgr::instance())
 
@@ -41,8 +48,24 @@ class TSrvAddrMgr : public TAddrMgr
 	int prefixLen; // just for prefixes
     };
 
+    /// @brief lease counters of a single client (or of the whole server)
+    struct TLeaseCounters
+    {
+        TLeaseCounters() :Addrs(0), TempAddrs(0), Prefixes(0) { }
+        unsigned long total() const { return Addrs + TempAddrs + Prefixes; }
+        bool operator==(const TLeaseCounters& other) const;
+
+        unsigned long Addrs;     ///< addresses in IA_NA
+        unsigned long TempAddrs; ///< temporary addresses in IA_TA
+        unsigned long Prefixes;  ///< prefixes in IA_PD
+        std::map<unsigned long, unsigned long> Classes; ///< IA_NA addresses per class ID
+    };
+
     ~TSrvAddrMgr();
 
+    bool updateInterfacesInfo(const NameToIndexMapping& nameToIndex,
+                              const IndexToNameMapping& indexToName);
+
     // IA address management
     bool addClntAddr(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr,
                      int iface, unsigned long IAID, unsigned long T1, unsigned long T2,
@@ -57,13 +80,26 @@ class TSrvAddrMgr : public TAddrMgr
                    int iface, unsigned long iaid, SPtr<TIPv6Addr> addr,
                    unsigned long pref, unsigned long valid);
     bool delTAAddr(SPtr<TDUID> duid,unsigned long iaid, SPtr<TIPv6Addr> addr, bool quiet);
+    SPtr<TIPv6Addr> allocTAAddr(SPtr<TSrvCfgTA> ta, std::vector<TExpiredInfo>& expired);
+    bool reclaimTAAddr(const TExpiredInfo& exp);
+    void getReclaimedTA(std::vector<TExpiredInfo>& tempAddrLst);
+    SPtr<TSrvTARing> getTARing(SPtr<TSrvCfgTA> ta);
 
     // prefix management
+    virtual bool addPrefix(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr,
+                           const std::string& ifname,
+                           int ifindex, unsigned long IAID, unsigned long T1, unsigned long T2,
+                           SPtr<TIPv6Addr> prefix, unsigned long pref, unsigned long valid,
+                           int length, bool quiet);
     virtual bool delPrefix(SPtr<TDUID> clntDuid, unsigned long IAID, SPtr<TIPv6Addr> prefix, bool quiet);
     virtual bool verifyPrefix(SPtr<TIPv6Addr> addr);
 
     // how many addresses does this client have?
     unsigned long getLeaseCount(SPtr<TDUID> duid);
+    TLeaseCounters getLeaseCounters(SPtr<TDUID> duid);
+    const TLeaseCounters& getLeaseCounters();
+    unsigned long getClassLeaseCount(unsigned long classID);
+    bool verifyLeaseCounters();
 
     void doDuties(std::vector<TExpiredInfo>& addrLst,
                   std::vector<TExpiredInfo>& tempAddrLst,
@@ -73,7 +109,9 @@ class TSrvAddrMgr : public TAddrMgr
                        long *addrCnt, SPtr<TDUID> duid, int iface);
 
     bool addrIsFree(SPtr<TIPv6Addr> addr);
+    bool prefixIsFree(SPtr<TIPv6Addr> prefix);
     bool taAddrIsFree(SPtr<TIPv6Addr> addr);
+    bool taAddrIsLeased(SPtr<TIPv6Addr> addr);
 
     SPtr<TIPv6Addr> getFirstAddr(SPtr<TDUID> clntDuid);
 
@@ -86,6 +124,21 @@ class TSrvAddrMgr : public TAddrMgr
     void setCacheSize(int bytes);
     void dump();
 
+    // lease journal (lifetime extensions since last dump)
+    void journalLease(SPtr<TDUID> duid, SPtr<TAddrIA> ia, TIAType type);
+    void dumpJournal();
+    unsigned int getJournalCount();
+
+    bool leaseReusable(SPtr<TAddrIA> ia);
+
+    // lease synchronization with the partner server
+    TSrvLeaseSync& getLeaseSync();
+
+    // addresses declined by clients
+    TSrvQuarantine& getQuarantine();
+    bool declineAddr(int iface, SPtr<TIPv6Addr> addr);
+    unsigned int releaseDeclined();
+
  protected:
     void print(std::ostream & out);
 
@@ -97,6 +150,25 @@ class TSrvAddrMgr : public TAddrMgr
     void checkCacheSize();
     List(TSrvCacheEntry) Cache; // list of cached addresses
     size_t CacheMaxSize; // maximum number of cached elements
+
+    void journalRead();
+    std::string JournalFile_;
+    std::string JournalPending_;  ///< records not written to journal yet
+    unsigned int JournalCount_;   ///< records written since last dump
+
+    typedef std::map<std::string, TLeaseCounters> TLeaseCountersMap;
+    void countLease(SPtr<TDUID> duid, TIAType type, int ifindex, SPtr<TIPv6Addr> addr,
+                    bool added);
+    void recountLeases(TLeaseCountersMap& clients, TLeaseCounters& total);
+    TLeaseCountersMap ClntCounters_; ///< per client, indexed by DUID (as in ClntIdx_)
+    TLeaseCounters Counters_;        ///< all leases
+
+    SPtr<TSrvTARing> findTARing(SPtr<TIPv6Addr> addr);
+    std::map<unsigned long, SPtr<TSrvTARing> > TARings_; ///< keyed by TA class ID
+    std::vector<TExpiredInfo> ReclaimedTA_; ///< reclaimed TA leases (expire notify pending)
+
+    TSrvLeaseSync LeaseSync_;
+    TSrvQuarantine Quarantine_;
 };
 
 #endif
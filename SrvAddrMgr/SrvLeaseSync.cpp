@@ -0,0 +1,903 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <sstream>
+#include <string.h>
+#include <time.h>
+#include "socket.h"
+#include "exception.h"
+#include "SrvLeaseSync.h"
+#include "SrvAddrMgr.h"
+#include "SrvCfgMgr.h"
+#include "AddrClient.h"
+#include "AddrAddr.h"
+#include "AddrPrefix.h"
+#include "DHCPDefaults.h"
+#include "Logger.h"
+
+using namespace std;
+
+#ifdef MSG_NOSIGNAL
+#define LEASE_SYNC_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define LEASE_SYNC_SEND_FLAGS 0
+#endif
+
+/// how much data is sent or read at once
+#define LEASE_SYNC_CHUNK 65536
+
+/// how many reads are done in one doDuties() call
+#define LEASE_SYNC_MAX_READS 16
+
+/// longer lines are not records, partner is broken
+#define LEASE_SYNC_MAX_RECORD 4096
+
+/// how many batches of the database are sent in one doDuties() call
+#define LEASE_SYNC_MAX_BATCHES 16
+
+/// length of the random part of handshake challenge (in bytes)
+#define LEASE_SYNC_CHALLENGE_LEN 16
+
+static const char* typeName(TIAType type)
+{
+    switch (type) {
+    case IATYPE_TA:
+        return "ta";
+    case IATYPE_PD:
+        return "pd";
+    default:
+        return "ia";
+    }
+}
+
+static std::string hexString(const char* data, size_t len)
+{
+    static const char digits[] = "0123456789abcdef";
+    string hex;
+    hex.reserve(2 * len);
+    for (size_t i = 0; i < len; i++) {
+        hex += digits[(unsigned char)data[i] >> 4];
+        hex += digits[(unsigned char)data[i] & 0xf];
+    }
+    return hex;
+}
+
+static std::string addRecord(SPtr<TDUID> duid, SPtr<TAddrIA> ia, TIAType type,
+                             SPtr<TIPv6Addr> addr, int length, unsigned long pref,
+                             unsigned long valid, unsigned long timestamp)
+{
+    ostringstream rec;
+    SPtr<TIPv6Addr> clntAddr = ia->getSrvAddr();
+    rec << "add " << typeName(type) << " " << duid->getPlain()
+        << " " << ia->getIAID() << " " << ia->getIfacename() << " "
+        << (clntAddr ? clntAddr->getPlain() : "-") << " " << addr->getPlain()
+        << " " << length << " " << pref << " " << valid << " " << ia->getT1()
+        << " " << ia->getT2() << " " << timestamp << "\n";
+    return rec.str();
+}
+
+TSrvLeaseSync::TSrvLeaseSync(TSrvAddrMgr& addrMgr)
+    :AddrMgr_(addrMgr), Role_(ROLE_NONE), Port_(0), ListenFd_(-1), Fd_(-1),
+     Connecting_(false), NextConnect_(0), LastSeen_(0), Applying_(false),
+     Resync_(false), Authenticated_(false), AuthDeadline_(0), Sent_(0), Received_(0),
+     Dropped_(0)
+{
+}
+
+TSrvLeaseSync::~TSrvLeaseSync()
+{
+    stop();
+}
+
+/**
+ * @brief starts lease synchronization with the partner
+ *
+ * Secondary starts listening immediately, primary connects to the partner
+ * in doDuties().
+ *
+ * @param role ROLE_PRIMARY or ROLE_SECONDARY
+ * @param peer partner's address
+ * @param port TCP port the secondary listens on
+ * @param secret shared secret the partner has to prove it knows (may be empty)
+ *
+ * @return true if synchronization was started
+ */
+bool TSrvLeaseSync::start(ERole role, SPtr<TIPv6Addr> peer, unsigned short port,
+                          const TKey& secret /*= TKey()*/)
+{
+    stop();
+    if (role == ROLE_NONE || !peer)
+        return false;
+
+    if (role == ROLE_SECONDARY) {
+        unsigned char any[16];
+        memset(any, 0, sizeof(any));
+        _addr addr;
+        getaddress_ip6(&addr, any, port);
+        try {
+            ListenFd_ = tcpcreateserver(&addr);
+        } catch (PException& e) {
+            Log(Error) << "Lease sync: unable to listen on port " << port << ": "
+                       << e.message << LogEnd;
+            return false;
+        }
+    }
+
+    Role_ = role;
+    Peer_ = peer;
+    Port_ = port;
+    if (!secret.empty())
+        Key_ = THmacKey::get(secret, DIGEST_HMAC_SHA256);
+    NextConnect_ = 0;
+    LastSeen_ = (unsigned long)time(NULL);
+
+    Log(Notice) << "Lease sync: started as " << (role == ROLE_PRIMARY ? "primary" : "secondary")
+                << ", partner " << peer->getPlain() << ", port " << port << "." << LogEnd;
+    if (!Key_) {
+        Log(Warning) << "Lease sync: no secret configured, partner is recognized by its"
+                     << " address only." << LogEnd;
+    }
+    return true;
+}
+
+void TSrvLeaseSync::stop()
+{
+    if (Fd_ >= 0)
+        tcpclose(Fd_);
+    if (ListenFd_ >= 0)
+        tcpclose(ListenFd_);
+    Fd_ = -1;
+    ListenFd_ = -1;
+    Connecting_ = false;
+    Resync_ = false;
+    Authenticated_ = false;
+    ResyncClients_.clear();
+    OutBuf_.clear();
+    InBuf_.clear();
+    Key_ = SPtr<THmacKey>();
+    Role_ = ROLE_NONE;
+}
+
+/**
+ * @brief maintains connection, sends queued events and applies received ones
+ *
+ * Never blocks, should be called at least once a second.
+ *
+ * @param now current time (in seconds)
+ */
+void TSrvLeaseSync::doDuties(unsigned long now)
+{
+    if (Role_ == ROLE_NONE)
+        return;
+
+    if (Role_ == ROLE_SECONDARY)
+        accept(now);
+    else if (Connecting_ || (Fd_ < 0 && now >= NextConnect_))
+        connect(now);
+
+    if (Fd_ < 0 || Connecting_)
+        return;
+
+    if (!Authenticated_ && now >= AuthDeadline_) {
+        disconnect("partner did not authenticate in time", now);
+        return;
+    }
+
+    if (Authenticated_)
+        LastSeen_ = now;
+    if (!receive()) {
+        disconnect(Authenticated_ ? "connection closed" : "authentication failed", now);
+        return;
+    }
+
+    if (Resync_ && OutBuf_.empty()) {
+        Resync_ = false;
+        queueAll();
+    }
+
+    // database is sent in batches, so the queue never holds all of it
+    for (int i = 0; i < LEASE_SYNC_MAX_BATCHES; i++) {
+        queueBatch();
+        if (!flush()) {
+            disconnect("unable to send", now);
+            return;
+        }
+        if (!OutBuf_.empty() || ResyncClients_.empty())
+            break;
+    }
+}
+
+/// @brief records a new lease (called by TSrvAddrMgr)
+void TSrvLeaseSync::leaseAdded(SPtr<TDUID> duid, SPtr<TAddrIA> ia, TIAType type,
+                               SPtr<TIPv6Addr> addr, int length, unsigned long pref,
+                               unsigned long valid, unsigned long timestamp)
+{
+    if (!isConnected() || Applying_ || !duid->getLen())
+        return;
+    queue(addRecord(duid, ia, type, addr, length, pref, valid, timestamp));
+}
+
+/// @brief records lifetime extension of all leases in an IA (called by TSrvAddrMgr)
+void TSrvLeaseSync::leaseExtended(SPtr<TDUID> duid, SPtr<TAddrIA> ia, TIAType type)
+{
+    if (!isConnected() || Applying_ || !duid->getLen())
+        return;
+    ostringstream rec;
+    rec << "ext " << typeName(type) << " " << duid->getPlain() << " "
+        << ia->getIAID() << " " << ia->getTimestamp() << "\n";
+    queue(rec.str());
+}
+
+/// @brief records removal of a lease (called by TSrvAddrMgr)
+void TSrvLeaseSync::leaseDeleted(SPtr<TDUID> duid, unsigned long iaid, TIAType type,
+                                 SPtr<TIPv6Addr> addr)
+{
+    if (!isConnected() || Applying_ || !duid->getLen())
+        return;
+    ostringstream rec;
+    rec << "del " << typeName(type) << " " << duid->getPlain() << " "
+        << iaid << " " << addr->getPlain() << "\n";
+    queue(rec.str());
+}
+
+/**
+ * @brief checks if this server may assign an address (or prefix)
+ *
+ * Addresses are split between the partners by a hash, so they never
+ * assign the same address to different clients. When the partner is not
+ * connected for SERVER_DEFAULT_LEASE_SYNC_TAKEOVER seconds, its addresses
+ * may be assigned, too.
+ *
+ * @param addr address, temporary address or prefix
+ * @param now current time (in seconds)
+ *
+ * @return true if address may be assigned by this server
+ */
+bool TSrvLeaseSync::ownsAddr(SPtr<TIPv6Addr> addr, unsigned long now) const
+{
+    if (Role_ == ROLE_NONE || !addr || takenOver(now))
+        return true;
+    bool primary = !(hash(addr->getAddr(), 16) & 1);
+    return primary == (Role_ == ROLE_PRIMARY);
+}
+
+/**
+ * @brief checks if this server should answer client's SOLICIT
+ *
+ * Clients are split between the partners by a hash of their DUID. When
+ * the partner is not connected for SERVER_DEFAULT_LEASE_SYNC_TAKEOVER
+ * seconds, its clients are served, too.
+ *
+ * @param duid client's DUID
+ * @param now current time (in seconds)
+ *
+ * @return true if client should be served
+ */
+bool TSrvLeaseSync::ownsClient(SPtr<TDUID> duid, unsigned long now) const
+{
+    if (Role_ == ROLE_NONE || !duid || takenOver(now))
+        return true;
+    bool primary = !(hash(duid->get(), duid->getLen()) & 1);
+    return primary == (Role_ == ROLE_PRIMARY);
+}
+
+/// @brief checks if partner is gone long enough to take over its clients and addresses
+bool TSrvLeaseSync::takenOver(unsigned long now) const
+{
+    return !isConnected() && now >= LastSeen_ + SERVER_DEFAULT_LEASE_SYNC_TAKEOVER;
+}
+
+bool TSrvLeaseSync::isActive() const
+{
+    return Role_ != ROLE_NONE;
+}
+
+/// @brief checks if partner is connected (and authenticated)
+bool TSrvLeaseSync::isConnected() const
+{
+    return Fd_ >= 0 && !Connecting_ && Authenticated_;
+}
+
+TSrvLeaseSync::ERole TSrvLeaseSync::getRole() const
+{
+    return Role_;
+}
+
+/// returns number of bytes queued, but not sent yet
+size_t TSrvLeaseSync::getQueued() const
+{
+    return OutBuf_.size();
+}
+
+/// returns number of records sent (or queued) to the partner
+unsigned long TSrvLeaseSync::getSent() const
+{
+    return Sent_;
+}
+
+/// returns number of records received from the partner
+unsigned long TSrvLeaseSync::getReceived() const
+{
+    return Received_;
+}
+
+/// returns how many times queued records were dropped (and full resync scheduled)
+unsigned long TSrvLeaseSync::getDropped() const
+{
+    return Dropped_;
+}
+
+/// @brief FNV-1a hash, used to split addresses and clients between partners
+unsigned int TSrvLeaseSync::hash(const char* data, size_t len)
+{
+    unsigned int h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/// @brief starts (or completes) non-blocking connect to the partner (primary only)
+void TSrvLeaseSync::connect(unsigned long now)
+{
+    if (Connecting_) {
+        smallset_t set;
+        set.init(1);
+        set.set(0, Fd_);
+        set.waitwrite(0);
+        if (!set.canwrite(0) && !set.iserror(0) && !set.ishup(0)) {
+            // NextConnect_ is a deadline while connecting
+            if (now >= NextConnect_)
+                disconnect("connect timed out", now);
+            return;
+        }
+
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (getsockopt(Fd_, SOL_SOCKET, SO_ERROR, (char*)&err, &len) < 0 || err) {
+            disconnect(string("unable to connect: ") + strerror(err), now);
+            return;
+        }
+        connected(Fd_, now);
+        return;
+    }
+
+    _addr addr;
+    getaddress_ip6(&addr, (const unsigned char*)Peer_->getAddr(), Port_);
+
+    int fd = socket(PF_INET6, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0) {
+        NextConnect_ = now + SERVER_DEFAULT_LEASE_SYNC_RETRY;
+        Log(Error) << "Lease sync: unable to create TCP socket." << LogEnd;
+        return;
+    }
+    try {
+        setnonblock(fd); // closes the socket if it fails
+    } catch (PException& e) {
+        NextConnect_ = now + SERVER_DEFAULT_LEASE_SYNC_RETRY;
+        Log(Error) << "Lease sync: " << e.message << LogEnd;
+        return;
+    }
+
+    Fd_ = fd;
+    if (!::connect(fd, (sockaddr*)&addr, sizeof(sockaddr_in6))) {
+        connected(fd, now);
+        return;
+    }
+#ifdef WIN32
+    if (WSAGetLastError() == WSAEWOULDBLOCK) {
+#else
+    if (errno == EINPROGRESS) {
+#endif
+        Connecting_ = true;
+        NextConnect_ = now + SERVER_DEFAULT_LEASE_SYNC_RETRY;
+        return;
+    }
+    disconnect(string("unable to connect: ") + strerror(errno), now);
+}
+
+/// @brief accepts connection from the partner (secondary only)
+void TSrvLeaseSync::accept(unsigned long now)
+{
+    smallset_t set;
+    set.init(1);
+    set.set(0, ListenFd_);
+    set.wait(0);
+    if (!set.isdata(0))
+        return;
+
+    _addr from;
+    int fd;
+    try {
+        fd = tcpaccept(ListenFd_, &from);
+    } catch (PException& e) {
+        Log(Warning) << "Lease sync: " << e.message << LogEnd;
+        return;
+    }
+
+    if (!sock_is_ipv6(&from) || memcmp(get_ipv6_ptr(&from), Peer_->getAddr(), 16)) {
+        Log(Warning) << "Lease sync: connection from " << addr_to_string(&from)
+                     << " rejected, only partner " << Peer_->getPlain()
+                     << " may connect." << LogEnd;
+        tcpclose(fd);
+        return;
+    }
+
+    if (Fd_ >= 0)
+        disconnect("partner reconnected", now);
+
+    try {
+        setnonblock(fd); // closes the socket if it fails
+    } catch (PException& e) {
+        Log(Error) << "Lease sync: " << e.message << LogEnd;
+        return;
+    }
+    connected(fd, now);
+}
+
+/// @brief connection is established, partner is challenged (if there's a secret)
+/// or whole database is sent to it
+void TSrvLeaseSync::connected(int fd, unsigned long now)
+{
+    Fd_ = fd;
+    Connecting_ = false;
+    Resync_ = false;
+    ResyncClients_.clear();
+    OutBuf_.clear();
+    InBuf_.clear();
+    PeerChallenge_.clear();
+
+    if (Key_) {
+        // current time is added, so challenge doesn't repeat even if random data does
+        uint8_t rnd[LEASE_SYNC_CHALLENGE_LEN];
+        fill_random(rnd, sizeof(rnd));
+        ostringstream challenge;
+        challenge << hexString((const char*)rnd, sizeof(rnd)) << "-" << now;
+        Challenge_ = challenge.str();
+        Authenticated_ = false;
+        AuthDeadline_ = now + SERVER_DEFAULT_LEASE_SYNC_RETRY;
+        OutBuf_ = "hello " + Challenge_ + "\n";
+        Log(Debug) << "Lease sync: connected to partner " << Peer_->getPlain()
+                   << ", authenticating." << LogEnd;
+        return;
+    }
+
+    Authenticated_ = true;
+    LastSeen_ = now;
+    queueAll();
+    Log(Notice) << "Lease sync: connected to partner " << Peer_->getPlain() << ", leases of "
+                << ResyncClients_.size() << " client(s) will be sent." << LogEnd;
+}
+
+void TSrvLeaseSync::disconnect(const std::string& reason, unsigned long now)
+{
+    if (Connecting_) {
+        Log(Debug) << "Lease sync: " << reason << ", retrying in "
+                   << SERVER_DEFAULT_LEASE_SYNC_RETRY << " second(s)." << LogEnd;
+    } else {
+        Log(Warning) << "Lease sync: connection to partner " << Peer_->getPlain()
+                     << " lost (" << reason << "), " << OutBuf_.size()
+                     << " byte(s) not sent." << LogEnd;
+    }
+
+    if (Fd_ >= 0)
+        tcpclose(Fd_);
+    Fd_ = -1;
+    Connecting_ = false;
+    Resync_ = false;
+    Authenticated_ = false;
+    ResyncClients_.clear();
+    NextConnect_ = now + SERVER_DEFAULT_LEASE_SYNC_RETRY;
+    OutBuf_.clear();
+    InBuf_.clear();
+}
+
+/**
+ * @brief queues a record for the partner
+ *
+ * If partner doesn't keep up and there's too much queued, queued records
+ * are dropped and whole database is sent when the connection drains.
+ *
+ * @param record record to be sent (with trailing newline)
+ */
+void TSrvLeaseSync::queue(const std::string& record)
+{
+    if (Resync_)
+        return;
+
+    if (OutBuf_.size() + record.size() > SERVER_DEFAULT_LEASE_SYNC_QUEUE) {
+        // first record may be partially sent already, so keep it
+        size_t eol = OutBuf_.find('\n');
+        OutBuf_.erase(eol == string::npos ? 0 : eol + 1);
+        ResyncClients_.clear();
+        Resync_ = true;
+        Dropped_++;
+        Log(Warning) << "Lease sync: partner " << Peer_->getPlain()
+                     << " does not keep up, queued records dropped, whole database"
+                     << " will be sent again." << LogEnd;
+        return;
+    }
+
+    OutBuf_ += record;
+    Sent_++;
+}
+
+/// @brief schedules sending of all addresses, temporary addresses and prefixes
+///
+/// Only clients are collected here, their leases are queued a batch at a time
+/// (see queueBatch()) as the connection drains.
+void TSrvLeaseSync::queueAll()
+{
+    ResyncClients_.clear();
+    SPtr<TAddrClient> client;
+    AddrMgr_.firstClient();
+    while (client = AddrMgr_.getClient()) {
+        if (client->getDUID()->getLen())
+            ResyncClients_.push_back(client->getDUID());
+    }
+}
+
+/// @brief queues leases of the next clients waiting to be sent, up to one chunk
+void TSrvLeaseSync::queueBatch()
+{
+    while (!ResyncClients_.empty() && OutBuf_.size() < LEASE_SYNC_CHUNK) {
+        queueClient(ResyncClients_.front());
+        ResyncClients_.pop_front();
+    }
+}
+
+/// @brief queues all leases of a client (if it still exists)
+void TSrvLeaseSync::queueClient(SPtr<TDUID> duid)
+{
+    SPtr<TAddrClient> client = AddrMgr_.getClient(duid);
+    if (!client)
+        return;
+
+    SPtr<TAddrIA> ia;
+    client->firstIA();
+    while (ia = client->getIA()) {
+        SPtr<TAddrAddr> addr;
+        ia->firstAddr();
+        while (addr = ia->getAddr()) {
+            OutBuf_ += addRecord(duid, ia, IATYPE_IA, addr->get(), 128, addr->getPref(),
+                                 addr->getValid(), addr->getTimestamp());
+            Sent_++;
+        }
+    }
+
+    client->firstTA();
+    while (ia = client->getTA()) {
+        SPtr<TAddrAddr> addr;
+        ia->firstAddr();
+        while (addr = ia->getAddr()) {
+            OutBuf_ += addRecord(duid, ia, IATYPE_TA, addr->get(), 128, addr->getPref(),
+                                 addr->getValid(), addr->getTimestamp());
+            Sent_++;
+        }
+    }
+
+    client->firstPD();
+    while (ia = client->getPD()) {
+        SPtr<TAddrPrefix> prefix;
+        ia->firstPrefix();
+        while (prefix = ia->getPrefix()) {
+            OutBuf_ += addRecord(duid, ia, IATYPE_PD, prefix->get(), prefix->getLength(),
+                                 prefix->getPref(), prefix->getValid(),
+                                 prefix->getTimestamp());
+            Sent_++;
+        }
+    }
+}
+
+/// @brief sends as much of the queue as possible without blocking
+///
+/// @return false if connection is broken
+bool TSrvLeaseSync::flush()
+{
+    while (!OutBuf_.empty()) {
+        size_t len = OutBuf_.size() > LEASE_SYNC_CHUNK ? LEASE_SYNC_CHUNK : OutBuf_.size();
+        int sent = send(Fd_, OutBuf_.c_str(), (int)len, LEASE_SYNC_SEND_FLAGS);
+        if (sent < 0) {
+#ifdef WIN32
+            return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+        }
+        OutBuf_.erase(0, sent);
+    }
+    return true;
+}
+
+/// @brief reads and applies records sent by the partner
+///
+/// @return false if connection is closed (or partner sends garbage)
+bool TSrvLeaseSync::receive()
+{
+    char buf[LEASE_SYNC_CHUNK];
+    for (int i = 0; i < LEASE_SYNC_MAX_READS; i++) {
+        smallset_t set;
+        set.init(1);
+        set.set(0, Fd_);
+        set.wait(0);
+        if (!set.isdata(0)) {
+            if (set.iserror(0) || set.ishup(0))
+                return false;
+            break;
+        }
+
+        int len;
+        try {
+            len = tcpread(Fd_, buf, sizeof(buf));
+        } catch (PException&) {
+            return false;
+        }
+        if (len <= 0)
+            return false; // readable, but nothing to read: closed
+        InBuf_.append(buf, len);
+    }
+
+    bool dump = false;
+    size_t start = 0, eol;
+    Applying_ = true;
+    while ((eol = InBuf_.find('\n', start)) != string::npos) {
+        string record = InBuf_.substr(start, eol - start);
+        start = eol + 1;
+        if (!Authenticated_) {
+            if (!handshake(record)) {
+                Applying_ = false;
+                return false;
+            }
+            continue;
+        }
+        Received_++;
+        if (!apply(record, dump))
+            Log(Debug) << "Lease sync: record not applied: " << record << LogEnd;
+    }
+    Applying_ = false;
+    InBuf_.erase(0, start);
+
+    if (dump)
+        AddrMgr_.dump();
+    else
+        AddrMgr_.dumpJournal();
+
+    return InBuf_.size() <= LEASE_SYNC_MAX_RECORD;
+}
+
+/**
+ * @brief handles partner's part of the handshake
+ *
+ * Partner's challenge is answered as soon as it arrives. Once partner's
+ * answer to our challenge is verified, whole database is sent to it.
+ *
+ * @param record received line (without trailing newline)
+ *
+ * @return false if partner failed to authenticate
+ */
+bool TSrvLeaseSync::handshake(const std::string& record)
+{
+    istringstream in(record);
+    string cmd, arg;
+    in >> cmd >> arg;
+
+    if (cmd == "hello" && PeerChallenge_.empty() && !arg.empty()) {
+        PeerChallenge_ = arg;
+        OutBuf_ += "auth " + proof(Role_, PeerChallenge_, Challenge_) + "\n";
+        return true;
+    }
+
+    ERole partner = (Role_ == ROLE_PRIMARY) ? ROLE_SECONDARY : ROLE_PRIMARY;
+    if (cmd == "auth" && !PeerChallenge_.empty() &&
+        arg == proof(partner, Challenge_, PeerChallenge_)) {
+        Authenticated_ = true;
+        queueAll();
+        Log(Notice) << "Lease sync: partner " << Peer_->getPlain() << " authenticated, leases of "
+                    << ResyncClients_.size() << " client(s) will be sent." << LogEnd;
+        return true;
+    }
+
+    Log(Warning) << "Lease sync: partner " << Peer_->getPlain()
+                 << " failed to authenticate (different secret?)." << LogEnd;
+    return false;
+}
+
+/**
+ * @brief computes answer to a handshake challenge
+ *
+ * Role of the answering side is signed, too, so a challenge reflected back
+ * to its sender can't be answered with sender's own answer.
+ *
+ * @param role role of the answering side
+ * @param challenge challenge being answered
+ * @param own challenge sent by the answering side
+ *
+ * @return HMAC (hex)
+ */
+std::string TSrvLeaseSync::proof(ERole role, const std::string& challenge,
+                                 const std::string& own) const
+{
+    string data = string(role == ROLE_PRIMARY ? "primary " : "secondary ") + challenge
+        + " " + own;
+    char digest[64]; // enough for any HMAC
+    Key_->sign(data.c_str(), data.size(), digest);
+    return hexString(digest, Key_->getDigestSize());
+}
+
+/**
+ * @brief applies one record received from the partner
+ *
+ * @param record record (without trailing newline)
+ * @param dump [out] set to true if database has to be dumped
+ *
+ * @return true if record was applied
+ */
+bool TSrvLeaseSync::apply(const std::string& record, bool& dump)
+{
+    istringstream in(record);
+    string cmd, type, duidStr;
+    unsigned long iaid = 0;
+    in >> cmd >> type >> duidStr >> iaid;
+    if (in.fail() || (type != "ia" && type != "ta" && type != "pd"))
+        return false;
+
+    TIAType iaType = IATYPE_IA;
+    if (type == "ta")
+        iaType = IATYPE_TA;
+    else if (type == "pd")
+        iaType = IATYPE_PD;
+    SPtr<TDUID> duid = new TDUID(duidStr.c_str());
+    SPtr<TAddrClient> client = AddrMgr_.getClient(duid);
+    SPtr<TAddrIA> ia;
+    if (client) {
+        if (iaType == IATYPE_TA)
+            ia = client->getTA(iaid);
+        else if (iaType == IATYPE_PD)
+            ia = client->getPD(iaid);
+        else
+            ia = client->getIA(iaid);
+    }
+
+    if (cmd == "add") {
+        string ifname, clntAddrStr, addrStr;
+        int length = 0;
+        unsigned long pref = 0, valid = 0, t1 = 0, t2 = 0, ts = 0;
+        in >> ifname >> clntAddrStr >> addrStr >> length >> pref >> valid >> t1 >> t2 >> ts;
+        if (in.fail())
+            return false;
+        SPtr<TIPv6Addr> addr = new TIPv6Addr(addrStr.c_str(), true);
+
+        // already known: just update timestamp
+        SPtr<TAddrAddr> lease;
+        if (ia && iaType != IATYPE_PD) {
+            lease = ia->getAddr(addr);
+        } else if (ia) {
+            SPtr<TAddrPrefix> prefix;
+            ia->firstPrefix();
+            while (prefix = ia->getPrefix()) {
+                if (*prefix->get() == *addr)
+                    lease = (Ptr*)prefix;
+            }
+        }
+        if (lease) {
+            if (ts > (unsigned long)lease->getTimestamp()) {
+                lease->setTimestamp(ts);
+                if (ts > ia->getTimestamp())
+                    ia->setTimestamp(ts);
+                AddrMgr_.journalLease(duid, ia, iaType);
+            }
+            return true;
+        }
+
+        bool used;
+        if (iaType == IATYPE_TA)
+            used = AddrMgr_.taAddrIsLeased(addr);
+        else if (iaType == IATYPE_PD)
+            used = !AddrMgr_.TAddrMgr::prefixIsFree(addr);
+        else
+            used = (bool)AddrMgr_.getClient(addr);
+        if (used) {
+            Log(Warning) << "Lease sync: " << addr->getPlain() << " received from partner "
+                         << "for client " << duidStr << " is leased to other client." << LogEnd;
+            return false;
+        }
+
+        SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByName(ifname);
+        if (!cfgIface) {
+            Log(Warning) << "Lease sync: lease for unknown interface " << ifname
+                         << " received from partner." << LogEnd;
+            return false;
+        }
+
+        SPtr<TIPv6Addr> clntAddr;
+        if (clntAddrStr != "-")
+            clntAddr = new TIPv6Addr(clntAddrStr.c_str(), true);
+
+        if (iaType == IATYPE_IA) {
+            if (!AddrMgr_.addClntAddr(duid, clntAddr, cfgIface->getID(), iaid, t1, t2, addr,
+                                      pref, valid, false))
+                return false;
+            SrvCfgMgr().addClntAddr(cfgIface->getID(), addr);
+            ia = AddrMgr_.getClient(duid)->getIA(iaid);
+            lease = ia->getAddr(addr);
+        } else if (iaType == IATYPE_TA) {
+            if (!AddrMgr_.addTAAddr(duid, clntAddr, cfgIface->getID(), iaid, addr, pref, valid))
+                return false;
+            SrvCfgMgr().addTAAddr(cfgIface->getID());
+            ia = AddrMgr_.getClient(duid)->getTA(iaid);
+            lease = ia->getAddr(addr);
+        } else {
+            if (!AddrMgr_.addPrefix(duid, clntAddr, cfgIface->getName(), cfgIface->getID(),
+                                    iaid, t1, t2, addr, pref, valid, length, false))
+                return false;
+            SrvCfgMgr().incrPrefixCount(cfgIface->getID(), addr);
+            ia = AddrMgr_.getClient(duid)->getPD(iaid);
+            SPtr<TAddrPrefix> prefix;
+            ia->firstPrefix();
+            while (prefix = ia->getPrefix()) {
+                if (*prefix->get() == *addr)
+                    lease = (Ptr*)prefix;
+            }
+        }
+        if (lease)
+            lease->setTimestamp(ts);
+        ia->setTimestamp(ts);
+        dump = true;
+        return true;
+    }
+
+    if (cmd == "ext") {
+        unsigned long ts = 0;
+        in >> ts;
+        if (in.fail() || !ia)
+            return false;
+        if (ts <= ia->getTimestamp())
+            return true;
+
+        ia->setTimestamp(ts);
+        SPtr<TAddrAddr> addr;
+        ia->firstAddr();
+        while (addr = ia->getAddr())
+            addr->setTimestamp(ts);
+        SPtr<TAddrPrefix> prefix;
+        ia->firstPrefix();
+        while (prefix = ia->getPrefix())
+            prefix->setTimestamp(ts);
+        AddrMgr_.journalLease(duid, ia, iaType);
+        return true;
+    }
+
+    if (cmd == "del") {
+        string addrStr;
+        in >> addrStr;
+        if (in.fail() || !ia)
+            return false;
+        SPtr<TIPv6Addr> addr = new TIPv6Addr(addrStr.c_str(), true);
+        int ifindex = ia->getIfindex();
+
+        if (iaType == IATYPE_IA) {
+            if (!AddrMgr_.delClntAddr(duid, iaid, addr, false))
+                return false;
+            SrvCfgMgr().delClntAddr(ifindex, addr);
+        } else if (iaType == IATYPE_TA) {
+            if (!AddrMgr_.delTAAddr(duid, iaid, addr, false))
+                return false;
+            SrvCfgMgr().delTAAddr(ifindex);
+        } else {
+            if (!AddrMgr_.delPrefix(duid, iaid, addr, false))
+                return false;
+            SrvCfgMgr().decrPrefixCount(ifindex, addr);
+        }
+        dump = true;
+        return true;
+    }
+
+    return false;
+}
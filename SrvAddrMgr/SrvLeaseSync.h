@@ -0,0 +1,140 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVLEASESYNC_H
+#define SRVLEASESYNC_H
+
+#include <string>
+#include <deque>
+#include "SmartPtr.h"
+#include "DUID.h"
+#include "IPv6Addr.h"
+#include "AddrIA.h"
+#include "HmacKey.h"
+
+class TSrvAddrMgr;
+
+/// @brief lease synchronization between two active servers
+///
+/// Two servers exchange lease events (add, lifetime extension, delete)
+/// over a single TCP connection, so both have all leases and either of
+/// them can renew or rebind any client. The primary connects to the
+/// secondary, which listens for it.
+///
+/// Both servers serve clients at the same time, so addresses, temporary
+/// addresses and prefixes are split between them (hash of an address decides
+/// which server may assign it) and new clients (SOLICIT) are split by hash
+/// of their DUID. When the partner is not connected for
+/// SERVER_DEFAULT_LEASE_SYNC_TAKEOVER seconds, its clients and its part of
+/// the pools are taken over. If the partner was still running (network
+/// split), both servers may assign the same address in that time; such
+/// conflicts are logged when the servers reconnect.
+///
+/// Only the configured partner address may connect. If a shared secret is
+/// configured, both sides also have to prove they know it before any
+/// records are exchanged: each sends a random challenge and answers the
+/// partner's one with HMAC-SHA256 of both challenges and its role:
+///   hello <challenge>
+///   auth <hmac>
+/// Without a secret, anyone able to spoof the partner's address can
+/// inject leases.
+///
+/// Events are queued and sent in batches every time doDuties() is called.
+/// If the partner does not keep up and the queue gets too long, queued
+/// events are dropped and whole lease database is sent again once the
+/// connection drains. Whole database is also sent after every (re)connect,
+/// a few clients at a time, so the queue never holds all of it.
+///
+/// Records are text lines:
+///   add <ia|ta|pd> <duid> <iaid> <iface> <clntaddr|-> <addr> <length> <pref> <valid>
+///       <t1> <t2> <timestamp>
+///   ext <ia|ta|pd> <duid> <iaid> <timestamp>
+///   del <ia|ta|pd> <duid> <iaid> <addr>
+class TSrvLeaseSync
+{
+ public:
+    typedef enum {
+        ROLE_NONE,      ///< synchronization disabled
+        ROLE_PRIMARY,   ///< connects to the partner
+        ROLE_SECONDARY  ///< waits for the partner to connect
+    } ERole;
+
+    TSrvLeaseSync(TSrvAddrMgr& addrMgr);
+    ~TSrvLeaseSync();
+
+    bool start(ERole role, SPtr<TIPv6Addr> peer, unsigned short port,
+               const TKey& secret = TKey());
+    void stop();
+    void doDuties(unsigned long now);
+
+    void leaseAdded(SPtr<TDUID> duid, SPtr<TAddrIA> ia, TIAType type,
+                    SPtr<TIPv6Addr> addr, int length, unsigned long pref,
+                    unsigned long valid, unsigned long timestamp);
+    void leaseExtended(SPtr<TDUID> duid, SPtr<TAddrIA> ia, TIAType type);
+    void leaseDeleted(SPtr<TDUID> duid, unsigned long iaid, TIAType type,
+                      SPtr<TIPv6Addr> addr);
+
+    bool ownsAddr(SPtr<TIPv6Addr> addr, unsigned long now) const;
+    bool ownsClient(SPtr<TDUID> duid, unsigned long now) const;
+
+    bool isActive() const;
+    bool isConnected() const;
+    ERole getRole() const;
+    size_t getQueued() const;
+    unsigned long getSent() const;
+    unsigned long getReceived() const;
+    unsigned long getDropped() const;
+
+    static unsigned int hash(const char* data, size_t len);
+
+ private:
+    void connect(unsigned long now);
+    void accept(unsigned long now);
+    void connected(int fd, unsigned long now);
+    void disconnect(const std::string& reason, unsigned long now);
+    void queue(const std::string& record);
+    void queueAll();
+    void queueClient(SPtr<TDUID> duid);
+    void queueBatch();
+    bool flush();
+    bool receive();
+    bool handshake(const std::string& record);
+    std::string proof(ERole role, const std::string& challenge,
+                      const std::string& own) const;
+    bool apply(const std::string& record, bool& dump);
+    bool takenOver(unsigned long now) const;
+
+    TSrvAddrMgr& AddrMgr_;
+    ERole Role_;
+    SPtr<TIPv6Addr> Peer_;
+    unsigned short Port_;
+    SPtr<THmacKey> Key_;    ///< shared secret (NULL if not configured)
+
+    int ListenFd_;          ///< listening socket (secondary only)
+    int Fd_;                ///< connection to the partner
+    bool Connecting_;       ///< non-blocking connect in progress
+    unsigned long NextConnect_;  ///< when to try to connect again
+    unsigned long LastSeen_;     ///< when partner was last connected
+    bool Applying_;         ///< partner's events are being applied, don't echo them
+    bool Resync_;           ///< queue overflowed, send whole database when drained
+    bool Authenticated_;    ///< partner proved it knows the secret (or there is none)
+    unsigned long AuthDeadline_; ///< when to give up waiting for partner's proof
+    std::string Challenge_;     ///< challenge sent to the partner
+    std::string PeerChallenge_; ///< challenge received from the partner
+    std::deque< SPtr<TDUID> > ResyncClients_; ///< clients whose leases are still to be sent
+
+    std::string OutBuf_;    ///< queued records, not sent yet
+    std::string InBuf_;     ///< received data, not parsed yet
+
+    unsigned long Sent_;
+    unsigned long Received_;
+    unsigned long Dropped_;
+};
+
+#endif
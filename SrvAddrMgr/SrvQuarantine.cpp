@@ -0,0 +1,163 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <algorithm>
+#include <functional>
+#include "SrvQuarantine.h"
+#include "DHCPDefaults.h"
+#include "DHCPConst.h"
+
+using namespace std;
+
+TSrvQuarantine::TSrvQuarantine()
+    :HoldTime_(DECLINED_TIMEOUT), MaxShare_(SERVER_DEFAULT_DECLINE_MAX_SHARE)
+{
+}
+
+/**
+ * @brief sets quarantine parameters
+ *
+ * @param holdTime how long (in seconds) declined addresses are not used
+ * @param maxShare how many percent of a pool may be in quarantine (0 disables quarantine)
+ */
+void TSrvQuarantine::setLimits(unsigned int holdTime, unsigned int maxShare)
+{
+    HoldTime_ = holdTime;
+    MaxShare_ = maxShare > 100 ? 100 : maxShare;
+}
+
+unsigned int TSrvQuarantine::getHoldTime() const
+{
+    return HoldTime_;
+}
+
+/**
+ * @brief puts declined address in quarantine
+ *
+ * If the address is already there, its hold time starts again.
+ *
+ * @param addr declined address
+ * @param iface interface index
+ * @param poolID ID of the address class the address belongs to
+ * @param poolSize number of addresses in that class
+ * @param now current time (in seconds)
+ *
+ * @return false if address was not quarantined (pool limit reached or
+ *         quarantine disabled), so it is free to use again
+ */
+bool TSrvQuarantine::add(SPtr<TIPv6Addr> addr, int iface, unsigned long poolID,
+                         unsigned long poolSize, unsigned long now)
+{
+    if (!addr || !HoldTime_ || !MaxShare_)
+        return false;
+
+    string key(addr->getAddr(), 16);
+    map<string, TEntry>::iterator it = Entries_.find(key);
+    if (it == Entries_.end()) {
+        // poolSize may be close to ULONG_MAX, so avoid poolSize*MaxShare_
+        unsigned long limit = poolSize / 100 * MaxShare_ + poolSize % 100 * MaxShare_ / 100;
+        if (!limit)
+            limit = 1;
+        if (PoolCount_[poolID] >= limit)
+            return false;
+
+        TEntry entry = TEntry();
+        entry.Addr = new TIPv6Addr(*addr);
+        entry.Iface = iface;
+        entry.PoolID = poolID;
+        it = Entries_.insert(make_pair(key, entry)).first;
+        PoolCount_[poolID]++;
+    }
+    it->second.Release = now + HoldTime_;
+
+    // heap items of re-declined addresses are left behind and skipped when
+    // popped; don't let them pile up
+    if (Heap_.size() > 2 * Entries_.size() + 16) {
+        Heap_.clear();
+        for (map<string, TEntry>::const_iterator e = Entries_.begin(); e != Entries_.end(); ++e)
+            Heap_.push_back(THeapItem(e->second.Release, e->first));
+        make_heap(Heap_.begin(), Heap_.end(), greater<THeapItem>());
+    } else {
+        Heap_.push_back(THeapItem(it->second.Release, key));
+        push_heap(Heap_.begin(), Heap_.end(), greater<THeapItem>());
+    }
+    return true;
+}
+
+/// @brief checks if address is in quarantine (and can't be assigned)
+bool TSrvQuarantine::contains(SPtr<TIPv6Addr> addr, unsigned long now) const
+{
+    if (Entries_.empty() || !addr)
+        return false;
+    map<string, TEntry>::const_iterator it = Entries_.find(string(addr->getAddr(), 16));
+    return it != Entries_.end() && it->second.Release > now;
+}
+
+/**
+ * @brief releases addresses whose hold time elapsed
+ *
+ * @param now current time (in seconds)
+ * @param released [out] released addresses are appended here
+ *
+ * @return number of released addresses
+ */
+unsigned int TSrvQuarantine::expire(unsigned long now, vector<TEntry>& released)
+{
+    unsigned int cnt = 0;
+    while (!Heap_.empty() && Heap_.front().first <= now) {
+        THeapItem item = Heap_.front();
+        pop_heap(Heap_.begin(), Heap_.end(), greater<THeapItem>());
+        Heap_.pop_back();
+
+        map<string, TEntry>::iterator it = Entries_.find(item.second);
+        if (it == Entries_.end() || it->second.Release != item.first)
+            continue; // address was declined again
+        released.push_back(it->second);
+        remove(it);
+        cnt++;
+    }
+    return cnt;
+}
+
+/// @brief returns number of seconds until next address is released
+unsigned long TSrvQuarantine::getTimeout(unsigned long now) const
+{
+    if (Heap_.empty())
+        return DHCPV6_INFINITY;
+    if (Heap_.front().first <= now)
+        return 0;
+    return Heap_.front().first - now;
+}
+
+void TSrvQuarantine::clear()
+{
+    Entries_.clear();
+    Heap_.clear();
+    PoolCount_.clear();
+}
+
+unsigned int TSrvQuarantine::count() const
+{
+    return Entries_.size();
+}
+
+/// @brief returns number of quarantined addresses from specified pool
+unsigned int TSrvQuarantine::count(unsigned long poolID) const
+{
+    map<unsigned long, unsigned int>::const_iterator it = PoolCount_.find(poolID);
+    return it == PoolCount_.end() ? 0 : it->second;
+}
+
+void TSrvQuarantine::remove(map<string, TEntry>::iterator it)
+{
+    map<unsigned long, unsigned int>::iterator pool = PoolCount_.find(it->second.PoolID);
+    if (pool != PoolCount_.end() && !--pool->second)
+        PoolCount_.erase(pool);
+    Entries_.erase(it);
+}
@@ -0,0 +1,69 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVQUARANTINE_H
+#define SRVQUARANTINE_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "SmartPtr.h"
+#include "IPv6Addr.h"
+
+/// @brief addresses declined by clients, kept out of pools for a while
+///
+/// Client sends DECLINE when an address it got is already used by someone
+/// else (DAD failed), so the server must not assign it again for some time.
+/// Declined addresses are kept here (not in the lease database), indexed by
+/// address and ordered by release time (min-heap), and go back to their pools
+/// once the hold time elapses.
+///
+/// Each pool (address class) may have only a share of its addresses in
+/// quarantine, so a flood of DECLINEs can't use up the whole pool. Addresses
+/// declined over that limit are released immediately.
+class TSrvQuarantine
+{
+ public:
+    /// quarantined address
+    struct TEntry {
+        SPtr<TIPv6Addr> Addr;
+        int Iface;
+        unsigned long PoolID;  ///< ID of the address class
+        unsigned long Release; ///< when the address goes back to the pool
+    };
+
+    TSrvQuarantine();
+
+    void setLimits(unsigned int holdTime, unsigned int maxShare);
+    unsigned int getHoldTime() const;
+
+    bool add(SPtr<TIPv6Addr> addr, int iface, unsigned long poolID,
+             unsigned long poolSize, unsigned long now);
+    bool contains(SPtr<TIPv6Addr> addr, unsigned long now) const;
+    unsigned int expire(unsigned long now, std::vector<TEntry>& released);
+    unsigned long getTimeout(unsigned long now) const;
+    void clear();
+
+    unsigned int count() const;
+    unsigned int count(unsigned long poolID) const;
+
+ private:
+    typedef std::pair<unsigned long, std::string> THeapItem; ///< (release, address)
+
+    void remove(std::map<std::string, TEntry>::iterator it);
+
+    std::map<std::string, TEntry> Entries_;  ///< keyed by binary address
+    std::vector<THeapItem> Heap_;            ///< min-heap of release times
+    std::map<unsigned long, unsigned int> PoolCount_;
+    unsigned int HoldTime_;
+    unsigned int MaxShare_;                  ///< percent of a pool
+};
+
+#endif
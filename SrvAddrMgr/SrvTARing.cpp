@@ -0,0 +1,205 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "SrvTARing.h"
+
+using namespace std;
+
+/**
+ * @brief creates a ring over a TA pool
+ *
+ * @param pool pool of temporary addresses
+ * @param maxSize maximum number of slots (pools larger than that are covered partially)
+ * @param key permutation key
+ */
+TSrvTARing::TSrvTARing(SPtr<THostRange> pool, unsigned int maxSize, uint64_t key)
+    :Pool_(pool), Head_(0), Used_(0)
+{
+    // pools with more than 2^64 addresses: the ring covers the beginning of the pool
+    uint64_t last = 0;
+    if (!Pool_->getLastIndex(last))
+        last = 0xffffffffffffffffULL;
+
+    Permutation_.init(last, key);
+    Slots_.resize(last < (uint64_t)maxSize ? (unsigned int)(last + 1) : maxSize);
+}
+
+/**
+ * @brief offers next free slot
+ *
+ * Walks the ring from the head and stops at the first slot that is free
+ * or holds an expired lease. The slot is not assigned; assign() must be
+ * called once the address is actually leased. If the slot holds an expired
+ * lease, lease.Duid, Iaid and Iface identify its previous owner, so the
+ * caller may remove the stale lease.
+ *
+ * @param now current time (in seconds)
+ * @param maxTries maximum number of slots to check
+ * @param lease [out] offered slot
+ *
+ * @return false if no slot is available
+ */
+bool TSrvTARing::next(unsigned long now, unsigned int maxTries, TLease& lease)
+{
+    if (maxTries > Slots_.size())
+        maxTries = Slots_.size();
+
+    for (unsigned int i = 0; i < maxTries; i++) {
+        unsigned int slot = Head_;
+        Head_ = (Head_ + 1 == Slots_.size()) ? 0 : Head_ + 1;
+
+        if (Slots_[slot].Duid && Slots_[slot].Expires > now)
+            continue;
+
+        fillLease(slot, lease);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief marks address as leased
+ *
+ * @param addr leased address
+ * @param duid client's DUID
+ * @param iaid IAID of client's TA
+ * @param iface interface index
+ * @param expires when the lease expires
+ *
+ * @return false if address is not covered by this ring
+ */
+bool TSrvTARing::assign(SPtr<TIPv6Addr> addr, SPtr<TDUID> duid, unsigned long iaid,
+                        int iface, unsigned long expires)
+{
+    unsigned int slot = 0;
+    if (!findSlot(addr, slot))
+        return false;
+
+    TSlot& s = Slots_[slot];
+    if (!s.Duid)
+        Used_++;
+    s.Duid = duid;
+    s.Iaid = iaid;
+    s.Iface = iface;
+    s.Expires = expires;
+    s.Generation++;
+    return true;
+}
+
+/**
+ * @brief frees address, if it is leased to specified client
+ *
+ * @param addr leased address
+ * @param duid client's DUID
+ * @param iaid IAID of client's TA
+ *
+ * @return true if slot was freed
+ */
+bool TSrvTARing::release(SPtr<TIPv6Addr> addr, SPtr<TDUID> duid, unsigned long iaid)
+{
+    unsigned int slot = 0;
+    if (!findSlot(addr, slot))
+        return false;
+
+    TSlot& s = Slots_[slot];
+    if (!s.Duid || s.Iaid != iaid || !(*s.Duid == *duid))
+        return false;
+    freeSlot(slot);
+    return true;
+}
+
+/**
+ * @brief frees slot, unless it changed owner since lease was obtained
+ *
+ * @param lease lease returned by next() or get()
+ *
+ * @return true if slot was freed
+ */
+bool TSrvTARing::release(const TLease& lease)
+{
+    if (lease.Slot >= Slots_.size())
+        return false;
+    TSlot& s = Slots_[lease.Slot];
+    if (!s.Duid || s.Generation != lease.Generation)
+        return false;
+    freeSlot(lease.Slot);
+    return true;
+}
+
+/// checks if address is covered by this ring
+bool TSrvTARing::contains(SPtr<TIPv6Addr> addr) const
+{
+    unsigned int slot = 0;
+    return findSlot(addr, slot);
+}
+
+/// checks if address is not leased (or its lease has expired)
+bool TSrvTARing::isFree(SPtr<TIPv6Addr> addr, unsigned long now) const
+{
+    unsigned int slot = 0;
+    if (!findSlot(addr, slot))
+        return false;
+    return !Slots_[slot].Duid || Slots_[slot].Expires <= now;
+}
+
+/// returns lease of specified address (lease.Duid is NULL if address is free)
+bool TSrvTARing::get(SPtr<TIPv6Addr> addr, TLease& lease) const
+{
+    unsigned int slot = 0;
+    if (!findSlot(addr, slot))
+        return false;
+    fillLease(slot, lease);
+    return true;
+}
+
+/// returns number of slots
+unsigned int TSrvTARing::size() const
+{
+    return Slots_.size();
+}
+
+/// returns number of leased slots (including expired leases not reclaimed yet)
+unsigned int TSrvTARing::count() const
+{
+    return Used_;
+}
+
+bool TSrvTARing::findSlot(SPtr<TIPv6Addr> addr, unsigned int& slot) const
+{
+    uint64_t index = 0;
+    if (!addr || !Pool_->getIndex(addr, index))
+        return false;
+
+    uint64_t pos = Permutation_.unpermute(index);
+    if (pos >= Slots_.size())
+        return false;
+    slot = (unsigned int)pos;
+    return true;
+}
+
+void TSrvTARing::fillLease(unsigned int slot, TLease& lease) const
+{
+    const TSlot& s = Slots_[slot];
+    lease.Addr = Pool_->getAddrByIndex(Permutation_.permute(slot));
+    lease.Duid = s.Duid;
+    lease.Iaid = s.Iaid;
+    lease.Iface = s.Iface;
+    lease.Expires = s.Expires;
+    lease.Slot = slot;
+    lease.Generation = s.Generation;
+}
+
+void TSrvTARing::freeSlot(unsigned int slot)
+{
+    TSlot& s = Slots_[slot];
+    s.Duid.reset();
+    s.Expires = 0;
+    s.Generation++;
+    Used_--;
+}
@@ -0,0 +1,85 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVTARING_H
+#define SRVTARING_H
+
+#include <vector>
+#include <stdint.h>
+#include "SmartPtr.h"
+#include "IPv6Addr.h"
+#include "DUID.h"
+#include "HostRange.h"
+#include "Permutation.h"
+
+/// @brief allocator of temporary (IA_TA) addresses from a single pool
+///
+/// Temporary addresses are short-lived and privacy-focused clients rotate
+/// them often, so checking random candidates against all leases is a waste.
+/// Instead, each TA pool gets a ring of slots. Slot k holds the address at
+/// pool index permute(k) (keyed permutation, see TPermutation), so the ring
+/// is a shuffled view of the pool that needs no per-address storage beyond
+/// the slot itself. Pools larger than the ring are covered partially.
+///
+/// Allocation walks the ring from the head and offers the first slot that
+/// is free or holds an expired lease, so expired leases are reclaimed when
+/// the head gets to them (lazy reclaim, no global scan). Every change of
+/// slot owner bumps its generation, so stale lease handles can be told apart.
+class TSrvTARing
+{
+ public:
+    /// lease held in a ring slot
+    struct TLease {
+        TLease() :Iaid(0), Iface(0), Expires(0), Slot(0), Generation(0) { }
+        SPtr<TIPv6Addr> Addr;
+        SPtr<TDUID> Duid;      ///< owner (NULL if slot was free)
+        unsigned long Iaid;
+        int Iface;
+        unsigned long Expires; ///< when the lease expires
+        unsigned int Slot;
+        uint32_t Generation;   ///< generation of the slot when lease was created
+    };
+
+    TSrvTARing(SPtr<THostRange> pool, unsigned int maxSize, uint64_t key);
+
+    bool next(unsigned long now, unsigned int maxTries, TLease& lease);
+    bool assign(SPtr<TIPv6Addr> addr, SPtr<TDUID> duid, unsigned long iaid,
+                int iface, unsigned long expires);
+    bool release(SPtr<TIPv6Addr> addr, SPtr<TDUID> duid, unsigned long iaid);
+    bool release(const TLease& lease);
+
+    bool contains(SPtr<TIPv6Addr> addr) const;
+    bool isFree(SPtr<TIPv6Addr> addr, unsigned long now) const;
+    bool get(SPtr<TIPv6Addr> addr, TLease& lease) const;
+
+    unsigned int size() const;
+    unsigned int count() const;
+
+ private:
+    struct TSlot {
+        TSlot() :Iaid(0), Iface(0), Expires(0), Generation(0) { }
+        SPtr<TDUID> Duid;      ///< NULL if slot is free
+        unsigned long Iaid;
+        int Iface;
+        unsigned long Expires;
+        uint32_t Generation;
+    };
+
+    bool findSlot(SPtr<TIPv6Addr> addr, unsigned int& slot) const;
+    void fillLease(unsigned int slot, TLease& lease) const;
+    void freeSlot(unsigned int slot);
+
+    SPtr<THostRange> Pool_;
+    TPermutation Permutation_;
+    std::vector<TSlot> Slots_;
+    unsigned int Head_;  ///< next slot to be offered
+    unsigned int Used_;  ///< slots with a lease (including expired ones)
+};
+
+#endif
@@ -17,6 +17,8 @@
 #include "SrvOptAddrParams.h"
 #include "SrvMsg.h"
 #include "DHCPDefaults.h"
+#include <stdlib.h>
+#include <time.h>
 
 using namespace std;
 
@@ -33,8 +35,9 @@ TSrvCfgAddrClass::TSrvCfgAddrClass() {
     ValidMin_ = SERVER_DEFAULT_MIN_VALID;
     ValidMax_ = SERVER_DEFAULT_MAX_VALID;
     ID_ = StaticID_++; // client-class ID
-    AddrsAssigned_ = 0;
+    AddrsAssigned_.set(0);
     AddrsCount_ = 0;
+    Permute_ = false;
     Share_ = 100;
     ClassMaxLease_ = SERVER_DEFAULT_CLASSMAXLEASE;
 }
@@ -196,7 +199,16 @@ void TSrvCfgAddrClass::setOptions(SPtr<TSrvParsGlobalOpt> opt)
 
     // set up address counter counts
     AddrsCount_ = Pool_->rangeCount();
-    AddrsAssigned_ = 0;
+    AddrsAssigned_.set(0);
+
+    // every pool gets its own key, so pools are walked in unrelated orders
+    uint64_t last = 0;
+    Permute_ = Pool_->getLastIndex(last);
+    if (Permute_) {
+        uint64_t key = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+        key ^= ((uint64_t)time(NULL) << 20) ^ ID_;
+        Permutation_.init(last, key);
+    }
 
     if (ClassMaxLease_ > AddrsCount_)
         ClassMaxLease_ = AddrsCount_;
@@ -219,6 +231,29 @@ SPtr<TIPv6Addr> TSrvCfgAddrClass::getRandomAddr()
     return Pool_->getRandomAddr();
 }
 
+/// @brief returns next address from the pool in keyed pseudo-random order
+///
+/// Every address in the pool is returned exactly once in any
+/// countAddrInPool() consecutive calls. Pools larger than 2^64 addresses
+/// can't be exhausted anyway, so random addresses are returned for them.
+SPtr<TIPv6Addr> TSrvCfgAddrClass::getNextAddr()
+{
+    if (!Permute_)
+        return Pool_->getRandomAddr();
+    return Pool_->getAddrByIndex(Permutation_.next());
+}
+
+/// returns how many getNextAddr() calls are enough to check whole pool
+/// (capped at SERVER_MAX_IA_PERMUTATION_STEPS)
+unsigned long TSrvCfgAddrClass::getMaxAllocSteps()
+{
+    if (!Permute_)
+        return SERVER_MAX_IA_RANDOM_TRIES;
+    if (Permutation_.getLast() >= SERVER_MAX_IA_PERMUTATION_STEPS - 1)
+        return SERVER_MAX_IA_PERMUTATION_STEPS;
+    return (unsigned long)Permutation_.getLast() + 1;
+}
+
 SPtr<TIPv6Addr> TSrvCfgAddrClass::getFirstAddr() {
 	return Pool_->getAddrL();
 }
@@ -240,17 +275,23 @@ unsigned long TSrvCfgAddrClass::getShare() {
 }
 
 long TSrvCfgAddrClass::incrAssigned(int count) {
-    AddrsAssigned_ += count;
-    return AddrsAssigned_;
+    return AddrsAssigned_.add(count);
 }
 
 long TSrvCfgAddrClass::decrAssigned(int count) {
-    AddrsAssigned_ -= count;
-    return AddrsAssigned_;
+    return AddrsAssigned_.sub(count);
 }
 
 unsigned long TSrvCfgAddrClass::getAssignedCount() {
-    return AddrsAssigned_;
+    return AddrsAssigned_.get();
+}
+
+/// returns number of addresses that still may be assigned from this class
+unsigned long TSrvCfgAddrClass::getFreeCount() {
+    unsigned long assigned = AddrsAssigned_.get();
+    if (assigned >= ClassMaxLease_)
+        return 0;
+    return ClassMaxLease_ - assigned;
 }
 
 bool TSrvCfgAddrClass::isLinkLocal() {
@@ -293,7 +334,7 @@ ostream& operator<<(ostream& out,TSrvCfgAddrClass& addrClass)
 {
     out << "    <class id=\"" << addrClass.ID_ << "\" share=\"" << addrClass.Share_ << "\">" << std::endl;
     out << "      <!-- total addrs in class: " << addrClass.AddrsCount_
-        << ", addrs assigned: " << addrClass.AddrsAssigned_ << " -->" << endl;
+        << ", addrs assigned: " << addrClass.AddrsAssigned_.get() << " -->" << endl;
     out << "      <T1 min=\"" << addrClass.T1Min_ << "\" max=\"" << addrClass.T1Max_  << "\" />" << endl;
     out << "      <T2 min=\"" << addrClass.T2Min_ << "\" max=\"" << addrClass.T2Max_  << "\" />" << endl;
     out << "      <pref min=\"" << addrClass.PrefMin_ << "\" max=\""<< addrClass.PrefMax_  << "\" />" <<endl;
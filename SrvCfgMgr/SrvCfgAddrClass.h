@@ -27,6 +27,8 @@ class TSrvCfgAddrClass;
 #include "SmartPtr.h"
 #include "SrvOptAddrParams.h"
 #include "SrvCfgClientClass.h"
+#include "Permutation.h"
+#include "Atomic.h"
 
 class TSrvCfgAddrClass
 {
@@ -45,6 +47,8 @@ class TSrvCfgAddrClass
     bool addrInPool(SPtr<TIPv6Addr> addr);
     unsigned long countAddrInPool();
     SPtr<TIPv6Addr> getRandomAddr();
+    SPtr<TIPv6Addr> getNextAddr();
+    unsigned long getMaxAllocSteps();
     SPtr<TIPv6Addr> getFirstAddr();
     SPtr<TIPv6Addr> getLastAddr();
 
@@ -59,6 +63,7 @@ class TSrvCfgAddrClass
     bool isLinkLocal();
 
     unsigned long getAssignedCount();
+    unsigned long getFreeCount();
     long incrAssigned(int count=1);
     long decrAssigned(int count=1);
 
@@ -83,9 +88,12 @@ class TSrvCfgAddrClass
 
     SPtr<THostRange> Pool_;
     unsigned long ClassMaxLease_;
-    unsigned long AddrsAssigned_;
+    TAtomicCounter AddrsAssigned_; ///< modified during packet processing
     unsigned long AddrsCount_;
 
+    bool Permute_;              ///< pool fits in permutation (up to 2^64 addresses)
+    TPermutation Permutation_;  ///< pool order used by getNextAddr()
+
     SPtr<TSrvOptAddrParams> AddrParams_; // AddrParams - experimental option
 
     // new, better white/black-list
@@ -16,6 +16,7 @@
 #include "SrvCfgPD.h"
 #include "Logger.h"
 #include "Opt.h"
+#include "OptInteger.h"
 #include "SrvMsg.h"
 #include "DNSUpdate.h"
 
@@ -218,9 +219,9 @@ void TSrvCfgIface::firstAddrClass() {
 ///
 /// @return ID of prefered pool (or -1 if there is none)
 int TSrvCfgIface::getPreferedAddrClassID(SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr) {
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    SrvCfgAddrClassLst_.first();
-    while(ptrClass=SrvCfgAddrClassLst_.get()) {
+    for (TAddrClassLst::const_iterator it = SrvCfgAddrClassLst_.begin();
+         it != SrvCfgAddrClassLst_.end(); ++it) {
+        SPtr<TSrvCfgAddrClass> ptrClass = *it;
         if (ptrClass->clntPrefered(duid, clntAddr)) {
             return ptrClass->getID();
         }
@@ -243,9 +244,9 @@ int TSrvCfgIface::getAllowedAddrClassID(SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAd
 
     /// @todo Buffer overflow for more than 100 classes
 
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    SrvCfgAddrClassLst_.first();
-    while( (ptrClass=SrvCfgAddrClassLst_.get()) && (cnt<100) ) {
+    for (TAddrClassLst::const_iterator it = SrvCfgAddrClassLst_.begin();
+         it != SrvCfgAddrClassLst_.end() && (cnt<100); ++it) {
+        SPtr<TSrvCfgAddrClass> ptrClass = *it;
         if (ptrClass->clntSupported(duid, clntAddr) &&
             ptrClass->getClassMaxLease() > ptrClass->getAssignedCount()) {
             clsid[cnt]   = ptrClass->getID();
@@ -283,6 +284,9 @@ bool TSrvCfgIface::supportPrefixDelegation() const {
 
 void TSrvCfgIface::addTA(SPtr<TSrvCfgTA> ta) {
     SrvCfgTALst_.append(ta);
+    SPtr<THostRange> pool = ta->getPool();
+    if (pool)
+        TaPoolTable_.add(pool->getAddrL(), pool->getAddrR());
 }
 
 void TSrvCfgIface::firstTA() {
@@ -293,24 +297,28 @@ SPtr<TSrvCfgTA> TSrvCfgIface::getTA() {
 }
 
 void TSrvCfgIface::addPD(SPtr<TSrvCfgPD> pd) {
+    unsigned long pos = SrvCfgPDLst_.count();
     SrvCfgPDLst_.append(pd);
+    PrefixesFree_.add(pd->getFreeCount());
+
+    List(THostRange) pools = pd->getPoolLst();
+    SPtr<THostRange> pool;
+    pools.first();
+    while (pool = pools.get())
+        PdPoolTable_.add(pool->getAddrL(), pool->getAddrR(), pos);
 }
 
 SPtr<TSrvCfgTA> TSrvCfgIface::getTA(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr) {
-    SPtr<TSrvCfgTA> ta;
-
     // try to find preferred TA for this client
-    SrvCfgTALst_.first();
-    while ( ta = getTA() ) {
-        if (ta->clntPrefered(clntDuid, clntAddr))
-            return ta;
+    for (TTALst::const_iterator it = SrvCfgTALst_.begin(); it != SrvCfgTALst_.end(); ++it) {
+        if ((*it)->clntPrefered(clntDuid, clntAddr))
+            return *it;
     }
 
     // prefered not found? Then find first allowed
-    SrvCfgTALst_.first();
-    while ( ta = getTA() ) {
-        if (ta->clntSupported(clntDuid, clntAddr))
-            return ta;
+    for (TTALst::const_iterator it = SrvCfgTALst_.begin(); it != SrvCfgTALst_.end(); ++it) {
+        if ((*it)->clntSupported(clntDuid, clntAddr))
+            return *it;
     }
 
     return SPtr<TSrvCfgTA>(); // NULL
@@ -321,47 +329,59 @@ SPtr<TSrvCfgAddrClass> TSrvCfgIface::getAddrClass() {
 }
 
 SPtr<TSrvCfgAddrClass> TSrvCfgIface::getClassByID(unsigned long id) {
-    firstAddrClass();
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    while (ptrClass = getAddrClass()) {
+    for (TAddrClassLst::const_iterator it = SrvCfgAddrClassLst_.begin();
+         it != SrvCfgAddrClassLst_.end(); ++it) {
+        SPtr<TSrvCfgAddrClass> ptrClass = *it;
         if (ptrClass->getID() == id)
             return ptrClass;
     }
     return SPtr<TSrvCfgAddrClass>(); // NULL
 }
 
+/// @brief returns first class (in config order) whose pool contains the address
+///
+/// @param addr address to look for
+///
+/// @return class (or NULL if address is outside of all pools)
+SPtr<TSrvCfgAddrClass> TSrvCfgIface::getClassByAddr(SPtr<TIPv6Addr> addr) const {
+    unsigned long pos;
+    if (!addr || !AddrPoolTable_.find(addr, pos) || pos >= SrvCfgAddrClassLst_.count())
+        return SPtr<TSrvCfgAddrClass>(); // NULL
+    return *(SrvCfgAddrClassLst_.begin() + pos);
+}
+
 void TSrvCfgIface::addClntAddr(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false*/) {
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    firstAddrClass();
-    while (ptrClass = getAddrClass() ) {
-        if (ptrClass->addrInPool(ptrAddr)) {
-            unsigned int count = ptrClass->incrAssigned();
-            if (quiet)
-                return;
-            Log(Debug) << "Address usage for class " << ptrClass->getID()
-                       << " increased to " << count << "." << LogEnd;
-            return;
-        }
+    SPtr<TSrvCfgAddrClass> ptrClass = getClassByAddr(ptrAddr);
+    if (!ptrClass) {
+        Log(Warning) << "Unable to increase address usage: no class found for "
+                     << *ptrAddr << LogEnd;
+        return;
     }
-    Log(Warning) << "Unable to increase address usage: no class found for "
-                 << *ptrAddr << LogEnd;
+    unsigned long freeCnt = ptrClass->getFreeCount();
+    unsigned int count = ptrClass->incrAssigned();
+    AddrsFree_.sub(freeCnt - ptrClass->getFreeCount());
+    AddrsAssigned_.add();
+    if (quiet)
+        return;
+    Log(Debug) << "Address usage for class " << ptrClass->getID()
+               << " increased to " << count << "." << LogEnd;
 }
 
 void TSrvCfgIface::delClntAddr(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false*/) {
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    firstAddrClass();
-    while (ptrClass = getAddrClass() ) {
-        if (ptrClass->addrInPool(ptrAddr)) {
-            unsigned long count = ptrClass->decrAssigned();
-            if (quiet)
-                return;
-            Log(Debug) << "Address usage for class " << ptrClass->getID()
-                       << " decreased to " << count << "." << LogEnd;
-            return;
-        }
+    SPtr<TSrvCfgAddrClass> ptrClass = getClassByAddr(ptrAddr);
+    if (!ptrClass) {
+        Log(Warning) << "Unable to decrease address usage: no class found for "
+                     << *ptrAddr << LogEnd;
+        return;
     }
-    Log(Warning) << "Unable to decrease address usage: no class found for "
-                 << *ptrAddr << LogEnd;
+    unsigned long freeCnt = ptrClass->getFreeCount();
+    unsigned long count = ptrClass->decrAssigned();
+    AddrsFree_.add(ptrClass->getFreeCount() - freeCnt);
+    AddrsAssigned_.sub();
+    if (quiet)
+        return;
+    Log(Debug) << "Address usage for class " << ptrClass->getID()
+               << " decreased to " << count << "." << LogEnd;
 }
 
 SPtr<TSrvCfgAddrClass> TSrvCfgIface::getRandomClass(SPtr<TDUID> clntDuid,
@@ -393,6 +413,21 @@ SPtr<TSrvCfgAddrClass> TSrvCfgIface::getRandomClass(SPtr<TDUID> clntDuid,
     return SPtr<TSrvCfgAddrClass>(); // NULL
 }
 
+/// @brief checks if any class supports this client (full classes included)
+///
+/// @param clntDuid client's DUID
+/// @param clntAddr client's link-local address
+///
+/// @return true if client is allowed to use at least one class
+bool TSrvCfgIface::addrClassAllowed(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr) {
+    for (TAddrClassLst::const_iterator it = SrvCfgAddrClassLst_.begin();
+         it != SrvCfgAddrClassLst_.end(); ++it) {
+        if ((*it)->clntSupported(clntDuid, clntAddr))
+            return true;
+    }
+    return false;
+}
+
 long TSrvCfgIface::countAddrClass() const {
     return SrvCfgAddrClassLst_.count();
 }
@@ -402,49 +437,59 @@ SPtr<TSrvCfgPD> TSrvCfgIface::getPD() {
 }
 
 SPtr<TSrvCfgPD> TSrvCfgIface::getPDByID(unsigned long id) {
-    firstPD();
-    SPtr<TSrvCfgPD> ptrPD;
-    while (ptrPD = getPD()) {
+    for (TPDLst::const_iterator it = SrvCfgPDLst_.begin();
+         it != SrvCfgPDLst_.end(); ++it) {
+        SPtr<TSrvCfgPD> ptrPD = *it;
         if (ptrPD->getID() == id)
             return ptrPD;
     }
     return SPtr<TSrvCfgPD>(); // NULL
 }
 
+/// @brief returns first PD class (in config order) whose pools contain the prefix
+///
+/// @param prefix prefix to look for
+///
+/// @return PD class (or NULL if prefix is outside of all pools)
+SPtr<TSrvCfgPD> TSrvCfgIface::getPDByPrefix(SPtr<TIPv6Addr> prefix) {
+    unsigned long pos;
+    if (!prefix || !PdPoolTable_.find(prefix, pos) || pos >= SrvCfgPDLst_.count())
+        return SPtr<TSrvCfgPD>(); // NULL
+    return *(SrvCfgPDLst_.begin() + pos);
+}
+
 bool TSrvCfgIface::addClntPrefix(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false */) {
-    SPtr<TSrvCfgPD> ptrPD;
-    firstPD();
-    while (ptrPD = getPD() ) {
-        if (ptrPD->prefixInPool(ptrAddr)) {
-            unsigned long count = ptrPD->incrAssigned();
-            if (quiet)
-                return true;
-            Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
-                       << " increased to " << count << "." << LogEnd;
-            return true;
-        }
+    SPtr<TSrvCfgPD> ptrPD = getPDByPrefix(ptrAddr);
+    if (!ptrPD) {
+        Log(Warning) << "Unable to increase prefix usage: no prefix found for "
+                     << *ptrAddr << LogEnd;
+        return false;
     }
-    Log(Warning) << "Unable to increase prefix usage: no prefix found for "
-                 << *ptrAddr << LogEnd;
-    return false;
+    unsigned long freeCnt = ptrPD->getFreeCount();
+    unsigned long count = ptrPD->incrAssigned();
+    PrefixesFree_.sub(freeCnt - ptrPD->getFreeCount());
+    if (quiet)
+        return true;
+    Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
+               << " increased to " << count << "." << LogEnd;
+    return true;
 }
 
 bool TSrvCfgIface::delClntPrefix(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false */) {
-    SPtr<TSrvCfgPD> ptrPD;
-    firstPD();
-    while (ptrPD = getPD() ) {
-        if (ptrPD->prefixInPool(ptrAddr)) {
-            unsigned long count = ptrPD->decrAssigned();
-            if (quiet)
-                return true;
-            Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
-                       << " decreased to " << count << "." << LogEnd;
-            return true;
-        }
+    SPtr<TSrvCfgPD> ptrPD = getPDByPrefix(ptrAddr);
+    if (!ptrPD) {
+        Log(Warning) << "Unable to decrease address usage: no class found for "
+                     << *ptrAddr << LogEnd;
+        return false;
     }
-    Log(Warning) << "Unable to decrease address usage: no class found for "
-                 << *ptrAddr << LogEnd;
-    return false;
+    unsigned long freeCnt = ptrPD->getFreeCount();
+    unsigned long count = ptrPD->decrAssigned();
+    PrefixesFree_.add(ptrPD->getFreeCount() - freeCnt);
+    if (quiet)
+        return true;
+    Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
+               << " decreased to " << count << "." << LogEnd;
+    return true;
 }
 
 long TSrvCfgIface::countPD() const {
@@ -528,6 +573,10 @@ void TSrvCfgIface::setOptions(SPtr<TSrvParsGlobalOpt> opt) {
     }
 
     TSrvCfgOptions::setOptions(opt);
+
+    // values were validated by the parser
+    setSolMaxRT(opt->getSolMaxRT());
+    setInfMaxRT(opt->getInfMaxRT());
 }
 
 TSrvCfgIface::TSrvCfgIface(int ifindex) {
@@ -565,6 +614,13 @@ void TSrvCfgIface::setDefaults() {
     PrefMax_  = SERVER_DEFAULT_MAX_PREF;
     ValidMin_ = SERVER_DEFAULT_MIN_VALID;
     ValidMax_ = SERVER_DEFAULT_MAX_VALID;
+
+    SolMaxRT_ = 0;
+    InfMaxRT_ = 0;
+
+    AddrsAssigned_.set(0);
+    AddrsFree_.set(0);
+    PrefixesFree_.set(0);
 }
 
 void TSrvCfgIface::setNoConfig() {
@@ -589,7 +645,10 @@ bool TSrvCfgIface::getRapidCommit() const {
 
 
 void TSrvCfgIface::addAddrClass(SPtr<TSrvCfgAddrClass> addrClass) {
+    unsigned long pos = SrvCfgAddrClassLst_.count();
     SrvCfgAddrClassLst_.append(addrClass);
+    AddrsFree_.add(addrClass->getFreeCount());
+    AddrPoolTable_.add(addrClass->getFirstAddr(), addrClass->getLastAddr(), pos);
 }
 
 long TSrvCfgIface::getIfaceMaxLease() const {
@@ -786,6 +845,85 @@ void TSrvCfgIface::setRevDNSZoneRootLength(int revDNSZoneRootLength){
     RevDNSZoneRootLength_ = revDNSZoneRootLength;
 }
 
+/// @brief sets value of SOL_MAX_RT option sent to clients (if requested)
+///
+/// @param maxRT max. SOLICIT retransmission timeout (in seconds, 0 disables the option)
+///
+/// @return false if the value is out of range (60..86400)
+bool TSrvCfgIface::setSolMaxRT(uint32_t maxRT) {
+    if (maxRT && (maxRT < MAX_RT_OPTION_MIN || maxRT > MAX_RT_OPTION_MAX)) {
+        Log(Warning) << "Invalid SOL_MAX_RT value " << maxRT << " on " << getFullName()
+                     << ", allowed range is " << MAX_RT_OPTION_MIN << "-" << MAX_RT_OPTION_MAX
+                     << "." << LogEnd;
+        return false;
+    }
+    SolMaxRT_ = maxRT;
+    delExtraOption(OPTION_SOL_MAX_RT);
+    if (maxRT)
+        addExtraOption(new TOptInteger(OPTION_SOL_MAX_RT, OPTION_SOL_MAX_RT_LEN, maxRT, NULL), false);
+    return true;
+}
+
+/// @brief sets value of INF_MAX_RT option sent to clients (if requested)
+///
+/// @param maxRT max. INF-REQUEST retransmission timeout (in seconds, 0 disables the option)
+///
+/// @return false if the value is out of range (60..86400)
+bool TSrvCfgIface::setInfMaxRT(uint32_t maxRT) {
+    if (maxRT && (maxRT < MAX_RT_OPTION_MIN || maxRT > MAX_RT_OPTION_MAX)) {
+        Log(Warning) << "Invalid INF_MAX_RT value " << maxRT << " on " << getFullName()
+                     << ", allowed range is " << MAX_RT_OPTION_MIN << "-" << MAX_RT_OPTION_MAX
+                     << "." << LogEnd;
+        return false;
+    }
+    InfMaxRT_ = maxRT;
+    delExtraOption(OPTION_INF_MAX_RT);
+    if (maxRT)
+        addExtraOption(new TOptInteger(OPTION_INF_MAX_RT, OPTION_INF_MAX_RT_LEN, maxRT, NULL), false);
+    return true;
+}
+
+/// @brief returns number of addresses that still may be assigned on this interface
+///
+/// Kept up to date by addClntAddr()/delClntAddr(), so this is O(1).
+/// Class and interface limits (class-max-lease, iface-max-lease) are honoured.
+unsigned long TSrvCfgIface::getFreeAddrCount() const {
+    unsigned long assigned = AddrsAssigned_.get();
+    if (assigned >= IfaceMaxLease_)
+        return 0;
+    unsigned long ifaceFree = IfaceMaxLease_ - assigned;
+    unsigned long classFree = AddrsFree_.get();
+    return classFree < ifaceFree ? classFree : ifaceFree;
+}
+
+/// returns number of prefixes that still may be delegated on this interface
+unsigned long TSrvCfgIface::getFreePrefixCount() const {
+    return PrefixesFree_.get();
+}
+
+/// @brief checks if all address pools on this interface are full
+///
+/// Used to refuse new address leases quickly (without trying random
+/// addresses) and to tell clients to back off.
+///
+/// @return true if there are pools defined and none of them has free leases
+bool TSrvCfgIface::addrPoolsExhausted() const {
+    return SrvCfgAddrClassLst_.count() && !getFreeAddrCount();
+}
+
+/// returns true if there are PD pools, but none of them can delegate anything
+bool TSrvCfgIface::prefixPoolsExhausted() const {
+    return SrvCfgPDLst_.count() && !PrefixesFree_.get();
+}
+
+uint32_t TSrvCfgIface::getSolMaxRT() const {
+    return SolMaxRT_;
+}
+
+uint32_t TSrvCfgIface::getInfMaxRT() const {
+    return InfMaxRT_;
+}
+
 string TSrvCfgIface::getFQDNModeString() const {
     switch (FQDNMode_) {
     case 0:  return "updates disabled";
@@ -797,9 +935,7 @@ string TSrvCfgIface::getFQDNModeString() const {
 
 
 void TSrvCfgIface::addTAAddr() {
-    SPtr<TSrvCfgTA> ta;
-    firstTA();
-    ta = getTA();
+    SPtr<TSrvCfgTA> ta = SrvCfgTALst_.getFirst();
     if (!ta) {
         Log(Error) << "Unable to increase TA usage. TA (temporary addresses) is not found on the "
                    << getFullName() << " interface." << LogEnd;
@@ -809,9 +945,7 @@ void TSrvCfgIface::addTAAddr() {
 }
 
 void TSrvCfgIface::delTAAddr() {
-    SPtr<TSrvCfgTA> ta;
-    firstTA();
-    ta = getTA();
+    SPtr<TSrvCfgTA> ta = SrvCfgTALst_.getFirst();
     if (!ta) {
         Log(Error) << "Unable to decrease TA usage. TA (temporary addresses) is not found on the "
                    << getFullName() << " interface." << LogEnd;
@@ -822,16 +956,11 @@ void TSrvCfgIface::delTAAddr() {
 
 void TSrvCfgIface::addSubnet(SPtr<TIPv6Addr> min, SPtr<TIPv6Addr> max) {
     Subnets_.push_back(THostRange(min, max));
+    SubnetTable_.add(min, max);
 }
 
 bool TSrvCfgIface::addrInSubnet(SPtr<TIPv6Addr> addr) {
-    for (std::vector<THostRange>::const_iterator range = Subnets_.begin();
-         range != Subnets_.end(); ++range) {
-        if (range->in(addr)) {
-            return true;
-        }
-    }
-    return false;
+    return SubnetTable_.in(addr);
 }
 
 bool TSrvCfgIface::subnetDefined() {
@@ -993,22 +1122,22 @@ ostream& operator<<(ostream& out,TSrvCfgIface& iface) {
 void TSrvCfgIface::mapAllowDenyList( List(TSrvCfgClientClass) clientClassLst)
 {
     //  Log(Info)<<"Mapping allow, deny list inside interface "<<Name<<LogEnd;
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    SrvCfgAddrClassLst_.first();
-    while(ptrClass = SrvCfgAddrClassLst_.get()){
+    for (TAddrClassLst::const_iterator it = SrvCfgAddrClassLst_.begin();
+         it != SrvCfgAddrClassLst_.end(); ++it) {
+        SPtr<TSrvCfgAddrClass> ptrClass = *it;
         ptrClass->mapAllowDenyList(clientClassLst);
     }
 
     // Map the Allow and Deny list to TA c
-    SPtr<TSrvCfgTA> ptrTA;
-    SrvCfgTALst_.first();
-    while(ptrTA = SrvCfgTALst_.get()){
+    for (TTALst::const_iterator it = SrvCfgTALst_.begin();
+         it != SrvCfgTALst_.end(); ++it) {
+        SPtr<TSrvCfgTA> ptrTA = *it;
         ptrTA->mapAllowDenyList(clientClassLst);
     }
     // Map the Allow and Deny list to prefix
-    SPtr<TSrvCfgPD> ptrPD;
-    SrvCfgPDLst_.first();
-    while(ptrPD = SrvCfgPDLst_.get()){
+    for (TPDLst::const_iterator it = SrvCfgPDLst_.begin();
+         it != SrvCfgPDLst_.end(); ++it) {
+        SPtr<TSrvCfgPD> ptrPD = *it;
         ptrPD->mapAllowDenyList(clientClassLst);
     }
 }
@@ -1096,54 +1225,30 @@ EAddrStatus TSrvCfgIface::confirmAddress(TIAType type, SPtr<TIPv6Addr> addr) {
     }
 }
 
-/// checks if address is in NA pool
+/// checks if address is in any NA pool
 ///
 /// @param addr address to be checked
 ///
 /// @return true if in pool, false otherwise
 bool TSrvCfgIface::addrInPool(SPtr<TIPv6Addr> addr) {
-    firstAddrClass();
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    bool inPool = false;
-    while (ptrClass = getAddrClass()) {
-        inPool = ptrClass->addrInPool(addr);
-        if (!inPool)
-            return false;
-    }
-    return inPool;
+    return addr && AddrPoolTable_.in(addr);
 }
 
-/// checks if address is in TA pool
+/// checks if address is in any TA pool
 ///
 /// @param addr address to be checked
 ///
 /// @return true if in pool, false otherwise
 bool TSrvCfgIface::addrInTaPool(SPtr<TIPv6Addr> addr) {
-    firstTA();
-    SPtr<TSrvCfgTA> ptrClass;
-    bool inPool = false;
-    while (ptrClass = getTA()) {
-        inPool = ptrClass->addrInPool(addr);
-        if (!inPool)
-            return false;
-    }
-    return inPool;
+    return addr && TaPoolTable_.in(addr);
 }
 
-/// checks if prefix is in PD pool
+/// checks if prefix is in any PD pool
 ///
 /// @param prefix prefix to be checked
 ///
 /// @return true if in pool, false otherwise
 bool TSrvCfgIface::prefixInPdPool(SPtr<TIPv6Addr> prefix) {
-    firstPD();
-    SPtr<TSrvCfgPD> ptrClass;
-    bool inPool = false;
-    while (ptrClass = getPD()) {
-        inPool = ptrClass->prefixInPool(prefix);
-        if (!inPool)
-            return false;
-    }
-    return inPool;
+    return prefix && PdPoolTable_.in(prefix);
 }
 
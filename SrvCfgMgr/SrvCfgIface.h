@@ -23,6 +23,7 @@ class TSrvCfgIface;
 #include <vector>
 #include "OptVendorSpecInfo.h"
 #include "SrvCfgOptions.h"
+#include "AddrRangeTable.h"
 
 class TSrvCfgIface: public TSrvCfgOptions
 {
@@ -46,7 +47,9 @@ public:
 
     SPtr<TSrvCfgAddrClass> getAddrClass();
     SPtr<TSrvCfgAddrClass> getClassByID(unsigned long id);
+    SPtr<TSrvCfgAddrClass> getClassByAddr(SPtr<TIPv6Addr> addr) const;
     SPtr<TSrvCfgAddrClass> getRandomClass(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr);
+    bool addrClassAllowed(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr);
     long countAddrClass() const;
 
     // temporary address management (IA_TA)
@@ -58,6 +61,7 @@ public:
     // prefix management (IA_PD)
     void addPDClass(SPtr<TSrvCfgPD> PDClass);
     SPtr<TSrvCfgPD> getPDByID(unsigned long id);
+    SPtr<TSrvCfgPD> getPDByPrefix(SPtr<TIPv6Addr> prefix);
     //SPtr<TSrvCfgPD> getRandomPrefix(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr);
     long countPD() const;
     void addPD(SPtr<TSrvCfgPD> pd);
@@ -70,6 +74,10 @@ public:
     // CONFIRM support
     EAddrStatus confirmAddress(TIAType type, SPtr<TIPv6Addr> addr);
     bool addrInPool(SPtr<TIPv6Addr> addr);
+    bool addrPoolsExhausted() const;
+    bool prefixPoolsExhausted() const;
+    unsigned long getFreeAddrCount() const;
+    unsigned long getFreePrefixCount() const;
     bool addrInTaPool(SPtr<TIPv6Addr> addr);
     bool prefixInPdPool(SPtr<TIPv6Addr> addr);
 
@@ -137,6 +145,12 @@ public:
     uint32_t getT2(uint32_t proposal);
     uint32_t getPref(uint32_t proposal);
     uint32_t getValid(uint32_t proposal);
+
+    // option: SOL_MAX_RT, INF_MAX_RT (RFC8415)
+    bool setSolMaxRT(uint32_t maxRT);
+    bool setInfMaxRT(uint32_t maxRT);
+    uint32_t getSolMaxRT() const;
+    uint32_t getInfMaxRT() const;
 private:
     uint32_t chooseTime(uint32_t min, uint32_t max, uint32_t proposal);
 
@@ -148,18 +162,28 @@ private:
     unsigned long IfaceMaxLease_;
     unsigned long ClntMaxLease_;
     bool RapidCommit_;
-    List(TSrvCfgAddrClass) SrvCfgAddrClassLst_; // IA_NA list (normal addresses)
+    typedef SmallList(TSrvCfgAddrClass) TAddrClassLst;
+    typedef SmallList(TSrvCfgTA) TTALst;
+    typedef SmallList(TSrvCfgPD) TPDLst;
+
+    TAddrClassLst SrvCfgAddrClassLst_; // IA_NA list (normal addresses)
     bool LeaseQuery_;
 
     // --- Temporary Addresses ---
-    List(TSrvCfgTA) SrvCfgTALst_; // IA_TA list (temporary addresses)
+    TTALst SrvCfgTALst_; // IA_TA list (temporary addresses)
 
     // --- Prefix Delegation ---
-    List(TSrvCfgPD) SrvCfgPDLst_;
+    TPDLst SrvCfgPDLst_;
 
     // --- subnets ---
     std::vector<THostRange> Subnets_;
 
+    // --- range tables for pool and subnet lookups ---
+    TAddrRangeTable SubnetTable_;
+    TAddrRangeTable AddrPoolTable_; // tagged with class position in SrvCfgAddrClassLst_
+    TAddrRangeTable TaPoolTable_;
+    TAddrRangeTable PdPoolTable_;   // tagged with PD position in SrvCfgPDLst_
+
     // --- relay ---
     bool Relay_;
     std::string RelayName_;     // name of the underlaying physical interface (or other relay)
@@ -183,6 +207,15 @@ private:
     uint32_t PrefMax_;
     uint32_t ValidMin_;
     uint32_t ValidMax_;
+
+    // --- SOL_MAX_RT, INF_MAX_RT (0 means not sent) ---
+    uint32_t SolMaxRT_;
+    uint32_t InfMaxRT_;
+
+    // --- usage counters (see getFreeAddrCount()), modified during packet processing ---
+    TAtomicCounter AddrsAssigned_; // addresses assigned from all classes
+    TAtomicCounter AddrsFree_;     // sum of free counts of all classes
+    TAtomicCounter PrefixesFree_;  // sum of free counts of all PD pools
 };
 
 #endif /* SRVCONFIFACE_H */
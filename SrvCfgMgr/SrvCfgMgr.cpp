@@ -38,9 +38,18 @@ int TSrvCfgMgr::NextRelayID = RELAY_MIN_IFINDEX;
 
 TSrvCfgMgr::TSrvCfgMgr(const std::string& cfgFile, const std::string& xmlFile)
     :TCfgMgr(), XmlFile(xmlFile), Reconfigure_(false), PerformanceMode_(false),
-     DropUnicast_(false)
+     DropUnicast_(false),
+     AddrPermutation_(SERVER_DEFAULT_ADDR_PERMUTATION),
+     LeaseReuse_(SERVER_DEFAULT_LEASE_REUSE),
+     ReplyCacheTTL_(SERVER_DEFAULT_REPLY_CACHE_TTL),
+     ReplyCacheSize_(SERVER_DEFAULT_REPLY_CACHE_SIZE),
+     RenewTemplates_(SERVER_DEFAULT_RENEW_TEMPLATES), DeclineHoldTime_(DECLINED_TIMEOUT),
+     DeclineMaxShare_(SERVER_DEFAULT_DECLINE_MAX_SHARE), LeaseSyncPrimary_(false),
+     LeaseSyncPort_(SERVER_DEFAULT_LEASE_SYNC_PORT),
+     TAMemoryOnly_(SERVER_DEFAULT_TA_MEMORY_ONLY)
 {
     setDefaults();
+    publishSnapshot(); // no interfaces yet
 
     // load config file
     if (!this->parseConfigFile(cfgFile)) {
@@ -272,6 +281,7 @@ SPtr<TSrvCfgIface> TSrvCfgMgr::getIface() {
 
 void TSrvCfgMgr::addIface(SPtr<TSrvCfgIface> ptr) {
     SrvCfgIfaceLst.append(ptr);
+    publishSnapshot();
 }
 
 /**
@@ -281,16 +291,15 @@ void TSrvCfgMgr::addIface(SPtr<TSrvCfgIface> ptr) {
  * @param inactive true for makeing inactive, false for makeing active
  */
 void TSrvCfgMgr::makeInactiveIface(int ifindex, bool inactive) {
-    SPtr<TSrvCfgIface> x;
-
     if (inactive)
     {
-        SrvCfgIfaceLst.first();
-        while (x= SrvCfgIfaceLst.get()) {
+        for (TIfaceLst::iterator it = SrvCfgIfaceLst.begin(); it != SrvCfgIfaceLst.end(); ++it) {
+            SPtr<TSrvCfgIface> x = *it;
             if (x->getID() == ifindex) {
                 Log(Info) << "Switching " << x->getFullName() << " to inactive-mode." << LogEnd;
-                SrvCfgIfaceLst.del();
+                SrvCfgIfaceLst.erase(it);
                 InactiveLst.append(x);
+                publishSnapshot();
                 return;
             }
         }
@@ -300,12 +309,11 @@ void TSrvCfgMgr::makeInactiveIface(int ifindex, bool inactive) {
 
     else
     {
-        InactiveLst.first();
-        while (x= InactiveLst.get()) {
+        for (TIfaceLst::iterator it = InactiveLst.begin(); it != InactiveLst.end(); ++it) {
+            SPtr<TSrvCfgIface> x = *it;
             if (x->getID() == ifindex) {
                 Log(Info) << "Switching " << x->getFullName() << " to normal mode." << LogEnd;
-                InactiveLst.del();
-                InactiveLst.first();
+                InactiveLst.erase(it);
                 addIface(x);
                 return;
             }
@@ -375,6 +383,50 @@ SPtr<TSrvCfgIface> TSrvCfgMgr::checkInactiveIfaces() {
     return SPtr<TSrvCfgIface>(); // NULL
 }
 
+/// @brief returns active interfaces, as last published
+///
+/// Doesn't take any locks. Pointer stays valid until the next publishSnapshot(),
+/// or, for registered readers, until their next quiescent().
+const TSrvCfgSnapshot* TSrvCfgMgr::getSnapshot() {
+    return Snapshot_.get();
+}
+
+/// @brief makes current set of active interfaces visible to readers
+///
+/// Called whenever interface is added or moved to/from inactive list.
+/// Must not be called concurrently with itself.
+void TSrvCfgMgr::publishSnapshot() {
+    TSrvCfgSnapshot::TIfaceVector ifaces(SrvCfgIfaceLst.begin(), SrvCfgIfaceLst.end());
+    Snapshot_.publish(new TSrvCfgSnapshot(ifaces));
+}
+
+/// @brief registers a thread that will use snapshots
+///
+/// @return reader id (to be passed to quiescent()), -1 if there are too many readers
+int TSrvCfgMgr::registerReader() {
+    return Snapshot_.registerReader();
+}
+
+void TSrvCfgMgr::unregisterReader(int reader) {
+    Snapshot_.unregisterReader(reader);
+}
+
+/// @brief tells that reader doesn't use any snapshot at the moment
+///
+/// Snapshots replaced in the meantime are freed (by reclaimSnapshots() or
+/// the next publishSnapshot()) once all readers passed this point.
+void TSrvCfgMgr::quiescent(int reader) {
+    Snapshot_.quiescent(reader);
+}
+
+/// @brief frees replaced snapshots that are no longer used
+///
+/// Must be called by the thread that publishes snapshots.
+///
+/// @return number of replaced snapshots still in use
+size_t TSrvCfgMgr::reclaimSnapshots() {
+    return Snapshot_.reclaim();
+}
 
 TSrvCfgMgr::~TSrvCfgMgr() {
     Log(Debug) << "SrvCfgMgr cleanup." << LogEnd;
@@ -440,7 +492,6 @@ long TSrvCfgMgr::countAvailAddrs(SPtr<TDUID> clntDuid,
  */
 SPtr<TSrvCfgAddrClass> TSrvCfgMgr::getClassByAddr(int iface, SPtr<TIPv6Addr> addr)
 {
-    this->firstIface();
     SPtr<TSrvCfgIface> ptrIface;
     ptrIface = this->getIfaceByID(iface);
 
@@ -449,14 +500,7 @@ SPtr<TSrvCfgAddrClass> TSrvCfgMgr::getClassByAddr(int iface, SPtr<TIPv6Addr> add
         return SPtr<TSrvCfgAddrClass>(); // NULL
     }
 
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    ptrIface->firstAddrClass();
-    while (ptrClass = ptrIface->getAddrClass()) {
-        if (ptrClass->addrInPool(addr))
-            return ptrClass;
-    }
-
-    return SPtr<TSrvCfgAddrClass>(); // NULL
+    return ptrIface->getClassByAddr(addr);
 }
 
 /**
@@ -469,7 +513,6 @@ SPtr<TSrvCfgAddrClass> TSrvCfgMgr::getClassByAddr(int iface, SPtr<TIPv6Addr> add
  */
 SPtr<TSrvCfgPD> TSrvCfgMgr::getClassByPrefix(int iface, SPtr<TIPv6Addr> addr)
 {
-    this->firstIface();
     SPtr<TSrvCfgIface> ptrIface;
     ptrIface = this->getIfaceByID(iface);
 
@@ -478,14 +521,7 @@ SPtr<TSrvCfgPD> TSrvCfgMgr::getClassByPrefix(int iface, SPtr<TIPv6Addr> addr)
         return SPtr<TSrvCfgPD>();
     }
 
-    SPtr<TSrvCfgPD> ptrClass;
-    ptrIface->firstPD();
-    while (ptrClass = ptrIface->getPD()) {
-        if (ptrClass->prefixInPool(addr))
-            return ptrClass;
-    }
-
-    return SPtr<TSrvCfgPD>();
+    return ptrIface->getPDByPrefix(addr);
 }
 
 
@@ -529,9 +565,11 @@ bool TSrvCfgMgr::isClntSupported(SPtr<TSrvMsg> msg) {
         duid = clientId->getDUID();
     }
 
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    TSrvCfgSnapshot::const_iterator it = cfg->findByID(iface);
     SPtr<TSrvCfgIface> ptrIface;
-    firstIface();
-    while((ptrIface=getIface())&&(ptrIface->getID()!=iface)) ;
+    if (it != cfg->end())
+        ptrIface = *it;
 
     /** @todo: reject-client and accept-only does not work in stateless mode */
     if (this->stateless())
@@ -568,6 +606,11 @@ bool TSrvCfgMgr::isClntSupported(SPtr<TSrvMsg> msg) {
     return false;
 }
 
+/// returns negative cache of recently rejected clients
+TSrvRejectCache& TSrvCfgMgr::getRejectCache() {
+    return RejectCache_;
+}
+
 #if 0
 /*
 * Method checks whether client is supported and assigned addresses from any class
@@ -575,8 +618,11 @@ bool TSrvCfgMgr::isClntSupported(SPtr<TSrvMsg> msg) {
 bool TSrvCfgMgr::isClntSupported(SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int iface, SPtr<TSrvMsg> msg)
 {
    SPtr<TSrvCfgIface> ptrIface;
-   firstIface();
-   while((ptrIface=getIface())&&(ptrIface->getID()!=iface)) ;
+   for (TIfaceLst::const_iterator it = SrvCfgIfaceLst.begin();
+        !ptrIface && it != SrvCfgIfaceLst.end(); ++it) {
+       if ((*it)->getID() == iface)
+           ptrIface = *it;
+   }
 
    /** @todo: reject-client and accept-only does not work in stateless mode */
    if (this->stateless())
@@ -608,10 +654,9 @@ bool TSrvCfgMgr::isClntSupported(SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int
 ///
 /// @return true if reserved, false otherwise
 bool TSrvCfgMgr::addrReserved(SPtr<TIPv6Addr> addr) {
-    SPtr<TSrvCfgIface> iface;
-    SrvCfgIfaceLst.first();
-    while (iface = SrvCfgIfaceLst.get()) {
-        if (iface->addrReserved(addr))
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    for (TSrvCfgSnapshot::const_iterator it = cfg->begin(); it != cfg->end(); ++it) {
+        if ((*it)->addrReserved(addr))
             return true;
     }
     return false;
@@ -623,10 +668,9 @@ bool TSrvCfgMgr::addrReserved(SPtr<TIPv6Addr> addr) {
 ///
 /// @return true if reserved, false otherwise
 bool TSrvCfgMgr::prefixReserved(SPtr<TIPv6Addr> prefix) {
-    SPtr<TSrvCfgIface> iface;
-    SrvCfgIfaceLst.first();
-    while (iface = SrvCfgIfaceLst.get()) {
-        if (iface->prefixReserved(prefix))
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    for (TSrvCfgSnapshot::const_iterator it = cfg->begin(); it != cfg->end(); ++it) {
+        if ((*it)->prefixReserved(prefix))
             return true;
     }
     return false;
@@ -719,24 +763,20 @@ bool TSrvCfgMgr::validateClass(SPtr<TSrvCfgIface> ptrIface, SPtr<TSrvCfgAddrClas
 }
 
 SPtr<TSrvCfgIface> TSrvCfgMgr::getIfaceByID(int iface) {
-    SPtr<TSrvCfgIface> ptrIface;
-    firstIface();
-    while ( ptrIface = getIface() ) {
-        if ( ptrIface->getID()==iface )
-            return ptrIface;
-    }
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    TSrvCfgSnapshot::const_iterator it = cfg->findByID(iface);
+    if (it != cfg->end())
+        return *it;
     Log(Error) << "Invalid interface (ifindex=" << iface
                << ") specifed: no such interface." << LogEnd;
     return SPtr<TSrvCfgIface>(); // NULL
 }
 
 SPtr<TSrvCfgIface> TSrvCfgMgr::getIfaceByName(const std::string& name) {
-    SPtr<TSrvCfgIface> ptrIface;
-    firstIface();
-    while ( ptrIface = getIface() ) {
-        if ( ptrIface->getName()==name ) {
-            return ptrIface;
-        }
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    for (TSrvCfgSnapshot::const_iterator it = cfg->begin(); it != cfg->end(); ++it) {
+        if ((*it)->getName() == name)
+            return *it;
     }
     Log(Error) << "Invalid interface (name=" << name
                << ") specifed: no such interface." << LogEnd;
@@ -753,6 +793,9 @@ void TSrvCfgMgr::delClntAddr(int iface, SPtr<TIPv6Addr> addr) {
         return;
     }
     ptrIface->delClntAddr(addr);
+
+    // address was released, clients refused on this interface may get it now
+    RejectCache_.clear(iface, TSrvRejectCache::REJECT_NO_CLASS);
 }
 
 void TSrvCfgMgr::addClntAddr(int iface, SPtr<TIPv6Addr> addr) {
@@ -964,10 +1007,10 @@ bool TSrvCfgMgr::getReconfigureSupport()
 
 /// @brief removes reserved entries from the cache
 void TSrvCfgMgr::removeReservedFromCache() {
-    SPtr<TSrvCfgIface> iface;
-    SrvCfgIfaceLst.first();
     unsigned int cnt = 0;
-    while (iface = SrvCfgIfaceLst.get()) {
+    for (TIfaceLst::const_iterator it = SrvCfgIfaceLst.begin();
+         it != SrvCfgIfaceLst.end(); ++it) {
+        SPtr<TSrvCfgIface> iface = *it;
         cnt += iface->removeReservedFromCache();
     }
     if (cnt) {
@@ -1113,8 +1156,9 @@ int TSrvCfgMgr::getRelayByInterfaceID(SPtr<TSrvOptInterfaceID> interfaceID) {
         return -1;
     }
 
-    firstIface();
-    while (SPtr<TSrvCfgIface> cfgIface = getIface()) {
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    for (TSrvCfgSnapshot::const_iterator it = cfg->begin(); it != cfg->end(); ++it) {
+        const SPtr<TSrvCfgIface>& cfgIface = *it;
         SPtr<TSrvOptInterfaceID> cfgIfaceID = cfgIface->getRelayInterfaceID();
         if (cfgIfaceID && (*cfgIfaceID == *interfaceID)) {
             return cfgIface->getID();
@@ -1131,10 +1175,10 @@ int TSrvCfgMgr::getRelayByInterfaceID(SPtr<TSrvOptInterfaceID> interfaceID) {
 ///
 /// @return interface index (or -1 if not found)
 int TSrvCfgMgr::getRelayByLinkAddr(SPtr<TIPv6Addr> addr) {
-    SPtr<TSrvCfgIface> cfgIface;
 
-    firstIface();
-    while (cfgIface = getIface()) {
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    for (TSrvCfgSnapshot::const_iterator it = cfg->begin(); it != cfg->end(); ++it) {
+        const SPtr<TSrvCfgIface>& cfgIface = *it;
         if (cfgIface->addrInSubnet(addr)) {
             Log(Debug) << "Address " << addr->getPlain() << " matched on interface "
                        << cfgIface->getFullName() << LogEnd;
@@ -1150,10 +1194,10 @@ int TSrvCfgMgr::getRelayByLinkAddr(SPtr<TIPv6Addr> addr) {
 ///
 /// @return interface index of the first relay (or -1 if there are no relays)
 int TSrvCfgMgr::getAnyRelay() {
-    SPtr<TSrvCfgIface> cfgIface;
 
-    firstIface();
-    while (cfgIface = getIface()) {
+    const TSrvCfgSnapshot* cfg = getSnapshot();
+    for (TSrvCfgSnapshot::const_iterator it = cfg->begin(); it != cfg->end(); ++it) {
+        const SPtr<TSrvCfgIface>& cfgIface = *it;
         if (cfgIface->isRelay()) {
             Log(Debug) << "Guess-mode: Picked " << cfgIface->getFullName() << " as relay." << LogEnd;
             return cfgIface->getID();
@@ -1223,3 +1267,130 @@ void TSrvCfgMgr::dropUnicast(bool drop) {
 bool TSrvCfgMgr::dropUnicast() {
     return DropUnicast_;
 }
+
+/// @brief selects how random addresses are chosen from address classes
+///
+/// @param permute true: walk the pool in keyed pseudo-random order, so every
+///        address is checked once before any is checked again; false: pick
+///        random addresses independently (up to SERVER_MAX_IA_RANDOM_TRIES)
+void TSrvCfgMgr::setAddrPermutation(bool permute) {
+    AddrPermutation_ = permute;
+}
+
+bool TSrvCfgMgr::getAddrPermutation() {
+    return AddrPermutation_;
+}
+
+/// @brief sets lease reuse threshold
+///
+/// Lease renewed (or rebound) before that percentage of its valid lifetime
+/// elapsed is not extended; client gets remaining lifetimes instead and
+/// lease database is not touched (see TSrvAddrMgr::leaseReusable()).
+///
+/// @param percent threshold (0 disables lease reuse)
+void TSrvCfgMgr::setLeaseReuse(unsigned int percent) {
+    if (percent > SERVER_MAX_LEASE_REUSE)
+        percent = SERVER_MAX_LEASE_REUSE;
+    LeaseReuse_ = percent;
+}
+
+unsigned int TSrvCfgMgr::getLeaseReuse() {
+    return LeaseReuse_;
+}
+
+/// @brief sets reply cache parameters (used by TSrvTransMgr)
+///
+/// @param ttl how long (in seconds) replies are remembered (0 disables cache)
+/// @param maxSize maximum number of remembered replies
+void TSrvCfgMgr::setReplyCache(unsigned int ttl, unsigned int maxSize) {
+    ReplyCacheTTL_ = ttl;
+    ReplyCacheSize_ = maxSize;
+}
+
+unsigned int TSrvCfgMgr::getReplyCacheTTL() {
+    return ReplyCacheTTL_;
+}
+
+unsigned int TSrvCfgMgr::getReplyCacheSize() {
+    return ReplyCacheSize_;
+}
+
+/// @brief sets how many RENEW/REBIND replies are kept as templates (used by TSrvTransMgr)
+///
+/// @param maxSize maximum number of templates (0 disables them)
+void TSrvCfgMgr::setRenewTemplates(unsigned int maxSize) {
+    RenewTemplates_ = maxSize;
+}
+
+unsigned int TSrvCfgMgr::getRenewTemplates() {
+    return RenewTemplates_;
+}
+
+/// @brief sets quarantine parameters for declined addresses (used by TSrvAddrMgr)
+///
+/// @param holdTime how long (in seconds) declined addresses are not used
+/// @param maxShare how many percent of a pool may be in quarantine (0 disables quarantine)
+void TSrvCfgMgr::setDeclineQuarantine(unsigned int holdTime, unsigned int maxShare) {
+    DeclineHoldTime_ = holdTime;
+    DeclineMaxShare_ = maxShare;
+}
+
+unsigned int TSrvCfgMgr::getDeclineHoldTime() {
+    return DeclineHoldTime_;
+}
+
+unsigned int TSrvCfgMgr::getDeclineMaxShare() {
+    return DeclineMaxShare_;
+}
+
+/// @brief configures lease synchronization with a partner server
+///
+/// Both servers serve clients and exchange lease updates over TCP (see
+/// TSrvLeaseSync). Primary connects to the port the secondary listens on.
+///
+/// @param peer partner's address (NULL disables synchronization)
+/// @param primary true if this server is the primary
+/// @param port TCP port the secondary listens on
+void TSrvCfgMgr::setLeaseSync(SPtr<TIPv6Addr> peer, bool primary, unsigned short port) {
+    LeaseSyncPeer_ = peer;
+    LeaseSyncPrimary_ = primary;
+    LeaseSyncPort_ = port ? port : SERVER_DEFAULT_LEASE_SYNC_PORT;
+}
+
+SPtr<TIPv6Addr> TSrvCfgMgr::getLeaseSyncPeer() {
+    return LeaseSyncPeer_;
+}
+
+bool TSrvCfgMgr::getLeaseSyncPrimary() {
+    return LeaseSyncPrimary_;
+}
+
+unsigned short TSrvCfgMgr::getLeaseSyncPort() {
+    return LeaseSyncPort_;
+}
+
+/// @brief sets secret lease sync partners authenticate each other with
+///
+/// @param secret raw secret (empty if partner is recognized by its address only)
+void TSrvCfgMgr::setLeaseSyncSecret(const TKey& secret) {
+    LeaseSyncSecret_ = secret;
+}
+
+TKey TSrvCfgMgr::getLeaseSyncSecret() {
+    return LeaseSyncSecret_;
+}
+
+/// @brief specifies whether temporary address leases are kept in memory only
+///
+/// Temporary addresses are short-lived and rotated often. When kept in memory
+/// only, they are not written to the lease database and messages that only
+/// affect temporary addresses don't cause database dumps.
+///
+/// @param memoryOnly true: don't store TA leases in the lease database
+void TSrvCfgMgr::setTAMemoryOnly(bool memoryOnly) {
+    TAMemoryOnly_ = memoryOnly;
+}
+
+bool TSrvCfgMgr::getTAMemoryOnly() {
+    return TAMemoryOnly_;
+}
@@ -23,6 +23,9 @@ class TSrvCfgMgr;
 #include "DUID.h"
 #include "KeyList.h"
 #include "SrvCfgClientClass.h"
+#include "SrvRejectCache.h"
+#include "SrvCfgSnapshot.h"
+#include "Rcu.h"
 
 #define SrvCfgMgr() (TSrvCfgMgr::instance())
 
@@ -49,6 +52,14 @@ public:
     int inactiveIfacesCnt();
     SPtr<TSrvCfgIface> checkInactiveIfaces();
 
+    // lock-free access to active interfaces
+    const TSrvCfgSnapshot* getSnapshot();
+    void publishSnapshot();
+    int registerReader();
+    void unregisterReader(int reader);
+    void quiescent(int reader);
+    size_t reclaimSnapshots();
+
     void dump();
 
     bool setupRelay(SPtr<TSrvCfgIface> cfgIface);
@@ -64,6 +75,7 @@ public:
     SPtr<TIPv6Addr> getRandomAddr(SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int iface);
     // bool isClntSupported(SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int iface);
     bool isClntSupported(/*SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int iface,*/ SPtr<TSrvMsg> msg);
+    TSrvRejectCache& getRejectCache();
 
     // prefix-related
     bool incrPrefixCount(int iface, SPtr<TIPv6Addr> prefix);
@@ -139,6 +151,32 @@ public:
     void dropUnicast(bool drop);
     bool dropUnicast();
 
+    void setAddrPermutation(bool permute);
+    bool getAddrPermutation();
+
+    void setLeaseReuse(unsigned int percent);
+    unsigned int getLeaseReuse();
+
+    void setReplyCache(unsigned int ttl, unsigned int maxSize);
+    unsigned int getReplyCacheTTL();
+    unsigned int getReplyCacheSize();
+    void setRenewTemplates(unsigned int maxSize);
+    unsigned int getRenewTemplates();
+
+    void setDeclineQuarantine(unsigned int holdTime, unsigned int maxShare);
+    unsigned int getDeclineHoldTime();
+    unsigned int getDeclineMaxShare();
+
+    void setLeaseSync(SPtr<TIPv6Addr> peer, bool primary, unsigned short port);
+    SPtr<TIPv6Addr> getLeaseSyncPeer();
+    bool getLeaseSyncPrimary();
+    unsigned short getLeaseSyncPort();
+    void setLeaseSyncSecret(const TKey& secret);
+    TKey getLeaseSyncSecret();
+
+    void setTAMemoryOnly(bool memoryOnly);
+    bool getTAMemoryOnly();
+
     // used to be private, but we need access in tests
 protected:
     TSrvCfgMgr(const std::string& cfgFile, const std::string& xmlFile);
@@ -153,8 +191,12 @@ protected:
     bool validateConfig();
     bool validateIface(SPtr<TSrvCfgIface> ptrIface);
     bool validateClass(SPtr<TSrvCfgIface> ptrIface, SPtr<TSrvCfgAddrClass> ptrClass);
-    List(TSrvCfgIface) SrvCfgIfaceLst;
-    List(TSrvCfgIface) InactiveLst;
+    typedef SmallList(TSrvCfgIface) TIfaceLst;
+    TIfaceLst SrvCfgIfaceLst;
+    TIfaceLst InactiveLst;
+
+    /// active interfaces, as seen by packet processing
+    TRcuPtr<TSrvCfgSnapshot> Snapshot_;
     List(TSrvCfgClientClass) ClientClassLst;
     bool matchParsedSystemInterfaces(SrvParser *parser);
 
@@ -183,6 +225,24 @@ protected:
 
     bool PerformanceMode_;
     bool DropUnicast_;
+    bool AddrPermutation_;
+    unsigned int LeaseReuse_; ///< in percents of valid lifetime
+    unsigned int ReplyCacheTTL_;
+    unsigned int ReplyCacheSize_;
+    unsigned int RenewTemplates_;
+    unsigned int DeclineHoldTime_;
+    unsigned int DeclineMaxShare_; ///< in percents of a pool
+
+    // lease synchronization with the partner server
+    SPtr<TIPv6Addr> LeaseSyncPeer_;
+    bool LeaseSyncPrimary_;
+    unsigned short LeaseSyncPort_;
+    TKey LeaseSyncSecret_;        ///< partners prove they know it (may be empty)
+
+    bool TAMemoryOnly_;           ///< don't store TA leases in the lease database
+
+    /// recently rejected clients
+    TSrvRejectCache RejectCache_;
 };
 
 #endif /* SRVCONFMGR_H */
@@ -130,6 +130,24 @@ TOptPtr TSrvCfgOptions::getExtraOption(uint16_t type) {
     return TOptPtr(); // NULL
 }
 
+/// @brief Removes extra (and forced) option of specified type.
+///
+/// @param type option type to be removed
+void TSrvCfgOptions::delExtraOption(uint16_t type) {
+    for (TOptList::iterator opt=ExtraOpts_.begin(); opt!=ExtraOpts_.end(); ) {
+        if ((*opt)->getOptType() == type)
+            opt = ExtraOpts_.erase(opt);
+        else
+            ++opt;
+    }
+    for (TOptList::iterator opt=ForcedOpts_.begin(); opt!=ForcedOpts_.end(); ) {
+        if ((*opt)->getOptType() == type)
+            opt = ForcedOpts_.erase(opt);
+        else
+            ++opt;
+    }
+}
+
 const TOptList& TSrvCfgOptions::getForcedOptions() {
     return ForcedOpts_;
 }
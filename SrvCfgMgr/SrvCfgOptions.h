@@ -69,6 +69,7 @@ public:
     void addExtraOption(SPtr<TOpt> extra, bool always);
     const TOptList& getExtraOptions();
     SPtr<TOpt> getExtraOption(uint16_t type);
+    void delExtraOption(uint16_t type);
     const TOptList& getForcedOptions();
     void addExtraOptions(const TOptList& extra);
     void addForcedOptions(const TOptList& extra);
@@ -31,7 +31,7 @@ TSrvCfgPD::TSrvCfgPD()
 {
     ID_ = StaticID_++;
     PD_MaxLease_ = SERVER_DEFAULT_CLASSMAXLEASE;
-    PD_Assigned_ = 0;
+    PD_Assigned_.set(0);
     PD_Count_ = 0;
     PD_Length_ = 0;
 }
@@ -110,6 +110,7 @@ bool TSrvCfgPD::setOptions(SPtr<TSrvParsGlobalOpt> opt, int prefixLength)
     while ( pool = opt->getPool() ) {
         poolLength = pool->getPrefixLength();
         PoolLst_.append(pool);
+        PoolTable_.add(pool->getAddrL(), pool->getAddrR());
         Log(Debug) << "PD: Pool " << pool->getAddrL()->getPlain() << " - "
                    << pool->getAddrR()->getPlain() << ", pool length: "
                    << pool->getPrefixLength() << ", " << PD_Count_ << " prefix(es) total." << LogEnd;
@@ -136,7 +137,7 @@ bool TSrvCfgPD::setOptions(SPtr<TSrvParsGlobalOpt> opt, int prefixLength)
        << CommonPool->getPrefixLength() << "." << LogEnd; */
 
     // set up prefix counter counts
-    PD_Assigned_ = 0;
+    PD_Assigned_.set(0);
     if (PD_MaxLease_ > PD_Count_)
         PD_MaxLease_ = PD_Count_;
     Log(Debug) << "PD: Up to " << PD_Count_ << " prefixes may be assigned." << LogEnd;
@@ -147,13 +148,12 @@ bool TSrvCfgPD::setOptions(SPtr<TSrvParsGlobalOpt> opt, int prefixLength)
 
 bool TSrvCfgPD::prefixInPool(SPtr<TIPv6Addr> prefix)
 {
-    SPtr<THostRange> pool;
-    PoolLst_.first();
-    while ( pool = PoolLst_.get() ) {
-        if (pool->in(prefix))
-            return true;
-    }
-    return false;
+    return PoolTable_.in(prefix);
+}
+
+List(THostRange) TSrvCfgPD::getPoolLst()
+{
+    return PoolLst_;
 }
 
 /**
@@ -189,7 +189,7 @@ List(TIPv6Addr) TSrvCfgPD::getRandomList() {
     commonPart->truncate(0, getPD_Length());
 
     /// @todo: it's just workaround. Prefix random generation should be implemented for real.
-    if (PD_Count_ == PD_Assigned_ + 1) {
+    if (PD_Count_ == PD_Assigned_.get() + 1) {
         commonPart = new TIPv6Addr(*CommonPool_->getAddrR());
     }
 
@@ -213,17 +213,23 @@ unsigned long TSrvCfgPD::getID()
 }
 
 long TSrvCfgPD::incrAssigned(int count) {
-    PD_Assigned_ += count;
-    return PD_Assigned_;
+    return PD_Assigned_.add(count);
 }
 
 long TSrvCfgPD::decrAssigned(int count) {
-    PD_Assigned_ -= count;
-    return PD_Assigned_;
+    return PD_Assigned_.sub(count);
 }
 
 unsigned long TSrvCfgPD::getAssignedCount() {
-    return PD_Assigned_;
+    return PD_Assigned_.get();
+}
+
+/// returns number of prefixes that still may be delegated from this pool
+unsigned long TSrvCfgPD::getFreeCount() {
+    unsigned long assigned = PD_Assigned_.get();
+    if (assigned >= PD_MaxLease_)
+        return 0;
+    return PD_MaxLease_ - assigned;
 }
 
 unsigned long TSrvCfgPD::getTotalCount() {
@@ -235,7 +241,7 @@ ostream& operator<<(ostream& out,TSrvCfgPD& prefix)
 {
     out << "    <PD id=\"" << prefix.ID_ << "\">" << std::endl;
     out << "      <!-- total prefixes in class: " << prefix.PD_Count_
-        << ", prefixes assigned: " << prefix.PD_Assigned_ << " -->" << endl;
+        << ", prefixes assigned: " << prefix.PD_Assigned_.get() << " -->" << endl;
     out << "      <T1 min=\"" << prefix.PD_T1Beg_ << "\" max=\"" << prefix.PD_T1End_  << "\" />" << endl;
     out << "      <T2 min=\"" << prefix.PD_T2Beg_ << "\" max=\"" << prefix.PD_T2End_  << "\" />" << endl;
     out << "      <prefered-lifetime min=\"" << prefix.PD_PrefBeg_ << "\" max=\"" << prefix.PD_PrefEnd_  << "\" />" << endl;
@@ -44,6 +44,8 @@ class TSrvCfgPD;
 #include "SmartPtr.h"
 #include "SrvCfgPD.h"
 #include "Node.h"
+#include "Atomic.h"
+#include "AddrRangeTable.h"
 
 class TSrvCfgClientClass;
 
@@ -61,6 +63,7 @@ class TSrvCfgPD
 
     //checks if the prefix belongs to the pool
     bool prefixInPool(SPtr<TIPv6Addr> prefix);
+    List(THostRange) getPoolLst();
     unsigned long countPrefixesInPool();
     SPtr<TIPv6Addr> getRandomPrefix();
     List(TIPv6Addr) getRandomList();
@@ -78,6 +81,7 @@ class TSrvCfgPD
 
     unsigned long getAssignedCount();
     unsigned long getTotalCount();
+    unsigned long getFreeCount();
     long incrAssigned(int count=1);
     long decrAssigned(int count=1);
 
@@ -102,9 +106,10 @@ class TSrvCfgPD
     static unsigned long StaticID_;
 
     List(THostRange) PoolLst_;
+    TAddrRangeTable PoolTable_;   // the same pools, for prefixInPool()
     SPtr<THostRange> CommonPool_; /* common part of all available prefix pools (section b in the description above) */
     unsigned long PD_MaxLease_;
-    unsigned long PD_Assigned_;
+    TAtomicCounter PD_Assigned_; ///< modified during packet processing
     unsigned long PD_Count_;
 
     List(std::string) AllowLst_;
@@ -0,0 +1,57 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <algorithm>
+#include "SrvCfgSnapshot.h"
+
+using namespace std;
+
+TSrvCfgSnapshot::TSrvCfgSnapshot(const TIfaceVector& ifaces)
+    :Ifaces_(ifaces)
+{
+    ByID_.reserve(Ifaces_.size());
+    for (size_t i = 0; i < Ifaces_.size(); i++)
+        ByID_.push_back(make_pair(Ifaces_[i]->getID(), i));
+
+    // stable, so the first of interfaces with the same ifindex wins
+    stable_sort(ByID_.begin(), ByID_.end());
+}
+
+/// @brief returns interface with specified ifindex (or NULL)
+const TSrvCfgIface* TSrvCfgSnapshot::getIfaceByID(int ifindex) const
+{
+    const_iterator it = findByID(ifindex);
+    if (it == end())
+        return 0;
+    return it->get();
+}
+
+/// @brief returns interface with specified name (or NULL)
+const TSrvCfgIface* TSrvCfgSnapshot::getIfaceByName(const std::string& name) const
+{
+    for (const_iterator it = Ifaces_.begin(); it != Ifaces_.end(); ++it) {
+        if ((*it)->getName() == name)
+            return it->get();
+    }
+    return 0;
+}
+
+/// @brief finds interface with specified ifindex
+///
+/// Meant for the thread that publishes snapshots, which may copy the SPtr<>.
+///
+/// @return iterator pointing to the interface, end() if there is no such interface
+TSrvCfgSnapshot::const_iterator TSrvCfgSnapshot::findByID(int ifindex) const
+{
+    vector< pair<int, size_t> >::const_iterator it =
+        lower_bound(ByID_.begin(), ByID_.end(), make_pair(ifindex, (size_t)0));
+    if (it == ByID_.end() || it->first != ifindex)
+        return end();
+    return Ifaces_.begin() + it->second;
+}
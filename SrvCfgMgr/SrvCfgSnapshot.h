@@ -0,0 +1,61 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVCFGSNAPSHOT_H
+#define SRVCFGSNAPSHOT_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include "SmartPtr.h"
+#include "SrvCfgIface.h"
+
+/// @brief immutable view of the server configuration
+///
+/// Holds active interfaces (with their classes, reservations and options)
+/// as they were when the snapshot was published by TSrvCfgMgr. Snapshot is
+/// never modified: any change of the interface set builds a new one, so
+/// packet processing may read it without locks. Only pool usage counters,
+/// which are atomic, change inside the interface objects.
+///
+/// Interface lookup by ifindex is a binary search. Interfaces are traversed
+/// in config file order (relay lookups rely on it).
+///
+/// @note SPtr<> reference counters are not atomic, so readers get plain
+/// pointers. Only the thread that publishes snapshots may copy SPtr<>s
+/// (see findByID()).
+///
+/// @note Snapshots are published when interfaces are added or go
+/// (in)active. Configuration reload is not wired up: changed classes,
+/// pools or options still require a server restart.
+class TSrvCfgSnapshot
+{
+public:
+    typedef std::vector< SPtr<TSrvCfgIface> > TIfaceVector;
+    typedef TIfaceVector::const_iterator const_iterator;
+
+    TSrvCfgSnapshot(const TIfaceVector& ifaces);
+
+    const TSrvCfgIface* getIfaceByID(int ifindex) const;
+    const TSrvCfgIface* getIfaceByName(const std::string& name) const;
+    const_iterator findByID(int ifindex) const;
+
+    const_iterator begin() const { return Ifaces_.begin(); }
+    const_iterator end() const { return Ifaces_.end(); }
+    size_t size() const { return Ifaces_.size(); }
+
+private:
+    /// interfaces in config file order
+    TIfaceVector Ifaces_;
+
+    /// (ifindex, position in Ifaces_), sorted by ifindex
+    std::vector< std::pair<int, size_t> > ByID_;
+};
+
+#endif
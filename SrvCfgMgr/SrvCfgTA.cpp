@@ -176,7 +176,7 @@ void TSrvCfgTA::setOptions(SPtr<TSrvParsGlobalOpt> opt)
 
     // set up address counter counts
     this->AddrsCount = this->Pool->rangeCount();
-    this->AddrsAssigned = 0;
+    this->AddrsAssigned.set(0);
 
     if (this->ClassMaxLease > this->AddrsCount)
 	this->ClassMaxLease = this->AddrsCount;
@@ -198,6 +198,11 @@ SPtr<TIPv6Addr> TSrvCfgTA::getRandomAddr()
     return Pool->getRandomAddr();
 }
 
+SPtr<THostRange> TSrvCfgTA::getPool()
+{
+    return Pool;
+}
+
 unsigned long TSrvCfgTA::getClassMaxLease() {
     return ClassMaxLease;
 }
@@ -208,17 +213,15 @@ unsigned long TSrvCfgTA::getID()
 }
 
 long TSrvCfgTA::incrAssigned(int count) {
-    this->AddrsAssigned += count;
-    return this->AddrsAssigned;
+    return this->AddrsAssigned.add(count);
 }
 
 long TSrvCfgTA::decrAssigned(int count) {
-    this->AddrsAssigned -= count;
-    return this->AddrsAssigned;
+    return this->AddrsAssigned.sub(count);
 }
 
 unsigned long TSrvCfgTA::getAssignedCount() {
-    return this->AddrsAssigned;
+    return this->AddrsAssigned.get();
 }
 
 bool TSrvCfgTA::addrInPool(SPtr<TIPv6Addr> addr) 
@@ -231,7 +234,7 @@ ostream& operator<<(ostream& out,TSrvCfgTA& addrClass)
     out << "    <taClass id=\"" << addrClass.ID << "\" pref=\"" << addrClass.Pref
 	<< "\" valid=\"" << addrClass.Valid << "\">" << endl;
     out << "      <!-- total addrs in class: " << addrClass.AddrsCount
-	<< ", addrs assigned: " << addrClass.AddrsAssigned << " -->" << endl;
+	<< ", addrs assigned: " << addrClass.AddrsAssigned.get() << " -->" << endl;
     out << "      <ClassMaxLease>" << addrClass.ClassMaxLease << "</ClassMaxLease>" << endl;
 
     SPtr<THostRange> statRange;
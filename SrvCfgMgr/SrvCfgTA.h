@@ -22,6 +22,7 @@ class TSrcCfgTA;
 #include "SmartPtr.h"
 #include "IPv6Addr.h"
 #include "DUID.h"
+#include "Atomic.h"
 
 class TSrvCfgTA
 {
@@ -37,6 +38,7 @@ class TSrvCfgTA
     unsigned long countAddrInPool();
     SPtr<TIPv6Addr> getRandomAddr();
     bool addrInPool(SPtr<TIPv6Addr> addr);
+    SPtr<THostRange> getPool();
 
     unsigned long getPref();
     unsigned long getValid();
@@ -63,7 +65,7 @@ class TSrvCfgTA
     TContainer<SPtr<THostRange> > AcceptClnt;
     SPtr<THostRange> Pool;
     unsigned long ClassMaxLease;
-    unsigned long AddrsAssigned;
+    TAtomicCounter AddrsAssigned; // modified during packet processing
     unsigned long AddrsCount;
 
     List(std::string) allowLst;
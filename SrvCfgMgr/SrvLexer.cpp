@@ -354,8 +354,8 @@ int yyFlexLexer::yywrap() { return 1; }
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 139
-#define YY_END_OF_BUFFER 140
+#define YY_NUM_RULES 148
+#define YY_END_OF_BUFFER 149
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -363,131 +363,142 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[1118] =
+static yyconst flex_int16_t yy_accept[1212] =
     {   0,
-        1,    1,    0,    0,    0,    0,  140,  138,    2,    1,
-        1,  138,  120,  138,  138,  137,  137,  138,  138,  138,
-      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
-      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
-      138,  138,  124,  124,  139,    1,    1,    1,    0,  132,
-      120,    0,  132,  122,  121,  137,    0,    0,  136,    0,
-      129,  102,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  117,  133,  133,  104,
-
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,   17,   18,  133,  133,  133,  133,  133,
-      133,  133,  133,  123,  121,  137,    0,    0,    0,  128,
-      134,  127,  127,  133,  133,  133,  133,  133,  133,  103,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,   95,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  116,  137,    0,
-
-        0,    0,    0,  126,  126,    0,  127,    0,  127,  133,
-      133,  133,   68,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  110,  133,  133,  133,  133,   32,  133,  133,
-       48,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,    0,  133,  133,  133,  133,  133,
-      133,  133,   25,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      118,  133,  133,  133,  133,  137,    0,  135,    0,    0,
-        0,  126,    0,  126,    0,  127,  127,  127,  127,  133,
-      133,  133,  133,  133,  109,  133,  133,  133,    4,  133,
-
-      133,  133,  133,  133,  133,  133,  133,  119,  133,   99,
-      133,  133,    3,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,    0,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,    7,
-      133,   47,  133,  133,   26,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,    0,    0,    0,
-        0,    0,  126,  126,  126,  126,    0,  127,  127,  127,
-        0,  127,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,   31,  133,  133,  133,  133,  133,   40,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-
-      133,  133,  133,  133,  133,  133,  133,  133,  133,    0,
-        0,  133,  133,  133,   38,  133,  133,  133,  133,  133,
-       36,  133,  133,  133,  133,   64,   96,  133,  133,  133,
-      113,   46,  133,  133,  133,  133,  133,  133,  133,    0,
-        0,    0,    0,  126,  126,  126,    0,  126,    0,    0,
-      127,  127,  127,  127,  133,  133,   35,  133,  133,  133,
-      133,  133,  133,  133,  133,    0,  133,  133,  112,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,    0,    0,  133,  133,  133,  133,  133,   62,
-
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,   23,  133,  133,  133,  135,    0,    0,
-        0,    0,    0,  126,  126,  126,  126,    0,  127,  127,
-      127,    0,  127,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,    0,  133,
-      133,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,   84,  133,  133,  133,   49,  133,   58,  133,
-      133,  133,   12,   10,  101,  133,   45,    0,    0,  133,
-      133,  133,   60,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,  133,  133,    5,  133,  133,  133,
-
-       14,    0,    0,    0,    0,  126,  126,  126,    0,  126,
-      131,  127,  127,  127,  127,  133,  133,  133,  133,  133,
-       97,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-        0,  133,  133,  133,  133,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,   86,  133,  133,  133,  133,  133,
-      133,  133,  133,   11,   67,    0,    0,  133,  133,  133,
-       61,  133,  133,  133,  133,  133,  133,  133,   33,  133,
-      133,    6,  111,   42,  133,  133,    0,    0,    0,    0,
-      130,  126,  126,  126,  126,  127,  127,  127,    0,  127,
-      133,  133,  133,  133,  133,  133,  133,  133,   78,  133,
-
-      133,  133,   59,  133,    0,  133,  133,  133,  133,  133,
-      133,  133,  133,   39,  133,  133,  133,   37,  133,  133,
-      133,  133,  133,  133,  133,   34,   13,    0,    0,   55,
-       54,   41,  133,  133,   24,  133,  133,  133,  133,   44,
-       43,  133,  133,  135,    0,    0,  126,  126,  126,    0,
-      126,  127,  127,  127,  127,  133,   15,  133,   66,  133,
-      133,  133,  133,   77,  133,  133,  133,    0,  133,  133,
-      133,  133,  133,  133,   81,  133,  133,  133,  133,   88,
-       90,   92,   94,  133,  133,  133,   57,   56,  133,  133,
-      133,  133,  133,  133,  133,   63,    0,    0,    0,    0,
-
-      126,  126,  126,  126,  127,  127,  127,    0,  127,  133,
-      133,  114,  133,   79,  133,  133,  133,  133,    0,  100,
-      133,  133,  133,   53,  133,   82,   22,   65,  133,  133,
-      133,    8,  133,  133,  133,   27,  133,  133,  133,    0,
-        0,    0,  126,  126,  126,    0,  126,  127,  127,  127,
-      127,  133,  133,  133,   75,   80,  133,  133,    0,  133,
-      133,   52,  133,  133,  133,  133,   69,  133,  133,  133,
-      133,  133,  133,  133,  135,    0,    0,    0,  126,  126,
-      126,  126,  127,  127,  127,    0,  127,  133,  133,   76,
-      133,  133,    0,  133,  133,  133,  133,  133,  133,  133,
-
-      133,  133,  133,  133,   16,   21,    0,    0,  125,  128,
-      126,  126,  126,    0,  126,  127,  127,  127,  127,  133,
-      133,  133,   29,    0,    0,  133,  133,  133,   83,  133,
-      133,   28,  133,  133,  133,  133,  133,    0,    0,  125,
-        0,  126,  126,  126,  126,  126,  127,  127,  127,    0,
-      127,  133,  133,  133,    0,    0,   30,  133,  133,   85,
-      133,  133,  133,  133,  133,  115,  133,  133,  133,  135,
-      125,  128,  126,    0,  126,  126,  126,  126,  127,  127,
-      127,   70,  133,  133,  133,  133,    0,    0,  133,  133,
-      133,  133,  133,  133,   51,  133,   20,  133,  133,    0,
-
-      125,  126,  126,  126,  126,  127,  127,  127,  133,  133,
-      133,  133,  133,    0,    0,  133,  133,   87,   89,   91,
-       93,    9,   19,  133,    0,  126,  126,    0,  126,  126,
-      127,   50,  133,  133,  133,  133,    0,    0,  133,  133,
-       98,  135,  126,  126,  127,  133,  133,  133,  133,    0,
-        0,    0,  133,  133,  133,    0,  126,  126,    0,  133,
-      133,  133,  133,    0,    0,    0,  105,  133,  133,  133,
-      105,  125,  126,  126,   71,  133,  133,  133,    0,  107,
-        0,  133,  107,  133,  125,  126,  126,    0,  133,  133,
-       74,    0,  106,  133,  106,    0,  126,  126,  133,   72,
-
-      108,  108,    0,  126,  126,    0,   73,  135,  126,  126,
-        0,  126,  126,    0,  126,  126,    0
+        1,    1,    0,    0,    0,    0,  149,  147,    2,    1,
+        1,  147,  129,  147,  147,  146,  146,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  133,  133,  133,  148,    1,    1,    1,    0,
+      141,  129,    0,  141,  131,  130,  146,    0,    0,  145,
+        0,  138,  102,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  126,  142,
+
+      142,  104,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,   17,   18,  142,  142,
+      142,  142,  142,  142,  142,  142,  132,    0,  130,  146,
+        0,    0,    0,  137,  143,  136,  136,  142,  142,  142,
+      142,  142,  142,  142,  142,  103,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+       95,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+
+      142,  142,  142,  142,  142,  142,  142,  142,  125,  146,
+        0,    0,    0,    0,  135,  135,  143,    0,  136,    0,
+      136,  142,  142,  142,   68,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  110,  142,  142,  142,  142,
+       32,  142,  142,   48,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,    0,
+      142,  142,  142,  142,  142,  142,  142,   25,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  127,
+      142,  142,  142,  142,  146,    0,  144,    0,    0,    0,
+
+      135,    0,  135,    0,  136,  136,  136,  136,  142,  142,
+      142,  142,  142,  109,  142,  142,  142,    4,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  128,  142,   99,
+      142,  142,    3,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,    0,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,    7,  142,  142,  142,   47,  142,  142,   26,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,    0,    0,    0,    0,    0,  135,  135,
+      135,  135,    0,    0,  136,  136,  136,    0,  136,  142,
+
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+       31,  142,  142,  142,  142,  142,  142,   40,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,    0,
+        0,  142,  142,  142,   38,  142,  142,  142,  142,  142,
+       36,  142,  142,  142,  142,  142,  142,   64,   96,  142,
+      142,  142,  142,  113,   46,  142,  142,  142,  142,  142,
+      142,  142,  142,    0,    0,    0,    0,    0,  135,  135,
+      135,    0,  135,    0,    0,  136,  136,  136,  136,  142,
+      142,   35,  142,  142,  142,  142,  142,  142,  142,  142,
+
+        0,  142,  142,  112,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,    0,    0,  142,  142,  142,  142,  142,   62,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,   23,  142,  142,  142,
+      144,    0,    0,    0,    0,    0,  135,  135,  135,  135,
+        0,    0,  136,  136,  136,    0,  136,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,    0,  142,  142,  142,  142,  142,  142,  142,
+
+      142,  142,  142,  142,  142,  142,  142,   84,  142,  142,
+      142,  142,   49,  142,  142,  142,   58,  142,  142,  142,
+       12,   10,  101,  142,   45,    0,    0,  142,  142,  142,
+       60,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,    5,  142,  142,
+      142,  142,   14,    0,    0,    0,    0,    0,  135,  135,
+      135,    0,  135,  140,  136,  136,  136,  136,  142,  142,
+      142,  142,  142,   97,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,    0,  142,  142,  142,  142,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,   86,  142,
+
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+       11,   67,    0,    0,  142,  142,  142,   61,  142,  142,
+      142,  142,  142,  142,  142,  142,   33,  142,  142,  142,
+      142,  142,    6,  111,  142,   42,  142,  142,    0,    0,
+        0,    0,  139,  135,  135,  135,  135,  140,  136,  136,
+      136,    0,  136,  142,  142,  142,  142,  142,  142,  142,
+      142,   78,  142,  142,  142,   59,  142,    0,  142,  142,
+      142,  142,  142,  142,  142,  142,  142,   39,  142,  142,
+      142,   37,  142,  142,  142,  142,  142,  142,  117,  142,
+      142,  122,   34,   13,    0,    0,   55,   54,   41,  142,
+
+      142,   24,  142,  142,  142,  142,  142,  142,  142,   44,
+       43,  116,  142,  142,  142,  144,    0,    0,  139,  135,
+      135,  135,    0,  135,  136,  136,  136,  136,  142,   15,
+      142,   66,  142,  142,  142,  142,   77,  142,  142,  142,
+        0,  142,  142,  142,  142,  142,  142,  142,   81,  142,
+      142,  142,  142,   88,   90,   92,   94,  142,  142,  142,
+      119,   57,   56,  142,  142,  142,  142,  142,  142,  142,
+      142,  120,  142,  142,   63,    0,    0,    0,    0,  135,
+      135,  135,  135,  136,  136,  136,    0,  136,  142,  142,
+      114,  142,   79,  142,  142,  142,  142,    0,  100,  142,
+
+      142,  142,   53,  142,  142,   82,   22,   65,  142,  142,
+      142,    8,  142,  142,  142,   27,  142,  118,  142,  142,
+      142,  142,    0,    0,    0,  135,  135,  135,    0,  135,
+      136,  136,  136,  136,  142,  142,  142,   75,   80,  142,
+      142,    0,  142,  142,   52,  142,  142,  142,  142,  142,
+       69,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      144,    0,    0,    0,  135,  135,  135,  135,  136,  136,
+      136,    0,  136,  142,  142,   76,  142,  142,    0,  142,
+      142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+      142,   16,  142,  124,   21,    0,    0,  134,  137,  135,
+
+      135,  135,    0,  135,  136,  136,  136,  136,  142,  142,
+      142,   29,    0,    0,  142,  142,  142,  142,   83,  142,
+      142,   28,  142,  142,  142,  142,  142,  121,    0,    0,
+      134,    0,  135,  135,  135,  135,  135,  136,  136,  136,
+        0,  136,  142,  142,  142,    0,    0,   30,  142,  142,
+      142,   85,  142,  142,  142,  142,  142,  115,  142,  142,
+      142,  144,  134,  137,  135,    0,  135,  135,  135,  135,
+      136,  136,  136,   70,  142,  142,  142,  142,    0,    0,
+      142,  142,  142,  142,  142,  142,  142,   51,  142,   20,
+      142,  142,    0,  134,  135,  135,  135,  135,  136,  136,
+
+      136,  142,  142,  142,  142,  142,    0,    0,  142,  142,
+      123,   87,   89,   91,   93,    9,   19,  142,    0,  135,
+      135,    0,  135,  135,  136,   50,  142,  142,  142,  142,
+        0,    0,  142,  142,   98,  144,  135,  135,  136,  142,
+      142,  142,  142,    0,    0,    0,  142,  142,  142,    0,
+      135,  135,    0,  142,  142,  142,  142,    0,    0,    0,
+      105,  142,  142,  142,  105,  134,  135,  135,   71,  142,
+      142,  142,    0,  107,    0,  142,  107,  142,  134,  135,
+      135,    0,  142,  142,   74,    0,  106,  142,  106,    0,
+      135,  135,  142,   72,  108,  108,    0,  135,  135,    0,
+
+       73,  144,  135,  135,    0,  135,  135,    0,  135,  135,
+        0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -501,11 +512,11 @@ static yyconst flex_int32_t yy_ec[256] =
        23,    1,    1,    1,   24,   25,   26,   27,   28,   29,
        30,   31,   32,   33,   34,   35,   36,   37,   38,   39,
        40,   41,   42,   43,   44,   45,   46,   47,   48,   49,
-        1,    1,    1,    1,    1,    1,   50,   51,   52,   53,
+        1,    1,    1,    1,    1,    1,   24,   25,   26,   27,
 
-       54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
-       64,   65,   66,   67,   68,   69,   70,   71,   72,   73,
-       74,   75,    1,    1,    1,    1,    1,    1,    1,    1,
+       28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
+       38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+       48,   49,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -522,1696 +533,1257 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[76] =
+static yyconst flex_int32_t yy_meta[50] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    4,    1,    3,    3,    3,    3,    3,    3,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
-        3,    3,    3,    3,    3,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[1208] =
+static yyconst flex_int16_t yy_base[1212] =
     {   0,
-        0,    0, 1166, 1165,    0,    0, 1172, 6257, 6257,   73,
-       75, 1165,    0, 1162,   72,   72,   34, 1116, 1109,  136,
-      186,  233,  280,   71,  208,  338,   66,  236,   38,   89,
-      223,  240,  340,   72,  359,  377,  422,  419,   68,  392,
-      180,  209, 6257, 1118, 6257,  111,  137,  213, 1120, 6257,
-        0, 1082, 1064, 6257,    0,  480, 1022,  499, 6257,    0,
-      525, 6257,   60,  568,  188,  192,  182,  184,  270,  275,
-      279,  231,  283,  420,  276,  274,  279,  405,  388,  375,
-      560,  478,  561,  335,  564,  583,  585,  591,  604,  608,
-      411,  613,  603,  337,  628,  601,  370,  623,  621,  413,
-
-      477,  638,  643,  652,  645,  659,  459,  656,  673,  680,
-      670,  692,  687,  570,  600,  709,  701,  658,  700,  704,
-      697,  705,  710, 6257,    0,  768,  978,  542,  969,  813,
-        0,  858,  553,  901,  719,  710,  890,  894,  895,  732,
-      893,  901,  760,  898,  918,  766,  899,  900,  945,  754,
-      951,  937,  950,  952,  940,  818,  948,  941,  953,  972,
-      986,  981,  989,  800,  991,  992,  983,  988, 1004,  985,
-     1037, 1021, 1005, 1038, 1028, 1006, 1040, 1034, 1041, 1042,
-     1044, 1049, 1057, 1065, 1074, 1076, 1092, 1078, 1084, 1087,
-     1107, 1109, 1112, 1108, 1117, 1137, 1124, 1036, 1195,  832,
-
-      968,  965,  964, 1242,  878, 1182, 1287, 1330, 1214, 1373,
-     1100, 1308, 1101, 1210, 1333, 1195, 1325, 1368, 1362, 1247,
-     1385, 1363, 1123, 1366, 1369, 1148, 1404, 1229, 1374, 1403,
-     1406, 1412, 1375, 1410, 1414, 1408, 1290, 1405, 1416, 1443,
-     1453, 1439, 1450, 1451,  939, 1464, 1456, 1455, 1457, 1484,
-     1466, 1491, 1467, 1512, 1495, 1505, 1507, 1497, 1503, 1525,
-     1513, 1530, 1532, 1554, 1536, 1548, 1559, 1519, 1564, 1583,
-     1547, 1570, 1577, 1571, 1587, 1645,  925,  914,  885,  884,
-     1655, 1666, 1709, 1685, 1728, 1754, 1773, 1799, 1818,  883,
-     1688, 1584, 1568, 1798, 1572, 1819, 1813, 1645, 1741, 1797,
-
-     1815, 1832, 1818, 1836, 1582, 1670, 1833, 1733, 1851, 1752,
-     1835, 1856, 1872, 1864, 1867, 1865, 1875, 1879, 1892, 1884,
-     1903, 1907, 1883, 1888, 1915, 1902, 1922, 1920, 1924, 1906,
-     1937, 1938, 1927, 1939, 1952, 1951, 1969, 1955, 1945, 1800,
-     1972, 1802, 1959, 1961, 1967, 1974, 1989, 1988, 1990, 1992,
-     2004, 2003, 2006, 2010, 2031, 2022, 2024,  882,  881,  880,
-      879, 2089, 2100, 2119, 2145, 2164, 2128, 2190,  878, 2202,
-     2245, 2221, 2087, 2144, 2023, 2013, 2232, 2042, 2028, 2240,
-     2247, 2235, 2242, 2317, 2243, 2241, 2284, 2181, 2289, 2020,
-     2244, 2299, 2288, 2300, 2293, 2303, 2309, 2304, 2307, 2328,
-
-     2321, 2342, 2320, 2322, 2341, 2351, 2352, 2344, 2359, 2138,
-     2255, 2363, 2360, 2361, 2345, 2374, 2390, 2365, 2388, 2408,
-     2373, 2393, 2407, 2428, 2430, 2397, 2403, 2417, 2413, 2427,
-     2412, 2415, 2432, 2424, 2451, 2460, 2449, 2476, 2464,  868,
-      839,  838, 2522, 2534,  837, 2546, 2589, 2565, 2608, 2634,
-     2645, 2664, 2690, 2709, 2711, 2447, 2567, 2474, 2691, 2463,
-     2693, 2712, 2689, 2706, 2710, 2454, 2722, 2724, 2457, 2727,
-     2576, 2759, 2741, 2755, 2760, 2763, 2745, 2735, 2777, 2784,
-     2791, 2792, 2797, 2804, 2811, 2800, 2812, 2815, 2824, 2821,
-     2816, 2833, 2533, 2590, 2829, 2843, 2845, 2851, 2853, 2624,
-
-     2856, 2865, 2873, 2866, 2881, 2894, 2897, 2900, 2863, 2898,
-     2895, 2903, 2912, 2632, 2916, 2910, 2918,  836,  835,  834,
-      832, 2976, 2987, 2998, 3017, 3043, 3062, 3026, 3088,  821,
-     3100, 3143, 3119, 3121, 3129, 3137, 3042, 3141, 3142, 3139,
-     3157, 3136, 3173, 3175, 2861, 3145, 3172, 3176, 2925, 3187,
-     3194, 3196, 3182, 3209, 3197, 3191, 3195, 3226, 3232, 3225,
-     3229, 3233, 2913, 3267, 3228, 3264, 2940, 3250, 2985, 3263,
-     3248, 3256, 3030, 3246, 3249, 3268, 3261, 3282, 3264, 3295,
-     3286, 3297, 3277, 3298, 3306, 3313, 3302, 3317, 3316, 3278,
-     3314, 3318, 3341, 3335, 3322, 3347, 3330, 3352, 3353, 3354,
-
-     3337,  794,  793,  792, 3412, 3423,  791, 3435, 3478, 3454,
-     3463, 3523, 3497, 3568, 3542, 3476, 3556, 3564, 3465, 3377,
-     3350, 3558, 3563, 3565, 3568, 3587, 3600, 3608, 3611, 3570,
-     3578, 3619, 3598, 3609, 3610, 3612, 3623, 3622, 3640, 3642,
-     3651, 3644, 3650, 3663, 3607, 3681, 3679, 3683, 3688, 3667,
-     3692, 3680, 3674, 3660, 3661, 3676, 3691, 3691, 3699, 3711,
-     3678, 3712, 3724, 3719, 3716, 3721, 3726, 3740, 3727, 3743,
-     3733, 3731, 3732, 3735, 3760, 3764,  790,  789,  786,  785,
-     3551, 3824, 3806, 3869, 3843, 3888,  784, 3914, 3957, 3933,
-     3919, 3944, 3953, 3949, 3952, 3969, 3763, 3803, 3822, 3951,
-
-     3959, 3958, 3856, 3971, 3884, 3989, 3935, 4003, 4008, 3991,
-     4010, 4009, 4006, 3996, 4000, 4021, 4025, 4002, 4038, 4039,
-     4050, 4033, 4046, 4048, 4052, 4030, 4041, 4050, 4047, 4045,
-     4049, 4053, 4073, 4089, 4054, 4090, 4094, 4100, 4101, 4060,
-     4061, 4092, 4106,  783,  782,  781, 4164,  779, 4176, 4219,
-     4195, 4264, 4238, 4309, 4283, 4304, 4093, 4102, 4095, 4098,
-     4198, 4297, 4302, 4104, 4324, 4129, 4325, 4186, 4303, 4340,
-     4306, 4313, 4311, 4251, 4243, 4345, 4342, 4352, 4361, 4346,
-     4347, 4348, 4349, 4376, 4379, 4380, 6257, 6257, 4390, 4392,
-     4393, 4359, 4399, 4398, 4394, 4383,  778,  747,  746,  744,
-
-     4459, 4478, 4504, 4523, 4549,  739, 4561, 4604, 4580, 4401,
-     4564, 4395, 4595, 4396, 4600, 4616, 4609, 4503, 4415, 4446,
-     4618, 4597, 4605, 4491, 4606, 4601, 4603, 4607, 4651, 4656,
-     4653, 4672, 4647, 4657, 4655, 4643, 4661, 4649, 4658,  734,
-      733,  705, 4719,  644, 4732, 4775, 4751, 4820, 4794, 4865,
-     4839, 4652, 4825, 4762, 4654, 4659, 4855, 4856,  646, 4773,
-     4853, 4711, 4877, 4870, 4861, 4864, 4807, 4865, 4869, 4867,
-     4910, 4904, 4900, 4915,  627,  624,  594,  589, 4975, 4994,
-     5020, 5039, 5065,  587, 5077, 5120, 5096, 4917, 4902, 4905,
-     4907, 5098, 5117, 4908, 5134, 4999, 5133, 5135, 5136, 4912,
-
-     5138, 5019, 4914, 5137, 4954, 4962,  585,  584,  581,    0,
-     5198,  580, 5210, 5253, 5229, 5298, 5272, 5343, 5317, 5332,
-     5311, 5114, 5081, 5127, 5127, 5346, 5240, 5336, 5123, 5368,
-     5335, 5152, 5360, 5363, 5374, 5376, 5251,  579,  543,  506,
-      505,  504, 5436, 5408, 5481, 5455, 5500,  503, 5526,    0,
-     5545, 5341, 5527, 5546, 5209, 5360, 5365, 5479, 5529, 5397,
-     5554, 5460, 5468, 5542, 5547, 5415, 5559, 5556, 5550,  502,
-      501, 6257,  466,    0, 5617,  462, 5629, 5648, 5674, 5693,
-        0, 5544, 5678, 5671, 5692, 5706, 5553, 5599, 5675, 5695,
-     5713, 5608, 5716, 5705, 5616, 5696, 5674, 5707, 5724,  460,
-
-      451,  450,  449, 5784, 5803, 5829,  446,    0, 5709, 5763,
-     5712, 5787, 5817, 5712,    0, 5786, 5858, 5711, 5723, 5726,
-     5762, 5785, 5814, 5841,  445,  417,  416,    0, 5882, 6257,
-        0, 5834, 5861, 5862, 5863, 5864,    0, 5863, 5918, 5885,
-     5839,  406,  403,  402, 6257, 5898, 5884, 5904, 5906, 5918,
-     5864, 5884, 5929, 5934, 5916,  400,  396,  395,    0, 5918,
-     5921, 5937, 5907, 5940, 5929, 5924, 6257, 5956, 5952, 5951,
-     5953,  363,  357,  355, 5954, 5965, 5964, 5967, 5960, 6257,
-     5988, 5970, 5972, 6001,  353,  352,  349,    0, 6004, 5974,
-     5983, 6006, 6257, 6008, 5989,  339,  314,  310, 6005, 6002,
-
-     6257, 6006,    0,  307,  305,    0, 6010,  303,  276,  273,
-      267,  260,  254,    0,  220,  214, 6257, 6080, 6084, 6088,
-     6092, 6096, 6100, 6102,  232, 6104, 6106, 6108, 6110, 6112,
-     6114, 6116, 6118, 6120, 6122, 6126, 6128, 6130, 6132, 6134,
-     6136, 6138, 6140, 6142, 6144, 6146, 6148, 6150, 6152, 6154,
-     6156, 6158, 6160, 6162, 6164, 6166, 6168, 6170, 6172, 6174,
-     6176, 6178,  231, 6180, 6182, 6184,  230, 6186, 6188, 6190,
-      228,  226, 6192, 6194, 6196,  224, 6200, 6204, 6206, 6208,
-      223,  219, 6212, 6216, 6218, 6220, 6222, 6224, 6226,  217,
-     6228, 6230, 6232, 6234, 6236,  145, 6238, 6240, 6242,  131,
-
-     6244,  117, 6246, 6248, 6250,   80, 6252
+        1,    0,   50,    0,   99,    0, 4292, 4292, 4292,  146,
+      148,  151,  200,  249,  291,  291,  156,  278,  278,  315,
+      339,  343,  352,  277,  348,  384,  333,  385,  258,  286,
+      388,  299,  389,  332,  396,  407,  410,  425,  290,  358,
+      299,  342, 4292, 4292,  363, 4292,    0,    0,    0,    0,
+     4292,    0,    0,  378, 4292,  463,  500,  517,  534, 4292,
+      543,  560, 4292,  580,  617,  365,  367,  352,    0,  395,
+      380,  375,  384,  407,  419,  407,  409,  421,  420,  410,
+      419,  418,  427,  421,  426,  435,  436,  495,  516,  541,
+      623,  518,  558,  620,  553,  549,  608,  560,    0,  564,
+
+      607,    0,  641,  612,  616,  628,  619,  634,  615,  620,
+      636,  639,  625,  630,  644,  647,    0,    0,  664,  639,
+      632,  645,  643,  642,  639,  639, 4292,    0,    0,  673,
+      690,  707,  716,  733,  750,  769,  788,    0,  797,    0,
+      654,  642,  643,  657,  658,    0,  681,  679,  708,  713,
+      728,  729,  731,  746,  744,  772,  810,  803,  789,  802,
+      802,  789,  795,  803,  792,  809,  810,  811,  828,  811,
+        0,  798,  813,  808,  833,  818,  815,  803,  838,  839,
+      818,  826,  822,  818,  825,  823,  818,  829,  834,  821,
+      834,  828,  821,  834,  826,  827,  859,  860,  828,  840,
+
+      836,  848,  847,  848,  851,  847,  853,  847,    0,  872,
+      889,  898,  915,  932,  951,  970,    0,  979,  988, 1005,
+     1024, 1033,  843,  910,    0,  842,  848,  885,  911,  909,
+      912,  918,  939,  964,  950,    0,  968,  969,  995, 1018,
+        0,  995, 1027, 1046, 1035, 1022, 1055, 1038, 1024, 1032,
+     1032, 1029, 1043, 1029, 1063, 1048, 1044, 1045, 1067, 1068,
+     1052, 1038, 1043, 1047, 1058, 1049, 1050,    0, 1061, 1063,
+     1054, 1066, 1047, 1053, 1051, 1050, 1071, 1061, 1073, 1074,
+     1076, 1068, 1077, 1069, 1079, 1065, 1074, 1082, 1101,    0,
+     1088, 1086, 1076, 1105, 1094, 1095, 1097, 1107, 1124, 1141,
+
+     1150, 1167, 1186, 1197, 1206, 1225, 1234, 1253, 1107, 1087,
+     1108, 1130, 1141,    0, 1241, 1154, 1180, 1188, 1166, 1196,
+     1236, 1192, 1194, 1229, 1239, 1234, 1249,    0, 1256,    0,
+     1274, 1249, 1276, 1255, 1264, 1257, 1261, 1282, 1261, 1259,
+     1257, 1268, 1259, 1274, 1289, 1275, 1270, 1275, 1265, 1276,
+     1277, 1269, 1283, 1271, 1271, 1269, 1270, 1265, 1303, 1285,
+     1272,    0, 1288, 1308, 1309,    0, 1277, 1278,    0, 1284,
+     1295, 1300, 1290, 1296, 1284, 1287, 1305, 1294, 1282, 1290,
+     1323, 1293, 1308, 1323, 1323, 1340, 1357, 1376, 1385, 1404,
+     1413, 1432, 1441,    0, 1452, 1324, 1462, 1479, 1498, 1352,
+
+     1339, 1337, 1337, 1353, 1379, 1367, 1388, 1408, 1402, 1428,
+     1519, 1447, 1444, 1469, 1474, 1500, 1481,    0, 1532, 1534,
+     1544, 1536, 1546, 1543, 1539, 1531, 1530, 1535, 1555, 1539,
+     1546, 1545, 1549, 1540, 1559, 1551, 1556, 1551, 1552, 1553,
+     1564, 1557, 1553, 1554,    0, 1554, 1567, 1563, 1563, 1572,
+        0, 1575, 1570, 1593, 1594, 1562, 1580,    0,    0, 1571,
+     1567, 1562, 1582,    0,    0, 1579, 1570, 1576, 1577, 1573,
+     1582, 1608, 1587, 1607, 1624, 1641, 1658,    0, 1669, 1607,
+     1679, 1696, 1715, 1726, 1608, 1735, 1754, 1763, 1782, 1769,
+     1605, 1637, 1633, 1651, 1658, 1664, 1770, 1694, 1687, 1703,
+
+     1693, 1779, 1712,    0, 1720, 1730, 1776, 1775, 1763, 1779,
+     1788, 1780, 1780, 1801, 1796, 1797, 1794, 1813, 1797, 1800,
+     1799, 1780, 1801, 1804, 1793, 1804, 1805, 1806, 1806, 1795,
+     1798, 1802, 1798, 1816, 1796, 1797, 1801, 1801,    0, 1821,
+     1819, 1819, 1810, 1819, 1824, 1819, 1824, 1829, 1830, 1810,
+     1847, 1816, 1822, 1818, 1820, 1825,    0, 1831, 1822, 1824,
+     1844, 1845, 1855, 1872, 1891, 1855, 1900, 1919, 1928, 1947,
+     1956,    0, 1856, 1872, 1965, 1982, 2001, 1867, 1866, 1885,
+     1899, 1896, 1915, 1921, 1956, 1945, 1969, 1970, 1969, 1981,
+     1975, 1978, 1998, 1992, 2004, 2001, 1987, 2003, 1992, 1997,
+
+     1996, 2000, 2008, 2011, 2001, 1997, 2013,    0, 2027, 1997,
+     2036, 2006,    0, 2020, 2005, 2013,    0, 2027, 2011, 2018,
+        0,    0,    0, 2012,    0, 2031, 2011, 2025, 2030, 2031,
+        0, 2029, 2024, 2052, 2037, 2037, 2029, 2022, 2043, 2041,
+     2033, 2044, 2039, 2044, 2032, 2032, 2045,    0, 2028, 2049,
+     2050, 2041,    0, 2068, 2085, 2102, 2119,    0, 2068, 2069,
+     2128, 2145, 2164, 2173, 2182, 2201, 2210, 2229, 2083, 2073,
+     2091, 2114, 2119,    0, 2126, 2130, 2138, 2168, 2181, 2181,
+     2205, 2213, 2241, 2215, 2229, 2207, 2218, 2218, 2219, 2214,
+     2235, 2223, 2237, 2221, 2239, 2221, 2255, 2238,    0, 2252,
+
+     2247, 2255, 2261, 2236, 2230, 2264, 2233, 2250, 2242, 2236,
+        0,    0, 2247, 2252, 2244, 2241, 2242,    0, 2258, 2250,
+     2258, 2277, 2252, 2248, 2264, 2259,    0, 2253, 2262, 2257,
+     2254, 2253,    0,    0, 2287,    0, 2270, 2271, 2287, 2287,
+     2304, 2321, 2338, 2347, 2366, 2375, 2394,    0, 2288, 2304,
+     2403, 2420, 2439, 2285, 2295, 2307, 2327, 2328, 2346, 2371,
+     2380,    0, 2377, 2385, 2402,    0, 2408, 2424, 2419, 2452,
+     2436, 2438, 2421, 2442, 2441, 2440, 2437,    0, 2428, 2447,
+     2448,    0, 2456, 2455, 2458, 2461, 2442, 2440,    0, 2447,
+     2452,    0,    0,    0, 2444, 2441,    0,    0,    0, 2455,
+
+     2452,    0, 2450, 2454, 2459, 2457, 2461, 2455, 2463,    0,
+        0,    0, 2454, 2450, 2468, 2473, 2483, 2500,    0, 2483,
+     2484, 2517, 2534, 2553, 2562, 2581, 2590, 2609, 2495,    0,
+     2501,    0, 2497, 2513, 2515, 2527,    0, 2556, 2541, 2565,
+     2575, 2579, 2596, 2594, 2595, 2591, 2594, 2626,    0, 2600,
+     2595, 2604, 2613,    0,    0,    0,    0, 2613, 2615, 2616,
+        0, 4292, 4292, 2634, 2616, 2614, 2604, 2638, 2621, 2613,
+     2627,    0, 2615, 2621,    0, 2641, 2641, 2658, 2675, 2692,
+     2711, 2720, 2739, 2642, 2658, 2748, 2765, 2784, 2641, 2651,
+        0, 2667,    0, 2679, 2688, 2695, 2719, 2710,    0, 2742,
+
+     2730, 2752,    0, 2764, 2770,    0,    0,    0, 2769, 2783,
+     2780, 2799, 2774, 2783, 2784,    0, 2786,    0, 2772, 2773,
+     2782, 2782, 2806, 2823, 2840, 2806, 2807, 2857, 2874, 2893,
+     2902, 2921, 2930, 2949, 2801, 2809, 2827,    0,    0, 2838,
+     2838, 2886, 2873, 2895,    0, 2887, 2898, 2902, 2912, 2919,
+        0, 2933, 2934, 2930, 2946, 2938, 2934, 2949, 2930, 2951,
+     2958, 2959, 2969, 2986, 3003, 3022, 3031, 3050, 2969, 2970,
+     3059, 3076, 3095, 2981, 3015,    0, 2978, 3006, 3056, 3012,
+     3081, 3019, 3063, 3075, 3089, 3090, 3078, 3093, 3089, 3079,
+     3100,    0, 3083,    0,    0, 3113, 3130, 3147, 3164, 3113,
+
+     3114, 3181, 3198, 3217, 3226, 3245, 3254, 3273, 3111, 3124,
+     3160,    0, 3151, 3148, 3175, 3169, 3181, 3189,    0, 3281,
+     3187,    0, 3221, 3221, 3221, 3245, 3260,    0, 3287, 3276,
+     3304, 3287, 3321, 3338, 3357, 3366, 3385, 3288, 3304, 3394,
+     3411, 3430, 3279, 3304, 3418, 3336, 3333,    0, 3345, 3360,
+     3352,    0, 3437, 3376, 3402, 3375, 3405,    0, 3406, 3417,
+     3421, 3435, 3449, 4292, 3466, 3483, 3436, 3437, 3500, 3519,
+     3528, 3547, 3556,    0, 3433, 3445, 3448, 3560, 3446, 3463,
+     3463, 3480, 3494, 3506, 3512, 3533, 3536,    0, 3518,    0,
+     3550, 3551, 3580, 3565, 3597, 3614, 3631, 3650, 3566, 3567,
+
+     3659, 3553, 3565, 3555, 3564, 3583, 3578, 3688, 3595, 3728,
+        0,    0,    0,    0,    0,    0,    0, 3626, 3765, 3632,
+     3782, 3799,    0, 4292, 3816,    0, 3634, 3671, 3672, 3663,
+     3845, 3723, 3885, 3760,    0, 3718, 3922, 3939, 4292, 3765,
+     3779, 3782, 3784, 3811, 3824, 3860, 3880, 3920, 3908, 3956,
+     3940, 3973, 3990, 3935, 3941, 3957, 3952, 3988, 3976, 3977,
+     4292, 3997, 3985, 3980,    0, 4011, 4028, 4045,    0, 3996,
+     3993, 4007, 4008, 4292, 4044, 4032,    0, 4052, 4055, 4056,
+     4066, 4083, 4051, 4046,    0, 4081, 4292, 4082,    0, 4100,
+     4117, 4134, 4080,    0, 4292,    0, 4151, 4101, 4168, 4185,
+
+        0, 4117, 4202, 4219, 4118, 4135, 4236, 4253, 4262, 4151,
+     4292
     } ;
 
-static yyconst flex_int16_t yy_def[1208] =
+static yyconst flex_int16_t yy_def[1212] =
     {   0,
-     1117,    1, 1118, 1118, 1119, 1119, 1117, 1117, 1117, 1117,
-     1117, 1120, 1121, 1122, 1117, 1117,   16, 1117, 1117, 1117,
-       20,   20,   22,   22,   22,   22,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26, 1117, 1117, 1117, 1117, 1117, 1117, 1120, 1117,
-     1121, 1122, 1117, 1117, 1123, 1117, 1124,   56, 1117, 1125,
-     1117, 1117,   26,   26,   64,   64,   64,   26,   26,   26,
-       26,   26,   64,   26,   26,   64,   64,   26,   26,   26,
-       26,   26,   26,   64,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26, 1117, 1123, 1117, 1126,  126, 1127, 1117,
-     1125, 1117,  132,   64,  134,  134,   26,   26,   26,   26,
-       26,   26,  134,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26, 1117,  199,
-
-     1128, 1129, 1130, 1117,  204, 1117, 1117, 1117,  207,  134,
-      210,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26, 1117,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,  200,  200, 1129, 1131, 1132,
-     1117, 1117, 1117,  282, 1117, 1117,  286, 1117,  288,  210,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26, 1117,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1133, 1117, 1134,
-     1135, 1117, 1117,  363, 1117,  365, 1117, 1117, 1117, 1117,
-     1117,  370,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26, 1136,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1117,
-     1117,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1137,
-     1138, 1139, 1117, 1117, 1117, 1117, 1117,  446, 1117, 1117,
-     1117,  451, 1117,  453,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26, 1117,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26, 1117, 1117,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1134, 1117, 1140,
-     1141, 1117, 1117, 1117,  524, 1117,  526, 1117, 1117, 1117,
-     1117, 1117,  531,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26, 1117,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1117, 1117,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-
-       26, 1142, 1143, 1144, 1117, 1117, 1117, 1117, 1117,  608,
-     1117, 1117,  612, 1117,  614,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-     1117,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26, 1117, 1117,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26, 1145, 1117, 1146, 1147,
-     1117, 1117,  682, 1117,  684, 1117, 1117, 1117, 1117,  688,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26, 1117,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1117, 1117,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26, 1148, 1149, 1150, 1117, 1117, 1117, 1117,
-      749, 1117,  752, 1117,  754,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1117,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26, 1117, 1117,   26,   26,
-       26,   26,   26,   26,   26,   26, 1151, 1117, 1152, 1153,
-
-     1117,  801, 1117,  803, 1117, 1117, 1117, 1117,  807,   26,
-       26,   26,   26,   26,   26,   26,   26,   26, 1117,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1154,
-     1155, 1156, 1117, 1117, 1117, 1117,  845, 1117,  848, 1117,
-      850,   26,   26,   26,   26,   26,   26,   26, 1117,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26, 1157, 1117, 1158, 1159, 1117,  879,
-     1117,  881, 1117, 1117, 1117, 1117,  885,   26,   26,   26,
-       26,   26, 1117,   26,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26, 1160, 1161, 1162, 1163,
-     1117, 1117, 1117, 1117,  913, 1117,  916, 1117,  918,   26,
-       26,   26,   26, 1117, 1117,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1164, 1117, 1165,
-     1117, 1166, 1117,  943, 1117,  945, 1117, 1117, 1117, 1167,
-      949,   26,   26,   26, 1117, 1117,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1168,
-     1169, 1117, 1170, 1171, 1117, 1117, 1117,  977, 1117,  979,
-     1172,   26,   26,   26,   26,   26, 1117, 1117,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1173,
-
-     1117, 1174, 1175, 1117, 1004, 1117, 1117, 1176,   26,   26,
-       26,   26,   26, 1117, 1177,   26, 1178,   26,   26,   26,
-       26,   26,   26,   26, 1179, 1117, 1180, 1181, 1117, 1117,
-     1182,   26,   26,   26,   26,   26, 1183, 1117, 1184,   26,
-       26, 1185, 1186, 1187, 1117,   26,   26,   26,   26, 1117,
-     1117, 1117,   26,   26,   26, 1188, 1117, 1189, 1190,   26,
-       26,   26,   26, 1117, 1117, 1117, 1117,   26,   26,   26,
-       26, 1191, 1192, 1193,   26,   26,   26,   26, 1117, 1117,
-     1117,   26,   26,   26, 1194, 1117, 1195, 1196,   26,   26,
-       26, 1117, 1117,   26,   26, 1197, 1198, 1199,   26,   26,
-
-     1117,   26, 1200, 1117, 1201, 1202,   26, 1117, 1203, 1204,
-     1197, 1117, 1205, 1206, 1207, 1117,    0, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-
-     1117, 1117, 1117, 1117, 1117, 1117, 1117
+     1211,    1, 1211,    3, 1211,    5, 1211, 1211, 1211, 1211,
+       10, 1211, 1211, 1211, 1211, 1211,   16, 1211, 1211,   16,
+       20,   21,   21,   21,   21,   21,   26,   26,   26,   29,
+       29,   29,   29,   29,   29,   29,   26,   29,   29,   29,
+       29,   29, 1211, 1211, 1211, 1211,   10,   11,   10,   12,
+     1211,   13,   14, 1211, 1211, 1211,   17, 1211,   57, 1211,
+     1211, 1211, 1211, 1211,   64,   65,   65,   65,   64,   64,
+       64,   64,   64,   65,   64,   64,   65,   65,   64,   64,
+       64,   64,   64,   64,   65,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64, 1211,   14,   56,   17,
+       58,  130, 1211, 1211, 1211, 1211,  136,   64,   65,   64,
+      139,  139,   64,   64,   64,   64,   64,   64,  139,   64,
+       64,   64,   64,  139,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   17,
+      210,  133,  133,   58, 1211,  215,  135, 1211,  136, 1211,
+      219,  139,  222,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64, 1211,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,  210,  211,  213,  133, 1211, 1211,
+
+      215, 1211,  301, 1211,  136,  305,  136,  307,  222,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64, 1211,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   58, 1211,  299,   58, 1211,  215,  389,
+      215,  391, 1211,  304, 1211, 1211,  307, 1211,  397,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+     1211,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64, 1211,
+     1211,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,  299,  299, 1211, 1211,  388, 1211, 1211,
+      391, 1211,  481, 1211,  395,  307,  486,  136,  488,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+     1211,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64, 1211, 1211,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+      386, 1211,  476,   58, 1211,  479,  391,  567,  215,  569,
+     1211,  484,  395, 1211,  488, 1211,  575,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64, 1211,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64, 1211, 1211,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   58,  476, 1211, 1211,  565,  479, 1211,
+      569, 1211,  661, 1211,  488,  665,  136,  667,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64, 1211,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64, 1211, 1211,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,  476, 1211,
+      656,   58, 1211,  569,  744,  215,  746,  664,  395, 1211,
+      667, 1211,  751,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64, 1211,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64, 1211, 1211,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,  563,  656, 1211,  743,  479,
+     1211,  746, 1211,  822,  667,  825,  136,  827,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+     1211,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64, 1211, 1211,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   58, 1211,  818,   58,  746,
+      880,  215,  882,  395, 1211,  827, 1211,  886,   64,   64,
+       64,   64,   64,   64,   64,   64,   64, 1211,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,  656,  818, 1211,  479, 1211,  882, 1211,  928,
+      827,  931,  136,  933,   64,   64,   64,   64,   64,   64,
+       64, 1211,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+      741, 1211,  925, 1211,  882,  965,  215,  967,  395, 1211,
+      933, 1211,  971,   64,   64,   64,   64,   64, 1211,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   58,  925, 1211, 1211,  479,
+
+     1211,  967, 1211, 1002,  933, 1005,  136, 1007,   64,   64,
+       64,   64, 1211, 1211,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,  818, 1211,
+      998, 1211, 1211,  967, 1034,  566, 1036,  395, 1211, 1007,
+     1211, 1040,   64,   64,   64, 1211, 1211,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,  878,  998, 1211, 1033, 1211,  479, 1211,  566, 1069,
+     1007, 1071, 1211,   64,   64,   64,   64,   64, 1211, 1211,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   58, 1211, 1033, 1211,  566, 1097,  395, 1211,
+
+     1211,   64,   64,   64,   64,   64, 1211, 1211,   64, 1108,
+       64,   64,   64,   64,   64,   64,   64,   64,  925, 1211,
+     1096, 1211,  566, 1211, 1211,   64,   64,   64,   64,   64,
+     1211, 1211, 1131,   64,   64,  963, 1096, 1211, 1211,   64,
+       64,   64,   64, 1211, 1211, 1211,   64,   64,   64,  964,
+     1211, 1138, 1211,   64,   64,   64,   64, 1211, 1211, 1211,
+     1211,   64,   64,   64,   64,  998, 1138, 1211,   64,   64,
+       64,   64, 1211, 1211, 1211,   64,   64,   64, 1031, 1211,
+     1168, 1211,   64,   64,   64, 1211, 1211,   64,   64, 1032,
+     1168, 1211,   64,   64, 1211,   64, 1211, 1211, 1192, 1211,
+
+       64, 1211, 1192, 1211, 1190, 1211, 1204, 1003, 1204, 1211,
+        0
     } ;
 
-static yyconst flex_int16_t yy_nxt[6333] =
+static yyconst flex_int16_t yy_nxt[4342] =
     {   0,
-        8,    9,   10,   11,   12,   13,   14,    8,    8,    8,
-        8,   15,   16,   17,   17,   17,   17,   17,   17,   17,
-       17,   18,   19,   20,   21,   22,   23,   24,   25,   26,
-       27,   28,   29,   30,   31,   32,   33,   34,   35,   29,
-       36,   37,   38,   39,   40,   41,   29,   42,   29,   20,
-       21,   22,   23,   24,   25,   26,   27,   28,   29,   30,
-       31,   32,   33,   34,   35,   29,   36,   37,   38,   39,
-       40,   41,   29,   42,   29,   46,   47,   48,   47,   54,
-     1117,   63,  946,   55,   56,   56,   56,   56,   56,   56,
-       56,   56,   56,   57,   64,   58,   58,   58,   58,   58,
-
-       58,   88,   59,   63,  119,   63, 1117,   63,   63,   63,
-       99,   63,  100,   46,   47,   63,   91,   83,   60, 1110,
-       64,   58,   58,   58,   58,   58,   58,   88,   59,   63,
-      119,   63,   63, 1108,   63,   63,   99,   63,  100,   48,
-       47,   63,   91,   83,   60,   63,   63, 1098,   64,   64,
-       64,   64,   64,   64,   64,   64,   64,   57,   63,   64,
-       64,   65,   66,   64,   67,   63,   68,   63,   63,   63,
-       69,   63,   70,   63,   63,   63,   63,   63,   63,   71,
-       63,   63,   63,   63,   63,   64,   64,   65,   66,   64,
-       67,   63,   68,   63,   63,   63,   69,   63,   70,   63,
-
-       63,   63,   63,   63,   63,   71,   63,   63,   63,   63,
-       63,   64,   64,  135,   64,   46,   47,  122,  136, 1074,
-       63, 1045,   63,   63,  137, 1044, 1031,   63, 1008,   72,
-     1003,   84,  981,  942,  131, 1114,  123,   64,   64,  135,
-       64, 1114,   63,  122,  136,   63,   63,   85,   63,   63,
-      137,   86,   63,   63,   92,   72,   73,   84,   64,   64,
-       93,   64,  123,   94,   89,  142,   63,   74,   63,   63,
-       75,   63,   90,   85,   63, 1114,   63,   86,   63,   63,
-       92, 1106,   73,   63,   64,   64,   93,   64, 1117,   94,
-       89,  142,   63,   74, 1114,   63,   75, 1106,   90,  138,
-
-       63,  140,   63,   64,  139,   63,   76,   77,  143,   63,
-      147,   78,  146,   63,   63,  148,   79,   80,   63,   63,
-       81,  141,   63,   82, 1111,  138, 1106,  140, 1088,   64,
-      139, 1106,   76,   77,  143, 1088,  147,   78,  146,   63,
-       63,  148,   79,   80,   63,   63,   81,  141,   63,   82,
-       63,   63,   63,   63,   63,   63,   63,   63,   63, 1117,
-      972,   63,   63,   63,   63,   63,   63,   95,   63,  155,
-     1088,   96,   63, 1059, 1096,   63, 1088,   97, 1059,  168,
-       63,   87,   98,   63,  941,  101,  102,   63,   63,   63,
-       63,   63,   63,   95,   63,  155,  103,   96,   63,  104,
-
-      105,   63,   63,   97,  106,  168,   63,   87,   98,   63,
-      151,  101,  102,   63,  107,  120, 1059, 1028,   63,  121,
-       63,  910,  103, 1059, 1028,  104,  105, 1056,   63,  150,
-      106,   63,  114,  115,  149,   63,  151, 1028,  974,   63,
-      107,  120,  116,  144,   63,  121,   63,  108,   63,  109,
-      117,  145,  110,  111,   63,  150,   63,   63,  164,  118,
-      149,   63,   63,   63,  112,  113,  878,  950,  116,  144,
-     1028,  974,  941,  108,   63,  109,  117,  145,  110,  111,
-       63,  130,   63,  914,  164,  118,  174,  974,   63,   63,
-      112,  113,  126,  126,  126,  126,  126,  126,  126,  126,
-
-      126,  127,  183,  128,  128,  128,  128,  128,  128,  153,
-       59,  128,  128,  128,  128,  128,  128,  128,  128,  128,
-       63,   63,  941, 1000,  886,  974,  972,  941,  183,  128,
-      128,  128,  128,  128,  128,  153,   59,  132,  132,  132,
-      132,  132,  132,  132,  132,  132,   63,   63,  133,  133,
-      133,  133,  133,  133,  200,  200,  200,  200,  200,  200,
-      200,  200,  200, 1117,  878,  209,  209,  209,  209,  209,
-      209,  209,  209,  209,  133,  133,  133,  133,  133,  133,
-      134,  134,  134,  134,  134,  134,  134,  134,  134,  127,
-      156,  134,  134,  134,  134,  134,  134,  152,   68,  154,
-
-      800,  846,  941,   63,   63,  878,  130,   63,  808,  157,
-      910,   63,  158,   63,  159,  878,  156,  134,  134,  134,
-      134,  134,  134,  152,   68,  154,   63,  160,   63,   63,
-       63,  161,  167,   63,   63,  157,  162,   63,  158,   63,
-      159,  165,  171,   63,   63,  800,   63,   63,  907,  166,
-      163,   63,   63,  160,   63,  893,   63,  161,  167,  169,
-       63,  172,  162,  173,   63,  750,   63,  165,  171,   63,
-       63,   63,   63,   63,  170,  166,  163,   63,  175,  177,
-      176,   63,   63,  178,  179,  169,   63,  172,   63,  173,
-       63,  180,   63,  181,  182,   63,  184,   63,  185,   63,
-
-      170,  193,   63,  186,  175,  177,  176,   63,  187,  178,
-      179,  190,   63,   63,   63,  188,   63,  180,  191,  181,
-      182,   63,  184,   63,  185,   63,  878,  193,   63,  186,
-       63,  194,  189,  196,  187,   63,  192,  190,  195,   63,
-       63,  188,   63,   63,   63,  197,  211,   63,   63,   63,
-      212,  198,   63,   63,  800,  680,   63,  194,  189,  196,
-      689,   63,  192,  225,  195,  130,   63,  800,  680,   63,
-       63,  197,  211,   63,   63,   63,  212,  198,   63,   63,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,   57,
-      218,  200,  200,  200,  200,  200,  200,   63,   59,  130,
-
-      609,   63,  800,  680,  797,  532,  130,  680,  221,   63,
-      521,  521,  447,  680,  521,  130,  218,  200,  200,  200,
-      200,  200,  200,   63,   59,  204,  204,  204,  204,  204,
-      204,  204,  204,  204,  221,   63,  205,  205,  205,  205,
-      205,  205,  371,   63,  277,  277,  277,  277,  277,  277,
-      277,  277,  277,  130,  231,  521,  361,  602,  283,  521,
-      361,   63,  205,  205,  205,  205,  205,  205,  206,   63,
-      207,  207,  207,  207,  207,  207,  207,  207,  207,  208,
-      231,  209,  209,  209,  209,  209,  209,   63, 1117,  361,
-      284,  284,  284,  284,  284,  284,  284,  284,  284,  208,
-
-      130,  361,  203,  130, 1117,  361,  203,  209,  209,  209,
-      209,  209,  209,  210,  210,  210,  210,  210,  210,  210,
-      210,  210,   57,  216,  210,  210,  210,  210,  210,  210,
-      213,  214,  215,   63,  217,  358,   63,   63,   63,  219,
-      222,   63,   63,   63,   63,  220, 1117,  223,  326,  216,
-      210,  210,  210,  210,  210,  210,  213,  214,  215,   63,
-      217,   63,   63,   63,   63,  219,  222,   63,   63,   63,
-       63,  220,  224,  223,  226,  227,  228,  232,  234,  229,
-       63,  230,  233,   63,   63,  130,  203,   63,   63,  203,
-      203,   63,  241,   63,   63,   63,   63,  235,  224,  130,
-
-      226,  227,  228,  232,  234,  229,   63,  230,  233,   63,
-       63,  236,  237,  242,   63,   63,  238,   63,  239,   63,
-       63,   63,   63,  235,   63,  240,   63,  244,   63,   63,
-      247,   63,   63,  243,   63,   63,  248,  236,  237,  242,
-      253,   63,  238,  130,  239,  245,  246,   63,   63,   63,
-       63,  240,   63,  244,   63,   63,  252,   63,   63,  243,
-       63,   63,  248,  249,   63,  255,  253,  258,  254,  257,
-       52,   63,  250,   63,   63,   63,  251,   63,  256,   63,
-       63,   63,  252,   63,   63,   63,  259,   63,   53,  249,
-       63,  255,   63,  258,  254,  257,  261,   63,  250,  260,
-
-       63,  264,  251,   63,  256,   63,   63,   63,   63,   63,
-       63,   63,  259,   63,  262,  266,  263,   63,   63,   63,
-      265,   63,  261,  267,   50,  260,   63,   63,  268,  124,
-       63,   62,  269,  272,   63,   63,  270,   61,  291,  271,
-      262,  266,  263,   63,   63,   63,  265,   63,  273,  267,
-       63,   63,   63,   63,  268,   63,   63,  275,  269,  272,
-       63,   63,  270,  274,  291,  271,   63,   63,   53,   50,
-       63, 1117,   44,   44,  273, 1117,   63,   63,   63,  305,
-       63,   63, 1117,  275, 1117, 1117,   63, 1117, 1117,  274,
-     1117,   63,   63,   63,  285,  285,  285,  285,  285,  285,
-
-      285,  285,  285, 1117,  296,  305,   63,  276,  276,  276,
-      276,  276,  276,  276,  276,  276,   57,   63,  277,  277,
-      277,  277,  277,  277, 1117,   59,  287,  287,  287,  287,
-      287,  287,  287,  287,  287, 1117, 1117, 1117,   63, 1117,
-     1117, 1117, 1117, 1117,  277,  277,  277,  277,  277,  277,
-      294,   59,  281,   63,  282,  282,  282,  282,  282,  282,
-      282,  282,  282,  283,   63,  284,  284,  284,  284,  284,
-      284, 1117,   63, 1117, 1117, 1117,  294, 1117, 1117,   63,
-     1117, 1117, 1117,  300, 1117, 1117, 1117, 1117, 1117, 1117,
-       63,  284,  284,  284,  284,  284,  284,  206,   63,  286,
-
-      286,  286,  286,  286,  286,  286,  286,  286,  208,  300,
-      287,  287,  287,  287,  287,  287,   63,  292, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117,  315, 1117, 1117, 1117,
-     1117, 1117, 1117,   63,  297,  293,  287,  287,  287,  287,
-      287,  287,  288,  288,  288,  288,  288,  288,  288,  288,
-      288,   63,  315,  289,  289,  289,  289,  289,  289,   63,
-     1117,  293, 1117, 1117, 1117, 1117, 1117, 1117,   63, 1117,
-     1117, 1117,  302, 1117, 1117, 1117,   63,   63,  295,  289,
-      289,  289,  289,  289,  289,  290,  290,  290,  290,  290,
-      290,  290,  290,  290,   63,  298,  290,  290,  290,  290,
-
-      290,  290,   63,  299,  295,   63,   63,  303,  301,   63,
-      304,   63,   63,  306,  307,  309,  311,   63,   63,  312,
-     1117,  298,  290,  290,  290,  290,  290,  290,   63,  299,
-      308,   63,   63,  303,  301,   63,  304,   63,   63,  310,
-      307,  313,  311,   63,   63,  316,   63,   63,   63,   63,
-      314,   63,  318,   63,   63,   63,  308,   63,  317,   63,
-      325, 1117, 1117, 1117, 1117,  310, 1117,  313, 1117,  323,
-     1117,  316,   63,   63,   63,   63,  314,   63,  319,   63,
-      324,   63,   63,   63,  317,   63,   63,  320,  321,  322,
-      327,  331,  330,   63,   63,  323,   63,  329,   63,   63,
-
-       63, 1117, 1117,  333,  319,  328,  324,   63,   63,   63,
-       63,  332,   63,  320,  321,  322,  327,  331,  330,   63,
-       63,  337,   63,  329,   63,   63,   63,   63,  334,  333,
-     1117,  328,  339,   63,   63,   63,   63,  332,   63,  335,
-       63,  338, 1117,  336,  340,  341,   63,  337,   63, 1117,
-       63,  343,  342,   63,  334,   63,   63,  344,  339,  345,
-       63,  351,   63,  348,   63,  335,   63,  338,   63,  336,
-      340,  341,   63,   63,   63,   63,   63,  343,  342,   63,
-      346,   63,   63,  344,  349,  345,  350,  351,   63,  348,
-       63,   63,  353,  354,   63,  347,  357,   63,  352,   63,
-
-     1117,   63,   63,  355, 1117,   63,  346,   63,  356,  375,
-      349,   63,  350,   63,   63,   63,   63,   63,  390,  354,
-       63,  347,  374,   63,  352,   63,   63,   63,   63,  355,
-       63, 1117, 1117,   63,  356,  375, 1117,   63, 1117,   63,
-       63,   63, 1117, 1117,  390, 1117,   63, 1117,  374, 1117,
-     1117,   63,   63,   63,  382, 1117,   63,  276,  276,  276,
-      276,  276,  276,  276,  276,  276, 1117,  362,  362,  362,
-      362,  362,  362,  362,  362,  362,  281, 1117,  363,  363,
-      363,  363,  363,  363,  363,  363,  363,  283,   63,  364,
-      364,  364,  364,  364,  364, 1117, 1117,  364,  364,  364,
-
-      364,  364,  364,  364,  364,  364, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117,  391,   63,  364,  364,  364,  364,  364,
-      364,  365,  365,  365,  365,  365,  365,  365,  365,  365,
-      373,   63,  366,  366,  366,  366,  366,  366,  367,  391,
-      285,  285,  285,  285,  285,  285,  285,  285,  285, 1117,
-      383, 1117, 1117, 1117, 1117, 1117,  373,   63,  366,  366,
-      366,  366,  366,  366,  206, 1117,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  208,   63,  369,  369,  369,
-      369,  369,  369, 1117,   63,  369,  369,  369,  369,  369,
-      369,  369,  369,  369, 1117,   63, 1117, 1117, 1117, 1117,
-
-     1117, 1117,   63,  369,  369,  369,  369,  369,  369,  206,
-       63,  370,  370,  370,  370,  370,  370,  370,  370,  370,
-      371,   63,  372,  372,  372,  372,  372,  372, 1117,  376,
-      372,  372,  372,  372,  372,  372,  372,  372,  372,  384,
-       63,   63,  377,   63,  394,   63,  385,  381,  372,  372,
-      372,  372,  372,  372,  378,  376,   63,  379,   63,  380,
-      388,   63,   63,  389,  392,  384,   63,   63,  377,   63,
-      386,   63,  385,  381,  387,   63,   63,  393,   63,   63,
-      378,  397,   63,  379,   63,  380,  388,   63,   63,  389,
-      392,  395,  407,  400,   63,  398,  386,  396,  399,   63,
-
-      387,   63,   63,  393,   63,   63,  401,   63,   63, 1117,
-       63,  404,  408,  402, 1117,   63, 1117,  395,   63,  400,
-       63,  398,   63,  396,  399,   63,   63,   63,  410,  403,
-      406,   63,  401,   63,   63,   63,   63,  404,  408,  402,
-      405,   63,  415,  411,   63,  409,   63,  413,   63,   63,
-       63,  414,   63,   63,  410,  403,  406,   63,   63,  412,
-      416,   63, 1117,   63,  418,   63,  405,   63,  415,  411,
-       63,  409,   63,  413,  417,   63,   63,  414,  422,  419,
-       63,   63,   63,  423,   63,  412,  416,  424,   63,   63,
-      418,   63,  420,   63,   63,   63,   63,  421,   63,  425,
-
-      417,  426,   63,  427,   63,  419,   63,   63,   63,  423,
-       63,  428,   63,  424,   63,   63,  429,   63,  420,  431,
-       63,   63,  430,  421,   63,  425,  434,  426,   63,  427,
-       63,   63,   63,   63,  432,   63,   63,  428,   63, 1117,
-      437,   63,  429,   63,  433,  431,   63,   63,  430,   63,
-      439,  436,  434,   63,  435,  458,   63,   63,   63,   63,
-      432,   63,  438,   63,  457,   63,   63,   63,  461,  460,
-      433,   63,   63,   63,   63,   63,  439,  436, 1117,   63,
-      435,  458,   63, 1117, 1117,   63, 1117, 1117,  438,   63,
-      457,   63,   63,   63,  461,  460,  455,   63, 1117,  443,
-
-       63,  362,  362,  362,  362,  362,  362,  362,  362,  362,
-      281,   63,  444,  444,  444,  444,  444,  444,  444,  444,
-      444,  283, 1117,  445,  445,  445,  445,  445,  445, 1117,
-       63,  445,  445,  445,  445,  445,  445,  445,  445,  445,
-      449,  449,  449,  449,  449,  449,  449,  449,  449,  445,
-      445,  445,  445,  445,  445,  281,   63,  446,  446,  446,
-      446,  446,  446,  446,  446,  446,  447,  456,  448,  448,
-      448,  448,  448,  448, 1117,  493,  448,  448,  448,  448,
-      448,  448,  448,  448,  448, 1117, 1117,   63, 1117, 1117,
-      472, 1117, 1117,  456,  448,  448,  448,  448,  448,  448,
-
-      206,  493,  450,  450,  450,  450,  450,  450,  450,  450,
-      450,  208,  206,   63,  451,  451,  451,  451,  451,  451,
-      451,  451,  451,  371,   63,  452,  452,  452,  452,  452,
-      452, 1117, 1117,  452,  452,  452,  452,  452,  452,  452,
-      452,  452, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-       63,  452,  452,  452,  452,  452,  452,  453,  453,  453,
-      453,  453,  453,  453,  453,  453,  459,  462,  454,  454,
-      454,  454,  454,  454,  463,   63,  464,  465,   63,  469,
-      474,  470,  494,   63,   63,   63,   63,   63, 1117, 1117,
-       63, 1117,  459,  462,  454,  454,  454,  454,  454,  454,
-
-      463,   63,  464,  465,   63,  469,  474,  470,  494,   63,
-       63,   63,   63,   63,  476,  471,   63,  466,  466,  478,
-      466,  466,  466,  466,  466,  466,  467,   63,  466,  473,
-     1117,   63,   63,  479,  475,  477,   63, 1117,  466,  466,
-      476,  471,   63,   63,  480,  478,   63,   63,  481,  482,
-       63,  483,   63,   63,  486,  473,  484,   63,   63,  479,
-      475,  477,   63,   63,   63,   63,  487,  488,   63,   63,
-      480,   63,   63,   63,  481,  482,   63,  483,   63,  485,
-      486,  491,  484,  490,   63,   63,  489,   63,   63,   63,
-       63,   63,  487,  488,   63,   63,  492,   63,  495,  500,
-
-      496,  497,   63,   63,   63,  485,   63,  491,   63,  490,
-       63,   63,  489,   63,   63,  498,   63,   63,  504,  499,
-       63,   63,  492,  501,  495,  500,  496,  497,   63,   63,
-       63,   63,   63,   63,   63,  502,   63,  506,  505,  507,
-       63,  498,   63,   63,  504,  499,   63, 1117,  503,  501,
-       63,   63,  508,  509,  510,   63,   63,   63,   63,   63,
-       63,  502,   63,  511,  505,  512,   63,   63, 1117, 1117,
-       63,   63,   63,   63,  503,   63,   63,   63,  508,  509,
-      510,   63,   63,  515,   63,  516,   63,  537,  513,  511,
-       63,  512,   63,   63,   63,  517,   63,   63,  549,   63,
-
-       63,   63,  514,   63,  539,  541,   63,   63, 1117,  515,
-     1117, 1117, 1117,  537,  513, 1117,   63,   63,   63,   63,
-       63,  517, 1117, 1117,  549, 1117,   63, 1117,  514,   63,
-      539,  541,   63,   63,  522,  522,  522,  522,  522,  522,
-      522,  522,  522,   63,  281,   63,  523,  523,  523,  523,
-      523,  523,  523,  523,  523,  283,  281, 1117,  524,  524,
-      524,  524,  524,  524,  524,  524,  524,  447,  578,  525,
-      525,  525,  525,  525,  525, 1117,  538,  525,  525,  525,
-      525,  525,  525,  525,  525,  525, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117,  578,  525,  525,  525,  525,  525,
-
-      525,  526,  526,  526,  526,  526,  526,  526,  526,  526,
-       63,  554,  527,  527,  527,  527,  527,  527,  528,   63,
-      449,  449,  449,  449,  449,  449,  449,  449,  449, 1117,
-      579, 1117, 1117, 1117, 1117, 1117,   63,  554,  527,  527,
-      527,  527,  527,  527,  206,   63,  450,  450,  450,  450,
-      450,  450,  450,  450,  450,  206,  579,  529,  529,  529,
-      529,  529,  529,  529,  529,  529,  371,   63,  530,  530,
-      530,  530,  530,  530, 1117,   63,  530,  530,  530,  530,
-      530,  530,  530,  530,  530, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117,   63,  530,  530,  530,  530,  530,  530,
-
-      206,   63,  531,  531,  531,  531,  531,  531,  531,  531,
-      531,  532,  546,  533,  533,  533,  533,  533,  533, 1117,
-      540,  533,  533,  533,  533,  533,  533,  533,  533,  533,
-      542, 1117,   63,  548,   63,  543,   63,  547,  546,  533,
-      533,  533,  533,  533,  533,  534,  540,  550,  535,   63,
-      544,  545,  563,   63,  536,   63,  542,  551,   63,  548,
-       63,  543,   63,  547,  553,   63,  552,   63,  552, 1117,
-       63,  534, 1117,  550,  535,   63,  544,  545,   63,   63,
-      536,   63,  562,  551,   63,  558,  559,  560,   63,  555,
-      553,   63,  552,   63,  552,  556,   63,  557,   63,  561,
-
-      564, 1117,   63,   63,   63, 1117,   63,  565,  562, 1117,
-       63,  558,  559,  560,   63,  555, 1117, 1117,  566,  567,
-       63,  556,  568,  557,   63,  561,  564,   63,   63,   63,
-     1117,  569,   63,  565,   63,   63,  570,  571, 1117,  572,
-       63, 1117,  573,   63,  566,  567,   63,   63,  568,  575,
-     1117,  574,  580,   63,   63,   63,  576,  569,   63,   63,
-       63,   63,  570,  571,   63,  572,   63,   63,  573,   63,
-     1117,  577,   63,   63, 1117,  575,   63,  574,  580,  585,
-       63,   63,  576, 1117,   63,   63,   63,  581,   63,  582,
-       63,  586,  583,   63,   63,  584,   63,  577,   63,   63,
-
-      588,  587,   63,  589,  627,  585,   63,  594,   63,   63,
-      590, 1117,   63,  581,   63,  582,   63,  586,  583,  591,
-       63,  584,   63,  593,   63,   63,  588,  587,  592,  589,
-      627,  596,   63,  594,   63,   63,  590,   63,   63,  595,
-       63,   63,   63,   63,  597,  591,   63,  599,  598,  593,
-       63,  600,  631,   63,  592,   63,   63,  596,  601,   63,
-     1117,   63, 1117,   63,   63,  595,   63,   63, 1117,   63,
-      597, 1117,   63,  599,  598, 1117, 1117,  600,  631,   63,
-     1117,   63,   63,   63,  601,   63,  605,   63,  522,  522,
-      522,  522,  522,  522,  522,  522,  522,  281, 1117,  523,
-
-      523,  523,  523,  523,  523,  523,  523,  523,  281,   63,
-      606,  606,  606,  606,  606,  606,  606,  606,  606,  447,
-     1117,  607,  607,  607,  607,  607,  607, 1117,   63,  607,
-      607,  607,  607,  607,  607,  607,  607,  607,  611,  611,
-      611,  611,  611,  611,  611,  611,  611,  607,  607,  607,
-      607,  607,  607,  281,   63,  608,  608,  608,  608,  608,
-      608,  608,  608,  608,  609,  619,  610,  610,  610,  610,
-      610,  610, 1117,   63,  610,  610,  610,  610,  610,  610,
-      610,  610,  610, 1117, 1117,   63, 1117, 1117, 1117, 1117,
-     1117,  619,  610,  610,  610,  610,  610,  610,  206,   63,
-
-      450,  450,  450,  450,  450,  450,  450,  450,  450,  371,
-      206,   63,  612,  612,  612,  612,  612,  612,  612,  612,
-      612,  532, 1117,  613,  613,  613,  613,  613,  613, 1117,
-     1117,  613,  613,  613,  613,  613,  613,  613,  613,  613,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,  616,  613,
-      613,  613,  613,  613,  613,  614,  614,  614,  614,  614,
-      614,  614,  614,  614,   63,  617,  615,  615,  615,  615,
-      615,  615,   63,  618,  616,  620,  622,  621,  624,   63,
-       63, 1117,   63, 1117,   63,   63,  628,  623,   63, 1117,
-       63,  617,  615,  615,  615,  615,  615,  615,   63,  618,
-
-       63,  620,  622,  621,  624,   63,   63,  625,   63,  626,
-       63,   63,  628,  623,   63,   63,   63,  633,   63,   63,
-      629,  632,  630,  634,  635,   63,   63, 1117,  638,  639,
-       63, 1117,  637,  625,   63,  626,  636,   63,   63,   63,
-       63,   63,   63,  633,   63,   63,  629,  632,  630,  634,
-      635,   63,   63,  640,  638,  639,   63,  641,  637,  644,
-       63,  642,  636,   63,   63,   63,   63, 1117,   63,   63,
-      643,   63,   63,  650,  649,   63,   63,  651,   63,  640,
-      645,  646,  647,  641,  648,  644,  652,  642,  653,   63,
-      654,   63,   63,   63,   63,   63,  643,   63,   63,   63,
-
-      649,   63,   63,  651,   63,  656,   63,   63,  657,  655,
-       63,   63,  652,  659,  653,   63,  654,   63,   63,   63,
-       63,  667,  663, 1117,  660,   63,  658,  664,  661,   63,
-       63,  656,   63,   63,  657,  655,   63,   63,   63,  659,
-       63,   63,  662,  665,  669,   63,   63,  667,  668,   63,
-      660,  666,  658,  664,  661,   63,   63,   63, 1117,   63,
-       63,   63,  671,  672,   63,   63,   63,   63,  662,  665,
-      669,   63,  670,   63,  668,   63,  673,  666,   63,  674,
-       63,  675,   63,   63,   63,   63,   63,   63,  671,  672,
-       63,   63,  676,   63, 1117,   63,   63,   63,  670,   63,
-
-     1117, 1117,  673, 1117,   63,  674,   63,  675,  695, 1117,
-       63, 1117, 1117, 1117, 1117, 1117,   63, 1117,  676,   63,
-       63,   63,   63,   63,  681,  681,  681,  681,  681,  681,
-      681,  681,  681,  281,  695,  523,  523,  523,  523,  523,
-      523,  523,  523,  523,  447,  281,   63,  682,  682,  682,
-      682,  682,  682,  682,  682,  682,  609, 1117,  683,  683,
-      683,  683,  683,  683, 1117, 1117,  683,  683,  683,  683,
-      683,  683,  683,  683,  683,  611,  611,  611,  611,  611,
-      611,  611,  611,  611,  683,  683,  683,  683,  683,  683,
-      684,  684,  684,  684,  684,  684,  684,  684,  684,  691,
-
-      694,  685,  685,  685,  685,  685,  685, 1117,   63,  687,
-      687,  687,  687,  687,  687,  687,  687,  687, 1117,   63,
-     1117, 1117, 1117, 1117, 1117,  691,  694,  685,  685,  685,
-      685,  685,  685,  206,   63,  686,  686,  686,  686,  686,
-      686,  686,  686,  686,  532,   63,  687,  687,  687,  687,
-      687,  687, 1117, 1117,  690,  690,  690,  690,  690,  690,
-      690,  690,  690,  681,  681,  681,  681,  681,  681,  681,
-      681,  681,  687,  687,  687,  687,  687,  687,  206,  704,
-      688,  688,  688,  688,  688,  688,  688,  688,  688,  689,
-      692,  690,  690,  690,  690,  690,  690,  693,  696,   63,
-
-      697,   63,  698,  699, 1117, 1117,   63,   63,   63, 1117,
-      700,   63, 1117,   63,  705, 1117,  692,  690,  690,  690,
-      690,  690,  690,  693,  696,   63,  697,   63,  698,  699,
-       63,  701,   63,   63,   63,  702,  700,   63,  703,   63,
-      705,   63,  706,   63,  707,  708,  711,  709, 1117,  710,
-       63,   63,   63,   63,   63,   63,   63,  701,  712,  717,
-     1117,  702,   63,  713,  703,   63,   63,   63,  706,   63,
-      707,  708,  711,  709,  715,  710,   63,   63,   63,   63,
-       63,   63,  714,   63,  712,   63,  716,   63,   63,  713,
-      718,   63,   63,   63,   63,  719,  722,  723,  720,  721,
-
-      715,  725,  724,   63,   63, 1117,   63,  728,  714,   63,
-       63,   63,  716,   63,  726,  727,  718,   63,  729,   63,
-       63,   63,   63,   63,   63,  736,   63,  730,  724,   63,
-       63,   63,   63,  728,   63,   63,   63,  733, 1117,  731,
-      726,  727,   63,   63,  729, 1117,  735,   63,   63,   63,
-       63,  732,   63,  730,   63,   63,  737,   63,  734,   63,
-       63,   63,   63,  733,   63,  731,  738,   63,   63,   63,
-       63,  739,  735,  741,   63,   63,   63,  732,   63,  740,
-       63,   63,  737,   63,  734,   63,   63,  742,   63,  762,
-       63,  743,  738,   63, 1117,   63,   63,  739, 1117,  741,
-
-       63,   63,   63,   63,   63,  740,   63,   63, 1117,   63,
-     1117, 1117,   63,  742, 1117,  762, 1117,  743,  748,  748,
-      748,  748,  748,  748,  748,  748,  748, 1117,  763,   63,
-     1117, 1117,   63,   63,  281, 1117,  747,  747,  747,  747,
-      747,  747,  747,  747,  747,  609,   63,  748,  748,  748,
-      748,  748,  748, 1117,  763,  751,  751,  751,  751,  751,
-      751,  751,  751,  751, 1117,   63, 1117, 1117, 1117, 1117,
-     1117, 1117,   63,  748,  748,  748,  748,  748,  748,  281,
-     1117,  749,  749,  749,  749,  749,  749,  749,  749,  749,
-      750,   63,  751,  751,  751,  751,  751,  751,  206,   63,
-
-      450,  450,  450,  450,  450,  450,  450,  450,  450,  532,
-      768, 1117, 1117, 1117, 1117, 1117, 1117, 1117,  751,  751,
-      751,  751,  751,  751,  206,   63,  752,  752,  752,  752,
-      752,  752,  752,  752,  752,  689,  768,  753,  753,  753,
-      753,  753,  753, 1117,  770,  753,  753,  753,  753,  753,
-      753,  753,  753,  753, 1117, 1117, 1117, 1117, 1117, 1117,
-      756, 1117,   63,  753,  753,  753,  753,  753,  753,  754,
-      754,  754,  754,  754,  754,  754,  754,  754,   63, 1117,
-      755,  755,  755,  755,  755,  755,  756,   63,   63,  758,
-      759,  757,   63,  760,   63,   63,   63,  766,  764,  765,
-
-      761,   63,   63, 1117,   63,  767,  755,  755,  755,  755,
-      755,  755,   63,   63,   63,  758,  759,  757,   63,  760,
-       63,   63,   63,  766,  764,  765,  761,   63,   63,  771,
-      769,  767,   63,  772,  773,  774,  775,  776,   63,   63,
-       63,  777, 1117,   63,  778,   63,   63,  783,  779,   63,
-     1117,   63,   63,   63,  780,  771,  769,  781,   63,  772,
-      773,  774,  775,  776,   63,   63,  782,  777,   63,   63,
-      778,   63,   63,   63,  779,   63,   63,   63,   63,   63,
-      784,   63,   63,  786,   63,  785,  787,  788,   63,   63,
-       63,   63,   63,   63,   63,   63,   63,   63, 1117,   63,
-
-      789, 1117,   63,   63,   63, 1117,  784,   63,   63,  786,
-       63,  785,  787,  788,   63,   63,   63,   63,   63,   63,
-      790,   63,   63,   63,  791,  792,  789,  793,  794,   63,
-       63,  796,   63,   63,  795,   63,   63,   63,   63,  811,
-      812,   63,   63,   63,   63,   63,  790,   63, 1117,   63,
-      791,  792, 1117,  793,  794, 1117, 1117,  796,   63,   63,
-      795,   63,   63,   63,   63,  811,  812,   63, 1117,   63,
-       63,   63,  817,   63,  281,   63,  523,  523,  523,  523,
-      523,  523,  523,  523,  523,  609,  281, 1117,  801,  801,
-      801,  801,  801,  801,  801,  801,  801,  750,  817,  802,
-
-      802,  802,  802,  802,  802, 1117, 1117,  802,  802,  802,
-      802,  802,  802,  802,  802,  802, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117,  819, 1117,  802,  802,  802,  802,  802,
-      802,  803,  803,  803,  803,  803,  803,  803,  803,  803,
-      813,   63,  804,  804,  804,  804,  804,  804, 1117,  819,
-      806,  806,  806,  806,  806,  806,  806,  806,  806, 1117,
-      825, 1117, 1117, 1117, 1117, 1117,  813,   63,  804,  804,
-      804,  804,  804,  804,  206, 1117,  805,  805,  805,  805,
-      805,  805,  805,  805,  805,  689,   63,  806,  806,  806,
-      806,  806,  806, 1117,   63,  809,  809,  809,  809,  809,
-
-      809,  809,  809,  809, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117,   63,  806,  806,  806,  806,  806,  806,  206,
-       63,  807,  807,  807,  807,  807,  807,  807,  807,  807,
-      808,  810,  809,  809,  809,  809,  809,  809,  814,  815,
-       63, 1117, 1117,  822,  820,   63,   63,   63, 1117,   63,
-      823,  816,  818,  824,   63, 1117,   63,  810,  809,  809,
-      809,  809,  809,  809,  814,  815,   63,   63,   63,  822,
-      820,   63,   63,   63,  821,   63,  823,  816,  818,  824,
-       63,  826,   63,   63,  827,   63,  828,  829,   63,   63,
-       63,   63,   63,   63,   63,   63, 1117, 1117, 1117,  833,
-
-      821,  836,   63,  830,   63,  831,  832,  826,  837,   63,
-      827,   63,  828,  829,   63,   63,   63,   63,   63,   63,
-      834,   63,   63,   63,  835,  839,   63,  836,   63,  830,
-       63,  831,  832,   63,  838,   63,   63,   63,   63,   63,
-      852,   63,   63, 1117,   63,   63,  834, 1117,   63,   63,
-      835,  839,   63, 1117, 1117,  859, 1117, 1117, 1117,   63,
-      838,   63,   63,   63,   63,   63,  852,   63,   63,  281,
-       63,  843,  843,  843,  843,  843,  843,  843,  843,  843,
-      750,  859,  844,  844,  844,  844,  844,  844, 1117,   63,
-      844,  844,  844,  844,  844,  844,  844,  844,  844, 1117,
-
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,  844,  844,
-      844,  844,  844,  844,  281,   63,  845,  845,  845,  845,
-      845,  845,  845,  845,  845,  846,  858,  847,  847,  847,
-      847,  847,  847, 1117,   63,  847,  847,  847,  847,  847,
-      847,  847,  847,  847, 1117, 1117,   63, 1117, 1117, 1117,
-     1117, 1117,  858,  847,  847,  847,  847,  847,  847,  206,
-       63,  450,  450,  450,  450,  450,  450,  450,  450,  450,
-      689,  206,   63,  848,  848,  848,  848,  848,  848,  848,
-      848,  848,  808, 1117,  849,  849,  849,  849,  849,  849,
-     1117, 1117,  849,  849,  849,  849,  849,  849,  849,  849,
-
-      849, 1117, 1117, 1117, 1117, 1117, 1117,   63, 1117,  853,
-      849,  849,  849,  849,  849,  849,  850,  850,  850,  850,
-      850,  850,  850,  850,  850,  854, 1117,  851,  851,  851,
-      851,  851,  851,   63,  855,  853,  857,  861,   63,  862,
-       63,  863,  856,   63,   63,  860,   63,  864,   63,   63,
-       63,  854,   63,  851,  851,  851,  851,  851,  851,   63,
-      855,   63,  857,  861,   63,  862,   63,  863,  856,   63,
-       63,  860,   63,  864,   63,   63,   63,  865,   63,  866,
-      867,  868,  869,  871,  870,   63,   63,   63,  872, 1117,
-       63,  873,   63,  874,   63,  888,   63,   63,   63,   63,
-
-       63,   63,   63,  865,   63,  866,  867, 1117,  869,  871,
-      870, 1117,   63, 1117,  872,   63,   63,  873,   63,  874,
-       63,  888,   63,   63,   63,   63,   63,   63,   63,  281,
-       63,  523,  523,  523,  523,  523,  523,  523,  523,  523,
-      750,   63,  281, 1117,  879,  879,  879,  879,  879,  879,
-      879,  879,  879,  846,   63,  880,  880,  880,  880,  880,
-      880, 1117, 1117,  880,  880,  880,  880,  880,  880,  880,
-      880,  880, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-       63,  880,  880,  880,  880,  880,  880,  881,  881,  881,
-      881,  881,  881,  881,  881,  881,  894,  890,  882,  882,
-
-      882,  882,  882,  882, 1117,   63,  884,  884,  884,  884,
-      884,  884,  884,  884,  884, 1117,   63, 1117, 1117, 1117,
-     1117, 1117,  894,  890,  882,  882,  882,  882,  882,  882,
-      206,   63,  883,  883,  883,  883,  883,  883,  883,  883,
-      883,  808,   63,  884,  884,  884,  884,  884,  884, 1117,
-       63,  887,  887,  887,  887,  887,  887,  887,  887,  887,
-     1117,  889,  895, 1117, 1117, 1117, 1117, 1117,   63,  884,
-      884,  884,  884,  884,  884,  206,   63,  885,  885,  885,
-      885,  885,  885,  885,  885,  885,  886,  889,  887,  887,
-      887,  887,  887,  887,   63,  891,   63,  892,   63,   63,
-
-      897,  898,  900,  896,   63,  899,  901,   63,   63,  902,
-       63,  921,   63,   63,  887,  887,  887,  887,  887,  887,
-       63,  891,   63,  892,   63,   63,  897,  898,  900,  896,
-       63,  899,  901,   63,   63,  902,   63,  903,   63,   63,
-      904,  905,  906,   63,  920,   63,   63,   63,   63,  926,
-       63,   63,  933,   63,  922,   63,  936,   63,   63, 1117,
-       63, 1117, 1117,  903, 1117, 1117,  904,  905,  906,   63,
-      920,   63, 1117,   63,   63,  926,   63,   63,  933,   63,
-      922,   63,  936,   63,   63,  281,   63,  911,  911,  911,
-      911,  911,  911,  911,  911,  911,  846,   63,  912,  912,
-
-      912,  912,  912,  912, 1117,   63,  912,  912,  912,  912,
-      912,  912,  912,  912,  912, 1117,  929, 1117, 1117, 1117,
-     1117, 1117, 1117,   63,  912,  912,  912,  912,  912,  912,
-      281,   63,  913,  913,  913,  913,  913,  913,  913,  913,
-      913,  914,   63,  915,  915,  915,  915,  915,  915, 1117,
-      935,  915,  915,  915,  915,  915,  915,  915,  915,  915,
-     1117, 1117,   63, 1117, 1117, 1117, 1117, 1117,   63,  915,
-      915,  915,  915,  915,  915,  206,  935,  450,  450,  450,
-      450,  450,  450,  450,  450,  450,  808,  206,   63,  916,
-      916,  916,  916,  916,  916,  916,  916,  916,  886, 1117,
-
-      917,  917,  917,  917,  917,  917, 1117, 1117,  917,  917,
-      917,  917,  917,  917,  917,  917,  917, 1117, 1117, 1117,
-     1117, 1117, 1117,  954,   63,  923,  917,  917,  917,  917,
-      917,  917,  918,  918,  918,  918,  918,  918,  918,  918,
-      918,   63,  924,  919,  919,  919,  919,  919,  919, 1117,
-       63,  923, 1117, 1117, 1117, 1117,  930,   63,  925,  927,
-      937,  955,  931,  932,  934,  956,   63,   63,  924,  919,
-      919,  919,  919,  919,  919,  928,   63,   63,   63,   63,
-       63,   63,  930,   63,  925,  927,  937,  955,  931,  932,
-      934,  956,   63, 1117, 1117,   63, 1117, 1117, 1117, 1117,
-
-     1117,  928,   63,   63,   63,   63,   63,   63,  281, 1117,
-      523,  523,  523,  523,  523,  523,  523,  523,  523,  846,
-      281,   63,  943,  943,  943,  943,  943,  943,  943,  943,
-      943,  914,  987,  944,  944,  944,  944,  944,  944, 1117,
-     1117,  944,  944,  944,  944,  944,  944,  944,  944,  944,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,  987,  944,
-      944,  944,  944,  944,  944,  945,  945,  945,  945,  945,
-      945,  945,  945,  945,  958,  969,  946,  946,  946,  946,
-      946,  946, 1117,   63,  948,  948,  948,  948,  948,  948,
-      948,  948,  948, 1117,   63, 1117, 1117, 1117, 1117, 1117,
-
-      958,  969,  946,  946,  946,  946,  946,  946,  206,   63,
-      947,  947,  947,  947,  947,  947,  947,  947,  947,  886,
-       63,  948,  948,  948,  948,  948,  948, 1117, 1117,  951,
-      951,  951,  951,  951,  951,  951,  951,  951, 1117,  953,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117,  948,  948,  948,
-      948,  948,  948,  206,   63,  949,  949,  949,  949,  949,
-      949,  949,  949,  949,  950,  953,  951,  951,  951,  951,
-      951,  951,  952,  957,  959,   63,  964, 1117,   63,   63,
-       63,  960,  961,  962,   63,  963,  965,  988,  982,   63,
-      966, 1117,  951,  951,  951,  951,  951,  951,  952,  957,
-
-      959,   63,  964,   63,   63,   63,   63,  968,   63,  967,
-       63,   63,  965,  988,  982,   63,  966,   63, 1117,   63,
-      976,  976,  976,  976,  976,  976,  976,  976,  976,   63,
-     1117, 1117,   63,  968,   63,  967, 1117,   63, 1117, 1117,
-       63, 1117, 1117,   63, 1117,   63,  281, 1117,  975,  975,
-      975,  975,  975,  975,  975,  975,  975,  914,   63,  976,
-      976,  976,  976,  976,  976, 1117,   63,  978,  978,  978,
-      978,  978,  978,  978,  978,  978, 1117, 1117, 1117, 1117,
-      993,  994, 1117, 1117,   63,  976,  976,  976,  976,  976,
-      976,  281, 1117,  977,  977,  977,  977,  977,  977,  977,
-
-      977,  977,  989,   63,  978,  978,  978,  978,  978,  978,
-      206,   63,  450,  450,  450,  450,  450,  450,  450,  450,
-      450,  886,   63, 1117, 1117, 1117, 1117, 1117,  989,   63,
-      978,  978,  978,  978,  978,  978,  206,   63,  979,  979,
-      979,  979,  979,  979,  979,  979,  979,  950,   63,  980,
-      980,  980,  980,  980,  980, 1117,  990,  980,  980,  980,
-      980,  980,  980,  980,  980,  980,  983, 1117,  991,  984,
-       63,  992,   63, 1117,  996,  980,  980,  980,  980,  980,
-      980,  985,  990,  995,  999,   63,  997,   63,  986,   63,
-       63,  998,  983,   63, 1014,  984,   63,   63,   63,   63,
-
-      996, 1117,   63, 1117, 1117, 1117, 1117,  985, 1117,  995,
-      999,   63,  997,   63,  986,   63,   63,  998, 1117,   63,
-     1014, 1117, 1117,   63, 1015,   63, 1019,  281,   63,  523,
-      523,  523,  523,  523,  523,  523,  523,  523,  914,  281,
-     1117, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
-     1015,   63, 1005, 1005, 1005, 1005, 1005, 1005, 1117,   63,
-     1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117,   63, 1005, 1005,
-     1005, 1005, 1005, 1005,  206,   63, 1006, 1006, 1006, 1006,
-     1006, 1006, 1006, 1006, 1006,  950, 1010, 1007, 1007, 1007,
-
-     1007, 1007, 1007, 1117, 1009, 1007, 1007, 1007, 1007, 1007,
-     1007, 1007, 1007, 1007,   63, 1011, 1016,   63,   63, 1021,
-     1017,   63, 1010, 1007, 1007, 1007, 1007, 1007, 1007, 1018,
-     1009, 1012, 1020, 1117, 1023,   63, 1022, 1013,   63,   63,
-       63, 1011, 1016,   63,   63, 1032, 1017,   63,   63,   63,
-       63, 1024,   63, 1037,   63,   63,   63, 1012, 1034,   63,
-     1023,   63, 1022, 1013,   63,   63,   63,   63, 1117,   63,
-     1117, 1032, 1117, 1117,   63,   63,   63, 1024,   63, 1037,
-       63,   63,   63, 1117, 1034,   63, 1117, 1117, 1033, 1117,
-     1117, 1117,   63,   63,  281,   63, 1029, 1029, 1029, 1029,
-
-     1029, 1029, 1029, 1029, 1029,   63,   63, 1030, 1030, 1030,
-     1030, 1030, 1030, 1117, 1033, 1030, 1030, 1030, 1030, 1030,
-     1030, 1030, 1030, 1030, 1117, 1035, 1117, 1039,   63,   63,
-       63,   63,   63, 1030, 1030, 1030, 1030, 1030, 1030,  206,
-     1117,  450,  450,  450,  450,  450,  450,  450,  450,  450,
-      950, 1035, 1036, 1039,   63,   63,   63,   63, 1038, 1038,
-       63, 1038, 1038, 1038, 1038, 1038, 1038, 1041, 1117, 1038,
-     1117, 1047, 1048, 1117, 1117, 1117, 1117,   63, 1036, 1038,
-     1038, 1117,   63,   63,   63, 1117,   63, 1066, 1046, 1051,
-     1052, 1049,  281, 1041,  523,  523,  523,  523,  523,  523,
-
-      523,  523,  523,   63,   63,   63,   63,   63,   63, 1061,
-       63, 1054, 1055, 1066, 1046, 1051, 1052, 1049, 1050, 1050,
-     1067, 1050, 1050, 1050, 1050, 1050, 1050,   63,   63, 1050,
-       63,   63,   63,   63, 1117, 1061, 1060, 1054, 1055, 1050,
-     1050,   63, 1062, 1063, 1064, 1065, 1067,   63, 1117,   63,
-     1078, 1117, 1071,   63,   63, 1068, 1069, 1070, 1076,   63,
-     1075,   63, 1060, 1079,   63, 1080, 1081,   63, 1062, 1063,
-     1064, 1065,   63,   63, 1077,   63, 1078,   63, 1071, 1082,
-       63, 1068, 1069, 1070, 1076,   63, 1075,   63, 1083, 1079,
-       63, 1080, 1081, 1084,   63,   63,   63,   63,   63,   63,
-
-     1077, 1089, 1092,   63, 1090, 1082,   63,   63,   63, 1091,
-       63, 1093, 1094,   63, 1083,   63, 1100,   63, 1117, 1084,
-       63,   63,   63,   63, 1095,   63,   63, 1089, 1092, 1101,
-     1090, 1102,   63,   63,   63, 1091,   63, 1093, 1094,   63,
-     1099,   63, 1100,   63,   63,   63, 1107,   63,   63,   63,
-     1095,   63,   63,   63, 1117, 1101, 1117, 1102,   63, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1099, 1117, 1117, 1117,
-       63,   63, 1107,   63,   63,   63, 1117,   63, 1117,   63,
-       43,   43,   43,   43,   45,   45,   45,   45,   49,   49,
-       49,   49,   51, 1117,   51,   51,   52,   52,   52,   52,
-
-      125, 1117,  125,  125,  129,  129,  201,  201,  202,  202,
-      278,  278,  279,  279,  280,  280,  359,  359,  360,  360,
-      440,  440,  441,  441,  442,  442,  468, 1117,  468,  468,
-      518,  518,  519,  519,  520,  520,  603,  603,  604,  604,
-      677,  677,  678,  678,  679,  679,  744,  744,  745,  745,
-      746,  746,  603,  603,  798,  798,  799,  799,  840,  840,
-      841,  841,  842,  842,  875,  875,  876,  876,  877,  877,
-      745,  745,  908,  908,  909,  909,  938,  938,  939,  939,
-      940,  940,  970,  970,  971,  971,  973,  973,  841,  841,
-     1001, 1001, 1002, 1002, 1025, 1025, 1026, 1026, 1027, 1027,
-
-     1038, 1117, 1038, 1038, 1040, 1117, 1040, 1040, 1042, 1042,
-     1043, 1043, 1050, 1117, 1050, 1050, 1053, 1117, 1053, 1053,
-      908,  908, 1057, 1057, 1058, 1058, 1072, 1072, 1073, 1073,
-     1085, 1085, 1086, 1086, 1087, 1087,  971,  971, 1097, 1097,
-     1103, 1103, 1104, 1104, 1105, 1105, 1109, 1109, 1112, 1112,
-     1113, 1113, 1115, 1115, 1116, 1116,    7, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117
+     1211,    8,    9,   10,   11,   12,   13,   14,    8,    8,
+        8,    8,   15,   16,   17,   17,   17,   17,   17,   17,
+       17,   17,   18,   19,   20,   21,   22,   23,   24,   25,
+       26,   27,   28,   29,   30,   31,   32,   33,   34,   35,
+       29,   36,   37,   38,   39,   40,   41,   29,   42,   29,
+       43,   43,   44,   43,   43,   43,   43,   45,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   46,
+
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   47,   48,
+       49,   50,   50,   50,   50,   51,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       52,   52, 1211,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   53,
+       53,   53,   53,   53,   53,   54,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   55,   62,
+
+       63,   64,   56,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   58,   92,   59,   59,   59,   59,   59,   59,
+       64,   60,   96,   84,   64,   64,  122,   65,   65,   65,
+       65,   65,   65,   65,   65,   65,  125,   61,   65,   65,
+       66,   67,   65,   68,   64,   69,   64,   64,   64,   70,
+       64,   71,   64,   64,   64,   64,   64,   64,   72,   64,
+       64,   64,   64,   64,   65,   65,   74,   65,   89,  126,
+      101,   85,  102,   64,  127,   64,   64,   75,   77,   78,
+       76,  123,   73,   79,  128,  124,   64,   86,   80,   81,
+      141,   87,   82,  142,  143,   83,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64, 1211,  146,   64,   64,   64,
+       64,   64,   64,   90,   64,   93,   97,  147,  148,   94,
+       98,   91,  103,  104,  144,   95,   99,   88,   64,  145,
+      107,  100,  149,  105,  108,  110,  106,  111,  117,  118,
+      112,  113,  150,  152,  109,  153,  154,  114,  119,  156,
+      151,  157,  115,  116,  158,  159,  120,  155,  160,  161,
+      162,  163,  164,  129,  129,  121,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+
+      129,  129,  129,  129,  129,  129,  129,  129,  129,  129,
+      129,  129,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  131,  165,  132,  132,  132,  132,  132,  132,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  134,  166,
+      133,  133,  133,  133,  133,  133,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  135,  135,  135,  135,  135,
+      135,  135,  135,  135,  167,  171,  135,  135,  135,  135,
+      135,  135,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  172,  175,  137,  137,  137,  137,  137,  137,  138,
+      138,  176,  138,  138,  138,  138,  138,  138,  138,  138,
+
+      138,  179,  180,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  138,
+      138,  138,  138,  138,  138,  138,  138,  138,  138,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  131,  177,
+      139,  139,  139,  139,  139,  139,  168,  140,  173,  181,
+      182,  169,  183,  184,  178,  185,  174,  186,  193,  187,
+      194,  195,  196,  197,  198,  170,  188,  199,  189,  190,
+      191,  201,  192,  202,  203,  204,  205,  206,  207,  208,
+      209,  223,  224,  225,  200,  210,  210,  210,  210,  210,
+      210,  210,  210,  210,  226,  227,  211,  211,  211,  211,
+
+      211,  211,  212,  212,  212,  212,  212,  212,  212,  212,
+      212,  228,  229,  212,  212,  212,  212,  212,  212,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  213,  213,
+      213,  213,  213,  213,  213,  213,  213,  214,  230,  213,
+      213,  213,  213,  213,  213,  215,  215,  215,  215,  215,
+      215,  215,  215,  215,  231,  232,  216,  216,  216,  216,
+      216,  216,  217,  217,  217,  217,  217,  217,  217,  217,
+      217,  233,  234,  217,  217,  217,  217,  217,  217,  218,
+      235,  219,  219,  219,  219,  219,  219,  219,  219,  219,
+      220,  236,  221,  221,  221,  221,  221,  221, 1211,  237,
+
+      221,  221,  221,  221,  221,  221,  221,  221,  221,  222,
+      222,  222,  222,  222,  222,  222,  222,  222,   58,  238,
+      222,  222,  222,  222,  222,  222,  239,  240,  241,  242,
+      243,  244,  245,  246,  247,  248,  249,  250,  252,  253,
+      254,  255,  256,  257,  258,  259,  260,  261,  262,  263,
+      267,  264,  268,  269,  270,  271,  272,  273,  274,  251,
+      265,  275,  276,  277,  266,  278,  279,  280,  281,  282,
+      283,  284,  285,  287,  289,  290,  291,  286,  292,  293,
+      294,  310,  313,  288,  295,  295,  295,  295,  295,  295,
+      295,  295,  295,  314,  315,  296,  296,  296,  296,  296,
+
+      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
+      297,  297,  297,  297,  297,  297,  297,  297,  297,  311,
+      316,  297,  297,  297,  297,  297,  297,  298,  298,  298,
+      298,  298,  298,  298,  298,  298,  317,  312,  298,  298,
+      298,  298,  298,  298,  299,  299,  299,  299,  299,  299,
+      299,  299,  299,  318,  319,  299,  299,  299,  299,  299,
+      299,  300,  320,  301,  301,  301,  301,  301,  301,  301,
+      301,  301,  302,  321,  303,  303,  303,  303,  303,  303,
+     1211,  322,  303,  303,  303,  303,  303,  303,  303,  303,
+      303,  304,  304,  304,  304,  304,  304,  304,  304,  304,
+
+      305,  305,  305,  305,  305,  305,  305,  305,  305,  323,
+      324,  306,  306,  306,  306,  306,  306,  307,  307,  307,
+      307,  307,  307,  307,  307,  307,  325,  326,  308,  308,
+      308,  308,  308,  308, 1211,  327,  306,  306,  306,  306,
+      306,  306,  306,  306,  306,  309,  309,  309,  309,  309,
+      309,  309,  309,  309,  328,  329,  309,  309,  309,  309,
+      309,  309,  330,  331,  332,  333,  334,  335,  336,  337,
+      338,  339,  340,  341,  345,  346,  347,  348,  349,  351,
+      352,  353,  342,  343,  344,  354,  355,  356,  357,  359,
+      360,  361,  358,  350,  362,  363,  364,  365,  366,  367,
+
+      368,  369,  370,  372,  373,  374,  375,  376,  377,  378,
+      379,  380,  381,  382,  383, 1211, 1211,  371,  384,  385,
+      385,  385,  385,  385,  385,  385,  385,  385, 1211,  400,
+      385,  385,  385,  385,  385,  385,  386,  386,  386,  386,
+      386,  386,  386,  386,  386,  387,  401,  386,  386,  386,
+      386,  386,  386,  388,  388,  388,  388,  388,  388,  388,
+      388,  388,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  402,  403,  390,  390,  390,  390,  390,  390,  391,
+      391,  391,  391,  391,  391,  391,  391,  391,  408,  409,
+      392,  392,  392,  392,  392,  392, 1211,  410,  390,  390,
+
+      390,  390,  390,  390,  390,  390,  390,  393,  411,  394,
+      394,  394,  394,  394,  394,  394,  394,  394,  395,  395,
+      395,  395,  395,  395,  395,  395,  395,  412,  415,  396,
+      396,  396,  396,  396,  396, 1211,  416,  396,  396,  396,
+      396,  396,  396,  396,  396,  396,  397,  397,  397,  397,
+      397,  397,  397,  397,  397,  398,  417,  399,  399,  399,
+      399,  399,  399, 1211,  404,  399,  399,  399,  399,  399,
+      399,  399,  399,  399,  413,  418,  405,  419,  414,  406,
+      420,  407,  421,  422,  423,  425,  426,  427,  428,  429,
+      424,  430,  431,  432,  433,  434,  435,  436,  437,  438,
+
+      439,  440,  442,  443,  444,  445,  446,  447,  448,  449,
+      450,  451,  452,  453,  454,  455,  441,  456,  457,  458,
+      459,  460,  461,  462,  463,  464,  465,  466,  467,  468,
+      469,  470,  471,  472,  473,  474,  474,  474,  474,  474,
+      474,  474,  474,  474,  214,  220,  474,  474,  474,  474,
+      474,  474,  475,  475,  475,  475,  475,  475,  475,  475,
+      475,  490,  491,  475,  475,  475,  475,  475,  475,  476,
+      476,  476,  476,  476,  476,  476,  476,  476,  492,  493,
+      476,  476,  476,  476,  476,  476,  477,  494,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  479,  479,  479,
+
+      479,  479,  479,  479,  479,  479,  495,  496,  480,  480,
+      480,  480,  480,  480, 1211,  497,  480,  480,  480,  480,
+      480,  480,  480,  480,  480,  481,  481,  481,  481,  481,
+      481,  481,  481,  481,  482,  498,  483,  483,  483,  483,
+      483,  483, 1211,  499,  483,  483,  483,  483,  483,  483,
+      483,  483,  483,  484,  484,  484,  484,  484,  484,  484,
+      484,  484,  218,  500,  485,  485,  485,  485,  485,  485,
+      485,  485,  485,  220,  486,  486,  486,  486,  486,  486,
+      486,  486,  486,  504,  505,  487,  487,  487,  487,  487,
+      487,  488,  488,  488,  488,  488,  488,  488,  488,  488,
+
+      506,  507,  489,  489,  489,  489,  489,  489, 1211,  508,
+      487,  487,  487,  487,  487,  487,  487,  487,  487,  501,
+      501,  509,  501,  501,  501,  501,  501,  501,  502,  503,
+      501,  503,  503,  503,  503,  503,  503,  503,  503,  503,
+      501,  501,  503,  503,  503,  503,  503,  503,  503,  503,
+      503,  503,  503,  503,  503,  503,  503,  503,  503,  503,
+      503,  503,  503,  503,  503,  503,  503,  503,  510,  511,
+      512,  513,  514,  515,  516,  517,  518,  519,  520,  521,
+      522,  523,  524,  525,  526,  527,  528,  529,  530,  531,
+      532,  533,  534,  535,  536,  537,  538,  539,  540,  541,
+
+      543,  544,  545,  546,  547,  548,  549,  550,  551,  552,
+      553,  554,  542,  555,  556,  557,  558,  559,  560,  561,
+      561,  561,  561,  561,  561,  561,  561,  561,  302, 1211,
+      561,  561,  561,  561,  561,  561,  562,  562,  562,  562,
+      562,  562,  562,  562,  562,  581,  582,  562,  562,  562,
+      562,  562,  562,  563,  563,  563,  563,  563,  563,  563,
+      563,  563,  564,  583,  563,  563,  563,  563,  563,  563,
+      565,  565,  565,  565,  565,  565,  565,  565,  565,  300,
+      584,  566,  566,  566,  566,  566,  566,  566,  566,  566,
+      302,  567,  567,  567,  567,  567,  567,  567,  567,  567,
+
+      585,  586,  568,  568,  568,  568,  568,  568,  569,  569,
+      569,  569,  569,  569,  569,  569,  569,  590,  591,  570,
+      570,  570,  570,  570,  570, 1211,  592,  568,  568,  568,
+      568,  568,  568,  568,  568,  568,  571,  593,  572,  572,
+      572,  572,  572,  572,  572,  572,  572,  573,  573,  573,
+      573,  573,  573,  573,  573,  573,  596,  597,  574,  574,
+      574,  574,  574,  574, 1211,  598,  574,  574,  574,  574,
+      574,  574,  574,  574,  574,  575,  575,  575,  575,  575,
+      575,  575,  575,  575,  576,  599,  577,  577,  577,  577,
+      577,  577, 1211,  587,  577,  577,  577,  577,  577,  577,
+
+      577,  577,  577,  578,  594,  600,  579,  603,  588,  589,
+      604,  601,  580,  602,  595,  605,  606,  607,  608,  609,
+      610,  611,  612,  596,  613,  614,  615,  616,  617,  618,
+      619,  620,  621,  622,  623,  624,  625,  626,  627,  628,
+      629,  630,  631,  632,  633,  634,  636,  637,  638,  639,
+      640,  641,  642,  643,  644,  635,  645,  646,  647,  648,
+      649,  650,  651,  652,  653,  654,  387,  655,  655,  655,
+      655,  655,  655,  655,  655,  655, 1211,  398,  655,  655,
+      655,  655,  655,  655,  656,  656,  656,  656,  656,  656,
+      656,  656,  656,  398,  669,  656,  656,  656,  656,  656,
+
+      656,  657,  670,  658,  658,  658,  658,  658,  658,  658,
+      658,  658,  659,  659,  659,  659,  659,  659,  659,  659,
+      659,  671,  672,  660,  660,  660,  660,  660,  660, 1211,
+      673,  660,  660,  660,  660,  660,  660,  660,  660,  660,
+      661,  661,  661,  661,  661,  661,  661,  661,  661,  662,
+      674,  663,  663,  663,  663,  663,  663, 1211,  675,  663,
+      663,  663,  663,  663,  663,  663,  663,  663,  664,  664,
+      664,  664,  664,  664,  664,  664,  664,  665,  665,  665,
+      665,  665,  665,  665,  665,  665,  676,  677,  666,  666,
+      666,  666,  666,  666,  667,  667,  667,  667,  667,  667,
+
+      667,  667,  667,  678,  679,  668,  668,  668,  668,  668,
+      668, 1211,  680,  666,  666,  666,  666,  666,  666,  666,
+      666,  666,  681,  682,  683,  684,  685,  686,  687,  688,
+      689,  690,  691,  692,  693,  694,  695,  696,  697,  698,
+      699,  700,  701,  703,  702,  704,  705,  706,  707,  708,
+      709,  710,  711,  712,  713,  714,  715,  716,  717,  718,
+      719,  720,  721,  722,  723,  724,  725,  727,  728,  729,
+      730,  731,  732,  733,  734,  735,  736,  726,  737,  738,
+      739,  739,  739,  739,  739,  739,  739,  739,  739,  482,
+      482,  739,  739,  739,  739,  739,  739,  740,  740,  740,
+
+      740,  740,  740,  740,  740,  740,  754,  755,  740,  740,
+      740,  740,  740,  740,  741,  741,  741,  741,  741,  741,
+      741,  741,  741,  742,  756,  741,  741,  741,  741,  741,
+      741,  743,  743,  743,  743,  743,  743,  743,  743,  743,
+      744,  744,  744,  744,  744,  744,  744,  744,  744,  757,
+      758,  745,  745,  745,  745,  745,  745,  746,  746,  746,
+      746,  746,  746,  746,  746,  746,  759,  760,  747,  747,
+      747,  747,  747,  747, 1211,  761,  745,  745,  745,  745,
+      745,  745,  745,  745,  745,  748,  748,  748,  748,  748,
+      748,  748,  748,  748,  749,  749,  749,  749,  749,  749,
+
+      749,  749,  749,  762,  763,  750,  750,  750,  750,  750,
+      750, 1211,  764,  750,  750,  750,  750,  750,  750,  750,
+      750,  750,  751,  751,  751,  751,  751,  751,  751,  751,
+      751,  752,  765,  753,  753,  753,  753,  753,  753, 1211,
+      766,  753,  753,  753,  753,  753,  753,  753,  753,  753,
+      767,  768,  769,  770,  771,  772,  773,  774,  775,  776,
+      777,  778,  779,  780,  781,  782,  783,  785,  786,  784,
+      787,  788,  789,  790,  791,  792,  793,  794,  795,  796,
+      797,  798,  799,  800,  801,  802,  803,  804,  805,  806,
+      807,  808,  809,  810,  811,  812,  813,  814,  815,  816,
+
+      816,  816,  816,  816,  816,  816,  816,  816,  564,  576,
+      816,  816,  816,  816,  816,  816,  817,  817,  817,  817,
+      817,  817,  817,  817,  817,  576,  829,  817,  817,  817,
+      817,  817,  817,  818,  818,  818,  818,  818,  818,  818,
+      818,  818,  830,  831,  818,  818,  818,  818,  818,  818,
+      819,  819,  819,  819,  819,  819,  819,  819,  819,  820,
+      820,  820,  820,  820,  820,  820,  820,  820,  832,  833,
+      821,  821,  821,  821,  821,  821, 1211,  834,  821,  821,
+      821,  821,  821,  821,  821,  821,  821,  822,  822,  822,
+      822,  822,  822,  822,  822,  822,  823,  835,  824,  824,
+
+      824,  824,  824,  824, 1211,  836,  824,  824,  824,  824,
+      824,  824,  824,  824,  824,  825,  825,  825,  825,  825,
+      825,  825,  825,  825,  837,  838,  826,  826,  826,  826,
+      826,  826,  827,  827,  827,  827,  827,  827,  827,  827,
+      827,  839,  840,  828,  828,  828,  828,  828,  828, 1211,
+      841,  826,  826,  826,  826,  826,  826,  826,  826,  826,
+      842,  843,  844,  845,  846,  847,  848,  849,  850,  851,
+      852,  853,  854,  855,  856,  857,  858,  859,  860,  861,
+      862,  863,  864,  865,  866,  867,  868,  869,  870,  871,
+      872,  873,  874,  875,  876,  877,  877,  877,  877,  877,
+
+      877,  877,  877,  877,  662,  662,  877,  877,  877,  877,
+      877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+      878,  879,  889,  878,  878,  878,  878,  878,  878,  880,
+      880,  880,  880,  880,  880,  880,  880,  880,  890,  891,
+      881,  881,  881,  881,  881,  881,  882,  882,  882,  882,
+      882,  882,  882,  882,  882,  892,  893,  883,  883,  883,
+      883,  883,  883, 1211,  894,  881,  881,  881,  881,  881,
+      881,  881,  881,  881,  884,  884,  884,  884,  884,  884,
+      884,  884,  884,  895,  896,  885,  885,  885,  885,  885,
+      885, 1211,  897,  885,  885,  885,  885,  885,  885,  885,
+
+      885,  885,  886,  886,  886,  886,  886,  886,  886,  886,
+      886,  887,  898,  888,  888,  888,  888,  888,  888, 1211,
+      899,  888,  888,  888,  888,  888,  888,  888,  888,  888,
+      900,  901,  902,  903,  904,  905,  906,  907,  908,  909,
+      910,  911,  912,  913,  914,  915,  916,  917,  918,  919,
+      920,  921,  922,  923,  923,  923,  923,  923,  923,  923,
+      923,  923,  742,  752,  923,  923,  923,  923,  923,  923,
+      924,  924,  924,  924,  924,  924,  924,  924,  924,  752,
+      935,  924,  924,  924,  924,  924,  924,  925,  925,  925,
+      925,  925,  925,  925,  925,  925,  936,  937,  925,  925,
+
+      925,  925,  925,  925,  926,  926,  926,  926,  926,  926,
+      926,  926,  926,  938,  939,  927,  927,  927,  927,  927,
+      927, 1211,  940,  927,  927,  927,  927,  927,  927,  927,
+      927,  927,  928,  928,  928,  928,  928,  928,  928,  928,
+      928,  929,  941,  930,  930,  930,  930,  930,  930, 1211,
+      942,  930,  930,  930,  930,  930,  930,  930,  930,  930,
+      931,  931,  931,  931,  931,  931,  931,  931,  931,  943,
+      944,  932,  932,  932,  932,  932,  932,  933,  933,  933,
+      933,  933,  933,  933,  933,  933,  945,  946,  934,  934,
+      934,  934,  934,  934, 1211,  949,  932,  932,  932,  932,
+
+      932,  932,  932,  932,  932,  947,  950,  951,  952,  953,
+      954,  948,  955,  956,  957,  958,  959,  960,  961,  961,
+      961,  961,  961,  961,  961,  961,  961,  823,  823,  961,
+      961,  961,  961,  961,  961,  962,  962,  962,  962,  962,
+      962,  962,  962,  962,  974,  975,  962,  962,  962,  962,
+      962,  962,  963,  963,  963,  963,  963,  963,  963,  963,
+      963,  964,  976,  963,  963,  963,  963,  963,  963,  965,
+      965,  965,  965,  965,  965,  965,  965,  965,  977,  978,
+      966,  966,  966,  966,  966,  966,  967,  967,  967,  967,
+      967,  967,  967,  967,  967,  979,  980,  968,  968,  968,
+
+      968,  968,  968, 1211,  981,  966,  966,  966,  966,  966,
+      966,  966,  966,  966,  969,  969,  969,  969,  969,  969,
+      969,  969,  969,  982,  983,  970,  970,  970,  970,  970,
+      970, 1211,  984,  970,  970,  970,  970,  970,  970,  970,
+      970,  970,  971,  971,  971,  971,  971,  971,  971,  971,
+      971,  972,  985,  973,  973,  973,  973,  973,  973, 1211,
+      986,  973,  973,  973,  973,  973,  973,  973,  973,  973,
+      987,  988,  989,  990,  991,  992,  993,  994,  995,  996,
+      879,  997,  997,  997,  997,  997,  997,  997,  997,  997,
+      887,  887,  997,  997,  997,  997,  997,  997,  998,  998,
+
+      998,  998,  998,  998,  998,  998,  998,  999, 1009,  998,
+      998,  998,  998,  998,  998, 1000, 1000, 1000, 1000, 1000,
+     1000, 1000, 1000, 1000, 1010, 1011, 1001, 1001, 1001, 1001,
+     1001, 1001, 1211, 1012, 1001, 1001, 1001, 1001, 1001, 1001,
+     1001, 1001, 1001, 1002, 1002, 1002, 1002, 1002, 1002, 1002,
+     1002, 1002, 1003, 1015, 1004, 1004, 1004, 1004, 1004, 1004,
+     1211, 1018, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
+     1004, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005, 1005,
+     1019, 1013, 1006, 1006, 1006, 1006, 1006, 1006, 1007, 1007,
+     1007, 1007, 1007, 1007, 1007, 1007, 1007, 1014, 1020, 1008,
+
+     1008, 1008, 1008, 1008, 1008, 1211, 1016, 1006, 1006, 1006,
+     1006, 1006, 1006, 1006, 1006, 1006, 1021, 1022, 1023, 1024,
+     1025, 1026, 1017, 1027, 1028, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029,  929,  929, 1029, 1029, 1029, 1029,
+     1029, 1029, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+     1030, 1043, 1044, 1030, 1030, 1030, 1030, 1030, 1030, 1031,
+     1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1032, 1045,
+     1031, 1031, 1031, 1031, 1031, 1031, 1033, 1033, 1033, 1033,
+     1033, 1033, 1033, 1033, 1033, 1046, 1047, 1033, 1033, 1033,
+     1033, 1033, 1033, 1034, 1034, 1034, 1034, 1034, 1034, 1034,
+
+     1034, 1034, 1048, 1049, 1035, 1035, 1035, 1035, 1035, 1035,
+     1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1050,
+     1051, 1037, 1037, 1037, 1037, 1037, 1037, 1211, 1056, 1035,
+     1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1038, 1038,
+     1038, 1038, 1038, 1038, 1038, 1038, 1038, 1057, 1058, 1039,
+     1039, 1039, 1039, 1039, 1039, 1211, 1059, 1039, 1039, 1039,
+     1039, 1039, 1039, 1039, 1039, 1039, 1040, 1040, 1040, 1040,
+     1040, 1040, 1040, 1040, 1040, 1041, 1060, 1042, 1042, 1042,
+     1042, 1042, 1042, 1211, 1061, 1042, 1042, 1042, 1042, 1042,
+     1042, 1042, 1042, 1042, 1052, 1053, 1054,  964, 1055, 1062,
+
+     1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1064,  972,
+     1062, 1062, 1062, 1062, 1062, 1062, 1063, 1063, 1063, 1063,
+     1063, 1063, 1063, 1063, 1063,  972, 1074, 1063, 1063, 1063,
+     1063, 1063, 1063, 1065, 1065, 1065, 1065, 1065, 1065, 1065,
+     1065, 1065, 1066, 1075, 1065, 1065, 1065, 1065, 1065, 1065,
+     1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1079,
+     1080, 1068, 1068, 1068, 1068, 1068, 1068, 1211, 1081, 1068,
+     1068, 1068, 1068, 1068, 1068, 1068, 1068, 1068, 1069, 1069,
+     1069, 1069, 1069, 1069, 1069, 1069, 1069, 1082, 1083, 1070,
+     1070, 1070, 1070, 1070, 1070, 1211, 1086, 1070, 1070, 1070,
+
+     1070, 1070, 1070, 1070, 1070, 1070, 1071, 1071, 1071, 1071,
+     1071, 1071, 1071, 1071, 1071, 1087, 1088, 1072, 1072, 1072,
+     1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+     1073, 1073, 1089, 1090, 1073, 1073, 1073, 1073, 1073, 1073,
+     1211, 1076, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072,
+     1072, 1084, 1091, 1077, 1085, 1092, 1093, 1003, 1003, 1102,
+     1078, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094, 1094,
+     1103, 1104, 1094, 1094, 1094, 1094, 1094, 1094, 1095, 1095,
+     1095, 1095, 1095, 1095, 1095, 1095, 1095, 1107, 1108, 1095,
+     1095, 1095, 1095, 1095, 1095, 1096, 1096, 1096, 1096, 1096,
+
+     1096, 1096, 1096, 1096, 1109, 1110, 1096, 1096, 1096, 1096,
+     1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+     1097, 1111, 1112, 1098, 1098, 1098, 1098, 1098, 1098, 1211,
+     1113, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+     1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099, 1114,
+     1115, 1100, 1100, 1100, 1100, 1100, 1100, 1211, 1116, 1100,
+     1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1101, 1101,
+     1101, 1101, 1101, 1101, 1101, 1101, 1101, 1117, 1118, 1101,
+     1101, 1101, 1101, 1101, 1101, 1105, 1032, 1041, 1041, 1126,
+     1127, 1106, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119,
+
+     1119, 1128, 1129, 1119, 1119, 1119, 1119, 1119, 1119, 1120,
+     1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1130, 1131,
+     1120, 1120, 1120, 1120, 1120, 1120, 1121, 1121, 1121, 1121,
+     1121, 1121, 1121, 1121, 1121, 1122, 1133, 1121, 1121, 1121,
+     1121, 1121, 1121, 1123, 1123, 1123, 1123, 1123, 1123, 1123,
+     1123, 1123, 1135, 1066, 1124, 1124, 1124, 1124, 1124, 1124,
+     1211, 1140, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+     1124, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+     1141, 1142, 1125, 1125, 1125, 1125, 1125, 1125, 1132, 1132,
+     1143, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132,
+
+     1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132,
+     1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132,
+     1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132,
+     1132, 1132, 1132, 1132, 1132, 1132, 1132, 1134, 1134, 1150,
+     1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1145,
+     1146, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+     1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+     1134, 1134, 1134, 1134, 1134, 1134, 1134, 1136, 1136, 1136,
+     1136, 1136, 1136, 1136, 1136, 1136, 1148, 1149, 1136, 1136,
+     1136, 1136, 1136, 1136, 1137, 1137, 1137, 1137, 1137, 1137,
+
+     1137, 1137, 1137, 1154, 1155, 1137, 1137, 1137, 1137, 1137,
+     1137, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138,
+     1156, 1157, 1138, 1138, 1138, 1138, 1138, 1138, 1139, 1139,
+     1139, 1139, 1139, 1139, 1139, 1139, 1139, 1158, 1159, 1139,
+     1139, 1139, 1139, 1139, 1139, 1144, 1144, 1160, 1144, 1144,
+     1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+     1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+     1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+     1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+     1144, 1144, 1144, 1144, 1147, 1147, 1161, 1147, 1147, 1147,
+
+     1147, 1147, 1147, 1147, 1147, 1147, 1162, 1163, 1147, 1147,
+     1147, 1147, 1147, 1147, 1147, 1147, 1147, 1147, 1147, 1147,
+     1147, 1147, 1147, 1147, 1147, 1147, 1147, 1147, 1147, 1147,
+     1147, 1147, 1147, 1147, 1151, 1151, 1151, 1151, 1151, 1151,
+     1151, 1151, 1151, 1164, 1165, 1151, 1151, 1151, 1151, 1151,
+     1151, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+     1153, 1122, 1152, 1152, 1152, 1152, 1152, 1152, 1166, 1166,
+     1166, 1166, 1166, 1166, 1166, 1166, 1166, 1169, 1170, 1166,
+     1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167,
+     1167, 1167, 1167, 1167, 1171, 1172, 1167, 1167, 1167, 1167,
+
+     1167, 1167, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168,
+     1168, 1173, 1174, 1168, 1168, 1168, 1168, 1168, 1168, 1175,
+     1176, 1177, 1178, 1179, 1179, 1179, 1179, 1179, 1179, 1179,
+     1179, 1179, 1183, 1184, 1179, 1179, 1179, 1179, 1179, 1179,
+     1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1185,
+     1186, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1181, 1181,
+     1181, 1181, 1181, 1181, 1181, 1181, 1182, 1187, 1181, 1181,
+     1181, 1181, 1181, 1181, 1188, 1189, 1190, 1153, 1191, 1191,
+     1191, 1191, 1191, 1191, 1191, 1191, 1191, 1193, 1194, 1191,
+     1191, 1191, 1191, 1191, 1191, 1192, 1192, 1192, 1192, 1192,
+
+     1192, 1192, 1192, 1192, 1195, 1196, 1192, 1192, 1192, 1192,
+     1192, 1192, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+     1197, 1201, 1182, 1197, 1197, 1197, 1197, 1197, 1197, 1198,
+     1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1205, 1211,
+     1198, 1198, 1198, 1198, 1198, 1198, 1199, 1199, 1199, 1199,
+     1199, 1199, 1199, 1199, 1199, 1200, 1200, 1199, 1199, 1199,
+     1199, 1199, 1199, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+     1202, 1202, 1208, 1211, 1202, 1202, 1202, 1202, 1202, 1202,
+     1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1211,
+     1211, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204,
+
+     1204, 1204, 1204, 1204, 1204, 1204, 1211, 1211, 1204, 1204,
+     1204, 1204, 1204, 1204, 1206, 1206, 1206, 1206, 1206, 1206,
+     1206, 1206, 1206, 1211, 1211, 1206, 1206, 1206, 1206, 1206,
+     1206, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207, 1207,
+     1208, 1211, 1207, 1207, 1207, 1207, 1207, 1207, 1209, 1209,
+     1209, 1209, 1209, 1209, 1209, 1209, 1209, 1211, 1211, 1209,
+     1209, 1209, 1209, 1209, 1209, 1037, 1037, 1037, 1037, 1037,
+     1037, 1037, 1037, 1037, 1210, 1210, 1210, 1210, 1210, 1210,
+     1210, 1210, 1210, 1211, 1211, 1210, 1210, 1210, 1210, 1210,
+     1210,    7, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211
     } ;
 
-static yyconst flex_int16_t yy_chk[6333] =
+static yyconst flex_int16_t yy_chk[4342] =
     {   0,
+        0,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,   10,   10,   11,   11,   15,
-       17,   29, 1206,   15,   16,   16,   16,   16,   16,   16,
-       16,   16,   16,   16,   24,   16,   16,   16,   16,   16,
-
-       16,   27,   16,   63,   39,   24,   17,   29,   24,   27,
-       34,   39,   34,   46,   46,   34,   30,   24,   16, 1202,
-       24,   16,   16,   16,   16,   16,   16,   27,   16,   63,
-       39,   24,   30, 1200,   24,   27,   34,   39,   34,   47,
-       47,   34,   30,   24,   16,   20,   20, 1196,   20,   20,
-       20,   20,   20,   20,   20,   20,   20,   20,   30,   20,
-       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
-       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,   10,   10,
+       11,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       13,   13,   17,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   15,   18,
+
+       19,   29,   15,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   30,   16,   16,   16,   16,   16,   16,
+       24,   16,   32,   24,   20,   20,   39,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   41,   16,   20,   20,
        20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
        20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
-
-       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
-       20,   21,   21,   65,   21,   48,   48,   41,   66, 1190,
-       21, 1182,   21,   41,   67, 1181, 1176,   68, 1172,   21,
-     1171,   25, 1167, 1163, 1125, 1116,   42,   21,   21,   65,
-       21, 1115,   25,   41,   66,   25,   21,   25,   21,   41,
-       67,   25,   42,   68,   31,   21,   22,   25,   22,   22,
-       31,   22,   42,   32,   28,   72,   31,   22,   25,   22,
-       22,   25,   28,   25,   72, 1113,   22,   25,   42,   28,
-       31, 1112,   22,   32,   22,   22,   31,   22, 1111,   32,
-       28,   72,   31,   22, 1110,   22,   22, 1109,   28,   69,
-
-       72,   70,   22,   23,   69,   28,   23,   23,   73,   32,
-       76,   23,   75,   69,   23,   77,   23,   23,   70,   75,
-       23,   71,   71,   23, 1108,   69, 1105,   70, 1104,   23,
-       69, 1098,   23,   23,   73, 1097,   76,   23,   75,   69,
-       23,   77,   23,   23,   70,   75,   23,   71,   71,   23,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-     1096,   26,   26,   26,   26,   26,   26,   33,   26,   84,
-     1087,   33,   26, 1086, 1085,   26, 1074,   33, 1073,   94,
-       94,   26,   33,   33, 1072,   35,   35,   26,   26,   26,
-       26,   26,   26,   33,   26,   84,   35,   33,   26,   35,
-
-       36,   26,   35,   33,   36,   94,   94,   26,   33,   33,
-       80,   35,   35,   97,   36,   40, 1058, 1057,   80,   40,
-       36, 1056,   35, 1044, 1043,   35,   36, 1042,   35,   79,
-       36,   79,   38,   38,   78,   40,   80, 1027, 1026,   97,
-       36,   40,   38,   74,   80,   40,   36,   37,   78,   37,
-       38,   74,   37,   37,   91,   79,  100,   79,   91,   38,
-       78,   40,   38,   74,   37,   37, 1025, 1007,   38,   74,
-     1003, 1002, 1001,   37,   78,   37,   38,   74,   37,   37,
-       91, 1000,  100,  976,   91,   38,  101,  973,   38,   74,
-       37,   37,   56,   56,   56,   56,   56,   56,   56,   56,
-
-       56,   56,  107,   56,   56,   56,   56,   56,   56,   82,
-       56,   58,   58,   58,   58,   58,   58,   58,   58,   58,
-      101,   82,  971,  970,  948,  942,  941,  940,  107,   56,
-       56,   56,   56,   56,   56,   82,   56,   61,   61,   61,
-       61,   61,   61,   61,   61,   61,  101,   82,   61,   61,
-       61,   61,   61,   61,  128,  128,  128,  128,  128,  128,
-      128,  128,  128,  133,  939,  133,  133,  133,  133,  133,
-      133,  133,  133,  133,   61,   61,   61,   61,   61,   61,
+       20,   20,   20,   20,   21,   21,   22,   21,   27,   42,
+       34,   25,   34,   21,   45,   21,   27,   22,   23,   23,
+       22,   40,   21,   23,   54,   40,   22,   25,   23,   23,
+       66,   25,   23,   67,   68,   23,   26,   26,   26,   26,
+
+       26,   26,   26,   26,   26,   26,   71,   26,   26,   26,
+       26,   26,   26,   28,   26,   31,   33,   72,   73,   31,
+       33,   28,   35,   35,   70,   31,   33,   26,   28,   70,
+       36,   33,   74,   35,   36,   37,   35,   37,   38,   38,
+       37,   37,   75,   76,   36,   77,   78,   37,   38,   79,
+       75,   80,   37,   37,   81,   82,   38,   78,   83,   84,
+       85,   86,   87,   56,   56,   38,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   88,   57,   57,   57,   57,   57,   57,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   89,
+       58,   58,   58,   58,   58,   58,   59,   59,   59,   59,
+       59,   59,   59,   59,   59,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   90,   92,   61,   61,   61,   61,
+       61,   61,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   93,   95,   62,   62,   62,   62,   62,   62,   64,
+       64,   96,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   98,  100,   64,   64,   64,   64,   64,   64,   64,
        64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
-       85,   64,   64,   64,   64,   64,   64,   81,   64,   83,
-
-      938,  912,  909,   81,   83,  908,  907,   85,  884,   86,
-      878,   64,   87,  114,   88,  877,   85,   64,   64,   64,
-       64,   64,   64,   81,   64,   83,   86,   89,   87,   81,
-       83,   90,   93,   85,   88,   86,   90,   64,   87,  114,
-       88,   92,   96,  115,   96,  876,   93,   89,  875,   92,
-       90,   90,   86,   89,   87,  859,   92,   90,   93,   95,
-       88,   98,   90,   99,   99,  844,   98,   92,   96,  115,
-       96,   95,   93,   89,   95,   92,   90,   90,  102,  104,
-      103,  102,   92,  105,  106,   95,  103,   98,  105,   99,
-       99,  106,   98,  106,  106,  104,  108,   95,  109,  108,
-
-       95,  118,  106,  110,  102,  104,  103,  102,  111,  105,
-      106,  113,  103,  111,  105,  112,  109,  106,  116,  106,
-      106,  104,  108,  110,  109,  108,  842,  118,  106,  110,
-      113,  119,  112,  121,  111,  112,  117,  113,  120,  111,
-      121,  112,  109,  119,  117,  122,  135,  120,  122,  110,
-      136,  123,  116,  123,  841,  840,  113,  119,  112,  121,
-      806,  112,  117,  150,  120,  800,  121,  799,  798,  119,
-      117,  122,  135,  120,  122,  140,  136,  123,  116,  123,
-      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
-      143,  126,  126,  126,  126,  126,  126,  150,  126,  797,
-
-      748,  140,  746,  745,  744,  687,  680,  679,  146,  146,
-      678,  677,  607,  604,  603,  602,  143,  126,  126,  126,
-      126,  126,  126,  150,  126,  130,  130,  130,  130,  130,
-      130,  130,  130,  130,  146,  146,  130,  130,  130,  130,
-      130,  130,  530,  164,  200,  200,  200,  200,  200,  200,
-      200,  200,  200,  521,  156,  520,  519,  518,  445,  442,
-      441,  156,  130,  130,  130,  130,  130,  130,  132,  164,
-      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
-      156,  132,  132,  132,  132,  132,  132,  156,  205,  440,
-      205,  205,  205,  205,  205,  205,  205,  205,  205,  369,
-
-      361,  360,  359,  358,  290,  280,  279,  132,  132,  132,
-      132,  132,  132,  134,  134,  134,  134,  134,  134,  134,
-      134,  134,  134,  141,  134,  134,  134,  134,  134,  134,
-      137,  138,  139,  137,  142,  278,  141,  138,  139,  144,
-      147,  144,  147,  148,  142,  145,  277,  148,  245,  141,
-      134,  134,  134,  134,  134,  134,  137,  138,  139,  137,
-      142,  145,  141,  138,  139,  144,  147,  144,  147,  148,
-      142,  145,  149,  148,  151,  152,  153,  157,  159,  154,
-      152,  155,  158,  155,  158,  203,  202,  145,  149,  201,
-      129,  157,  167,  153,  151,  154,  159,  160,  149,  127,
-
-      151,  152,  153,  157,  159,  154,  152,  155,  158,  155,
-      158,  161,  162,  168,  149,  160,  163,  157,  165,  153,
-      151,  154,  159,  160,  162,  166,  167,  170,  170,  161,
-      172,  168,  163,  169,  165,  166,  173,  161,  162,  168,
-      176,  160,  163,   57,  165,  171,  171,  169,  173,  176,
-      162,  166,  167,  170,  170,  161,  175,  168,  163,  169,
-      165,  166,  173,  174,  172,  178,  176,  181,  177,  180,
-       53,  175,  174,  169,  173,  176,  174,  178,  179,  198,
-      171,  174,  175,  177,  179,  180,  182,  181,   52,  174,
-      172,  178,  182,  181,  177,  180,  184,  175,  174,  183,
-
-      183,  187,  174,  178,  179,  198,  171,  174,  184,  177,
-      179,  180,  182,  181,  185,  189,  186,  185,  182,  186,
-      188,  188,  184,  190,   49,  183,  183,  189,  190,   44,
-      190,   19,  191,  194,  184,  187,  192,   18,  211,  193,
-      185,  189,  186,  185,  213,  186,  188,  188,  195,  190,
-      191,  194,  192,  189,  190,  193,  190,  197,  191,  194,
-      195,  187,  192,  196,  211,  193,  223,  197,   14,   12,
-      213,    7,    4,    3,  195,    0,  191,  194,  192,  226,
-      196,  193,    0,  197,    0,    0,  195,    0,    0,  196,
-        0,  226,  223,  197,  206,  206,  206,  206,  206,  206,
-
-      206,  206,  206,    0,  216,  226,  196,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  226,  199,  199,
-      199,  199,  199,  199,  209,  199,  209,  209,  209,  209,
-      209,  209,  209,  209,  209,    0,    0,    0,  216,    0,
-        0,    0,    0,    0,  199,  199,  199,  199,  199,  199,
-      214,  199,  204,  214,  204,  204,  204,  204,  204,  204,
-      204,  204,  204,  204,  216,  204,  204,  204,  204,  204,
-      204,    0,  228,    0,    0,    0,  214,    0,    0,  214,
-        0,    0,    0,  220,    0,    0,    0,    0,    0,    0,
-      220,  204,  204,  204,  204,  204,  204,  207,  228,  207,
-
-      207,  207,  207,  207,  207,  207,  207,  207,  207,  220,
-      207,  207,  207,  207,  207,  207,  220,  212,    0,    0,
-        0,    0,    0,    0,    0,    0,  237,    0,    0,    0,
-        0,    0,    0,  237,  217,  212,  207,  207,  207,  207,
-      207,  207,  208,  208,  208,  208,  208,  208,  208,  208,
-      208,  212,  237,  208,  208,  208,  208,  208,  208,  237,
-        0,  212,    0,    0,    0,    0,    0,    0,  217,    0,
-        0,    0,  222,    0,    0,    0,  215,  212,  215,  208,
-      208,  208,  208,  208,  208,  210,  210,  210,  210,  210,
-      210,  210,  210,  210,  217,  218,  210,  210,  210,  210,
-
-      210,  210,  215,  219,  215,  219,  222,  224,  221,  224,
-      225,  218,  225,  227,  229,  231,  233,  229,  233,  234,
-        0,  218,  210,  210,  210,  210,  210,  210,  221,  219,
-      230,  219,  222,  224,  221,  224,  225,  218,  225,  232,
-      229,  235,  233,  229,  233,  238,  230,  227,  238,  231,
-      236,  236,  240,  234,  221,  232,  230,  235,  239,  239,
-      244,    0,    0,    0,    0,  232,    0,  235,    0,  242,
-        0,  238,  230,  227,  238,  231,  236,  236,  241,  234,
-      243,  232,  242,  235,  239,  239,  240,  241,  241,  241,
-      246,  249,  248,  243,  244,  242,  241,  247,  248,  247,
-
-      249,    0,    0,  251,  241,  246,  243,  246,  242,  251,
-      253,  250,  240,  241,  241,  241,  246,  249,  248,  243,
-      244,  255,  241,  247,  248,  247,  249,  250,  252,  251,
-        0,  246,  257,  246,  252,  251,  253,  250,  255,  254,
-      258,  256,    0,  254,  258,  259,  259,  255,  256,    0,
-      257,  261,  260,  250,  252,  254,  261,  262,  257,  263,
-      252,  268,  268,  265,  255,  254,  258,  256,  260,  254,
-      258,  259,  259,  262,  256,  263,  257,  261,  260,  265,
-      264,  254,  261,  262,  266,  263,  267,  268,  268,  265,
-      271,  266,  270,  272,  260,  264,  275,  264,  269,  262,
-
-        0,  263,  267,  273,    0,  265,  264,  269,  274,  293,
-      266,  293,  267,  272,  274,  295,  271,  266,  305,  272,
-      273,  264,  292,  264,  269,  305,  270,  292,  267,  273,
-      275,    0,    0,  269,  274,  293,    0,  293,    0,  272,
-      274,  295,    0,    0,  305,    0,  273,    0,  292,    0,
-        0,  305,  270,  292,  298,    0,  275,  276,  276,  276,
-      276,  276,  276,  276,  276,  276,  276,  281,  281,  281,
-      281,  281,  281,  281,  281,  281,  282,    0,  282,  282,
-      282,  282,  282,  282,  282,  282,  282,  282,  298,  282,
-      282,  282,  282,  282,  282,  284,    0,  284,  284,  284,
-
-      284,  284,  284,  284,  284,  284,    0,    0,    0,    0,
-        0,    0,    0,  306,  298,  282,  282,  282,  282,  282,
-      282,  283,  283,  283,  283,  283,  283,  283,  283,  283,
-      291,  291,  283,  283,  283,  283,  283,  283,  285,  306,
-      285,  285,  285,  285,  285,  285,  285,  285,  285,    0,
-      299,    0,    0,    0,    0,    0,  291,  291,  283,  283,
-      283,  283,  283,  283,  286,    0,  286,  286,  286,  286,
-      286,  286,  286,  286,  286,  286,  308,  286,  286,  286,
-      286,  286,  286,  287,  299,  287,  287,  287,  287,  287,
-      287,  287,  287,  287,    0,  310,    0,    0,    0,    0,
-
-        0,    0,  308,  286,  286,  286,  286,  286,  286,  288,
-      299,  288,  288,  288,  288,  288,  288,  288,  288,  288,
-      288,  310,  288,  288,  288,  288,  288,  288,  289,  294,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  300,
-      300,  294,  296,  340,  311,  342,  301,  297,  288,  288,
-      288,  288,  288,  288,  296,  294,  297,  296,  301,  296,
-      303,  303,  296,  304,  307,  300,  300,  294,  296,  340,
-      302,  342,  301,  297,  302,  302,  307,  309,  311,  304,
-      296,  313,  297,  296,  301,  296,  303,  303,  296,  304,
-      307,  312,  323,  316,  309,  314,  302,  312,  315,  312,
-
-      302,  302,  307,  309,  311,  304,  317,  314,  316,    0,
-      315,  320,  324,  318,    0,  313,    0,  312,  317,  316,
-      309,  314,  318,  312,  315,  312,  323,  320,  326,  319,
-      322,  324,  317,  314,  316,  319,  315,  320,  324,  318,
-      321,  313,  330,  326,  317,  325,  321,  328,  318,  330,
-      322,  329,  323,  320,  326,  319,  322,  324,  325,  327,
-      331,  319,    0,  328,  333,  327,  321,  329,  330,  326,
-      333,  325,  321,  328,  332,  330,  322,  329,  337,  334,
-      331,  332,  334,  338,  325,  327,  331,  339,  339,  328,
-      333,  327,  335,  329,  336,  335,  333,  336,  338,  341,
-
-      332,  343,  343,  344,  344,  334,  331,  332,  334,  338,
-      345,  346,  337,  339,  339,  341,  347,  346,  335,  349,
-      336,  335,  348,  336,  338,  341,  352,  343,  343,  344,
-      344,  348,  347,  349,  350,  350,  345,  346,  337,    0,
-      355,  341,  347,  346,  351,  349,  352,  351,  348,  353,
-      357,  354,  352,  354,  353,  376,  376,  348,  347,  349,
-      350,  350,  356,  390,  375,  356,  375,  357,  379,  378,
-      351,  379,  352,  351,  355,  353,  357,  354,    0,  354,
-      353,  376,  376,    0,    0,  378,    0,    0,  356,  390,
-      375,  356,  375,  357,  379,  378,  373,  379,    0,  362,
-
-      355,  362,  362,  362,  362,  362,  362,  362,  362,  362,
-      363,  378,  363,  363,  363,  363,  363,  363,  363,  363,
-      363,  363,    0,  363,  363,  363,  363,  363,  363,  364,
-      373,  364,  364,  364,  364,  364,  364,  364,  364,  364,
-      367,  367,  367,  367,  367,  367,  367,  367,  367,  363,
-      363,  363,  363,  363,  363,  365,  373,  365,  365,  365,
-      365,  365,  365,  365,  365,  365,  365,  374,  365,  365,
-      365,  365,  365,  365,  366,  410,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,    0,    0,  374,    0,    0,
-      388,    0,    0,  374,  365,  365,  365,  365,  365,  365,
-
-      368,  410,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  370,  374,  370,  370,  370,  370,  370,  370,
-      370,  370,  370,  370,  388,  370,  370,  370,  370,  370,
-      370,  372,    0,  372,  372,  372,  372,  372,  372,  372,
-      372,  372,    0,    0,    0,    0,    0,    0,    0,    0,
-      388,  370,  370,  370,  370,  370,  370,  371,  371,  371,
-      371,  371,  371,  371,  371,  371,  377,  380,  371,  371,
-      371,  371,  371,  371,  381,  377,  382,  383,  382,  385,
-      391,  386,  411,  380,  386,  383,  385,  391,    0,    0,
-      381,    0,  377,  380,  371,  371,  371,  371,  371,  371,
-
-      381,  377,  382,  383,  382,  385,  391,  386,  411,  380,
-      386,  383,  385,  391,  393,  387,  381,  384,  384,  395,
-      384,  384,  384,  384,  384,  384,  384,  387,  384,  389,
-        0,  393,  389,  396,  392,  394,  395,    0,  384,  384,
-      393,  387,  392,  394,  397,  395,  396,  398,  398,  399,
-      399,  400,  397,  387,  403,  389,  401,  393,  389,  396,
-      392,  394,  395,  403,  401,  404,  404,  405,  392,  394,
-      397,  400,  396,  398,  398,  399,  399,  400,  397,  402,
-      403,  408,  401,  407,  405,  402,  406,  408,  415,  403,
-      401,  404,  404,  405,  406,  407,  409,  400,  412,  418,
-
-      413,  414,  409,  413,  414,  402,  412,  408,  418,  407,
-      405,  402,  406,  408,  415,  416,  421,  416,  422,  417,
-      406,  407,  409,  419,  412,  418,  413,  414,  409,  413,
-      414,  419,  412,  417,  418,  420,  422,  424,  423,  425,
-      426,  416,  421,  416,  422,  417,  427,    0,  420,  419,
-      423,  420,  428,  429,  430,  431,  429,  419,  432,  417,
-      428,  420,  422,  433,  423,  434,  426,  434,    0,    0,
-      430,  424,  427,  425,  420,  433,  423,  420,  428,  429,
-      430,  431,  429,  437,  432,  438,  428,  456,  435,  433,
-      456,  434,  437,  434,  435,  439,  430,  424,  466,  425,
-
-      469,  433,  436,  436,  458,  460,  460,  439,    0,  437,
-        0,    0,    0,  456,  435,    0,  456,  458,  437,  438,
-      435,  439,    0,    0,  466,    0,  469,    0,  436,  436,
-      458,  460,  460,  439,  443,  443,  443,  443,  443,  443,
-      443,  443,  443,  458,  444,  438,  444,  444,  444,  444,
-      444,  444,  444,  444,  444,  444,  446,    0,  446,  446,
-      446,  446,  446,  446,  446,  446,  446,  446,  493,  446,
-      446,  446,  446,  446,  446,  448,  457,  448,  448,  448,
-      448,  448,  448,  448,  448,  448,    0,    0,    0,    0,
-        0,    0,    0,    0,  493,  446,  446,  446,  446,  446,
-
-      446,  447,  447,  447,  447,  447,  447,  447,  447,  447,
-      457,  471,  447,  447,  447,  447,  447,  447,  449,  471,
-      449,  449,  449,  449,  449,  449,  449,  449,  449,    0,
-      494,    0,    0,    0,    0,    0,  457,  471,  447,  447,
-      447,  447,  447,  447,  450,  471,  450,  450,  450,  450,
-      450,  450,  450,  450,  450,  451,  494,  451,  451,  451,
-      451,  451,  451,  451,  451,  451,  451,  500,  451,  451,
-      451,  451,  451,  451,  452,  514,  452,  452,  452,  452,
-      452,  452,  452,  452,  452,    0,    0,    0,    0,    0,
-        0,    0,    0,  500,  451,  451,  451,  451,  451,  451,
-
-      453,  514,  453,  453,  453,  453,  453,  453,  453,  453,
-      453,  453,  463,  453,  453,  453,  453,  453,  453,  454,
-      459,  454,  454,  454,  454,  454,  454,  454,  454,  454,
-      461,    0,  463,  465,  459,  462,  461,  464,  463,  453,
-      453,  453,  453,  453,  453,  455,  459,  467,  455,  464,
-      462,  462,  478,  465,  455,  462,  461,  467,  463,  465,
-      459,  462,  461,  464,  470,  467,  467,  468,  468,    0,
-      470,  455,    0,  467,  455,  464,  462,  462,  478,  465,
-      455,  462,  477,  467,  473,  473,  474,  475,  477,  472,
-      470,  467,  467,  468,  468,  472,  470,  472,  474,  476,
-
-      479,    0,  472,  475,  478,    0,  476,  480,  477,    0,
-      473,  473,  474,  475,  477,  472,    0,    0,  481,  482,
-      479,  472,  483,  472,  474,  476,  479,  480,  472,  475,
-        0,  484,  476,  480,  481,  482,  485,  486,    0,  487,
-      483,    0,  488,  486,  481,  482,  479,  484,  483,  490,
-        0,  489,  495,  480,  485,  487,  491,  484,  488,  491,
-      481,  482,  485,  486,  490,  487,  483,  489,  488,  486,
-        0,  492,  495,  484,    0,  490,  492,  489,  495,  501,
-      485,  487,  491,    0,  488,  491,  496,  496,  497,  497,
-      490,  502,  498,  489,  498,  499,  499,  492,  495,  501,
-
-      503,  502,  492,  504,  545,  501,  509,  509,  502,  504,
-      505,    0,  496,  496,  497,  497,  503,  502,  498,  506,
-      498,  499,  499,  508,  505,  501,  503,  502,  507,  504,
-      545,  511,  509,  509,  502,  504,  505,  506,  511,  510,
-      507,  510,  503,  508,  512,  506,  512,  515,  513,  508,
-      505,  516,  549,  516,  507,  513,  563,  511,  517,  515,
-        0,  517,    0,  506,  511,  510,  507,  510,    0,  508,
-      512,    0,  512,  515,  513,    0,    0,  516,  549,  516,
-        0,  513,  563,  567,  517,  515,  522,  517,  522,  522,
-      522,  522,  522,  522,  522,  522,  522,  523,    0,  523,
-
-      523,  523,  523,  523,  523,  523,  523,  523,  524,  567,
-      524,  524,  524,  524,  524,  524,  524,  524,  524,  524,
-        0,  524,  524,  524,  524,  524,  524,  525,  569,  525,
-      525,  525,  525,  525,  525,  525,  525,  525,  528,  528,
-      528,  528,  528,  528,  528,  528,  528,  524,  524,  524,
-      524,  524,  524,  526,  569,  526,  526,  526,  526,  526,
-      526,  526,  526,  526,  526,  537,  526,  526,  526,  526,
-      526,  526,  527,  573,  527,  527,  527,  527,  527,  527,
-      527,  527,  527,    0,    0,  537,    0,    0,    0,    0,
-        0,  537,  526,  526,  526,  526,  526,  526,  529,  573,
-
-      529,  529,  529,  529,  529,  529,  529,  529,  529,  529,
-      531,  537,  531,  531,  531,  531,  531,  531,  531,  531,
-      531,  531,    0,  531,  531,  531,  531,  531,  531,  533,
-        0,  533,  533,  533,  533,  533,  533,  533,  533,  533,
-        0,    0,    0,    0,    0,    0,    0,    0,  534,  531,
-      531,  531,  531,  531,  531,  532,  532,  532,  532,  532,
-      532,  532,  532,  532,  534,  535,  532,  532,  532,  532,
-      532,  532,  535,  536,  534,  538,  540,  539,  542,  542,
-      536,    0,  540,    0,  538,  539,  546,  541,  546,    0,
-      534,  535,  532,  532,  532,  532,  532,  532,  535,  536,
-
-      541,  538,  540,  539,  542,  542,  536,  543,  540,  544,
-      538,  539,  546,  541,  546,  547,  543,  551,  544,  548,
-      547,  550,  548,  552,  553,  553,  541,    0,  556,  557,
-      550,    0,  555,  543,  556,  544,  554,  551,  557,  552,
-      555,  547,  543,  551,  544,  548,  547,  550,  548,  552,
-      553,  553,  554,  558,  556,  557,  550,  559,  555,  562,
-      556,  560,  554,  551,  557,  552,  555,    0,  560,  558,
-      561,  565,  561,  566,  565,  559,  562,  568,  554,  558,
-      564,  564,  564,  559,  564,  562,  570,  560,  571,  574,
-      572,  571,  575,  568,  560,  558,  561,  565,  561,  572,
-
-      565,  559,  562,  568,  577,  578,  570,  566,  579,  576,
-      564,  576,  570,  581,  571,  574,  572,  571,  575,  568,
-      583,  590,  586,    0,  582,  572,  580,  587,  584,  581,
-      577,  578,  570,  566,  579,  576,  564,  576,  580,  581,
-      582,  584,  585,  588,  592,  587,  583,  590,  591,  585,
-      582,  589,  580,  587,  584,  581,  586,  591,    0,  589,
-      588,  592,  594,  595,  580,  595,  582,  584,  585,  588,
-      592,  587,  593,  597,  591,  585,  596,  589,  594,  598,
-      601,  599,  586,  591,  593,  589,  588,  592,  594,  595,
-      596,  595,  600,  621,    0,  598,  599,  600,  593,  597,
-
-        0,    0,  596,    0,  594,  598,  601,  599,  620,    0,
-      593,    0,    0,    0,    0,    0,  596,    0,  600,  621,
-      620,  598,  599,  600,  605,  605,  605,  605,  605,  605,
-      605,  605,  605,  606,  620,  606,  606,  606,  606,  606,
-      606,  606,  606,  606,  606,  608,  620,  608,  608,  608,
-      608,  608,  608,  608,  608,  608,  608,    0,  608,  608,
-      608,  608,  608,  608,  610,    0,  610,  610,  610,  610,
-      610,  610,  610,  610,  610,  611,  611,  611,  611,  611,
-      611,  611,  611,  611,  608,  608,  608,  608,  608,  608,
-      609,  609,  609,  609,  609,  609,  609,  609,  609,  616,
-
-      619,  609,  609,  609,  609,  609,  609,  613,  619,  613,
-      613,  613,  613,  613,  613,  613,  613,  613,    0,  616,
-        0,    0,    0,    0,    0,  616,  619,  609,  609,  609,
-      609,  609,  609,  612,  619,  612,  612,  612,  612,  612,
-      612,  612,  612,  612,  612,  616,  612,  612,  612,  612,
-      612,  612,  615,    0,  615,  615,  615,  615,  615,  615,
-      615,  615,  615,  681,  681,  681,  681,  681,  681,  681,
-      681,  681,  612,  612,  612,  612,  612,  612,  614,  630,
-      614,  614,  614,  614,  614,  614,  614,  614,  614,  614,
-      617,  614,  614,  614,  614,  614,  614,  618,  622,  617,
-
-      623,  622,  624,  625,    0,    0,  623,  618,  624,    0,
-      626,  625,    0,  630,  631,    0,  617,  614,  614,  614,
-      614,  614,  614,  618,  622,  617,  623,  622,  624,  625,
-      626,  627,  623,  618,  624,  628,  626,  625,  629,  630,
-      631,  633,  632,  627,  633,  634,  637,  635,    0,  636,
-      645,  628,  634,  635,  629,  636,  626,  627,  638,  643,
-        0,  628,  632,  639,  629,  638,  637,  633,  632,  627,
-      633,  634,  637,  635,  641,  636,  645,  628,  634,  635,
-      629,  636,  640,  639,  638,  640,  642,  642,  632,  639,
-      644,  638,  637,  643,  641,  646,  648,  649,  646,  647,
-
-      641,  651,  650,  654,  655,    0,  644,  656,  640,  639,
-      650,  640,  642,  642,  652,  653,  644,  653,  657,  643,
-      641,  661,  647,  652,  646,  665,  648,  658,  650,  654,
-      655,  649,  644,  656,  658,  651,  650,  662,    0,  659,
-      652,  653,  659,  653,  657,    0,  664,  661,  647,  652,
-      646,  660,  648,  658,  660,  662,  666,  649,  663,  665,
-      658,  651,  664,  662,  666,  659,  667,  663,  659,  667,
-      669,  668,  664,  671,  672,  673,  671,  660,  674,  670,
-      660,  662,  666,  668,  663,  665,  670,  675,  664,  697,
-      666,  676,  667,  663,    0,  667,  669,  668,    0,  671,
-
-      672,  673,  671,  675,  674,  670,  697,  676,    0,  668,
-        0,    0,  670,  675,    0,  697,  683,  676,  683,  683,
-      683,  683,  683,  683,  683,  683,  683,    0,  698,  675,
-        0,    0,  697,  676,  682,    0,  682,  682,  682,  682,
-      682,  682,  682,  682,  682,  682,  698,  682,  682,  682,
-      682,  682,  682,  685,  698,  685,  685,  685,  685,  685,
-      685,  685,  685,  685,    0,  699,    0,    0,    0,    0,
-        0,    0,  698,  682,  682,  682,  682,  682,  682,  684,
-        0,  684,  684,  684,  684,  684,  684,  684,  684,  684,
-      684,  699,  684,  684,  684,  684,  684,  684,  686,  703,
-
-      686,  686,  686,  686,  686,  686,  686,  686,  686,  686,
-      705,    0,    0,    0,    0,    0,    0,    0,  684,  684,
-      684,  684,  684,  684,  688,  703,  688,  688,  688,  688,
-      688,  688,  688,  688,  688,  688,  705,  688,  688,  688,
-      688,  688,  688,  690,  707,  690,  690,  690,  690,  690,
-      690,  690,  690,  690,    0,    0,    0,    0,    0,    0,
-      691,    0,  691,  688,  688,  688,  688,  688,  688,  689,
-      689,  689,  689,  689,  689,  689,  689,  689,  707,    0,
-      689,  689,  689,  689,  689,  689,  691,  692,  691,  693,
-      694,  692,  694,  695,  700,  695,  693,  702,  700,  701,
-
-      696,  702,  701,    0,  707,  704,  689,  689,  689,  689,
-      689,  689,  696,  692,  704,  693,  694,  692,  694,  695,
-      700,  695,  693,  702,  700,  701,  696,  702,  701,  708,
-      706,  704,  706,  709,  710,  711,  712,  713,  696,  714,
-      704,  715,    0,  715,  716,  718,  708,  722,  717,  713,
-        0,  709,  712,  711,  719,  708,  706,  720,  706,  709,
-      710,  711,  712,  713,  716,  714,  721,  715,  717,  715,
-      716,  718,  708,  726,  717,  713,  722,  709,  712,  711,
-      723,  719,  720,  725,  727,  724,  728,  729,  730,  723,
-      716,  724,  731,  721,  717,  725,  732,  735,    0,  726,
-
-      733,    0,  722,  740,  741,    0,  723,  719,  720,  725,
-      727,  724,  728,  729,  730,  723,  733,  724,  731,  721,
-      734,  725,  732,  735,  736,  737,  733,  738,  739,  740,
-      741,  743,  734,  736,  742,  742,  757,  737,  759,  758,
-      760,  760,  733,  738,  739,  758,  734,  764,    0,  743,
-      736,  737,    0,  738,  739,    0,    0,  743,  734,  736,
-      742,  742,  757,  737,  759,  758,  760,  760,    0,  738,
-      739,  758,  766,  764,  747,  743,  747,  747,  747,  747,
-      747,  747,  747,  747,  747,  747,  749,    0,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,  749,  766,  749,
-
-      749,  749,  749,  749,  749,  751,    0,  751,  751,  751,
-      751,  751,  751,  751,  751,  751,    0,    0,    0,    0,
-        0,    0,    0,  768,    0,  749,  749,  749,  749,  749,
-      749,  750,  750,  750,  750,  750,  750,  750,  750,  750,
-      761,  761,  750,  750,  750,  750,  750,  750,  753,  768,
-      753,  753,  753,  753,  753,  753,  753,  753,  753,    0,
-      774,    0,    0,    0,    0,    0,  761,  761,  750,  750,
-      750,  750,  750,  750,  752,    0,  752,  752,  752,  752,
-      752,  752,  752,  752,  752,  752,  775,  752,  752,  752,
-      752,  752,  752,  755,  774,  755,  755,  755,  755,  755,
-
-      755,  755,  755,  755,    0,    0,    0,    0,    0,    0,
-        0,    0,  775,  752,  752,  752,  752,  752,  752,  754,
-      774,  754,  754,  754,  754,  754,  754,  754,  754,  754,
-      754,  756,  754,  754,  754,  754,  754,  754,  762,  763,
-      762,    0,    0,  771,  769,  763,  769,  756,    0,  771,
-      772,  765,  767,  773,  773,    0,  772,  756,  754,  754,
-      754,  754,  754,  754,  762,  763,  762,  765,  767,  771,
-      769,  763,  769,  756,  770,  771,  772,  765,  767,  773,
-      773,  776,  772,  770,  777,  777,  778,  779,  776,  780,
-      781,  782,  783,  765,  767,  778,    0,    0,    0,  789,
-
-      770,  792,  792,  784,  779,  785,  786,  776,  793,  770,
-      777,  777,  778,  779,  776,  780,  781,  782,  783,  784,
-      790,  778,  785,  786,  791,  795,  796,  792,  792,  784,
-      779,  785,  786,  789,  794,  790,  791,  795,  812,  814,
-      810,  794,  793,    0,  810,  784,  790,    0,  785,  786,
-      791,  795,  796,    0,    0,  819,    0,    0,    0,  789,
-      794,  790,  791,  795,  812,  814,  810,  794,  793,  801,
-      810,  801,  801,  801,  801,  801,  801,  801,  801,  801,
-      801,  819,  801,  801,  801,  801,  801,  801,  802,  820,
-      802,  802,  802,  802,  802,  802,  802,  802,  802,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,  801,  801,
-      801,  801,  801,  801,  803,  820,  803,  803,  803,  803,
-      803,  803,  803,  803,  803,  803,  818,  803,  803,  803,
-      803,  803,  803,  804,  824,  804,  804,  804,  804,  804,
-      804,  804,  804,  804,    0,    0,  818,    0,    0,    0,
-        0,    0,  818,  803,  803,  803,  803,  803,  803,  805,
-      824,  805,  805,  805,  805,  805,  805,  805,  805,  805,
-      805,  807,  818,  807,  807,  807,  807,  807,  807,  807,
-      807,  807,  807,    0,  807,  807,  807,  807,  807,  807,
-      809,    0,  809,  809,  809,  809,  809,  809,  809,  809,
-
-      809,    0,    0,    0,    0,    0,    0,  811,    0,  811,
-      807,  807,  807,  807,  807,  807,  808,  808,  808,  808,
-      808,  808,  808,  808,  808,  813,    0,  808,  808,  808,
-      808,  808,  808,  811,  815,  811,  817,  822,  813,  823,
-      822,  825,  816,  815,  826,  821,  827,  825,  823,  825,
-      828,  813,  817,  808,  808,  808,  808,  808,  808,  816,
-      815,  821,  817,  822,  813,  823,  822,  825,  816,  815,
-      826,  821,  827,  825,  823,  825,  828,  829,  817,  830,
-      831,  832,  833,  835,  834,  816,  836,  821,  837,    0,
-      833,  838,  838,  839,  829,  852,  831,  855,  835,  830,
-
-      834,  839,  856,  829,  837,  830,  831,    0,  833,  835,
-      834,    0,  836,    0,  837,  832,  833,  838,  838,  839,
-      829,  852,  831,  855,  835,  830,  834,  839,  856,  843,
-      837,  843,  843,  843,  843,  843,  843,  843,  843,  843,
-      843,  832,  845,    0,  845,  845,  845,  845,  845,  845,
-      845,  845,  845,  845,  862,  845,  845,  845,  845,  845,
-      845,  847,    0,  847,  847,  847,  847,  847,  847,  847,
-      847,  847,    0,    0,    0,    0,    0,    0,    0,    0,
-      862,  845,  845,  845,  845,  845,  845,  846,  846,  846,
-      846,  846,  846,  846,  846,  846,  860,  854,  846,  846,
-
-      846,  846,  846,  846,  849,  854,  849,  849,  849,  849,
-      849,  849,  849,  849,  849,    0,  860,    0,    0,    0,
-        0,    0,  860,  854,  846,  846,  846,  846,  846,  846,
-      848,  854,  848,  848,  848,  848,  848,  848,  848,  848,
-      848,  848,  860,  848,  848,  848,  848,  848,  848,  851,
-      867,  851,  851,  851,  851,  851,  851,  851,  851,  851,
-        0,  853,  861,    0,    0,    0,    0,    0,  853,  848,
-      848,  848,  848,  848,  848,  850,  867,  850,  850,  850,
-      850,  850,  850,  850,  850,  850,  850,  853,  850,  850,
-      850,  850,  850,  850,  853,  857,  861,  858,  857,  858,
-
-      864,  865,  868,  863,  865,  866,  869,  866,  868,  870,
-      870,  889,  869,  864,  850,  850,  850,  850,  850,  850,
-      863,  857,  861,  858,  857,  858,  864,  865,  868,  863,
-      865,  866,  869,  866,  868,  870,  870,  871,  869,  864,
-      872,  873,  874,  873,  888,  889,  863,  872,  890,  894,
-      891,  894,  900,  871,  891,  900,  903,  903,  874,    0,
-      888,    0,    0,  871,    0,    0,  872,  873,  874,  873,
-      888,  889,    0,  872,  890,  894,  891,  894,  900,  871,
-      891,  900,  903,  903,  874,  879,  888,  879,  879,  879,
-      879,  879,  879,  879,  879,  879,  879,  905,  879,  879,
-
-      879,  879,  879,  879,  880,  906,  880,  880,  880,  880,
-      880,  880,  880,  880,  880,    0,  896,    0,    0,    0,
-        0,    0,    0,  905,  879,  879,  879,  879,  879,  879,
-      881,  906,  881,  881,  881,  881,  881,  881,  881,  881,
-      881,  881,  896,  881,  881,  881,  881,  881,  881,  882,
-      902,  882,  882,  882,  882,  882,  882,  882,  882,  882,
-        0,    0,  902,    0,    0,    0,    0,    0,  896,  881,
-      881,  881,  881,  881,  881,  883,  902,  883,  883,  883,
-      883,  883,  883,  883,  883,  883,  883,  885,  902,  885,
-      885,  885,  885,  885,  885,  885,  885,  885,  885,    0,
-
-      885,  885,  885,  885,  885,  885,  887,    0,  887,  887,
-      887,  887,  887,  887,  887,  887,  887,    0,    0,    0,
-        0,    0,    0,  922,  923,  892,  885,  885,  885,  885,
-      885,  885,  886,  886,  886,  886,  886,  886,  886,  886,
-      886,  892,  893,  886,  886,  886,  886,  886,  886,    0,
-      923,  892,    0,    0,    0,    0,  897,  922,  893,  895,
-      904,  924,  898,  899,  901,  925,  929,  892,  893,  886,
-      886,  886,  886,  886,  886,  895,  897,  895,  898,  899,
-      904,  901,  897,  922,  893,  895,  904,  924,  898,  899,
-      901,  925,  929,    0,    0,  932,    0,    0,    0,    0,
-
-        0,  895,  897,  895,  898,  899,  904,  901,  911,    0,
-      911,  911,  911,  911,  911,  911,  911,  911,  911,  911,
-      913,  932,  913,  913,  913,  913,  913,  913,  913,  913,
-      913,  913,  955,  913,  913,  913,  913,  913,  913,  915,
-        0,  915,  915,  915,  915,  915,  915,  915,  915,  915,
-        0,    0,    0,    0,    0,    0,    0,    0,  955,  913,
-      913,  913,  913,  913,  913,  914,  914,  914,  914,  914,
-      914,  914,  914,  914,  927,  937,  914,  914,  914,  914,
-      914,  914,  917,  927,  917,  917,  917,  917,  917,  917,
-      917,  917,  917,    0,  937,    0,    0,    0,    0,    0,
-
-      927,  937,  914,  914,  914,  914,  914,  914,  916,  927,
-      916,  916,  916,  916,  916,  916,  916,  916,  916,  916,
-      937,  916,  916,  916,  916,  916,  916,  919,    0,  919,
-      919,  919,  919,  919,  919,  919,  919,  919,    0,  921,
-        0,    0,    0,    0,    0,    0,    0,  916,  916,  916,
-      916,  916,  916,  918,  921,  918,  918,  918,  918,  918,
-      918,  918,  918,  918,  918,  921,  918,  918,  918,  918,
-      918,  918,  920,  926,  928,  920,  931,    0,  931,  928,
-      921,  930,  930,  930,  952,  930,  933,  956,  952,  926,
-      934,    0,  918,  918,  918,  918,  918,  918,  920,  926,
-
-      928,  920,  931,  933,  931,  928,  934,  936,  957,  935,
-      952,  930,  933,  956,  952,  926,  934,  935,  944,  936,
-      944,  944,  944,  944,  944,  944,  944,  944,  944,  933,
-        0,    0,  934,  936,  957,  935,    0,  930,    0,    0,
-      960,    0,    0,  935,    0,  936,  943,    0,  943,  943,
-      943,  943,  943,  943,  943,  943,  943,  943,  966,  943,
-      943,  943,  943,  943,  943,  946,  960,  946,  946,  946,
-      946,  946,  946,  946,  946,  946,    0,    0,    0,    0,
-      962,  963,    0,    0,  966,  943,  943,  943,  943,  943,
-      943,  945,    0,  945,  945,  945,  945,  945,  945,  945,
-
-      945,  945,  958,  962,  945,  945,  945,  945,  945,  945,
-      947,  963,  947,  947,  947,  947,  947,  947,  947,  947,
-      947,  947,  958,    0,    0,    0,    0,    0,  958,  962,
-      945,  945,  945,  945,  945,  945,  949,  963,  949,  949,
-      949,  949,  949,  949,  949,  949,  949,  949,  958,  949,
-      949,  949,  949,  949,  949,  951,  959,  951,  951,  951,
-      951,  951,  951,  951,  951,  951,  953,    0,  961,  954,
-      953,  961,  959,    0,  965,  949,  949,  949,  949,  949,
-      949,  954,  959,  964,  969,  964,  967,  982,  954,  954,
-      965,  968,  953,  969,  987,  954,  953,  961,  959,  968,
-
-      965,    0,  967,    0,    0,    0,    0,  954,    0,  964,
-      969,  964,  967,  982,  954,  954,  965,  968,    0,  969,
-      987,    0,    0,  961,  988,  968,  992,  975,  967,  975,
-      975,  975,  975,  975,  975,  975,  975,  975,  975,  977,
-        0,  977,  977,  977,  977,  977,  977,  977,  977,  977,
-      988,  992,  977,  977,  977,  977,  977,  977,  978,  995,
-      978,  978,  978,  978,  978,  978,  978,  978,  978,    0,
-        0,    0,    0,    0,    0,    0,    0,  992,  977,  977,
-      977,  977,  977,  977,  979,  995,  979,  979,  979,  979,
-      979,  979,  979,  979,  979,  979,  984,  979,  979,  979,
-
-      979,  979,  979,  980,  983,  980,  980,  980,  980,  980,
-      980,  980,  980,  980,  984,  985,  989,  997,  989,  994,
-      990,  983,  984,  979,  979,  979,  979,  979,  979,  991,
-      983,  986,  993,    0,  998,  985,  996,  986,  990,  996,
-      984,  985,  989,  997,  989, 1009,  990,  983,  994,  986,
-      998,  999, 1009, 1014, 1018, 1011,  991,  986, 1011,  993,
-      998,  985,  996,  986,  990,  996, 1019,  999,    0, 1020,
-        0, 1009,    0,    0,  994,  986,  998,  999, 1009, 1014,
-     1018, 1011,  991,    0, 1011,  993,    0,    0, 1010,    0,
-        0,    0, 1019,  999, 1004, 1020, 1004, 1004, 1004, 1004,
-
-     1004, 1004, 1004, 1004, 1004, 1021, 1010, 1004, 1004, 1004,
-     1004, 1004, 1004, 1005, 1010, 1005, 1005, 1005, 1005, 1005,
-     1005, 1005, 1005, 1005,    0, 1012,    0, 1016, 1022, 1016,
-     1012, 1021, 1010, 1004, 1004, 1004, 1004, 1004, 1004, 1006,
-        0, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
-     1006, 1012, 1013, 1016, 1022, 1016, 1012, 1023, 1017, 1017,
-     1013, 1017, 1017, 1017, 1017, 1017, 1017, 1024,    0, 1017,
-        0, 1034, 1035,    0,    0,    0,    0, 1032, 1013, 1017,
-     1017,    0, 1041, 1023, 1024,    0, 1013, 1051, 1033, 1038,
-     1038, 1036, 1029, 1024, 1029, 1029, 1029, 1029, 1029, 1029,
-
-     1029, 1029, 1029, 1032, 1033, 1034, 1035, 1036, 1041, 1047,
-     1024, 1040, 1040, 1051, 1033, 1038, 1038, 1036, 1039, 1039,
-     1052, 1039, 1039, 1039, 1039, 1039, 1039, 1047, 1040, 1039,
-     1033, 1034, 1035, 1036,    0, 1047, 1046, 1040, 1040, 1039,
-     1039, 1046, 1048, 1049, 1050, 1050, 1052, 1048,    0, 1049,
-     1063,    0, 1055, 1047, 1040, 1053, 1053, 1054, 1061, 1055,
-     1060, 1060, 1046, 1064, 1061, 1065, 1066, 1046, 1048, 1049,
-     1050, 1050, 1053, 1048, 1062, 1049, 1063, 1054, 1055, 1068,
-     1062, 1053, 1053, 1054, 1061, 1055, 1060, 1060, 1069, 1064,
-     1061, 1065, 1066, 1070, 1070, 1069, 1071, 1075, 1053, 1068,
-
-     1062, 1076, 1079, 1054, 1077, 1068, 1062, 1077, 1076, 1078,
-     1078, 1081, 1082, 1082, 1069, 1083, 1090, 1090,    0, 1070,
-     1070, 1069, 1071, 1075, 1084, 1068, 1091, 1076, 1079, 1092,
-     1077, 1094, 1095, 1077, 1076, 1078, 1078, 1081, 1082, 1082,
-     1089, 1083, 1090, 1090, 1084, 1100, 1099, 1089, 1099, 1102,
-     1084, 1094, 1091, 1107,    0, 1092,    0, 1094, 1095,    0,
-        0,    0,    0,    0,    0,    0, 1089,    0,    0,    0,
-     1084, 1100, 1099, 1089, 1099, 1102,    0, 1094,    0, 1107,
-     1118, 1118, 1118, 1118, 1119, 1119, 1119, 1119, 1120, 1120,
-     1120, 1120, 1121,    0, 1121, 1121, 1122, 1122, 1122, 1122,
-
-     1123,    0, 1123, 1123, 1124, 1124, 1126, 1126, 1127, 1127,
-     1128, 1128, 1129, 1129, 1130, 1130, 1131, 1131, 1132, 1132,
-     1133, 1133, 1134, 1134, 1135, 1135, 1136,    0, 1136, 1136,
-     1137, 1137, 1138, 1138, 1139, 1139, 1140, 1140, 1141, 1141,
-     1142, 1142, 1143, 1143, 1144, 1144, 1145, 1145, 1146, 1146,
-     1147, 1147, 1148, 1148, 1149, 1149, 1150, 1150, 1151, 1151,
-     1152, 1152, 1153, 1153, 1154, 1154, 1155, 1155, 1156, 1156,
-     1157, 1157, 1158, 1158, 1159, 1159, 1160, 1160, 1161, 1161,
-     1162, 1162, 1164, 1164, 1165, 1165, 1166, 1166, 1168, 1168,
-     1169, 1169, 1170, 1170, 1173, 1173, 1174, 1174, 1175, 1175,
-
-     1177,    0, 1177, 1177, 1178,    0, 1178, 1178, 1179, 1179,
-     1180, 1180, 1183,    0, 1183, 1183, 1184,    0, 1184, 1184,
-     1185, 1185, 1186, 1186, 1187, 1187, 1188, 1188, 1189, 1189,
-     1191, 1191, 1192, 1192, 1193, 1193, 1194, 1194, 1195, 1195,
-     1197, 1197, 1198, 1198, 1199, 1199, 1201, 1201, 1203, 1203,
-     1204, 1204, 1205, 1205, 1207, 1207, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117, 1117,
-     1117, 1117
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   65,
+       65,   65,   65,   65,   65,   65,   65,   65,   65,   97,
+       65,   65,   65,   65,   65,   65,   91,   65,   94,  101,
+      103,   91,  104,  105,   97,  106,   94,  107,  109,  108,
+      110,  111,  112,  113,  114,   91,  108,  115,  108,  108,
+      108,  116,  108,  119,  120,  121,  122,  123,  124,  125,
+      126,  141,  142,  143,  115,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  144,  145,  130,  130,  130,  130,
+
+      130,  130,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  147,  148,  131,  131,  131,  131,  131,  131,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  133,  133,
+      133,  133,  133,  133,  133,  133,  133,  133,  149,  133,
+      133,  133,  133,  133,  133,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  150,  151,  134,  134,  134,  134,
+      134,  134,  135,  135,  135,  135,  135,  135,  135,  135,
+      135,  152,  153,  135,  135,  135,  135,  135,  135,  136,
+      154,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  155,  136,  136,  136,  136,  136,  136,  137,  156,
+
+      137,  137,  137,  137,  137,  137,  137,  137,  137,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  157,
+      139,  139,  139,  139,  139,  139,  158,  159,  160,  161,
+      162,  163,  164,  165,  166,  167,  168,  169,  170,  172,
+      173,  174,  175,  176,  177,  178,  179,  179,  180,  181,
+      183,  182,  184,  185,  186,  187,  188,  189,  190,  169,
+      182,  191,  192,  193,  182,  194,  195,  196,  197,  198,
+      199,  200,  201,  202,  203,  204,  205,  201,  206,  207,
+      208,  223,  226,  202,  210,  210,  210,  210,  210,  210,
+      210,  210,  210,  227,  228,  210,  210,  210,  210,  210,
+
+      210,  211,  211,  211,  211,  211,  211,  211,  211,  211,
+      212,  212,  212,  212,  212,  212,  212,  212,  212,  224,
+      229,  212,  212,  212,  212,  212,  212,  213,  213,  213,
+      213,  213,  213,  213,  213,  213,  230,  224,  213,  213,
+      213,  213,  213,  213,  214,  214,  214,  214,  214,  214,
+      214,  214,  214,  231,  232,  214,  214,  214,  214,  214,
+      214,  215,  233,  215,  215,  215,  215,  215,  215,  215,
+      215,  215,  215,  234,  215,  215,  215,  215,  215,  215,
+      216,  235,  216,  216,  216,  216,  216,  216,  216,  216,
+      216,  218,  218,  218,  218,  218,  218,  218,  218,  218,
+
+      219,  219,  219,  219,  219,  219,  219,  219,  219,  237,
+      238,  219,  219,  219,  219,  219,  219,  220,  220,  220,
+      220,  220,  220,  220,  220,  220,  239,  240,  220,  220,
+      220,  220,  220,  220,  221,  242,  221,  221,  221,  221,
+      221,  221,  221,  221,  221,  222,  222,  222,  222,  222,
+      222,  222,  222,  222,  243,  244,  222,  222,  222,  222,
+      222,  222,  245,  246,  247,  248,  249,  250,  251,  252,
+      253,  254,  255,  256,  257,  258,  259,  260,  261,  262,
+      263,  264,  256,  256,  256,  265,  266,  267,  269,  270,
+      271,  272,  269,  261,  273,  274,  275,  276,  277,  278,
+
+      279,  280,  281,  282,  283,  284,  285,  286,  287,  288,
+      289,  291,  292,  293,  294,  295,  296,  281,  297,  298,
+      298,  298,  298,  298,  298,  298,  298,  298,  309,  310,
+      298,  298,  298,  298,  298,  298,  299,  299,  299,  299,
+      299,  299,  299,  299,  299,  299,  311,  299,  299,  299,
+      299,  299,  299,  300,  300,  300,  300,  300,  300,  300,
+      300,  300,  301,  301,  301,  301,  301,  301,  301,  301,
+      301,  312,  313,  301,  301,  301,  301,  301,  301,  302,
+      302,  302,  302,  302,  302,  302,  302,  302,  316,  317,
+      302,  302,  302,  302,  302,  302,  303,  318,  303,  303,
+
+      303,  303,  303,  303,  303,  303,  303,  304,  319,  304,
+      304,  304,  304,  304,  304,  304,  304,  304,  305,  305,
+      305,  305,  305,  305,  305,  305,  305,  320,  322,  305,
+      305,  305,  305,  305,  305,  306,  323,  306,  306,  306,
+      306,  306,  306,  306,  306,  306,  307,  307,  307,  307,
+      307,  307,  307,  307,  307,  307,  324,  307,  307,  307,
+      307,  307,  307,  308,  315,  308,  308,  308,  308,  308,
+      308,  308,  308,  308,  321,  325,  315,  326,  321,  315,
+      327,  315,  329,  331,  332,  333,  334,  335,  336,  337,
+      332,  338,  339,  340,  341,  342,  343,  344,  345,  346,
+
+      347,  348,  349,  350,  351,  352,  353,  354,  355,  356,
+      357,  358,  359,  360,  361,  363,  348,  364,  365,  367,
+      368,  370,  371,  372,  373,  374,  375,  376,  377,  378,
+      379,  380,  381,  382,  383,  384,  384,  384,  384,  384,
+      384,  384,  384,  384,  385,  396,  384,  384,  384,  384,
+      384,  384,  386,  386,  386,  386,  386,  386,  386,  386,
+      386,  400,  401,  386,  386,  386,  386,  386,  386,  387,
+      387,  387,  387,  387,  387,  387,  387,  387,  402,  403,
+      387,  387,  387,  387,  387,  387,  388,  404,  388,  388,
+      388,  388,  388,  388,  388,  388,  388,  389,  389,  389,
+
+      389,  389,  389,  389,  389,  389,  405,  406,  389,  389,
+      389,  389,  389,  389,  390,  407,  390,  390,  390,  390,
+      390,  390,  390,  390,  390,  391,  391,  391,  391,  391,
+      391,  391,  391,  391,  391,  408,  391,  391,  391,  391,
+      391,  391,  392,  409,  392,  392,  392,  392,  392,  392,
+      392,  392,  392,  393,  393,  393,  393,  393,  393,  393,
+      393,  393,  395,  410,  395,  395,  395,  395,  395,  395,
+      395,  395,  395,  395,  397,  397,  397,  397,  397,  397,
+      397,  397,  397,  412,  413,  397,  397,  397,  397,  397,
+      397,  398,  398,  398,  398,  398,  398,  398,  398,  398,
+
+      414,  415,  398,  398,  398,  398,  398,  398,  399,  416,
+      399,  399,  399,  399,  399,  399,  399,  399,  399,  411,
+      411,  417,  411,  411,  411,  411,  411,  411,  411,  411,
+      411,  411,  411,  411,  411,  411,  411,  411,  411,  411,
+      411,  411,  411,  411,  411,  411,  411,  411,  411,  411,
+      411,  411,  411,  411,  411,  411,  411,  411,  411,  411,
+      411,  411,  411,  411,  411,  411,  411,  411,  419,  420,
+      421,  422,  423,  424,  425,  426,  427,  428,  429,  430,
+      430,  431,  432,  433,  434,  435,  436,  437,  438,  439,
+      440,  441,  442,  443,  444,  446,  447,  448,  449,  450,
+
+      452,  453,  454,  455,  456,  457,  460,  461,  462,  463,
+      466,  467,  450,  468,  469,  470,  471,  472,  473,  474,
+      474,  474,  474,  474,  474,  474,  474,  474,  480,  485,
+      474,  474,  474,  474,  474,  474,  475,  475,  475,  475,
+      475,  475,  475,  475,  475,  491,  492,  475,  475,  475,
+      475,  475,  475,  476,  476,  476,  476,  476,  476,  476,
+      476,  476,  476,  493,  476,  476,  476,  476,  476,  476,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  479,
+      494,  479,  479,  479,  479,  479,  479,  479,  479,  479,
+      479,  481,  481,  481,  481,  481,  481,  481,  481,  481,
+
+      495,  496,  481,  481,  481,  481,  481,  481,  482,  482,
+      482,  482,  482,  482,  482,  482,  482,  498,  499,  482,
+      482,  482,  482,  482,  482,  483,  500,  483,  483,  483,
+      483,  483,  483,  483,  483,  483,  484,  501,  484,  484,
+      484,  484,  484,  484,  484,  484,  484,  486,  486,  486,
+      486,  486,  486,  486,  486,  486,  503,  505,  486,  486,
+      486,  486,  486,  486,  487,  506,  487,  487,  487,  487,
+      487,  487,  487,  487,  487,  488,  488,  488,  488,  488,
+      488,  488,  488,  488,  488,  507,  488,  488,  488,  488,
+      488,  488,  489,  497,  489,  489,  489,  489,  489,  489,
+
+      489,  489,  489,  490,  502,  508,  490,  509,  497,  497,
+      510,  508,  490,  508,  502,  511,  512,  513,  514,  515,
+      516,  517,  518,  502,  519,  520,  521,  522,  523,  524,
+      525,  526,  527,  528,  529,  530,  531,  532,  533,  534,
+      535,  536,  537,  538,  540,  541,  542,  543,  544,  545,
+      546,  547,  548,  549,  550,  541,  551,  552,  553,  554,
+      555,  556,  558,  559,  560,  561,  562,  563,  563,  563,
+      563,  563,  563,  563,  563,  563,  566,  573,  563,  563,
+      563,  563,  563,  563,  564,  564,  564,  564,  564,  564,
+      564,  564,  564,  574,  578,  564,  564,  564,  564,  564,
+
+      564,  565,  579,  565,  565,  565,  565,  565,  565,  565,
+      565,  565,  567,  567,  567,  567,  567,  567,  567,  567,
+      567,  580,  581,  567,  567,  567,  567,  567,  567,  568,
+      582,  568,  568,  568,  568,  568,  568,  568,  568,  568,
+      569,  569,  569,  569,  569,  569,  569,  569,  569,  569,
+      583,  569,  569,  569,  569,  569,  569,  570,  584,  570,
+      570,  570,  570,  570,  570,  570,  570,  570,  571,  571,
+      571,  571,  571,  571,  571,  571,  571,  575,  575,  575,
+      575,  575,  575,  575,  575,  575,  585,  586,  575,  575,
+      575,  575,  575,  575,  576,  576,  576,  576,  576,  576,
+
+      576,  576,  576,  587,  588,  576,  576,  576,  576,  576,
+      576,  577,  589,  577,  577,  577,  577,  577,  577,  577,
+      577,  577,  590,  591,  592,  593,  594,  595,  596,  597,
+      598,  599,  600,  601,  602,  603,  604,  605,  606,  607,
+      609,  609,  609,  610,  609,  611,  612,  614,  615,  616,
+      618,  619,  620,  624,  626,  627,  628,  629,  630,  632,
+      633,  634,  635,  636,  637,  638,  639,  640,  641,  642,
+      643,  644,  645,  646,  647,  649,  650,  639,  651,  652,
+      654,  654,  654,  654,  654,  654,  654,  654,  654,  659,
+      660,  654,  654,  654,  654,  654,  654,  655,  655,  655,
+
+      655,  655,  655,  655,  655,  655,  669,  670,  655,  655,
+      655,  655,  655,  655,  656,  656,  656,  656,  656,  656,
+      656,  656,  656,  656,  671,  656,  656,  656,  656,  656,
+      656,  657,  657,  657,  657,  657,  657,  657,  657,  657,
+      661,  661,  661,  661,  661,  661,  661,  661,  661,  672,
+      673,  661,  661,  661,  661,  661,  661,  662,  662,  662,
+      662,  662,  662,  662,  662,  662,  675,  676,  662,  662,
+      662,  662,  662,  662,  663,  677,  663,  663,  663,  663,
+      663,  663,  663,  663,  663,  664,  664,  664,  664,  664,
+      664,  664,  664,  664,  665,  665,  665,  665,  665,  665,
+
+      665,  665,  665,  678,  679,  665,  665,  665,  665,  665,
+      665,  666,  680,  666,  666,  666,  666,  666,  666,  666,
+      666,  666,  667,  667,  667,  667,  667,  667,  667,  667,
+      667,  667,  681,  667,  667,  667,  667,  667,  667,  668,
+      682,  668,  668,  668,  668,  668,  668,  668,  668,  668,
+      683,  684,  685,  686,  687,  688,  689,  690,  691,  692,
+      693,  694,  695,  696,  697,  698,  700,  701,  702,  700,
+      703,  704,  705,  706,  707,  708,  709,  710,  713,  714,
+      715,  716,  717,  719,  720,  721,  722,  723,  724,  725,
+      726,  728,  729,  730,  731,  732,  735,  737,  738,  739,
+
+      739,  739,  739,  739,  739,  739,  739,  739,  740,  749,
+      739,  739,  739,  739,  739,  739,  741,  741,  741,  741,
+      741,  741,  741,  741,  741,  750,  754,  741,  741,  741,
+      741,  741,  741,  742,  742,  742,  742,  742,  742,  742,
+      742,  742,  755,  756,  742,  742,  742,  742,  742,  742,
+      743,  743,  743,  743,  743,  743,  743,  743,  743,  744,
+      744,  744,  744,  744,  744,  744,  744,  744,  757,  758,
+      744,  744,  744,  744,  744,  744,  745,  759,  745,  745,
+      745,  745,  745,  745,  745,  745,  745,  746,  746,  746,
+      746,  746,  746,  746,  746,  746,  746,  760,  746,  746,
+
+      746,  746,  746,  746,  747,  761,  747,  747,  747,  747,
+      747,  747,  747,  747,  747,  751,  751,  751,  751,  751,
+      751,  751,  751,  751,  763,  764,  751,  751,  751,  751,
+      751,  751,  752,  752,  752,  752,  752,  752,  752,  752,
+      752,  765,  767,  752,  752,  752,  752,  752,  752,  753,
+      768,  753,  753,  753,  753,  753,  753,  753,  753,  753,
+      769,  770,  771,  772,  773,  774,  775,  776,  777,  779,
+      780,  781,  783,  784,  785,  786,  787,  788,  790,  791,
+      795,  796,  800,  801,  803,  804,  805,  806,  807,  808,
+      809,  813,  814,  815,  816,  817,  817,  817,  817,  817,
+
+      817,  817,  817,  817,  820,  821,  817,  817,  817,  817,
+      817,  817,  818,  818,  818,  818,  818,  818,  818,  818,
+      818,  818,  829,  818,  818,  818,  818,  818,  818,  822,
+      822,  822,  822,  822,  822,  822,  822,  822,  831,  833,
+      822,  822,  822,  822,  822,  822,  823,  823,  823,  823,
+      823,  823,  823,  823,  823,  834,  835,  823,  823,  823,
+      823,  823,  823,  824,  836,  824,  824,  824,  824,  824,
+      824,  824,  824,  824,  825,  825,  825,  825,  825,  825,
+      825,  825,  825,  838,  839,  825,  825,  825,  825,  825,
+      825,  826,  840,  826,  826,  826,  826,  826,  826,  826,
+
+      826,  826,  827,  827,  827,  827,  827,  827,  827,  827,
+      827,  827,  841,  827,  827,  827,  827,  827,  827,  828,
+      842,  828,  828,  828,  828,  828,  828,  828,  828,  828,
+      843,  844,  845,  846,  847,  848,  850,  851,  852,  853,
+      858,  859,  860,  864,  865,  866,  867,  868,  869,  870,
+      871,  873,  874,  876,  876,  876,  876,  876,  876,  876,
+      876,  876,  877,  884,  876,  876,  876,  876,  876,  876,
+      878,  878,  878,  878,  878,  878,  878,  878,  878,  885,
+      889,  878,  878,  878,  878,  878,  878,  879,  879,  879,
+      879,  879,  879,  879,  879,  879,  890,  892,  879,  879,
+
+      879,  879,  879,  879,  880,  880,  880,  880,  880,  880,
+      880,  880,  880,  894,  895,  880,  880,  880,  880,  880,
+      880,  881,  896,  881,  881,  881,  881,  881,  881,  881,
+      881,  881,  882,  882,  882,  882,  882,  882,  882,  882,
+      882,  882,  897,  882,  882,  882,  882,  882,  882,  883,
+      898,  883,  883,  883,  883,  883,  883,  883,  883,  883,
+      886,  886,  886,  886,  886,  886,  886,  886,  886,  900,
+      901,  886,  886,  886,  886,  886,  886,  887,  887,  887,
+      887,  887,  887,  887,  887,  887,  902,  904,  887,  887,
+      887,  887,  887,  887,  888,  909,  888,  888,  888,  888,
+
+      888,  888,  888,  888,  888,  905,  910,  911,  912,  913,
+      914,  905,  915,  917,  919,  920,  921,  922,  923,  923,
+      923,  923,  923,  923,  923,  923,  923,  926,  927,  923,
+      923,  923,  923,  923,  923,  924,  924,  924,  924,  924,
+      924,  924,  924,  924,  935,  936,  924,  924,  924,  924,
+      924,  924,  925,  925,  925,  925,  925,  925,  925,  925,
+      925,  925,  937,  925,  925,  925,  925,  925,  925,  928,
+      928,  928,  928,  928,  928,  928,  928,  928,  940,  941,
+      928,  928,  928,  928,  928,  928,  929,  929,  929,  929,
+      929,  929,  929,  929,  929,  942,  943,  929,  929,  929,
+
+      929,  929,  929,  930,  944,  930,  930,  930,  930,  930,
+      930,  930,  930,  930,  931,  931,  931,  931,  931,  931,
+      931,  931,  931,  946,  947,  931,  931,  931,  931,  931,
+      931,  932,  948,  932,  932,  932,  932,  932,  932,  932,
+      932,  932,  933,  933,  933,  933,  933,  933,  933,  933,
+      933,  933,  949,  933,  933,  933,  933,  933,  933,  934,
+      950,  934,  934,  934,  934,  934,  934,  934,  934,  934,
+      952,  953,  954,  955,  956,  957,  958,  959,  960,  961,
+      962,  963,  963,  963,  963,  963,  963,  963,  963,  963,
+      969,  970,  963,  963,  963,  963,  963,  963,  964,  964,
+
+      964,  964,  964,  964,  964,  964,  964,  964,  974,  964,
+      964,  964,  964,  964,  964,  965,  965,  965,  965,  965,
+      965,  965,  965,  965,  975,  977,  965,  965,  965,  965,
+      965,  965,  966,  978,  966,  966,  966,  966,  966,  966,
+      966,  966,  966,  967,  967,  967,  967,  967,  967,  967,
+      967,  967,  967,  980,  967,  967,  967,  967,  967,  967,
+      968,  982,  968,  968,  968,  968,  968,  968,  968,  968,
+      968,  971,  971,  971,  971,  971,  971,  971,  971,  971,
+      983,  979,  971,  971,  971,  971,  971,  971,  972,  972,
+      972,  972,  972,  972,  972,  972,  972,  979,  984,  972,
+
+      972,  972,  972,  972,  972,  973,  981,  973,  973,  973,
+      973,  973,  973,  973,  973,  973,  985,  986,  987,  988,
+      989,  990,  981,  991,  993,  996,  996,  996,  996,  996,
+      996,  996,  996,  996, 1000, 1001,  996,  996,  996,  996,
+      996,  996,  997,  997,  997,  997,  997,  997,  997,  997,
+      997, 1009, 1010,  997,  997,  997,  997,  997,  997,  998,
+      998,  998,  998,  998,  998,  998,  998,  998,  998, 1011,
+      998,  998,  998,  998,  998,  998,  999,  999,  999,  999,
+      999,  999,  999,  999,  999, 1013, 1014,  999,  999,  999,
+      999,  999,  999, 1002, 1002, 1002, 1002, 1002, 1002, 1002,
+
+     1002, 1002, 1015, 1016, 1002, 1002, 1002, 1002, 1002, 1002,
+     1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1017,
+     1018, 1003, 1003, 1003, 1003, 1003, 1003, 1004, 1021, 1004,
+     1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1005, 1005,
+     1005, 1005, 1005, 1005, 1005, 1005, 1005, 1023, 1024, 1005,
+     1005, 1005, 1005, 1005, 1005, 1006, 1025, 1006, 1006, 1006,
+     1006, 1006, 1006, 1006, 1006, 1006, 1007, 1007, 1007, 1007,
+     1007, 1007, 1007, 1007, 1007, 1007, 1026, 1007, 1007, 1007,
+     1007, 1007, 1007, 1008, 1027, 1008, 1008, 1008, 1008, 1008,
+     1008, 1008, 1008, 1008, 1020, 1020, 1020, 1030, 1020, 1029,
+
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1032, 1038,
+     1029, 1029, 1029, 1029, 1029, 1029, 1031, 1031, 1031, 1031,
+     1031, 1031, 1031, 1031, 1031, 1039, 1043, 1031, 1031, 1031,
+     1031, 1031, 1031, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+     1033, 1033, 1033, 1044, 1033, 1033, 1033, 1033, 1033, 1033,
+     1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1034, 1046,
+     1047, 1034, 1034, 1034, 1034, 1034, 1034, 1035, 1049, 1035,
+     1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1036, 1036,
+     1036, 1036, 1036, 1036, 1036, 1036, 1036, 1050, 1051, 1036,
+     1036, 1036, 1036, 1036, 1036, 1037, 1054, 1037, 1037, 1037,
+
+     1037, 1037, 1037, 1037, 1037, 1037, 1040, 1040, 1040, 1040,
+     1040, 1040, 1040, 1040, 1040, 1055, 1056, 1040, 1040, 1040,
+     1040, 1040, 1040, 1041, 1041, 1041, 1041, 1041, 1041, 1041,
+     1041, 1041, 1057, 1059, 1041, 1041, 1041, 1041, 1041, 1041,
+     1042, 1045, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042,
+     1042, 1053, 1060, 1045, 1053, 1061, 1062, 1067, 1068, 1075,
+     1045, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063,
+     1076, 1077, 1063, 1063, 1063, 1063, 1063, 1063, 1065, 1065,
+     1065, 1065, 1065, 1065, 1065, 1065, 1065, 1079, 1080, 1065,
+     1065, 1065, 1065, 1065, 1065, 1066, 1066, 1066, 1066, 1066,
+
+     1066, 1066, 1066, 1066, 1081, 1082, 1066, 1066, 1066, 1066,
+     1066, 1066, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069,
+     1069, 1083, 1084, 1069, 1069, 1069, 1069, 1069, 1069, 1070,
+     1085, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070,
+     1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1071, 1086,
+     1087, 1071, 1071, 1071, 1071, 1071, 1071, 1072, 1089, 1072,
+     1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073,
+     1073, 1073, 1073, 1073, 1073, 1073, 1073, 1091, 1092, 1073,
+     1073, 1073, 1073, 1073, 1073, 1078, 1094, 1099, 1100, 1102,
+     1103, 1078, 1093, 1093, 1093, 1093, 1093, 1093, 1093, 1093,
+
+     1093, 1104, 1105, 1093, 1093, 1093, 1093, 1093, 1093, 1095,
+     1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1106, 1107,
+     1095, 1095, 1095, 1095, 1095, 1095, 1096, 1096, 1096, 1096,
+     1096, 1096, 1096, 1096, 1096, 1096, 1109, 1096, 1096, 1096,
+     1096, 1096, 1096, 1097, 1097, 1097, 1097, 1097, 1097, 1097,
+     1097, 1097, 1118, 1120, 1097, 1097, 1097, 1097, 1097, 1097,
+     1098, 1127, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+     1098, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101,
+     1128, 1129, 1101, 1101, 1101, 1101, 1101, 1101, 1108, 1108,
+     1130, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+
+     1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+     1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+     1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+     1108, 1108, 1108, 1108, 1108, 1108, 1108, 1110, 1110, 1136,
+     1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1132,
+     1132, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+     1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+     1110, 1110, 1110, 1110, 1110, 1110, 1110, 1119, 1119, 1119,
+     1119, 1119, 1119, 1119, 1119, 1119, 1134, 1134, 1119, 1119,
+     1119, 1119, 1119, 1119, 1121, 1121, 1121, 1121, 1121, 1121,
+
+     1121, 1121, 1121, 1140, 1141, 1121, 1121, 1121, 1121, 1121,
+     1121, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+     1142, 1143, 1122, 1122, 1122, 1122, 1122, 1122, 1125, 1125,
+     1125, 1125, 1125, 1125, 1125, 1125, 1125, 1144, 1144, 1125,
+     1125, 1125, 1125, 1125, 1125, 1131, 1131, 1145, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1133, 1133, 1146, 1133, 1133, 1133,
+
+     1133, 1133, 1133, 1133, 1133, 1133, 1147, 1147, 1133, 1133,
+     1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133,
+     1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133, 1133,
+     1133, 1133, 1133, 1133, 1137, 1137, 1137, 1137, 1137, 1137,
+     1137, 1137, 1137, 1148, 1149, 1137, 1137, 1137, 1137, 1137,
+     1137, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138, 1138,
+     1138, 1151, 1138, 1138, 1138, 1138, 1138, 1138, 1150, 1150,
+     1150, 1150, 1150, 1150, 1150, 1150, 1150, 1154, 1155, 1150,
+     1150, 1150, 1150, 1150, 1150, 1152, 1152, 1152, 1152, 1152,
+     1152, 1152, 1152, 1152, 1156, 1157, 1152, 1152, 1152, 1152,
+
+     1152, 1152, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153,
+     1153, 1158, 1159, 1153, 1153, 1153, 1153, 1153, 1153, 1160,
+     1162, 1163, 1164, 1166, 1166, 1166, 1166, 1166, 1166, 1166,
+     1166, 1166, 1170, 1171, 1166, 1166, 1166, 1166, 1166, 1166,
+     1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1172,
+     1173, 1167, 1167, 1167, 1167, 1167, 1167, 1168, 1168, 1168,
+     1168, 1168, 1168, 1168, 1168, 1168, 1168, 1175, 1168, 1168,
+     1168, 1168, 1168, 1168, 1176, 1178, 1179, 1180, 1181, 1181,
+     1181, 1181, 1181, 1181, 1181, 1181, 1181, 1183, 1184, 1181,
+     1181, 1181, 1181, 1181, 1181, 1182, 1182, 1182, 1182, 1182,
+
+     1182, 1182, 1182, 1182, 1186, 1188, 1182, 1182, 1182, 1182,
+     1182, 1182, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190,
+     1190, 1193, 1198, 1190, 1190, 1190, 1190, 1190, 1190, 1191,
+     1191, 1191, 1191, 1191, 1191, 1191, 1191, 1191, 1202, 1205,
+     1191, 1191, 1191, 1191, 1191, 1191, 1192, 1192, 1192, 1192,
+     1192, 1192, 1192, 1192, 1192, 1192, 1206, 1192, 1192, 1192,
+     1192, 1192, 1192, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+     1197, 1197, 1210,    0, 1197, 1197, 1197, 1197, 1197, 1197,
+     1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199, 1199,    0,
+        0, 1199, 1199, 1199, 1199, 1199, 1199, 1200, 1200, 1200,
+
+     1200, 1200, 1200, 1200, 1200, 1200,    0,    0, 1200, 1200,
+     1200, 1200, 1200, 1200, 1203, 1203, 1203, 1203, 1203, 1203,
+     1203, 1203, 1203,    0,    0, 1203, 1203, 1203, 1203, 1203,
+     1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+     1204,    0, 1204, 1204, 1204, 1204, 1204, 1204, 1207, 1207,
+     1207, 1207, 1207, 1207, 1207, 1207, 1207,    0,    0, 1207,
+     1207, 1207, 1207, 1207, 1207, 1208, 1208, 1208, 1208, 1208,
+     1208, 1208, 1208, 1208, 1209, 1209, 1209, 1209, 1209, 1209,
+     1209, 1209, 1209,    0,    0, 1209, 1209, 1209, 1209, 1209,
+     1209, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+     1211
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[140] =
+static yyconst flex_int32_t yy_rule_can_match_eol[149] =
     {   0,
 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
@@ -2219,8 +1791,8 @@ static yyconst flex_int32_t yy_rule_can_match_eol[140] =
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
-        };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0,     };
 
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
@@ -2259,7 +1831,7 @@ using namespace std;
 namespace std{
   yy_SrvParser_stype yylval;
 }
-#line 2263 "SrvLexer.cpp"
+#line 1835 "SrvLexer.cpp"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2396,7 +1968,7 @@ YY_DECL
 #line 50 "SrvLexer.l"
 
 
-#line 2400 "SrvLexer.cpp"
+#line 1972 "SrvLexer.cpp"
 
 	while ( 1 )		/* loops until end-of-file is reached */
 		{
@@ -2423,13 +1995,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1118 )
+				if ( yy_current_state >= 1212 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 6257 );
+		while ( yy_base[yy_current_state] != 4292 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -3041,55 +2613,100 @@ YY_RULE_SETUP
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
-#line 177 "SrvLexer.l"
-{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+#line 176 "SrvLexer.l"
+{ return SrvParser::SOL_MAX_RT_; }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
-#line 178 "SrvLexer.l"
-{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+#line 177 "SrvLexer.l"
+{ return SrvParser::INF_MAX_RT_; }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
-#line 179 "SrvLexer.l"
-{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+#line 178 "SrvLexer.l"
+{ return SrvParser::REJECT_CACHE_; }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
-#line 180 "SrvLexer.l"
-{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+#line 179 "SrvLexer.l"
+{ return SrvParser::LEASE_REUSE_; }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
-#line 182 "SrvLexer.l"
-;
+#line 180 "SrvLexer.l"
+{ return SrvParser::REPLY_CACHE_; }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
-#line 184 "SrvLexer.l"
-;
+#line 181 "SrvLexer.l"
+{ return SrvParser::RENEW_TEMPLATES_; }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
+#line 182 "SrvLexer.l"
+{ return SrvParser::LEASE_SYNC_; }
+	YY_BREAK
+case 123:
+YY_RULE_SETUP
+#line 183 "SrvLexer.l"
+{ return SrvParser::DECLINE_QUARANTINE_; }
+	YY_BREAK
+case 124:
+YY_RULE_SETUP
+#line 184 "SrvLexer.l"
+{ return SrvParser::TA_MEMORY_ONLY_; }
+	YY_BREAK
+case 125:
+YY_RULE_SETUP
 #line 186 "SrvLexer.l"
+{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 126:
+YY_RULE_SETUP
+#line 187 "SrvLexer.l"
+{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 127:
+YY_RULE_SETUP
+#line 188 "SrvLexer.l"
+{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 128:
+YY_RULE_SETUP
+#line 189 "SrvLexer.l"
+{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 129:
+YY_RULE_SETUP
+#line 191 "SrvLexer.l"
+;
+	YY_BREAK
+case 130:
+YY_RULE_SETUP
+#line 193 "SrvLexer.l"
+;
+	YY_BREAK
+case 131:
+YY_RULE_SETUP
+#line 195 "SrvLexer.l"
 {
   BEGIN(COMMENT);
   ComBeg=yylineno;
 }
 	YY_BREAK
-case 123:
+case 132:
 YY_RULE_SETUP
-#line 191 "SrvLexer.l"
+#line 200 "SrvLexer.l"
 BEGIN(INITIAL);
 	YY_BREAK
-case 124:
-/* rule 124 can match eol */
+case 133:
+/* rule 133 can match eol */
 YY_RULE_SETUP
-#line 192 "SrvLexer.l"
+#line 201 "SrvLexer.l"
 ;
 	YY_BREAK
 case YY_STATE_EOF(COMMENT):
-#line 193 "SrvLexer.l"
+#line 202 "SrvLexer.l"
 {
     Log(Crit) << "Comment not closed. (/* in line " << ComBeg << LogEnd;
   { YYABORT; }
@@ -3097,9 +2714,9 @@ case YY_STATE_EOF(COMMENT):
 	YY_BREAK
  //IPv6 address - various forms
 
-case 125:
+case 134:
 YY_RULE_SETUP
-#line 200 "SrvLexer.l"
+#line 209 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -3109,9 +2726,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 135:
 YY_RULE_SETUP
-#line 209 "SrvLexer.l"
+#line 218 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -3121,9 +2738,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 136:
 YY_RULE_SETUP
-#line 218 "SrvLexer.l"
+#line 227 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -3133,9 +2750,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 137:
 YY_RULE_SETUP
-#line 227 "SrvLexer.l"
+#line 236 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -3145,9 +2762,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 138:
 YY_RULE_SETUP
-#line 236 "SrvLexer.l"
+#line 245 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -3157,9 +2774,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 139:
 YY_RULE_SETUP
-#line 245 "SrvLexer.l"
+#line 254 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -3169,9 +2786,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 140:
 YY_RULE_SETUP
-#line 254 "SrvLexer.l"
+#line 263 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -3183,10 +2800,10 @@ YY_RULE_SETUP
 	YY_BREAK
  //STRING (interface identifier,dns server etc.)
 
-case 132:
-/* rule 132 can match eol */
+case 141:
+/* rule 141 can match eol */
 YY_RULE_SETUP
-#line 266 "SrvLexer.l"
+#line 275 "SrvLexer.l"
 {
     yylval.strval=new char[strlen(yytext)-1];
     strncpy(yylval.strval, yytext+1, strlen(yytext)-2);
@@ -3194,9 +2811,9 @@ YY_RULE_SETUP
     return SrvParser::STRING_;
 }
 	YY_BREAK
-case 133:
+case 142:
 YY_RULE_SETUP
-#line 273 "SrvLexer.l"
+#line 282 "SrvLexer.l"
 {
     int len = strlen(yytext);
     if ( ( (len>2) && !strncasecmp("yes",yytext,3) ) ||
@@ -3218,9 +2835,9 @@ YY_RULE_SETUP
     return SrvParser::STRING_;
 }
 	YY_BREAK
-case 134:
+case 143:
 YY_RULE_SETUP
-#line 294 "SrvLexer.l"
+#line 303 "SrvLexer.l"
 {
     // DUID
     int len;
@@ -3253,9 +2870,9 @@ YY_RULE_SETUP
    return SrvParser::DUID_;
 }
 	YY_BREAK
-case 135:
+case 144:
 YY_RULE_SETUP
-#line 326 "SrvLexer.l"
+#line 335 "SrvLexer.l"
 {
    int len = (strlen(yytext)+1)/3;
    char * pos = 0;
@@ -3283,9 +2900,9 @@ YY_RULE_SETUP
    return SrvParser::DUID_;
 }
 	YY_BREAK
-case 136:
+case 145:
 YY_RULE_SETUP
-#line 353 "SrvLexer.l"
+#line 362 "SrvLexer.l"
 {
     // HEX NUMBER
     yytext[strlen(yytext)-1]='\n';
@@ -3296,9 +2913,9 @@ YY_RULE_SETUP
     return SrvParser::HEXNUMBER_;
 }
 	YY_BREAK
-case 137:
+case 146:
 YY_RULE_SETUP
-#line 363 "SrvLexer.l"
+#line 372 "SrvLexer.l"
 {
     // DECIMAL NUMBER
     if(!sscanf(yytext,"%20u",&(yylval.ival))) {
@@ -3308,17 +2925,17 @@ YY_RULE_SETUP
     return SrvParser::INTNUMBER_;
 }
 	YY_BREAK
-case 138:
+case 147:
 YY_RULE_SETUP
-#line 372 "SrvLexer.l"
+#line 381 "SrvLexer.l"
 { return yytext[0]; }
 	YY_BREAK
-case 139:
+case 148:
 YY_RULE_SETUP
-#line 375 "SrvLexer.l"
+#line 384 "SrvLexer.l"
 ECHO;
 	YY_BREAK
-#line 3322 "SrvLexer.cpp"
+#line 2939 "SrvLexer.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(ADDR):
 	yyterminate();
@@ -3701,7 +3318,7 @@ int yyFlexLexer::yy_get_next_buffer()
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1118 )
+			if ( yy_current_state >= 1212 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -3729,11 +3346,11 @@ int yyFlexLexer::yy_get_next_buffer()
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1118 )
+		if ( yy_current_state >= 1212 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1117);
+	yy_is_jam = (yy_current_state == 1211);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4227,7 +3844,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 374 "SrvLexer.l"
+#line 383 "SrvLexer.l"
 
 
 
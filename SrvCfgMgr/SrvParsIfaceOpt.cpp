@@ -21,7 +21,8 @@ using namespace std;
 TSrvParsIfaceOpt::TSrvParsIfaceOpt(void)
     :Preference_(SERVER_DEFAULT_PREFERENCE), RapidCommit_(SERVER_DEFAULT_RAPIDCOMMIT),
      IfaceMaxLease_(SERVER_DEFAULT_IFACEMAXLEASE), ClntMaxLease_(SERVER_DEFAULT_CLNTMAXLEASE),
-     Unicast_(), LeaseQuery_(SERVER_DEFAULT_LEASEQUERY), Relay_(false),
+     Unicast_(), LeaseQuery_(SERVER_DEFAULT_LEASEQUERY), SolMaxRT_(0), InfMaxRT_(0),
+     Relay_(false),
      RelayName_("[unknown]"), RelayID_(-1), RelayInterfaceID_(),
      FQDNSupport_(false), FQDNMode_(0/*DNS_UPDATE_MODE_NONE*/),
      UnknownFQDN_(SERVER_DEFAULT_UNKNOWN_FQDN), FQDNDomain_("")
@@ -61,6 +62,22 @@ bool TSrvParsIfaceOpt::getLeaseQuerySupport() {
     return LeaseQuery_;
 }
 
+void TSrvParsIfaceOpt::setSolMaxRT(uint32_t maxRT) {
+    SolMaxRT_ = maxRT;
+}
+
+uint32_t TSrvParsIfaceOpt::getSolMaxRT() {
+    return SolMaxRT_;
+}
+
+void TSrvParsIfaceOpt::setInfMaxRT(uint32_t maxRT) {
+    InfMaxRT_ = maxRT;
+}
+
+uint32_t TSrvParsIfaceOpt::getInfMaxRT() {
+    return InfMaxRT_;
+}
+
 // --- unicast ---
 void TSrvParsIfaceOpt::setUnicast(SPtr<TIPv6Addr> addr) {
     Unicast_ = addr;
@@ -48,6 +48,12 @@ public:
     void setLeaseQuerySupport(bool support);
     bool getLeaseQuerySupport();
 
+    // SOL_MAX_RT, INF_MAX_RT (0 if not configured)
+    void setSolMaxRT(uint32_t maxRT);
+    uint32_t getSolMaxRT();
+    void setInfMaxRT(uint32_t maxRT);
+    uint32_t getInfMaxRT();
+
     //-- options related methods --
     // option: DNS Servers servers is now handled with extra options mechanism
     // option: Domain servers is now handled with extra options mechanism
@@ -99,6 +105,8 @@ private:
     long ClntMaxLease_;
     SPtr<TIPv6Addr> Unicast_;
     bool LeaseQuery_; // support for leasequery
+    uint32_t SolMaxRT_;
+    uint32_t InfMaxRT_;
 
     // relay
     bool Relay_;
@@ -501,11 +501,20 @@ typedef
 #define	ROUTE_	361
 #define	INFINITE_	362
 #define	SUBNET_	363
-#define	STRING_	364
-#define	HEXNUMBER_	365
-#define	INTNUMBER_	366
-#define	IPV6ADDR_	367
-#define	DUID_	368
+#define	SOL_MAX_RT_	364
+#define	INF_MAX_RT_	365
+#define	REJECT_CACHE_	366
+#define	LEASE_REUSE_	367
+#define	REPLY_CACHE_	368
+#define	LEASE_SYNC_	369
+#define	DECLINE_QUARANTINE_	370
+#define	TA_MEMORY_ONLY_	371
+#define	RENEW_TEMPLATES_	372
+#define	STRING_	373
+#define	HEXNUMBER_	374
+#define	INTNUMBER_	375
+#define	IPV6ADDR_	376
+#define	DUID_	377
 
 
 #line 263 "../bison++/bison.cc"
@@ -661,6 +670,15 @@ static const int NEXT_HOP_;
 static const int ROUTE_;
 static const int INFINITE_;
 static const int SUBNET_;
+static const int SOL_MAX_RT_;
+static const int INF_MAX_RT_;
+static const int REJECT_CACHE_;
+static const int LEASE_REUSE_;
+static const int REPLY_CACHE_;
+static const int LEASE_SYNC_;
+static const int DECLINE_QUARANTINE_;
+static const int TA_MEMORY_ONLY_;
+static const int RENEW_TEMPLATES_;
 static const int STRING_;
 static const int HEXNUMBER_;
 static const int INTNUMBER_;
@@ -780,11 +798,20 @@ enum YY_SrvParser_ENUM_TOKEN { YY_SrvParser_NULL_TOKEN=0
 	,ROUTE_=361
 	,INFINITE_=362
 	,SUBNET_=363
-	,STRING_=364
-	,HEXNUMBER_=365
-	,INTNUMBER_=366
-	,IPV6ADDR_=367
-	,DUID_=368
+	,SOL_MAX_RT_=364
+	,INF_MAX_RT_=365
+	,REJECT_CACHE_=366
+	,LEASE_REUSE_=367
+	,REPLY_CACHE_=368
+	,LEASE_SYNC_=369
+	,DECLINE_QUARANTINE_=370
+	,TA_MEMORY_ONLY_=371
+	,RENEW_TEMPLATES_=372
+	,STRING_=373
+	,HEXNUMBER_=374
+	,INTNUMBER_=375
+	,IPV6ADDR_=376
+	,DUID_=377
 
 
 #line 310 "../bison++/bison.cc"
@@ -927,11 +954,20 @@ const int YY_SrvParser_CLASS::NEXT_HOP_=360;
 const int YY_SrvParser_CLASS::ROUTE_=361;
 const int YY_SrvParser_CLASS::INFINITE_=362;
 const int YY_SrvParser_CLASS::SUBNET_=363;
-const int YY_SrvParser_CLASS::STRING_=364;
-const int YY_SrvParser_CLASS::HEXNUMBER_=365;
-const int YY_SrvParser_CLASS::INTNUMBER_=366;
-const int YY_SrvParser_CLASS::IPV6ADDR_=367;
-const int YY_SrvParser_CLASS::DUID_=368;
+const int YY_SrvParser_CLASS::SOL_MAX_RT_=364;
+const int YY_SrvParser_CLASS::INF_MAX_RT_=365;
+const int YY_SrvParser_CLASS::REJECT_CACHE_=366;
+const int YY_SrvParser_CLASS::LEASE_REUSE_=367;
+const int YY_SrvParser_CLASS::REPLY_CACHE_=368;
+const int YY_SrvParser_CLASS::LEASE_SYNC_=369;
+const int YY_SrvParser_CLASS::DECLINE_QUARANTINE_=370;
+const int YY_SrvParser_CLASS::TA_MEMORY_ONLY_=371;
+const int YY_SrvParser_CLASS::RENEW_TEMPLATES_=372;
+const int YY_SrvParser_CLASS::STRING_=373;
+const int YY_SrvParser_CLASS::HEXNUMBER_=374;
+const int YY_SrvParser_CLASS::INTNUMBER_=375;
+const int YY_SrvParser_CLASS::IPV6ADDR_=376;
+const int YY_SrvParser_CLASS::DUID_=377;
 
 
 #line 341 "../bison++/bison.cc"
@@ -950,26 +986,26 @@ YY_SrvParser_CONSTRUCTOR_CODE;
  #line 352 "../bison++/bison.cc"
 
 
-#define	YYFINAL		507
+#define	YYFINAL		543
 #define	YYFLAG		-32768
-#define	YYNTBASE	122
+#define	YYNTBASE	131
 
-#define YYTRANSLATE(x) ((unsigned)(x) <= 368 ? yytranslate[x] : 263)
+#define YYTRANSLATE(x) ((unsigned)(x) <= 377 ? yytranslate[x] : 283)
 
-static const char yytranslate[] = {     0,
+static const short yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,   120,
-   121,     2,     2,   119,   117,     2,   118,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,   116,     2,
+     2,     2,     2,     2,     2,     2,     2,     2,     2,   129,
+   130,     2,     2,   128,   126,     2,   127,     2,     2,     2,
+     2,     2,     2,     2,     2,     2,     2,     2,   125,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,   114,     2,   115,     2,     2,     2,     2,     2,
+     2,     2,   123,     2,   124,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -993,7 +1029,8 @@ static const char yytranslate[] = {     0,
     76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
     86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
     96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
-   106,   107,   108,   109,   110,   111,   112,   113
+   106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+   116,   117,   118,   119,   120,   121,   122
 };
 
 #if YY_SrvParser_DEBUG != 0
@@ -1004,171 +1041,182 @@ static const short yyprhs[] = {     0,
     61,    63,    65,    67,    69,    71,    73,    75,    77,    79,
     81,    83,    85,    87,    89,    91,    93,    95,    97,    99,
    101,   103,   105,   107,   109,   111,   113,   115,   117,   119,
-   121,   123,   125,   127,   129,   131,   133,   134,   141,   142,
-   149,   151,   154,   156,   158,   160,   162,   165,   168,   171,
-   174,   175,   176,   185,   187,   190,   192,   194,   196,   200,
-   204,   208,   212,   216,   217,   225,   226,   236,   237,   245,
-   247,   250,   252,   254,   256,   258,   260,   262,   264,   266,
-   268,   270,   272,   274,   276,   278,   280,   282,   285,   290,
-   291,   297,   299,   302,   303,   309,   311,   314,   316,   318,
-   320,   322,   324,   326,   328,   330,   331,   337,   339,   342,
-   344,   346,   348,   350,   352,   354,   356,   358,   359,   366,
-   369,   371,   374,   381,   386,   393,   396,   399,   402,   405,
-   406,   410,   412,   416,   418,   420,   422,   424,   426,   428,
-   430,   432,   435,   437,   441,   445,   449,   455,   461,   463,
-   465,   467,   471,   477,   483,   489,   497,   505,   513,   515,
-   519,   521,   525,   529,   533,   539,   543,   545,   549,   553,
-   559,   561,   565,   569,   575,   576,   580,   581,   585,   586,
-   590,   591,   595,   598,   601,   606,   609,   614,   617,   620,
-   625,   628,   633,   636,   639,   642,   646,   651,   656,   657,
-   663,   668,   669,   674,   677,   680,   682,   685,   688,   691,
-   694,   697,   700,   703,   705,   707,   710,   713,   716,   718,
-   720,   723,   726,   728,   731,   734,   737,   740,   743,   746,
-   749,   752,   755,   758,   763,   768,   770,   772,   774,   776,
-   778,   780,   782,   784,   786,   788,   790,   792,   795,   798,
-   799,   804,   805,   810,   811,   816,   820,   821,   826,   827,
-   832,   833,   838,   839,   845,   846,   853,   857,   860,   863,
-   866,   869,   870,   875,   876,   881,   885,   889,   893,   894,
-   899,   900,   907,   910,   911,   917,   923,   929,   935,   937,
-   939,   941,   943,   945,   947
+   121,   123,   125,   127,   129,   131,   133,   135,   137,   139,
+   141,   143,   145,   147,   149,   151,   152,   159,   160,   167,
+   169,   172,   174,   176,   178,   180,   183,   186,   189,   192,
+   193,   194,   203,   205,   208,   210,   212,   214,   218,   222,
+   226,   230,   234,   235,   243,   244,   254,   255,   263,   265,
+   268,   270,   272,   274,   276,   278,   280,   282,   284,   286,
+   288,   290,   292,   294,   296,   298,   300,   303,   308,   309,
+   315,   317,   320,   321,   327,   329,   332,   334,   336,   338,
+   340,   342,   344,   346,   348,   349,   355,   357,   360,   362,
+   364,   366,   368,   370,   372,   374,   376,   377,   384,   387,
+   389,   392,   399,   404,   411,   414,   417,   420,   423,   424,
+   428,   430,   434,   436,   438,   440,   442,   444,   446,   448,
+   450,   453,   455,   459,   463,   467,   473,   479,   481,   483,
+   485,   489,   495,   501,   507,   515,   523,   531,   533,   537,
+   539,   543,   547,   551,   557,   561,   563,   567,   571,   577,
+   579,   583,   587,   593,   594,   598,   599,   603,   604,   608,
+   609,   613,   616,   619,   624,   627,   632,   635,   638,   643,
+   646,   651,   654,   657,   660,   664,   669,   674,   675,   681,
+   686,   687,   692,   695,   698,   700,   703,   706,   709,   712,
+   715,   718,   721,   724,   727,   729,   731,   734,   737,   741,
+   744,   748,   751,   753,   756,   760,   765,   771,   772,   775,
+   777,   780,   783,   786,   788,   790,   793,   796,   798,   801,
+   804,   807,   810,   813,   816,   819,   822,   825,   828,   833,
+   838,   840,   842,   844,   846,   848,   850,   852,   854,   856,
+   858,   860,   862,   865,   868,   869,   874,   875,   880,   881,
+   886,   890,   891,   896,   897,   902,   903,   908,   909,   915,
+   916,   923,   927,   930,   933,   936,   939,   940,   945,   946,
+   951,   955,   959,   963,   964,   969,   970,   977,   980,   981,
+   987,   993,   999,  1005,  1007,  1009,  1011,  1013,  1015,  1017
 };
 
-static const short yyrhs[] = {   123,
-     0,     0,   124,     0,   126,     0,   123,   124,     0,   123,
-   126,     0,   125,     0,   206,     0,   205,     0,   207,     0,
-   208,     0,   209,     0,   210,     0,   218,     0,   161,     0,
-   162,     0,   163,     0,   164,     0,   165,     0,   169,     0,
-   216,     0,   217,     0,   246,     0,   247,     0,   248,     0,
-   211,     0,   258,     0,   130,     0,   212,     0,   213,     0,
-   214,     0,   202,     0,   227,     0,   224,     0,   225,     0,
-   219,     0,   220,     0,   221,     0,   222,     0,   223,     0,
-   201,     0,   204,     0,   203,     0,   200,     0,   192,     0,
-   230,     0,   232,     0,   234,     0,   236,     0,   237,     0,
-   239,     0,   241,     0,   245,     0,   249,     0,   253,     0,
-   251,     0,   254,     0,   195,     0,   255,     0,   196,     0,
-   198,     0,   153,     0,   256,     0,   138,     0,   215,     0,
-   226,     0,     0,     3,   109,   114,   127,   129,   115,     0,
-     0,     3,   171,   114,   128,   129,   115,     0,   125,     0,
-   129,   125,     0,   146,     0,   149,     0,   157,     0,   160,
-     0,   129,   149,     0,   129,   146,     0,   129,   157,     0,
-   129,   160,     0,     0,     0,    72,   109,   114,   131,   133,
-   115,   132,   116,     0,   134,     0,   133,   134,     0,   137,
-     0,   135,     0,   136,     0,    73,   109,   116,     0,    75,
-   171,   116,     0,    74,    81,   116,     0,    74,    79,   116,
-     0,    74,    78,   116,     0,     0,    53,    54,   113,   114,
-   139,   142,   115,     0,     0,    53,    55,   171,   117,   113,
-   114,   140,   142,   115,     0,     0,    53,    56,   112,   114,
-   141,   142,   115,     0,   143,     0,   142,   143,     0,   230,
-     0,   232,     0,   234,     0,   236,     0,   237,     0,   239,
-     0,   249,     0,   253,     0,   251,     0,   254,     0,   255,
-     0,   256,     0,   196,     0,   195,     0,   144,     0,   145,
-     0,    57,   112,     0,    58,   112,   118,   171,     0,     0,
-     7,   114,   147,   148,   115,     0,   227,     0,   148,   227,
-     0,     0,     8,   114,   150,   151,   115,     0,   152,     0,
-   151,   152,     0,   187,     0,   188,     0,   182,     0,   193,
-     0,   178,     0,   180,     0,   228,     0,   229,     0,     0,
-    48,   114,   154,   155,   115,     0,   156,     0,   156,   155,
-     0,   186,     0,   184,     0,   188,     0,   187,     0,   190,
-     0,   191,     0,   228,     0,   229,     0,     0,   105,   112,
-   114,   158,   159,   115,     0,   105,   112,     0,   160,     0,
-   159,   160,     0,   106,   112,   118,   111,    25,   111,     0,
-   106,   112,   118,   111,     0,   106,   112,   118,   111,    25,
-   107,     0,    66,   109,     0,    67,   109,     0,    68,   109,
-     0,    71,   109,     0,     0,    69,   166,   167,     0,   168,
-     0,   167,   119,   168,     0,    76,     0,    77,     0,    78,
-     0,    79,     0,    80,     0,    81,     0,    82,     0,    83,
-     0,    70,   171,     0,   109,     0,   109,   117,   113,     0,
-   109,   117,   112,     0,   170,   119,   109,     0,   170,   119,
-   109,   117,   113,     0,   170,   119,   109,   117,   112,     0,
-   110,     0,   111,     0,   112,     0,   172,   119,   112,     0,
-   171,   117,   171,   117,   113,     0,   171,   117,   171,   117,
-   112,     0,   171,   117,   171,   117,   109,     0,   173,   119,
-   171,   117,   171,   117,   113,     0,   173,   119,   171,   117,
-   171,   117,   112,     0,   173,   119,   171,   117,   171,   117,
-   109,     0,   109,     0,   174,   119,   109,     0,   112,     0,
-   112,   117,   112,     0,   112,   118,   111,     0,   175,   119,
-   112,     0,   175,   119,   112,   117,   112,     0,   112,   118,
-   111,     0,   112,     0,   112,   117,   112,     0,   177,   119,
-   112,     0,   177,   119,   112,   117,   112,     0,   113,     0,
-   113,   117,   113,     0,   177,   119,   113,     0,   177,   119,
-   113,   117,   113,     0,     0,    32,   179,   177,     0,     0,
-    31,   181,   177,     0,     0,    33,   183,   175,     0,     0,
-    50,   185,   176,     0,    49,   171,     0,    37,   171,     0,
-    37,   171,   117,   171,     0,    38,   171,     0,    38,   171,
-   117,   171,     0,    34,   171,     0,    35,   171,     0,    35,
-   171,   117,   171,     0,    36,   171,     0,    36,   171,   117,
-   171,     0,    45,   171,     0,    44,   171,     0,    62,   171,
-     0,    14,    64,   109,     0,    14,   171,    54,   113,     0,
-    14,   171,    57,   112,     0,     0,    14,   171,   103,   197,
-   172,     0,    14,   171,   102,   109,     0,     0,    14,    63,
-   199,   172,     0,    43,   171,     0,    39,   112,     0,    40,
-     0,    42,   171,     0,    41,   171,     0,    10,   171,     0,
-    11,   109,     0,     9,   109,     0,    12,   171,     0,    13,
-   109,     0,    46,     0,    59,     0,    51,   109,     0,    65,
-   171,     0,    98,   171,     0,    60,     0,    61,     0,     6,
-   109,     0,    47,   171,     0,    84,     0,    84,   171,     0,
-    85,   171,     0,    86,   171,     0,    87,   171,     0,    88,
-   171,     0,     4,   109,     0,     4,   171,     0,     5,   171,
-     0,     5,   113,     0,     5,   109,     0,   108,   112,   118,
-   171,     0,   108,   112,   117,   112,     0,   187,     0,   188,
-     0,   182,     0,   189,     0,   190,     0,   191,     0,   178,
-     0,   180,     0,   193,     0,   194,     0,   228,     0,   229,
-     0,    99,   109,     0,   100,   109,     0,     0,    14,    15,
-   231,   172,     0,     0,    14,    16,   233,   174,     0,     0,
-    14,    17,   235,   172,     0,    14,    18,   109,     0,     0,
-    14,    19,   238,   172,     0,     0,    14,    20,   240,   174,
-     0,     0,    14,    26,   242,   170,     0,     0,    14,    26,
-   111,   243,   170,     0,     0,    14,    26,   111,   111,   244,
-   170,     0,    27,   171,   109,     0,    27,   171,     0,    28,
-   112,     0,    29,   109,     0,    30,   171,     0,     0,    14,
-    21,   250,   172,     0,     0,    14,    23,   252,   172,     0,
-    14,    22,   109,     0,    14,    24,   109,     0,    14,    25,
-   171,     0,     0,    14,    52,   257,   173,     0,     0,    89,
-   109,   114,   259,   260,   115,     0,    90,   261,     0,     0,
-   120,   262,   104,   262,   121,     0,   120,   262,    91,   262,
-   121,     0,   120,   261,    92,   261,   121,     0,   120,   261,
-    93,   261,   121,     0,    94,     0,    95,     0,    96,     0,
-    97,     0,   109,     0,   171,     0,   101,   120,   262,   119,
-   171,   119,   171,   121,     0
+static const short yyrhs[] = {   132,
+     0,     0,   133,     0,   135,     0,   132,   133,     0,   132,
+   135,     0,   134,     0,   217,     0,   216,     0,   218,     0,
+   219,     0,   220,     0,   221,     0,   238,     0,   170,     0,
+   171,     0,   172,     0,   173,     0,   174,     0,   178,     0,
+   236,     0,   237,     0,   266,     0,   267,     0,   268,     0,
+   222,     0,   278,     0,   139,     0,   223,     0,   233,     0,
+   234,     0,   211,     0,   224,     0,   232,     0,   225,     0,
+   226,     0,   229,     0,   228,     0,   227,     0,   247,     0,
+   244,     0,   245,     0,   239,     0,   240,     0,   241,     0,
+   242,     0,   243,     0,   210,     0,   213,     0,   214,     0,
+   215,     0,   212,     0,   209,     0,   201,     0,   250,     0,
+   252,     0,   254,     0,   256,     0,   257,     0,   259,     0,
+   261,     0,   265,     0,   269,     0,   273,     0,   271,     0,
+   274,     0,   204,     0,   275,     0,   205,     0,   207,     0,
+   162,     0,   276,     0,   147,     0,   235,     0,   246,     0,
+     0,     3,   118,   123,   136,   138,   124,     0,     0,     3,
+   180,   123,   137,   138,   124,     0,   134,     0,   138,   134,
+     0,   155,     0,   158,     0,   166,     0,   169,     0,   138,
+   158,     0,   138,   155,     0,   138,   166,     0,   138,   169,
+     0,     0,     0,    72,   118,   123,   140,   142,   124,   141,
+   125,     0,   143,     0,   142,   143,     0,   146,     0,   144,
+     0,   145,     0,    73,   118,   125,     0,    75,   180,   125,
+     0,    74,    81,   125,     0,    74,    79,   125,     0,    74,
+    78,   125,     0,     0,    53,    54,   122,   123,   148,   151,
+   124,     0,     0,    53,    55,   180,   126,   122,   123,   149,
+   151,   124,     0,     0,    53,    56,   121,   123,   150,   151,
+   124,     0,   152,     0,   151,   152,     0,   250,     0,   252,
+     0,   254,     0,   256,     0,   257,     0,   259,     0,   269,
+     0,   273,     0,   271,     0,   274,     0,   275,     0,   276,
+     0,   205,     0,   204,     0,   153,     0,   154,     0,    57,
+   121,     0,    58,   121,   127,   180,     0,     0,     7,   123,
+   156,   157,   124,     0,   247,     0,   157,   247,     0,     0,
+     8,   123,   159,   160,   124,     0,   161,     0,   160,   161,
+     0,   196,     0,   197,     0,   191,     0,   202,     0,   187,
+     0,   189,     0,   248,     0,   249,     0,     0,    48,   123,
+   163,   164,   124,     0,   165,     0,   165,   164,     0,   195,
+     0,   193,     0,   197,     0,   196,     0,   199,     0,   200,
+     0,   248,     0,   249,     0,     0,   105,   121,   123,   167,
+   168,   124,     0,   105,   121,     0,   169,     0,   168,   169,
+     0,   106,   121,   127,   120,    25,   120,     0,   106,   121,
+   127,   120,     0,   106,   121,   127,   120,    25,   107,     0,
+    66,   118,     0,    67,   118,     0,    68,   118,     0,    71,
+   118,     0,     0,    69,   175,   176,     0,   177,     0,   176,
+   128,   177,     0,    76,     0,    77,     0,    78,     0,    79,
+     0,    80,     0,    81,     0,    82,     0,    83,     0,    70,
+   180,     0,   118,     0,   118,   126,   122,     0,   118,   126,
+   121,     0,   179,   128,   118,     0,   179,   128,   118,   126,
+   122,     0,   179,   128,   118,   126,   121,     0,   119,     0,
+   120,     0,   121,     0,   181,   128,   121,     0,   180,   126,
+   180,   126,   122,     0,   180,   126,   180,   126,   121,     0,
+   180,   126,   180,   126,   118,     0,   182,   128,   180,   126,
+   180,   126,   122,     0,   182,   128,   180,   126,   180,   126,
+   121,     0,   182,   128,   180,   126,   180,   126,   118,     0,
+   118,     0,   183,   128,   118,     0,   121,     0,   121,   126,
+   121,     0,   121,   127,   120,     0,   184,   128,   121,     0,
+   184,   128,   121,   126,   121,     0,   121,   127,   120,     0,
+   121,     0,   121,   126,   121,     0,   186,   128,   121,     0,
+   186,   128,   121,   126,   121,     0,   122,     0,   122,   126,
+   122,     0,   186,   128,   122,     0,   186,   128,   122,   126,
+   122,     0,     0,    32,   188,   186,     0,     0,    31,   190,
+   186,     0,     0,    33,   192,   184,     0,     0,    50,   194,
+   185,     0,    49,   180,     0,    37,   180,     0,    37,   180,
+   126,   180,     0,    38,   180,     0,    38,   180,   126,   180,
+     0,    34,   180,     0,    35,   180,     0,    35,   180,   126,
+   180,     0,    36,   180,     0,    36,   180,   126,   180,     0,
+    45,   180,     0,    44,   180,     0,    62,   180,     0,    14,
+    64,   118,     0,    14,   180,    54,   122,     0,    14,   180,
+    57,   121,     0,     0,    14,   180,   103,   206,   181,     0,
+    14,   180,   102,   118,     0,     0,    14,    63,   208,   181,
+     0,    43,   180,     0,    39,   121,     0,    40,     0,    42,
+   180,     0,    41,   180,     0,   109,   180,     0,   110,   180,
+     0,    10,   180,     0,    11,   118,     0,     9,   118,     0,
+    12,   180,     0,    13,   118,     0,    46,     0,    59,     0,
+    51,   118,     0,   111,   180,     0,   111,   180,   180,     0,
+   113,   180,     0,   113,   180,   180,     0,   117,   180,     0,
+   116,     0,   115,   180,     0,   115,   180,   180,     0,   114,
+   231,   121,   230,     0,   114,   231,   121,   180,   230,     0,
+     0,    73,   118,     0,   118,     0,   112,   180,     0,    65,
+   180,     0,    98,   180,     0,    60,     0,    61,     0,     6,
+   118,     0,    47,   180,     0,    84,     0,    84,   180,     0,
+    85,   180,     0,    86,   180,     0,    87,   180,     0,    88,
+   180,     0,     4,   118,     0,     4,   180,     0,     5,   180,
+     0,     5,   122,     0,     5,   118,     0,   108,   121,   127,
+   180,     0,   108,   121,   126,   121,     0,   196,     0,   197,
+     0,   191,     0,   198,     0,   199,     0,   200,     0,   187,
+     0,   189,     0,   202,     0,   203,     0,   248,     0,   249,
+     0,    99,   118,     0,   100,   118,     0,     0,    14,    15,
+   251,   181,     0,     0,    14,    16,   253,   183,     0,     0,
+    14,    17,   255,   181,     0,    14,    18,   118,     0,     0,
+    14,    19,   258,   181,     0,     0,    14,    20,   260,   183,
+     0,     0,    14,    26,   262,   179,     0,     0,    14,    26,
+   120,   263,   179,     0,     0,    14,    26,   120,   120,   264,
+   179,     0,    27,   180,   118,     0,    27,   180,     0,    28,
+   121,     0,    29,   118,     0,    30,   180,     0,     0,    14,
+    21,   270,   181,     0,     0,    14,    23,   272,   181,     0,
+    14,    22,   118,     0,    14,    24,   118,     0,    14,    25,
+   180,     0,     0,    14,    52,   277,   182,     0,     0,    89,
+   118,   123,   279,   280,   124,     0,    90,   281,     0,     0,
+   129,   282,   104,   282,   130,     0,   129,   282,    91,   282,
+   130,     0,   129,   281,    92,   281,   130,     0,   129,   281,
+    93,   281,   130,     0,    94,     0,    95,     0,    96,     0,
+    97,     0,   118,     0,   180,     0,   101,   129,   282,   128,
+   180,   128,   180,   130,     0
 };
 
 #endif
 
 #if (YY_SrvParser_DEBUG != 0) || defined(YY_SrvParser_ERROR_VERBOSE) 
 static const short yyrline[] = { 0,
-   162,   163,   167,   168,   169,   170,   174,   175,   176,   177,
-   178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
-   188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
-   198,   199,   203,   204,   205,   206,   207,   208,   209,   210,
-   211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-   221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
-   231,   232,   233,   234,   235,   236,   241,   246,   254,   259,
-   265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-   278,   283,   308,   311,   312,   316,   317,   318,   322,   329,
-   335,   336,   337,   342,   348,   356,   362,   370,   376,   385,
-   386,   390,   391,   392,   393,   394,   395,   396,   397,   398,
-   399,   400,   401,   402,   403,   404,   405,   408,   416,   425,
-   430,   438,   439,   444,   447,   455,   456,   460,   461,   462,
-   463,   464,   465,   466,   467,   471,   474,   482,   483,   486,
-   487,   488,   489,   490,   491,   492,   493,   500,   507,   512,
-   521,   522,   525,   535,   544,   555,   578,   584,   602,   611,
-   614,   625,   626,   630,   631,   632,   633,   634,   635,   636,
-   637,   642,   659,   664,   671,   677,   682,   688,   697,   698,
-   702,   706,   713,   721,   729,   737,   744,   752,   762,   763,
-   767,   771,   780,   796,   800,   812,   835,   839,   848,   852,
-   861,   867,   879,   885,   899,   903,   909,   913,   919,   923,
-   929,   932,   937,   949,   954,   962,   967,   975,   987,   992,
-  1000,  1005,  1013,  1020,  1027,  1042,  1050,  1057,  1065,  1069,
-  1075,  1083,  1094,  1103,  1110,  1117,  1123,  1138,  1150,  1156,
-  1161,  1168,  1174,  1181,  1188,  1196,  1202,  1215,  1231,  1237,
-  1244,  1266,  1277,  1282,  1299,  1310,  1316,  1322,  1331,  1335,
-  1342,  1347,  1352,  1360,  1373,  1383,  1384,  1385,  1386,  1387,
-  1388,  1389,  1390,  1391,  1392,  1393,  1394,  1398,  1427,  1460,
-  1464,  1474,  1477,  1487,  1491,  1502,  1514,  1517,  1528,  1531,
-  1543,  1553,  1556,  1579,  1583,  1612,  1619,  1625,  1634,  1642,
-  1659,  1669,  1672,  1683,  1686,  1697,  1709,  1720,  1731,  1733,
-  1740,  1743,  1753,  1759,  1759,  1767,  1776,  1785,  1796,  1800,
-  1804,  1808,  1812,  1817,  1826
+   166,   167,   171,   172,   173,   174,   178,   179,   180,   181,
+   182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+   192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+   202,   203,   204,   205,   206,   207,   208,   209,   210,   214,
+   215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+   225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+   235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+   245,   246,   247,   248,   249,   254,   259,   267,   272,   278,
+   279,   280,   281,   282,   283,   284,   285,   286,   287,   291,
+   296,   321,   324,   325,   329,   330,   331,   335,   342,   348,
+   349,   350,   355,   361,   369,   375,   383,   389,   398,   399,
+   403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+   413,   414,   415,   416,   417,   418,   421,   429,   438,   443,
+   451,   452,   457,   460,   468,   469,   473,   474,   475,   476,
+   477,   478,   479,   480,   484,   487,   495,   496,   499,   500,
+   501,   502,   503,   504,   505,   506,   513,   520,   525,   534,
+   535,   538,   548,   557,   568,   591,   597,   615,   624,   627,
+   638,   639,   643,   644,   645,   646,   647,   648,   649,   650,
+   655,   672,   677,   684,   690,   695,   701,   710,   711,   715,
+   719,   726,   734,   742,   750,   757,   765,   775,   776,   780,
+   784,   793,   809,   813,   825,   848,   852,   861,   865,   874,
+   880,   892,   898,   912,   916,   922,   926,   932,   936,   942,
+   945,   950,   962,   967,   975,   980,   988,  1000,  1005,  1013,
+  1018,  1026,  1033,  1040,  1055,  1063,  1070,  1078,  1082,  1088,
+  1096,  1107,  1116,  1123,  1130,  1136,  1151,  1163,  1176,  1189,
+  1195,  1200,  1207,  1213,  1220,  1227,  1235,  1241,  1246,  1254,
+  1259,  1267,  1275,  1282,  1287,  1300,  1306,  1320,  1321,  1339,
+  1353,  1366,  1379,  1395,  1401,  1408,  1430,  1441,  1446,  1463,
+  1474,  1480,  1486,  1495,  1499,  1506,  1511,  1516,  1524,  1537,
+  1547,  1548,  1549,  1550,  1551,  1552,  1553,  1554,  1555,  1556,
+  1557,  1558,  1562,  1591,  1624,  1628,  1638,  1641,  1651,  1655,
+  1666,  1678,  1681,  1692,  1695,  1707,  1717,  1720,  1743,  1747,
+  1776,  1783,  1789,  1798,  1806,  1823,  1833,  1836,  1847,  1850,
+  1861,  1873,  1884,  1895,  1897,  1904,  1907,  1917,  1923,  1923,
+  1931,  1940,  1949,  1960,  1964,  1968,  1972,  1976,  1981,  1990
 };
 
 static const char * const yytname[] = {   "$","error","$illegal.","IFACE_","RELAY_",
@@ -1190,70 +1238,75 @@ static const char * const yytname[] = {   "$","error","$illegal.","IFACE_","RELA
 "EQ_","AND_","OR_","CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_","CLIENT_VENDOR_SPEC_DATA_",
 "CLIENT_VENDOR_CLASS_EN_","CLIENT_VENDOR_CLASS_DATA_","RECONFIGURE_ENABLED_",
 "ALLOW_","DENY_","SUBSTRING_","STRING_KEYWORD_","ADDRESS_LIST_","CONTAIN_","NEXT_HOP_",
-"ROUTE_","INFINITE_","SUBNET_","STRING_","HEXNUMBER_","INTNUMBER_","IPV6ADDR_",
-"DUID_","'{'","'}'","';'","'-'","'/'","','","'('","')'","Grammar","GlobalDeclarationList",
-"GlobalOption","InterfaceOptionDeclaration","InterfaceDeclaration","@1","@2",
-"InterfaceDeclarationsList","Key","@3","@4","KeyOptions","KeyOption","KeySecret",
-"KeyFudge","KeyAlgorithm","Client","@5","@6","@7","ClientOptions","ClientOption",
-"AddressReservation","PrefixReservation","ClassDeclaration","@8","ClassOptionDeclarationsList",
-"TAClassDeclaration","@9","TAClassOptionsList","TAClassOption","PDDeclaration",
-"@10","PDOptionsList","PDOptions","NextHopDeclaration","@11","RouteList","Route",
-"AuthProtocol","AuthAlgorithm","AuthReplay","AuthRealm","AuthMethods","@12",
-"DigestList","Digest","AuthDropUnauthenticated","FQDNList","Number","ADDRESSList",
-"VendorSpecList","StringList","ADDRESSRangeList","PDRangeList","ADDRESSDUIDRangeList",
-"RejectClientsOption","@13","AcceptOnlyOption","@14","PoolOption","@15","PDPoolOption",
-"@16","PDLength","PreferredTimeOption","ValidTimeOption","ShareOption","T1Option",
-"T2Option","ClntMaxLeaseOption","ClassMaxLeaseOption","AddrParams","DsLiteAftrName",
-"ExtraOption","@17","RemoteAutoconfNeighborsOption","@18","IfaceMaxLeaseOption",
-"UnicastAddressOption","DropUnicast","RapidCommitOption","PreferenceOption",
-"LogLevelOption","LogModeOption","LogNameOption","LogColors","WorkDirOption",
-"StatelessOption","GuessMode","ScriptName","PerformanceMode","ReconfigureEnabled",
-"InactiveMode","Experimental","IfaceIDOrder","CacheSizeOption","AcceptLeaseQuery",
-"BulkLeaseQueryAccept","BulkLeaseQueryTcpPort","BulkLeaseQueryMaxConns","BulkLeaseQueryTimeout",
-"RelayOption","InterfaceIDOption","Subnet","ClassOptionDeclaration","AllowClientClassDeclaration",
-"DenyClientClassDeclaration","DNSServerOption","@19","DomainOption","@20","NTPServerOption",
-"@21","TimeZoneOption","SIPServerOption","@22","SIPDomainOption","@23","FQDNOption",
-"@24","@25","@26","AcceptUnknownFQDN","FqdnDdnsAddress","DdnsProtocol","DdnsTimeout",
-"NISServerOption","@27","NISPServerOption","@28","NISDomainOption","NISPDomainOption",
-"LifetimeOption","VendorSpecOption","@29","ClientClass","@30","ClientClassDecleration",
-"Condition","Expr",""
+"ROUTE_","INFINITE_","SUBNET_","SOL_MAX_RT_","INF_MAX_RT_","REJECT_CACHE_","LEASE_REUSE_",
+"REPLY_CACHE_","LEASE_SYNC_","DECLINE_QUARANTINE_","TA_MEMORY_ONLY_","RENEW_TEMPLATES_",
+"STRING_","HEXNUMBER_","INTNUMBER_","IPV6ADDR_","DUID_","'{'","'}'","';'","'-'",
+"'/'","','","'('","')'","Grammar","GlobalDeclarationList","GlobalOption","InterfaceOptionDeclaration",
+"InterfaceDeclaration","@1","@2","InterfaceDeclarationsList","Key","@3","@4",
+"KeyOptions","KeyOption","KeySecret","KeyFudge","KeyAlgorithm","Client","@5",
+"@6","@7","ClientOptions","ClientOption","AddressReservation","PrefixReservation",
+"ClassDeclaration","@8","ClassOptionDeclarationsList","TAClassDeclaration","@9",
+"TAClassOptionsList","TAClassOption","PDDeclaration","@10","PDOptionsList","PDOptions",
+"NextHopDeclaration","@11","RouteList","Route","AuthProtocol","AuthAlgorithm",
+"AuthReplay","AuthRealm","AuthMethods","@12","DigestList","Digest","AuthDropUnauthenticated",
+"FQDNList","Number","ADDRESSList","VendorSpecList","StringList","ADDRESSRangeList",
+"PDRangeList","ADDRESSDUIDRangeList","RejectClientsOption","@13","AcceptOnlyOption",
+"@14","PoolOption","@15","PDPoolOption","@16","PDLength","PreferredTimeOption",
+"ValidTimeOption","ShareOption","T1Option","T2Option","ClntMaxLeaseOption","ClassMaxLeaseOption",
+"AddrParams","DsLiteAftrName","ExtraOption","@17","RemoteAutoconfNeighborsOption",
+"@18","IfaceMaxLeaseOption","UnicastAddressOption","DropUnicast","RapidCommitOption",
+"PreferenceOption","SolMaxRTOption","InfMaxRTOption","LogLevelOption","LogModeOption",
+"LogNameOption","LogColors","WorkDirOption","StatelessOption","GuessMode","ScriptName",
+"RejectCache","ReplyCache","RenewTemplates","TAMemoryOnly","DeclineQuarantine",
+"LeaseSync","LeaseSyncSecret","LeaseSyncRole","LeaseReuse","PerformanceMode",
+"ReconfigureEnabled","InactiveMode","Experimental","IfaceIDOrder","CacheSizeOption",
+"AcceptLeaseQuery","BulkLeaseQueryAccept","BulkLeaseQueryTcpPort","BulkLeaseQueryMaxConns",
+"BulkLeaseQueryTimeout","RelayOption","InterfaceIDOption","Subnet","ClassOptionDeclaration",
+"AllowClientClassDeclaration","DenyClientClassDeclaration","DNSServerOption",
+"@19","DomainOption","@20","NTPServerOption","@21","TimeZoneOption","SIPServerOption",
+"@22","SIPDomainOption","@23","FQDNOption","@24","@25","@26","AcceptUnknownFQDN",
+"FqdnDdnsAddress","DdnsProtocol","DdnsTimeout","NISServerOption","@27","NISPServerOption",
+"@28","NISDomainOption","NISPDomainOption","LifetimeOption","VendorSpecOption",
+"@29","ClientClass","@30","ClientClassDecleration","Condition","Expr",""
 };
 #endif
 
 static const short yyr1[] = {     0,
-   122,   122,   123,   123,   123,   123,   124,   124,   124,   124,
-   124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-   124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
-   124,   124,   125,   125,   125,   125,   125,   125,   125,   125,
-   125,   125,   125,   125,   125,   125,   125,   125,   125,   125,
-   125,   125,   125,   125,   125,   125,   125,   125,   125,   125,
-   125,   125,   125,   125,   125,   125,   127,   126,   128,   126,
-   129,   129,   129,   129,   129,   129,   129,   129,   129,   129,
-   131,   132,   130,   133,   133,   134,   134,   134,   135,   136,
-   137,   137,   137,   139,   138,   140,   138,   141,   138,   142,
-   142,   143,   143,   143,   143,   143,   143,   143,   143,   143,
-   143,   143,   143,   143,   143,   143,   143,   144,   145,   147,
-   146,   148,   148,   150,   149,   151,   151,   152,   152,   152,
-   152,   152,   152,   152,   152,   154,   153,   155,   155,   156,
-   156,   156,   156,   156,   156,   156,   156,   158,   157,   157,
-   159,   159,   160,   160,   160,   161,   162,   163,   164,   166,
-   165,   167,   167,   168,   168,   168,   168,   168,   168,   168,
-   168,   169,   170,   170,   170,   170,   170,   170,   171,   171,
-   172,   172,   173,   173,   173,   173,   173,   173,   174,   174,
-   175,   175,   175,   175,   175,   176,   177,   177,   177,   177,
-   177,   177,   177,   177,   179,   178,   181,   180,   183,   182,
-   185,   184,   186,   187,   187,   188,   188,   189,   190,   190,
-   191,   191,   192,   193,   194,   195,   196,   196,   197,   196,
-   196,   199,   198,   200,   201,   202,   203,   204,   205,   206,
-   207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
-   217,   218,   219,   219,   220,   221,   222,   223,   224,   224,
-   225,   225,   225,   226,   226,   227,   227,   227,   227,   227,
-   227,   227,   227,   227,   227,   227,   227,   228,   229,   231,
-   230,   233,   232,   235,   234,   236,   238,   237,   240,   239,
-   242,   241,   243,   241,   244,   241,   245,   245,   246,   247,
-   248,   250,   249,   252,   251,   253,   254,   255,   257,   256,
-   259,   258,   260,   261,   261,   261,   261,   261,   262,   262,
-   262,   262,   262,   262,   262
+   131,   131,   132,   132,   132,   132,   133,   133,   133,   133,
+   133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
+   133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
+   133,   133,   133,   133,   133,   133,   133,   133,   133,   134,
+   134,   134,   134,   134,   134,   134,   134,   134,   134,   134,
+   134,   134,   134,   134,   134,   134,   134,   134,   134,   134,
+   134,   134,   134,   134,   134,   134,   134,   134,   134,   134,
+   134,   134,   134,   134,   134,   136,   135,   137,   135,   138,
+   138,   138,   138,   138,   138,   138,   138,   138,   138,   140,
+   141,   139,   142,   142,   143,   143,   143,   144,   145,   146,
+   146,   146,   148,   147,   149,   147,   150,   147,   151,   151,
+   152,   152,   152,   152,   152,   152,   152,   152,   152,   152,
+   152,   152,   152,   152,   152,   152,   153,   154,   156,   155,
+   157,   157,   159,   158,   160,   160,   161,   161,   161,   161,
+   161,   161,   161,   161,   163,   162,   164,   164,   165,   165,
+   165,   165,   165,   165,   165,   165,   167,   166,   166,   168,
+   168,   169,   169,   169,   170,   171,   172,   173,   175,   174,
+   176,   176,   177,   177,   177,   177,   177,   177,   177,   177,
+   178,   179,   179,   179,   179,   179,   179,   180,   180,   181,
+   181,   182,   182,   182,   182,   182,   182,   183,   183,   184,
+   184,   184,   184,   184,   185,   186,   186,   186,   186,   186,
+   186,   186,   186,   188,   187,   190,   189,   192,   191,   194,
+   193,   195,   196,   196,   197,   197,   198,   199,   199,   200,
+   200,   201,   202,   203,   204,   205,   205,   206,   205,   205,
+   208,   207,   209,   210,   211,   212,   213,   214,   215,   216,
+   217,   218,   219,   220,   221,   222,   223,   224,   224,   225,
+   225,   226,   227,   228,   228,   229,   229,   230,   230,   231,
+   232,   233,   234,   235,   236,   237,   238,   239,   239,   240,
+   241,   242,   243,   244,   244,   245,   245,   245,   246,   246,
+   247,   247,   247,   247,   247,   247,   247,   247,   247,   247,
+   247,   247,   248,   249,   251,   250,   253,   252,   255,   254,
+   256,   258,   257,   260,   259,   262,   261,   263,   261,   264,
+   261,   265,   265,   266,   267,   268,   270,   269,   272,   271,
+   273,   274,   275,   277,   276,   279,   278,   280,   281,   281,
+   281,   281,   281,   282,   282,   282,   282,   282,   282,   282
 };
 
 static const short yyr2[] = {     0,
@@ -1263,113 +1316,122 @@ static const short yyr2[] = {     0,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     0,     6,     0,     6,
-     1,     2,     1,     1,     1,     1,     2,     2,     2,     2,
-     0,     0,     8,     1,     2,     1,     1,     1,     3,     3,
-     3,     3,     3,     0,     7,     0,     9,     0,     7,     1,
-     2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     2,     4,     0,
-     5,     1,     2,     0,     5,     1,     2,     1,     1,     1,
-     1,     1,     1,     1,     1,     0,     5,     1,     2,     1,
-     1,     1,     1,     1,     1,     1,     1,     0,     6,     2,
-     1,     2,     6,     4,     6,     2,     2,     2,     2,     0,
-     3,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-     1,     2,     1,     3,     3,     3,     5,     5,     1,     1,
-     1,     3,     5,     5,     5,     7,     7,     7,     1,     3,
-     1,     3,     3,     3,     5,     3,     1,     3,     3,     5,
-     1,     3,     3,     5,     0,     3,     0,     3,     0,     3,
-     0,     3,     2,     2,     4,     2,     4,     2,     2,     4,
-     2,     4,     2,     2,     2,     3,     4,     4,     0,     5,
-     4,     0,     4,     2,     2,     1,     2,     2,     2,     2,
-     2,     2,     2,     1,     1,     2,     2,     2,     1,     1,
-     2,     2,     1,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     4,     4,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     2,     2,     0,
-     4,     0,     4,     0,     4,     3,     0,     4,     0,     4,
-     0,     4,     0,     5,     0,     6,     3,     2,     2,     2,
-     2,     0,     4,     0,     4,     3,     3,     3,     0,     4,
-     0,     6,     2,     0,     5,     5,     5,     5,     1,     1,
-     1,     1,     1,     1,     8
+     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+     1,     1,     1,     1,     1,     0,     6,     0,     6,     1,
+     2,     1,     1,     1,     1,     2,     2,     2,     2,     0,
+     0,     8,     1,     2,     1,     1,     1,     3,     3,     3,
+     3,     3,     0,     7,     0,     9,     0,     7,     1,     2,
+     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+     1,     1,     1,     1,     1,     1,     2,     4,     0,     5,
+     1,     2,     0,     5,     1,     2,     1,     1,     1,     1,
+     1,     1,     1,     1,     0,     5,     1,     2,     1,     1,
+     1,     1,     1,     1,     1,     1,     0,     6,     2,     1,
+     2,     6,     4,     6,     2,     2,     2,     2,     0,     3,
+     1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+     2,     1,     3,     3,     3,     5,     5,     1,     1,     1,
+     3,     5,     5,     5,     7,     7,     7,     1,     3,     1,
+     3,     3,     3,     5,     3,     1,     3,     3,     5,     1,
+     3,     3,     5,     0,     3,     0,     3,     0,     3,     0,
+     3,     2,     2,     4,     2,     4,     2,     2,     4,     2,
+     4,     2,     2,     2,     3,     4,     4,     0,     5,     4,
+     0,     4,     2,     2,     1,     2,     2,     2,     2,     2,
+     2,     2,     2,     2,     1,     1,     2,     2,     3,     2,
+     3,     2,     1,     2,     3,     4,     5,     0,     2,     1,
+     2,     2,     2,     1,     1,     2,     2,     1,     2,     2,
+     2,     2,     2,     2,     2,     2,     2,     2,     4,     4,
+     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+     1,     1,     2,     2,     0,     4,     0,     4,     0,     4,
+     3,     0,     4,     0,     4,     0,     4,     0,     5,     0,
+     6,     3,     2,     2,     2,     2,     0,     4,     0,     4,
+     3,     3,     3,     0,     4,     0,     6,     2,     0,     5,
+     5,     5,     5,     1,     1,     1,     1,     1,     1,     8
 };
 
 static const short yydefact[] = {     2,
      0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,   207,   205,   209,     0,     0,     0,
-     0,     0,     0,   236,     0,     0,     0,     0,     0,   244,
-     0,     0,     0,     0,   245,   249,   250,     0,     0,     0,
-     0,     0,   160,     0,     0,     0,   253,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     1,     3,     7,     4,
-    28,    64,    62,    15,    16,    17,    18,    19,    20,   272,
-   273,   268,   266,   267,   269,   270,   271,    45,   274,   275,
-    58,    60,    61,    44,    41,    32,    43,    42,     9,     8,
-    10,    11,    12,    13,    26,    29,    30,    31,    65,    21,
-    22,    14,    36,    37,    38,    39,    40,    34,    35,    66,
-    33,   276,   277,    46,    47,    48,    49,    50,    51,    52,
-    53,    23,    24,    25,    54,    56,    55,    57,    59,    63,
-    27,     0,   179,   180,     0,   259,   260,   263,   262,   261,
-   251,   241,   239,   240,   242,   243,   280,   282,   284,     0,
-   287,   289,   302,     0,   304,     0,     0,   291,   309,   232,
-     0,     0,   298,   299,   300,   301,     0,     0,     0,   218,
-   219,   221,   214,   216,   235,   238,   237,   234,   224,   223,
-   252,   136,   246,     0,     0,     0,   225,   247,   156,   157,
-   158,     0,   172,   159,     0,   254,   255,   256,   257,   258,
-     0,   248,   278,   279,     0,     5,     6,    67,    69,     0,
-     0,     0,   286,     0,     0,     0,   306,     0,   307,   308,
-   293,     0,     0,     0,   226,     0,     0,     0,   229,   297,
-   197,   201,   208,   206,   191,   210,     0,     0,     0,     0,
-     0,     0,     0,     0,   164,   165,   166,   167,   168,   169,
-   170,   171,   161,   162,    81,   311,     0,     0,     0,     0,
-   181,   281,   189,   283,   285,   288,   290,   303,   305,   295,
-     0,   173,   292,     0,   310,   233,   227,   228,   231,     0,
-     0,     0,     0,     0,     0,     0,   220,   222,   215,   217,
-     0,   211,     0,   138,   141,   140,   143,   142,   144,   145,
-   146,   147,    94,     0,    98,     0,     0,     0,   265,   264,
-     0,     0,     0,     0,    71,     0,    73,    74,    75,    76,
-     0,     0,     0,     0,   294,     0,     0,     0,     0,   230,
-   198,   202,   199,   203,   192,   193,   194,   213,     0,   137,
-   139,     0,     0,     0,   163,     0,     0,     0,     0,    84,
-    87,    88,    86,   314,     0,   120,   124,   150,     0,    68,
-    72,    78,    77,    79,    80,    70,   182,   190,   296,   175,
-   174,   176,     0,     0,     0,     0,     0,     0,   212,     0,
-     0,     0,     0,   100,   116,   117,   115,   114,   102,   103,
-   104,   105,   106,   107,   108,   110,   109,   111,   112,   113,
-    96,     0,     0,     0,     0,     0,     0,    82,    85,   314,
-   313,   312,     0,     0,   148,     0,     0,     0,     0,   200,
-   204,   195,     0,   118,     0,    95,   101,     0,    99,    89,
-    93,    92,    91,    90,     0,   319,   320,   321,   322,     0,
-   323,   324,     0,     0,     0,   122,     0,   126,   132,   133,
-   130,   128,   129,   131,   134,   135,     0,   154,   178,   177,
-   185,   184,   183,     0,   196,     0,     0,    83,     0,   314,
-   314,     0,     0,   121,   123,   125,   127,     0,   151,     0,
-     0,   119,    97,     0,     0,     0,     0,     0,   149,   152,
-   155,   153,   188,   187,   186,     0,   317,   318,   316,   315,
-     0,     0,     0,   325,     0,     0,     0
+     0,     0,     0,     0,   216,   214,   218,     0,     0,     0,
+     0,     0,     0,   245,     0,     0,     0,     0,     0,   255,
+     0,     0,     0,     0,   256,   274,   275,     0,     0,     0,
+     0,     0,   169,     0,     0,     0,   278,     0,     0,     0,
+     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     0,     0,     0,   263,     0,     1,     3,     7,     4,    28,
+    73,    71,    15,    16,    17,    18,    19,    20,   297,   298,
+   293,   291,   292,   294,   295,   296,    54,   299,   300,    67,
+    69,    70,    53,    48,    32,    52,    49,    50,    51,     9,
+     8,    10,    11,    12,    13,    26,    29,    33,    35,    36,
+    39,    38,    37,    34,    30,    31,    74,    21,    22,    14,
+    43,    44,    45,    46,    47,    41,    42,    75,    40,   301,
+   302,    55,    56,    57,    58,    59,    60,    61,    62,    23,
+    24,    25,    63,    65,    64,    66,    68,    72,    27,     0,
+   188,   189,     0,   284,   285,   288,   287,   286,   276,   252,
+   250,   251,   253,   254,   305,   307,   309,     0,   312,   314,
+   327,     0,   329,     0,     0,   316,   334,   241,     0,     0,
+   323,   324,   325,   326,     0,     0,     0,   227,   228,   230,
+   223,   225,   244,   247,   246,   243,   233,   232,   277,   145,
+   257,     0,     0,     0,   234,   272,   165,   166,   167,     0,
+   181,   168,     0,   279,   280,   281,   282,   283,     0,   273,
+   303,   304,     0,   248,   249,   258,   271,   260,   270,     0,
+   264,   262,     5,     6,    76,    78,     0,     0,     0,   311,
+     0,     0,     0,   331,     0,   332,   333,   318,     0,     0,
+     0,   235,     0,     0,     0,   238,   322,   206,   210,   217,
+   215,   200,   219,     0,     0,     0,     0,     0,     0,     0,
+     0,   173,   174,   175,   176,   177,   178,   179,   180,   170,
+   171,    90,   336,     0,     0,   259,   261,   268,   265,     0,
+     0,   190,   306,   198,   308,   310,   313,   315,   328,   330,
+   320,     0,   182,   317,     0,   335,   242,   236,   237,   240,
+     0,     0,     0,     0,     0,     0,     0,   229,   231,   224,
+   226,     0,   220,     0,   147,   150,   149,   152,   151,   153,
+   154,   155,   156,   103,     0,   107,     0,     0,     0,   290,
+   289,     0,   268,   266,     0,     0,     0,     0,    80,     0,
+    82,    83,    84,    85,     0,     0,     0,     0,   319,     0,
+     0,     0,     0,   239,   207,   211,   208,   212,   201,   202,
+   203,   222,     0,   146,   148,     0,     0,     0,   172,     0,
+     0,     0,     0,    93,    96,    97,    95,   339,     0,   269,
+   267,   129,   133,   159,     0,    77,    81,    87,    86,    88,
+    89,    79,   191,   199,   321,   184,   183,   185,     0,     0,
+     0,     0,     0,     0,   221,     0,     0,     0,     0,   109,
+   125,   126,   124,   123,   111,   112,   113,   114,   115,   116,
+   117,   119,   118,   120,   121,   122,   105,     0,     0,     0,
+     0,     0,     0,    91,    94,   339,   338,   337,     0,     0,
+   157,     0,     0,     0,     0,   209,   213,   204,     0,   127,
+     0,   104,   110,     0,   108,    98,   102,   101,   100,    99,
+     0,   344,   345,   346,   347,     0,   348,   349,     0,     0,
+     0,   131,     0,   135,   141,   142,   139,   137,   138,   140,
+   143,   144,     0,   163,   187,   186,   194,   193,   192,     0,
+   205,     0,     0,    92,     0,   339,   339,     0,     0,   130,
+   132,   134,   136,     0,   160,     0,     0,   128,   106,     0,
+     0,     0,     0,     0,   158,   161,   164,   162,   197,   196,
+   195,     0,   342,   343,   341,   340,     0,     0,     0,   350,
+     0,     0,     0
 };
 
-static const short yydefgoto[] = {   505,
-    57,    58,    59,    60,   259,   260,   316,    61,   307,   435,
-   349,   350,   351,   352,   353,    62,   342,   428,   344,   383,
-   384,   385,   386,   317,   413,   445,   318,   414,   447,   448,
-    63,   241,   293,   294,   319,   457,   478,   320,    64,    65,
-    66,    67,    68,   192,   253,   254,    69,   273,   442,   262,
-   275,   264,   236,   379,   233,    70,   168,    71,   167,    72,
-   169,   295,   339,   296,    73,    74,    75,    76,    77,    78,
-    79,    80,    81,    82,   280,    83,   224,    84,    85,    86,
-    87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
-    97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-   107,   108,   109,   110,   111,   112,   113,   114,   210,   115,
-   211,   116,   212,   117,   118,   214,   119,   215,   120,   222,
-   271,   324,   121,   122,   123,   124,   125,   216,   126,   218,
-   127,   128,   129,   130,   223,   131,   308,   355,   411,   444
+static const short yydefgoto[] = {   541,
+    66,    67,    68,    69,   290,   291,   350,    70,   338,   471,
+   383,   384,   385,   386,   387,    71,   376,   464,   378,   419,
+   420,   421,   422,   351,   449,   481,   352,   450,   483,   484,
+    72,   268,   324,   325,   353,   493,   514,   354,    73,    74,
+    75,    76,    77,   210,   280,   281,    78,   304,   478,   293,
+   306,   295,   263,   415,   260,    79,   186,    80,   185,    81,
+   187,   326,   373,   327,    82,    83,    84,    85,    86,    87,
+    88,    89,    90,    91,   311,    92,   251,    93,    94,    95,
+    96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+   106,   107,   108,   109,   110,   111,   112,   113,   344,   230,
+   114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+   124,   125,   126,   127,   128,   129,   130,   131,   132,   237,
+   133,   238,   134,   239,   135,   136,   241,   137,   242,   138,
+   249,   302,   358,   139,   140,   141,   142,   143,   243,   144,
+   245,   145,   146,   147,   148,   250,   149,   339,   389,   447,
+   480
 };
 
-static const short yypact[] = {   443,
-   -24,   116,   145,   -30,    -6,    96,    25,    96,    29,   285,
-    96,    43,    32,    96,-32768,-32768,-32768,    96,    96,    96,
-    96,    96,    68,-32768,    96,    96,    96,    96,    96,-32768,
-    96,    72,   102,   258,-32768,-32768,-32768,    96,    96,   137,
-   143,   151,-32768,    96,   153,   157,    96,    96,    96,    96,
-    96,   167,    96,   178,   184,   187,   443,-32768,-32768,-32768,
+static const short yypact[] = {   511,
+   115,   132,   170,  -102,   -95,   220,   -67,   220,   -64,   222,
+   220,   -55,   -22,   220,-32768,-32768,-32768,   220,   220,   220,
+   220,   220,    12,-32768,   220,   220,   220,   220,   220,-32768,
+   220,    18,    30,   331,-32768,-32768,-32768,   220,   220,    40,
+    46,    55,-32768,   220,    66,    77,   220,   220,   220,   220,
+   220,    99,   220,   102,   104,   138,   220,   220,   220,   220,
+   220,   111,   220,-32768,   220,   511,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
@@ -1377,215 +1439,224 @@ static const short yypact[] = {   443,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,   128,-32768,-32768,   205,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   222,
--32768,-32768,-32768,   225,-32768,   229,    96,   232,-32768,-32768,
-   231,    57,   241,-32768,-32768,-32768,   103,   103,   253,-32768,
-   238,   254,   255,   257,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,   267,    96,   271,-32768,-32768,-32768,-32768,
--32768,   440,-32768,-32768,   270,-32768,-32768,-32768,-32768,-32768,
-   272,-32768,-32768,-32768,   165,-32768,-32768,-32768,-32768,   277,
-   289,   277,-32768,   277,   289,   277,-32768,   277,-32768,-32768,
-   283,   290,    96,   277,-32768,   287,   291,   292,-32768,-32768,
-   297,   298,   300,   300,   208,   307,    96,    96,    96,    96,
-    95,   288,   311,   294,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,   310,-32768,-32768,-32768,   305,    96,   530,   530,
--32768,   313,-32768,   315,   313,   313,   315,   313,   313,-32768,
-   290,   321,   320,   324,   323,   313,-32768,-32768,-32768,   277,
-   333,   337,   108,   339,   293,   346,-32768,-32768,-32768,-32768,
-    96,-32768,   345,    95,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,   348,-32768,   440,   243,   372,-32768,-32768,
-   349,   350,   354,   355,-32768,   236,-32768,-32768,-32768,-32768,
-   325,   356,   360,   290,   320,   121,   383,    96,    96,   313,
--32768,-32768,   376,   380,-32768,-32768,   381,-32768,   387,-32768,
--32768,    37,   386,    37,-32768,   397,   216,    96,   130,-32768,
--32768,-32768,-32768,   404,   392,-32768,-32768,   411,   408,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   320,-32768,
--32768,   416,   419,   422,   428,   432,   434,   429,-32768,   579,
-   436,   437,    82,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   130,
+-32768,-32768,   139,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,   152,-32768,-32768,
+-32768,   157,-32768,   159,   220,   153,-32768,-32768,   165,   155,
+   186,-32768,-32768,-32768,   224,   224,   190,-32768,   194,   199,
+   201,   245,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,   256,   220,   195,-32768,-32768,-32768,-32768,-32768,   314,
+-32768,-32768,   278,-32768,-32768,-32768,-32768,-32768,   282,-32768,
+-32768,-32768,   241,-32768,-32768,   220,-32768,   220,-32768,   315,
+   220,-32768,-32768,-32768,-32768,-32768,   326,   316,   326,-32768,
+   326,   316,   326,-32768,   326,-32768,-32768,   338,   354,   220,
+   326,-32768,   351,   355,   361,-32768,-32768,   352,   356,   358,
+   358,   249,   359,   220,   220,   220,   220,   244,   365,   363,
+   367,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   364,
+-32768,-32768,-32768,   370,   220,-32768,-32768,    34,-32768,   625,
+   625,-32768,   366,-32768,   368,   366,   366,   368,   366,   366,
+-32768,   354,   369,   372,   371,   374,   366,-32768,-32768,-32768,
+   326,   377,   381,   277,   383,   373,   384,-32768,-32768,-32768,
+-32768,   220,-32768,   385,   244,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,   386,-32768,   314,   382,   420,-32768,
+-32768,   393,   439,-32768,   390,   395,   398,   405,-32768,   264,
+-32768,-32768,-32768,-32768,   375,   406,   410,   354,   372,   308,
+   411,   220,   220,   366,-32768,-32768,   404,   408,-32768,-32768,
+   409,-32768,   415,-32768,-32768,   112,   437,   112,-32768,   443,
+    41,   220,   108,-32768,-32768,-32768,-32768,   434,   441,-32768,
+-32768,-32768,-32768,   444,   442,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,   372,-32768,-32768,   440,   448,   449,
+   447,   462,   464,   459,-32768,   313,   466,   467,    56,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,   114,   438,   439,   442,   444,   454,-32768,-32768,   296,
--32768,-32768,   620,   186,-32768,   441,   233,   119,    96,-32768,
--32768,-32768,   445,-32768,   435,-32768,-32768,    37,-32768,-32768,
--32768,-32768,-32768,-32768,   460,-32768,-32768,-32768,-32768,   430,
--32768,-32768,   261,   -20,   588,-32768,   344,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,   453,   552,-32768,-32768,
--32768,-32768,-32768,   462,-32768,    96,   133,-32768,   326,   404,
-   404,   326,   326,-32768,-32768,-32768,-32768,   -70,-32768,     2,
-   152,-32768,-32768,   461,   463,   464,   465,   466,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,    96,-32768,-32768,-32768,-32768,
-   469,    96,   468,-32768,   581,   582,-32768
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,    67,   465,   468,
+   469,   476,   477,-32768,-32768,   585,-32768,-32768,   407,   433,
+-32768,   471,   346,   192,   220,-32768,-32768,-32768,   472,-32768,
+   478,-32768,-32768,   112,-32768,-32768,-32768,-32768,-32768,-32768,
+   479,-32768,-32768,-32768,-32768,   460,-32768,-32768,   360,   -59,
+   322,-32768,   223,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,   497,   581,-32768,-32768,-32768,-32768,-32768,   481,
+-32768,   220,    79,-32768,   330,   434,   434,   330,   330,-32768,
+-32768,-32768,-32768,    81,-32768,   -15,   197,-32768,-32768,   480,
+   482,   483,   484,   485,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,   220,-32768,-32768,-32768,-32768,   488,   220,   487,-32768,
+   618,   631,-32768
 };
 
 static const short yypgoto[] = {-32768,
--32768,   534,  -138,   536,-32768,-32768,   347,-32768,-32768,-32768,
--32768,   256,-32768,-32768,-32768,-32768,-32768,-32768,-32768,  -322,
-  -300,-32768,-32768,  -153,-32768,-32768,  -134,-32768,-32768,   159,
--32768,-32768,   314,-32768,  -123,-32768,-32768,  -305,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,   303,-32768,  -256,    -1,    35,
--32768,   395,-32768,-32768,   459,  -356,-32768,  -248,-32768,  -245,
--32768,-32768,-32768,-32768,  -238,  -237,-32768,  -197,  -187,-32768,
-  -239,-32768,  -330,  -313,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,   568,  -212,   569,-32768,-32768,   345,-32768,-32768,-32768,
+-32768,   254,-32768,-32768,-32768,-32768,-32768,-32768,-32768,  -356,
+  -304,-32768,-32768,  -193,-32768,-32768,  -154,-32768,-32768,   158,
+-32768,-32768,   317,-32768,  -137,-32768,-32768,  -316,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,   301,-32768,  -287,    -1,   -35,
+-32768,   401,-32768,-32768,   454,  -447,-32768,  -406,-32768,  -338,
+-32768,-32768,-32768,-32768,  -264,  -262,-32768,  -227,  -174,-32768,
+  -318,-32768,  -364,  -347,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   302,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,  -390,  -235,  -233,  -310,-32768,  -309,
--32768,  -303,-32768,  -302,  -282,-32768,  -279,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,  -278,-32768,  -275,-32768,
-  -267,  -266,  -254,  -232,-32768,-32768,-32768,-32768,  -328,  -181
+-32768,-32768,-32768,-32768,-32768,  -396,  -260,  -257,  -343,-32768,
+  -336,-32768,  -309,-32768,  -303,  -296,-32768,  -292,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,  -289,-32768,  -288,
+-32768,  -279,  -275,  -272,  -267,-32768,-32768,-32768,-32768,  -328,
+  -105
 };
 
 
-#define	YYLAST		720
-
-
-static const short yytable[] = {   135,
-   137,   140,   297,   298,   143,   301,   145,   302,   162,   163,
-   365,   387,   166,   387,   325,   365,   170,   171,   172,   173,
-   174,   402,   446,   176,   177,   178,   179,   180,   388,   181,
-   388,   389,   390,   389,   390,   314,   187,   188,   391,   392,
-   391,   392,   193,   299,   489,   196,   197,   198,   199,   200,
-   380,   202,   387,   300,   475,   297,   298,   449,   301,   393,
-   302,   393,   394,   395,   394,   395,   396,   369,   396,   388,
-   472,   387,   389,   390,   397,   398,   397,   398,   141,   391,
-   392,   443,   427,   473,   132,   133,   134,   399,   388,   399,
-   449,   389,   390,   381,   382,   380,   299,   387,   391,   392,
-   393,   427,   142,   394,   395,   467,   300,   396,   491,   400,
-   226,   400,   492,   227,   388,   397,   398,   389,   390,   393,
-   315,   315,   394,   395,   391,   392,   396,   380,   399,    19,
-    20,    21,    22,   144,   397,   398,   387,   146,   381,   382,
-   165,   485,   486,   291,   292,   393,   380,   399,   394,   395,
-   400,   479,   396,   388,   164,   220,   389,   390,   228,   229,
-   397,   398,   362,   391,   392,   450,   427,   362,   451,   400,
-   381,   382,   490,   399,   454,   452,   453,   361,   455,   175,
-   456,   363,   361,   243,   393,   182,   363,   394,   395,   381,
-   382,   396,   364,    54,    55,   400,   426,   364,   450,   397,
-   398,   451,   346,   347,   348,   133,   134,   454,   452,   453,
-   183,   455,   399,   456,   231,   232,    15,    16,    17,   333,
-   334,   274,    21,    22,   136,   133,   134,   461,   429,    28,
-   462,   463,   370,   371,   400,   287,   288,   289,   290,     2,
-     3,   208,   311,   312,   408,   189,   265,   483,   266,    10,
-   268,   190,   269,   138,   133,   134,   310,   139,   276,   191,
-   493,   194,    11,   494,   495,   195,    15,    16,    17,    18,
-    19,    20,    21,    22,    23,   201,    25,    26,    27,    28,
-    29,   257,   258,    32,    54,    55,   203,   484,    34,   338,
-   487,   488,   204,   404,   405,    36,   406,    38,   205,   147,
-   148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
-   158,   184,   185,   186,   330,   346,   347,   348,   209,    47,
-    48,    49,    50,    51,   284,   285,   373,   374,     2,     3,
-   213,   311,   312,   217,    54,    55,   159,   219,    10,   225,
-   313,   314,   221,    56,   459,   460,   407,   160,   161,   230,
-   360,    11,   470,   471,   237,    15,    16,    17,    18,    19,
-    20,    21,    22,    23,   235,    25,    26,    27,    28,    29,
-   238,   239,    32,   240,    15,    16,    17,    34,   162,   242,
-    21,    22,   244,   255,    36,   256,    38,    28,   261,   436,
-   437,   438,   439,   270,   133,   134,   440,   263,   272,   277,
-   279,   303,   278,   336,   441,   133,   134,   305,    47,    48,
-    49,    50,    51,   281,   282,   410,   309,   464,   283,   436,
-   437,   438,   439,    54,    55,   286,   440,   304,   306,   313,
-   314,   322,    56,   323,   441,   133,   134,   326,   327,   366,
-   328,   329,    54,    55,   331,     1,     2,     3,     4,   332,
-   335,     5,     6,     7,     8,     9,    10,   337,   476,   340,
-   343,   354,   356,   357,   482,   358,   359,   367,   368,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-    32,   372,   375,    33,   501,    34,   376,   377,   378,   401,
-   503,    35,    36,    37,    38,   403,   412,    39,    40,    41,
-    42,    43,    44,    45,    46,   245,   246,   247,   248,   249,
-   250,   251,   252,   410,   415,   416,    47,    48,    49,    50,
-    51,    52,   417,     2,     3,   418,   311,   312,   419,   420,
-    53,    54,    55,    10,   421,   422,   423,   424,   425,   469,
-    56,   458,   466,   430,   431,   465,    11,   432,   314,   433,
-    15,    16,    17,    18,    19,    20,    21,    22,    23,   434,
-    25,    26,    27,    28,    29,   468,   480,    32,   481,   496,
-   506,   507,    34,   497,   498,   499,   500,   502,   504,    36,
-   206,    38,   207,   147,   148,   149,   150,   151,   152,   153,
-   154,   155,   156,   157,   409,   477,   321,   341,   345,   267,
-     0,     0,     0,    47,    48,    49,    50,    51,    15,    16,
-    17,    18,    19,    20,    21,    22,   234,     0,    54,    55,
-   159,    28,     0,     0,   313,   314,     0,    56,     0,     0,
-     0,     0,   161,     0,     0,     0,     0,     0,     0,    38,
-    15,    16,    17,    18,    19,    20,    21,    22,     0,     0,
-     0,     0,     0,    28,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,    38,     0,     0,     0,     0,    54,    55,   133,   134,
+#define	YYLAST		735
+
+
+static const short yytable[] = {   153,
+   155,   158,   485,   328,   161,   329,   163,   332,   180,   181,
+   333,   423,   184,   423,   359,   159,   188,   189,   190,   191,
+   192,   438,   160,   194,   195,   196,   197,   198,   424,   199,
+   424,   508,   425,   401,   425,   485,   205,   206,   401,   426,
+   330,   426,   211,   486,   509,   214,   215,   216,   217,   218,
+   162,   220,   482,   164,   423,   224,   225,   226,   227,   228,
+   328,   231,   329,   232,   332,   182,   427,   333,   427,   416,
+   405,   424,   428,   423,   428,   425,   486,   349,   349,   429,
+   416,   429,   426,   430,   511,   430,   431,   432,   431,   432,
+   424,   527,   416,   331,   425,   183,   433,   330,   433,   423,
+   434,   426,   434,   435,   528,   435,   342,   503,   436,   427,
+   436,   487,   417,   418,   463,   428,   424,   479,   440,   441,
+   425,   442,   429,   417,   418,   416,   430,   426,   427,   431,
+   432,   490,   193,   463,   428,   417,   418,   397,   423,   433,
+   200,   429,   397,   434,   487,   430,   435,   201,   431,   432,
+   331,   436,   151,   152,   427,   424,   398,   207,   433,   425,
+   428,   398,   434,   208,   490,   435,   426,   429,   417,   418,
+   436,   430,   209,   247,   431,   432,   515,   521,   522,   462,
+   380,   381,   382,   212,   433,   488,   348,   489,   434,   491,
+   465,   435,   492,   427,   213,   399,   436,   526,   463,   428,
+   399,   270,   519,   296,   525,   297,   429,   299,   253,   300,
+   430,   254,   400,   431,   432,   307,   219,   400,   488,   221,
+   489,   222,   491,   433,   286,   492,   287,   434,   229,   289,
+   435,   444,   150,   151,   152,   436,   165,   166,   167,   168,
+   169,   170,   171,   172,   173,   174,   175,   176,   305,   154,
+   151,   152,   235,    15,    16,    17,   255,   256,   223,    21,
+    22,   236,   318,   319,   320,   321,    28,     2,     3,   240,
+   345,   346,   248,   177,   244,   364,   246,    10,    19,    20,
+    21,    22,   252,   341,   178,   179,   343,   156,   151,   152,
+    11,   157,   322,   323,    15,    16,    17,    18,    19,    20,
+    21,    22,    23,   257,    25,    26,    27,    28,    29,   497,
+   262,    32,   498,   499,   529,   271,    34,   530,   531,   264,
+   372,    54,    55,    36,   265,    38,   266,   165,   166,   167,
+   168,   169,   170,   171,   172,   173,   174,   175,   151,   152,
+   151,   152,    54,    55,   258,   259,   512,    47,    48,    49,
+    50,    51,    15,    16,    17,    18,    19,    20,    21,    22,
+   409,   410,    54,    55,   177,    28,   284,   285,   347,   348,
+   267,    56,    57,    58,   315,   316,   179,   269,     2,     3,
+   443,   345,   346,    38,   202,   203,   204,   396,    10,   272,
+   273,   274,   275,   276,   277,   278,   279,   367,   368,   520,
+   282,    11,   523,   524,   283,    15,    16,    17,    18,    19,
+    20,    21,    22,    23,   180,    25,    26,    27,    28,    29,
+    54,    55,    32,   472,   473,   474,   475,    34,   406,   407,
+   476,   151,   152,   294,    36,   288,    38,    15,    16,    17,
+    18,    19,    20,    21,    22,   510,   292,   477,   151,   152,
+    28,   506,   507,   500,   380,   381,   382,   301,    47,    48,
+    49,    50,    51,    15,    16,    17,   495,   496,    38,    21,
+    22,   303,   308,    54,    55,   309,    28,   312,   310,   347,
+   348,   313,    56,    57,    58,   314,   317,   334,   335,   336,
+   340,   337,   370,   356,   360,   357,   362,   365,   402,   361,
+   518,   363,   366,   369,   371,    54,    55,   377,   374,   388,
+   390,   342,   392,     1,     2,     3,     4,   393,   394,     5,
+     6,     7,     8,     9,    10,   395,   403,   404,   408,   411,
+   537,    54,    55,   412,   413,   414,   539,    11,    12,    13,
+    14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+    24,    25,    26,    27,    28,    29,    30,    31,    32,   437,
+   439,    33,   446,    34,   448,   453,   451,   456,   452,    35,
+    36,    37,    38,   454,   455,    39,    40,    41,    42,    43,
+    44,    45,    46,   457,   458,   459,   460,   461,   505,   466,
+   494,   501,   467,   468,    47,    48,    49,    50,    51,    52,
+   469,   470,   348,   504,   502,   516,   517,   532,    53,    54,
+    55,   533,   534,   535,   536,   538,   540,   542,    56,    57,
+    58,    59,    60,    61,    62,    63,    64,    65,     2,     3,
+   543,   345,   346,   233,   234,   355,   445,   379,    10,   261,
+   513,   375,   298,     0,   391,     0,     0,     0,     0,     0,
+     0,    11,     0,     0,     0,    15,    16,    17,    18,    19,
+    20,    21,    22,    23,     0,    25,    26,    27,    28,    29,
+     0,     0,    32,     0,     0,     0,     0,    34,   472,   473,
+   474,   475,     0,     0,    36,   476,    38,     0,     0,     0,
      0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,   474,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,    54,    55
+     0,     0,   477,   151,   152,     0,     0,     0,    47,    48,
+    49,    50,    51,   446,     0,     0,     0,     0,     0,     0,
+     0,     0,     0,    54,    55,     0,     0,     0,     0,   347,
+   348,     0,    56,    57,    58
 };
 
 static const short yycheck[] = {     1,
-     2,     3,   241,   241,     6,   241,     8,   241,    10,    11,
-   316,   342,    14,   344,   271,   321,    18,    19,    20,    21,
-    22,   344,   413,    25,    26,    27,    28,    29,   342,    31,
-   344,   342,   342,   344,   344,   106,    38,    39,   342,   342,
-   344,   344,    44,   241,   115,    47,    48,    49,    50,    51,
-    14,    53,   383,   241,   445,   294,   294,   414,   294,   342,
-   294,   344,   342,   342,   344,   344,   342,   324,   344,   383,
-    91,   402,   383,   383,   342,   342,   344,   344,   109,   383,
-   383,   410,   383,   104,   109,   110,   111,   342,   402,   344,
-   447,   402,   402,    57,    58,    14,   294,   428,   402,   402,
-   383,   402,   109,   383,   383,   428,   294,   383,   107,   342,
-    54,   344,   111,    57,   428,   383,   383,   428,   428,   402,
-   259,   260,   402,   402,   428,   428,   402,    14,   383,    35,
-    36,    37,    38,   109,   402,   402,   467,   109,    57,    58,
-   109,   470,   471,    49,    50,   428,    14,   402,   428,   428,
-   383,   457,   428,   467,   112,   157,   467,   467,   102,   103,
-   428,   428,   316,   467,   467,   414,   467,   321,   414,   402,
-    57,    58,   478,   428,   414,   414,   414,   316,   414,   112,
-   414,   316,   321,   185,   467,   114,   321,   467,   467,    57,
-    58,   467,   316,    99,   100,   428,   115,   321,   447,   467,
-   467,   447,    73,    74,    75,   110,   111,   447,   447,   447,
-   109,   447,   467,   447,   112,   113,    31,    32,    33,   112,
-   113,   223,    37,    38,   109,   110,   111,   109,   115,    44,
-   112,   113,   112,   113,   467,   237,   238,   239,   240,     4,
-     5,   114,     7,     8,   115,   109,   212,   115,   214,    14,
-   216,   109,   218,   109,   110,   111,   258,   113,   224,   109,
-   109,   109,    27,   112,   113,   109,    31,    32,    33,    34,
-    35,    36,    37,    38,    39,   109,    41,    42,    43,    44,
-    45,   117,   118,    48,    99,   100,   109,   469,    53,   291,
-   472,   473,   109,    78,    79,    60,    81,    62,   112,    15,
-    16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-    26,    54,    55,    56,   280,    73,    74,    75,   114,    84,
-    85,    86,    87,    88,   117,   118,   328,   329,     4,     5,
-   109,     7,     8,   109,    99,   100,    52,   109,    14,   109,
-   105,   106,   111,   108,   112,   113,   348,    63,    64,   109,
-   115,    27,    92,    93,   117,    31,    32,    33,    34,    35,
-    36,    37,    38,    39,   112,    41,    42,    43,    44,    45,
-   117,   117,    48,   117,    31,    32,    33,    53,   380,   113,
-    37,    38,   112,   114,    60,   114,    62,    44,   112,    94,
-    95,    96,    97,   111,   110,   111,   101,   109,   109,   113,
-   109,   114,   112,   111,   109,   110,   111,   114,    84,    85,
-    86,    87,    88,   117,   117,   120,   112,   419,   119,    94,
-    95,    96,    97,    99,   100,   119,   101,   117,   119,   105,
-   106,   119,   108,   119,   109,   110,   111,   117,   119,   115,
-   117,   119,    99,   100,   112,     3,     4,     5,     6,   113,
-   112,     9,    10,    11,    12,    13,    14,   112,   115,   115,
-   113,    90,   114,   114,   466,   112,   112,   112,   109,    27,
-    28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-    38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-    48,   109,   117,    51,   496,    53,   117,   117,   112,   114,
-   502,    59,    60,    61,    62,   109,   115,    65,    66,    67,
-    68,    69,    70,    71,    72,    76,    77,    78,    79,    80,
-    81,    82,    83,   120,   114,   118,    84,    85,    86,    87,
-    88,    89,   117,     4,     5,   117,     7,     8,   117,   112,
-    98,    99,   100,    14,   113,   112,   118,   112,   112,   120,
-   108,   111,   118,   116,   116,   111,    27,   116,   106,   116,
-    31,    32,    33,    34,    35,    36,    37,    38,    39,   116,
-    41,    42,    43,    44,    45,   116,    25,    48,   117,   119,
-     0,     0,    53,   121,   121,   121,   121,   119,   121,    60,
-    57,    62,    57,    15,    16,    17,    18,    19,    20,    21,
-    22,    23,    24,    25,   349,   447,   260,   294,   306,   215,
-    -1,    -1,    -1,    84,    85,    86,    87,    88,    31,    32,
-    33,    34,    35,    36,    37,    38,   168,    -1,    99,   100,
-    52,    44,    -1,    -1,   105,   106,    -1,   108,    -1,    -1,
-    -1,    -1,    64,    -1,    -1,    -1,    -1,    -1,    -1,    62,
-    31,    32,    33,    34,    35,    36,    37,    38,    -1,    -1,
-    -1,    -1,    -1,    44,    -1,    -1,    -1,    -1,    -1,    -1,
+     2,     3,   450,   268,     6,   268,     8,   268,    10,    11,
+   268,   376,    14,   378,   302,   118,    18,    19,    20,    21,
+    22,   378,   118,    25,    26,    27,    28,    29,   376,    31,
+   378,    91,   376,   350,   378,   483,    38,    39,   355,   376,
+   268,   378,    44,   450,   104,    47,    48,    49,    50,    51,
+   118,    53,   449,   118,   419,    57,    58,    59,    60,    61,
+   325,    63,   325,    65,   325,   121,   376,   325,   378,    14,
+   358,   419,   376,   438,   378,   419,   483,   290,   291,   376,
+    14,   378,   419,   376,   481,   378,   376,   376,   378,   378,
+   438,   107,    14,   268,   438,   118,   376,   325,   378,   464,
+   376,   438,   378,   376,   120,   378,    73,   464,   376,   419,
+   378,   450,    57,    58,   419,   419,   464,   446,    78,    79,
+   464,    81,   419,    57,    58,    14,   419,   464,   438,   419,
+   419,   450,   121,   438,   438,    57,    58,   350,   503,   419,
+   123,   438,   355,   419,   483,   438,   419,   118,   438,   438,
+   325,   419,   119,   120,   464,   503,   350,   118,   438,   503,
+   464,   355,   438,   118,   483,   438,   503,   464,    57,    58,
+   438,   464,   118,   175,   464,   464,   493,   506,   507,   124,
+    73,    74,    75,   118,   464,   450,   106,   450,   464,   450,
+   124,   464,   450,   503,   118,   350,   464,   514,   503,   503,
+   355,   203,   124,   239,   124,   241,   503,   243,    54,   245,
+   503,    57,   350,   503,   503,   251,   118,   355,   483,   118,
+   483,   118,   483,   503,   226,   483,   228,   503,   118,   231,
+   503,   124,   118,   119,   120,   503,    15,    16,    17,    18,
+    19,    20,    21,    22,    23,    24,    25,    26,   250,   118,
+   119,   120,   123,    31,    32,    33,   102,   103,   121,    37,
+    38,   123,   264,   265,   266,   267,    44,     4,     5,   118,
+     7,     8,   120,    52,   118,   311,   118,    14,    35,    36,
+    37,    38,   118,   285,    63,    64,   288,   118,   119,   120,
+    27,   122,    49,    50,    31,    32,    33,    34,    35,    36,
+    37,    38,    39,   118,    41,    42,    43,    44,    45,   118,
+   121,    48,   121,   122,   118,   121,    53,   121,   122,   126,
+   322,    99,   100,    60,   126,    62,   126,    15,    16,    17,
+    18,    19,    20,    21,    22,    23,    24,    25,   119,   120,
+   119,   120,    99,   100,   121,   122,   124,    84,    85,    86,
+    87,    88,    31,    32,    33,    34,    35,    36,    37,    38,
+   362,   363,    99,   100,    52,    44,   126,   127,   105,   106,
+   126,   108,   109,   110,   126,   127,    64,   122,     4,     5,
+   382,     7,     8,    62,    54,    55,    56,   124,    14,    76,
+    77,    78,    79,    80,    81,    82,    83,   121,   122,   505,
+   123,    27,   508,   509,   123,    31,    32,    33,    34,    35,
+    36,    37,    38,    39,   416,    41,    42,    43,    44,    45,
+    99,   100,    48,    94,    95,    96,    97,    53,   121,   122,
+   101,   119,   120,   118,    60,   121,    62,    31,    32,    33,
+    34,    35,    36,    37,    38,   124,   121,   118,   119,   120,
+    44,    92,    93,   455,    73,    74,    75,   120,    84,    85,
+    86,    87,    88,    31,    32,    33,   121,   122,    62,    37,
+    38,   118,   122,    99,   100,   121,    44,   126,   118,   105,
+   106,   126,   108,   109,   110,   128,   128,   123,   126,   123,
+   121,   128,   120,   128,   126,   128,   126,   121,   124,   128,
+   502,   128,   122,   121,   121,    99,   100,   122,   124,    90,
+   118,    73,   123,     3,     4,     5,     6,   123,   121,     9,
+    10,    11,    12,    13,    14,   121,   121,   118,   118,   126,
+   532,    99,   100,   126,   126,   121,   538,    27,    28,    29,
+    30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+    40,    41,    42,    43,    44,    45,    46,    47,    48,   123,
+   118,    51,   129,    53,   124,   126,   123,   121,   127,    59,
+    60,    61,    62,   126,   126,    65,    66,    67,    68,    69,
+    70,    71,    72,   122,   121,   127,   121,   121,   129,   125,
+   120,   120,   125,   125,    84,    85,    86,    87,    88,    89,
+   125,   125,   106,   125,   127,    25,   126,   128,    98,    99,
+   100,   130,   130,   130,   130,   128,   130,     0,   108,   109,
+   110,   111,   112,   113,   114,   115,   116,   117,     4,     5,
+     0,     7,     8,    66,    66,   291,   383,   337,    14,   186,
+   483,   325,   242,    -1,   343,    -1,    -1,    -1,    -1,    -1,
+    -1,    27,    -1,    -1,    -1,    31,    32,    33,    34,    35,
+    36,    37,    38,    39,    -1,    41,    42,    43,    44,    45,
+    -1,    -1,    48,    -1,    -1,    -1,    -1,    53,    94,    95,
+    96,    97,    -1,    -1,    60,   101,    62,    -1,    -1,    -1,
     -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    62,    -1,    -1,    -1,    -1,    99,   100,   110,   111,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,   115,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    99,   100
+    -1,    -1,   118,   119,   120,    -1,    -1,    -1,    84,    85,
+    86,    87,    88,   129,    -1,    -1,    -1,    -1,    -1,    -1,
+    -1,    -1,    -1,    99,   100,    -1,    -1,    -1,    -1,   105,
+   106,    -1,   108,   109,   110
 };
 
 #line 352 "../bison++/bison.cc"
@@ -2082,15 +2153,15 @@ YYLABEL(yyreduce)
 
   switch (yyn) {
 
-case 67:
-#line 242 "SrvParser.y"
+case 76:
+#line 255 "SrvParser.y"
 {
     if (!StartIfaceDeclaration(yyvsp[-1].strval))
 	YYABORT;
 ;
     break;}
-case 68:
-#line 247 "SrvParser.y"
+case 77:
+#line 260 "SrvParser.y"
 {
     //Information about new interface has been read
     //Add it to list of read interfaces
@@ -2098,28 +2169,28 @@ case 68:
     EndIfaceDeclaration();
 ;
     break;}
-case 69:
-#line 255 "SrvParser.y"
+case 78:
+#line 268 "SrvParser.y"
 {
     if (!StartIfaceDeclaration(yyvsp[-1].ival))
 	YYABORT;
 ;
     break;}
-case 70:
-#line 260 "SrvParser.y"
+case 79:
+#line 273 "SrvParser.y"
 {
     EndIfaceDeclaration();
 ;
     break;}
-case 81:
-#line 279 "SrvParser.y"
+case 90:
+#line 292 "SrvParser.y"
 {
     /// this is key object initialization part
     CurrentKey = new TSIGKey(string(yyvsp[-1].strval));
 ;
     break;}
-case 82:
-#line 284 "SrvParser.y"
+case 91:
+#line 297 "SrvParser.y"
 {
     /// check that both secret and algorithm keywords were defined.
     Log(Debug) << "Loaded key '" << CurrentKey->Name_ << "', base64len is "
@@ -2145,41 +2216,41 @@ case 82:
 #endif
 ;
     break;}
-case 89:
-#line 323 "SrvParser.y"
+case 98:
+#line 336 "SrvParser.y"
 {
     // store the key in base64 encoded form
     CurrentKey->setData(string(yyvsp[-1].strval));
 ;
     break;}
-case 90:
-#line 330 "SrvParser.y"
+case 99:
+#line 343 "SrvParser.y"
 {
     CurrentKey->Fudge_ = yyvsp[-1].ival;
 ;
     break;}
-case 91:
-#line 335 "SrvParser.y"
+case 100:
+#line 348 "SrvParser.y"
 { CurrentKey->Digest_ = DIGEST_HMAC_SHA256; ;
     break;}
-case 92:
-#line 336 "SrvParser.y"
+case 101:
+#line 349 "SrvParser.y"
 { CurrentKey->Digest_ = DIGEST_HMAC_SHA1;  ;
     break;}
-case 93:
-#line 337 "SrvParser.y"
+case 102:
+#line 350 "SrvParser.y"
 { CurrentKey->Digest_ = DIGEST_HMAC_MD5;  ;
     break;}
-case 94:
-#line 343 "SrvParser.y"
+case 103:
+#line 356 "SrvParser.y"
 {
     ParserOptStack.append(new TSrvParsGlobalOpt());
     SPtr<TDUID> duid = new TDUID(yyvsp[-1].duidval.duid,yyvsp[-1].duidval.length);
     ClientLst.append(new TSrvCfgOptions(duid));
 ;
     break;}
-case 95:
-#line 349 "SrvParser.y"
+case 104:
+#line 362 "SrvParser.y"
 {
     Log(Debug) << "Exception: DUID-based exception specified." << LogEnd;
     // copy all defined options
@@ -2187,16 +2258,16 @@ case 95:
     ParserOptStack.delLast();
 ;
     break;}
-case 96:
-#line 357 "SrvParser.y"
+case 105:
+#line 370 "SrvParser.y"
 {
     ParserOptStack.append(new TSrvParsGlobalOpt());
     SPtr<TOptVendorData> remoteid = new TOptVendorData(yyvsp[-3].ival, yyvsp[-1].duidval.duid, yyvsp[-1].duidval.length, 0);
     ClientLst.append(new TSrvCfgOptions(remoteid));
 ;
     break;}
-case 97:
-#line 363 "SrvParser.y"
+case 106:
+#line 376 "SrvParser.y"
 {
     Log(Debug) << "Exception: RemoteID-based exception specified." << LogEnd;
     // copy all defined options
@@ -2204,16 +2275,16 @@ case 97:
     ParserOptStack.delLast();
 ;
     break;}
-case 98:
-#line 371 "SrvParser.y"
+case 107:
+#line 384 "SrvParser.y"
 {
 		ParserOptStack.append(new TSrvParsGlobalOpt());
 		SPtr<TIPv6Addr> clntaddr = new TIPv6Addr(yyvsp[-1].addrval);
 		ClientLst.append(new TSrvCfgOptions(clntaddr));
 ;
     break;}
-case 99:
-#line 377 "SrvParser.y"
+case 108:
+#line 390 "SrvParser.y"
 {
 		Log(Debug) << "Exception: Link-local-based exception specified." << LogEnd;
 		// copy all defined options
@@ -2221,86 +2292,86 @@ case 99:
 		ParserOptStack.delLast();
 ;
     break;}
-case 118:
-#line 410 "SrvParser.y"
+case 127:
+#line 423 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     Log(Info) << "Exception: Address " << addr->getPlain() << " reserved." << LogEnd;
     ClientLst.getLast()->setAddr(addr);
 ;
     break;}
-case 119:
-#line 418 "SrvParser.y"
+case 128:
+#line 431 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[-2].addrval);
     Log(Info) << "Exception: Prefix " << addr->getPlain() << "/" << yyvsp[0].ival << " reserved." << LogEnd;
     ClientLst.getLast()->setPrefix(addr, yyvsp[0].ival);
 ;
     break;}
-case 120:
-#line 427 "SrvParser.y"
+case 129:
+#line 440 "SrvParser.y"
 {
     StartClassDeclaration();
 ;
     break;}
-case 121:
-#line 431 "SrvParser.y"
+case 130:
+#line 444 "SrvParser.y"
 {
     if (!EndClassDeclaration())
 	YYABORT;
 ;
     break;}
-case 124:
-#line 445 "SrvParser.y"
+case 133:
+#line 458 "SrvParser.y"
 {
     StartTAClassDeclaration();
 ;
     break;}
-case 125:
-#line 448 "SrvParser.y"
+case 134:
+#line 461 "SrvParser.y"
 {
     if (!EndTAClassDeclaration())
 	YYABORT;
 ;
     break;}
-case 136:
-#line 472 "SrvParser.y"
+case 145:
+#line 485 "SrvParser.y"
 {
     StartPDDeclaration();
 ;
     break;}
-case 137:
-#line 475 "SrvParser.y"
+case 146:
+#line 488 "SrvParser.y"
 {
     if (!EndPDDeclaration())
 	YYABORT;
 ;
     break;}
-case 148:
-#line 502 "SrvParser.y"
+case 157:
+#line 515 "SrvParser.y"
 {
     SPtr<TIPv6Addr> routerAddr = new TIPv6Addr(yyvsp[-1].addrval);
     SPtr<TOpt> myNextHop = new TOptAddr(OPTION_NEXT_HOP, routerAddr, NULL);
     nextHop = myNextHop; 
 ;
     break;}
-case 149:
-#line 508 "SrvParser.y"
+case 158:
+#line 521 "SrvParser.y"
 {
     ParserOptStack.getLast()->addExtraOption(nextHop, false);
     nextHop.reset();
 ;
     break;}
-case 150:
-#line 513 "SrvParser.y"
+case 159:
+#line 526 "SrvParser.y"
 {
     SPtr<TIPv6Addr> routerAddr = new TIPv6Addr(yyvsp[0].addrval);
     SPtr<TOpt> myNextHop = new TOptAddr(OPTION_NEXT_HOP, routerAddr, NULL);
     ParserOptStack.getLast()->addExtraOption(myNextHop, false);
 ;
     break;}
-case 153:
-#line 527 "SrvParser.y"
+case 162:
+#line 540 "SrvParser.y"
 {
     SPtr<TIPv6Addr> prefix = new TIPv6Addr(yyvsp[-4].addrval);
     SPtr<TOpt> rtPrefix = new TOptRtPrefix(yyvsp[0].ival, yyvsp[-2].ival, 42, prefix, NULL);
@@ -2310,8 +2381,8 @@ case 153:
         ParserOptStack.getLast()->addExtraOption(rtPrefix, false);
 ;
     break;}
-case 154:
-#line 536 "SrvParser.y"
+case 163:
+#line 549 "SrvParser.y"
 {
     SPtr<TIPv6Addr> prefix = new TIPv6Addr(yyvsp[-2].addrval);
     SPtr<TOpt> rtPrefix = new TOptRtPrefix(DHCPV6_INFINITY, yyvsp[0].ival, 42, prefix, NULL);
@@ -2321,8 +2392,8 @@ case 154:
         ParserOptStack.getLast()->addExtraOption(rtPrefix, false);
 ;
     break;}
-case 155:
-#line 545 "SrvParser.y"
+case 164:
+#line 558 "SrvParser.y"
 {
     SPtr<TIPv6Addr> prefix = new TIPv6Addr(yyvsp[-4].addrval);
     SPtr<TOpt> rtPrefix = new TOptRtPrefix(DHCPV6_INFINITY, yyvsp[-2].ival, 42, prefix, NULL);
@@ -2332,8 +2403,8 @@ case 155:
         ParserOptStack.getLast()->addExtraOption(rtPrefix, false);
 ;
     break;}
-case 156:
-#line 555 "SrvParser.y"
+case 165:
+#line 568 "SrvParser.y"
 {
 
 #ifndef MOD_DISABLE_AUTH
@@ -2356,15 +2427,15 @@ case 156:
 #endif
 ;
     break;}
-case 157:
-#line 578 "SrvParser.y"
+case 166:
+#line 591 "SrvParser.y"
 {
     Log(Crit) << "auth-algorithm secification is not supported yet." << LogEnd;
     YYABORT;
 ;
     break;}
-case 158:
-#line 584 "SrvParser.y"
+case 167:
+#line 597 "SrvParser.y"
 {
 
 #ifndef MOD_DISABLE_AUTH
@@ -2382,8 +2453,8 @@ case 158:
 
 ;
     break;}
-case 159:
-#line 602 "SrvParser.y"
+case 168:
+#line 615 "SrvParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     CfgMgr->setAuthRealm(std::string(yyvsp[0].strval));
@@ -2392,14 +2463,14 @@ case 159:
 #endif
 ;
     break;}
-case 160:
-#line 612 "SrvParser.y"
+case 169:
+#line 625 "SrvParser.y"
 {
     DigestLst.clear();
 ;
     break;}
-case 161:
-#line 614 "SrvParser.y"
+case 170:
+#line 627 "SrvParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     CfgMgr->setAuthDigests(DigestLst);
@@ -2410,40 +2481,40 @@ case 161:
 #endif
 ;
     break;}
-case 164:
-#line 630 "SrvParser.y"
+case 173:
+#line 643 "SrvParser.y"
 { DigestLst.push_back(DIGEST_NONE); ;
     break;}
-case 165:
-#line 631 "SrvParser.y"
+case 174:
+#line 644 "SrvParser.y"
 { DigestLst.push_back(DIGEST_PLAIN); ;
     break;}
-case 166:
-#line 632 "SrvParser.y"
+case 175:
+#line 645 "SrvParser.y"
 { DigestLst.push_back(DIGEST_HMAC_MD5); ;
     break;}
-case 167:
-#line 633 "SrvParser.y"
+case 176:
+#line 646 "SrvParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA1); ;
     break;}
-case 168:
-#line 634 "SrvParser.y"
+case 177:
+#line 647 "SrvParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA224); ;
     break;}
-case 169:
-#line 635 "SrvParser.y"
+case 178:
+#line 648 "SrvParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA256); ;
     break;}
-case 170:
-#line 636 "SrvParser.y"
+case 179:
+#line 649 "SrvParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA384); ;
     break;}
-case 171:
-#line 637 "SrvParser.y"
+case 180:
+#line 650 "SrvParser.y"
 { DigestLst.push_back(DIGEST_HMAC_SHA512); ;
     break;}
-case 172:
-#line 642 "SrvParser.y"
+case 181:
+#line 655 "SrvParser.y"
 {
 #ifndef MOD_DISABLE_AUTH
     CfgMgr->setAuthDropUnauthenticated(yyvsp[0].ival);
@@ -2452,15 +2523,15 @@ case 172:
 #endif
 ;
     break;}
-case 173:
-#line 660 "SrvParser.y"
+case 182:
+#line 673 "SrvParser.y"
 {
     Log(Notice)<< "FQDN: The client "<<yyvsp[0].strval<<" has no address nor DUID"<<LogEnd;
     PresentFQDNLst.append(new TFQDN(yyvsp[0].strval,false));
 ;
     break;}
-case 174:
-#line 665 "SrvParser.y"
+case 183:
+#line 678 "SrvParser.y"
 {
     /// @todo: Use SPtr()
     TDUID* duidNew = new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length);
@@ -2468,59 +2539,59 @@ case 174:
     PresentFQDNLst.append(new TFQDN(duidNew, yyvsp[-2].strval,false));
 ;
     break;}
-case 175:
-#line 672 "SrvParser.y"
+case 184:
+#line 685 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     Log(Debug)<< "FQDN:" << yyvsp[-2].strval <<" reserved for address "<<*addr<<LogEnd;
     PresentFQDNLst.append(new TFQDN(new TIPv6Addr(yyvsp[0].addrval), yyvsp[-2].strval,false));
 ;
     break;}
-case 176:
-#line 678 "SrvParser.y"
+case 185:
+#line 691 "SrvParser.y"
 {
 	Log(Debug) << "FQDN:"<<yyvsp[0].strval<<" has no reservations (is available to everyone)."<<LogEnd;
     PresentFQDNLst.append(new TFQDN(yyvsp[0].strval,false));
 ;
     break;}
-case 177:
-#line 683 "SrvParser.y"
+case 186:
+#line 696 "SrvParser.y"
 {
     TDUID* duidNew = new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length);
     Log(Debug)<< "FQDN:" << yyvsp[-2].strval << " reserved for DUID "<< duidNew->getPlain() << LogEnd;
     PresentFQDNLst.append(new TFQDN( duidNew, yyvsp[-2].strval,false));
 ;
     break;}
-case 178:
-#line 689 "SrvParser.y"
+case 187:
+#line 702 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     Log(Debug)<< "FQDN:" << yyvsp[-2].strval<<" reserved for address "<< addr->getPlain() << LogEnd;
     PresentFQDNLst.append(new TFQDN(new TIPv6Addr(yyvsp[0].addrval), yyvsp[-2].strval,false));
 ;
     break;}
-case 179:
-#line 697 "SrvParser.y"
+case 188:
+#line 710 "SrvParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 180:
-#line 698 "SrvParser.y"
+case 189:
+#line 711 "SrvParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 181:
-#line 703 "SrvParser.y"
+case 190:
+#line 716 "SrvParser.y"
 {
     PresentAddrLst.append(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 182:
-#line 707 "SrvParser.y"
+case 191:
+#line 720 "SrvParser.y"
 {
     PresentAddrLst.append(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 183:
-#line 714 "SrvParser.y"
+case 192:
+#line 727 "SrvParser.y"
 {
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
 	       << yyvsp[-2].ival << ", valuelen=" << yyvsp[0].duidval.length << LogEnd;
@@ -2529,8 +2600,8 @@ case 183:
 								    yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0), false);
 ;
     break;}
-case 184:
-#line 722 "SrvParser.y"
+case 193:
+#line 735 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[0].addrval));
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
@@ -2539,8 +2610,8 @@ case 184:
 								    new TIPv6Addr(yyvsp[0].addrval), 0), false);
 ;
     break;}
-case 185:
-#line 730 "SrvParser.y"
+case 194:
+#line 743 "SrvParser.y"
 {
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
 	       << yyvsp[-2].ival << ", valuelen=" << strlen(yyvsp[0].strval) << LogEnd;
@@ -2549,8 +2620,8 @@ case 185:
 								    yyvsp[0].strval, 0), false);
 ;
     break;}
-case 186:
-#line 738 "SrvParser.y"
+case 195:
+#line 751 "SrvParser.y"
 {
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
 	       << yyvsp[-2].ival << ", valuelen=" << yyvsp[0].duidval.length << LogEnd;
@@ -2558,8 +2629,8 @@ case 186:
 								    yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0), false);
 ;
     break;}
-case 187:
-#line 745 "SrvParser.y"
+case 196:
+#line 758 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[0].addrval));
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
@@ -2568,8 +2639,8 @@ case 187:
 								    addr, 0), false);
 ;
     break;}
-case 188:
-#line 753 "SrvParser.y"
+case 197:
+#line 766 "SrvParser.y"
 {
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
 	       << yyvsp[-2].ival << ", valuelen=" << strlen(yyvsp[0].strval) << LogEnd;
@@ -2577,22 +2648,22 @@ case 188:
 								    yyvsp[0].strval, 0), false);
 ;
     break;}
-case 189:
-#line 762 "SrvParser.y"
+case 198:
+#line 775 "SrvParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 190:
-#line 763 "SrvParser.y"
+case 199:
+#line 776 "SrvParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 191:
-#line 768 "SrvParser.y"
+case 200:
+#line 781 "SrvParser.y"
 {
 	PresentRangeLst.append(new THostRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
     ;
     break;}
-case 192:
-#line 772 "SrvParser.y"
+case 201:
+#line 785 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
 	SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2602,8 +2673,8 @@ case 192:
 	    PresentRangeLst.append(new THostRange(addr2,addr1));
     ;
     break;}
-case 193:
-#line 781 "SrvParser.y"
+case 202:
+#line 794 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[-2].addrval));
 	int prefix = yyvsp[0].ival;
@@ -2620,14 +2691,14 @@ case 193:
 	    PresentRangeLst.append(new THostRange(addr2,addr1));
     ;
     break;}
-case 194:
-#line 797 "SrvParser.y"
+case 203:
+#line 810 "SrvParser.y"
 {
 	PresentRangeLst.append(new THostRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
     ;
     break;}
-case 195:
-#line 801 "SrvParser.y"
+case 204:
+#line 814 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
 	SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2637,8 +2708,8 @@ case 195:
 	    PresentRangeLst.append(new THostRange(addr2,addr1));
     ;
     break;}
-case 196:
-#line 813 "SrvParser.y"
+case 205:
+#line 826 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[-2].addrval));
 	int prefix = yyvsp[0].ival;
@@ -2659,14 +2730,14 @@ case 196:
 	PDLst.append(range);
     ;
     break;}
-case 197:
-#line 836 "SrvParser.y"
+case 206:
+#line 849 "SrvParser.y"
 {
     PresentRangeLst.append(new THostRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
 ;
     break;}
-case 198:
-#line 840 "SrvParser.y"
+case 207:
+#line 853 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
     SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2676,14 +2747,14 @@ case 198:
 	PresentRangeLst.append(new THostRange(addr2,addr1));
 ;
     break;}
-case 199:
-#line 849 "SrvParser.y"
+case 208:
+#line 862 "SrvParser.y"
 {
     PresentRangeLst.append(new THostRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
 ;
     break;}
-case 200:
-#line 853 "SrvParser.y"
+case 209:
+#line 866 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
     SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2693,16 +2764,16 @@ case 200:
 	PresentRangeLst.append(new THostRange(addr2,addr1));
 ;
     break;}
-case 201:
-#line 862 "SrvParser.y"
+case 210:
+#line 875 "SrvParser.y"
 {
     SPtr<TDUID> duid(new TDUID(yyvsp[0].duidval.duid, yyvsp[0].duidval.length));
     PresentRangeLst.append(new THostRange(duid, duid));
     delete yyvsp[0].duidval.duid;
 ;
     break;}
-case 202:
-#line 868 "SrvParser.y"
+case 211:
+#line 881 "SrvParser.y"
 {
     SPtr<TDUID> duid1(new TDUID(yyvsp[-2].duidval.duid,yyvsp[-2].duidval.length));
     SPtr<TDUID> duid2(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length));
@@ -2715,16 +2786,16 @@ case 202:
     /// @todo: delete [] $1.duid; delete [] $3.duid?
 ;
     break;}
-case 203:
-#line 880 "SrvParser.y"
+case 212:
+#line 893 "SrvParser.y"
 {
     SPtr<TDUID> duid(new TDUID(yyvsp[0].duidval.duid, yyvsp[0].duidval.length));
     PresentRangeLst.append(new THostRange(duid, duid));
     delete yyvsp[0].duidval.duid;
 ;
     break;}
-case 204:
-#line 886 "SrvParser.y"
+case 213:
+#line 899 "SrvParser.y"
 {
     SPtr<TDUID> duid2(new TDUID(yyvsp[-2].duidval.duid,yyvsp[-2].duidval.length));
     SPtr<TDUID> duid1(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length));
@@ -2736,55 +2807,55 @@ case 204:
     delete yyvsp[0].duidval.duid;
 ;
     break;}
-case 205:
-#line 900 "SrvParser.y"
+case 214:
+#line 913 "SrvParser.y"
 {
     PresentRangeLst.clear();
 ;
     break;}
-case 206:
-#line 903 "SrvParser.y"
+case 215:
+#line 916 "SrvParser.y"
 {
     ParserOptStack.getLast()->setRejedClnt(&PresentRangeLst);
 ;
     break;}
-case 207:
-#line 910 "SrvParser.y"
+case 216:
+#line 923 "SrvParser.y"
 {
     PresentRangeLst.clear();
 ;
     break;}
-case 208:
-#line 913 "SrvParser.y"
+case 217:
+#line 926 "SrvParser.y"
 {
     ParserOptStack.getLast()->setAcceptClnt(&PresentRangeLst);
 ;
     break;}
-case 209:
-#line 920 "SrvParser.y"
+case 218:
+#line 933 "SrvParser.y"
 {
     PresentRangeLst.clear();
 ;
     break;}
-case 210:
-#line 923 "SrvParser.y"
+case 219:
+#line 936 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPool(&PresentRangeLst);
 ;
     break;}
-case 211:
-#line 930 "SrvParser.y"
+case 220:
+#line 943 "SrvParser.y"
 {
 ;
     break;}
-case 212:
-#line 932 "SrvParser.y"
+case 221:
+#line 945 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPool(&PresentRangeLst/*PDList*/);
 ;
     break;}
-case 213:
-#line 938 "SrvParser.y"
+case 222:
+#line 951 "SrvParser.y"
 {
     if ( ((yyvsp[0].ival) > 128) || ((yyvsp[0].ival) < 1) ) {
         Log(Crit) << "Invalid pd-length:" << yyvsp[0].ival << ", allowed range is 1..128."
@@ -2794,36 +2865,36 @@ case 213:
    this->PDPrefix = yyvsp[0].ival;
 ;
     break;}
-case 214:
-#line 950 "SrvParser.y"
+case 223:
+#line 963 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPrefBeg(yyvsp[0].ival);
     ParserOptStack.getLast()->setPrefEnd(yyvsp[0].ival);
 ;
     break;}
-case 215:
-#line 955 "SrvParser.y"
+case 224:
+#line 968 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPrefBeg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setPrefEnd(yyvsp[0].ival);
 ;
     break;}
-case 216:
-#line 963 "SrvParser.y"
+case 225:
+#line 976 "SrvParser.y"
 {
     ParserOptStack.getLast()->setValidBeg(yyvsp[0].ival);
     ParserOptStack.getLast()->setValidEnd(yyvsp[0].ival);
 ;
     break;}
-case 217:
-#line 968 "SrvParser.y"
+case 226:
+#line 981 "SrvParser.y"
 {
     ParserOptStack.getLast()->setValidBeg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setValidEnd(yyvsp[0].ival);
 ;
     break;}
-case 218:
-#line 976 "SrvParser.y"
+case 227:
+#line 989 "SrvParser.y"
 {
     int x=yyvsp[0].ival;
     if ( (x<1) || (x>1000)) {
@@ -2834,48 +2905,48 @@ case 218:
     ParserOptStack.getLast()->setShare(x);
 ;
     break;}
-case 219:
-#line 988 "SrvParser.y"
+case 228:
+#line 1001 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT1Beg(yyvsp[0].ival);
     ParserOptStack.getLast()->setT1End(yyvsp[0].ival);
 ;
     break;}
-case 220:
-#line 993 "SrvParser.y"
+case 229:
+#line 1006 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT1Beg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setT1End(yyvsp[0].ival);
 ;
     break;}
-case 221:
-#line 1001 "SrvParser.y"
+case 230:
+#line 1014 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT2Beg(yyvsp[0].ival);
     ParserOptStack.getLast()->setT2End(yyvsp[0].ival);
 ;
     break;}
-case 222:
-#line 1006 "SrvParser.y"
+case 231:
+#line 1019 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT2Beg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setT2End(yyvsp[0].ival);
 ;
     break;}
-case 223:
-#line 1014 "SrvParser.y"
+case 232:
+#line 1027 "SrvParser.y"
 {
     ParserOptStack.getLast()->setClntMaxLease(yyvsp[0].ival);
 ;
     break;}
-case 224:
-#line 1021 "SrvParser.y"
+case 233:
+#line 1034 "SrvParser.y"
 {
     ParserOptStack.getLast()->setClassMaxLease(yyvsp[0].ival);
 ;
     break;}
-case 225:
-#line 1028 "SrvParser.y"
+case 234:
+#line 1041 "SrvParser.y"
 {
     if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental 'addr-params' defined, but experimental "
@@ -2889,16 +2960,16 @@ case 225:
     ParserOptStack.getLast()->setAddrParams(yyvsp[0].ival,bitfield);
 ;
     break;}
-case 226:
-#line 1043 "SrvParser.y"
+case 235:
+#line 1056 "SrvParser.y"
 {
     SPtr<TOpt> tunnelName = new TOptDomainLst(OPTION_AFTR_NAME, yyvsp[0].strval, 0);
     Log(Debug) << "Enabling DS-Lite tunnel option, AFTR name=" << yyvsp[0].strval << LogEnd;
     ParserOptStack.getLast()->addExtraOption(tunnelName, false);
 ;
     break;}
-case 227:
-#line 1051 "SrvParser.y"
+case 236:
+#line 1064 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptGeneric(yyvsp[-2].ival, yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0);
     ParserOptStack.getLast()->addExtraOption(opt, false);
@@ -2906,8 +2977,8 @@ case 227:
                << yyvsp[0].duidval.length << LogEnd;
 ;
     break;}
-case 228:
-#line 1058 "SrvParser.y"
+case 237:
+#line 1071 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[0].addrval));
 
@@ -2916,14 +2987,14 @@ case 228:
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", address=" << addr->getPlain() << LogEnd;
 ;
     break;}
-case 229:
-#line 1066 "SrvParser.y"
+case 238:
+#line 1079 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 230:
-#line 1069 "SrvParser.y"
+case 239:
+#line 1082 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptAddrLst(yyvsp[-3].ival, PresentAddrLst, 0);
     ParserOptStack.getLast()->addExtraOption(opt, false);
@@ -2931,16 +3002,16 @@ case 230:
                << PresentAddrLst.count() << LogEnd;
 ;
     break;}
-case 231:
-#line 1076 "SrvParser.y"
+case 240:
+#line 1089 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptString(yyvsp[-2].ival, string(yyvsp[0].strval), 0);
     ParserOptStack.getLast()->addExtraOption(opt, false);
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", string=" << yyvsp[0].strval << LogEnd;
 ;
     break;}
-case 232:
-#line 1084 "SrvParser.y"
+case 241:
+#line 1097 "SrvParser.y"
 {
     if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental 'remote autoconf neighbors' defined, but "
@@ -2952,8 +3023,8 @@ case 232:
     PresentAddrLst.clear();
 ;
     break;}
-case 233:
-#line 1094 "SrvParser.y"
+case 242:
+#line 1107 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptAddrLst(OPTION_NEIGHBORS, PresentAddrLst, 0);
     ParserOptStack.getLast()->addExtraOption(opt, false);
@@ -2961,26 +3032,26 @@ case 233:
 	       << " neighbors defined.)" << LogEnd;
 ;
     break;}
-case 234:
-#line 1104 "SrvParser.y"
+case 243:
+#line 1117 "SrvParser.y"
 {
     ParserOptStack.getLast()->setIfaceMaxLease(yyvsp[0].ival);
 ;
     break;}
-case 235:
-#line 1111 "SrvParser.y"
+case 244:
+#line 1124 "SrvParser.y"
 {
     ParserOptStack.getLast()->setUnicast(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 236:
-#line 1118 "SrvParser.y"
+case 245:
+#line 1131 "SrvParser.y"
 {
     CfgMgr->dropUnicast(true);
 ;
     break;}
-case 237:
-#line 1124 "SrvParser.y"
+case 246:
+#line 1137 "SrvParser.y"
 {
     if ( (yyvsp[0].ival!=0) && (yyvsp[0].ival!=1)) {
 	Log(Crit) << "RAPID-COMMIT  parameter in line " << lex->lineno()
@@ -2993,8 +3064,8 @@ case 237:
 	ParserOptStack.getLast()->setRapidCommit(false);
 ;
     break;}
-case 238:
-#line 1139 "SrvParser.y"
+case 247:
+#line 1152 "SrvParser.y"
 {
     if ((yyvsp[0].ival<0)||(yyvsp[0].ival>255)) {
 	Log(Crit) << "Preference value (" << yyvsp[0].ival << ") in line " << lex->lineno()
@@ -3004,58 +3075,214 @@ case 238:
     ParserOptStack.getLast()->setPreference(yyvsp[0].ival);
 ;
     break;}
-case 239:
-#line 1150 "SrvParser.y"
+case 248:
+#line 1164 "SrvParser.y"
+{
+    if (yyvsp[0].ival && (yyvsp[0].ival < MAX_RT_OPTION_MIN || yyvsp[0].ival > MAX_RT_OPTION_MAX)) {
+	Log(Crit) << "SOL_MAX_RT value (" << yyvsp[0].ival << ") in line " << lex->lineno()
+		   << " is out of range [" << MAX_RT_OPTION_MIN << ".." << MAX_RT_OPTION_MAX
+		   << "] (or 0 to disable)." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setSolMaxRT(yyvsp[0].ival);
+;
+    break;}
+case 249:
+#line 1177 "SrvParser.y"
+{
+    if (yyvsp[0].ival && (yyvsp[0].ival < MAX_RT_OPTION_MIN || yyvsp[0].ival > MAX_RT_OPTION_MAX)) {
+	Log(Crit) << "INF_MAX_RT value (" << yyvsp[0].ival << ") in line " << lex->lineno()
+		   << " is out of range [" << MAX_RT_OPTION_MIN << ".." << MAX_RT_OPTION_MAX
+		   << "] (or 0 to disable)." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setInfMaxRT(yyvsp[0].ival);
+;
+    break;}
+case 250:
+#line 1189 "SrvParser.y"
 {
     logger::setLogLevel(yyvsp[0].ival);
 ;
     break;}
-case 240:
-#line 1156 "SrvParser.y"
+case 251:
+#line 1195 "SrvParser.y"
 {
     logger::setLogMode(yyvsp[0].strval);
 ;
     break;}
-case 241:
-#line 1162 "SrvParser.y"
+case 252:
+#line 1201 "SrvParser.y"
 {
     logger::setLogName(yyvsp[0].strval);
 ;
     break;}
-case 242:
-#line 1169 "SrvParser.y"
+case 253:
+#line 1208 "SrvParser.y"
 {
     logger::setColors(yyvsp[0].ival==1);
 ;
     break;}
-case 243:
-#line 1175 "SrvParser.y"
+case 254:
+#line 1214 "SrvParser.y"
 {
     ParserOptStack.getLast()->setWorkDir(yyvsp[0].strval);
 ;
     break;}
-case 244:
-#line 1182 "SrvParser.y"
+case 255:
+#line 1221 "SrvParser.y"
 {
     ParserOptStack.getLast()->setStateless(true);
 ;
     break;}
-case 245:
-#line 1189 "SrvParser.y"
+case 256:
+#line 1228 "SrvParser.y"
 {
     Log(Info) << "Guess-mode enabled: relay interfaces may be loosely "
               << "defined (matching interface-id is not mandatory)." << LogEnd;
     ParserOptStack.getLast()->setGuessMode(true);
 ;
     break;}
-case 246:
-#line 1197 "SrvParser.y"
+case 257:
+#line 1236 "SrvParser.y"
 {
     CfgMgr->setScriptName(yyvsp[0].strval);
 ;
     break;}
-case 247:
-#line 1203 "SrvParser.y"
+case 258:
+#line 1242 "SrvParser.y"
+{
+    Log(Debug) << "Rejected clients are remembered for " << yyvsp[0].ival << " second(s)." << LogEnd;
+    CfgMgr->getRejectCache().setLimits(yyvsp[0].ival, SERVER_DEFAULT_REJECT_CACHE_SIZE);
+;
+    break;}
+case 259:
+#line 1247 "SrvParser.y"
+{
+    Log(Debug) << "Up to " << yyvsp[0].ival << " rejected clients are remembered for " << yyvsp[-1].ival
+               << " second(s)." << LogEnd;
+    CfgMgr->getRejectCache().setLimits(yyvsp[-1].ival, yyvsp[0].ival);
+;
+    break;}
+case 260:
+#line 1255 "SrvParser.y"
+{
+    Log(Debug) << "Replies are remembered for " << yyvsp[0].ival << " second(s)." << LogEnd;
+    CfgMgr->setReplyCache(yyvsp[0].ival, SERVER_DEFAULT_REPLY_CACHE_SIZE);
+;
+    break;}
+case 261:
+#line 1260 "SrvParser.y"
+{
+    Log(Debug) << "Up to " << yyvsp[0].ival << " replies are remembered for " << yyvsp[-1].ival
+               << " second(s)." << LogEnd;
+    CfgMgr->setReplyCache(yyvsp[-1].ival, yyvsp[0].ival);
+;
+    break;}
+case 262:
+#line 1268 "SrvParser.y"
+{
+    Log(Debug) << "Replies to RENEW/REBIND are kept as templates for up to " << yyvsp[0].ival
+               << " client(s)." << LogEnd;
+    CfgMgr->setRenewTemplates(yyvsp[0].ival);
+;
+    break;}
+case 263:
+#line 1276 "SrvParser.y"
+{
+    Log(Debug) << "Temporary address leases will not be stored in the lease database." << LogEnd;
+    CfgMgr->setTAMemoryOnly(true);
+;
+    break;}
+case 264:
+#line 1283 "SrvParser.y"
+{
+    Log(Debug) << "Declined addresses are not used for " << yyvsp[0].ival << " second(s)." << LogEnd;
+    CfgMgr->setDeclineQuarantine(yyvsp[0].ival, SERVER_DEFAULT_DECLINE_MAX_SHARE);
+;
+    break;}
+case 265:
+#line 1288 "SrvParser.y"
+{
+    if (yyvsp[0].ival > 100) {
+        Log(Crit) << "Invalid decline-quarantine share " << yyvsp[0].ival << "% (line " << lex->lineno()
+                  << "), allowed range is 0-100." << LogEnd;
+        YYABORT;
+    }
+    Log(Debug) << "Declined addresses are not used for " << yyvsp[-1].ival << " second(s), up to "
+               << yyvsp[0].ival << "% of a pool." << LogEnd;
+    CfgMgr->setDeclineQuarantine(yyvsp[-1].ival, yyvsp[0].ival);
+;
+    break;}
+case 266:
+#line 1301 "SrvParser.y"
+{
+    addr = new TIPv6Addr(yyvsp[-1].addrval);
+    Log(Debug) << "Leases are synchronized with partner " << addr->getPlain() << "." << LogEnd;
+    CfgMgr->setLeaseSync(addr, yyvsp[-2].ival, 0);
+;
+    break;}
+case 267:
+#line 1307 "SrvParser.y"
+{
+    if (!yyvsp[-1].ival || yyvsp[-1].ival > 65535) {
+        Log(Crit) << "Invalid lease-sync port " << yyvsp[-1].ival << " (line " << lex->lineno()
+                  << "), allowed range is 1-65535." << LogEnd;
+        YYABORT;
+    }
+    addr = new TIPv6Addr(yyvsp[-2].addrval);
+    Log(Debug) << "Leases are synchronized with partner " << addr->getPlain()
+               << ", port " << yyvsp[-1].ival << "." << LogEnd;
+    CfgMgr->setLeaseSync(addr, yyvsp[-3].ival, yyvsp[-1].ival);
+;
+    break;}
+case 269:
+#line 1322 "SrvParser.y"
+{
+    // base64 encoded, just like TSIG key secrets
+    TSIGKey key("lease-sync");
+    string secret;
+    if (key.setData(string(yyvsp[0].strval)))
+        secret = key.getPackedData();
+    if (secret.empty()) {
+        Log(Crit) << "Invalid lease-sync secret (line " << lex->lineno()
+                  << "), base64 encoded secret expected." << LogEnd;
+        YYABORT;
+    }
+    CfgMgr->setLeaseSyncSecret(TKey(secret.begin(), secret.end()));
+    Log(Debug) << "Lease sync partners authenticate with a " << secret.length()
+               << " byte(s) long secret." << LogEnd;
+;
+    break;}
+case 270:
+#line 1340 "SrvParser.y"
+{
+    if (!strcasecmp(yyvsp[0].strval, "primary")) {
+        yyval.ival = 1;
+    } else if (!strcasecmp(yyvsp[0].strval, "secondary")) {
+        yyval.ival = 0;
+    } else {
+        Log(Crit) << "Invalid lease-sync role " << yyvsp[0].strval << " (line " << lex->lineno()
+                  << "), primary or secondary expected." << LogEnd;
+        YYABORT;
+    }
+;
+    break;}
+case 271:
+#line 1354 "SrvParser.y"
+{
+    if (yyvsp[0].ival < 0 || yyvsp[0].ival > SERVER_MAX_LEASE_REUSE) {
+	Log(Crit) << "Lease reuse threshold (" << yyvsp[0].ival << ") in line " << lex->lineno()
+		   << " is out of range [0.." << SERVER_MAX_LEASE_REUSE << "]." << LogEnd;
+	YYABORT;
+    }
+    Log(Debug) << "Leases renewed before " << yyvsp[0].ival << "% of valid lifetime elapsed will be reused."
+               << LogEnd;
+    CfgMgr->setLeaseReuse(yyvsp[0].ival);
+;
+    break;}
+case 272:
+#line 1367 "SrvParser.y"
 {
     if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental 'performance-mode' defined, but experimental "
@@ -3067,8 +3294,8 @@ case 247:
     CfgMgr->setPerformanceMode(yyvsp[0].ival);
 ;
     break;}
-case 248:
-#line 1216 "SrvParser.y"
+case 273:
+#line 1380 "SrvParser.y"
 {
     switch (yyvsp[0].ival) {
     case 0:
@@ -3082,21 +3309,21 @@ case 248:
     }
 ;
     break;}
-case 249:
-#line 1232 "SrvParser.y"
+case 274:
+#line 1396 "SrvParser.y"
 {
     ParserOptStack.getLast()->setInactiveMode(true);
 ;
     break;}
-case 250:
-#line 1238 "SrvParser.y"
+case 275:
+#line 1402 "SrvParser.y"
 {
     Log(Crit) << "Experimental features are allowed." << LogEnd;
     ParserOptStack.getLast()->setExperimental(true);
 ;
     break;}
-case 251:
-#line 1245 "SrvParser.y"
+case 276:
+#line 1409 "SrvParser.y"
 {
     if (!strncasecmp(yyvsp[0].strval,"before",6))
     {
@@ -3117,21 +3344,21 @@ case 251:
     }
 ;
     break;}
-case 252:
-#line 1267 "SrvParser.y"
+case 277:
+#line 1431 "SrvParser.y"
 {
     ParserOptStack.getLast()->setCacheSize(yyvsp[0].ival);
 ;
     break;}
-case 253:
-#line 1278 "SrvParser.y"
+case 278:
+#line 1442 "SrvParser.y"
 {
     ParserOptStack.getLast()->setLeaseQuerySupport(true);
 
 ;
     break;}
-case 254:
-#line 1283 "SrvParser.y"
+case 279:
+#line 1447 "SrvParser.y"
 {
     switch (yyvsp[0].ival) {
     case 0:
@@ -3147,8 +3374,8 @@ case 254:
     }
 ;
     break;}
-case 255:
-#line 1300 "SrvParser.y"
+case 280:
+#line 1464 "SrvParser.y"
 {
     if (yyvsp[0].ival!=0 && yyvsp[0].ival!=1) {
 	Log(Error) << "Invalid bulk-leasequery-accept value: " << (yyvsp[0].ival)
@@ -3158,59 +3385,59 @@ case 255:
     CfgMgr->bulkLQAccept( (bool) yyvsp[0].ival);
 ;
     break;}
-case 256:
-#line 1311 "SrvParser.y"
+case 281:
+#line 1475 "SrvParser.y"
 {
     CfgMgr->bulkLQTcpPort( yyvsp[0].ival );
 ;
     break;}
-case 257:
-#line 1317 "SrvParser.y"
+case 282:
+#line 1481 "SrvParser.y"
 {
     CfgMgr->bulkLQMaxConns( yyvsp[0].ival );
 ;
     break;}
-case 258:
-#line 1323 "SrvParser.y"
+case 283:
+#line 1487 "SrvParser.y"
 {
     CfgMgr->bulkLQTimeout( yyvsp[0].ival );
 ;
     break;}
-case 259:
-#line 1332 "SrvParser.y"
+case 284:
+#line 1496 "SrvParser.y"
 {
     ParserOptStack.getLast()->setRelayName(yyvsp[0].strval);
 ;
     break;}
-case 260:
-#line 1336 "SrvParser.y"
+case 285:
+#line 1500 "SrvParser.y"
 {
     ParserOptStack.getLast()->setRelayID(yyvsp[0].ival);
 ;
     break;}
-case 261:
-#line 1343 "SrvParser.y"
+case 286:
+#line 1507 "SrvParser.y"
 {
     SPtr<TSrvOptInterfaceID> id = new TSrvOptInterfaceID(yyvsp[0].ival, 0);
     ParserOptStack.getLast()->setRelayInterfaceID(id);
 ;
     break;}
-case 262:
-#line 1348 "SrvParser.y"
+case 287:
+#line 1512 "SrvParser.y"
 {
     SPtr<TSrvOptInterfaceID> id = new TSrvOptInterfaceID(yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0);
     ParserOptStack.getLast()->setRelayInterfaceID(id);
 ;
     break;}
-case 263:
-#line 1353 "SrvParser.y"
+case 288:
+#line 1517 "SrvParser.y"
 {
     SPtr<TSrvOptInterfaceID> id = new TSrvOptInterfaceID(yyvsp[0].strval, strlen(yyvsp[0].strval), 0);
     ParserOptStack.getLast()->setRelayInterfaceID(id);
 ;
     break;}
-case 264:
-#line 1361 "SrvParser.y"
+case 289:
+#line 1525 "SrvParser.y"
 {
     int prefix = yyvsp[0].ival;
     if ( (prefix<1) || (prefix>128) ) {
@@ -3225,8 +3452,8 @@ case 264:
                << " on " << SrvCfgIfaceLst.getLast()->getFullName() << LogEnd;
 ;
     break;}
-case 265:
-#line 1374 "SrvParser.y"
+case 290:
+#line 1538 "SrvParser.y"
 {
     SPtr<TIPv6Addr> min = new TIPv6Addr(yyvsp[-2].addrval);
     SPtr<TIPv6Addr> max = new TIPv6Addr(yyvsp[0].addrval);
@@ -3235,8 +3462,8 @@ case 265:
                << "on " << SrvCfgIfaceLst.getLast()->getFullName() << LogEnd;
 ;
     break;}
-case 278:
-#line 1399 "SrvParser.y"
+case 303:
+#line 1563 "SrvParser.y"
 {
     SPtr<TSrvCfgClientClass> clntClass;
     bool found = false;
@@ -3264,8 +3491,8 @@ case 278:
 
 ;
     break;}
-case 279:
-#line 1428 "SrvParser.y"
+case 304:
+#line 1592 "SrvParser.y"
 {
     SPtr<TSrvCfgClientClass> clntClass;
     bool found = false;
@@ -3293,84 +3520,84 @@ case 279:
 
 ;
     break;}
-case 280:
-#line 1461 "SrvParser.y"
+case 305:
+#line 1625 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 281:
-#line 1464 "SrvParser.y"
+case 306:
+#line 1628 "SrvParser.y"
 {
     SPtr<TOpt> nis_servers = new TOptAddrLst(OPTION_DNS_SERVERS, PresentAddrLst, NULL);
     ParserOptStack.getLast()->addExtraOption(nis_servers, false);
 ;
     break;}
-case 282:
-#line 1474 "SrvParser.y"
+case 307:
+#line 1638 "SrvParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 283:
-#line 1477 "SrvParser.y"
+case 308:
+#line 1641 "SrvParser.y"
 {
     SPtr<TOpt> domains = new TOptDomainLst(OPTION_DOMAIN_LIST, PresentStringLst, NULL);
     ParserOptStack.getLast()->addExtraOption(domains, false);
 ;
     break;}
-case 284:
-#line 1488 "SrvParser.y"
+case 309:
+#line 1652 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 285:
-#line 1491 "SrvParser.y"
+case 310:
+#line 1655 "SrvParser.y"
 {
     SPtr<TOpt> ntp_servers = new TOptAddrLst(OPTION_SNTP_SERVERS, PresentAddrLst, NULL);
     ParserOptStack.getLast()->addExtraOption(ntp_servers, false);
     // ParserOptStack.getLast()->setNTPServerLst(&PresentAddrLst);
 ;
     break;}
-case 286:
-#line 1503 "SrvParser.y"
+case 311:
+#line 1667 "SrvParser.y"
 {
     SPtr<TOpt> timezone = new TOptString(OPTION_NEW_TZDB_TIMEZONE, string(yyvsp[0].strval), NULL);
     ParserOptStack.getLast()->addExtraOption(timezone, false);
     // ParserOptStack.getLast()->setTimezone($3);
 ;
     break;}
-case 287:
-#line 1514 "SrvParser.y"
+case 312:
+#line 1678 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 288:
-#line 1517 "SrvParser.y"
+case 313:
+#line 1681 "SrvParser.y"
 {
     SPtr<TOpt> sip_servers = new TOptAddrLst(OPTION_SIP_SERVER_A, PresentAddrLst, NULL);
     ParserOptStack.getLast()->addExtraOption(sip_servers, false);
     // ParserOptStack.getLast()->setSIPServerLst(&PresentAddrLst);
 ;
     break;}
-case 289:
-#line 1528 "SrvParser.y"
+case 314:
+#line 1692 "SrvParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 290:
-#line 1531 "SrvParser.y"
+case 315:
+#line 1695 "SrvParser.y"
 {
     SPtr<TOpt> sip_domains = new TOptDomainLst(OPTION_SIP_SERVER_D, PresentStringLst, NULL);
     ParserOptStack.getLast()->addExtraOption(sip_domains, false);
     //ParserOptStack.getLast()->setSIPDomainLst(&PresentStringLst);
 ;
     break;}
-case 291:
-#line 1544 "SrvParser.y"
+case 316:
+#line 1708 "SrvParser.y"
 {
     PresentFQDNLst.clear();
     Log(Debug)   << "No FQDNMode found, setting default mode 2 (all updates "
@@ -3381,14 +3608,14 @@ case 291:
     ParserOptStack.getLast()->setRevDNSZoneRootLength(0);
 ;
     break;}
-case 292:
-#line 1553 "SrvParser.y"
+case 317:
+#line 1717 "SrvParser.y"
 {
     ParserOptStack.getLast()->setFQDNLst(&PresentFQDNLst);
 ;
     break;}
-case 293:
-#line 1557 "SrvParser.y"
+case 318:
+#line 1721 "SrvParser.y"
 {
     PresentFQDNLst.clear();
     Log(Debug)  << "FQDN: Setting update mode to " << yyvsp[0].ival;
@@ -3412,15 +3639,15 @@ case 293:
     ParserOptStack.getLast()->setRevDNSZoneRootLength(0);
 ;
     break;}
-case 294:
-#line 1579 "SrvParser.y"
+case 319:
+#line 1743 "SrvParser.y"
 {
     ParserOptStack.getLast()->setFQDNLst(&PresentFQDNLst);
 
 ;
     break;}
-case 295:
-#line 1584 "SrvParser.y"
+case 320:
+#line 1748 "SrvParser.y"
 {
     PresentFQDNLst.clear();
     Log(Debug) << "FQDN: Setting update mode to " << yyvsp[-1].ival;
@@ -3450,39 +3677,39 @@ case 295:
     ParserOptStack.getLast()->setRevDNSZoneRootLength(yyvsp[0].ival);
 ;
     break;}
-case 296:
-#line 1612 "SrvParser.y"
+case 321:
+#line 1776 "SrvParser.y"
 {
     ParserOptStack.getLast()->setFQDNLst(&PresentFQDNLst);
 
 ;
     break;}
-case 297:
-#line 1620 "SrvParser.y"
+case 322:
+#line 1784 "SrvParser.y"
 {
     ParserOptStack.getLast()->setUnknownFQDN(EUnknownFQDNMode(yyvsp[-1].ival), string(yyvsp[0].strval) );
     Log(Debug) << "FQDN: Unknown fqdn names processing set to " << yyvsp[-1].ival
                << ", domain=" << yyvsp[0].strval << "." << LogEnd;
 ;
     break;}
-case 298:
-#line 1626 "SrvParser.y"
+case 323:
+#line 1790 "SrvParser.y"
 {
     ParserOptStack.getLast()->setUnknownFQDN(EUnknownFQDNMode(yyvsp[0].ival), string("") );
     Log(Debug) << "FQDN: Unknown fqdn names processing set to " << yyvsp[0].ival
                << ", no domain." << LogEnd;
 ;
     break;}
-case 299:
-#line 1635 "SrvParser.y"
+case 324:
+#line 1799 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     CfgMgr->setDDNSAddress(addr);
     Log(Info) << "FQDN: DDNS updates will be performed to " << addr->getPlain() << "." << LogEnd;
 ;
     break;}
-case 300:
-#line 1643 "SrvParser.y"
+case 325:
+#line 1807 "SrvParser.y"
 {
     if (!strcasecmp(yyvsp[0].strval,"tcp"))
 	CfgMgr->setDDNSProtocol(TCfgMgr::DNSUPDATE_TCP);
@@ -3498,58 +3725,58 @@ case 300:
     Log(Debug) << "DDNS: Setting protocol to " << (yyvsp[0].strval) << LogEnd;
 ;
     break;}
-case 301:
-#line 1660 "SrvParser.y"
+case 326:
+#line 1824 "SrvParser.y"
 {
     Log(Debug) << "DDNS: Setting timeout to " << yyvsp[0].ival << "ms." << LogEnd;
     CfgMgr->setDDNSTimeout(yyvsp[0].ival);
 ;
     break;}
-case 302:
-#line 1669 "SrvParser.y"
+case 327:
+#line 1833 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 303:
-#line 1672 "SrvParser.y"
+case 328:
+#line 1836 "SrvParser.y"
 {
     SPtr<TOpt> nis_servers = new TOptAddrLst(OPTION_NIS_SERVERS, PresentAddrLst, NULL);
     ParserOptStack.getLast()->addExtraOption(nis_servers, false);
     ///ParserOptStack.getLast()->setNISServerLst(&PresentAddrLst);
 ;
     break;}
-case 304:
-#line 1683 "SrvParser.y"
+case 329:
+#line 1847 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 305:
-#line 1686 "SrvParser.y"
+case 330:
+#line 1850 "SrvParser.y"
 {
     SPtr<TOpt> nisp_servers = new TOptAddrLst(OPTION_NISP_SERVERS, PresentAddrLst, NULL);
     ParserOptStack.getLast()->addExtraOption(nisp_servers, false);
     // ParserOptStack.getLast()->setNISPServerLst(&PresentAddrLst);
 ;
     break;}
-case 306:
-#line 1698 "SrvParser.y"
+case 331:
+#line 1862 "SrvParser.y"
 {
     SPtr<TOpt> nis_domain = new TOptDomainLst(OPTION_NIS_DOMAIN_NAME, string(yyvsp[0].strval), NULL);
     ParserOptStack.getLast()->addExtraOption(nis_domain, false);
     // ParserOptStack.getLast()->setNISDomain($3);
 ;
     break;}
-case 307:
-#line 1710 "SrvParser.y"
+case 332:
+#line 1874 "SrvParser.y"
 {
     SPtr<TOpt> nispdomain = new TOptDomainLst(OPTION_NISP_DOMAIN_NAME, string(yyvsp[0].strval), NULL);
     ParserOptStack.getLast()->addExtraOption(nispdomain, false);
 ;
     break;}
-case 308:
-#line 1721 "SrvParser.y"
+case 333:
+#line 1885 "SrvParser.y"
 {
     SPtr<TOpt> lifetime = new TOptInteger(OPTION_INFORMATION_REFRESH_TIME,
                                           OPTION_INFORMATION_REFRESH_TIME_LEN, 
@@ -3558,39 +3785,39 @@ case 308:
     //ParserOptStack.getLast()->setLifetime($3);
 ;
     break;}
-case 309:
-#line 1731 "SrvParser.y"
+case 334:
+#line 1895 "SrvParser.y"
 {
 ;
     break;}
-case 310:
-#line 1733 "SrvParser.y"
+case 335:
+#line 1897 "SrvParser.y"
 {
     // ParserOptStack.getLast()->setVendorSpec(VendorSpec);
     // Log(Debug) << "Vendor-spec parsing finished" << LogEnd;
 ;
     break;}
-case 311:
-#line 1741 "SrvParser.y"
+case 336:
+#line 1905 "SrvParser.y"
 {
     Log(Notice) << "ClientClass found, name: " << string(yyvsp[-1].strval) << LogEnd;
 ;
     break;}
-case 312:
-#line 1744 "SrvParser.y"
+case 337:
+#line 1908 "SrvParser.y"
 {
     SPtr<Node> cond =  NodeClientClassLst.getLast();
     SrvCfgClientClassLst.append( new TSrvCfgClientClass(string(yyvsp[-4].strval),cond));
     NodeClientClassLst.delLast();
 ;
     break;}
-case 313:
-#line 1754 "SrvParser.y"
+case 338:
+#line 1918 "SrvParser.y"
 {
 ;
     break;}
-case 315:
-#line 1760 "SrvParser.y"
+case 340:
+#line 1924 "SrvParser.y"
 {
     SPtr<Node> r =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3599,8 +3826,8 @@ case 315:
     NodeClientClassLst.append(new NodeOperator(NodeOperator::OPERATOR_CONTAIN,l,r));
 ;
     break;}
-case 316:
-#line 1768 "SrvParser.y"
+case 341:
+#line 1932 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3610,8 +3837,8 @@ case 316:
     NodeClientClassLst.append(new NodeOperator(NodeOperator::OPERATOR_EQUAL,l,r));
 ;
     break;}
-case 317:
-#line 1777 "SrvParser.y"
+case 342:
+#line 1941 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3621,8 +3848,8 @@ case 317:
 
 ;
     break;}
-case 318:
-#line 1786 "SrvParser.y"
+case 343:
+#line 1950 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3631,39 +3858,39 @@ case 318:
     NodeClientClassLst.append(new NodeOperator(NodeOperator::OPERATOR_OR,l,r));
 ;
     break;}
-case 319:
-#line 1797 "SrvParser.y"
+case 344:
+#line 1961 "SrvParser.y"
 {
     NodeClientClassLst.append(new NodeClientSpecific(NodeClientSpecific::CLIENT_VENDOR_SPEC_ENTERPRISE_NUM));
 ;
     break;}
-case 320:
-#line 1801 "SrvParser.y"
+case 345:
+#line 1965 "SrvParser.y"
 {
     NodeClientClassLst.append(new NodeClientSpecific(NodeClientSpecific::CLIENT_VENDOR_SPEC_DATA));
 ;
     break;}
-case 321:
-#line 1805 "SrvParser.y"
+case 346:
+#line 1969 "SrvParser.y"
 {
     NodeClientClassLst.append(new NodeClientSpecific(NodeClientSpecific::CLIENT_VENDOR_CLASS_ENTERPRISE_NUM));
 ;
     break;}
-case 322:
-#line 1809 "SrvParser.y"
+case 347:
+#line 1973 "SrvParser.y"
 {
     NodeClientClassLst.append(new NodeClientSpecific(NodeClientSpecific::CLIENT_VENDOR_CLASS_DATA));
 ;
     break;}
-case 323:
-#line 1813 "SrvParser.y"
+case 348:
+#line 1977 "SrvParser.y"
 {
     // Log(Info) << "Constant expression found:" <<string($1)<<LogEnd;
     NodeClientClassLst.append(new NodeConstant(string(yyvsp[0].strval)));
 ;
     break;}
-case 324:
-#line 1818 "SrvParser.y"
+case 349:
+#line 1982 "SrvParser.y"
 {
     //Log(Info) << "Constant expression found:" <<string($1)<<LogEnd;
     stringstream convert;
@@ -3673,8 +3900,8 @@ case 324:
     NodeClientClassLst.append(new NodeConstant(snum));
 ;
     break;}
-case 325:
-#line 1827 "SrvParser.y"
+case 350:
+#line 1991 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3885,7 +4112,7 @@ YYLABEL(yyerrhandle)
 /* END */
 
  #line 1039 "../bison++/bison.cc"
-#line 1833 "SrvParser.y"
+#line 1997 "SrvParser.y"
 
 
 /////////////////////////////////////////////////////////////////////////////
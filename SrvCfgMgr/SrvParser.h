@@ -384,11 +384,20 @@ typedef
 #define	ROUTE_	361
 #define	INFINITE_	362
 #define	SUBNET_	363
-#define	STRING_	364
-#define	HEXNUMBER_	365
-#define	INTNUMBER_	366
-#define	IPV6ADDR_	367
-#define	DUID_	368
+#define	SOL_MAX_RT_	364
+#define	INF_MAX_RT_	365
+#define	REJECT_CACHE_	366
+#define	LEASE_REUSE_	367
+#define	REPLY_CACHE_	368
+#define	LEASE_SYNC_	369
+#define	DECLINE_QUARANTINE_	370
+#define	TA_MEMORY_ONLY_	371
+#define	RENEW_TEMPLATES_	372
+#define	STRING_	373
+#define	HEXNUMBER_	374
+#define	INTNUMBER_	375
+#define	IPV6ADDR_	376
+#define	DUID_	377
 
 
 #line 169 "../bison++/bison.h"
@@ -543,6 +552,15 @@ static const int NEXT_HOP_;
 static const int ROUTE_;
 static const int INFINITE_;
 static const int SUBNET_;
+static const int SOL_MAX_RT_;
+static const int INF_MAX_RT_;
+static const int REJECT_CACHE_;
+static const int LEASE_REUSE_;
+static const int REPLY_CACHE_;
+static const int LEASE_SYNC_;
+static const int DECLINE_QUARANTINE_;
+static const int TA_MEMORY_ONLY_;
+static const int RENEW_TEMPLATES_;
 static const int STRING_;
 static const int HEXNUMBER_;
 static const int INTNUMBER_;
@@ -662,11 +680,20 @@ static const int DUID_;
 	,ROUTE_=361
 	,INFINITE_=362
 	,SUBNET_=363
-	,STRING_=364
-	,HEXNUMBER_=365
-	,INTNUMBER_=366
-	,IPV6ADDR_=367
-	,DUID_=368
+	,SOL_MAX_RT_=364
+	,INF_MAX_RT_=365
+	,REJECT_CACHE_=366
+	,LEASE_REUSE_=367
+	,REPLY_CACHE_=368
+	,LEASE_SYNC_=369
+	,DECLINE_QUARANTINE_=370
+	,TA_MEMORY_ONLY_=371
+	,RENEW_TEMPLATES_=372
+	,STRING_=373
+	,HEXNUMBER_=374
+	,INTNUMBER_=375
+	,IPV6ADDR_=376
+	,DUID_=377
 
 
 #line 215 "../bison++/bison.h"
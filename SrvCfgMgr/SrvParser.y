@@ -143,6 +143,9 @@ virtual ~SrvParser();
 %token CONTAIN_
 %token NEXT_HOP_, ROUTE_, INFINITE_
 %token SUBNET_
+%token SOL_MAX_RT_, INF_MAX_RT_
+%token REJECT_CACHE_, LEASE_REUSE_, REPLY_CACHE_, LEASE_SYNC_, DECLINE_QUARANTINE_
+%token TA_MEMORY_ONLY_, RENEW_TEMPLATES_
 
 %token <strval>     STRING_
 %token <ival>       HEXNUMBER_
@@ -151,6 +154,7 @@ virtual ~SrvParser();
 %token <duidval>    DUID_
 
 %type  <ival>       Number
+%type  <ival>       LeaseSyncRole
 
 %%
 
@@ -197,6 +201,13 @@ GlobalOption
 | PerformanceMode
 | ReconfigureEnabled
 | DropUnicast
+| RejectCache
+| LeaseReuse
+| ReplyCache
+| RenewTemplates
+| LeaseSync
+| DeclineQuarantine
+| TAMemoryOnly
 ;
 
 InterfaceOptionDeclaration
@@ -210,6 +221,8 @@ InterfaceOptionDeclaration
 | BulkLeaseQueryTimeout
 | UnicastAddressOption
 | PreferenceOption
+| SolMaxRTOption
+| InfMaxRTOption
 | RapidCommitOption
 | IfaceMaxLeaseOption
 | ClntMaxLeaseOption
@@ -1146,6 +1159,32 @@ PreferenceOption
 }
 ;
 
+SolMaxRTOption
+: SOL_MAX_RT_ Number
+{
+    if ($2 && ($2 < MAX_RT_OPTION_MIN || $2 > MAX_RT_OPTION_MAX)) {
+	Log(Crit) << "SOL_MAX_RT value (" << $2 << ") in line " << lex->lineno()
+		   << " is out of range [" << MAX_RT_OPTION_MIN << ".." << MAX_RT_OPTION_MAX
+		   << "] (or 0 to disable)." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setSolMaxRT($2);
+}
+;
+
+InfMaxRTOption
+: INF_MAX_RT_ Number
+{
+    if ($2 && ($2 < MAX_RT_OPTION_MIN || $2 > MAX_RT_OPTION_MAX)) {
+	Log(Crit) << "INF_MAX_RT value (" << $2 << ") in line " << lex->lineno()
+		   << " is out of range [" << MAX_RT_OPTION_MIN << ".." << MAX_RT_OPTION_MAX
+		   << "] (or 0 to disable)." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setInfMaxRT($2);
+}
+;
+
 LogLevelOption
 : LOGLEVEL_ Number {
     logger::setLogLevel($2);
@@ -1198,6 +1237,131 @@ ScriptName
     CfgMgr->setScriptName($2);
 };
 
+RejectCache
+: REJECT_CACHE_ Number
+{
+    Log(Debug) << "Rejected clients are remembered for " << $2 << " second(s)." << LogEnd;
+    CfgMgr->getRejectCache().setLimits($2, SERVER_DEFAULT_REJECT_CACHE_SIZE);
+}
+| REJECT_CACHE_ Number Number
+{
+    Log(Debug) << "Up to " << $3 << " rejected clients are remembered for " << $2
+               << " second(s)." << LogEnd;
+    CfgMgr->getRejectCache().setLimits($2, $3);
+};
+
+ReplyCache
+: REPLY_CACHE_ Number
+{
+    Log(Debug) << "Replies are remembered for " << $2 << " second(s)." << LogEnd;
+    CfgMgr->setReplyCache($2, SERVER_DEFAULT_REPLY_CACHE_SIZE);
+}
+| REPLY_CACHE_ Number Number
+{
+    Log(Debug) << "Up to " << $3 << " replies are remembered for " << $2
+               << " second(s)." << LogEnd;
+    CfgMgr->setReplyCache($2, $3);
+};
+
+RenewTemplates
+: RENEW_TEMPLATES_ Number
+{
+    Log(Debug) << "Replies to RENEW/REBIND are kept as templates for up to " << $2
+               << " client(s)." << LogEnd;
+    CfgMgr->setRenewTemplates($2);
+};
+
+TAMemoryOnly
+: TA_MEMORY_ONLY_
+{
+    Log(Debug) << "Temporary address leases will not be stored in the lease database." << LogEnd;
+    CfgMgr->setTAMemoryOnly(true);
+};
+
+DeclineQuarantine
+: DECLINE_QUARANTINE_ Number
+{
+    Log(Debug) << "Declined addresses are not used for " << $2 << " second(s)." << LogEnd;
+    CfgMgr->setDeclineQuarantine($2, SERVER_DEFAULT_DECLINE_MAX_SHARE);
+}
+| DECLINE_QUARANTINE_ Number Number
+{
+    if ($3 > 100) {
+        Log(Crit) << "Invalid decline-quarantine share " << $3 << "% (line " << lex->lineno()
+                  << "), allowed range is 0-100." << LogEnd;
+        YYABORT;
+    }
+    Log(Debug) << "Declined addresses are not used for " << $2 << " second(s), up to "
+               << $3 << "% of a pool." << LogEnd;
+    CfgMgr->setDeclineQuarantine($2, $3);
+};
+
+LeaseSync
+: LEASE_SYNC_ LeaseSyncRole IPV6ADDR_ LeaseSyncSecret
+{
+    addr = new TIPv6Addr($3);
+    Log(Debug) << "Leases are synchronized with partner " << addr->getPlain() << "." << LogEnd;
+    CfgMgr->setLeaseSync(addr, $2, 0);
+}
+| LEASE_SYNC_ LeaseSyncRole IPV6ADDR_ Number LeaseSyncSecret
+{
+    if (!$4 || $4 > 65535) {
+        Log(Crit) << "Invalid lease-sync port " << $4 << " (line " << lex->lineno()
+                  << "), allowed range is 1-65535." << LogEnd;
+        YYABORT;
+    }
+    addr = new TIPv6Addr($3);
+    Log(Debug) << "Leases are synchronized with partner " << addr->getPlain()
+               << ", port " << $4 << "." << LogEnd;
+    CfgMgr->setLeaseSync(addr, $2, $4);
+};
+
+LeaseSyncSecret
+: /* empty */
+| SECRET_ STRING_
+{
+    // base64 encoded, just like TSIG key secrets
+    TSIGKey key("lease-sync");
+    string secret;
+    if (key.setData(string($2)))
+        secret = key.getPackedData();
+    if (secret.empty()) {
+        Log(Crit) << "Invalid lease-sync secret (line " << lex->lineno()
+                  << "), base64 encoded secret expected." << LogEnd;
+        YYABORT;
+    }
+    CfgMgr->setLeaseSyncSecret(TKey(secret.begin(), secret.end()));
+    Log(Debug) << "Lease sync partners authenticate with a " << secret.length()
+               << " byte(s) long secret." << LogEnd;
+};
+
+LeaseSyncRole
+: STRING_
+{
+    if (!strcasecmp($1, "primary")) {
+        $$ = 1;
+    } else if (!strcasecmp($1, "secondary")) {
+        $$ = 0;
+    } else {
+        Log(Crit) << "Invalid lease-sync role " << $1 << " (line " << lex->lineno()
+                  << "), primary or secondary expected." << LogEnd;
+        YYABORT;
+    }
+};
+
+LeaseReuse
+: LEASE_REUSE_ Number
+{
+    if ($2 < 0 || $2 > SERVER_MAX_LEASE_REUSE) {
+	Log(Crit) << "Lease reuse threshold (" << $2 << ") in line " << lex->lineno()
+		   << " is out of range [0.." << SERVER_MAX_LEASE_REUSE << "]." << LogEnd;
+	YYABORT;
+    }
+    Log(Debug) << "Leases renewed before " << $2 << "% of valid lifetime elapsed will be reused."
+               << LogEnd;
+    CfgMgr->setLeaseReuse($2);
+};
+
 PerformanceMode
 : PERFORMANCE_MODE_ Number
 {
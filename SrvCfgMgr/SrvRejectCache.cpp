@@ -0,0 +1,137 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "SrvRejectCache.h"
+#include "DHCPDefaults.h"
+
+TSrvRejectCache::TSrvRejectCache()
+    :TTL_(SERVER_DEFAULT_REJECT_CACHE_TTL), MaxSize_(SERVER_DEFAULT_REJECT_CACHE_SIZE), Hits_(0)
+{
+}
+
+/**
+ * @brief sets cache parameters
+ *
+ * @param ttl how long (in seconds) rejected clients are remembered (0 disables cache)
+ * @param maxSize maximum number of remembered clients
+ */
+void TSrvRejectCache::setLimits(unsigned int ttl, unsigned int maxSize)
+{
+    TTL_ = ttl;
+    MaxSize_ = maxSize;
+    if (!TTL_ || !MaxSize_)
+        clear();
+}
+
+/**
+ * @brief remembers rejected client
+ *
+ * @param iface interface index
+ * @param duid client's DUID (anonymous clients are not remembered)
+ * @param reason why the client was rejected
+ * @param now current time (in seconds)
+ */
+void TSrvRejectCache::add(int iface, SPtr<TDUID> duid, ERejectReason reason, unsigned long now)
+{
+    if (!TTL_ || !MaxSize_ || !duid || !duid->getLen() || reason == REJECT_NONE)
+        return;
+
+    expire(now);
+
+    TKey key(iface, std::string(duid->get(), duid->getLen()));
+    TEntry entry;
+    entry.Reason = reason;
+    entry.Expire = now + TTL_;
+    Entries_[key] = entry;
+    Order_.push_back(std::make_pair(entry.Expire, key));
+
+    // cache is full: forget the oldest entries
+    while (Entries_.size() > MaxSize_) {
+        std::map<TKey, TEntry>::iterator it = Entries_.find(Order_.front().second);
+        if (it != Entries_.end() && it->second.Expire == Order_.front().first)
+            Entries_.erase(it);
+        Order_.pop_front();
+    }
+}
+
+/**
+ * @brief checks if client was rejected recently
+ *
+ * @param iface interface index
+ * @param duid client's DUID
+ * @param now current time (in seconds)
+ *
+ * @return reason of the rejection (REJECT_NONE if client is not in the cache)
+ */
+TSrvRejectCache::ERejectReason TSrvRejectCache::find(int iface, SPtr<TDUID> duid,
+                                                     unsigned long now)
+{
+    if (Entries_.empty() || !duid || !duid->getLen())
+        return REJECT_NONE;
+
+    std::map<TKey, TEntry>::iterator it =
+        Entries_.find(TKey(iface, std::string(duid->get(), duid->getLen())));
+    if (it == Entries_.end())
+        return REJECT_NONE;
+
+    if (it->second.Expire <= now) {
+        expire(now);
+        return REJECT_NONE;
+    }
+
+    Hits_++;
+    return it->second.Reason;
+}
+
+void TSrvRejectCache::clear()
+{
+    Entries_.clear();
+    Order_.clear();
+}
+
+/**
+ * @brief forgets clients rejected on specified interface for specified reason
+ *
+ * Their entries in the expiration queue are skipped when they expire.
+ *
+ * @param iface interface index
+ * @param reason rejection reason
+ */
+void TSrvRejectCache::clear(int iface, ERejectReason reason)
+{
+    std::map<TKey, TEntry>::iterator it = Entries_.lower_bound(TKey(iface, std::string()));
+    while (it != Entries_.end() && it->first.first == iface) {
+        if (it->second.Reason == reason)
+            Entries_.erase(it++);
+        else
+            ++it;
+    }
+}
+
+unsigned int TSrvRejectCache::count() const
+{
+    return Entries_.size();
+}
+
+/// returns number of lookups that found a rejected client
+unsigned long TSrvRejectCache::getHits() const
+{
+    return Hits_;
+}
+
+/// removes expired entries
+void TSrvRejectCache::expire(unsigned long now)
+{
+    while (!Order_.empty() && Order_.front().first <= now) {
+        std::map<TKey, TEntry>::iterator it = Entries_.find(Order_.front().second);
+        if (it != Entries_.end() && it->second.Expire == Order_.front().first)
+            Entries_.erase(it);
+        Order_.pop_front();
+    }
+}
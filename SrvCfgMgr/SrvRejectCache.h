@@ -0,0 +1,63 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVREJECTCACHE_H
+#define SRVREJECTCACHE_H
+
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include "SmartPtr.h"
+#include "DUID.h"
+
+/// @brief short-lived negative cache of rejected clients
+///
+/// Clients that were rejected (by white/black lists, or no class would
+/// accept them even if it had free addresses) are remembered for a while, keyed by interface and DUID,
+/// so their retransmissions are dropped (or refused) without walking through
+/// the classes, client classification and logging again. All entries have
+/// the same lifetime, so they expire in the order they were added.
+class TSrvRejectCache
+{
+ public:
+    typedef enum {
+        REJECT_NONE,        ///< client is not in the cache
+        REJECT_UNSUPPORTED, ///< rejected by white/black lists, message is dropped
+        REJECT_NO_CLASS     ///< no class supports this client, IA_NA gets NoAddrsAvail
+    } ERejectReason;
+
+    TSrvRejectCache();
+
+    void setLimits(unsigned int ttl, unsigned int maxSize);
+    void add(int iface, SPtr<TDUID> duid, ERejectReason reason, unsigned long now);
+    ERejectReason find(int iface, SPtr<TDUID> duid, unsigned long now);
+    void clear();
+    void clear(int iface, ERejectReason reason);
+
+    unsigned int count() const;
+    unsigned long getHits() const;
+
+ private:
+    typedef std::pair<int, std::string> TKey;
+    struct TEntry {
+        ERejectReason Reason;
+        unsigned long Expire;
+    };
+
+    void expire(unsigned long now);
+
+    std::map<TKey, TEntry> Entries_;
+    std::deque<std::pair<unsigned long, TKey> > Order_; ///< (expire, key) in insertion order
+    unsigned int TTL_;
+    unsigned int MaxSize_;
+    unsigned long Hits_;
+};
+
+#endif
@@ -2,6 +2,7 @@
 #include "SrvIfaceMgr.h"
 #include "SrvCfgMgr.h"
 #include "OptAddrLst.h"
+#include "OptInteger.h"
 
 #include <gtest/gtest.h>
 
@@ -108,4 +109,242 @@ TEST_F(SrvCfgMgrTest, getDelayedAuthKeyID) {
     EXPECT_EQ(0, cfgmgr->getDelayedAuthKeyID("no-such-file", duid1));
 }
 
+TEST_F(SrvCfgMgrTest, maxRT) {
+    SPtr<TSrvCfgIface> cfgIface = new TSrvCfgIface("eth0");
+
+    EXPECT_EQ(0u, cfgIface->getSolMaxRT());
+    EXPECT_EQ(0u, cfgIface->getInfMaxRT());
+    EXPECT_FALSE(cfgIface->getExtraOption(OPTION_SOL_MAX_RT));
+    EXPECT_FALSE(cfgIface->getExtraOption(OPTION_INF_MAX_RT));
+
+    // out of range values are rejected
+    EXPECT_FALSE(cfgIface->setSolMaxRT(59));
+    EXPECT_FALSE(cfgIface->setInfMaxRT(86401));
+    EXPECT_FALSE(cfgIface->getExtraOption(OPTION_SOL_MAX_RT));
+
+    EXPECT_TRUE(cfgIface->setSolMaxRT(600));
+    EXPECT_TRUE(cfgIface->setInfMaxRT(86400));
+    EXPECT_EQ(600u, cfgIface->getSolMaxRT());
+    EXPECT_EQ(86400u, cfgIface->getInfMaxRT());
+
+    // option is replaced, not duplicated
+    EXPECT_TRUE(cfgIface->setSolMaxRT(1200));
+    SPtr<TOptInteger> opt = (Ptr*)cfgIface->getExtraOption(OPTION_SOL_MAX_RT);
+    ASSERT_TRUE(opt);
+    EXPECT_EQ(1200u, opt->getValue());
+    EXPECT_EQ(2u, cfgIface->getExtraOptions().size());
+    EXPECT_EQ(0u, cfgIface->getForcedOptions().size());
+
+    // 0 disables the option
+    EXPECT_TRUE(cfgIface->setSolMaxRT(0));
+    EXPECT_FALSE(cfgIface->getExtraOption(OPTION_SOL_MAX_RT));
+    EXPECT_TRUE(cfgIface->getExtraOption(OPTION_INF_MAX_RT));
+}
+
+// checks that sol-max-rt and inf-max-rt are parsed
+TEST_F(SrvCfgMgrTest, maxRTConfig) {
+
+    ASSERT_TRUE(iface_);
+    string cfg = string("iface \"") + iface_->getName() + "\" {\n"
+                        "  sol-max-rt 600\n"
+                        "  inf-max-rt 3600\n"
+                        "  class { pool 2001:db8:1111::/64 }\n"
+                        "}\n";
+
+    ofstream cfgfile("testdata/server-maxrt.conf");
+    cfgfile << cfg;
+    cfgfile.close();
+
+    SPtr<NakedSrvCfgMgr> cfgmgr = new NakedSrvCfgMgr("testdata/server-maxrt.conf",
+                                                     "testdata/server-CfgMgr-maxrt.xml");
+    SPtr<TSrvCfgIface> cfgIface = cfgmgr->getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+    EXPECT_EQ(600u, cfgIface->getSolMaxRT());
+    EXPECT_EQ(3600u, cfgIface->getInfMaxRT());
+    EXPECT_TRUE(cfgIface->getExtraOption(OPTION_SOL_MAX_RT));
+    EXPECT_TRUE(cfgIface->getExtraOption(OPTION_INF_MAX_RT));
+
+    unlink("testdata/server-maxrt.conf");
+    unlink("testdata/server-CfgMgr-maxrt.xml");
+}
+
+// checks that global tuning options are parsed
+TEST_F(SrvCfgMgrTest, tuningConfig) {
+
+    ASSERT_TRUE(iface_);
+    string cfg = string("lease-reuse 50\n"
+                        "reply-cache 5 100\n"
+                        "renew-templates 200\n"
+                        "lease-sync secondary 2001:db8::1 1647 secret \"c2VjcmV0\"\n"
+                        "decline-quarantine 600 10\n"
+                        "ta-memory-only\n"
+                        "iface \"") + iface_->getName() + "\" {\n"
+                        "  class { pool 2001:db8:1111::/64 }\n"
+                        "}\n";
+
+    ofstream cfgfile("testdata/server-tuning.conf");
+    cfgfile << cfg;
+    cfgfile.close();
+
+    SPtr<NakedSrvCfgMgr> cfgmgr = new NakedSrvCfgMgr("testdata/server-tuning.conf",
+                                                     "testdata/server-CfgMgr-tuning.xml");
+    EXPECT_EQ(50u, cfgmgr->getLeaseReuse());
+    EXPECT_EQ(5u, cfgmgr->getReplyCacheTTL());
+    EXPECT_EQ(100u, cfgmgr->getReplyCacheSize());
+    EXPECT_EQ(200u, cfgmgr->getRenewTemplates());
+    ASSERT_TRUE(cfgmgr->getLeaseSyncPeer());
+    EXPECT_EQ(string("2001:db8::1"), cfgmgr->getLeaseSyncPeer()->getPlain());
+    EXPECT_FALSE(cfgmgr->getLeaseSyncPrimary());
+    EXPECT_EQ(1647, cfgmgr->getLeaseSyncPort());
+    TKey secret = cfgmgr->getLeaseSyncSecret();
+    EXPECT_EQ(string("secret"), string(secret.begin(), secret.end()));
+    EXPECT_EQ(600u, cfgmgr->getDeclineHoldTime());
+    EXPECT_EQ(10u, cfgmgr->getDeclineMaxShare());
+    EXPECT_TRUE(cfgmgr->getTAMemoryOnly());
+
+    unlink("testdata/server-tuning.conf");
+    unlink("testdata/server-CfgMgr-tuning.xml");
+}
+
+// checks that interface changes are published as new snapshots and that
+// snapshots in use are not freed
+TEST_F(SrvCfgMgrTest, snapshot) {
+    SPtr<NakedSrvCfgMgr> cfgmgr = new NakedSrvCfgMgr("", "");
+
+    const TSrvCfgSnapshot* empty = cfgmgr->getSnapshot();
+    ASSERT_TRUE(empty);
+    EXPECT_EQ(0u, empty->size());
+
+    SPtr<TSrvCfgIface> eth0 = new TSrvCfgIface(7);
+    eth0->setName("eth0");
+    SPtr<TSrvCfgIface> eth1 = new TSrvCfgIface(3);
+    eth1->setName("eth1");
+    cfgmgr->addIface(eth0);
+    cfgmgr->addIface(eth1);
+
+    const TSrvCfgSnapshot* cfg = cfgmgr->getSnapshot();
+    ASSERT_EQ(2u, cfg->size());
+    EXPECT_EQ(eth0, *cfg->begin()); // config order is kept
+    EXPECT_EQ(eth1.get(), cfg->getIfaceByID(3));
+    EXPECT_EQ(eth0.get(), cfg->getIfaceByName("eth0"));
+    EXPECT_FALSE(cfg->getIfaceByID(5));
+    EXPECT_TRUE(cfg->findByID(5) == cfg->end());
+    EXPECT_EQ(eth1, cfgmgr->getIfaceByID(3));
+
+    // reader keeps using old snapshot while interface goes inactive
+    int reader = cfgmgr->registerReader();
+    ASSERT_NE(-1, reader);
+    cfgmgr->makeInactiveIface(7, true);
+    EXPECT_NE(cfg, cfgmgr->getSnapshot());
+    EXPECT_EQ(1u, cfgmgr->getSnapshot()->size());
+    EXPECT_FALSE(cfgmgr->getIfaceByID(7));
+    EXPECT_EQ(1u, cfgmgr->reclaimSnapshots());
+    EXPECT_EQ(eth0.get(), cfg->getIfaceByID(7));
+
+    cfgmgr->quiescent(reader);
+    EXPECT_EQ(0u, cfgmgr->reclaimSnapshots());
+
+    cfgmgr->makeInactiveIface(7, false);
+    EXPECT_EQ(eth0, cfgmgr->getIfaceByID(7));
+    cfgmgr->unregisterReader(reader);
+}
+
+// checks that pool lookups find the right class when there are many of them
+TEST_F(SrvCfgMgrTest, poolLookup) {
+    ASSERT_TRUE(iface_);
+    string cfg = string("iface \"") + iface_->getName() + "\" {\n"
+                        "  class { pool 2001:db8:1::/64 }\n"
+                        "  class { pool 2001:db8:2::/64 }\n"
+                        "  class { pool 2001:db8:8000::/64 }\n"
+                        "  pd-class { pd-pool 2001:db8:f000::/48 pd-length 64 }\n"
+                        "  pd-class { pd-pool 2001:db8:f001::/48 pd-length 64 }\n"
+                        "}\n";
+
+    ofstream cfgfile("testdata/server-2.conf");
+    cfgfile << cfg;
+    cfgfile.close();
+
+    SPtr<NakedSrvCfgMgr> cfgmgr = new NakedSrvCfgMgr("testdata/server-2.conf",
+                                                     "testdata/server-CfgMgr2.xml");
+    SPtr<TSrvCfgIface> cfgIface = cfgmgr->getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+
+    SPtr<TIPv6Addr> second = new TIPv6Addr("2001:db8:2::1234", true);
+    SPtr<TIPv6Addr> third = new TIPv6Addr("2001:db8:8000::ffff", true);
+    SPtr<TIPv6Addr> outside = new TIPv6Addr("2001:db8:3::1", true);
+
+    // address must belong to any class, not all of them
+    EXPECT_TRUE(cfgIface->addrInPool(second));
+    EXPECT_TRUE(cfgIface->addrInPool(third));
+    EXPECT_FALSE(cfgIface->addrInPool(outside));
+
+    cfgIface->firstAddrClass();
+    cfgIface->getAddrClass();
+    SPtr<TSrvCfgAddrClass> cls = cfgIface->getAddrClass();
+    EXPECT_EQ(cls, cfgmgr->getClassByAddr(iface_->getID(), second));
+    EXPECT_EQ(cls, cfgIface->getClassByAddr(second));
+    EXPECT_FALSE(cfgIface->getClassByAddr(outside));
+
+    SPtr<TIPv6Addr> prefix = new TIPv6Addr("2001:db8:f001:5::", true);
+    cfgIface->firstPD();
+    cfgIface->getPD();
+    SPtr<TSrvCfgPD> pd = cfgIface->getPD();
+    EXPECT_TRUE(cfgIface->prefixInPdPool(prefix));
+    EXPECT_EQ(pd, cfgmgr->getClassByPrefix(iface_->getID(), prefix));
+    EXPECT_FALSE(cfgIface->prefixInPdPool(outside));
+
+    unlink("testdata/server-2.conf");
+    unlink("testdata/server-CfgMgr2.xml");
+}
+
+TEST(SrvRejectCacheTest, basic) {
+    TSrvRejectCache cache;
+    cache.setLimits(30, 2);
+
+    SPtr<TDUID> duid1 = new TDUID("00:01:00:0a:0b:0c:0d:0e:0f");
+    SPtr<TDUID> duid2 = new TDUID("00:01:00:0a:0b:0c:0d:0e:10");
+    SPtr<TDUID> duid3 = new TDUID("00:01:00:0a:0b:0c:0d:0e:11");
+
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(1, duid1, 100));
+
+    cache.add(1, duid1, TSrvRejectCache::REJECT_UNSUPPORTED, 100);
+    EXPECT_EQ(TSrvRejectCache::REJECT_UNSUPPORTED, cache.find(1, duid1, 110));
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(2, duid1, 110)); // other iface
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(1, duid2, 110));
+    EXPECT_EQ(1u, cache.getHits());
+
+    // anonymous clients are never cached
+    cache.add(1, SPtr<TDUID>(), TSrvRejectCache::REJECT_UNSUPPORTED, 100);
+    cache.add(1, new TDUID("", 0), TSrvRejectCache::REJECT_UNSUPPORTED, 100);
+    EXPECT_EQ(1u, cache.count());
+
+    // oldest entry is forgotten when cache is full
+    cache.add(1, duid2, TSrvRejectCache::REJECT_NO_CLASS, 105);
+    cache.add(1, duid3, TSrvRejectCache::REJECT_NO_CLASS, 106);
+    EXPECT_EQ(2u, cache.count());
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(1, duid1, 110));
+    EXPECT_EQ(TSrvRejectCache::REJECT_NO_CLASS, cache.find(1, duid2, 110));
+
+    // entries expire
+    EXPECT_EQ(TSrvRejectCache::REJECT_NO_CLASS, cache.find(1, duid3, 135));
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(1, duid2, 135));
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(1, duid3, 136));
+    EXPECT_EQ(0u, cache.count());
+
+    // clients are forgotten per interface and reason
+    cache.setLimits(30, 10);
+    cache.add(1, duid1, TSrvRejectCache::REJECT_UNSUPPORTED, 150);
+    cache.add(1, duid2, TSrvRejectCache::REJECT_NO_CLASS, 150);
+    cache.add(2, duid2, TSrvRejectCache::REJECT_NO_CLASS, 150);
+    cache.clear(1, TSrvRejectCache::REJECT_NO_CLASS);
+    EXPECT_EQ(TSrvRejectCache::REJECT_UNSUPPORTED, cache.find(1, duid1, 151));
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(1, duid2, 151));
+    EXPECT_EQ(TSrvRejectCache::REJECT_NO_CLASS, cache.find(2, duid2, 151));
+
+    // ttl 0 disables the cache
+    cache.setLimits(0, 2);
+    cache.add(1, duid1, TSrvRejectCache::REJECT_UNSUPPORTED, 200);
+    EXPECT_EQ(TSrvRejectCache::REJECT_NONE, cache.find(1, duid1, 200));
+}
+
 }
@@ -200,7 +200,9 @@ SPtr<TSrvMsg> TSrvIfaceMgr::select(unsigned long timeout) {
     int sockid;
 
     // read data
+    uint64_t start = TSrvLoad::now();
     sockid = receive(timeout, buf, bufsize, peer, myaddr);
+    Load_.update(start, TSrvLoad::now(), sockid >= 0);
     if (sockid < 0) {
         return SPtr<TSrvMsg>(); // NULL
     }
@@ -836,6 +838,11 @@ void TSrvIfaceMgr::notifyScripts(const std::string& scriptName, SPtr<TMsg> quest
     TIfaceMgr::notifyScripts(scriptName, question, answer);
 }
 
+/// returns server load tracker (used to compute SOL_MAX_RT/INF_MAX_RT backpressure)
+TSrvLoad& TSrvIfaceMgr::getLoad() {
+    return Load_;
+}
+
 ostream & operator <<(ostream & strum, TSrvIfaceMgr &x) {
     strum << "<SrvIfaceMgr>" << std::endl;
     SPtr<TIfaceIface> ptr;
@@ -16,6 +16,7 @@
 #include "IfaceMgr.h"
 #include "Iface.h"
 #include "SrvMsg.h"
+#include "SrvLoad.h"
 
 #define SrvIfaceMgr() (TSrvIfaceMgr::instance())
 
@@ -58,11 +59,14 @@ class TSrvIfaceMgr :public TIfaceMgr {
 
    void redetectIfaces();
 
+   TSrvLoad& getLoad();
+
 protected:
    TSrvIfaceMgr(const std::string& xmlFile);
    static TSrvIfaceMgr * Instance;
 
    std::string XmlFile;
+   TSrvLoad Load_;
 };
 
 #endif
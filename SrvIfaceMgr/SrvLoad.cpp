@@ -0,0 +1,155 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+#include "SrvLoad.h"
+#include "DHCPDefaults.h"
+#include "Logger.h"
+
+TSrvLoad::TSrvLoad()
+    :Level_(LOAD_NORMAL), HoldUntil_(0), LastReturn_(0), Backlog_(0), ProcessingTime_(0),
+     BacklogThreshold_(SERVER_DEFAULT_LOAD_BACKLOG),
+     LatencyThreshold_(SERVER_DEFAULT_LOAD_LATENCY),
+     BusyMaxRT_(SERVER_DEFAULT_BUSY_MAX_RT),
+     OverloadMaxRT_(SERVER_DEFAULT_OVERLOAD_MAX_RT)
+{
+}
+
+/**
+ * @brief updates load statistics, called after every select()
+ *
+ * @param selectStart when select() was called (in us)
+ * @param selectEnd when select() returned (in us)
+ * @param received was anything received?
+ */
+void TSrvLoad::update(uint64_t selectStart, uint64_t selectEnd, bool received)
+{
+    if (LastReturn_ && selectStart > LastReturn_) {
+        // exponentially weighted moving average (1/8 weight for new sample)
+        uint64_t sample = selectStart - LastReturn_;
+        ProcessingTime_ = ProcessingTime_ ? (7*ProcessingTime_ + sample)/8 : sample;
+    }
+    LastReturn_ = selectEnd;
+
+    // message was already waiting (select() returned within a millisecond)
+    if (received && selectEnd - selectStart < 1000)
+        Backlog_++;
+    else
+        Backlog_ = 0;
+
+    unsigned int latency = getLatency();
+    ELoadLevel level = LOAD_NORMAL;
+    if ( (BacklogThreshold_ && Backlog_ >= BacklogThreshold_) ||
+         (LatencyThreshold_ && latency >= LatencyThreshold_) )
+        level = LOAD_OVERLOADED;
+    else if ( (BacklogThreshold_ && Backlog_ >= (BacklogThreshold_ + 3)/4) ||
+              (LatencyThreshold_ && latency >= (LatencyThreshold_ + 3)/4) )
+        level = LOAD_BUSY;
+
+    // go up immediately, go down only after hold time expired
+    if (level >= Level_ || selectEnd >= HoldUntil_) {
+        if (level != Level_) {
+            Log(Notice) << "Load: server is " << levelToString(level) << " (backlog="
+                        << Backlog_ << ", latency=" << latency << "ms)." << LogEnd;
+        }
+        Level_ = level;
+        if (level != LOAD_NORMAL)
+            HoldUntil_ = selectEnd + (uint64_t)SERVER_DEFAULT_LOAD_HOLD*1000000;
+    }
+}
+
+/**
+ * @brief sets load thresholds (0 disables given criterion)
+ *
+ * @param backlog number of queued messages that means overload
+ * @param latency estimated reply latency (in ms) that means overload
+ */
+void TSrvLoad::setThresholds(unsigned int backlog, unsigned int latency)
+{
+    BacklogThreshold_ = backlog;
+    LatencyThreshold_ = latency;
+}
+
+/**
+ * @brief sets SOL_MAX_RT/INF_MAX_RT values used under load
+ *
+ * @param busy value sent when server is busy
+ * @param overloaded value sent when server is overloaded or out of addresses
+ */
+void TSrvLoad::setMaxRT(uint32_t busy, uint32_t overloaded)
+{
+    BusyMaxRT_ = busy;
+    OverloadMaxRT_ = overloaded;
+}
+
+TSrvLoad::ELoadLevel TSrvLoad::getLevel() const
+{
+    return Level_;
+}
+
+unsigned int TSrvLoad::getBacklog() const
+{
+    return Backlog_;
+}
+
+/// returns estimated reply latency (in ms)
+unsigned int TSrvLoad::getLatency() const
+{
+    return (unsigned int)((Backlog_ + 1) * ProcessingTime_ / 1000);
+}
+
+/**
+ * @brief returns SOL_MAX_RT/INF_MAX_RT value to be sent to clients
+ *
+ * @param configured configured value (0 if not configured)
+ * @param exhausted true if client can't get any addresses anyway
+ *
+ * @return max. retransmission time (0 means option should not be sent)
+ */
+uint32_t TSrvLoad::getMaxRT(uint32_t configured, bool exhausted) const
+{
+    uint32_t maxRT = configured;
+    if (Level_ >= LOAD_BUSY && maxRT < BusyMaxRT_)
+        maxRT = BusyMaxRT_;
+    if ( (Level_ >= LOAD_OVERLOADED || exhausted) && maxRT < OverloadMaxRT_)
+        maxRT = OverloadMaxRT_;
+    return maxRT;
+}
+
+/// returns current time (in microseconds)
+uint64_t TSrvLoad::now()
+{
+#ifndef WIN32
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec*1000000 + tv.tv_usec;
+#else
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+    uint64_t t = ((uint64_t)ft.dwHighDateTime << 32) | ft.dwLowDateTime;
+    return t/10; // 100ns intervals since 1601
+#endif
+}
+
+const char* TSrvLoad::levelToString(ELoadLevel level)
+{
+    switch (level) {
+    case LOAD_NORMAL:
+        return "not overloaded";
+    case LOAD_BUSY:
+        return "busy";
+    case LOAD_OVERLOADED:
+        return "overloaded";
+    }
+    return "unknown";
+}
@@ -0,0 +1,63 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVLOAD_H
+#define SRVLOAD_H
+
+#include <stdint.h>
+
+/// @brief tracks server load and derives SOL_MAX_RT/INF_MAX_RT backpressure
+///
+/// Load is measured around every select() call. If select() returns
+/// immediately, messages were already waiting in the socket queue, so the
+/// number of such consecutive returns approximates queue depth (backlog).
+/// Time spent between select() calls is the processing time of a single
+/// message; backlog multiplied by (smoothed) processing time estimates how
+/// long a newly received message waits for its reply.
+///
+/// When the server is busy or overloaded, SOL_MAX_RT/INF_MAX_RT sent to
+/// clients are raised, so retransmitting clients back off instead of
+/// making things worse.
+class TSrvLoad
+{
+ public:
+    typedef enum {
+        LOAD_NORMAL,
+        LOAD_BUSY,
+        LOAD_OVERLOADED
+    } ELoadLevel;
+
+    TSrvLoad();
+
+    void update(uint64_t selectStart, uint64_t selectEnd, bool received);
+    void setThresholds(unsigned int backlog, unsigned int latency);
+    void setMaxRT(uint32_t busy, uint32_t overloaded);
+
+    ELoadLevel getLevel() const;
+    unsigned int getBacklog() const;
+    unsigned int getLatency() const;
+    uint32_t getMaxRT(uint32_t configured, bool exhausted) const;
+
+    static uint64_t now();
+    static const char* levelToString(ELoadLevel level);
+
+ private:
+    ELoadLevel Level_;
+    uint64_t HoldUntil_;       ///< elevated level is kept until then (in us)
+    uint64_t LastReturn_;      ///< when select() returned last time (in us)
+    unsigned int Backlog_;     ///< messages read without waiting for them
+    uint64_t ProcessingTime_;  ///< smoothed per-message processing time (in us)
+
+    unsigned int BacklogThreshold_;
+    unsigned int LatencyThreshold_; ///< in ms
+    uint32_t BusyMaxRT_;
+    uint32_t OverloadMaxRT_;
+};
+
+#endif
@@ -20,6 +20,7 @@
 #include "SrvOptIA_PD.h"
 #include "OptStatusCode.h"
 #include "OptGeneric.h"
+#include "OptInteger.h"
 #include "SrvOptLQ.h"
 #include "SrvOptTA.h"
 #include "SrvCfgOptions.h"
@@ -47,7 +48,7 @@ using namespace std;
  */
 TSrvMsg::TSrvMsg(int iface, SPtr<TIPv6Addr> addr, int msgType, long transID)
     :TMsg(iface, addr, msgType, transID), FirstTimeStamp_((uint32_t)time(NULL)),
-     MRT_(0), forceMsgType_(0), physicalIface_(iface)
+     MRT_(0), forceMsgType_(0), physicalIface_(iface), SentIface_(0), SentPort_(0)
 {
 }
 
@@ -62,7 +63,8 @@ TSrvMsg::TSrvMsg(int iface, SPtr<TIPv6Addr> addr, int msgType, long transID)
  */
 TSrvMsg::TSrvMsg(int iface, SPtr<TIPv6Addr> addr,
                  char* buf, int bufSize)
-    :TMsg(iface, addr, buf, bufSize), forceMsgType_(0), physicalIface_(iface)
+    :TMsg(iface, addr, buf, bufSize), forceMsgType_(0), physicalIface_(iface),
+     SentIface_(0), SentPort_(0)
 {
     setDefaults();
 
@@ -200,7 +202,7 @@ TSrvMsg::TSrvMsg(int iface, SPtr<TIPv6Addr> addr,
             break;
         }
         if ( (ptr) && (ptr->isValid()) )
-            Options.push_back( ptr );
+            addOption( ptr );
         else
             Log(Warning) << "Option type " << code << " invalid. Option ignored." << LogEnd;
         pos += length;
@@ -230,8 +232,9 @@ void TSrvMsg::processOptions(SPtr<TSrvMsg> clientMsg, bool quiet) {
     SPtr<TIPv6Addr> clntAddr = PeerAddr_;
 
     // --- process this message ---
-    clientMsg->firstOption();
-    while ( opt = clientMsg->getOption()) {
+    const TOptList& opts = clientMsg->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it) {
+        opt = *it;
         switch (opt->getOptType()) {
         case OPTION_IA_NA : {
             processIA_NA((Ptr*)clientMsg, (Ptr*) opt);
@@ -299,8 +302,8 @@ void TSrvMsg::processOptions(SPtr<TSrvMsg> clientMsg, bool quiet) {
 bool TSrvMsg::releaseAll(bool quiet) {
     bool released = false;
     SPtr<TOpt> opt;
-    this->firstOption();
-    while ( opt = this->getOption()) {
+    for (TOptList::const_iterator it = Options.begin(); it != Options.end(); ++it) {
+        opt = *it;
         switch (opt->getOptType()) {
         case OPTION_IA_NA: {
             SPtr<TSrvOptIA_NA> ptrOptIA_NA;
@@ -393,10 +396,8 @@ void TSrvMsg::send(int dstPort /* = 0 */)
     }
     Log(Notice) << "Sending " << this->getName() << " on " << ptrIface->getFullName()
                 << hex << ",transID=0x" << this->getTransID() << dec << ", opts:";
-    SPtr<TOpt> ptrOpt;
-    this->firstOption();
-    while (ptrOpt = this->getOption() )
-        Log(Cont) << " " << ptrOpt->getOptType();
+    for (TOptList::const_iterator opt = Options.begin(); opt != Options.end(); ++opt)
+        Log(Cont) << " " << (*opt)->getOptType();
     Log(Cont) << ", " << RelayInfo_.size() << " relay(s)." << LogEnd;
 
     port = DHCPCLIENT_PORT;
@@ -466,6 +467,11 @@ void TSrvMsg::send(int dstPort /* = 0 */)
     }
 
     SrvIfaceMgr().send(ptrIface->getID(), buf, offset, PeerAddr_, port);
+
+    // keep it, so retransmissions can be answered with the same reply
+    SentData_.assign(buf, offset);
+    SentIface_ = ptrIface->getID();
+    SentPort_ = port;
     delete [] buf;
 }
 
@@ -482,19 +488,19 @@ SPtr<TDUID> TSrvMsg::getClientDUID() {
 void TSrvMsg::processIA_NA(SPtr<TSrvMsg> clientMsg, SPtr<TSrvOptIA_NA> queryOpt) {
     SPtr<TOpt> optIA_NA;
     optIA_NA = new TSrvOptIA_NA( queryOpt, clientMsg, this);
-    Options.push_back(optIA_NA);
+    addOption(optIA_NA);
 }
 
 void TSrvMsg::processIA_TA(SPtr<TSrvMsg> clientMsg, SPtr<TSrvOptTA> queryOpt) {
     SPtr<TOpt> optTA;
     optTA = new TSrvOptTA(queryOpt, clientMsg, clientMsg->getType(), this);
-    Options.push_back(optTA);
+    addOption(optTA);
 }
 
 void TSrvMsg::processIA_PD(SPtr<TSrvMsg> clientMsg, SPtr<TSrvOptIA_PD> queryOpt) {
     SPtr<TOpt> optPD;
     optPD = new TSrvOptIA_PD(clientMsg, queryOpt, this);
-    Options.push_back(optPD);
+    addOption(optPD);
 }
 
 #ifndef MOD_DISABLE_AUTH
@@ -539,7 +545,7 @@ void TSrvMsg::appendReconfigureKey() {
 
     }
 
-    Options.push_back((Ptr*)auth);
+    addOption((Ptr*)auth);
 }
 #endif
 
@@ -562,7 +568,7 @@ void TSrvMsg::processFQDN(SPtr<TSrvMsg> clientMsg, SPtr<TSrvOptFQDN> requestFQDN
     optFQDN = addFQDN(Iface, requestFQDN, ClientDUID, clntAssignedAddr, hint, doRealUpdate);
 
     if (optFQDN)
-        Options.push_back((Ptr*) optFQDN);
+        addOption((Ptr*) optFQDN);
 }
 
 /**
@@ -898,7 +904,7 @@ void TSrvMsg::appendAuthenticationOption(SPtr<TDUID> duid)
 
         auth->setRealm(SrvCfgMgr().getAuthRealm()); // defined for delayed-auth only
 
-        Options.push_back((Ptr*)auth);
+        addOption((Ptr*)auth);
     }
 #endif
 }
@@ -908,13 +914,13 @@ bool TSrvMsg::appendMandatoryOptions(SPtr<TOptOptionRequest> oro, bool clientID
     // include our DUID (Server ID)
     SPtr<TOptDUID> ptrSrvID;
     ptrSrvID = new TOptDUID(OPTION_SERVERID, SrvCfgMgr().getDUID(), this);
-    Options.push_back((Ptr*)ptrSrvID);
+    addOption((Ptr*)ptrSrvID);
     oro->delOption(OPTION_SERVERID);
 
     // include his DUID (Client ID)
     if (clientID && ClientDUID) {
         SPtr<TOptDUID> clientDuid = new TOptDUID(OPTION_CLIENTID, ClientDUID, this);
-        Options.push_back( (Ptr*)clientDuid);
+        addOption( (Ptr*)clientDuid);
     }
 
     // ... and our preference
@@ -922,14 +928,14 @@ bool TSrvMsg::appendMandatoryOptions(SPtr<TOptOptionRequest> oro, bool clientID
     unsigned char preference = SrvCfgMgr().getIfaceByID(Iface)->getPreference();
     Log(Debug) << "Preference set to " << (int)preference << "." << LogEnd;
     ptrPreference = new TOptInteger(OPTION_PREFERENCE, 1, preference, this);
-    Options.push_back((Ptr*)ptrPreference);
+    addOption((Ptr*)ptrPreference);
     oro->delOption(OPTION_PREFERENCE);
 
     // does this server support unicast?
     SPtr<TIPv6Addr> unicastAddr = SrvCfgMgr().getIfaceByID(Iface)->getUnicast();
     if (unicastAddr) {
         SPtr<TOptAddr> optUnicast = new TOptAddr(OPTION_UNICAST, unicastAddr, this);
-        Options.push_back((Ptr*)optUnicast);
+        addOption((Ptr*)optUnicast);
         oro->delOption(OPTION_UNICAST);
     }
 
@@ -1006,18 +1012,22 @@ bool TSrvMsg::appendRequestedOptions(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr,
     {
         Log(Debug) << "Appending mandatory extra option " << (*gen)->getOptType()
                    << " (" << (*gen)->getSize() << ")" << LogEnd;
-        Options.push_back( (Ptr*) *gen);
+        addOption( (Ptr*) *gen);
         reqOpts->delOption( (*gen)->getOptType() );
         newOptionAssigned = true;
     }
 
+    // --- option: SOL_MAX_RT, INF_MAX_RT ---
+    if (appendMaxRT(ptrIface, reqOpts))
+        newOptionAssigned = true;
+
     for (TOptList::iterator gen = extraOpts.begin(); gen!=extraOpts.end(); ++gen)
     {
         if (reqOpts->isOption( (*gen)->getOptType()))
         {
             Log(Debug) << "Appending requested extra option " << (*gen)->getOptType()
                        << " (" << (*gen)->getSize() << ")" << LogEnd;
-            Options.push_back( (Ptr*) *gen);
+            addOption( (Ptr*) *gen);
             newOptionAssigned = true;
         }
     }
@@ -1028,7 +1038,7 @@ bool TSrvMsg::appendRequestedOptions(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr,
     if ( reqOpts->isOption(OPTION_KEYGEN) && SrvCfgMgr().getDigest() != DIGEST_NONE )
     { // && this->MsgType == ADVERTISE_MSG ) {
         SPtr<TSrvOptKeyGeneration> optKeyGeneration = new TSrvOptKeyGeneration(this);
-        Options.push_back( (Ptr*)optKeyGeneration);
+        addOption( (Ptr*)optKeyGeneration);
     }
 #endif
 #endif
@@ -1036,6 +1046,66 @@ bool TSrvMsg::appendRequestedOptions(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr,
     return newOptionAssigned;
 }
 
+/**
+ * @brief appends SOL_MAX_RT/INF_MAX_RT options (if requested)
+ *
+ * Configured values are raised when the server is busy, overloaded or
+ * out of addresses, so clients back off instead of retransmitting
+ * more and more often. Appended options are removed from reqOpts, so
+ * configured values are not appended again as extra options.
+ *
+ * @param iface interface the message was received on
+ * @param reqOpts options requested by client
+ *
+ * @return true if any option was appended
+ */
+bool TSrvMsg::appendMaxRT(SPtr<TSrvCfgIface> iface, SPtr<TOptOptionRequest> reqOpts)
+{
+    bool appended = false;
+    const TSrvLoad& load = SrvIfaceMgr().getLoad();
+
+    if (reqOpts->isOption(OPTION_SOL_MAX_RT)) {
+        // client was refused an address, because there are none left
+        bool exhausted = false;
+        for (TOptList::iterator opt = Options.begin(); opt != Options.end(); ++opt) {
+            if ((*opt)->getOptType() != OPTION_IA_NA)
+                continue;
+            SPtr<TOptStatusCode> status = (Ptr*)(*opt)->getOption(OPTION_STATUS_CODE);
+            if (status && status->getCode() == STATUSCODE_NOADDRSAVAIL)
+                exhausted = iface->addrPoolsExhausted();
+        }
+
+        uint32_t maxRT = load.getMaxRT(iface->getSolMaxRT(), exhausted);
+        if (maxRT) {
+            if (maxRT != iface->getSolMaxRT()) {
+                Log(Debug) << "Load: Sending SOL_MAX_RT=" << maxRT << " ("
+                           << TSrvLoad::levelToString(load.getLevel())
+                           << (exhausted?", no addresses left":"") << ")." << LogEnd;
+            }
+            addOption(new TOptInteger(OPTION_SOL_MAX_RT, OPTION_SOL_MAX_RT_LEN,
+                                              maxRT, this));
+            reqOpts->delOption(OPTION_SOL_MAX_RT);
+            appended = true;
+        }
+    }
+
+    if (reqOpts->isOption(OPTION_INF_MAX_RT)) {
+        uint32_t maxRT = load.getMaxRT(iface->getInfMaxRT(), false);
+        if (maxRT) {
+            if (maxRT != iface->getInfMaxRT()) {
+                Log(Debug) << "Load: Sending INF_MAX_RT=" << maxRT << " ("
+                           << TSrvLoad::levelToString(load.getLevel()) << ")." << LogEnd;
+            }
+            addOption(new TOptInteger(OPTION_INF_MAX_RT, OPTION_INF_MAX_RT_LEN,
+                                              maxRT, this));
+            reqOpts->delOption(OPTION_INF_MAX_RT);
+            appended = true;
+        }
+    }
+
+    return appended;
+}
+
 /**
  * this function prints all options specified in the ORO option
  */
@@ -1095,7 +1165,7 @@ bool TSrvMsg::appendVendorSpec(SPtr<TDUID> duid, int iface, int vendor, SPtr<TOp
         vsLst.first();
         while (vs=vsLst.get())
         {
-            Options.push_back( (Ptr*)vs);
+            addOption( (Ptr*)vs);
         }
         return true;
     }
@@ -1173,8 +1243,8 @@ void TSrvMsg::appendStatusCode()
     SPtr<TOpt> opt;
     //rootLevel = getOption(OPTION_STATUS_CODE);
 
-    firstOption();
-    while (opt = getOption()) {
+    for (TOptList::const_iterator it = Options.begin(); it != Options.end(); ++it) {
+        opt = *it;
         switch ( opt->getOptType() ) {
         case OPTION_IA_NA:
             {
@@ -1183,7 +1253,7 @@ void TSrvMsg::appendStatusCode()
                         // copy status code to root-level
                         delOption(OPTION_STATUS_CODE);
                         rootLevel = new TOptStatusCode(optLevel->getCode(), optLevel->getText(), this);
-                        Options.push_back( (Ptr*) rootLevel);
+                        addOption( (Ptr*) rootLevel);
                         return;
                     }
                 }
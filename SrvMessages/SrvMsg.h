@@ -13,6 +13,7 @@
 #ifndef SRVMSG_H
 #define SRVMSG_H
 
+#include <string>
 #include <vector>
 #include "Msg.h"
 #include "SmartPtr.h"
@@ -53,6 +54,7 @@ public:
                                 int iface, SPtr<TOptOptionRequest> reqOpt);
     std::string showRequestedOptions(SPtr<TOptOptionRequest> oro);
     bool appendVendorSpec(SPtr<TDUID> duid, int iface, int vendor, SPtr<TOptOptionRequest> reqOpt);
+    bool appendMaxRT(SPtr<TSrvCfgIface> iface, SPtr<TOptOptionRequest> reqOpt);
     void appendStatusCode();
 
 #ifndef MOD_DISABLE_AUTH
@@ -104,6 +106,11 @@ public:
     void setPhysicalIface(int iface);
     int  getPhysicalIface() const;
 
+    /// @brief returns encoded message, as it was sent (empty if not sent yet)
+    const std::string& getSentData() const { return SentData_; }
+    int getSentIface() const { return SentIface_; }
+    int getSentPort() const { return SentPort_; }
+
 
 protected:
     void setDefaults();
@@ -144,6 +151,10 @@ protected:
 
     /// physical interface from/to which message was received/should be sent
     int physicalIface_;
+
+    std::string SentData_; ///< encoded message (with relay headers) sent by send()
+    int SentIface_;        ///< physical interface message was sent on
+    int SentPort_;         ///< destination port message was sent to
 };
 
 typedef std::vector< SPtr<TSrvMsg> > SrvMsgList;
@@ -50,8 +50,9 @@ bool TSrvMsgLeaseQueryReply::answer(SPtr<TSrvMsgLeaseQuery> queryMsg) {
 
     Log(Info) << "LQ: Generating new LEASEQUERY_RESP message." << LogEnd;
     
-    queryMsg->firstOption();
-    while ( opt = queryMsg->getOption()) {
+    const TOptList& opts = queryMsg->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it) {
+	opt = *it;
 	switch (opt->getOptType()) {
 	case OPTION_LQ_QUERY:
 	{
@@ -65,7 +66,7 @@ bool TSrvMsgLeaseQueryReply::answer(SPtr<TSrvMsgLeaseQuery> queryMsg) {
 		ok = queryByClientID(q, queryMsg);
 		break;
 	    default:
-		Options.push_back(new TOptStatusCode(STATUSCODE_UNKNOWNQUERYTYPE, "Invalid Query type.", this) );
+		addOption(new TOptStatusCode(STATUSCODE_UNKNOWNQUERYTYPE, "Invalid Query type.", this) );
 		Log(Warning) << "LQ: Invalid query type (" << q->getQueryType() << " received." << LogEnd;
 		return true;
 	    }
@@ -77,13 +78,13 @@ bool TSrvMsgLeaseQueryReply::answer(SPtr<TSrvMsgLeaseQuery> queryMsg) {
 	}
 	case OPTION_CLIENTID:
 	    // copy the client-id option
-	    Options.push_back(opt);
+	    addOption(opt);
 	    break;
 	}
 
     }
     if (!count) {
-	Options.push_back(new TOptStatusCode(STATUSCODE_MALFORMEDQUERY,
+	addOption(new TOptStatusCode(STATUSCODE_MALFORMEDQUERY,
                                              "Required LQ_QUERY option missing.", this));
 	return true;
     }
@@ -91,7 +92,7 @@ bool TSrvMsgLeaseQueryReply::answer(SPtr<TSrvMsgLeaseQuery> queryMsg) {
     // append SERVERID
     SPtr<TOptDUID> serverID;
     serverID = new TOptDUID(OPTION_SERVERID, SrvCfgMgr().getDUID(), this);
-    Options.push_back((Ptr*)serverID);
+    addOption((Ptr*)serverID);
 
     // allocate buffer
     this->send();
@@ -110,7 +111,7 @@ bool TSrvMsgLeaseQueryReply::queryByAddress(SPtr<TSrvOptLQ> q, SPtr<TSrvMsgLease
 	    addr = (Ptr*) opt;
     }
     if (!addr) {
-	Options.push_back(new TOptStatusCode(STATUSCODE_MALFORMEDQUERY,
+	addOption(new TOptStatusCode(STATUSCODE_MALFORMEDQUERY,
                                              "Required IAADDR suboption missing.", this));
 	return true;
     }
@@ -121,7 +122,7 @@ bool TSrvMsgLeaseQueryReply::queryByAddress(SPtr<TSrvOptLQ> q, SPtr<TSrvMsgLease
     if (!cli) {
 	Log(Warning) << "LQ: Assignement for client addr=" << addr->getAddr()->getPlain()
                      << " not found." << LogEnd;
-	Options.push_back( new TOptStatusCode(STATUSCODE_NOTCONFIGURED,
+	addOption( new TOptStatusCode(STATUSCODE_NOTCONFIGURED,
                                               "No binding for this address found.", this) );
 	return true;
     }
@@ -144,7 +145,7 @@ bool TSrvMsgLeaseQueryReply::queryByClientID(SPtr<TSrvOptLQ> q, SPtr<TSrvMsgLeas
 	}
     }
     if (!duid) {
-	Options.push_back( new TOptStatusCode(STATUSCODE_UNSPECFAIL,
+	addOption( new TOptStatusCode(STATUSCODE_UNSPECFAIL,
                                               "You didn't send your ClientID.", this) );
 	return true;
     }
@@ -155,7 +156,7 @@ bool TSrvMsgLeaseQueryReply::queryByClientID(SPtr<TSrvOptLQ> q, SPtr<TSrvMsgLeas
     if (!cli) {
 	Log(Warning) << "LQ: Assignement for client duid=" << duid->getPlain()
                      << " not found." << LogEnd;
-	Options.push_back( new TOptStatusCode(STATUSCODE_NOTCONFIGURED,
+	addOption( new TOptStatusCode(STATUSCODE_NOTCONFIGURED,
                                               "No binding for this DUID found.", this) );
 	return true;
     }
@@ -211,7 +212,7 @@ void TSrvMsgLeaseQueryReply::appendClientData(SPtr<TAddrClient> cli) {
 
     cliData->addOption( new TSrvOptLQClientTime(diff, this));
 
-    Options.push_back((Ptr*)cliData);
+    addOption((Ptr*)cliData);
 }
 
 bool TSrvMsgLeaseQueryReply::check() {
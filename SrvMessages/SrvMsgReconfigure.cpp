@@ -29,13 +29,13 @@ TSrvMsgReconfigure::TSrvMsgReconfigure(int iface, SPtr<TIPv6Addr> clientAddr,
 {
 
     // include our DUID (server-id)
-    Options.push_back(new TOptDUID(OPTION_SERVERID, SrvCfgMgr().getDUID(), this));
+    addOption(new TOptDUID(OPTION_SERVERID, SrvCfgMgr().getDUID(), this));
 
     // include his DUID (client-id)
-    Options.push_back(new TOptDUID(OPTION_CLIENTID, clientDuid, this));
+    addOption(new TOptDUID(OPTION_CLIENTID, clientDuid, this));
 
     // include Reconfigure Message
-    Options.push_back(new TOptReconfigureMsg(msgType, this) );
+    addOption(new TOptReconfigureMsg(msgType, this) );
 
 
     SPtr<TAddrClient> cli = SrvAddrMgr().getClient(clientDuid);
@@ -51,7 +51,7 @@ TSrvMsgReconfigure::TSrvMsgReconfigure(int iface, SPtr<TIPv6Addr> clientAddr,
         tmp[0] = 2; // see RFC3315, section 21.5.1
         optAuth->setPayload(tmp);
 
-        Options.push_back((Ptr*)optAuth);
+        addOption((Ptr*)optAuth);
 
     } else {
         Log(Warning) << "Auth: No reconfigure-key specified for client. Sending"
@@ -140,7 +140,7 @@ bool TSrvMsgReply::handleConfirmOptions(TOptList & options) {
             new TOptStatusCode(STATUSCODE_SUCCESS,
                                "Your addresses are correct for this link! Yay!",
                                this);
-        Options.push_back( (Ptr*) ptrCode);
+        addOption( (Ptr*) ptrCode);
         return true;
     }
 
@@ -149,7 +149,7 @@ bool TSrvMsgReply::handleConfirmOptions(TOptList & options) {
             new TOptStatusCode(STATUSCODE_NOTONLINK,
                                "Sorry, those addresses are not valid for this link.",
                                this);
-        Options.push_back( (Ptr*) ptrCode );
+        addOption( (Ptr*) ptrCode );
         return true;
     }
 
@@ -192,16 +192,10 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgDecline> decline)
         return;
     }
 
-    SPtr<TDUID> declinedDUID = new TDUID("X",1);
-    SPtr<TAddrClient> declinedClient = SrvAddrMgr().getClient( declinedDUID );
-    if (!declinedClient) {
-        declinedClient = new TAddrClient( declinedDUID );
-        SrvAddrMgr().addClient(declinedClient);
-    }
-
-    decline->firstOption();
-    while (ptrOpt = decline->getOption() )
+    const TOptList& opts = decline->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it)
     {
+        ptrOpt = *it;
         switch (ptrOpt->getOptType())
         {
         case OPTION_IA_NA:
@@ -210,7 +204,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgDecline> decline)
             SPtr<TAddrIA> ptrIA = ptrClient->getIA(ptrIA_NA->getIAID());
             if (!ptrIA)
             {
-                Options.push_back( new TSrvOptIA_NA(ptrIA_NA->getIAID(), 0, 0, STATUSCODE_NOBINDING,
+                addOption( new TSrvOptIA_NA(ptrIA_NA->getIAID(), 0, 0, STATUSCODE_NOBINDING,
                                              "No such IA is bound.",this) );
                 continue;
             }
@@ -219,7 +213,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgDecline> decline)
             SPtr<TSrvOptIA_NA> replyIA_NA = new TSrvOptIA_NA(ptrIA_NA->getIAID(), 0, 0, this);
             int AddrsDeclinedCnt = 0;
 
-            // IA found in DB, now move each addr in DB to "declined-client" and
+            // IA found in DB, now move each addr in DB to quarantine and
             // ignore those, which are not present id DB
             SPtr<TOpt> subOpt;
             SPtr<TSrvOptIAAddress> addr;
@@ -233,14 +227,9 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgDecline> decline)
                     if (SrvAddrMgr().delClntAddr(ptrClient->getDUID(), ptrIA_NA->getIAID(),
                                                  addr->getAddr(), false)) {
 
-                        // add this address to DECLINED dummy client
-                        SrvAddrMgr().addClntAddr(declinedDUID,
-                                                 new TIPv6Addr("::", true), // client-address
-                                                 decline->getIface(),
-                                                 0, 0, 0, // IAID
-                                                 addr->getAddr(), // declined address
-                                                 DECLINED_TIMEOUT, DECLINED_TIMEOUT,
-                                                 false);
+                        // keep it out of the pool for a while (it stays
+                        // counted as assigned until released)
+                        SrvAddrMgr().declineAddr(decline->getIface(), addr->getAddr());
 
                         // set pref/valid lifetimes to 0
                         addr->setValid(0);
@@ -252,7 +241,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgDecline> decline)
                     }
                 };
             }
-            Options.push_back((Ptr*)replyIA_NA);
+            addOption((Ptr*)replyIA_NA);
             char buf[10];
             sprintf(buf,"%d",AddrsDeclinedCnt);
             string tmp = buf;
@@ -296,9 +285,10 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRebind> rebind)
     unsigned long addrCount=0;
     SPtr<TOpt> ptrOpt;
 
-    rebind->firstOption();
-    while (ptrOpt = rebind->getOption() )
+    const TOptList& opts = rebind->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it)
     {
+        ptrOpt = *it;
         switch (ptrOpt->getOptType())
         {
         case OPTION_IA_NA:
@@ -309,7 +299,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRebind> rebind)
                                         rebind->getIface(), addrCount, REBIND_MSG,
                                         this);
             if (optIA_NA->getStatusCode() != STATUSCODE_NOBINDING )
-              Options.push_back((Ptr*)optIA_NA);
+              addOption((Ptr*)optIA_NA);
             else {
                 this->IsDone = true;
                 Log(Notice) << "REBIND received with unknown addresses and "
@@ -321,7 +311,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRebind> rebind)
         case OPTION_IA_PD: {
             SPtr<TSrvOptIA_PD> pd;
             pd = new TSrvOptIA_PD( (Ptr*)rebind, (Ptr*) ptrOpt, this);
-            Options.push_back((Ptr*)pd);
+            addOption((Ptr*)pd);
             break;
         }
 
@@ -391,8 +381,9 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
     appendMandatoryOptions(ORO);
     appendAuthenticationOption(ClientDUID);
 
-    release->firstOption();
-    while(opt=release->getOption()) {
+    const TOptList& opts = release->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it) {
+        opt = *it;
         switch (opt->getOptType()) {
         case OPTION_IA_NA: {
             SPtr<TSrvOptIA_NA> clntIA = (Ptr*) opt;
@@ -403,7 +394,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
             SPtr<TAddrIA> ptrIA = client->getIA(clntIA->getIAID() );
             if (!ptrIA) {
                 Log(Warning) << "No such IA (iaid=" << clntIA->getIAID() << ") found for client:" << ClientDUID->getPlain() << LogEnd;
-                Options.push_back( new TSrvOptIA_NA(clntIA->getIAID(), 0, 0, STATUSCODE_NOBINDING,"No such IA is bound.",this) );
+                addOption( new TSrvOptIA_NA(clntIA->getIAID(), 0, 0, STATUSCODE_NOBINDING,"No such IA is bound.",this) );
                 continue;
             }
 
@@ -434,7 +425,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
             if (!anyDeleted)
             {
                 SPtr<TSrvOptIA_NA> ansIA(new TSrvOptIA_NA(clntIA->getIAID(), clntIA->getT1(),clntIA->getT2(),this));
-                Options.push_back((Ptr*)ansIA);
+                addOption((Ptr*)ansIA);
                 ansIA->addOption(new TOptStatusCode(STATUSCODE_NOBINDING, "Not every address had binding.",this));
             };
             break;
@@ -445,7 +436,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
             SPtr<TAddrIA> ptrIA = client->getTA(ta->getIAID() );
             if (!ptrIA) {
                 Log(Warning) << "No such TA (iaid=" << ta->getIAID() << ") found for client:" << ClientDUID->getPlain() << LogEnd;
-                Options.push_back( new TSrvOptTA(ta->getIAID(), STATUSCODE_NOBINDING, "No such IA is bound.", this) );
+                addOption( new TSrvOptTA(ta->getIAID(), STATUSCODE_NOBINDING, "No such IA is bound.", this) );
                 continue;
             }
 
@@ -470,7 +461,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
             if (!anyDeleted)
             {
                 SPtr<TSrvOptTA> answerTA = new TSrvOptTA(ta->getIAID(), STATUSCODE_NOBINDING, "Not every address had binding.", this);
-                Options.push_back((Ptr*)answerTA);
+                addOption((Ptr*)answerTA);
             };
             break;
         }
@@ -484,7 +475,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
             SPtr<TAddrIA> ptrPD = client->getPD( pd->getIAID() );
             if (!ptrPD) {
                 Log(Warning) << "No such PD (iaid=" << pd->getIAID() << ") found for client:" << ClientDUID->getPlain() << LogEnd;
-                Options.push_back( new TSrvOptIA_PD(pd->getIAID(), 0, 0, STATUSCODE_NOBINDING,"No such PD is bound.",this) );
+                addOption( new TSrvOptIA_PD(pd->getIAID(), 0, 0, STATUSCODE_NOBINDING,"No such PD is bound.",this) );
                 continue;
             }
 
@@ -507,7 +498,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
             // send result to the client
             if (!anyDeleted)
             {
-                Options.push_back(new TSrvOptIA_PD(pd->getIAID(), 0u, 0u, 
+                addOption(new TSrvOptIA_PD(pd->getIAID(), 0u, 0u, 
                                                    STATUSCODE_NOBINDING, "Not every address had binding.", this));
             };
             break;
@@ -518,7 +509,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
         }; // switch(...)
     } // while
 
-    Options.push_back(new TOptStatusCode(STATUSCODE_SUCCESS,
+    addOption(new TOptStatusCode(STATUSCODE_SUCCESS,
                                          "All IAs in RELEASE message were processed.",this));
 
     NotifyScripts = notifyParams;
@@ -540,9 +531,10 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRenew> renew)
     unsigned long addrCount=0;
     SPtr<TOpt> ptrOpt;
 
-    renew->firstOption();
-    while (ptrOpt = renew->getOption() )
+    const TOptList& opts = renew->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it)
     {
+        ptrOpt = *it;
         switch (ptrOpt->getOptType())
         {
         case OPTION_IA_NA: {
@@ -550,13 +542,13 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRenew> renew)
             optIA_NA = new TSrvOptIA_NA((Ptr*)ptrOpt,
                                         renew->getRemoteAddr(), ClientDUID,
                                         renew->getIface(), addrCount, RENEW_MSG, this);
-            Options.push_back((Ptr*)optIA_NA);
+            addOption((Ptr*)optIA_NA);
             break;
         }
         case OPTION_IA_PD: {
             SPtr<TSrvOptIA_PD> optPD;
             optPD = new TSrvOptIA_PD((Ptr*) renew, (Ptr*)ptrOpt, this);
-            Options.push_back( (Ptr*) optPD);
+            addOption( (Ptr*) optPD);
             break;
         }
         case OPTION_IA_TA:
@@ -634,7 +626,7 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgSolicit> solicit)
     processOptions((Ptr*) solicit, false);
 
     // append RAPID-COMMIT option
-    Options.push_back(new TOptEmpty(OPTION_RAPID_COMMIT, this));
+    addOption(new TOptEmpty(OPTION_RAPID_COMMIT, this));
 
     appendMandatoryOptions(ORO);
     appendRequestedOptions(ClientDUID, PeerAddr_, Iface, ORO);
@@ -657,10 +649,11 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgInfRequest> infRequest)
 
     Log(Debug) << "Received INF-REQUEST requesting " << showRequestedOptions(ORO) << "." << LogEnd;
 
-    infRequest->firstOption();
     SPtr<TOpt> ptrOpt;
-    while (ptrOpt = infRequest->getOption() )
+    const TOptList& opts = infRequest->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it)
     {
+        ptrOpt = *it;
         switch (ptrOpt->getOptType())
         {
 
@@ -702,17 +695,18 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsg> msg, TOptList& options)
 
     // Let's just use specified options as they are
     Options = options;
+    optionsChanged();
 
     // Append client-id
     SPtr<TOpt> client_id = msg->getOption(OPTION_CLIENTID);
     if (client_id) {
-        Options.push_back(client_id);
+        addOption(client_id);
     }
 
     // Append server-id
     SPtr<TOptDUID> ptrSrvID;
     ptrSrvID = new TOptDUID(OPTION_SERVERID, SrvCfgMgr().getDUID(), this);
-    Options.push_back((Ptr*)ptrSrvID);
+    addOption((Ptr*)ptrSrvID);
 
     MRT_ = 330;
     IsDone = false;
@@ -16,6 +16,7 @@
 #endif
 
 #include <sstream>
+#include <time.h>
 #include "SrvOptIA_NA.h"
 #include "SrvOptIAAddress.h"
 #include "OptStatusCode.h"
@@ -146,6 +147,16 @@ TSrvOptIA_NA::TSrvOptIA_NA(SPtr<TSrvOptIA_NA> queryOpt, SPtr<TSrvMsg> queryMsg,
         return;
     }
 
+    // --- LEASE ASSIGN STEP 5a: Are there any free addresses at all? ---
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(Iface);
+    if (cfgIface && cfgIface->addrPoolsExhausted()) {
+        Log(Notice) << "All address pools on " << cfgIface->getFullName()
+                    << " are exhausted, no address assigned." << LogEnd;
+        SubOptions.append(new TOptStatusCode(STATUSCODE_NOADDRSAVAIL,
+                                             "No more addresses for you. Sorry.", Parent));
+        return;
+    }
+
     // --- LEASE ASSIGN STEP 6: Cached address? ---
     if (assignCachedAddr(quiet)) {
         return;
@@ -467,19 +478,21 @@ bool TSrvOptIA_NA::renew(SPtr<TSrvOptIA_NA> queryOpt, bool complainIfMissing)
       return false;
     }
 
-    // everything seems ok, update data in addrdb
-    ptrIA->setTimestamp();
-    T1_ = ptrIA->getT1();
-    T2_ = ptrIA->getT2();
+    // everything seems ok, update data in addrdb (unless lease is reused)
+    bool reuse = SrvAddrMgr().leaseReusable(ptrIA);
+    extendLease(ptrIA, reuse);
 
     // send addr info to client
     SPtr<TAddrAddr> ptrAddr;
     ptrIA->firstAddr();
     while ( ptrAddr = ptrIA->getAddr() ) {
         SPtr<TOptIAAddress> optAddr;
-        ptrAddr->setTimestamp();
-        optAddr = new TSrvOptIAAddress(ptrAddr->get(), ptrAddr->getPref(),ptrAddr->getValid(),
-                                       this->Parent);
+        if (reuse)
+            optAddr = new TSrvOptIAAddress(ptrAddr->get(), ptrAddr->getPrefTimeout(),
+                                           ptrAddr->getValidTimeout(), this->Parent);
+        else
+            optAddr = new TSrvOptIAAddress(ptrAddr->get(), ptrAddr->getPref(),ptrAddr->getValid(),
+                                           this->Parent);
         SubOptions.append( (Ptr*)optAddr );
     }
 
@@ -514,18 +527,21 @@ void TSrvOptIA_NA::rebind(SPtr<TSrvOptIA_NA> queryOpt,
 
     /// @todo: 18.2.4 par. 3 (check if addrs are appropriate for this link)
 
-    // everything seems ok, update data in addrdb
-    ptrIA->setTimestamp();
-    T1_ = ptrIA->getT1();
-    T2_ = ptrIA->getT2();
+    // everything seems ok, update data in addrdb (unless lease is reused)
+    bool reuse = SrvAddrMgr().leaseReusable(ptrIA);
+    extendLease(ptrIA, reuse);
 
     // send addr info to client
     SPtr<TAddrAddr> ptrAddr;
     ptrIA->firstAddr();
     while ( ptrAddr = ptrIA->getAddr() ) {
         SPtr<TOptIAAddress> optAddr;
-        optAddr = new TSrvOptIAAddress(ptrAddr->get(), ptrAddr->getPref(),
-                                       ptrAddr->getValid(),this->Parent);
+        if (reuse)
+            optAddr = new TSrvOptIAAddress(ptrAddr->get(), ptrAddr->getPrefTimeout(),
+                                           ptrAddr->getValidTimeout(), this->Parent);
+        else
+            optAddr = new TSrvOptIAAddress(ptrAddr->get(), ptrAddr->getPref(),
+                                           ptrAddr->getValid(),this->Parent);
         SubOptions.append( (Ptr*)optAddr );
     }
 
@@ -536,6 +552,33 @@ void TSrvOptIA_NA::rebind(SPtr<TSrvOptIA_NA> queryOpt,
     SubOptions.append( (Ptr*)ptrStatus );
 }
 
+/**
+ * @brief extends lease lifetimes (or only sets T1/T2 if lease is reused)
+ *
+ * @param ptrIA client's IA
+ * @param reuse true if lease is confirmed as it is (see TSrvAddrMgr::leaseReusable())
+ */
+void TSrvOptIA_NA::extendLease(SPtr<TAddrIA> ptrIA, bool reuse)
+{
+    if (reuse) {
+        T1_ = ptrIA->getT1Timeout();
+        T2_ = ptrIA->getT2Timeout();
+        Log(Debug) << "Lease for IA(iaid=" << IAID_ << ") renewed too early, "
+                   << "remaining lifetimes sent, lease not extended." << LogEnd;
+        return;
+    }
+
+    ptrIA->setTimestamp();
+    T1_ = ptrIA->getT1();
+    T2_ = ptrIA->getT2();
+
+    SPtr<TAddrAddr> ptrAddr;
+    ptrIA->firstAddr();
+    while ( ptrAddr = ptrIA->getAddr() )
+        ptrAddr->setTimestamp(ptrIA->getTimestamp());
+    SrvAddrMgr().journalLease(ClntDuid, ptrIA, IATYPE_IA);
+}
+
 void TSrvOptIA_NA::release(SPtr<TSrvOptIA_NA> queryOpt,
                            unsigned long &addrCount) {
 }
@@ -626,10 +669,7 @@ SPtr<TIPv6Addr> TSrvOptIA_NA::getAddressHint(SPtr<TSrvMsg> clientReq, SPtr<TIPv6
     } else {
         Log(Debug) << "Requested address (" << *hint
                    << ") belongs to supported class, but is used." << LogEnd;
-        do {
-            addr = ptrClass->getRandomAddr();
-        } while (!SrvAddrMgr().addrIsFree(addr));
-        return addr;
+        return findFreeAddr(ptrClass);
     }
 
     return SPtr<TIPv6Addr>(); // NULL
@@ -644,36 +684,59 @@ bool TSrvOptIA_NA::assignRandomAddr(SPtr<TSrvMsg> queryMsg, bool quiet) {
         Log(Error) << "Failed to find interface with ifindex=" << Iface << LogEnd;
         return false;
     }
+
+    // this client was recently found to have no class it could use
+    unsigned long now = (unsigned long)time(NULL);
+    TSrvRejectCache& rejectCache = SrvCfgMgr().getRejectCache();
+    if (rejectCache.find(Iface, ClntDuid, now) == TSrvRejectCache::REJECT_NO_CLASS)
+        return false;
+
     SPtr<TSrvCfgAddrClass> pool = iface->getRandomClass(ClntDuid, ClntAddr);
 
     if (!pool) {
         Log(Warning) << "Unable to find any suitable (allowed, non-full) class for this client." << LogEnd;
-        return 0;
+        // full classes may get free addresses any time, so only clients
+        // that no class would accept are remembered
+        if (!iface->addrClassAllowed(ClntDuid, ClntAddr))
+            rejectCache.add(Iface, ClntDuid, TSrvRejectCache::REJECT_NO_CLASS, now);
+        return false;
     }
 
     if (pool->clntSupported(ClntDuid, ClntAddr, queryMsg) &&
         pool->getAssignedCount() < pool->getClassMaxLease() ) {
 
-        int safety = 0;
-
-        while (safety < SERVER_MAX_IA_RANDOM_TRIES) {
-            candidate = pool->getRandomAddr();
-
-            if (SrvAddrMgr().addrIsFree(candidate) && !SrvCfgMgr().addrReserved(candidate))
-                break;
-
-            safety++;
-        }
-        if (safety < SERVER_MAX_IA_RANDOM_TRIES) {
+        candidate = findFreeAddr(pool);
+        if (candidate)
             return assignAddr(candidate, pool->getPref(), pool->getValid(), quiet);
-        } else {
-            Log(Error) << "Unable to randomly choose address after " << SERVER_MAX_IA_RANDOM_TRIES << " tries." << LogEnd;
-            return false;
-        }
+        return false;
     }
     return false;
 }
 
+/// @brief finds free, not reserved address in specified pool
+///
+/// In permutation mode the pool is walked in its keyed pseudo-random order,
+/// so no address is checked twice and a free address is found in at most
+/// pool size steps (capped at SERVER_MAX_IA_PERMUTATION_STEPS). Otherwise
+/// up to SERVER_MAX_IA_RANDOM_TRIES random addresses are checked.
+///
+/// @param pool address class
+///
+/// @return free address (or NULL)
+SPtr<TIPv6Addr> TSrvOptIA_NA::findFreeAddr(SPtr<TSrvCfgAddrClass> pool) {
+    bool permute = SrvCfgMgr().getAddrPermutation();
+    unsigned long steps = permute ? pool->getMaxAllocSteps() : SERVER_MAX_IA_RANDOM_TRIES;
+
+    for (unsigned long i = 0; i < steps; i++) {
+        SPtr<TIPv6Addr> candidate = permute ? pool->getNextAddr() : pool->getRandomAddr();
+        if (SrvAddrMgr().addrIsFree(candidate) && !SrvCfgMgr().addrReserved(candidate))
+            return candidate;
+    }
+
+    Log(Error) << "Unable to choose free address from pool after " << steps << " tries." << LogEnd;
+    return SPtr<TIPv6Addr>(); // NULL
+}
+
 
 bool TSrvOptIA_NA::assignSequentialAddr(SPtr<TSrvMsg> clientMsg, bool quiet) {
     // Random pool failed. That really should not happen. We are most probably not supporting
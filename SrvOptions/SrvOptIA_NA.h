@@ -19,6 +19,7 @@ class TSrvOptIA_NA;
 #include "Container.h"
 #include "IPv6Addr.h"
 #include "SrvMsg.h"
+#include "AddrIA.h"
 
 class TSrvOptIA_NA : public TOptIA_NA
 {
@@ -46,8 +47,10 @@ class TSrvOptIA_NA : public TOptIA_NA
     bool assignSequentialAddr(SPtr<TSrvMsg> clientMsg, bool quiet);
     bool assignRandomAddr(SPtr<TSrvMsg> queryMsg, bool quiet);
     SPtr<TIPv6Addr> getAddressHint(SPtr<TSrvMsg> clientReq, SPtr<TIPv6Addr> hint);
+    SPtr<TIPv6Addr> findFreeAddr(SPtr<TSrvCfgAddrClass> pool);
     bool assignAddr(SPtr<TIPv6Addr> addr, uint32_t pref, uint32_t valid, bool quiet);
     bool assignFixedLease(SPtr<TSrvOptIA_NA> req, bool quiet);
+    void extendLease(SPtr<TAddrIA> ptrIA, bool reuse);
 
     SPtr<TIPv6Addr>   ClntAddr;
     SPtr<TDUID>       ClntDuid;
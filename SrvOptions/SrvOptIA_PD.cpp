@@ -322,6 +322,15 @@ void TSrvOptIA_PD::solicitRequest(SPtr<TSrvMsg> clientMsg, SPtr<TSrvOptIA_PD> qu
         return;
     }
 
+    // --- LEASE ASSIGN STEP 5a: Are there any free prefixes at all? ---
+    if (ptrIface->prefixPoolsExhausted()) {
+        Log(Notice) << "PD: All prefix pools on " << ptrIface->getFullName()
+                    << " are exhausted, no prefix delegated." << LogEnd;
+        SubOptions.append(new TOptStatusCode(STATUSCODE_NOPREFIXAVAIL,
+                                             "Unable to provide any prefixes. Sorry.", Parent));
+        return;
+    }
+
     // --- LEASE ASSIGN STEP 6: Cached address? ---
     // --- LEASE ASSIGN STEP 7: client's hint ---
     // --- LEASE ASSIGN STEP 8: get new random address --
@@ -352,21 +361,35 @@ void TSrvOptIA_PD::renew(SPtr<TSrvOptIA_PD> queryOpt, SPtr<TSrvCfgIface> iface)
         return;
     }
 
-    // everything seems ok, update data in addrdb
-    ptrIA->setTimestamp();
-    T1_ = ptrIA->getT1();
-    T2_ = ptrIA->getT2();
+    // everything seems ok, update data in addrdb (unless lease is reused)
+    bool reuse = SrvAddrMgr().leaseReusable(ptrIA);
+    if (reuse) {
+        T1_ = ptrIA->getT1Timeout();
+        T2_ = ptrIA->getT2Timeout();
+    } else {
+        ptrIA->setTimestamp();
+        T1_ = ptrIA->getT1();
+        T2_ = ptrIA->getT2();
+    }
 
     // send addr info to client
     SPtr<TAddrPrefix> prefix;
     ptrIA->firstPrefix();
     while ( prefix = ptrIA->getPrefix() ) {
         SPtr<TSrvOptIAPrefix> optPrefix;
-        prefix->setTimestamp();
-        optPrefix = new TSrvOptIAPrefix(prefix->get(), prefix->getLength(), prefix->getPref(),
-                                        prefix->getValid(), this->Parent);
+        if (reuse) {
+            optPrefix = new TSrvOptIAPrefix(prefix->get(), prefix->getLength(),
+                                            prefix->getPrefTimeout(), prefix->getValidTimeout(),
+                                            this->Parent);
+        } else {
+            prefix->setTimestamp(ptrIA->getTimestamp());
+            optPrefix = new TSrvOptIAPrefix(prefix->get(), prefix->getLength(), prefix->getPref(),
+                                            prefix->getValid(), this->Parent);
+        }
         SubOptions.append( (Ptr*)optPrefix );
     }
+    if (!reuse)
+        SrvAddrMgr().journalLease(ClntDuid, ptrIA, IATYPE_PD);
 
     // finally send greetings and happy OK status code
     SPtr<TOptStatusCode> ptrStatus;
@@ -532,12 +555,9 @@ List(TIPv6Addr) TSrvOptIA_PD::getFreePrefixes(SPtr<TSrvMsg> clientMsg, SPtr<TIPv
       return lst; // empty list
     }
 
-    ptrIface->firstPD();
-    ptrPD = ptrIface->getPD();
-    // should be ==, asigned>total should never happen
-    if (ptrPD->getAssignedCount() >= ptrPD->getTotalCount()) {
-      Log(Error) << "PD: Unable to grant any prefixes: Already asigned " << ptrPD->getAssignedCount()
-                 << " out of " << ptrPD->getTotalCount() << "." << LogEnd;
+    if (ptrIface->prefixPoolsExhausted()) {
+      Log(Error) << "PD: Unable to grant any prefixes: all prefix pools on "
+                 << ptrIface->getFullName() << " are exhausted." << LogEnd;
       return lst; // empty list
     }
 
@@ -600,20 +620,23 @@ List(TIPv6Addr) TSrvOptIA_PD::getFreePrefixes(SPtr<TSrvMsg> clientMsg, SPtr<TIPv
                     T2_       = ptrPD->getT2(T2_);
                     lst.append(hint);
                     return lst;
-                } else {
+                } else if (ptrPD->getFreeCount()) {
 
                     // case 3: hint is used, but we can assign another prefix from the same pool
+                    int attempts = SERVER_MAX_PD_RANDOM_TRIES;
                     do {
                         prefix=ptrPD->getRandomPrefix();
-                    } while (!SrvAddrMgr().prefixIsFree(prefix));
-                    lst.append(prefix);
-
-                    this->PDLength = ptrPD->getPD_Length();
-                    this->Prefered = ptrPD->getPrefered(this->Prefered);
-                    this->Valid    = ptrPD->getValid(this->Valid);
-                    T1_       = ptrPD->getT1(T1_);
-                    T2_       = ptrPD->getT2(T2_);
-                    return lst;
+                    } while (!SrvAddrMgr().prefixIsFree(prefix) && --attempts);
+                    if (attempts) {
+                        lst.append(prefix);
+
+                        this->PDLength = ptrPD->getPD_Length();
+                        this->Prefered = ptrPD->getPrefered(this->Prefered);
+                        this->Valid    = ptrPD->getValid(this->Valid);
+                        T1_       = ptrPD->getT1(T1_);
+                        T2_       = ptrPD->getT2(T2_);
+                        return lst;
+                    }
                 } // if hint is used
             } // if this hint is reserved for someone?
         } // if client is supported at all
@@ -207,12 +207,24 @@ SPtr<TSrvOptIAAddress> TSrvOptTA::assignAddr(SPtr<TSrvMsg> clientMsg) {
                      << LogEnd;
         return SPtr<TSrvOptIAAddress>(); // NULL
     }
-    SPtr<TIPv6Addr> addr;
+    // take next address from the ring of this TA class. Only if the ring
+    // is full (or larger pools were not covered), try random addresses.
+    std::vector<TSrvAddrMgr::TExpiredInfo> expired;
+    SPtr<TIPv6Addr> addr = SrvAddrMgr().allocTAAddr(ta, expired);
+    if (!expired.empty() && this->OrgMessage == REQUEST_MSG) {
+        // the address is still held by an expired lease, remove it first
+        if (SrvAddrMgr().reclaimTAAddr(expired.front()))
+            SrvCfgMgr().delTAAddr(expired.front().ia->getIfindex());
+        expired.clear();
+    }
     int safety=0;
 
     while (safety < SERVER_MAX_TA_RANDOM_TRIES) {
-	addr = ta->getRandomAddr();
-	if (SrvAddrMgr().taAddrIsFree(addr)) {
+	if (!addr)
+	    addr = ta->getRandomAddr();
+	// expired lease doesn't prevent offering its address
+	bool reclaimable = !expired.empty() && *expired.front().addr == *addr;
+	if (reclaimable || SrvAddrMgr().taAddrIsFree(addr)) {
 	    if ((this->OrgMessage == REQUEST_MSG)) {
 		Log(Debug) << "Temporary address " << addr->getPlain() << " granted." << LogEnd;
 		SrvAddrMgr().addTAAddr(this->ClntDuid, this->ClntAddr, this->Iface,
@@ -225,6 +237,7 @@ SPtr<TSrvOptIAAddress> TSrvOptTA::assignAddr(SPtr<TSrvMsg> clientMsg) {
 	    return new TSrvOptIAAddress(addr, ta->getPref(), ta->getValid(), this->Parent);
 
 	}
+	addr.reset();
 	safety++;
     }
     Log(Error) << "Unable to randomly choose address after " << SERVER_MAX_TA_RANDOM_TRIES
@@ -0,0 +1,182 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "SrvReplyCache.h"
+#include "SrvIfaceMgr.h"
+#include "DHCPDefaults.h"
+#include "Logger.h"
+
+TSrvReplyCache::TSrvReplyCache()
+    :TTL_(SERVER_DEFAULT_REPLY_CACHE_TTL), MaxSize_(SERVER_DEFAULT_REPLY_CACHE_SIZE),
+     Hits_(0), Misses_(0)
+{
+}
+
+/**
+ * @brief sets cache parameters
+ *
+ * @param ttl how long (in seconds) replies are remembered (0 disables cache)
+ * @param maxSize maximum number of remembered replies
+ */
+void TSrvReplyCache::setLimits(unsigned int ttl, unsigned int maxSize)
+{
+    TTL_ = ttl;
+    MaxSize_ = maxSize;
+    if (!TTL_ || !MaxSize_)
+        clear();
+}
+
+/**
+ * @brief remembers reply sent to a client
+ *
+ * @param query message received from the client
+ * @param data encoded reply, as it was sent
+ * @param iface physical interface the reply was sent on
+ * @param port destination port the reply was sent to
+ * @param now current time (in seconds)
+ */
+void TSrvReplyCache::add(SPtr<TSrvMsg> query, const std::string& data, int iface, int port,
+                         unsigned long now)
+{
+    if (!TTL_ || !MaxSize_ || data.empty())
+        return;
+
+    std::string key;
+    if (!getKey(query, key))
+        return;
+
+    expire(now);
+
+    TEntry entry;
+    entry.Data = data;
+    entry.Iface = iface;
+    entry.Port = port;
+    entry.Expire = now + TTL_;
+    Entries_[key] = entry;
+    Order_.push_back(std::make_pair(entry.Expire, key));
+
+    // cache is full: forget the oldest entries
+    while (Entries_.size() > MaxSize_) {
+        std::map<std::string, TEntry>::iterator it = Entries_.find(Order_.front().second);
+        if (it != Entries_.end() && it->second.Expire == Order_.front().first)
+            Entries_.erase(it);
+        Order_.pop_front();
+    }
+}
+
+/**
+ * @brief sends cached reply again, if the message is a retransmission
+ *
+ * @param query message received from the client
+ * @param now current time (in seconds)
+ *
+ * @return true if cached reply was sent (message should not be processed)
+ */
+bool TSrvReplyCache::resend(SPtr<TSrvMsg> query, unsigned long now)
+{
+    if (!TTL_ || !MaxSize_)
+        return false;
+
+    std::string key;
+    if (!getKey(query, key))
+        return false;
+
+    std::map<std::string, TEntry>::iterator it = Entries_.find(key);
+    if (it == Entries_.end() || it->second.Expire <= now) {
+        Misses_++;
+        if (it != Entries_.end())
+            expire(now);
+        return false;
+    }
+
+    Hits_++;
+    Log(Info) << "Retransmitted " << query->getName() << " (transID=0x" << std::hex
+              << query->getTransID() << std::dec << ") received, cached reply ("
+              << it->second.Data.size() << " bytes) sent again." << LogEnd;
+
+    // send() does not modify the buffer
+    SrvIfaceMgr().send(it->second.Iface, const_cast<char*>(it->second.Data.c_str()),
+                       it->second.Data.size(), query->getRemoteAddr(), it->second.Port);
+    return true;
+}
+
+void TSrvReplyCache::clear()
+{
+    Entries_.clear();
+    Order_.clear();
+}
+
+unsigned int TSrvReplyCache::count() const
+{
+    return Entries_.size();
+}
+
+/// returns number of retransmissions answered from the cache
+unsigned long TSrvReplyCache::getHits() const
+{
+    return Hits_;
+}
+
+/// returns number of messages that had to be processed
+unsigned long TSrvReplyCache::getMisses() const
+{
+    return Misses_;
+}
+
+/**
+ * @brief builds cache key for a message
+ *
+ * Key consists of interface, remote address, client's address (different
+ * from remote one when relayed), number of relays, message type,
+ * transaction-id and client DUID.
+ *
+ * @param query message received from the client
+ * @param key [out] cache key
+ *
+ * @return false if message can't be cached (anonymous client or no address)
+ */
+bool TSrvReplyCache::getKey(SPtr<TSrvMsg> query, std::string& key)
+{
+    SPtr<TDUID> duid = query->getClientDUID();
+    SPtr<TIPv6Addr> remote = query->getRemoteAddr();
+    SPtr<TIPv6Addr> peer = query->getClientPeer();
+    if (!duid || !duid->getLen() || !remote || !peer)
+        return false;
+
+    char hdr[10];
+    int iface = query->getIface();
+    unsigned long transid = query->getTransID();
+    hdr[0] = (char)(iface >> 24);
+    hdr[1] = (char)(iface >> 16);
+    hdr[2] = (char)(iface >> 8);
+    hdr[3] = (char)iface;
+    hdr[4] = (char)query->getType();
+    hdr[5] = (char)query->RelayInfo_.size();
+    hdr[6] = (char)(transid >> 24);
+    hdr[7] = (char)(transid >> 16);
+    hdr[8] = (char)(transid >> 8);
+    hdr[9] = (char)transid;
+
+    key.assign(hdr, sizeof(hdr));
+    key.append(remote->getAddr(), 16);
+    key.append(peer->getAddr(), 16);
+    key.append(duid->get(), duid->getLen());
+    return true;
+}
+
+/// removes expired entries
+void TSrvReplyCache::expire(unsigned long now)
+{
+    while (!Order_.empty() && Order_.front().first <= now) {
+        std::map<std::string, TEntry>::iterator it = Entries_.find(Order_.front().second);
+        if (it != Entries_.end() && it->second.Expire == Order_.front().first)
+            Entries_.erase(it);
+        Order_.pop_front();
+    }
+}
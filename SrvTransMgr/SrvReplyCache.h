@@ -0,0 +1,64 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVREPLYCACHE_H
+#define SRVREPLYCACHE_H
+
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include "SmartPtr.h"
+#include "IPv6Addr.h"
+#include "SrvMsg.h"
+
+/// @brief short-lived cache of sent replies, used to answer retransmissions
+///
+/// Clients (and relays) retransmit messages with the same transaction-id
+/// when reply is late or lost. Encoded replies are remembered for a few
+/// seconds, keyed by interface, peer address, client DUID, transaction-id
+/// and message type, so an exact retransmission gets the very same reply
+/// again, without processing the message (and changing leases) once more.
+/// All entries have the same lifetime, so they expire in the order they
+/// were added.
+class TSrvReplyCache
+{
+ public:
+    TSrvReplyCache();
+
+    void setLimits(unsigned int ttl, unsigned int maxSize);
+    void add(SPtr<TSrvMsg> query, const std::string& data, int iface, int port,
+             unsigned long now);
+    bool resend(SPtr<TSrvMsg> query, unsigned long now);
+    void clear();
+
+    unsigned int count() const;
+    unsigned long getHits() const;
+    unsigned long getMisses() const;
+
+ private:
+    struct TEntry {
+        std::string Data; ///< encoded reply (with relay headers, if relayed)
+        int Iface;        ///< physical interface reply was sent on
+        int Port;         ///< destination port
+        unsigned long Expire;
+    };
+
+    static bool getKey(SPtr<TSrvMsg> query, std::string& key);
+    void expire(unsigned long now);
+
+    std::map<std::string, TEntry> Entries_;
+    std::deque<std::pair<unsigned long, std::string> > Order_; ///< (expire, key) in insertion order
+    unsigned int TTL_;
+    unsigned int MaxSize_;
+    unsigned long Hits_;
+    unsigned long Misses_;
+};
+
+#endif
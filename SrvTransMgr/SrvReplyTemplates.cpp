@@ -0,0 +1,409 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "SrvReplyTemplates.h"
+#include "SrvIfaceMgr.h"
+#include "SrvAddrMgr.h"
+#include "DHCPDefaults.h"
+#include "Portable.h"
+#include "Logger.h"
+
+TSrvReplyTemplates::TSrvReplyTemplates()
+    :MaxSize_(SERVER_DEFAULT_RENEW_TEMPLATES), Hits_(0), Misses_(0)
+{
+}
+
+/**
+ * @brief sets maximum number of remembered replies
+ *
+ * @param maxSize maximum number of remembered replies (0 disables templates)
+ */
+void TSrvReplyTemplates::setLimit(unsigned int maxSize)
+{
+    MaxSize_ = maxSize;
+    if (!MaxSize_)
+        clear();
+}
+
+/**
+ * @brief remembers REPLY sent to RENEW or REBIND as a template
+ *
+ * Reply is remembered only if all IAs in it contain exactly the leases
+ * client has in the database (in the same order), so the next time
+ * lifetimes can be written directly to it.
+ *
+ * @param query RENEW or REBIND received from the client (already processed)
+ * @param reply REPLY that was sent to the client
+ */
+void TSrvReplyTemplates::add(SPtr<TSrvMsg> query, SPtr<TSrvMsg> reply)
+{
+    if (!MaxSize_ || !reply || reply->getType() != REPLY_MSG)
+        return;
+    if (reply->getOption(OPTION_AUTH) || reply->getOption(OPTION_FQDN))
+        return;
+
+    const std::string& data = reply->getSentData();
+    std::string key;
+    if (data.empty() || !getKey(query, key))
+        return;
+
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(query->getClientDUID());
+    if (!client)
+        return;
+
+    // skip relay headers: msg-type, hop-count, link-address, peer-address, options
+    size_t pos = 0;
+    size_t end = data.size();
+    for (size_t relay = 0; relay < reply->RelayInfo_.size(); relay++) {
+        size_t opt = pos + 34;
+        pos = 0;
+        while (opt + 4 <= end) {
+            size_t len = readUint16(data.c_str() + opt + 2);
+            if (opt + 4 + len > end)
+                return;
+            if (readUint16(data.c_str() + opt) == OPTION_RELAY_MSG) {
+                pos = opt + 4;
+                end = pos + len;
+                break;
+            }
+            opt += 4 + len;
+        }
+        if (!pos)
+            return;
+    }
+
+    TEntry entry;
+    entry.MsgOffset = pos;
+
+    // find IAs in the reply and check them against the database
+    for (pos += 4; pos + 4 <= end; pos += 4 + readUint16(data.c_str() + pos + 2)) {
+        int code = readUint16(data.c_str() + pos);
+        if (code != OPTION_IA_NA && code != OPTION_IA_PD)
+            continue;
+        TIA ia;
+        ia.Type = (code == OPTION_IA_NA) ? IATYPE_IA : IATYPE_PD;
+        ia.Offset = pos;
+        if (!parseIA(data, pos, client, ia))
+            return;
+        entry.IAs.push_back(ia);
+    }
+    if (entry.IAs.empty())
+        return;
+
+    getRequest(query, entry.Request);
+    entry.Data = data;
+    entry.Iface = reply->getSentIface();
+    entry.Port = reply->getSentPort();
+    entry.Load = SrvIfaceMgr().getLoad().getLevel();
+
+    std::map<std::string, TEntry>::iterator it = Entries_.find(key);
+    if (it != Entries_.end()) {
+        // client's leases changed, keep its place in the eviction order
+        it->second = entry;
+        return;
+    }
+
+    Entries_[key] = entry;
+    Order_.push_back(key);
+
+    // too many templates: forget the oldest ones
+    while (Entries_.size() > MaxSize_) {
+        Entries_.erase(Order_.front());
+        Order_.pop_front();
+    }
+}
+
+/**
+ * @brief answers RENEW or REBIND using remembered REPLY
+ *
+ * If message is the same as the one the template was created for
+ * (except transaction-id and elapsed time) and client's leases didn't
+ * change, leases are extended (or reused, see TSrvAddrMgr::leaseReusable())
+ * exactly as TSrvMsgReply would do it, transaction-id and lifetimes are
+ * written to a copy of the template and it is sent.
+ *
+ * @param query RENEW or REBIND received from the client
+ * @param cache reply cache (sent reply is added there)
+ * @param now current time (in seconds)
+ *
+ * @return true if reply was sent (message should not be processed)
+ */
+bool TSrvReplyTemplates::send(SPtr<TSrvMsg> query, TSrvReplyCache& cache, unsigned long now)
+{
+    if (!MaxSize_)
+        return false;
+
+    std::string key;
+    if (!getKey(query, key))
+        return false;
+
+    std::map<std::string, TEntry>::const_iterator it = Entries_.find(key);
+    if (it == Entries_.end()) {
+        Misses_++;
+        return false;
+    }
+    const TEntry& entry = it->second;
+
+    std::string request;
+    getRequest(query, request);
+    SPtr<TDUID> duid = query->getClientDUID();
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(duid);
+    if (!client || request != entry.Request ||
+        entry.Load != SrvIfaceMgr().getLoad().getLevel()) {
+        Misses_++;
+        return false;
+    }
+
+    std::vector<SPtr<TAddrIA> > ias;
+    for (std::vector<TIA>::const_iterator t = entry.IAs.begin(); t != entry.IAs.end(); ++t) {
+        SPtr<TAddrIA> ia = findIA(client, *t);
+        if (!ia) {
+            Misses_++;
+            return false;
+        }
+        ias.push_back(ia);
+    }
+
+    std::string data = entry.Data;
+    char* buf = &data[0];
+    unsigned long transid = query->getTransID();
+    buf[entry.MsgOffset + 1] = (char)(transid >> 16);
+    buf[entry.MsgOffset + 2] = (char)(transid >> 8);
+    buf[entry.MsgOffset + 3] = (char)transid;
+
+    for (size_t i = 0; i < ias.size(); i++) {
+        const TIA& t = entry.IAs[i];
+        SPtr<TAddrIA> ia = ias[i];
+
+        // the same as TSrvOptIA_NA::renew() and TSrvOptIA_PD::renew() do
+        bool reuse = SrvAddrMgr().leaseReusable(ia);
+        if (reuse) {
+            writeUint32(buf + t.Offset, ia->getT1Timeout());
+            writeUint32(buf + t.Offset + 4, ia->getT2Timeout());
+        } else {
+            ia->setTimestamp();
+            writeUint32(buf + t.Offset, ia->getT1());
+            writeUint32(buf + t.Offset + 4, ia->getT2());
+        }
+
+        size_t lease = 0;
+        if (t.Type == IATYPE_IA) {
+            for (TAddrIA::TAddrAddrLst::const_iterator a = ia->getAddrs().begin();
+                 a != ia->getAddrs().end(); ++a, ++lease) {
+                if (!reuse)
+                    (*a)->setTimestamp(ia->getTimestamp());
+                writeUint32(buf + t.Leases[lease].Offset,
+                            reuse ? (*a)->getPrefTimeout() : (*a)->getPref());
+                writeUint32(buf + t.Leases[lease].Offset + 4,
+                            reuse ? (*a)->getValidTimeout() : (*a)->getValid());
+            }
+        } else {
+            for (TAddrIA::TAddrPrefixLst::const_iterator p = ia->getPrefixes().begin();
+                 p != ia->getPrefixes().end(); ++p, ++lease) {
+                if (!reuse)
+                    (*p)->setTimestamp(ia->getTimestamp());
+                writeUint32(buf + t.Leases[lease].Offset,
+                            reuse ? (*p)->getPrefTimeout() : (*p)->getPref());
+                writeUint32(buf + t.Leases[lease].Offset + 4,
+                            reuse ? (*p)->getValidTimeout() : (*p)->getValid());
+            }
+        }
+
+        if (reuse) {
+            Log(Debug) << "Lease for IA(iaid=" << t.IAID << ") renewed too early, "
+                       << "remaining lifetimes sent, lease not extended." << LogEnd;
+        } else {
+            SrvAddrMgr().journalLease(duid, ia, t.Type);
+        }
+    }
+
+    Hits_++;
+    Log(Info) << query->getName() << " (transID=0x" << std::hex << transid << std::dec
+              << ") answered with REPLY template (" << data.size() << " bytes)." << LogEnd;
+
+    SrvIfaceMgr().send(entry.Iface, buf, data.size(), query->getRemoteAddr(), entry.Port);
+    cache.add(query, data, entry.Iface, entry.Port, now);
+    return true;
+}
+
+void TSrvReplyTemplates::clear()
+{
+    Entries_.clear();
+    Order_.clear();
+}
+
+unsigned int TSrvReplyTemplates::count() const
+{
+    return Entries_.size();
+}
+
+/// returns number of messages answered with a template
+unsigned long TSrvReplyTemplates::getHits() const
+{
+    return Hits_;
+}
+
+/// returns number of messages that had to be processed
+unsigned long TSrvReplyTemplates::getMisses() const
+{
+    return Misses_;
+}
+
+/**
+ * @brief builds template key for a message
+ *
+ * Key consists of interface, remote address, client's address (different
+ * from remote one when relayed), number of relays, message type and
+ * client DUID.
+ *
+ * @param query message received from the client
+ * @param key [out] template key
+ *
+ * @return false if message can't use templates (anonymous client or no address)
+ */
+bool TSrvReplyTemplates::getKey(SPtr<TSrvMsg> query, std::string& key)
+{
+    SPtr<TDUID> duid = query->getClientDUID();
+    SPtr<TIPv6Addr> remote = query->getRemoteAddr();
+    SPtr<TIPv6Addr> peer = query->getClientPeer();
+    if (!duid || !duid->getLen() || !remote || !peer)
+        return false;
+
+    char hdr[6];
+    int iface = query->getIface();
+    hdr[0] = (char)(iface >> 24);
+    hdr[1] = (char)(iface >> 16);
+    hdr[2] = (char)(iface >> 8);
+    hdr[3] = (char)iface;
+    hdr[4] = (char)query->getType();
+    hdr[5] = (char)query->RelayInfo_.size();
+
+    key.assign(hdr, sizeof(hdr));
+    key.append(remote->getAddr(), 16);
+    key.append(peer->getAddr(), 16);
+    key.append(duid->get(), duid->getLen());
+    return true;
+}
+
+/**
+ * @brief encodes everything in the message that could affect the reply
+ *
+ * That's all options (except elapsed time) and, for relayed messages,
+ * relay headers with options relays sent.
+ *
+ * @param query message received from the client
+ * @param request [out] encoded message
+ */
+void TSrvReplyTemplates::getRequest(SPtr<TSrvMsg> query, std::string& request)
+{
+    std::vector<char> buf;
+    request.clear();
+
+    for (size_t relay = 0; relay < query->RelayInfo_.size(); relay++) {
+        const TSrvMsg::RelayInfo& info = query->RelayInfo_[relay];
+        request += (char)info.Hop_;
+        request.append(info.LinkAddr_->getAddr(), 16);
+        request.append(info.PeerAddr_->getAddr(), 16);
+        for (TOptList::const_iterator opt = info.EchoList_.begin();
+             opt != info.EchoList_.end(); ++opt) {
+            buf.resize((*opt)->getSize());
+            (*opt)->storeSelf(&buf[0]);
+            request.append(&buf[0], buf.size());
+        }
+    }
+
+    const TOptList& opts = query->getOptLst();
+    for (TOptList::const_iterator opt = opts.begin(); opt != opts.end(); ++opt) {
+        if ((*opt)->getOptType() == OPTION_ELAPSED_TIME)
+            continue;
+        buf.resize((*opt)->getSize());
+        (*opt)->storeSelf(&buf[0]);
+        request.append(&buf[0], buf.size());
+    }
+}
+
+/**
+ * @brief finds lifetimes in encoded IA_NA or IA_PD and checks its leases
+ *
+ * @param data encoded reply
+ * @param offset offset of IA_NA or IA_PD option in the reply
+ * @param client client the reply was sent to
+ * @param ia [out] IA type and offset are expected, IAID and leases are set
+ *
+ * @return true if IA contains exactly the leases client has in the database
+ */
+bool TSrvReplyTemplates::parseIA(const std::string& data, size_t offset,
+                                 SPtr<TAddrClient> client, TIA& ia)
+{
+    const char* buf = data.c_str();
+    size_t end = offset + 4 + readUint16(buf + offset + 2);
+    if (end - offset < 16)
+        return false;
+
+    ia.IAID = readUint32(buf + offset + 4);
+    ia.Offset = offset + 8;
+
+    for (size_t pos = offset + 16; pos + 4 <= end; pos += 4 + readUint16(buf + pos + 2)) {
+        int code = readUint16(buf + pos);
+        size_t len = readUint16(buf + pos + 2);
+        TLease lease;
+        if (code == OPTION_IAADDR && ia.Type == IATYPE_IA && len >= 24) {
+            lease.Addr = new TIPv6Addr(buf + pos + 4, false);
+            lease.Length = 128;
+            lease.Offset = pos + 20;
+        } else if (code == OPTION_IAPREFIX && ia.Type == IATYPE_PD && len >= 25) {
+            lease.Addr = new TIPv6Addr(buf + pos + 13, false);
+            lease.Length = (unsigned char)buf[pos + 12];
+            lease.Offset = pos + 4;
+        } else {
+            continue;
+        }
+        ia.Leases.push_back(lease);
+    }
+
+    return findIA(client, ia);
+}
+
+/**
+ * @brief finds client's IA with exactly the same leases as in the template
+ *
+ * @param client client from the database
+ * @param ia IA from the template
+ *
+ * @return IA from the database (or NULL if there's none or leases differ)
+ */
+SPtr<TAddrIA> TSrvReplyTemplates::findIA(SPtr<TAddrClient> client, const TIA& ia)
+{
+    SPtr<TAddrIA> found = (ia.Type == IATYPE_IA) ? client->getIA(ia.IAID)
+                                                 : client->getPD(ia.IAID);
+    if (!found)
+        return SPtr<TAddrIA>();
+
+    size_t lease = 0;
+    if (ia.Type == IATYPE_IA) {
+        if (found->getAddrs().count() != ia.Leases.size())
+            return SPtr<TAddrIA>();
+        for (TAddrIA::TAddrAddrLst::const_iterator a = found->getAddrs().begin();
+             a != found->getAddrs().end(); ++a, ++lease) {
+            if (*(*a)->get() != *ia.Leases[lease].Addr)
+                return SPtr<TAddrIA>();
+        }
+    } else {
+        if (found->getPrefixes().count() != ia.Leases.size())
+            return SPtr<TAddrIA>();
+        for (TAddrIA::TAddrPrefixLst::const_iterator p = found->getPrefixes().begin();
+             p != found->getPrefixes().end(); ++p, ++lease) {
+            if (*(*p)->get() != *ia.Leases[lease].Addr ||
+                (*p)->getLength() != ia.Leases[lease].Length)
+                return SPtr<TAddrIA>();
+        }
+    }
+
+    return found;
+}
@@ -0,0 +1,86 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVREPLYTEMPLATES_H
+#define SRVREPLYTEMPLATES_H
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+#include "SmartPtr.h"
+#include "IPv6Addr.h"
+#include "DHCPConst.h"
+#include "AddrClient.h"
+#include "SrvMsg.h"
+#include "SrvReplyCache.h"
+
+/// @brief encoded REPLYs to RENEW/REBIND, reused for the next RENEW/REBIND
+///
+/// A client that renews its leases sends the same RENEW (or REBIND) every
+/// time, only the transaction-id and elapsed time differ. The REPLY it gets
+/// differs only in transaction-id and lifetimes, too. Encoded REPLY is
+/// remembered (keyed by interface, remote and client's address, number of
+/// relays, message type and client DUID) with offsets of all lifetimes in
+/// it. When the same message comes again and client's leases are still the
+/// same, leases are extended in place and the remembered REPLY is sent with
+/// new transaction-id and lifetimes written directly into it, without
+/// building REPLY again.
+class TSrvReplyTemplates
+{
+ public:
+    TSrvReplyTemplates();
+
+    void setLimit(unsigned int maxSize);
+    void add(SPtr<TSrvMsg> query, SPtr<TSrvMsg> reply);
+    bool send(SPtr<TSrvMsg> query, TSrvReplyCache& cache, unsigned long now);
+    void clear();
+
+    unsigned int count() const;
+    unsigned long getHits() const;
+    unsigned long getMisses() const;
+
+ private:
+    struct TLease {
+        SPtr<TIPv6Addr> Addr;
+        int Length;       ///< prefix length (IA_PD only)
+        size_t Offset;    ///< offset of preferred lifetime (valid lifetime follows)
+    };
+
+    struct TIA {
+        TIAType Type;     ///< IATYPE_IA or IATYPE_PD
+        unsigned long IAID;
+        size_t Offset;    ///< offset of T1 (T2 follows)
+        std::vector<TLease> Leases;
+    };
+
+    struct TEntry {
+        std::string Request;  ///< encoded options (except elapsed time) of the query
+        std::string Data;     ///< encoded reply (with relay headers, if relayed)
+        size_t MsgOffset;     ///< offset of the REPLY in Data
+        int Iface;            ///< physical interface reply was sent on
+        int Port;             ///< destination port
+        int Load;             ///< server load level (it affects *_MAX_RT options)
+        std::vector<TIA> IAs;
+    };
+
+    static bool getKey(SPtr<TSrvMsg> query, std::string& key);
+    static void getRequest(SPtr<TSrvMsg> query, std::string& request);
+    static bool parseIA(const std::string& data, size_t offset, SPtr<TAddrClient> client,
+                        TIA& ia);
+    static SPtr<TAddrIA> findIA(SPtr<TAddrClient> client, const TIA& ia);
+
+    std::map<std::string, TEntry> Entries_;
+    std::deque<std::string> Order_; ///< keys in insertion order
+    unsigned int MaxSize_;
+    unsigned long Hits_;
+    unsigned long Misses_;
+};
+
+#endif
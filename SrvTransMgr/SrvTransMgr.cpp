@@ -13,6 +13,7 @@
 #include <sstream>
 #include <map>
 #include <limits.h>
+#include <time.h>
 #include "SrvTransMgr.h"
 #include "SmartPtr.h"
 #include "SrvCfgIface.h"
@@ -66,6 +67,8 @@ TSrvTransMgr::TSrvTransMgr(const std::string xmlFile, int port)
     }
 
     SrvAddrMgr().setCacheSize(SrvCfgMgr().getCacheSize());
+    ReplyCache_.setLimits(SrvCfgMgr().getReplyCacheTTL(), SrvCfgMgr().getReplyCacheSize());
+    ReplyTemplates_.setLimit(SrvCfgMgr().getRenewTemplates());
 }
 
 /// @brief Checks loaded database and sends RECONFIGURE to some clients.
@@ -93,19 +96,20 @@ int TSrvTransMgr::checkReconfigures() {
         /// @todo clean up this shit
         check=true;
         ptrDUID=cli->getDUID();
-        SPtr<TAddrIA> ia;
-        cli->firstIA();
-        while ( (ia = cli->getIA()) && check) 
+        // iterators, not firstIA()/getIA(): delClntAddr() below looks up
+        // the same client
+        for (TAddrIAMap::const_iterator it = cli->getIAs().begin();
+             check && it != cli->getIAs().end(); ++it)
         {
+            SPtr<TAddrIA> ia = *it;
             IAID=ia->getIAID();	
             iface=ia->getIfindex();
             SPtr<TIfaceIface> ptrIface = SrvIfaceMgr().getIfaceByID(iface);
             SPtr<TIPv6Addr> unicast=ia->getSrvAddr();
-            SPtr<TAddrAddr> adr;
-            SPtr<TIPv6Addr> addra;
-            ia->firstAddr();
-            while( (adr=ia->getAddr()) && check ) 
+            for (TAddrIA::TAddrAddrLst::const_iterator a = ia->getAddrs().begin();
+                 a != ia->getAddrs().end(); ++a)
             {
+                SPtr<TAddrAddr> adr = *a;
                 PD=false;
                 if(ClientInPool1(adr->get(),iface,PD))
                 {
@@ -132,23 +136,24 @@ int TSrvTransMgr::checkReconfigures() {
                         Log(Debug) << "Outdated " << *adr->get() << " address deleted." << LogEnd;
                    }
                     check = false;
-                    break; // break inner while loop
+                    break; // break inner loop
                 }
             }
-        } 
-        SPtr<TAddrIA> pd;
-        cli->firstPD();
-        while ( (pd = cli->getPD()) && check ) 
+            if (!check)
+                break; // IA may be gone, don't touch the iterator
+        }
+        for (TAddrIAMap::const_iterator it = cli->getPDs().begin();
+             check && it != cli->getPDs().end(); ++it)
         {
+            SPtr<TAddrIA> pd = *it;
             IAID=pd->getIAID();
             iface=pd->getIfindex();
-            SPtr<TAddrPrefix> prefix;
-            SPtr<TIPv6Addr> addra;
             SPtr<TIfaceIface> ptrIface = SrvIfaceMgr().getIfaceByID(iface);
             SPtr<TIPv6Addr> unicast=pd->getSrvAddr();
-            pd->firstPrefix();
-            while(prefix=pd->getPrefix() ) 
+            for (TAddrIA::TAddrPrefixLst::const_iterator p = pd->getPrefixes().begin();
+                 p != pd->getPrefixes().end(); ++p)
             {
+                SPtr<TAddrPrefix> prefix = *p;
                 PD=true;
                 if(ClientInPool1(prefix->get(),iface,PD))
                 {
@@ -180,6 +185,8 @@ int TSrvTransMgr::checkReconfigures() {
                     break;
                 }
             }
+            if (!check)
+                break;
         }
     }
 
@@ -280,7 +287,14 @@ long TSrvTransMgr::getTimeout()
     if (SrvCfgMgr().inactiveIfacesCnt() && ifaceRecheckPeriod<min) {
         min = ifaceRecheckPeriod;
     }
+    // lease sync partner is served every second
+    if (SrvAddrMgr().getLeaseSync().isActive() && min > 1) {
+        min = 1;
+    }
     addrTimeout = SrvAddrMgr().getValidTimeout();
+    unsigned long declined = SrvAddrMgr().getQuarantine().getTimeout((unsigned long)time(NULL));
+    if (declined < addrTimeout)
+        addrTimeout = declined;
     if (min < addrTimeout) {
         return min;
     } else {
@@ -311,6 +325,27 @@ void TSrvTransMgr::relayMsg(SPtr<TSrvMsg> msg)
         return;
     }
 
+    // Is this a retransmission of a message we already replied to? Send
+    // the same reply again, without processing the message once more.
+    unsigned long now = (unsigned long)time(NULL);
+    if (ReplyCache_.resend(msg, now))
+        return;
+
+    // Was this client rejected recently? Then drop its retransmissions quickly.
+    TSrvRejectCache& rejectCache = SrvCfgMgr().getRejectCache();
+    if (rejectCache.find(msg->getIface(), msg->getClientDUID(), now) ==
+        TSrvRejectCache::REJECT_UNSUPPORTED) {
+        return;
+    }
+
+    // Both servers of a synchronized pair get every SOLICIT, but only one of
+    // them answers (unless its partner is gone for a while).
+    if (msg->getType() == SOLICIT_MSG &&
+        !SrvAddrMgr().getLeaseSync().ownsClient(msg->getClientDUID(), now)) {
+        Log(Debug) << "SOLICIT dropped, client is served by lease sync partner." << LogEnd;
+        return;
+    }
+
     // LEASE ASSIGN STEP 1: Evaluate defined expressions (client classification)
     // Ask NodeClietSpecific to analyse the message
     NodeClientSpecific::analyseMessage(msg);
@@ -318,6 +353,18 @@ void TSrvTransMgr::relayMsg(SPtr<TSrvMsg> msg)
     // LEASE ASSIGN STEP 2: Is this client supported?
     // is this client supported? (white-list, black-list)
     if (!SrvCfgMgr().isClntSupported(msg)) {
+        Log(Notice) << "Client is not supported on " << cfgIface->getFullName()
+                    << ", message dropped." << LogEnd;
+        rejectCache.add(msg->getIface(), msg->getClientDUID(),
+                        TSrvRejectCache::REJECT_UNSUPPORTED, now);
+        return;
+    }
+
+    // RENEW/REBIND that only extends leases we already replied to: extend
+    // them in place and send the previous REPLY with new lifetimes.
+    if (leaseExtensionOnly(msg) && SrvCfgMgr().getScriptName().empty() &&
+        ReplyTemplates_.send(msg, ReplyCache_, now)) {
+        SrvAddrMgr().dumpJournal();
         return;
     }
 
@@ -411,16 +458,91 @@ void TSrvTransMgr::relayMsg(SPtr<TSrvMsg> msg)
 
         // Send the packet
         sendPacket(answ);
+        if (msg->getType() != LEASEQUERY_MSG)
+            ReplyCache_.add(msg, answ->getSentData(), answ->getSentIface(),
+                            answ->getSentPort(), now);
+        if (leaseExtensionOnly(msg))
+            ReplyTemplates_.add(msg, answ);
 
         // Call notify script
         SrvIfaceMgr().notifyScripts(SrvCfgMgr().getScriptName(), q, a);
     }
 
+    if (leaseExtensionOnly(msg)) {
+        // only lifetimes of existing leases were extended, they're journaled
+        SrvAddrMgr().dumpJournal();
+        return;
+    }
+
+    if (tempAddrsOnly(msg)) {
+        // temporary addresses are kept in memory only, nothing to store
+        return;
+    }
+
     // save DB state regardless of action taken
     SrvAddrMgr().dump();
     SrvCfgMgr().dump();
 }
 
+/**
+ * @brief checks if processing a message could only extend existing leases
+ *
+ * RENEW and REBIND only update timestamps of existing leases (see
+ * TSrvAddrMgr::journalLease()), unless they carry FQDN (DNS Update
+ * state is stored in the database) or authentication is used (SPI and
+ * replay detection are stored in the database).
+ *
+ * @param msg received message
+ *
+ * @return true if journaling lease extensions is enough
+ */
+bool TSrvTransMgr::leaseExtensionOnly(SPtr<TSrvMsg> msg) {
+    if (msg->getType() != RENEW_MSG && msg->getType() != REBIND_MSG)
+        return false;
+    if (msg->getOption(OPTION_FQDN) || msg->getOption(OPTION_AUTH))
+        return false;
+#ifndef MOD_DISABLE_AUTH
+    if (SrvCfgMgr().getDigest() != DIGEST_NONE)
+        return false;
+#endif
+    return true;
+}
+
+/**
+ * @brief checks if processing a message could only change temporary addresses
+ *
+ * If TA leases are kept in memory only (see TSrvCfgMgr::setTAMemoryOnly()),
+ * messages that carry IA_TA options, but no IA_NA or IA_PD, don't change
+ * anything stored in the database (same exceptions as in leaseExtensionOnly()
+ * apply).
+ *
+ * @param msg received message
+ *
+ * @return true if the database does not have to be dumped
+ */
+bool TSrvTransMgr::tempAddrsOnly(SPtr<TSrvMsg> msg) {
+    if (!SrvCfgMgr().getTAMemoryOnly())
+        return false;
+    if (!msg->getOption(OPTION_IA_TA) || msg->getOption(OPTION_IA_NA) ||
+        msg->getOption(OPTION_IA_PD))
+        return false;
+    if (msg->getOption(OPTION_FQDN) || msg->getOption(OPTION_AUTH))
+        return false;
+#ifndef MOD_DISABLE_AUTH
+    if (SrvCfgMgr().getDigest() != DIGEST_NONE)
+        return false;
+#endif
+    return true;
+}
+
+TSrvReplyCache& TSrvTransMgr::getReplyCache() {
+    return ReplyCache_;
+}
+
+TSrvReplyTemplates& TSrvTransMgr::getReplyTemplates() {
+    return ReplyTemplates_;
+}
+
 void TSrvTransMgr::sendPacket(SPtr<TSrvMsg> msg) {
     if (!msg) {
         return;
@@ -492,6 +614,19 @@ void TSrvTransMgr::doDuties()
         removeExpired(addrLst, tempAddrLst, prefixLst);
     }
 
+    // temporary addresses reclaimed while processing REQUESTs (already removed)
+    tempAddrLst.clear();
+    SrvAddrMgr().getReclaimedTA(tempAddrLst);
+    for (vector<TSrvAddrMgr::TExpiredInfo>::iterator addr = tempAddrLst.begin();
+         addr != tempAddrLst.end(); ++addr) {
+        TNotifyScriptParams params;
+        notifyExpireInfo(params, *addr, IATYPE_TA);
+        SrvIfaceMgr().notifyScript(SrvCfgMgr().getScriptName(), "expire", params);
+    }
+
+    // declined addresses may go back to their pools
+    SrvAddrMgr().releaseDeclined();
+
     // Open socket on interface which becames ready during server run
     if (SrvCfgMgr().inactiveMode())
     {
@@ -501,6 +636,8 @@ void TSrvTransMgr::doDuties()
             openSocket(x, port_);
     }
 
+    // exchange lease updates with the partner server
+    SrvAddrMgr().getLeaseSync().doDuties((unsigned long)time(NULL));
 }
 
 
@@ -593,6 +730,8 @@ void TSrvTransMgr::removeExpired(std::vector<TSrvAddrMgr::TExpiredInfo>& addrLst
                                addr->ia->getIAID(),
                                addr->addr, false);
 
+        SrvCfgMgr().delTAAddr(addr->ia->getIfindex());
+
         TNotifyScriptParams params;
         notifyExpireInfo(params, *addr, IATYPE_TA);
         SrvIfaceMgr().notifyScript(SrvCfgMgr().getScriptName(), "expire", params);
@@ -617,12 +756,20 @@ void TSrvTransMgr::removeExpired(std::vector<TSrvAddrMgr::TExpiredInfo>& addrLst
         SrvIfaceMgr().notifyScript(SrvCfgMgr().getScriptName(), "expire", params);
     }
 
+    // temporary addresses may be kept in memory only
+    if (addrLst.empty() && prefixLst.empty() && SrvCfgMgr().getTAMemoryOnly())
+        return;
+
     SrvAddrMgr().dump();
     SrvCfgMgr().dump();
 }
 
 void TSrvTransMgr::shutdown()
 {
+    Log(Debug) << "Reply cache: " << ReplyCache_.getHits() << " retransmission(s) answered from cache, "
+               << ReplyCache_.getMisses() << " message(s) processed." << LogEnd;
+    Log(Debug) << "Reply templates: " << ReplyTemplates_.getHits() << " RENEW/REBIND(s) answered "
+               << "with template, " << ReplyTemplates_.getMisses() << " processed." << LogEnd;
     SrvAddrMgr().dump();
     IsDone = true;
 }
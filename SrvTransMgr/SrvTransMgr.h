@@ -21,6 +21,8 @@
 #include "SrvIfaceMgr.h"
 #include "SrvCfgIface.h"
 #include "SrvAddrMgr.h"
+#include "SrvReplyCache.h"
+#include "SrvReplyTemplates.h"
 
 #define SrvTransMgr() (TSrvTransMgr::instance())
 
@@ -43,6 +45,10 @@ class TSrvTransMgr
     /// back message with only status-code=UseMulticast, client-id and server-id
     /// @return true (accept message) or false (drop it)
     bool unicastCheck(SPtr<TSrvMsg> msg);
+    bool leaseExtensionOnly(SPtr<TSrvMsg> msg);
+    bool tempAddrsOnly(SPtr<TSrvMsg> msg);
+    TSrvReplyCache& getReplyCache();
+    TSrvReplyTemplates& getReplyTemplates();
 
     void doDuties();
     void dump();
@@ -94,6 +100,9 @@ class TSrvTransMgr
     static TSrvTransMgr * Instance;
 
     int port_;
+
+    TSrvReplyCache ReplyCache_;
+    TSrvReplyTemplates ReplyTemplates_;
 };
 
 
@@ -121,11 +121,11 @@ int tcpcreateserver(_addr *socketaddr) {
     
     if ((sockid = socket(struct_pf(socketaddr), SOCK_STREAM, IPPROTO_TCP)) < 0) 
 	throw PException("Could not create TCP socket");
+    setsockopt(sockid, SOL_SOCKET, SO_REUSEADDR, (char *)&one, sizeof(one));
     if (bind(sockid, (sockaddr *)socketaddr, struct_len(socketaddr)) < 0) { 
 	closesocket(sockid); 
 	throw PException("Could not bind TCP socket"); 
     }
-    setsockopt(sockid, SOL_SOCKET, SO_REUSEADDR, (char *)&one, sizeof(one));
     setnonblock(sockid);
     if (listen(sockid, 5) < 0) { 
 	closesocket(sockid); 
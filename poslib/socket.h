@@ -88,6 +88,9 @@ void tcpreadall(int sockid, const char *buff, int len, int maxtime);
 /** Checks whether the TCP connection is still open. */
 bool tcpisopen(int sockid);
 
+/** Sets the socket to non-blocking mode. Closes the socket and throws if it fails. */
+void setnonblock(int sockid);
+
 /* address functions */
 
 /** Converts an IPv4 binary address to an _addr structure. */
@@ -18,6 +18,9 @@
 #include "HostRange.h"
 #include "assign_utils.h"
 #include <gtest/gtest.h>
+#include <set>
+#include <fstream>
+#include <stdio.h>
 
 using namespace std;
 
@@ -389,5 +392,305 @@ TEST_F(ServerTest, SARR_outpool_reservation) {
     EXPECT_TRUE( checkIA_NA(rcvIA, minRange, maxRange, 100, 1000, 2000, 3000, 4000));
 }
 
+// checks that per-interface free counter follows assignments and releases
+TEST_F(ServerTest, SARR_free_counters) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::1-2001:db8:123::4 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+    EXPECT_EQ(4u, cfgIface->getFreeAddrCount());
+    EXPECT_FALSE(cfgIface->addrPoolsExhausted());
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    // nothing is assigned after ADVERTISE
+    EXPECT_EQ(4u, cfgIface->getFreeAddrCount());
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(3u, cfgIface->getFreeAddrCount());
+
+    SPtr<TSrvOptIA_NA> rcvIA = (Ptr*) reply->getOption(OPTION_IA_NA);
+    ASSERT_TRUE(rcvIA);
+    rcvIA->delOption(OPTION_STATUS_CODE);
+
+    SPtr<TSrvMsgRelease> rel = createRelease();
+    rel->addOption((Ptr*)clntId_);
+    rel->addOption(req->getOption(OPTION_SERVERID));
+    rel->addOption((Ptr*)rcvIA);
+    sendAndReceive((Ptr*)rel, 3);
+    EXPECT_EQ(4u, cfgIface->getFreeAddrCount());
+}
+
+// checks that permutation allocator walks whole pool and fills it up
+TEST_F(ServerTest, SARR_permutation_fills_pool) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::1-2001:db8:123::8 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+    ASSERT_TRUE(SrvCfgMgr().getAddrPermutation());
+
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+    cfgIface->firstAddrClass();
+    SPtr<TSrvCfgAddrClass> cfgAddrClass = cfgIface->getAddrClass();
+    ASSERT_TRUE(cfgAddrClass);
+    EXPECT_EQ(8u, cfgAddrClass->getMaxAllocSteps());
+
+    // every address is returned once per cycle
+    set<string> addrs;
+    for (int i = 0; i < 8; i++) {
+        SPtr<TIPv6Addr> addr = cfgAddrClass->getNextAddr();
+        ASSERT_TRUE(addr);
+        EXPECT_TRUE(cfgAddrClass->addrInPool(addr));
+        addrs.insert(addr->getPlain());
+    }
+    EXPECT_EQ(8u, addrs.size());
+
+    // every client gets an address, including the one that gets the last one
+    addrs.clear();
+    unsigned int msgCount = 0;
+    for (int i = 0; i < 8; i++) {
+        char duid[32];
+        sprintf(duid, "00:01:00:0a:0b:0c:0d:0e:%02x", i + 0x20);
+        clntDuid_ = new TDUID(duid);
+        clntId_ = new TOptDUID(OPTION_CLIENTID, clntDuid_, NULL);
+
+        SPtr<TSrvMsgSolicit> sol = createSolicit();
+        sol->addOption((Ptr*)clntId_);
+        sol->addOption((Ptr*)ia_);
+        SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, ++msgCount);
+        ASSERT_TRUE(adv);
+
+        SPtr<TSrvMsgRequest> req = createRequest();
+        req->addOption((Ptr*)clntId_);
+        req->addOption((Ptr*)ia_);
+        req->addOption(adv->getOption(OPTION_SERVERID));
+        SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, ++msgCount);
+        ASSERT_TRUE(reply);
+
+        SPtr<TSrvOptIA_NA> rcvIA = (Ptr*) reply->getOption(OPTION_IA_NA);
+        ASSERT_TRUE(rcvIA);
+        SPtr<TSrvOptIAAddress> rcvAddr = (Ptr*) rcvIA->getOption(OPTION_IAADDR);
+        ASSERT_TRUE(rcvAddr);
+        addrs.insert(rcvAddr->getAddr()->getPlain());
+    }
+    EXPECT_EQ(8u, addrs.size());
+    EXPECT_EQ(0u, cfgIface->getFreeAddrCount());
+}
+
+// server that loads lease database (and replays its journal)
+class JournalSrvAddrMgr : public TSrvAddrMgr {
+public:
+    JournalSrvAddrMgr(const std::string& xmlFile)
+        :TSrvAddrMgr(xmlFile, true) {
+    }
+};
+
+// checks that RENEW only journals lease extension and that journal
+// is replayed when database is loaded
+TEST_F(ServerTest, SARR_renew_journaled) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+
+    // REQUEST causes full dump
+    EXPECT_EQ(0u, SrvAddrMgr().getJournalCount());
+
+    SPtr<TSrvMsgRenew> renew = createRenew();
+    renew->addOption((Ptr*)clntId_);
+    renew->addOption((Ptr*)ia_);
+    renew->addOption(adv->getOption(OPTION_SERVERID));
+    reply = (Ptr*)sendAndReceive((Ptr*)renew, 3);
+    ASSERT_TRUE(reply);
+
+    SPtr<TSrvOptIA_NA> rcvIA = (Ptr*) reply->getOption(OPTION_IA_NA);
+    ASSERT_TRUE(rcvIA);
+    EXPECT_TRUE(rcvIA->getOption(OPTION_IAADDR));
+    EXPECT_EQ(1u, SrvAddrMgr().getJournalCount());
+
+    // pretend the lease was extended long ago, after database was dumped
+    {
+        ofstream journal("testdata/server-AddrMgr.xml.journal");
+        journal << clntDuid_->getPlain() << " " << ia_iaid_ << " ia 12345" << endl;
+    }
+
+    JournalSrvAddrMgr loaded("testdata/server-AddrMgr.xml");
+    EXPECT_EQ(1u, loaded.getJournalCount());
+    SPtr<TAddrClient> client = loaded.getClient(clntDuid_);
+    ASSERT_TRUE(client);
+    SPtr<TAddrIA> ia = client->getIA(ia_iaid_);
+    ASSERT_TRUE(ia);
+    EXPECT_EQ(12345u, ia->getTimestamp());
+    ia->firstAddr();
+    SPtr<TAddrAddr> addr = ia->getAddr();
+    ASSERT_TRUE(addr);
+    EXPECT_EQ(12345, addr->getTimestamp());
+
+    // REBIND is journaled, too
+    SPtr<TSrvMsgRebind> rebind = createRebind();
+    rebind->addOption((Ptr*)clntId_);
+    rebind->addOption((Ptr*)ia_);
+    reply = (Ptr*)sendAndReceive((Ptr*)rebind, 4);
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(2u, SrvAddrMgr().getJournalCount());
+}
+
+// checks that lease renewed too early is not extended and that client
+// gets remaining lifetimes instead
+TEST_F(ServerTest, SARR_renew_reused) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  t1 1000\n"
+                 "  t2 2000\n"
+                 "  preferred-lifetime 3000\n"
+                 "  valid-lifetime 4000\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+    SrvCfgMgr().setLeaseReuse(50);
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(clntDuid_);
+    ASSERT_TRUE(client);
+    SPtr<TAddrIA> ia = client->getIA(ia_iaid_);
+    ASSERT_TRUE(ia);
+    ia->firstAddr();
+    SPtr<TAddrAddr> addr = ia->getAddr();
+    ASSERT_TRUE(addr);
+
+    // lease was assigned 100 seconds ago
+    unsigned long assigned = (unsigned long)time(NULL) - 100;
+    ia->setTimestamp(assigned);
+    addr->setTimestamp(assigned);
+
+    SPtr<TSrvMsgRenew> renew = createRenew();
+    renew->addOption((Ptr*)clntId_);
+    renew->addOption((Ptr*)ia_);
+    renew->addOption(adv->getOption(OPTION_SERVERID));
+    reply = (Ptr*)sendAndReceive((Ptr*)renew, 3);
+    ASSERT_TRUE(reply);
+
+    // lease is not touched, remaining lifetimes are sent
+    EXPECT_EQ(assigned, ia->getTimestamp());
+    EXPECT_EQ((long)assigned, addr->getTimestamp());
+    EXPECT_EQ(0u, SrvAddrMgr().getJournalCount());
+
+    SPtr<TSrvOptIA_NA> rcvIA = (Ptr*) reply->getOption(OPTION_IA_NA);
+    ASSERT_TRUE(rcvIA);
+    EXPECT_GE(900u, rcvIA->getT1());
+    EXPECT_LE(890u, rcvIA->getT1());
+    SPtr<TOptIAAddress> rcvAddr = (Ptr*) rcvIA->getOption(OPTION_IAADDR);
+    ASSERT_TRUE(rcvAddr);
+    EXPECT_GE(3900u, rcvAddr->getValid());
+    EXPECT_LE(3890u, rcvAddr->getValid());
+
+    // T1 has passed: lease is extended as usual
+    assigned = (unsigned long)time(NULL) - 1500;
+    ia->setTimestamp(assigned);
+    addr->setTimestamp(assigned);
+
+    // the same transaction-id is used again, so don't answer from the reply cache
+    // (nor from the reply template, REPLY is checked below)
+    transmgr_->getReplyCache().clear();
+    transmgr_->getReplyTemplates().clear();
+    reply = (Ptr*)sendAndReceive((Ptr*)renew, 4);
+    ASSERT_TRUE(reply);
+    EXPECT_LT(assigned, ia->getTimestamp());
+    EXPECT_EQ(1u, SrvAddrMgr().getJournalCount());
+
+    rcvIA = (Ptr*) reply->getOption(OPTION_IA_NA);
+    ASSERT_TRUE(rcvIA);
+    EXPECT_EQ(1000u, rcvIA->getT1());
+    rcvAddr = (Ptr*) rcvIA->getOption(OPTION_IAADDR);
+    ASSERT_TRUE(rcvAddr);
+    EXPECT_EQ(4000u, rcvAddr->getValid());
+}
+
+// checks that client rejected by class rules is remembered and its
+// retransmissions are dropped
+TEST_F(ServerTest, SARR_rejected_client_cached) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class {\n"
+                 "    reject-clients fe80::1234\n"
+                 "    pool 2001:db8:123::/64\n"
+                 "  }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    TSrvRejectCache& cache = SrvCfgMgr().getRejectCache();
+    EXPECT_EQ(0u, cache.count());
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+
+    transmgr_->relayMsg((Ptr*)sol);
+    EXPECT_EQ(0u, transmgr_->getMsgLst().size());
+    EXPECT_EQ(1u, cache.count());
+    EXPECT_EQ(TSrvRejectCache::REJECT_UNSUPPORTED,
+              cache.find(iface_->getID(), clntDuid_, (unsigned long)time(NULL)));
+
+    // retransmission is dropped using the cache
+    unsigned long hits = cache.getHits();
+    transmgr_->relayMsg((Ptr*)sol);
+    EXPECT_EQ(0u, transmgr_->getMsgLst().size());
+    EXPECT_EQ(hits + 1, cache.getHits());
+
+    // other clients are still served
+    clntDuid_ = new TDUID("00:01:00:0a:0b:0c:0d:0e:10");
+    clntId_ = new TOptDUID(OPTION_CLIENTID, clntDuid_, NULL);
+    clntAddr_ = new TIPv6Addr("fe80::1235", true);
+    sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    EXPECT_TRUE(sendAndReceive((Ptr*)sol, 1));
+}
 
 }
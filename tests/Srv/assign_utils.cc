@@ -227,7 +227,8 @@ SPtr<TSrvMsg> ServerTest::sendAndReceive(SPtr<TSrvMsg> clntMsg,
 }
 
 void NakedSrvTransMgr::sendPacket(SPtr<TSrvMsg> msg) {
-    std::cout << "Pretending to send packet" << std::endl;
+    // encoded the same way as by the real server, NakedSrvIfaceMgr keeps it
+    msg->send();
     MsgLst_.push_back(msg);
 }
 
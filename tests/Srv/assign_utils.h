@@ -57,6 +57,14 @@ namespace test {
         }
     };
 
+    /// @brief second address manager (e.g. lease sync partner), not registered as SrvAddrMgr()
+    class PartnerSrvAddrMgr: public TSrvAddrMgr {
+    public:
+        PartnerSrvAddrMgr(const std::string& xmlFile)
+            :TSrvAddrMgr(xmlFile, false) {
+        }
+    };
+
     class NakedSrvCfgMgr : public TSrvCfgMgr {
     public:
         NakedSrvCfgMgr(const std::string& config, const std::string& dbfile)
@@ -0,0 +1,148 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <unistd.h>
+#include "SrvQuarantine.h"
+#include "SrvTransMgr.h"
+#include "OptStatusCode.h"
+#include "DHCPDefaults.h"
+#include "assign_utils.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+TEST(QuarantineTest, basic) {
+    TSrvQuarantine q;
+    EXPECT_EQ(DECLINED_TIMEOUT, q.getHoldTime());
+    q.setLimits(100, 50);
+
+    SPtr<TIPv6Addr> addr1 = new TIPv6Addr("2001:db8::1", true);
+    SPtr<TIPv6Addr> addr2 = new TIPv6Addr("2001:db8::2", true);
+    SPtr<TIPv6Addr> addr3 = new TIPv6Addr("2001:db8::3", true);
+    SPtr<TIPv6Addr> other = new TIPv6Addr("2001:db8:1::1", true);
+
+    EXPECT_EQ(DHCPV6_INFINITY, q.getTimeout(1000));
+
+    // pool 7 has 4 addresses, so only 2 of them may be quarantined
+    EXPECT_TRUE(q.add(addr1, 1, 7, 4, 1000));
+    EXPECT_TRUE(q.add(addr2, 1, 7, 4, 1010));
+    EXPECT_FALSE(q.add(addr3, 1, 7, 4, 1010));
+    EXPECT_TRUE(q.add(other, 1, 8, 4, 1020)); // other pool
+    EXPECT_EQ(3u, q.count());
+    EXPECT_EQ(2u, q.count(7));
+    EXPECT_EQ(1u, q.count(8));
+
+    EXPECT_TRUE(q.contains(addr1, 1050));
+    EXPECT_FALSE(q.contains(addr3, 1050));
+    EXPECT_FALSE(q.contains(addr1, 1100)); // hold time elapsed
+    EXPECT_EQ(50u, q.getTimeout(1050));
+
+    // declined again: hold time starts over
+    EXPECT_TRUE(q.add(addr1, 1, 7, 4, 1060));
+    EXPECT_EQ(2u, q.count(7));
+
+    vector<TSrvQuarantine::TEntry> released;
+    EXPECT_EQ(0u, q.expire(1109, released));
+    EXPECT_EQ(1u, q.expire(1110, released));
+    ASSERT_EQ(1u, released.size());
+    EXPECT_EQ(string(addr2->getPlain()), released[0].Addr->getPlain());
+    EXPECT_EQ(1, released[0].Iface);
+    EXPECT_EQ(7u, released[0].PoolID);
+    EXPECT_EQ(1u, q.count(7));
+    EXPECT_EQ(10u, q.getTimeout(1110));
+
+    EXPECT_EQ(2u, q.expire(2000, released));
+    EXPECT_EQ(0u, q.count());
+    EXPECT_EQ(0u, q.count(7));
+
+    // at least one address may be quarantined even in tiny pools
+    EXPECT_TRUE(q.add(addr1, 1, 9, 1, 3000));
+
+    // huge pools don't overflow the limit
+    EXPECT_TRUE(q.add(addr2, 1, 10, DHCPV6_INFINITY, 3000));
+
+    // 0 disables quarantine
+    q.setLimits(100, 0);
+    EXPECT_FALSE(q.add(addr3, 1, 9, 4, 3000));
+}
+
+// many re-declines of the same addresses don't grow the heap forever
+TEST(QuarantineTest, redecline) {
+    TSrvQuarantine q;
+    q.setLimits(100, 100);
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8::1", true);
+    for (unsigned long now = 0; now < 100000; now++)
+        EXPECT_TRUE(q.add(addr, 1, 1, 10, now));
+    EXPECT_EQ(1u, q.count());
+
+    vector<TSrvQuarantine::TEntry> released;
+    EXPECT_EQ(0u, q.expire(100098, released));
+    EXPECT_EQ(1u, q.expire(100099, released));
+    EXPECT_EQ(DHCPV6_INFINITY, q.getTimeout(100099));
+}
+
+// checks that declined address is kept out of the pool, then returned
+TEST_F(ServerTest, SARR_decline) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::1-2001:db8:123::4 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+    SrvAddrMgr().getQuarantine().setLimits(1, 50);
+
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(3u, cfgIface->getFreeAddrCount());
+
+    SPtr<TSrvOptIA_NA> rcvIA = (Ptr*) reply->getOption(OPTION_IA_NA);
+    ASSERT_TRUE(rcvIA);
+    rcvIA->delOption(OPTION_STATUS_CODE);
+    SPtr<TSrvOptIAAddress> rcvAddr = (Ptr*) rcvIA->getOption(OPTION_IAADDR);
+    ASSERT_TRUE(rcvAddr);
+    SPtr<TIPv6Addr> declined = rcvAddr->getAddr();
+
+    SPtr<TSrvMsgDecline> decline = createDecline();
+    decline->addOption((Ptr*)clntId_);
+    decline->addOption(req->getOption(OPTION_SERVERID));
+    decline->addOption((Ptr*)rcvIA);
+    SPtr<TSrvMsgReply> declineReply = (Ptr*)sendAndReceive((Ptr*)decline, 3);
+    ASSERT_TRUE(declineReply);
+
+    // address is not leased anymore, but can't be assigned either
+    EXPECT_EQ(0u, SrvAddrMgr().getLeaseCount(clntDuid_));
+    EXPECT_FALSE(SrvAddrMgr().getClient(new TDUID("X", 1))); // no fake client
+    EXPECT_EQ(1u, SrvAddrMgr().getQuarantine().count());
+    EXPECT_FALSE(SrvAddrMgr().addrIsFree(declined));
+    EXPECT_EQ(3u, cfgIface->getFreeAddrCount());
+
+    // hold time elapsed
+    sleep(2);
+    EXPECT_EQ(1u, SrvAddrMgr().releaseDeclined());
+    EXPECT_TRUE(SrvAddrMgr().addrIsFree(declined));
+    EXPECT_EQ(4u, cfgIface->getFreeAddrCount());
+    EXPECT_EQ(0u, SrvAddrMgr().getQuarantine().count());
+}
+
+}
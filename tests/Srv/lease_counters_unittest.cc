@@ -0,0 +1,200 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <stdlib.h>
+#include <sstream>
+#include "SrvAddrMgr.h"
+#include "assign_utils.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+static const string COUNTERS_CFG =
+    "iface REPLACE_ME {\n"
+    "  class { pool 2001:db8:1::/64 }\n"
+    "  class { pool 2001:db8:2::/64 }\n"
+    "  ta-class { pool 2001:db8:3::/64 }\n"
+    "  pd-class {\n"
+    "    pd-pool 2001:db8:4::/48\n"
+    "    pd-length 64\n"
+    "  }\n"
+    "}\n";
+
+static SPtr<TIPv6Addr> addrN(const string& prefix, unsigned int n) {
+    stringstream tmp;
+    tmp << prefix << hex << n;
+    return new TIPv6Addr(tmp.str().c_str(), true);
+}
+
+// checks that counters follow additions and removals of all lease types
+TEST_F(ServerTest, leaseCounters_basic) {
+    ASSERT_TRUE( createMgrs(COUNTERS_CFG) );
+
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+    cfgIface->firstAddrClass();
+    SPtr<TSrvCfgAddrClass> class1 = cfgIface->getAddrClass();
+    SPtr<TSrvCfgAddrClass> class2 = cfgIface->getAddrClass();
+    ASSERT_TRUE(class1 && class2);
+
+    SPtr<TDUID> other = new TDUID("00:01:00:00:00:00:00:00:00:00:00:01");
+    int ifindex = iface_->getID();
+
+    EXPECT_EQ(0u, addrmgr_->getLeaseCount(clntDuid_));
+
+    ASSERT_TRUE(addrmgr_->addClntAddr(clntDuid_, clntAddr_, ifindex, 1, 100, 200,
+                                      addrN("2001:db8:1::", 1), 300, 400, true));
+    ASSERT_TRUE(addrmgr_->addClntAddr(clntDuid_, clntAddr_, ifindex, 1, 100, 200,
+                                      addrN("2001:db8:2::", 1), 300, 400, true));
+    ASSERT_TRUE(addrmgr_->addTAAddr(clntDuid_, clntAddr_, ifindex, 2,
+                                    addrN("2001:db8:3::", 1), 300, 400));
+    ASSERT_TRUE(addrmgr_->addPrefix(clntDuid_, clntAddr_, iface_->getName(), ifindex, 3,
+                                    100, 200, new TIPv6Addr("2001:db8:4::", true),
+                                    300, 400, 64, true));
+    ASSERT_TRUE(addrmgr_->addClntAddr(other, clntAddr_, ifindex, 1, 100, 200,
+                                      addrN("2001:db8:1::", 2), 300, 400, true));
+
+    // duplicates are not counted
+    EXPECT_FALSE(addrmgr_->addClntAddr(other, clntAddr_, ifindex, 1, 100, 200,
+                                       addrN("2001:db8:1::", 2), 300, 400, true));
+
+    EXPECT_EQ(4u, addrmgr_->getLeaseCount(clntDuid_));
+    EXPECT_EQ(1u, addrmgr_->getLeaseCount(other));
+
+    TSrvAddrMgr::TLeaseCounters c = addrmgr_->getLeaseCounters(clntDuid_);
+    EXPECT_EQ(2u, c.Addrs);
+    EXPECT_EQ(1u, c.TempAddrs);
+    EXPECT_EQ(1u, c.Prefixes);
+    EXPECT_EQ(1u, c.Classes[class1->getID()]);
+    EXPECT_EQ(1u, c.Classes[class2->getID()]);
+
+    const TSrvAddrMgr::TLeaseCounters& total = addrmgr_->getLeaseCounters();
+    EXPECT_EQ(3u, total.Addrs);
+    EXPECT_EQ(1u, total.TempAddrs);
+    EXPECT_EQ(1u, total.Prefixes);
+    EXPECT_EQ(2u, addrmgr_->getClassLeaseCount(class1->getID()));
+    EXPECT_EQ(1u, addrmgr_->getClassLeaseCount(class2->getID()));
+
+    SPtr<List(TSrvCfgAddrClass)> classes = new List(TSrvCfgAddrClass);
+    classes->append(class1);
+    classes->append(class2);
+    long clntCnt[2], addrCnt[2];
+    addrmgr_->getAddrsCount(classes, clntCnt, addrCnt, clntDuid_, ifindex);
+    EXPECT_EQ(1, clntCnt[0]);
+    EXPECT_EQ(1, clntCnt[1]);
+    EXPECT_EQ(2, addrCnt[0]);
+    EXPECT_EQ(1, addrCnt[1]);
+
+    EXPECT_TRUE(addrmgr_->verifyLeaseCounters());
+
+    // failed removals don't change anything
+    EXPECT_FALSE(addrmgr_->delClntAddr(clntDuid_, 1, addrN("2001:db8:1::", 7), true));
+    EXPECT_EQ(4u, addrmgr_->getLeaseCount(clntDuid_));
+
+    EXPECT_TRUE(addrmgr_->delClntAddr(clntDuid_, 1, addrN("2001:db8:1::", 1), true));
+    EXPECT_TRUE(addrmgr_->delTAAddr(clntDuid_, 2, addrN("2001:db8:3::", 1), true));
+    EXPECT_EQ(2u, addrmgr_->getLeaseCount(clntDuid_));
+    EXPECT_EQ(1u, addrmgr_->getClassLeaseCount(class1->getID()));
+    EXPECT_TRUE(addrmgr_->verifyLeaseCounters());
+
+    EXPECT_TRUE(addrmgr_->delClntAddr(clntDuid_, 1, addrN("2001:db8:2::", 1), true));
+    EXPECT_TRUE(addrmgr_->delPrefix(clntDuid_, 3, new TIPv6Addr("2001:db8:4::", true), true));
+    EXPECT_TRUE(addrmgr_->delClntAddr(other, 1, addrN("2001:db8:1::", 2), true));
+    EXPECT_EQ(0u, addrmgr_->getLeaseCount(clntDuid_));
+    EXPECT_EQ(0u, addrmgr_->getLeaseCount(other));
+    EXPECT_EQ(0u, addrmgr_->getLeaseCounters().total());
+    EXPECT_EQ(0u, addrmgr_->getClassLeaseCount(class1->getID()));
+    EXPECT_TRUE(addrmgr_->verifyLeaseCounters());
+}
+
+// checks that counters stay consistent with the database during random churn
+TEST_F(ServerTest, leaseCounters_churn) {
+    ASSERT_TRUE( createMgrs(COUNTERS_CFG) );
+    int ifindex = iface_->getID();
+
+    srand(1);
+    for (unsigned int i = 0; i < 2000; i++) {
+        stringstream duidTxt;
+        duidTxt << "00:01:00:00:00:00:00:00:00:00:00:" << hex << (rand() % 8 + 16);
+        SPtr<TDUID> duid = new TDUID(duidTxt.str().c_str());
+        unsigned long iaid = rand() % 3;
+        unsigned int n = rand() % 16 + 1;
+        bool add = rand() % 2;
+
+        switch (rand() % 4) {
+        case 0:
+        case 1: {
+            SPtr<TIPv6Addr> addr = addrN(n % 2 ? "2001:db8:1::" : "2001:db8:2::", n);
+            if (add)
+                addrmgr_->addClntAddr(duid, clntAddr_, ifindex, iaid, 100, 200, addr,
+                                      300, 400, true);
+            else
+                addrmgr_->delClntAddr(duid, iaid, addr, true);
+            break;
+        }
+        case 2: {
+            SPtr<TIPv6Addr> addr = addrN("2001:db8:3::", n);
+            if (add)
+                addrmgr_->addTAAddr(duid, clntAddr_, ifindex, iaid, addr, 300, 400);
+            else
+                addrmgr_->delTAAddr(duid, iaid, addr, true);
+            break;
+        }
+        case 3: {
+            stringstream tmp;
+            tmp << "2001:db8:4:" << hex << n << "::";
+            SPtr<TIPv6Addr> prefix = new TIPv6Addr(tmp.str().c_str(), true);
+            if (add)
+                addrmgr_->addPrefix(duid, clntAddr_, iface_->getName(), ifindex, iaid, 100, 200,
+                                    prefix, 300, 400, 64, true);
+            else
+                addrmgr_->delPrefix(duid, iaid, prefix, true);
+            break;
+        }
+        }
+
+        if (i % 100 == 0)
+            ASSERT_TRUE(addrmgr_->verifyLeaseCounters()) << "after " << i << " operations";
+    }
+    EXPECT_TRUE(addrmgr_->verifyLeaseCounters());
+}
+
+// checks that per-client limit is enforced using counters
+TEST_F(ServerTest, leaseCounters_request) {
+    ASSERT_TRUE( createMgrs(COUNTERS_CFG) );
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    sol->addOption((Ptr*)pd_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    // SOLICIT doesn't leave anything behind
+    EXPECT_EQ(0u, addrmgr_->getLeaseCount(clntDuid_));
+    EXPECT_TRUE(addrmgr_->verifyLeaseCounters());
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption((Ptr*)pd_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+
+    TSrvAddrMgr::TLeaseCounters c = addrmgr_->getLeaseCounters(clntDuid_);
+    EXPECT_EQ(1u, c.Addrs);
+    EXPECT_EQ(1u, c.Prefixes);
+    EXPECT_EQ(2u, addrmgr_->getLeaseCount(clntDuid_));
+    EXPECT_TRUE(addrmgr_->verifyLeaseCounters());
+}
+
+}
@@ -0,0 +1,328 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include "SrvAddrMgr.h"
+#include "SrvLeaseSync.h"
+#include "AddrClient.h"
+#include "AddrIA.h"
+#include "DHCPDefaults.h"
+#include "assign_utils.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+/// lets both servers do their duties for a while
+static void exchange(TSrvLeaseSync& a, TSrvLeaseSync& b, int rounds = 20) {
+    for (int i = 0; i < rounds; i++) {
+        unsigned long now = (unsigned long)time(NULL);
+        a.doDuties(now);
+        b.doDuties(now);
+        usleep(5000);
+    }
+}
+
+/// waits until both servers are connected
+static bool connect(TSrvLeaseSync& a, TSrvLeaseSync& b) {
+    for (int i = 0; i < 200; i++) {
+        exchange(a, b, 1);
+        if (a.isConnected() && b.isConnected())
+            return true;
+    }
+    return false;
+}
+
+static bool hasAddr(TSrvAddrMgr& mgr, SPtr<TDUID> duid, unsigned long iaid,
+                    SPtr<TIPv6Addr> addr) {
+    SPtr<TAddrClient> client = mgr.getClient(duid);
+    if (!client)
+        return false;
+    SPtr<TAddrIA> ia = client->getIA(iaid);
+    return ia && ia->getAddr(addr);
+}
+
+static bool hasTAAddr(TSrvAddrMgr& mgr, SPtr<TDUID> duid, unsigned long iaid,
+                      SPtr<TIPv6Addr> addr) {
+    SPtr<TAddrClient> client = mgr.getClient(duid);
+    if (!client)
+        return false;
+    SPtr<TAddrIA> ta = client->getTA(iaid);
+    return ta && ta->getAddr(addr);
+}
+
+// checks that leases added, extended and deleted on one server appear on the other
+TEST_F(ServerTest, LeaseSync_basic) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    PartnerSrvAddrMgr partner("testdata/server-AddrMgr-partner.xml");
+    TSrvLeaseSync& primary = addrmgr_->getLeaseSync();
+    TSrvLeaseSync& secondary = partner.getLeaseSync();
+
+    SPtr<TIPv6Addr> loopback = new TIPv6Addr("::1", true);
+    unsigned short port = 10000 + SERVER_DEFAULT_LEASE_SYNC_PORT;
+
+    // lease assigned before servers are connected is sent in bulk
+    SPtr<TIPv6Addr> addr1 = new TIPv6Addr("2001:db8:123::1", true);
+    ASSERT_TRUE(addrmgr_->addClntAddr(clntDuid_, clntAddr_, iface_->getID(), 100, 1000, 2000,
+                                      addr1, 3000, 4000, false));
+
+    ASSERT_TRUE(secondary.start(TSrvLeaseSync::ROLE_SECONDARY, loopback, port));
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port));
+    ASSERT_TRUE(connect(primary, secondary));
+    exchange(primary, secondary);
+
+    EXPECT_TRUE(hasAddr(partner, clntDuid_, 100, addr1));
+    EXPECT_EQ(1u, primary.getSent());
+
+    // new lease on the secondary is sent to the primary
+    SPtr<TIPv6Addr> addr2 = new TIPv6Addr("2001:db8:123::2", true);
+    ASSERT_TRUE(partner.addClntAddr(clntDuid_, clntAddr_, iface_->getID(), 101, 1000, 2000,
+                                    addr2, 3000, 4000, false));
+    exchange(primary, secondary);
+    EXPECT_TRUE(hasAddr(*addrmgr_, clntDuid_, 101, addr2));
+
+    // leases added quietly (while handling SOLICIT) are not sent
+    SPtr<TIPv6Addr> addr3 = new TIPv6Addr("2001:db8:123::3", true);
+    ASSERT_TRUE(addrmgr_->addClntAddr(clntDuid_, clntAddr_, iface_->getID(), 102, 1000, 2000,
+                                      addr3, 3000, 4000, true));
+    exchange(primary, secondary);
+    EXPECT_FALSE(hasAddr(partner, clntDuid_, 102, addr3));
+    ASSERT_TRUE(addrmgr_->delClntAddr(clntDuid_, 102, addr3, true));
+
+    // lifetime extension
+    SPtr<TAddrIA> ia = addrmgr_->getClient(clntDuid_)->getIA(100);
+    ASSERT_TRUE(ia);
+    unsigned long ts = ia->getTimestamp() + 100;
+    ia->setTimestamp(ts);
+    addrmgr_->journalLease(clntDuid_, ia, IATYPE_IA);
+    exchange(primary, secondary);
+    SPtr<TAddrIA> partnerIA = partner.getClient(clntDuid_)->getIA(100);
+    ASSERT_TRUE(partnerIA);
+    EXPECT_EQ(ts, partnerIA->getTimestamp());
+    EXPECT_EQ(ts, (unsigned long)partnerIA->getAddr(addr1)->getTimestamp());
+
+    // release
+    ASSERT_TRUE(addrmgr_->delClntAddr(clntDuid_, 100, addr1, false));
+    exchange(primary, secondary);
+    EXPECT_FALSE(hasAddr(partner, clntDuid_, 100, addr1));
+    EXPECT_TRUE(hasAddr(partner, clntDuid_, 101, addr2));
+
+    // leases assigned while disconnected are sent after reconnect
+    primary.stop();
+    exchange(primary, secondary);
+    EXPECT_FALSE(secondary.isConnected());
+
+    SPtr<TIPv6Addr> addr4 = new TIPv6Addr("2001:db8:123::4", true);
+    ASSERT_TRUE(addrmgr_->addClntAddr(clntDuid_, clntAddr_, iface_->getID(), 103, 1000, 2000,
+                                      addr4, 3000, 4000, false));
+    EXPECT_FALSE(hasAddr(partner, clntDuid_, 103, addr4));
+
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port));
+    ASSERT_TRUE(connect(primary, secondary));
+    exchange(primary, secondary);
+    EXPECT_TRUE(hasAddr(partner, clntDuid_, 103, addr4));
+
+    primary.stop();
+    secondary.stop();
+}
+
+// checks that addresses and clients are split between partners
+TEST_F(ServerTest, LeaseSync_ownership) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    PartnerSrvAddrMgr partner("testdata/server-AddrMgr-partner.xml");
+    TSrvLeaseSync& primary = addrmgr_->getLeaseSync();
+    TSrvLeaseSync& secondary = partner.getLeaseSync();
+
+    // not synchronized: everything is ours
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8:123::1", true);
+    EXPECT_TRUE(primary.ownsAddr(addr, (unsigned long)time(NULL)));
+    EXPECT_TRUE(primary.ownsClient(clntDuid_, (unsigned long)time(NULL)));
+
+    SPtr<TIPv6Addr> loopback = new TIPv6Addr("::1", true);
+    unsigned short port = 10001 + SERVER_DEFAULT_LEASE_SYNC_PORT;
+    ASSERT_TRUE(secondary.start(TSrvLeaseSync::ROLE_SECONDARY, loopback, port));
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port));
+    ASSERT_TRUE(connect(primary, secondary));
+
+    unsigned long now = (unsigned long)time(NULL);
+    unsigned int owned = 0;
+    SPtr<TIPv6Addr> partnerAddr;
+    for (int i = 1; i <= 64; i++) {
+        addr = new TIPv6Addr("2001:db8:123::", true);
+        addr->getAddr()[15] = (char)i;
+        EXPECT_NE(primary.ownsAddr(addr, now), secondary.ownsAddr(addr, now));
+        EXPECT_EQ(primary.ownsAddr(addr, now), addrmgr_->addrIsFree(addr));
+        EXPECT_EQ(primary.ownsAddr(addr, now), addrmgr_->taAddrIsFree(addr));
+        if (primary.ownsAddr(addr, now))
+            owned++;
+        else
+            partnerAddr = addr;
+    }
+    EXPECT_LT(16u, owned);
+    EXPECT_GT(48u, owned);
+    ASSERT_TRUE(partnerAddr);
+
+    EXPECT_NE(primary.ownsClient(clntDuid_, now), secondary.ownsClient(clntDuid_, now));
+
+    // partner is gone for a while: its clients and addresses are taken over
+    secondary.stop();
+    exchange(primary, secondary);
+    EXPECT_FALSE(primary.isConnected());
+    EXPECT_FALSE(primary.ownsAddr(partnerAddr, now));
+    now += SERVER_DEFAULT_LEASE_SYNC_TAKEOVER + 1;
+    EXPECT_TRUE(primary.ownsClient(clntDuid_, now));
+    EXPECT_TRUE(primary.ownsAddr(partnerAddr, now));
+
+    primary.stop();
+}
+
+// checks that temporary addresses are synchronized, too
+TEST_F(ServerTest, LeaseSync_ta) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "  ta-class { pool 2001:db8:456::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    PartnerSrvAddrMgr partner("testdata/server-AddrMgr-partner.xml");
+    TSrvLeaseSync& primary = addrmgr_->getLeaseSync();
+    TSrvLeaseSync& secondary = partner.getLeaseSync();
+
+    SPtr<TIPv6Addr> loopback = new TIPv6Addr("::1", true);
+    unsigned short port = 10002 + SERVER_DEFAULT_LEASE_SYNC_PORT;
+    ASSERT_TRUE(secondary.start(TSrvLeaseSync::ROLE_SECONDARY, loopback, port));
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port));
+    ASSERT_TRUE(connect(primary, secondary));
+
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8:456::1", true);
+    ASSERT_TRUE(addrmgr_->addTAAddr(clntDuid_, clntAddr_, iface_->getID(), 200, addr,
+                                    3000, 4000));
+    exchange(primary, secondary);
+    EXPECT_TRUE(hasTAAddr(partner, clntDuid_, 200, addr));
+    EXPECT_TRUE(partner.taAddrIsLeased(addr));
+
+    ASSERT_TRUE(addrmgr_->delTAAddr(clntDuid_, 200, addr, false));
+    exchange(primary, secondary);
+    EXPECT_FALSE(hasTAAddr(partner, clntDuid_, 200, addr));
+    EXPECT_FALSE(partner.taAddrIsLeased(addr));
+
+    primary.stop();
+    secondary.stop();
+}
+
+// checks that partners with a secret connect only if they share it
+TEST_F(ServerTest, LeaseSync_secret) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    PartnerSrvAddrMgr partner("testdata/server-AddrMgr-partner.xml");
+    TSrvLeaseSync& primary = addrmgr_->getLeaseSync();
+    TSrvLeaseSync& secondary = partner.getLeaseSync();
+
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8:123::1", true);
+    ASSERT_TRUE(addrmgr_->addClntAddr(clntDuid_, clntAddr_, iface_->getID(), 100, 1000, 2000,
+                                      addr, 3000, 4000, false));
+
+    const char* secretData = "secret";
+    const char* otherData = "other secret";
+    TKey secret(secretData, secretData + strlen(secretData));
+    TKey other(otherData, otherData + strlen(otherData));
+
+    SPtr<TIPv6Addr> loopback = new TIPv6Addr("::1", true);
+    unsigned short port = 10003 + SERVER_DEFAULT_LEASE_SYNC_PORT;
+
+    // different secrets: nothing is exchanged
+    ASSERT_TRUE(secondary.start(TSrvLeaseSync::ROLE_SECONDARY, loopback, port, other));
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port, secret));
+    EXPECT_FALSE(connect(primary, secondary));
+    EXPECT_FALSE(hasAddr(partner, clntDuid_, 100, addr));
+    EXPECT_EQ(0u, secondary.getReceived());
+
+    // secret on one side only
+    ASSERT_TRUE(secondary.start(TSrvLeaseSync::ROLE_SECONDARY, loopback, port));
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port, secret));
+    EXPECT_FALSE(connect(primary, secondary));
+    EXPECT_FALSE(hasAddr(partner, clntDuid_, 100, addr));
+
+    // same secret
+    ASSERT_TRUE(secondary.start(TSrvLeaseSync::ROLE_SECONDARY, loopback, port, secret));
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port, secret));
+    ASSERT_TRUE(connect(primary, secondary));
+    exchange(primary, secondary);
+    EXPECT_TRUE(hasAddr(partner, clntDuid_, 100, addr));
+
+    primary.stop();
+    secondary.stop();
+}
+
+// checks that whole database is sent in batches, not queued at once
+TEST_F(ServerTest, LeaseSync_resyncBatches) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    PartnerSrvAddrMgr partner("testdata/server-AddrMgr-partner.xml");
+    TSrvLeaseSync& primary = addrmgr_->getLeaseSync();
+    TSrvLeaseSync& secondary = partner.getLeaseSync();
+
+    // each client is a few hundred bytes, so this is more than one batch
+    const int clients = 2000;
+    for (int i = 0; i < clients; i++) {
+        char duid[] = { 0x00, 0x01, 0x02, 0x03, (char)(i >> 8), (char)i };
+        SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8:123::", true);
+        addr->getAddr()[14] = (char)(i >> 8);
+        addr->getAddr()[15] = (char)i;
+        ASSERT_TRUE(addrmgr_->addClntAddr(new TDUID(duid, sizeof(duid)), clntAddr_,
+                                          iface_->getID(), 100, 1000, 2000, addr,
+                                          3000, 4000, false));
+    }
+
+    SPtr<TIPv6Addr> loopback = new TIPv6Addr("::1", true);
+    unsigned short port = 10004 + SERVER_DEFAULT_LEASE_SYNC_PORT;
+    ASSERT_TRUE(secondary.start(TSrvLeaseSync::ROLE_SECONDARY, loopback, port));
+    ASSERT_TRUE(primary.start(TSrvLeaseSync::ROLE_PRIMARY, loopback, port));
+    ASSERT_TRUE(connect(primary, secondary));
+
+    // leases are queued as the connection drains, a batch at a time
+    for (int i = 0; i < 200 && partner.countClient() < clients; i++) {
+        EXPECT_GE(65536u + 1024u, primary.getQueued());
+        exchange(primary, secondary, 1);
+    }
+    EXPECT_EQ((unsigned long)clients, primary.getSent());
+    EXPECT_EQ(clients, partner.countClient());
+
+    primary.stop();
+    secondary.stop();
+}
+
+}
@@ -0,0 +1,161 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "SrvLoad.h"
+#include "SrvCfgMgr.h"
+#include "OptInteger.h"
+#include "OptOptionRequest.h"
+#include "OptStatusCode.h"
+#include "OptDUID.h"
+#include "DHCPDefaults.h"
+#include "assign_utils.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+TEST(SrvLoadTest, levels) {
+    TSrvLoad load;
+    load.setThresholds(8, 0);
+
+    uint64_t t = 1000000;
+    EXPECT_EQ(TSrvLoad::LOAD_NORMAL, load.getLevel());
+
+    // server waits for every message: no backlog
+    for (int i = 0; i < 20; i++) {
+        load.update(t, t + 50000, true);
+        t += 50100;
+    }
+    EXPECT_EQ(0u, load.getBacklog());
+    EXPECT_EQ(TSrvLoad::LOAD_NORMAL, load.getLevel());
+
+    // messages are waiting in the queue
+    load.update(t, t + 10, true);
+    load.update(t + 100, t + 110, true);
+    EXPECT_EQ(2u, load.getBacklog());
+    EXPECT_EQ(TSrvLoad::LOAD_BUSY, load.getLevel());
+
+    t += 200;
+    for (int i = 0; i < 6; i++) {
+        load.update(t, t + 10, true);
+        t += 100;
+    }
+    EXPECT_EQ(8u, load.getBacklog());
+    EXPECT_EQ(TSrvLoad::LOAD_OVERLOADED, load.getLevel());
+
+    // queue drained, but level is kept for a while
+    load.update(t, t + 1000000, false);
+    EXPECT_EQ(0u, load.getBacklog());
+    EXPECT_EQ(TSrvLoad::LOAD_OVERLOADED, load.getLevel());
+
+    t += (uint64_t)SERVER_DEFAULT_LOAD_HOLD * 1000000 + 1000000;
+    load.update(t, t + 1000000, false);
+    EXPECT_EQ(TSrvLoad::LOAD_NORMAL, load.getLevel());
+}
+
+TEST(SrvLoadTest, latency) {
+    TSrvLoad load;
+    load.setThresholds(0, 400);
+
+    // every message takes 200ms to process
+    uint64_t t = 1000000;
+    for (int i = 0; i < 3; i++) {
+        load.update(t, t + 10, true);
+        t += 200010;
+    }
+    EXPECT_EQ(TSrvLoad::LOAD_OVERLOADED, load.getLevel());
+    EXPECT_LE(400u, load.getLatency());
+}
+
+TEST(SrvLoadTest, getMaxRT) {
+    TSrvLoad load;
+    load.setMaxRT(1000, 5000);
+    load.setThresholds(4, 0);
+
+    // not loaded: configured value is used (0 means not sent)
+    EXPECT_EQ(0u, load.getMaxRT(0, false));
+    EXPECT_EQ(600u, load.getMaxRT(600, false));
+    EXPECT_EQ(5000u, load.getMaxRT(600, true));
+
+    uint64_t t = 1000000;
+    load.update(t, t + 10, true);
+    EXPECT_EQ(TSrvLoad::LOAD_BUSY, load.getLevel());
+    EXPECT_EQ(1000u, load.getMaxRT(0, false));
+    EXPECT_EQ(2000u, load.getMaxRT(2000, false));
+
+    for (int i = 0; i < 4; i++)
+        load.update(t, t + 10, true);
+    EXPECT_EQ(TSrvLoad::LOAD_OVERLOADED, load.getLevel());
+    EXPECT_EQ(5000u, load.getMaxRT(0, false));
+    EXPECT_EQ(86400u, load.getMaxRT(86400, false));
+}
+
+// checks that SOLICIT sent when pool is exhausted gets quick NoAddrsAvail
+// and a SOL_MAX_RT telling client to back off
+TEST_F(ServerTest, SARR_pool_exhausted) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::1-2001:db8:123::1 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    SPtr<TOptOptionRequest> oro = new TOptOptionRequest(OPTION_ORO, NULL);
+    oro->addOption(OPTION_SOL_MAX_RT);
+
+    // first client gets the only address
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    sol->addOption((Ptr*)oro);
+
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+    EXPECT_FALSE(adv->getOption(OPTION_SOL_MAX_RT)); // nothing configured, no load
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+    EXPECT_TRUE(cfgIface->addrPoolsExhausted());
+
+    // second client
+    clntDuid_ = new TDUID("00:01:00:0a:0b:0c:0d:0e:10");
+    clntId_ = new TOptDUID(OPTION_CLIENTID, clntDuid_, NULL);
+    oro = new TOptOptionRequest(OPTION_ORO, NULL);
+    oro->addOption(OPTION_SOL_MAX_RT);
+
+    sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    sol->addOption((Ptr*)oro);
+
+    adv = (Ptr*)sendAndReceive((Ptr*)sol, 3);
+    ASSERT_TRUE(adv);
+
+    SPtr<TSrvOptIA_NA> rcvIA = (Ptr*) adv->getOption(OPTION_IA_NA);
+    ASSERT_TRUE(rcvIA);
+    EXPECT_FALSE(rcvIA->getOption(OPTION_IAADDR));
+    SPtr<TOptStatusCode> status = (Ptr*) rcvIA->getOption(OPTION_STATUS_CODE);
+    ASSERT_TRUE(status);
+    EXPECT_EQ(STATUSCODE_NOADDRSAVAIL, status->getCode());
+
+    SPtr<TOptInteger> maxRT = (Ptr*) adv->getOption(OPTION_SOL_MAX_RT);
+    ASSERT_TRUE(maxRT);
+    EXPECT_EQ(unsigned(SERVER_DEFAULT_OVERLOAD_MAX_RT), maxRT->getValue());
+}
+
+}
@@ -0,0 +1,132 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "assign_utils.h"
+#include "OptGeneric.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+/// exposes protected option handling
+class NakedMsg : public TMsg {
+public:
+    NakedMsg()
+        :TMsg(1, new TIPv6Addr("fe80::1", true), SOLICIT_MSG) {
+    }
+    std::string getName() const { return "NAKED"; }
+    using TMsg::delOption;
+    using TMsg::check;
+    using TMsg::optionsChanged;
+    using TMsg::Options;
+};
+
+TOptPtr opt(int type) {
+    char data = 0;
+    return new TOptGeneric(type, &data, 1, NULL);
+}
+
+TEST(MsgOptionsTest, index) {
+    NakedMsg msg;
+    EXPECT_FALSE(msg.getOption(OPTION_CLIENTID));
+    EXPECT_EQ(0u, msg.countOption(OPTION_CLIENTID));
+
+    TOptPtr ia1 = opt(OPTION_IA_NA);
+    TOptPtr ia2 = opt(OPTION_IA_NA);
+    TOptPtr high = opt(200); // beyond presence bitmap
+    msg.addOption(opt(OPTION_CLIENTID));
+    msg.addOption(ia1);
+    msg.addOption(high);
+    msg.addOption(ia2);
+    msg.addOption(opt(OPTION_IA_NA));
+    EXPECT_EQ(5, msg.countOption());
+
+    EXPECT_TRUE(msg.getOption(OPTION_CLIENTID));
+    EXPECT_TRUE(ia1.get() == msg.getOption(OPTION_IA_NA).get()); // first occurrence
+    EXPECT_EQ(3u, msg.countOption(OPTION_IA_NA));
+    EXPECT_TRUE(high.get() == msg.getOption(200).get());
+    EXPECT_FALSE(msg.getOption(OPTION_SERVERID));
+    EXPECT_FALSE(msg.getOption(201));
+    EXPECT_FALSE(msg.getOption(63));
+
+    // deleting first occurrence makes the next one first
+    EXPECT_TRUE(msg.delOption(OPTION_IA_NA));
+    EXPECT_TRUE(ia2.get() == msg.getOption(OPTION_IA_NA).get());
+    EXPECT_EQ(2u, msg.countOption(OPTION_IA_NA));
+    EXPECT_TRUE(msg.delOption(OPTION_IA_NA));
+    EXPECT_TRUE(msg.delOption(OPTION_IA_NA));
+    EXPECT_FALSE(msg.delOption(OPTION_IA_NA));
+    EXPECT_FALSE(msg.getOption(OPTION_IA_NA));
+    EXPECT_TRUE(msg.delOption(200));
+    EXPECT_FALSE(msg.getOption(200));
+    EXPECT_EQ(1, msg.countOption());
+
+    // direct changes of the list
+    msg.getOptLst().push_back(opt(OPTION_SERVERID));
+    EXPECT_TRUE(msg.getOption(OPTION_SERVERID));
+    TOptPtr auth = opt(OPTION_AUTH);
+    msg.Options.front() = auth;
+    msg.optionsChanged();
+    EXPECT_FALSE(msg.getOption(OPTION_CLIENTID));
+    EXPECT_TRUE(auth.get() == msg.getOption(OPTION_AUTH).get());
+}
+
+TEST(MsgOptionsTest, check) {
+    NakedMsg msg;
+    msg.addOption(opt(OPTION_CLIENTID));
+    EXPECT_TRUE(msg.check(true, false));
+    EXPECT_FALSE(msg.check(true, true)); // server-id missing
+
+    msg.addOption(opt(OPTION_SERVERID));
+    EXPECT_TRUE(msg.check(true, true));
+    EXPECT_FALSE(msg.check(true, false)); // server-id not allowed
+
+    msg.addOption(opt(OPTION_CLIENTID));
+    EXPECT_FALSE(msg.check(true, true)); // duplicate client-id
+
+    msg.delOption(OPTION_CLIENTID);
+    msg.addOption(opt(OPTION_AUTH));
+    msg.addOption(opt(OPTION_AUTH));
+    EXPECT_FALSE(msg.check(true, true)); // duplicate auth
+    msg.delOption(OPTION_AUTH);
+    EXPECT_TRUE(msg.check(true, true));
+}
+
+// decoder fills the index while parsing
+TEST_F(ServerTest, msgOptionIndexDecoded) {
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+
+    char buf[1024];
+    int len = sol->storeSelf(buf);
+    ASSERT_LT(4, len);
+    SPtr<TSrvMsgSolicit> rcvd = new TSrvMsgSolicit(iface_->getID(), clntAddr_, buf, len);
+
+    EXPECT_EQ(sol->countOption(), rcvd->countOption());
+    EXPECT_TRUE(rcvd->getOption(OPTION_CLIENTID));
+    EXPECT_TRUE(rcvd->getOption(OPTION_IA_NA));
+    EXPECT_EQ(1u, rcvd->countOption(OPTION_CLIENTID));
+    EXPECT_EQ(1u, rcvd->countOption(OPTION_IA_NA));
+    EXPECT_FALSE(rcvd->getOption(OPTION_SERVERID));
+    EXPECT_FALSE(rcvd->getOption(OPTION_FQDN));
+
+    // every option on the list is found
+    const TOptList& opts = rcvd->getOptLst();
+    for (TOptList::const_iterator it = opts.begin(); it != opts.end(); ++it)
+        EXPECT_TRUE(rcvd->getOption((*it)->getOptType())) << (*it)->getOptType();
+}
+
+}
@@ -0,0 +1,218 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "SrvTransMgr.h"
+#include "SrvReplyTemplates.h"
+#include "Portable.h"
+#include "assign_utils.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+// returns offset of the first option with specified code (or 0 if there's none)
+static size_t findOpt(const string& data, size_t pos, size_t end, int code) {
+    while (pos + 4 <= end) {
+        if (readUint16(data.c_str() + pos) == code)
+            return pos;
+        pos += 4 + readUint16(data.c_str() + pos + 2);
+    }
+    return 0;
+}
+
+// checks that the same RENEW is answered with REPLY template: leases are
+// extended in place and REPLY differs only in transaction-id and lifetimes
+TEST_F(ServerTest, RenewTemplate_renew) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  t1 1000\n"
+                 "  t2 2000\n"
+                 "  preferred-lifetime 3000\n"
+                 "  valid-lifetime 4000\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    TSrvReplyTemplates& templates = transmgr_->getReplyTemplates();
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    ASSERT_TRUE(sendAndReceive((Ptr*)req, 2));
+
+    // REPLY to REQUEST is not a template
+    EXPECT_EQ(0u, templates.count());
+
+    SPtr<TSrvMsgRenew> renew = createRenew();
+    renew->addOption((Ptr*)clntId_);
+    renew->addOption((Ptr*)ia_);
+    renew->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)renew, 3);
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(1u, templates.count());
+    EXPECT_EQ(1u, SrvAddrMgr().getJournalCount());
+
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(clntDuid_);
+    ASSERT_TRUE(client);
+    SPtr<TAddrIA> ia = client->getIA(ia_iaid_);
+    ASSERT_TRUE(ia);
+    ia->firstAddr();
+    SPtr<TAddrAddr> addr = ia->getAddr();
+    ASSERT_TRUE(addr);
+
+    // lease was extended long ago
+    unsigned long assigned = (unsigned long)time(NULL) - 1500;
+    ia->setTimestamp(assigned);
+    addr->setTimestamp(assigned);
+
+    // next RENEW (new transaction) is answered with template, not processed
+    char hdr[] = { RENEW_MSG, 0x1, 0x2, 0x9 };
+    SPtr<TSrvMsgRenew> renew2 = new TSrvMsgRenew(iface_->getID(), clntAddr_, hdr, sizeof(hdr));
+    renew2->addOption((Ptr*)clntId_);
+    renew2->addOption((Ptr*)ia_);
+    renew2->addOption(adv->getOption(OPTION_SERVERID));
+
+    size_t sent = ifacemgr_->sent_pkts_.size();
+    transmgr_->relayMsg((Ptr*)renew2);
+    EXPECT_EQ(3u, transmgr_->getMsgLst().size());
+    EXPECT_EQ(1u, templates.getHits());
+    ASSERT_EQ(sent + 1, ifacemgr_->sent_pkts_.size());
+
+    // lease is extended and journaled
+    EXPECT_LT(assigned, ia->getTimestamp());
+    EXPECT_EQ((long)ia->getTimestamp(), addr->getTimestamp());
+    EXPECT_EQ(2u, SrvAddrMgr().getJournalCount());
+
+    // the same REPLY (lifetimes are the same), only with new transaction-id
+    string expected = reply->getSentData();
+    ASSERT_LT(4u, expected.size());
+    expected[3] = 0x9;
+    const Pkt6Info& pkt = ifacemgr_->sent_pkts_.back();
+    string data(pkt.Data_.begin(), pkt.Data_.end());
+    EXPECT_EQ(expected, data);
+    EXPECT_EQ(DHCPCLIENT_PORT, pkt.Port_);
+
+    // templated REPLY is remembered in reply cache, too
+    transmgr_->relayMsg((Ptr*)renew2);
+    EXPECT_EQ(1u, transmgr_->getReplyCache().getHits());
+    EXPECT_EQ(1u, templates.getHits());
+
+    // renewed too early: remaining lifetimes are written to the template
+    SrvCfgMgr().setLeaseReuse(50);
+    assigned = (unsigned long)time(NULL) - 100;
+    ia->setTimestamp(assigned);
+    addr->setTimestamp(assigned);
+
+    hdr[3] = 0xa;
+    SPtr<TSrvMsgRenew> renew3 = new TSrvMsgRenew(iface_->getID(), clntAddr_, hdr, sizeof(hdr));
+    renew3->addOption((Ptr*)clntId_);
+    renew3->addOption((Ptr*)ia_);
+    renew3->addOption(adv->getOption(OPTION_SERVERID));
+    transmgr_->relayMsg((Ptr*)renew3);
+    EXPECT_EQ(3u, transmgr_->getMsgLst().size());
+    EXPECT_EQ(2u, templates.getHits());
+    ASSERT_EQ(sent + 3, ifacemgr_->sent_pkts_.size());
+
+    // lease is not touched
+    EXPECT_EQ(assigned, ia->getTimestamp());
+    EXPECT_EQ((long)assigned, addr->getTimestamp());
+    EXPECT_EQ(2u, SrvAddrMgr().getJournalCount());
+
+    const Pkt6Info& pkt3 = ifacemgr_->sent_pkts_.back();
+    data.assign(pkt3.Data_.begin(), pkt3.Data_.end());
+    ASSERT_EQ(expected.size(), data.size());
+    EXPECT_EQ(0xa, data[3]);
+    size_t optIA = findOpt(data, 4, data.size(), OPTION_IA_NA);
+    ASSERT_TRUE(optIA);
+    EXPECT_GE(900u, readUint32(data.c_str() + optIA + 8));
+    EXPECT_LE(890u, readUint32(data.c_str() + optIA + 8));
+    size_t optAddr = findOpt(data, optIA + 16, optIA + 4 + readUint16(data.c_str() + optIA + 2),
+                             OPTION_IAADDR);
+    ASSERT_TRUE(optAddr);
+    EXPECT_GE(3900u, readUint32(data.c_str() + optAddr + 24));
+    EXPECT_LE(3890u, readUint32(data.c_str() + optAddr + 24));
+}
+
+// checks that template is not used when client's leases changed and that
+// it is replaced with the new REPLY then
+TEST_F(ServerTest, RenewTemplate_leaseChanged) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    TSrvReplyTemplates& templates = transmgr_->getReplyTemplates();
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    ASSERT_TRUE(sendAndReceive((Ptr*)req, 2));
+
+    SPtr<TSrvMsgRenew> renew = createRenew();
+    renew->addOption((Ptr*)clntId_);
+    renew->addOption((Ptr*)ia_);
+    renew->addOption(adv->getOption(OPTION_SERVERID));
+    ASSERT_TRUE(sendAndReceive((Ptr*)renew, 3));
+    EXPECT_EQ(1u, templates.count());
+
+    // client got another address in the meantime
+    SPtr<TAddrIA> ia = SrvAddrMgr().getClient(clntDuid_)->getIA(ia_iaid_);
+    ASSERT_TRUE(ia);
+    SPtr<TIPv6Addr> other = new TIPv6Addr("2001:db8:123::abcd", true);
+    ia->addAddr(other, 3000, 4000);
+
+    // so RENEW is processed as usual and both addresses are sent
+    transmgr_->getReplyCache().clear();
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)renew, 4);
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(0u, templates.getHits());
+    EXPECT_EQ(2u, templates.getMisses());
+    SPtr<TSrvOptIA_NA> rcvIA = (Ptr*) reply->getOption(OPTION_IA_NA);
+    ASSERT_TRUE(rcvIA);
+    EXPECT_EQ(2, rcvIA->countAddrs());
+
+    // new REPLY replaced the template
+    EXPECT_EQ(1u, templates.count());
+    transmgr_->getReplyCache().clear();
+    size_t sent = ifacemgr_->sent_pkts_.size();
+    transmgr_->relayMsg((Ptr*)renew);
+    EXPECT_EQ(4u, transmgr_->getMsgLst().size());
+    EXPECT_EQ(1u, templates.getHits());
+    ASSERT_EQ(sent + 1, ifacemgr_->sent_pkts_.size());
+    const Pkt6Info& pkt = ifacemgr_->sent_pkts_.back();
+    EXPECT_EQ(reply->getSentData().size(), pkt.Data_.size());
+
+    // templates can be disabled
+    templates.setLimit(0);
+    EXPECT_EQ(0u, templates.count());
+    transmgr_->getReplyCache().clear();
+    ASSERT_TRUE(sendAndReceive((Ptr*)renew, 5));
+    EXPECT_EQ(1u, templates.getHits());
+    EXPECT_EQ(0u, templates.count());
+}
+
+} // end of test namespace
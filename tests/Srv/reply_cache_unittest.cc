@@ -0,0 +1,117 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "SrvTransMgr.h"
+#include "SrvReplyCache.h"
+#include "OptDUID.h"
+#include "DHCPDefaults.h"
+#include "assign_utils.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+// checks that retransmitted REQUEST gets the same REPLY again, without
+// being processed once more
+TEST_F(ServerTest, SARR_request_retransmitted) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    TSrvReplyCache& cache = SrvTransMgr().getReplyCache();
+    EXPECT_EQ(0u, cache.count());
+
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ia_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ia_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+    EXPECT_EQ(0u, cache.getHits());
+    EXPECT_EQ(2u, cache.getMisses());
+
+    // both ADVERTISE and REPLY were remembered by relayMsg()
+    ASSERT_FALSE(reply->getSentData().empty());
+    EXPECT_EQ(2u, cache.count());
+
+    // retransmission is answered from cache, not processed
+    size_t sent = ifacemgr_->sent_pkts_.size();
+    transmgr_->relayMsg((Ptr*)req);
+    EXPECT_EQ(2u, transmgr_->getMsgLst().size());
+    EXPECT_EQ(1u, cache.getHits());
+    ASSERT_EQ(sent + 1, ifacemgr_->sent_pkts_.size());
+    const Pkt6Info& pkt = ifacemgr_->sent_pkts_.back();
+    EXPECT_EQ(reply->getSentData(), string(pkt.Data_.begin(), pkt.Data_.end()));
+    EXPECT_EQ(DHCPCLIENT_PORT, pkt.Port_);
+
+    // new transaction (different transid) is processed as usual
+    SPtr<TSrvMsgRenew> renew = createRenew();
+    renew->addOption((Ptr*)clntId_);
+    renew->addOption((Ptr*)ia_);
+    renew->addOption(adv->getOption(OPTION_SERVERID));
+    ASSERT_TRUE(sendAndReceive((Ptr*)renew, 3));
+    EXPECT_EQ(1u, cache.getHits());
+    EXPECT_EQ(3u, cache.getMisses());
+}
+
+// checks that cached replies expire and that cache size is limited
+TEST_F(ServerTest, ReplyCache_limits) {
+
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:123::/64 }\n"
+                 "}\n";
+
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    TSrvReplyCache cache;
+    SPtr<TSrvMsg> req = (Ptr*)createRequest();
+    req->addOption((Ptr*)clntId_);
+    SPtr<TSrvMsg> renew = (Ptr*)createRenew();
+    renew->addOption((Ptr*)clntId_);
+
+    // anonymous messages are not cached
+    SPtr<TSrvMsg> anon = (Ptr*)createRequest();
+    cache.add(anon, "reply", iface_->getID(), DHCPCLIENT_PORT, 1000);
+    EXPECT_EQ(0u, cache.count());
+
+    cache.add(req, "reply", iface_->getID(), DHCPCLIENT_PORT, 1000);
+    EXPECT_EQ(1u, cache.count());
+    EXPECT_FALSE(cache.resend(renew, 1000));
+    EXPECT_TRUE(cache.resend(req, 1000 + SERVER_DEFAULT_REPLY_CACHE_TTL - 1));
+    EXPECT_FALSE(cache.resend(req, 1000 + SERVER_DEFAULT_REPLY_CACHE_TTL));
+    EXPECT_EQ(0u, cache.count());
+    EXPECT_EQ(1u, cache.getHits());
+    EXPECT_EQ(2u, cache.getMisses());
+
+    // only one reply fits, the oldest one is dropped
+    cache.setLimits(30, 1);
+    cache.add(req, "reply", iface_->getID(), DHCPCLIENT_PORT, 2000);
+    cache.add(renew, "reply", iface_->getID(), DHCPCLIENT_PORT, 2001);
+    EXPECT_EQ(1u, cache.count());
+    EXPECT_FALSE(cache.resend(req, 2002));
+    EXPECT_TRUE(cache.resend(renew, 2002));
+
+    // 0 disables the cache
+    cache.setLimits(0, 1);
+    EXPECT_EQ(0u, cache.count());
+    cache.add(req, "reply", iface_->getID(), DHCPCLIENT_PORT, 3000);
+    EXPECT_FALSE(cache.resend(req, 3000));
+}
+
+}
@@ -0,0 +1,257 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <set>
+#include <fstream>
+#include <sstream>
+#include "SrvTARing.h"
+#include "SrvAddrMgr.h"
+#include "AddrClient.h"
+#include "assign_utils.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace test {
+
+// checks that the ring offers every address of a small pool once per cycle
+TEST(TARingTest, basic) {
+    SPtr<THostRange> pool = new THostRange(new TIPv6Addr("2001:db8::1", true),
+                                           new TIPv6Addr("2001:db8::10", true));
+    TSrvTARing ring(pool, 100, 12345);
+    ASSERT_EQ(16u, ring.size());
+    EXPECT_EQ(0u, ring.count());
+
+    SPtr<TDUID> duid = new TDUID("00:01:00:00:00:00:00:00:00:00:00:01");
+    set<string> seen;
+    TSrvTARing::TLease lease;
+    for (unsigned int i = 0; i < 16; i++) {
+        ASSERT_TRUE(ring.next(1000, 100, lease));
+        EXPECT_FALSE(lease.Duid);
+        EXPECT_TRUE(pool->in(lease.Addr));
+        EXPECT_TRUE(ring.contains(lease.Addr));
+        EXPECT_TRUE(ring.isFree(lease.Addr, 1000));
+        seen.insert(lease.Addr->getPlain());
+        EXPECT_TRUE(ring.assign(lease.Addr, duid, i, 1, 2000));
+        EXPECT_FALSE(ring.isFree(lease.Addr, 1000));
+    }
+    EXPECT_EQ(16u, seen.size());
+    EXPECT_EQ(16u, ring.count());
+
+    // ring is full
+    EXPECT_FALSE(ring.next(1000, 100, lease));
+    EXPECT_FALSE(ring.contains(new TIPv6Addr("2001:db8::11", true)));
+    EXPECT_FALSE(ring.assign(new TIPv6Addr("2001:db8::11", true), duid, 1, 1, 2000));
+
+    // only the owner may release an address
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8::5", true);
+    ASSERT_TRUE(ring.get(addr, lease));
+    EXPECT_FALSE(ring.release(addr, duid, lease.Iaid + 1));
+    EXPECT_FALSE(ring.release(addr, new TDUID("00:01:00:00:00:00:00:00:00:00:00:02"),
+                              lease.Iaid));
+    EXPECT_TRUE(ring.release(addr, duid, lease.Iaid));
+    EXPECT_EQ(15u, ring.count());
+
+    // released address is offered again
+    ASSERT_TRUE(ring.next(1000, 100, lease));
+    EXPECT_EQ(string("2001:db8::5"), lease.Addr->getPlain());
+}
+
+// checks that expired leases are offered again and stale handles are ignored
+TEST(TARingTest, generation) {
+    SPtr<THostRange> pool = new THostRange(new TIPv6Addr("2001:db8::1", true),
+                                           new TIPv6Addr("2001:db8::1", true));
+    TSrvTARing ring(pool, 100, 1);
+    ASSERT_EQ(1u, ring.size());
+
+    SPtr<TDUID> duid1 = new TDUID("00:01:00:00:00:00:00:00:00:00:00:01");
+    SPtr<TDUID> duid2 = new TDUID("00:01:00:00:00:00:00:00:00:00:00:02");
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8::1", true);
+
+    TSrvTARing::TLease lease;
+    EXPECT_TRUE(ring.assign(addr, duid1, 1, 1, 2000));
+    EXPECT_FALSE(ring.next(1999, 100, lease));
+
+    // expired lease is offered, with its previous owner
+    ASSERT_TRUE(ring.next(2000, 100, lease));
+    EXPECT_EQ(string("2001:db8::1"), lease.Addr->getPlain());
+    ASSERT_TRUE(lease.Duid);
+    EXPECT_EQ(duid1->getPlain(), lease.Duid->getPlain());
+    EXPECT_TRUE(ring.isFree(addr, 2000));
+
+    // address changed owner, so old handle is stale
+    EXPECT_TRUE(ring.assign(addr, duid2, 2, 1, 5000));
+    EXPECT_FALSE(ring.release(lease));
+    EXPECT_FALSE(ring.release(addr, duid1, 1));
+    EXPECT_EQ(1u, ring.count());
+
+    TSrvTARing::TLease current;
+    ASSERT_TRUE(ring.get(addr, current));
+    EXPECT_NE(lease.Generation, current.Generation);
+    EXPECT_TRUE(ring.release(current));
+    EXPECT_EQ(0u, ring.count());
+    EXPECT_FALSE(ring.release(current));
+}
+
+// checks that large pools are covered partially, in shuffled order
+TEST(TARingTest, largePool) {
+    SPtr<THostRange> pool = new THostRange(new TIPv6Addr("2001:db8::", true),
+                                           new TIPv6Addr("2001:db8::ffff:ffff:ffff:ffff", true));
+    TSrvTARing ring(pool, 1000, 777);
+    ASSERT_EQ(1000u, ring.size());
+
+    set<string> seen;
+    unsigned int sequential = 0;
+    TSrvTARing::TLease lease, prev;
+    for (unsigned int i = 0; i < 1000; i++) {
+        ASSERT_TRUE(ring.next(0, 1, lease));
+        EXPECT_TRUE(ring.contains(lease.Addr));
+        EXPECT_EQ(i, lease.Slot);
+        seen.insert(lease.Addr->getPlain());
+        if (i && *lease.Addr == *(prev.Addr) + TIPv6Addr("::1", true))
+            sequential++;
+        prev = lease;
+    }
+    EXPECT_EQ(1000u, seen.size());
+    EXPECT_GT(10u, sequential);
+
+    // next cycle starts over
+    ASSERT_TRUE(ring.next(0, 1, lease));
+    EXPECT_EQ(0u, lease.Slot);
+
+    // rings of size 0 never offer anything
+    TSrvTARing empty(pool, 0, 777);
+    EXPECT_EQ(0u, empty.size());
+    EXPECT_FALSE(empty.next(0, 100, lease));
+    EXPECT_FALSE(empty.contains(lease.Addr));
+}
+
+// checks that temporary addresses are assigned from the ring and expired
+// ones are reclaimed when the ring gets to them
+TEST_F(ServerTest, SARR_ta_ring) {
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:1::/64 }\n"
+                 "  ta-class { pool 2001:db8:3::1-2001:db8:3::1 }\n"
+                 "}\n";
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(iface_->getID());
+    ASSERT_TRUE(cfgIface);
+    cfgIface->firstTA();
+    SPtr<TSrvCfgTA> ta = cfgIface->getTA();
+    ASSERT_TRUE(ta);
+
+    // lease of other client that has expired already
+    SPtr<TDUID> other = new TDUID("00:01:00:00:00:00:00:00:00:00:00:01");
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8:3::1", true);
+    ASSERT_TRUE(addrmgr_->addTAAddr(other, clntAddr_, iface_->getID(), 7, addr, 0, 0));
+    EXPECT_FALSE(addrmgr_->taAddrIsFree(addr));
+
+    SPtr<TSrvTARing> ring = addrmgr_->getTARing(ta);
+    ASSERT_TRUE(ring);
+    EXPECT_EQ(1u, ring->size());
+    EXPECT_EQ(1u, ring->count());
+
+    // address of expired lease is offered, but the lease is kept
+    SPtr<TSrvMsgSolicit> sol = createSolicit();
+    sol->addOption((Ptr*)clntId_);
+    sol->addOption((Ptr*)ta_);
+    SPtr<TSrvMsgAdvertise> adv = (Ptr*)sendAndReceive((Ptr*)sol, 1);
+    ASSERT_TRUE(adv);
+
+    SPtr<TOptTA> advTA = (Ptr*) adv->getOption(OPTION_IA_TA);
+    ASSERT_TRUE(advTA);
+    SPtr<TOptIAAddress> advAddr = (Ptr*) advTA->getOption(OPTION_IAADDR);
+    ASSERT_TRUE(advAddr);
+    EXPECT_EQ(string("2001:db8:3::1"), advAddr->getAddr()->getPlain());
+    EXPECT_TRUE(addrmgr_->getClient(other));
+    EXPECT_FALSE(addrmgr_->getClient(clntDuid_));
+
+    // expired lease is removed when address is requested
+    SPtr<TSrvMsgRequest> req = createRequest();
+    req->addOption((Ptr*)clntId_);
+    req->addOption((Ptr*)ta_);
+    req->addOption(adv->getOption(OPTION_SERVERID));
+    SPtr<TSrvMsgReply> reply = (Ptr*)sendAndReceive((Ptr*)req, 2);
+    ASSERT_TRUE(reply);
+
+    SPtr<TOptTA> rcvTA = (Ptr*) reply->getOption(OPTION_IA_TA);
+    ASSERT_TRUE(rcvTA);
+    SPtr<TOptIAAddress> rcvAddr = (Ptr*) rcvTA->getOption(OPTION_IAADDR);
+    ASSERT_TRUE(rcvAddr);
+    EXPECT_EQ(string("2001:db8:3::1"), rcvAddr->getAddr()->getPlain());
+
+    EXPECT_FALSE(addrmgr_->getClient(other));
+    SPtr<TAddrClient> client = addrmgr_->getClient(clntDuid_);
+    ASSERT_TRUE(client);
+    EXPECT_EQ(1, client->countTA());
+    EXPECT_EQ(1u, ring->count());
+    EXPECT_FALSE(addrmgr_->taAddrIsFree(addr));
+    EXPECT_TRUE(addrmgr_->verifyLeaseCounters());
+
+    // reclaimed lease waits for expire notify
+    std::vector<TSrvAddrMgr::TExpiredInfo> expired;
+    addrmgr_->getReclaimedTA(expired);
+    ASSERT_EQ(1u, expired.size());
+    EXPECT_EQ(other->getPlain(), expired[0].client->getDUID()->getPlain());
+    EXPECT_EQ(string("2001:db8:3::1"), expired[0].addr->getPlain());
+    expired.clear();
+    addrmgr_->getReclaimedTA(expired);
+    EXPECT_TRUE(expired.empty());
+
+    // the only address is taken
+    EXPECT_FALSE(addrmgr_->allocTAAddr(ta, expired));
+    EXPECT_TRUE(expired.empty());
+
+    EXPECT_TRUE(addrmgr_->delTAAddr(clntDuid_, ta_iaid_, addr, true));
+    EXPECT_EQ(0u, ring->count());
+    EXPECT_TRUE(addrmgr_->taAddrIsFree(addr));
+    SPtr<TIPv6Addr> next = addrmgr_->allocTAAddr(ta, expired);
+    ASSERT_TRUE(next);
+    EXPECT_EQ(string("2001:db8:3::1"), next->getPlain());
+}
+
+// checks that TA leases are not stored in the database, if configured so
+TEST_F(ServerTest, taMemoryOnly) {
+    string cfg = "iface REPLACE_ME {\n"
+                 "  class { pool 2001:db8:1::/64 }\n"
+                 "  ta-class { pool 2001:db8:3::/64 }\n"
+                 "}\n";
+    ASSERT_TRUE( createMgrs(cfg) );
+
+    SPtr<TDUID> other = new TDUID("00:01:00:00:00:00:00:00:00:00:00:01");
+    int ifindex = iface_->getID();
+    ASSERT_TRUE(addrmgr_->addClntAddr(clntDuid_, clntAddr_, ifindex, 1, 100, 200,
+                                      new TIPv6Addr("2001:db8:1::1", true), 300, 400, true));
+    ASSERT_TRUE(addrmgr_->addTAAddr(clntDuid_, clntAddr_, ifindex, 2,
+                                    new TIPv6Addr("2001:db8:3::1", true), 300, 400));
+    ASSERT_TRUE(addrmgr_->addTAAddr(other, clntAddr_, ifindex, 2,
+                                    new TIPv6Addr("2001:db8:3::2", true), 300, 400));
+
+    SrvCfgMgr().setTAMemoryOnly(true);
+    addrmgr_->dump();
+    stringstream db;
+    db << ifstream("testdata/server-AddrMgr.xml").rdbuf();
+    EXPECT_NE(string::npos, db.str().find("2001:db8:1::1"));
+    EXPECT_EQ(string::npos, db.str().find("2001:db8:3::1"));
+    EXPECT_EQ(string::npos, db.str().find("2001:db8:3::2"));
+    EXPECT_EQ(string::npos, db.str().find(other->getPlain()));
+
+    // leases are still known
+    EXPECT_FALSE(addrmgr_->taAddrIsFree(new TIPv6Addr("2001:db8:3::2", true)));
+
+    SrvCfgMgr().setTAMemoryOnly(false);
+    addrmgr_->dump();
+    stringstream db2;
+    db2 << ifstream("testdata/server-AddrMgr.xml").rdbuf();
+    EXPECT_NE(string::npos, db2.str().find("2001:db8:3::1"));
+    EXPECT_NE(string::npos, db2.str().find("2001:db8:3::2"));
+}
+
+}